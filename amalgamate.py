@@ -22,6 +22,8 @@ DEFAULT_FILES = [
     'license.txt',
     'src/utils.h',
     'src/utils.cpp',
+    'src/instrument.h',
+    'src/instrument.cpp',
     'src/extra_types.h',
     'src/h5wrap.h',
     'src/state_map.cpp',
@@ -40,6 +42,8 @@ DEFAULT_FILES = [
     'src/jsoncpp.cpp',
     'src/jsoncustomwriter.h',
     'src/jsoncustomwriter.cpp',
+    'src/comp_vector.h',
+    'src/comp_vector.cpp',
     'src/material.h',
     'src/material.cpp',
     'src/enrichment_cascade.h',
@@ -47,7 +51,7 @@ DEFAULT_FILES = [
     'src/enrichment.h',
     'src/enrichment.cpp',
     'src/enrichment_symbolic.h',
-    'src/enrichment_symbolic20.cpp',
+    'src/enrichment_symbolic.cpp',
     'src/_decay.h',
     'src/_decay.cpp',
     ]
@@ -28,6 +28,11 @@ macro(pyne_setup_cxx)
     MESSAGE(FATAL_ERROR "The compiler ${CMAKE_CXX_COMPILER} has no C++11 support. "
                         "Please use a different C++ compiler.")
   ENDIF()
+  # honor "#pragma omp simd" in vectorized kernels without requiring OpenMP
+  CHECK_CXX_COMPILER_FLAG("-fopenmp-simd" COMPILER_SUPPORTS_OPENMP_SIMD)
+  IF(COMPILER_SUPPORTS_OPENMP_SIMD)
+    SET(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -fopenmp-simd")
+  ENDIF()
 endmacro()
 
 macro(pyne_set_asm_platform)
@@ -222,6 +227,18 @@ macro(pyne_set_fast_compile)
 endmacro()
 
 
+# opt-in instrumentation counters and timers, see src/instrument.h
+macro(pyne_set_instrument)
+  if(NOT DEFINED PYNE_INSTRUMENT)
+    set(PYNE_INSTRUMENT FALSE)
+  endif()
+  if(PYNE_INSTRUMENT)
+    add_definitions(-DPYNE_INSTRUMENT)
+  endif()
+  message(STATUS "PyNE Instrumentation: ${PYNE_INSTRUMENT}")
+endmacro()
+
+
 # fast compile with assembly, if available.
 macro(fast_compile _srcname _gnuflags _clangflags _otherflags)
   get_filename_component(_base "${_srcname}" NAME_WE)  # get the base name, without the extension
@@ -7,7 +7,10 @@ from libc.string cimport strtok, strcpy, strncpy
 
 cimport numpy as np
 cimport pyne.cpp_utils
+from libcpp.string cimport string as std_string
 from cython.operator cimport dereference as deref
+import json
+
 import numpy as np
 
 def fromstring_split(s, sep=None, dtype=float):
@@ -150,18 +153,12 @@ def fromendf_tok(s):
     if isinstance(s, str):
         s = s.encode()
     cs = s
-    cdef int i, num_entries
-    cdef char entry[12]
-    cdef long pos = 0
+    cdef int i, num_lines
     cdef np.ndarray[np.float64_t, ndim=1] cdata
-    i = 0
-    num_entries = len(cs)//81 * 6
-    cdata = np.empty(num_entries, dtype=np.float64)
-    while i < num_entries:
-        pos = i*11 + i//6 * 15
-        strncpy(entry, cs+pos, 11)
-        cdata[i] = pyne.cpp_utils.endftod(entry)
-        i += 1
+    num_lines = len(cs)//81
+    cdata = np.empty(num_lines * 6, dtype=np.float64)
+    for i in range(num_lines):
+        pyne.cpp_utils.endftod_record(cs + i*81, &cdata[i*6])
     return cdata
 
 def fromendl_tok(s, num_fields):
@@ -208,4 +205,24 @@ def toggle_warnings():
     """Toggles warnings on and off
     """
     return pyne.cpp_utils.toggle_warnings()
-   
+
+
+def stats():
+    """Returns the instrumentation counters and timers of the C++ library,
+    which are only collected when it was built with PYNE_INSTRUMENT (e.g.
+    ``setup.py --instrument``).
+
+    Returns
+    -------
+    stats : dict
+        With an 'enabled' flag, a 'counters' dict of event counts and a
+        'timers' dict of {'calls', 'ns'} dicts, keyed by name. Without
+        instrumentation all counts are zero.
+    """
+    cdef std_string s = pyne.cpp_utils.stats()
+    return json.loads(s.decode())
+
+
+def reset_stats():
+    """Zeroes the instrumentation counters and timers of the C++ library."""
+    pyne.cpp_utils.reset_stats()
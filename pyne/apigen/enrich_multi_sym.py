@@ -3,6 +3,11 @@ Note that there is a bug in sympy v0.7.2 that prevents the cse() function
 from being used with infinities.  For a work around see [1].
 
 1. https://groups.google.com/forum/#!msg/sympy/YL1R_hR6OKQ/axKrCsCSMQsJ
+
+PyNE no longer ships the generated sources. src/enrichment_symbolic.cpp
+evaluates the same expressions over the feed nuclides at run time, taking the
+derivatives of the NP constraint in forward mode, so this module is kept as
+the derivation of that solver.
 """
 from __future__ import print_function, division
 import os
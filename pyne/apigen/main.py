@@ -6,18 +6,12 @@ from pyne.utils import QAWarning
 warn(__name__ + " is not yet QA compliant.", QAWarning)
 
 def main():
+    # The symbolic enrichment cascades are no longer generated: solve_symbolic()
+    # evaluates the solution of enrich_multi_sym at run time, and
+    # src/enrichment_symbolic.h is written by hand.
     parser = argparse.ArgumentParser("Generates PyNE API")
     parser.add_argument('--debug', action='store_true', default=False)
-    parser.add_argument('--enrich', action='store_true', default=False)
     ns = parser.parse_args()
 
-    if ns.enrich:
-        print("generating symbolic enrichment cascades")
-        import enrich_multi_sym
-        enrich_multi_sym.cgen_file(filename="cpp/enrichment_symbolic15", 
-                                   header_filename="cpp/enrichment_symbolic.h",
-                                   max_ncomp=15, 
-                                   debug=ns.debug)
-
 if __name__ == '__main__':
     main()
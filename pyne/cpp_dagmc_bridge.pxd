@@ -16,6 +16,20 @@ cdef extern from "dagmc_bridge.h" namespace "pyne":
 
     ctypedef double vec3[3]
 
+    int DAG_VOL_GRAVEYARD
+    int DAG_VOL_IMPLICIT_COMPLEMENT
+    int DAG_VOL_NO_BOUNDARY
+
+    ctypedef struct dag_volume_info:
+        int id
+        EntityHandle handle
+        int material
+        double density
+        double importance
+        double bbox_min[3]
+        double bbox_max[3]
+        int flags
+
     int dag_ent_handle_size() except +
     float dag_version() except +
     extra_types.uint32 dag_rev_version() except +
@@ -27,6 +41,7 @@ cdef extern from "dagmc_bridge.h" namespace "pyne":
                             const void* history) except +
     void* dag_alloc_ray_history() except +
     void dag_dealloc_ray_history(void* history) except +
+    void* dag_alloc_ray_buffer() except +
     void dag_dealloc_ray_buffer(void* data_buffers) except +
     ErrorCode dag_ray_fire(EntityHandle vol, vec3 ray_start, vec3 ray_dir,
                            EntityHandle* next_surf, double* next_surf_dist,
@@ -35,6 +50,20 @@ cdef extern from "dagmc_bridge.h" namespace "pyne":
                              double distance_limit, int* num_intersections,
                              EntityHandle** surfs, double** distances,
                              EntityHandle** volumes, void* data_buffers) except +
+    ErrorCode dag_ray_follow_many(const EntityHandle* firstvols,
+                                  const double* ray_starts, const double* ray_dirs,
+                                  int num_rays, double distance_limit, int** offsets,
+                                  EntityHandle** surfs, double** distances,
+                                  EntityHandle** volumes, void* data_buffers) except +
+    void* dag_alloc_discretize_buffer() except +
+    void dag_dealloc_discretize_buffer(void* data_buffers) except +
+    ErrorCode dag_ray_discretize(const double* x_divs, int num_x,
+                                 const double* y_divs, int num_y,
+                                 const double* z_divs, int num_z, int num_rays,
+                                 int grid, unsigned long seed, int num_threads,
+                                 int* num_results, int** ves, int** cells,
+                                 double** vol_fracs, double** rel_errors,
+                                 void* data_buffers) nogil except +
     ErrorCode dag_next_vol(EntityHandle surface, EntityHandle volume,
                            EntityHandle* next_vol) except +
     int vol_is_graveyard(EntityHandle vol) except +
@@ -42,3 +71,5 @@ cdef extern from "dagmc_bridge.h" namespace "pyne":
     ErrorCode get_volume_metadata(EntityHandle vol, int* material, double* density, 
                                   double* importance) except +
     ErrorCode get_volume_boundary(EntityHandle vol, vec3 minPt, vec3 maxPt) except +
+    ErrorCode dag_build_volume_table() except +
+    const dag_volume_info* dag_volume_table(int* num_volumes) except +
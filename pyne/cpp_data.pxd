@@ -3,6 +3,7 @@ from libcpp cimport bool
 from libcpp.utility cimport pair
 from libcpp.string cimport string as std_string
 from libcpp.map cimport map
+from libcpp.memory cimport shared_ptr
 from libcpp.set cimport set
 from libcpp.vector cimport vector
 
@@ -104,6 +105,17 @@ cdef extern from "data.h" namespace "pyne":
     double fpyield(char *, char *, int, bool) except +
     double fpyield(std_string, std_string, int, bool) except +
 
+    cdef cppclass FissionYieldMatrix:
+        int num_parents() const
+        int num_products() const
+        vector[int] parents() const
+        vector[int] products() const
+        int row_size(int) const
+        const int * row_products(int) const
+        const double * row_yields(int) const
+
+    const FissionYieldMatrix & fpyield_matrix(int, bool) except +
+
     # atomic data functions
     vector[pair[double, double]] calculate_xray_data(int, double,
                                                      double) except +
@@ -133,6 +145,16 @@ cdef extern from "data.h" namespace "pyne":
     int metastable_id(int, int) except +
     int metastable_id(int) except +
 
+    cdef cppclass DecayGraph:
+        int size() const
+        const vector[int] & nucs() const
+        double decay_const(int) const
+        int num_children(int) const
+        const int * children(int) const
+        const double * branch_ratios(int) const
+
+    shared_ptr[const DecayGraph] decay_graph() except +
+
     int id_from_level(int, double) except +
     int id_from_level(int, double, std_string) except +
 
@@ -163,6 +185,17 @@ cdef extern from "data.h" namespace "pyne":
     vector[int] gamma_child(int parent) except +
     vector[pair[double, double]] gamma_xrays(int parent) except +
 
+    cdef cppclass GammaLineIndex:
+        int size() const
+        double energy(int) const
+        double intensity(int) const
+        int parent(int) const
+        int child(int) const
+        void match(int, const double *, const double *, vector[int] &,
+                   vector[int] &, bool) const
+
+    shared_ptr[const GammaLineIndex] gamma_line_index() except +
+
     vector[double] alpha_energy(int parent) except +
     vector[double] alpha_intensity(int parent) except +
     vector[int] alpha_parent(double energy, double error) except +
@@ -184,3 +217,17 @@ cdef extern from "data.h" namespace "pyne":
     vector[int] ecbp_child(double energy, double error) except +
     vector[int] ecbp_child(int parent) except +
     vector[pair[double, double]] ecbp_xrays(int parent) except +
+
+    cdef cppclass NucPropertyTable:
+        int size()
+        void clear()
+
+    NucPropertyTable nuc_property_table
+
+    # preloading
+    void preload_nuc_data(vector[std_string] tables) nogil except +
+    void clear_miss_caches()
+
+    # snapshots
+    void write_nuc_data_snapshot(std_string filename) except +
+    bool load_nuc_data_snapshot(std_string filename, bool create) except +
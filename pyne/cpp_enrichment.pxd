@@ -1,5 +1,7 @@
 """Cython header for enrichment library."""
+from libcpp cimport bool as cpp_bool
 from libcpp.string cimport string as std_string
+from libcpp.vector cimport vector
 
 from pyne cimport cpp_material
 
@@ -52,6 +54,26 @@ cdef extern from "enrichment.h" namespace "pyne::enrichment":
     double swu_per_feed(double, double, double) except +
     double swu_per_prod(double, double, double) except +
     double swu_per_tail(double, double, double) except +
+
+    void feed_per_prod_n(const double *, const double *, const double *,
+                         double *, size_t) nogil
+    void feed_per_tail_n(const double *, const double *, const double *,
+                         double *, size_t) nogil
+    void prod_per_feed_n(const double *, const double *, const double *,
+                         double *, size_t) nogil
+    void prod_per_tail_n(const double *, const double *, const double *,
+                         double *, size_t) nogil
+    void tail_per_feed_n(const double *, const double *, const double *,
+                         double *, size_t) nogil
+    void tail_per_prod_n(const double *, const double *, const double *,
+                         double *, size_t) nogil
+    void value_func_n(const double *, double *, size_t) nogil
+    void swu_per_feed_n(const double *, const double *, const double *,
+                        double *, size_t) nogil
+    void swu_per_prod_n(const double *, const double *, const double *,
+                        double *, size_t) nogil
+    void swu_per_tail_n(const double *, const double *, const double *,
+                        double *, size_t) nogil
     
     double alphastar_i(double, double, double) except +
 
@@ -71,3 +93,6 @@ cdef extern from "enrichment.h" namespace "pyne::enrichment":
     Cascade multicomponent(Cascade &, std_string) except +
     Cascade multicomponent(Cascade &, std_string, double) except +
     Cascade multicomponent(Cascade &, std_string, double, int) except +
+
+    vector[Cascade] multicomponent_many(vector[Cascade] &, std_string, double,
+                                        int, cpp_bool, int) nogil except +
@@ -98,6 +98,7 @@ cdef extern from "material.h" namespace "pyne":
         Material sub_tru() except +
         Material sub_ma() except +
         Material sub_fp() except +
+        vector[double] group_masses(vector[std_set[int]]) except +
 
         # Atom frac member functions
         map[int, double] to_atom_frac() except +
@@ -109,13 +110,56 @@ cdef extern from "material.h" namespace "pyne":
         vector[pair[double, double]] gammas() except +
         vector[pair[double, double]] xrays() except +
         vector[pair[double, double]] photons(bool) except +
+        vector[double] photon_source(vector[double], bool) except +
 
         Material decay(double) except +
+        vector[Material] decay(vector[double]) except +
+        MaterialSeries decay_series(vector[double]) except +
         Material cram(vector[double]) except +
         Material cram(vector[double], int) except +
+        MaterialSeries cram_series(vector[double], vector[double], int) except +
+        MaterialSeries cram_series(vector[double], int) except +
 
         # Operator Overloads
         Material operator+(double) except +
         Material operator+(Material) except +
         Material operator*(double) except +
         Material operator/(double) except +
+
+    cdef cppclass MaterialSeries:
+        vector[double] times
+        vector[int] nucs
+        vector[double] moles
+        int size()
+        vector[double] activity() except +
+        vector[double] decay_heat() except +
+
+    void expand_elements(vector[Material] &, std_set[int], int) nogil except +
+    void collapse_elements(vector[Material] &, std_set[int], int) nogil except +
+    void transmute_all(vector[Material] &, vector[double], int) nogil except +
+    vector[double] photon_sources(vector[Material] &, vector[double], bool, int) nogil except +
+    void write_mcnp(std_string, vector[Material] &, std_string, bool, int) nogil except +
+    void write_fluka(std_string, vector[Material] &, int, std_string, int) nogil except +
+    void read_json_library(char *, char *, vector[std_string] &, vector[Material] &) nogil except +
+    void read_json_library(std_string, vector[std_string] &, vector[Material] &) nogil except +
+    void write_json_library(std_string, vector[std_string] &, vector[Material] &) nogil except +
+
+    cdef cppclass MaterialTable:
+        MaterialTable(std_string, std_string, int, int) except +
+        int size()
+        Material material(int) except +
+
+    void write_hdf5_rows(vector[Material] &, std_string, std_string, int, int, bool) except +
+
+    void write_binary_library(vector[Material] &, std_string) except +
+
+    cdef cppclass BinaryMaterialLibrary:
+        BinaryMaterialLibrary(std_string) except +
+        int size()
+        Material material(int) except +
+
+
+ctypedef const Material * const_Material_ptr
+
+cdef extern from "material.h" namespace "pyne":
+    Material mix(vector[const_Material_ptr], vector[double]) except +
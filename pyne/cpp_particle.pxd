@@ -15,6 +15,7 @@ cdef extern from "particle.h" namespace "pyne::particle":
     map[int, std_string] id_name
     map[std_string, int] name_id
     map[std_string, std_string] docs
+    void ensure_maps() except +
 
     # functions
     # is_hydrogen
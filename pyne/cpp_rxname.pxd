@@ -17,6 +17,7 @@ cdef extern from "rxname.h" namespace "pyne::rxname":
     map[extra_types.uint32, extra_types.uint32] mt_id
     map[extra_types.uint32, std_string] labels
     map[extra_types.uint32, std_string] docs
+    void ensure_maps() except +
 
     extra_types.uint32 hash(std_string) except +
     extra_types.uint32 hash(const_char *) except +
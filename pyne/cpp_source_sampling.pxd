@@ -19,6 +19,7 @@ cdef extern from "source_sampling.h" namespace "pyne":
         # constructors
         AliasTable() except +
         AliasTable(cpp_vector[double]) except +
+        AliasTable(cpp_vector[double], int) except +
 
         # attributes
         cpp_vector[int] alias
@@ -49,6 +50,14 @@ cdef extern from "source_sampling.h" namespace "pyne":
         cpp_vector[int] get_cell_list() except +
 
 
+cdef extern from "source_sampling.h" namespace "pyne":
+
+    cdef enum EnergyMode:
+        E_LINEAR
+        E_LOG
+        E_TABULATED
+
+
 cdef extern from "source_sampling.h" namespace "pyne":
 
     cdef cppclass Sampler:
@@ -67,4 +76,32 @@ cdef extern from "source_sampling.h" namespace "pyne":
         # methods
         SourceParticle particle_birth() except +
         SourceParticle particle_birth(cpp_vector[double]) except +
+        void set_energy_mode(EnergyMode) except +
+        void set_group_spectra(cpp_vector[cpp_vector[double]], cpp_vector[cpp_vector[double]]) except +
+        void write_state(std_string) except +
+        cpp_bool matches_source(std_string, int) except +
+        double get_source_strength() except +
+        double get_biased_strength() except +
+
+        @staticmethod
+        Sampler * read_state(std_string) except +
+        @staticmethod
+        Sampler * read_shared_state(std_string, std_string, cpp_map[std_string, std_string], cpp_vector[double], int) except +
+
+    cdef cppclass PartitionedSampler:
+        PartitionedSampler(cpp_vector[std_string]) except +
+        SourceParticle particle_birth(cpp_vector[double]) except +
+        int get_cell_list_size() except +
+        int num_partitions() except +
+
+
+cdef extern from "moab/Types.hpp" namespace "moab":
+
+    ctypedef enum EntityType:
+        MBTET
+        MBHEX
+
+cdef extern from "measure.h":
 
+    void measure_many(EntityType, int, size_t, const int *, const double *,
+                      const double *, const double *, double *) nogil except +
@@ -96,6 +96,31 @@ cdef extern from "tally.h" namespace "pyne":
         void write_hdf5(char *, char *) except +
         pass
 
+    cdef cppclass TallyCollection:
+        # constructors
+        TallyCollection() except +
+        TallyCollection(vector[Tally] &) except +
+
+        # attributes
+        vector[int] entity_ids
+        vector[int] entity_types
+        vector[int] tally_types
+        vector[int] particle_names
+        vector[int] entity_names
+        vector[int] tally_names
+        vector[double] entity_sizes
+        vector[double] normalizations
+        vector[cstr] strings
+
+        # methods
+        int push_back(Tally &) except +
+        Tally at(int) except +
+        int size()
+        void clear()
+        int intern(cstr) except +
+        void write_hdf5(cstr, cstr) nogil except +
+        void from_hdf5(cstr, cstr) nogil except +
+
 
 
 
@@ -1,5 +1,6 @@
 # Cython imports
 from libcpp.map cimport map
+from libcpp.string cimport string as std_string
 from libcpp.vector cimport vector
 
 
@@ -8,3 +9,33 @@ cdef extern from "transmuters.h" namespace "pyne::transmuters":
     map[int, double] cram(vector[double], const map[int, double]) except +ValueError
     map[int, double] cram(vector[double], const map[int, double], const int) except +ValueError
 
+
+    cdef cppclass CramSolver:
+        CramSolver(vector[double]) except +ValueError
+        CramSolver(vector[double], const int) except +ValueError
+        int size()
+        int get_order()
+        void solve(const double*, double*)
+        void solve_many(const double*, int, double*)
+        map[int, double] solve(const map[int, double])
+
+    cdef cppclass CramDepletion:
+        CramDepletion(const map[int, double]) except +ValueError
+        CramDepletion(const map[int, double], const int) except +ValueError
+        void step(vector[double]) except +ValueError
+        void step(vector[double], double) except +ValueError
+        vector[double] get_vector()
+        map[int, double] get_comp()
+        int get_order()
+
+    cdef cppclass CramMatrixBuilder:
+        CramMatrixBuilder() except +
+        CramMatrixBuilder(bint) except +
+        int size()
+        int nnz()
+        int num_channels()
+        int index(int)
+        int slot(int, int)
+        int add_channel(int, int) except +ValueError
+        int add_channel(int, std_string, std_string) except +
+        void assemble(const double*, double, double*) nogil
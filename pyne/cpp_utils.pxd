@@ -12,4 +12,9 @@ cdef extern from "utils.h" namespace "pyne":
 
     double endftod(char *) except +
     void use_fast_endftod() except +
+    void endftod_record(char *, double *)
     void pyne_start() except +
+
+cdef extern from "instrument.h" namespace "pyne":
+    std_string stats() except +
+    void reset_stats() except +
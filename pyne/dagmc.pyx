@@ -46,6 +46,7 @@ def get_entity_handle_type():
     return type(str("EntityHandle"), (eh_t,), {})
 
 EntityHandle = get_entity_handle_type()
+_EntityHandle_dtype = np.dtype(EntityHandle.__mro__[1])
 _ErrorCode = type(str("ErrorCode"), (np.int,), {})
 
 class DagmcError(Exception):
@@ -144,9 +145,18 @@ cdef class RayBuffer(object):
     cdef void * ptr
 
 
+def dag_alloc_ray_buffer():
+    """Allocates a new ray buffers object, which is reused by every ray
+    following call it is passed to."""
+    cdef RayBuffer data_buffers = RayBuffer()
+    data_buffers.ptr = cpp_dagmc_bridge.dag_alloc_ray_buffer()
+    return data_buffers
+
+
 def dag_dealloc_ray_buffer(RayBuffer data_buffers):
     """Frees an existing ray buffers object."""
     cpp_dagmc_bridge.dag_dealloc_ray_buffer(data_buffers.ptr)
+    data_buffers.ptr = NULL
 
 
 
@@ -213,6 +223,57 @@ def dag_ray_follow(firstvol, np.ndarray[np.float64_t, ndim=1] ray_start,
     return num_intersections, pysurfs, pydistances, pyvolumes
 
 
+def dag_ray_follow_many(firstvols, ray_starts, ray_dirs, double distance_limit,
+                        RayBuffer data_buffers):
+    """Follows many rays at once, ray i starting at ray_starts[i] in volume
+    handle firstvols[i] with direction ray_dirs[i].
+
+    Returns the (offsets, surfs, distances, volumes) arrays, where the
+    intersections of ray i are the entries offsets[i] to offsets[i+1] - 1 of
+    the other three.
+    """
+    cdef int i
+    cdef int num_rays
+    cdef cpp_dagmc_bridge.ErrorCode crtn
+    cdef int * offsets
+    cdef cpp_dagmc_bridge.EntityHandle * surfs
+    cdef double * distances
+    cdef cpp_dagmc_bridge.EntityHandle * volumes
+    cdef np.ndarray[np.float64_t, ndim=2] starts = \
+        np.ascontiguousarray(ray_starts, dtype=np.float64).reshape(-1, 3)
+    cdef np.ndarray[np.float64_t, ndim=2] dirs = \
+        np.ascontiguousarray(ray_dirs, dtype=np.float64).reshape(-1, 3)
+    cdef np.ndarray vols = np.ascontiguousarray(firstvols, dtype=_EntityHandle_dtype)
+    num_rays = starts.shape[0]
+    if dirs.shape[0] != num_rays or vols.shape[0] != num_rays:
+        raise ValueError("firstvols, ray_starts, and ray_dirs must have the "
+                         "same number of rays")
+    if num_rays == 0:
+        return (np.zeros(1, dtype=np.int32),
+                np.zeros(0, dtype=_EntityHandle_dtype),
+                np.zeros(0, dtype=np.float64),
+                np.zeros(0, dtype=_EntityHandle_dtype))
+    crtn = cpp_dagmc_bridge.dag_ray_follow_many(
+                <cpp_dagmc_bridge.EntityHandle *> np.PyArray_DATA(vols),
+                <double *> np.PyArray_DATA(starts),
+                <double *> np.PyArray_DATA(dirs), num_rays, distance_limit,
+                &offsets, &surfs, &distances, &volumes, data_buffers.ptr)
+    if crtn != 0:
+        raise DagmcError("Error code " + str(crtn))
+    pyoffsets = np.empty(num_rays + 1, dtype=np.int32)
+    for i in range(num_rays + 1):
+        pyoffsets[i] = offsets[i]
+    num_intersections = offsets[num_rays]
+    pysurfs = np.empty(num_intersections, dtype=_EntityHandle_dtype)
+    pydistances = np.empty(num_intersections, dtype=np.float64)
+    pyvolumes = np.empty(num_intersections, dtype=_EntityHandle_dtype)
+    for i in range(num_intersections):
+        pysurfs[i] = surfs[i]
+        pydistances[i] = distances[i]
+        pyvolumes[i] = volumes[i]
+    return pyoffsets, pysurfs, pydistances, pyvolumes
+
+
 def  dag_next_vol(surface, volume):
     cdef cpp_dagmc_bridge.ErrorCode crtn
     cdef cpp_dagmc_bridge.EntityHandle next_vol
@@ -283,6 +344,42 @@ def get_volume_boundary(vol):
     return pyminpt, pymaxpt
 
 
+def dag_build_volume_table():
+    """Rebuilds the table of volume metadata, bounding boxes, and flags that
+    dag_load builds."""
+    cdef cpp_dagmc_bridge.ErrorCode crtn
+    crtn = cpp_dagmc_bridge.dag_build_volume_table()
+    if crtn != 0:
+        raise DagmcError("Error code " + str(crtn))
+
+
+def dag_volume_table():
+    """Returns the table of volume metadata, bounding boxes, and flags as a
+    structured array with one entry per volume."""
+    cdef int i, j
+    cdef int num_volumes = 0
+    cdef const cpp_dagmc_bridge.dag_volume_info * table
+    table = cpp_dagmc_bridge.dag_volume_table(&num_volumes)
+    # Use str for python2/3 compatibility
+    rtn = np.zeros(num_volumes, dtype=[(str('id'), np.int32),
+                                       (str('handle'), _EntityHandle_dtype),
+                                       (str('material'), np.int32),
+                                       (str('density'), np.float64),
+                                       (str('importance'), np.float64),
+                                       (str('bbox_min'), np.float64, (3,)),
+                                       (str('bbox_max'), np.float64, (3,)),
+                                       (str('graveyard'), np.bool_),
+                                       (str('implicit_complement'), np.bool_)])
+    for i in range(num_volumes):
+        rtn[i] = (table[i].id, table[i].handle, table[i].material,
+                  table[i].density, table[i].importance,
+                  [table[i].bbox_min[j] for j in range(3)],
+                  [table[i].bbox_max[j] for j in range(3)],
+                  table[i].flags & cpp_dagmc_bridge.DAG_VOL_GRAVEYARD,
+                  table[i].flags & cpp_dagmc_bridge.DAG_VOL_IMPLICIT_COMPLEMENT)
+    return rtn
+
+
 
 ### end bridge
 
@@ -473,9 +570,10 @@ def ray_iterator(init_vol_id, startpoint, direction, **kw):
     xyz = np.array(startpoint, dtype=np.float64)
     uvw = np.array(direction, dtype=np.float64)
     dist_limit = kw.get('dist_limit', 0.0)
-    buf = RayBuffer()
+    buf = dag_alloc_ray_buffer()
 
     x, surfs, dists, vols = dag_ray_follow(eh, xyz, uvw, dist_limit, buf)
+    dag_dealloc_ray_buffer(buf)
     for i in range(x):
         vol_id = vol_handle_to_id[vols[i]]
         surf_id = surf_handle_to_id[surfs[i]]
@@ -485,8 +583,6 @@ def ray_iterator(init_vol_id, startpoint, direction, **kw):
         else:
             yield (vol_id, dists[i], surf_id)
 
-    dag_dealloc_ray_buffer(buf)
-
 
 def tell_ray_story(startpoint, direction, output=sys.stdout, **kw):
     """Write a human-readable history of a ray in a given direction.
@@ -590,17 +686,16 @@ def get_material_set(**kw):
     tuples containing material ID and density
     """
     mat_ids = set()
-    volumes = get_volume_list()
-    for v in volumes:
-        d = volume_metadata(v)
+    for v in dag_volume_table():
+        material = int(v['material'])
         if(kw.get('with_rho') is True):
             # rho is undefined for the void material and dagmc may return anything.
-            if d['material'] == 0:
-                mat_ids.add((d['material'], 0.0))
+            if material == 0:
+                mat_ids.add((material, 0.0))
             else:
-                mat_ids.add((d['material'], d['rho']))
+                mat_ids.add((material, float(v['density'])))
         else:
-            mat_ids.add(d['material'])
+            mat_ids.add(material)
     return mat_ids
 
 
@@ -706,10 +801,9 @@ def find_implicit_complement():
     """Find the implicit complement and return the volume id.
     Note that a DAGMC geometry must already be loaded into memory.
     """
-    volumes = get_volume_list()
-    for vol in volumes:
-        if volume_is_implicit_complement(vol):
-            return vol
+    for v in dag_volume_table():
+        if v['implicit_complement']:
+            return int(v['id'])
 
 
 def _tag_to_string(tag):
@@ -752,6 +846,8 @@ def discretize_geom(mesh, **kwargs):
         (on the boundary) for each mesh row. If true, a linearly spaced grid of
         starting points is used, with dimension sqrt(num_rays) x sqrt(num_rays).
         In this case, "num_rays" must be a perfect square.
+    num_threads : int, optional, default = 1
+        Structured mesh only. The number of threads that fire the rays.
 
     Returns
     -------
@@ -772,7 +868,8 @@ def discretize_geom(mesh, **kwargs):
     if mesh.structured:
        num_rays = kwargs['num_rays'] if 'num_rays' in kwargs else 10
        grid = kwargs['grid'] if 'grid' in kwargs else False
-       results = ray_discretize(mesh, num_rays, grid)
+       num_threads = kwargs['num_threads'] if 'num_threads' in kwargs else 1
+       results = ray_discretize(mesh, num_rays, grid, num_threads)
     else:
        if kwargs:
            raise ValueError("No valid key word arguments for unstructed mesh.")
@@ -812,8 +909,8 @@ def cells_at_ve_centers(mesh):
 
     return cells
 
-def ray_discretize(mesh, num_rays=10, grid=False):
-    """ray_discretize(mesh, num_rays=10, grid=False)
+def ray_discretize(mesh, num_rays=10, grid=False, num_threads=1):
+    """ray_discretize(mesh, num_rays=10, grid=False, num_threads=1)
     This function discretizes a geometry (by geometry cell) onto a
     superimposed, structured, axis-aligned mesh using the method described in
     [1]. Ray tracing is used to sample track lengths in geometry cells in mesh
@@ -838,6 +935,11 @@ def ray_discretize(mesh, num_rays=10, grid=False):
         for each mesh row. If true, a linearly spaced grid of starting points is
         used, with dimension sqrt(num_rays) x sqrt(num_rays). In this case,
         "num_rays" must be a perfect square.
+    num_threads : int, optional, default = 1
+        The number of threads that fire the rays, each taking whole mesh rows.
+        The results do not depend on it. Each thread but the first loads its
+        own copy of the geometry, as DAGMC queries must not share one.
+        Random starting points are drawn from a seed taken from numpy.random.
 
     Returns
     -------
@@ -855,246 +957,60 @@ def ray_discretize(mesh, num_rays=10, grid=False):
         This array is returned in sorted order with respect to idx and cell, with
         cell changing fastest.
     """
+    cdef int i
+    cdef cpp_dagmc_bridge.ErrorCode crtn
+    cdef int num_results = 0
+    cdef int * ves
+    cdef int * cells
+    cdef double * vol_fracs
+    cdef double * rel_errors
+    cdef void * buf
+    cdef np.ndarray[np.float64_t, ndim=1] x_divs, y_divs, z_divs
+    cdef double * px
+    cdef double * py
+    cdef double * pz
+    cdef int nx, ny, nz
+    cdef int c_num_rays = num_rays
+    cdef int c_grid = 1 if grid else 0
+    cdef unsigned long seed = np.random.randint(0, 2**31 - 1)
+    cdef int c_num_threads = num_threads
     mesh._structured_check()
+    if grid and int(np.sqrt(num_rays))**2 != num_rays:
+        raise ValueError("For rays fired in a grid, "
+                         "num_rays must be a perfect square.")
     # add the str here to prevent the 'xyz' be transfered to ascii
-    divs = [mesh.structured_get_divisions(x) for x in str('xyz')]
-    num_ves = (len(divs[0])-1)*(len(divs[1])-1)*(len(divs[2])-1)
-    #  Stores a running tally of sums of x and sums of x^2 for each ve
-    mesh_sums = [{} for x in range(0, num_ves)]
-    #  The length of the output array (will vary because different ve contain
-    #  different numbers of geometry cells.
-    len_count = 0
-
-    #  Direction indicies: x = 0, y = 1, z = 2
-    dis = [0, 1, 2]
-    #  Iterate over all directions indicies
-    for di in dis:
-        #  For each direction, the remaining two directions define the sampling
-        #  surface. These two directions are the values in s_dis (surface
-        #  direction indices)
-        s_dis = [0, 1, 2]
-        s_dis.remove(di)
-        #  Iterate through all all the sampling planes perpendicular to di,
-        #  creating a _MeshRow in each, and subsequently evaluating that row.
-        for a in range(0, len(divs[s_dis[0]]) - 1):
-            for b in range(0, len(divs[s_dis[1]]) - 1):
-                mesh_row = _MeshRow()
-                mesh_row.di = di
-                mesh_row.divs = divs[di]
-                mesh_row.num_rays = num_rays
-                mesh_row.s_dis_0 = s_dis[0]
-                mesh_row.s_min_0 = divs[s_dis[0]][a]
-                mesh_row.s_max_0 = divs[s_dis[0]][a + 1]
-                mesh_row.s_dis_1 = s_dis[1]
-                mesh_row.s_min_1 = divs[s_dis[1]][b]
-                mesh_row.s_max_1 = divs[s_dis[1]][b + 1]
-
-                #  Create a lines of starting points to fire rays for this
-                #  particular mesh row.
-                if not grid:
-                    mesh_row._rand_start()
-                else:
-                    mesh_row._grid_start()
-
-                #  Create a list of mesh idx corresponding to this mesh row.
-                if di == 0:
-                    ves = mesh.structured_iterate_hex('x', y=a, z=b)
-                elif di == 1:
-                    ves = mesh.structured_iterate_hex('y', x=a, z=b)
-                elif di == 2:
-                    ves = mesh.structured_iterate_hex('z', x=a, y=b)
-
-                idx_tag = mesh.idx
-                idx = []
-                for ve in ves:
-                    idx.append(idx_tag[ve][0])
-
-                #  Fire rays.
-                row_sums = mesh_row._evaluate_row()
-
-                #  Add row results to the full mesh sum matrix.
-                for j, ve_sums in enumerate(row_sums):
-                   for cell in ve_sums.keys():
-                       if ve_sums[cell][0] < VOL_FRAC_TOLERANCE:
-                           continue
-                       if cell not in mesh_sums[idx[j]].keys():
-                           mesh_sums[idx[j]][cell] = [0, 0]
-                           len_count += 1
-
-                       mesh_sums[idx[j]][cell][0] += ve_sums[cell][0]
-                       mesh_sums[idx[j]][cell][1] += ve_sums[cell][1]
-
-
-    #  Create structured array
-    total_rays = num_rays*3 # three directions
-    # Use str for python2/3 compatibility
-    results = np.zeros(len_count, dtype=[(str('idx'), np.int64),
-                                         (str('cell'), np.int64),
-                                         (str('vol_frac'), np.float64),
-                                         (str('rel_error'), np.float64)])
-
-    row_count = 0
-    total_rays = num_rays*3
-    for i, ve_sums in enumerate(mesh_sums):
-       for vol in ve_sums.keys():
-           vol_frac = ve_sums[vol][0]/total_rays
-           rel_error = np.sqrt((ve_sums[vol][1])/(ve_sums[vol][0])**2
-                                - 1.0/total_rays)
-           results[row_count] = (i, vol, vol_frac, rel_error)
-           row_count += 1
+    x_divs, y_divs, z_divs = [np.ascontiguousarray(
+        mesh.structured_get_divisions(x), dtype=np.float64) for x in str('xyz')]
+    px = <double *> np.PyArray_DATA(x_divs)
+    py = <double *> np.PyArray_DATA(y_divs)
+    pz = <double *> np.PyArray_DATA(z_divs)
+    nx, ny, nz = x_divs.shape[0], y_divs.shape[0], z_divs.shape[0]
+
+    buf = cpp_dagmc_bridge.dag_alloc_discretize_buffer()
+    try:
+        with nogil:
+            crtn = cpp_dagmc_bridge.dag_ray_discretize(
+                px, nx, py, ny, pz, nz, c_num_rays, c_grid, seed,
+                c_num_threads, &num_results, &ves, &cells, &vol_fracs,
+                &rel_errors, buf)
+        if crtn != 0:
+            raise DagmcError("Error code " + str(crtn))
+
+        #  The driver numbers the ves with x changing fastest, as this
+        #  iteration does.
+        idx_tag = mesh.idx
+        idx = [idx_tag[ve][0] for ve in mesh.structured_iterate_hex('zyx')]
+
+        # Use str for python2/3 compatibility
+        results = np.zeros(num_results, dtype=[(str('idx'), np.int64),
+                                               (str('cell'), np.int64),
+                                               (str('vol_frac'), np.float64),
+                                               (str('rel_error'), np.float64)])
+        for i in range(num_results):
+            results[i] = (idx[ves[i]], cells[i], vol_fracs[i], rel_errors[i])
+    finally:
+        cpp_dagmc_bridge.dag_dealloc_discretize_buffer(buf)
 
     results.sort()
 
     return results
-
-class _MeshRow():
-    """A class to store data and fire rays down a single mesh row.
-
-    Attributes
-    ----------
-    di : int
-        The direction index of the current firing direction.
-    divs : list
-        The mesh boundaries perpendicular to the firing direction.
-    start_points : list
-        The xyz points describing where rays should start from.
-    num_rays : int
-        The number of rays to fire down the mesh row.
-    s_dis_0 : int
-        The first of two directions that define the surface for which rays
-        are fired.
-    s_min_0 : float
-        The location of the plane the bounds the firing surface from the left
-        in direction s_dis_0.
-    s_max_0 : float
-        The location of the plane the bounds the firing surface from the right
-        in direction s_dis_0.
-    s_dis_1 : int
-        The second of two directions that define the surface for which rays
-        are fired.
-    s_min_1 : float
-        The location of the plane the bounds the firing surface from the left
-        in direction s_dis_1.
-    s_max_1 : float
-        The location of the plane the bounds the firing surface from the right
-        in direction s_dis_1.
-       """
-    def __init__(self):
-        pass
-
-    def _rand_start(self):
-        """Private function for randomly generating ray starting points to
-        populate self.starting_points
-        """
-        self.start_points = []
-        ray_count = 0
-        while ray_count < self.num_rays:
-            start_point = [0]*3
-            start_point[self.di] = self.divs[0]
-            start_point[self.s_dis_0] = np.random.uniform(self.s_min_0,
-                                                          self.s_max_0)
-            start_point[self.s_dis_1] = np.random.uniform(self.s_min_1,
-                                                          self.s_max_1)
-            self.start_points.append(start_point)
-            ray_count += 1
-
-    def _grid_start(self):
-        """Private function for generating a uniform grid of ray starting
-        points to populate self.starting_points.
-        """
-        #  Test to see if num_rays is a perfect square.
-        if int(np.sqrt(self.num_rays))**2 != self.num_rays:
-            raise ValueError("For rays fired in a grid, "
-                             "num_rays must be a perfect square.")
-        else:
-           square_dim = int(np.sqrt(self.num_rays))
-
-        step_1 = (self.s_max_0-self.s_min_0)/(float(square_dim) + 1)
-        step_2 = (self.s_max_1 - self.s_min_1)/(float(square_dim) + 1)
-        range_1 = np.linspace(self.s_min_0 + step_1, self.s_max_0, square_dim,
-                              endpoint=False)
-        range_2 = np.linspace(self.s_min_1 + step_2, self.s_max_1, square_dim,
-                              endpoint=False)
-
-        self.start_points = []
-        for point_1 in range_1:
-            for point_2 in range_2:
-                start_point = [0]*3
-                start_point[self.di] = self.divs[0]
-                start_point[self.s_dis_0] = point_1
-                start_point[self.s_dis_1]= point_2
-                self.start_points.append(start_point)
-
-    def _evaluate_row(self):
-        """Private function that fires rays down a single mesh row and returns the
-        results.
-
-        Returns
-        -------
-        row_sums : list
-            A list with one entry per mesh volume element in the mesh row. Each
-            entry is a dictionary that maps geometry cell number to a list
-            containing two statistical results. The first result is the sum of
-            all the samples and the second result is the sum of all the squares
-            of all of the samples.
-        """
-
-        # Number of volume elements in this mesh row.
-        num_ve = len(self.divs) - 1
-        direction = [0, 0, 0]
-        direction[self.di] = 1
-        row_sums = [{} for x in range(0, len(self.divs) - 1)]
-        width = [self.divs[x] - self.divs[x - 1] for x in range(1, len(self.divs))]
-
-        #  Find the first volume the first point is located in.
-        vol = find_volume(self.start_points[0], direction)
-        #  Fire ray for each starting point.
-        for point in self.start_points:
-            #  Check to see if the staring point is in the same volume as the
-            #  last staring point to avoid expensive find_volume calls.
-            if not point_in_volume(vol, point, direction):
-                vol = find_volume(point, direction)
-
-            mesh_dist = width[0]
-            ve_count = 0
-            complete = False
-            #  Track a single ray down the mesh row and tally accordingly.
-            for next_vol, distance, _ in ray_iterator(vol, point, direction):
-                if complete:
-                    break
-
-                #  Volume extends past mesh boundary
-                while distance >= mesh_dist:
-                    #  Check to see if current volume has already by tallied
-                    if vol not in row_sums[ve_count].keys():
-                        row_sums[ve_count][vol] = [0, 0]
-
-                    sample = mesh_dist/width[ve_count]
-                    row_sums[ve_count][vol][0] += sample
-                    row_sums[ve_count][vol][1] += sample**2
-                    distance -= mesh_dist
-
-                    #  If not on the last volume element, continue into the next
-                    #  volume element.
-                    if ve_count == num_ve - 1:
-                        complete = True
-                        break
-                    else:
-                        ve_count += 1
-                        mesh_dist = width[ve_count]
-
-                #  Volume does not extend past mesh volume.
-                if distance < mesh_dist and distance > VOL_FRAC_TOLERANCE \
-                    and not complete:
-                    #  Check to see if current volume has already by tallied
-                    if vol not in row_sums[ve_count].keys():
-                        row_sums[ve_count][vol] = [0, 0]
-
-                    sample = distance/width[ve_count]
-                    row_sums[ve_count][vol][0] += sample
-                    row_sums[ve_count][vol][1] += sample**2
-                    mesh_dist -= distance
-
-                vol = next_vol
-
-        return row_sums
@@ -3,6 +3,7 @@ from __future__ import division, unicode_literals
 
 # Cython imports
 from libcpp.map cimport map
+from libcpp.memory cimport shared_ptr
 from libcpp.set cimport set as cpp_set
 from cython.operator cimport dereference as deref
 from cython.operator cimport preincrement as inc
@@ -10,6 +11,7 @@ from libcpp.map cimport map as cpp_map
 from libcpp.set cimport set as cpp_set
 from libcpp.string cimport string as std_string
 from libcpp.utility cimport pair as cpp_pair
+from libcpp.vector cimport vector
 #from cython cimport pointer
 
 #Standard lib import
@@ -812,6 +814,48 @@ def fpyield(from_nuc, to_nuc, source=0, get_errors=False):
     fpy = cpp_data.fpyield(cpp_pair[int, int](fn, tn), <int> source, get_errors)
     return fpy
 
+
+def fpyield_matrix(source=0, get_errors=False):
+    """Returns the fission product yields of a source as a dense matrix, with
+    a row per fissioning nuclide and a column per fission product. The matrix
+    is built once per source and shared by later calls.
+
+    Parameters
+    ----------
+    source : int or str
+        The int or corresponding dictionary key for the source dataset.
+        Allowed values are:
+        'WIMSD': 0, 'NDS_THERMAL' : 1, 'NDS_FAST' : 2, 'NDS_14MEV' : 3
+    get_errors : boolean
+        return the errors in the values instead, if possible
+
+    Returns
+    -------
+    parents : ndarray of ints
+        The sorted ids of the fissioning nuclides, one per row.
+    products : ndarray of ints
+        The sorted ids of the fission products, one per column.
+    fpy : 2D ndarray
+        Fractional yields of each pair [unitless], zero for pairs without data.
+    """
+    srcmap = {'WIMSD': 0, 'NDS_THERMAL': 1, 'NDS_FAST': 2, 'NDS_14MEV': 3}
+    if isinstance(source, str):
+        source = srcmap[source]
+    elif not isinstance(source, int) or not 0 <= source <= 3:
+        raise ValueError('Only the ints 0 to 3 or their keys are accepted')
+    cdef const cpp_data.FissionYieldMatrix * fym = \
+        &cpp_data.fpyield_matrix(<int> source, <bint> get_errors)
+    cdef int p, i
+    cdef const int * cols
+    cdef const double * vals
+    fpy = np.zeros((fym.num_parents(), fym.num_products()), dtype=np.float64)
+    for p in range(fym.num_parents()):
+        cols = fym.row_products(p)
+        vals = fym.row_yields(p)
+        for i in range(fym.row_size(p)):
+            fpy[p, cols[i]] = vals[i]
+    return np.array(fym.parents()), np.array(fym.products()), fpy
+
 #
 # atomic data functions
 #
@@ -1050,6 +1094,49 @@ def decay_children(nuc, use_metastable=True):
 
     return dc
 
+def decay_graph():
+    """Returns the decay graph of the level data in compressed sparse row
+    form: the children of the decaying nuclide parents[p], with their branch
+    ratios, are children[indptr[p]:indptr[p+1]] and
+    branch_ratios[indptr[p]:indptr[p+1]]. The graph is built once and shared
+    with decay_children() and branch_ratio().
+
+    Returns
+    -------
+    parents : ndarray of ints
+        The sorted ids of the decaying nuclides.
+    decay_consts : ndarray of floats
+        The decay constant of each parent [1/s].
+    indptr : ndarray of ints
+        The start of the children of each parent, and their total at the end.
+    children : ndarray of ints
+        The sorted ids of the children of each parent in turn.
+    branch_ratios : ndarray of floats
+        The branch ratio of each child [fraction].
+    """
+    cdef shared_ptr[const cpp_data.DecayGraph] graph = cpp_data.decay_graph()
+    cdef int n = graph.get().size()
+    cdef int p, c, k
+    cdef const int * kids
+    cdef const double * ratios
+    parents = np.array(graph.get().nucs(), dtype=np.int32)
+    decay_consts = np.empty(n, dtype=np.float64)
+    indptr = np.zeros(n + 1, dtype=np.int32)
+    for p in range(n):
+        decay_consts[p] = graph.get().decay_const(p)
+        indptr[p + 1] = indptr[p] + graph.get().num_children(p)
+    children = np.empty(indptr[n], dtype=np.int32)
+    branch_ratios = np.empty(indptr[n], dtype=np.float64)
+    k = 0
+    for p in range(n):
+        kids = graph.get().children(p)
+        ratios = graph.get().branch_ratios(p)
+        for c in range(graph.get().num_children(p)):
+            children[k] = kids[c]
+            branch_ratios[k] = ratios[c]
+            k += 1
+    return parents, decay_consts, indptr, children, branch_ratios
+
 def all_children(nuc):
     """
     returns child nuclides from both level and decay data
@@ -1578,6 +1665,64 @@ def gamma_xrays(parent):
     """
     return cpp_data.gamma_xrays(<int> parent)
 
+def gamma_line_match(energies, errors, line_errors=False):
+    """
+    Finds the gamma and x-ray lines within the windows of many peaks at once,
+    from an energy sorted index of all lines that is built once. The
+    candidates of peak k are entries indptr[k]:indptr[k+1] of the returned
+    line arrays, in energy order.
+
+    Parameters
+    ----------
+    energies : array of floats
+        The peak energies [keV].
+    errors : array of floats
+        The half width of the window of each peak [keV].
+    line_errors : bool, optional
+        If True a line also matches when its own energy error brings it
+        within the window.
+
+    Returns
+    -------
+    indptr : ndarray of ints
+        The start of the candidates of each peak, and their total at the end.
+    line_energies : ndarray of floats
+        The energy of each candidate line [keV].
+    intensities : ndarray of floats
+        The photon intensity of each gamma line, or the intensity of each
+        x-ray as from gamma_xrays().
+    parents : ndarray of ints
+        The parent of each line in state_id form.
+    children : ndarray of ints
+        The child of each gamma line, 0 for x-rays.
+
+    """
+    cdef shared_ptr[const cpp_data.GammaLineIndex] index = \
+        cpp_data.gamma_line_index()
+    cdef np.ndarray[np.float64_t, ndim=1] e = np.ascontiguousarray(energies,
+                                                                 dtype=np.float64)
+    cdef np.ndarray[np.float64_t, ndim=1] err = np.ascontiguousarray(
+        np.broadcast_to(errors, e.shape), dtype=np.float64)
+    cdef vector[int] ptr
+    cdef vector[int] lines
+    cdef int n = e.shape[0]
+    cdef int i, k
+    index.get().match(n, <double *> np.PyArray_DATA(e),
+                      <double *> np.PyArray_DATA(err), ptr, lines,
+                      <bint> line_errors)
+    indptr = np.array(ptr, dtype=np.int32)
+    line_energies = np.empty(lines.size(), dtype=np.float64)
+    intensities = np.empty(lines.size(), dtype=np.float64)
+    parents = np.empty(lines.size(), dtype=np.int32)
+    children = np.empty(lines.size(), dtype=np.int32)
+    for k in range(lines.size()):
+        i = lines[k]
+        line_energies[k] = index.get().energy(i)
+        intensities[k] = index.get().intensity(i)
+        parents[k] = index.get().parent(i)
+        children[k] = index.get().child(i)
+    return indptr, line_energies, intensities, parents, children
+
 def alpha_energy(parent):
     """
     Returns a list of alpha energies from ENSDF decay dataset from a given
@@ -1932,3 +2077,75 @@ def ecbp_xrays(parent):
 
     """
     return cpp_data.ecbp_xrays(<int> parent)
+
+def clear_nuc_property_table():
+    """Empties the nuclide property table that caches the atomic masses, decay
+    constants, Q values, and dose factors read by the Material methods. Call
+    this after changing any of the data maps, e.g. atomic_mass_map, and not
+    while other threads use Materials.  clear_miss_caches() also empties it.
+    """
+    cpp_data.nuc_property_table.clear()
+
+def clear_miss_caches():
+    """Empties the caches of the values estimated for nuclides missing from
+    the data maps, e.g. the ground state mass that atomic_mass() returns for
+    an excited state that is not in atomic_mass_map.  The lookups never add
+    their estimates to the maps themselves.  Call this after changing any of
+    the data maps.
+    """
+    cpp_data.clear_miss_caches()
+
+def preload_nuc_data(tables=None):
+    """Loads nuc_data tables ahead of their first lookup so that the loading
+    cost is paid once at startup rather than by the first query.  Each table
+    is loaded at most once, even when lookups come from several threads.
+
+    Parameters
+    ----------
+    tables : sequence of str, optional
+        Names of the tables to load, any of 'atomic_mass', 'q_val', 'dose',
+        'scattering_lengths', 'wimsd_fpy', 'nds_fpy', 'atomic', 'level',
+        'decay', 'gamma', 'alpha', 'beta', 'ecbp', and 'simple_xs'.  All
+        tables are loaded by default.
+
+    """
+    cdef vector[std_string] cpp_tables
+    if tables is not None:
+        if isinstance(tables, basestring):
+            tables = [tables]
+        for table in tables:
+            cpp_tables.push_back(table.encode())
+    with nogil:
+        cpp_data.preload_nuc_data(cpp_tables)
+
+def write_nuc_data_snapshot(filename):
+    """Writes the decay data tables (atomic, level, decay, gamma, alpha, beta,
+    and ecbp) to a flat binary snapshot that loads without nuc_data.h5.
+
+    Parameters
+    ----------
+    filename : str
+        Path of the snapshot file.
+
+    """
+    cpp_data.write_nuc_data_snapshot(filename.encode())
+
+def load_nuc_data_snapshot(filename, create=True):
+    """Fills the decay data tables from a snapshot written by
+    write_nuc_data_snapshot().  The snapshot is only used if it was taken from
+    the current nuc_data.
+
+    Parameters
+    ----------
+    filename : str
+        Path of the snapshot file.
+    create : bool, optional
+        Write a new snapshot if the file is missing or out of date.
+
+    Returns
+    -------
+    loaded : bool
+        Whether the tables were loaded from the snapshot.
+
+    """
+    return cpp_data.load_nuc_data_snapshot(filename.encode(), create)
@@ -14,8 +14,11 @@ from cython.operator cimport dereference as deref
 from cython.operator cimport preincrement as inc
 from libc.stdlib cimport free
 from libcpp.string cimport string as std_string
+from libcpp.vector cimport vector
+cimport numpy as np
 
 from warnings import warn
+import numpy as np
 from pyne.utils import QAWarning
 
 from pyne cimport nucname
@@ -29,6 +32,8 @@ from pyne cimport cpp_enrichment
 
 warn(__name__ + " is not yet QA compliant.", QAWarning)
 
+np.import_array()
+
 
 #####################
 ### Cascade Class ###
@@ -496,6 +501,299 @@ def tail_per_prod(double x_feed, double x_prod, double x_tail):
     return cpp_enrichment.tail_per_prod(x_feed, x_prod, x_tail)
 
 
+ctypedef void (*batch_func)(const double *, const double *, const double *,
+                           double *, size_t) nogil
+
+
+cdef np.ndarray _batch(batch_func f, x_feed, x_prod, x_tail):
+    # broadcasts the assays to contiguous arrays and runs f on them without
+    # the GIL
+    xf, xp, xt = np.broadcast_arrays(np.asarray(x_feed, dtype=np.float64),
+                                     np.asarray(x_prod, dtype=np.float64),
+                                     np.asarray(x_tail, dtype=np.float64))
+    cdef np.ndarray cxf = np.ascontiguousarray(xf)
+    cdef np.ndarray cxp = np.ascontiguousarray(xp)
+    cdef np.ndarray cxt = np.ascontiguousarray(xt)
+    cdef np.ndarray res = np.empty_like(cxf)
+    cdef size_t n = cxf.size
+    cdef double * pxf = <double *> np.PyArray_DATA(cxf)
+    cdef double * pxp = <double *> np.PyArray_DATA(cxp)
+    cdef double * pxt = <double *> np.PyArray_DATA(cxt)
+    cdef double * pres = <double *> np.PyArray_DATA(res)
+    with nogil:
+        f(pxf, pxp, pxt, pres, n)
+    return res
+
+
+def feed_per_prod_n(x_feed, x_prod, x_tail):
+    """feed_per_prod_n(x_feed, x_prod, x_tail)
+    Calculates the feed over product ratios of many enrichment points at once,
+    with the GIL released. The assays are broadcast against each other.
+
+    .. math::
+
+        \\frac{f}{p} = \\frac{(x_p - x_t)}{(x_f - x_t)}
+
+    Parameters
+    ----------
+    x_feed : array-like
+        Feed enrichments.
+    x_prod : array-like
+        Product enrichments.
+    x_tail : array-like
+        Tails enrichments.
+
+    Returns
+    -------
+    res : ndarray of float64
+        As calculated above for each point.
+
+    """
+    return _batch(cpp_enrichment.feed_per_prod_n, x_feed, x_prod, x_tail)
+
+
+def feed_per_tail_n(x_feed, x_prod, x_tail):
+    """feed_per_tail_n(x_feed, x_prod, x_tail)
+    Calculates the feed over tails ratios of many enrichment points at once,
+    with the GIL released. The assays are broadcast against each other.
+
+    .. math::
+
+        \\frac{f}{t} = \\frac{(x_t - x_p)}{(x_f - x_p)}
+
+    Parameters
+    ----------
+    x_feed : array-like
+        Feed enrichments.
+    x_prod : array-like
+        Product enrichments.
+    x_tail : array-like
+        Tails enrichments.
+
+    Returns
+    -------
+    res : ndarray of float64
+        As calculated above for each point.
+
+    """
+    return _batch(cpp_enrichment.feed_per_tail_n, x_feed, x_prod, x_tail)
+
+
+def prod_per_feed_n(x_feed, x_prod, x_tail):
+    """prod_per_feed_n(x_feed, x_prod, x_tail)
+    Calculates the product over feed ratios of many enrichment points at once,
+    with the GIL released. The assays are broadcast against each other.
+
+    .. math::
+
+        \\frac{p}{f} = \\frac{(x_f - x_t)}{(x_p - x_t)}
+
+    Parameters
+    ----------
+    x_feed : array-like
+        Feed enrichments.
+    x_prod : array-like
+        Product enrichments.
+    x_tail : array-like
+        Tails enrichments.
+
+    Returns
+    -------
+    res : ndarray of float64
+        As calculated above for each point.
+
+    """
+    return _batch(cpp_enrichment.prod_per_feed_n, x_feed, x_prod, x_tail)
+
+
+def prod_per_tail_n(x_feed, x_prod, x_tail):
+    """prod_per_tail_n(x_feed, x_prod, x_tail)
+    Calculates the product over tails ratios of many enrichment points at once,
+    with the GIL released. The assays are broadcast against each other.
+
+    .. math::
+
+        \\frac{p}{t} = \\frac{(x_t - x_f)}{(x_f - x_p)}
+
+    Parameters
+    ----------
+    x_feed : array-like
+        Feed enrichments.
+    x_prod : array-like
+        Product enrichments.
+    x_tail : array-like
+        Tails enrichments.
+
+    Returns
+    -------
+    res : ndarray of float64
+        As calculated above for each point.
+
+    """
+    return _batch(cpp_enrichment.prod_per_tail_n, x_feed, x_prod, x_tail)
+
+
+def tail_per_feed_n(x_feed, x_prod, x_tail):
+    """tail_per_feed_n(x_feed, x_prod, x_tail)
+    Calculates the tails over feed ratios of many enrichment points at once,
+    with the GIL released. The assays are broadcast against each other.
+
+    .. math::
+
+        \\frac{t}{f} = \\frac{(x_f - x_p)}{(x_t - x_p)}
+
+    Parameters
+    ----------
+    x_feed : array-like
+        Feed enrichments.
+    x_prod : array-like
+        Product enrichments.
+    x_tail : array-like
+        Tails enrichments.
+
+    Returns
+    -------
+    res : ndarray of float64
+        As calculated above for each point.
+
+    """
+    return _batch(cpp_enrichment.tail_per_feed_n, x_feed, x_prod, x_tail)
+
+
+def tail_per_prod_n(x_feed, x_prod, x_tail):
+    """tail_per_prod_n(x_feed, x_prod, x_tail)
+    Calculates the tails over product ratios of many enrichment points at once,
+    with the GIL released. The assays are broadcast against each other.
+
+    .. math::
+
+        \\frac{t}{p} = \\frac{(x_f - x_p)}{(x_t - x_f)}
+
+    Parameters
+    ----------
+    x_feed : array-like
+        Feed enrichments.
+    x_prod : array-like
+        Product enrichments.
+    x_tail : array-like
+        Tails enrichments.
+
+    Returns
+    -------
+    res : ndarray of float64
+        As calculated above for each point.
+
+    """
+    return _batch(cpp_enrichment.tail_per_prod_n, x_feed, x_prod, x_tail)
+
+
+def value_func_n(x):
+    """value_func_n(x)
+    Calculates the values of many assays at once, as value_func() does for
+    one, with the GIL released.
+
+    Parameters
+    ----------
+    x : array-like
+        Assay enrichments.
+
+    Returns
+    -------
+    val : ndarray of float64
+        The value of each assay.
+
+    """
+    cdef np.ndarray cx = np.ascontiguousarray(x, dtype=np.float64)
+    cdef np.ndarray val = np.empty_like(cx)
+    cdef size_t n = cx.size
+    cdef double * px = <double *> np.PyArray_DATA(cx)
+    cdef double * pval = <double *> np.PyArray_DATA(val)
+    with nogil:
+        cpp_enrichment.value_func_n(px, pval, n)
+    return val
+
+
+def swu_per_feed_n(x_feed, x_prod, x_tail):
+    """swu_per_feed_n(x_feed, x_prod, x_tail)
+    Calculates the SWU per feed of many enrichment points at once,
+    with the GIL released. The assays are broadcast against each other.
+
+    .. math::
+
+        \\frac{S}{f} = \\frac{p}{f} V(x_p) + \\frac{t}{f} V(x_t) - V(x_f)
+
+    Parameters
+    ----------
+    x_feed : array-like
+        Feed enrichments.
+    x_prod : array-like
+        Product enrichments.
+    x_tail : array-like
+        Tails enrichments.
+
+    Returns
+    -------
+    res : ndarray of float64
+        As calculated above for each point.
+
+    """
+    return _batch(cpp_enrichment.swu_per_feed_n, x_feed, x_prod, x_tail)
+
+
+def swu_per_prod_n(x_feed, x_prod, x_tail):
+    """swu_per_prod_n(x_feed, x_prod, x_tail)
+    Calculates the SWU per product of many enrichment points at once,
+    with the GIL released. The assays are broadcast against each other.
+
+    .. math::
+
+        \\frac{S}{p} = V(x_p) + \\frac{t}{p} V(x_t) - \\frac{f}{p} V(x_f)
+
+    Parameters
+    ----------
+    x_feed : array-like
+        Feed enrichments.
+    x_prod : array-like
+        Product enrichments.
+    x_tail : array-like
+        Tails enrichments.
+
+    Returns
+    -------
+    res : ndarray of float64
+        As calculated above for each point.
+
+    """
+    return _batch(cpp_enrichment.swu_per_prod_n, x_feed, x_prod, x_tail)
+
+
+def swu_per_tail_n(x_feed, x_prod, x_tail):
+    """swu_per_tail_n(x_feed, x_prod, x_tail)
+    Calculates the SWU per tails of many enrichment points at once,
+    with the GIL released. The assays are broadcast against each other.
+
+    .. math::
+
+        \\frac{S}{t} = \\frac{p}{t} V(x_p) + V(x_t) - \\frac{f}{t} V(x_f)
+
+    Parameters
+    ----------
+    x_feed : array-like
+        Feed enrichments.
+    x_prod : array-like
+        Product enrichments.
+    x_tail : array-like
+        Tails enrichments.
+
+    Returns
+    -------
+    res : ndarray of float64
+        As calculated above for each point.
+
+    """
+    return _batch(cpp_enrichment.swu_per_tail_n, x_feed, x_prod, x_tail)
+
+
 def alphastar_i(double alpha, double Mstar, double M_i):
     """alphastar_i(alpha, Mstar, M_i)
     Calculates the stage separation factor for a nuclide i of atomic mass :math:`M_i`.
@@ -612,3 +910,55 @@ def multicomponent(Cascade orig_casc, solver="symbolic",
                                     orig_casc._inst[0], strsolver, tolerance, max_iter)
     casc._inst[0] = ccasc
     return casc
+
+
+def multicomponent_many(cascs, solver="symbolic", double tolerance=1.0E-7,
+                        int max_iter=100, warm_start=True, int num_threads=0):
+    """multicomponent_many(cascs, solver="symbolic", tolerance=1.0E-7, max_iter=100, warm_start=True, num_threads=0)
+    Runs multicomponent() on each of a sequence of cascades, such as a sweep
+    over the product enrichment, in parallel and without holding the GIL.
+    The cascades are split into contiguous runs, one per thread.
+
+    Parameters
+    ----------
+    cascs : sequence of Cascade
+        The cascades to optimize.
+    solver : str, optional
+        Flag for underlying cascade solver function to use. Current options 
+        are either "symbolic" or "numeric".
+    tolerance : float, optional
+        Numerical tolerance for underlying solvers, default=1E-7.
+    max_iter : int, optional
+        Maximum number of iterations for underlying solvers, default=100.
+    warm_start : bool, optional
+        If True, a cascade with the same key components and feed nuclides as 
+        the one before it starts from that solution's stage numbers, which
+        saves iterations in smooth sweeps. The results then match 
+        multicomponent() closely rather than exactly.
+    num_threads : int, optional
+        Number of threads to use, 0 (the default) uses one per hardware thread.
+
+    Returns
+    -------
+    solved : list of Cascade
+        New cascade objects, in the order of cascs, optimized as by 
+        multicomponent().
+
+    """
+    cdef vector[cpp_enrichment.Cascade] ccascs
+    cdef vector[cpp_enrichment.Cascade] csolved
+    cdef Cascade casc
+    for casc in cascs:
+        ccascs.push_back(casc._inst[0])
+    cdef std_string strsolver = solver.encode('UTF-8')
+    cdef bint cwarm = warm_start
+    with nogil:
+        csolved = cpp_enrichment.multicomponent_many(ccascs, strsolver,
+                                    tolerance, max_iter, cwarm, num_threads)
+    solved = []
+    cdef size_t i
+    for i in range(csolved.size()):
+        casc = Cascade()
+        casc._inst[0] = csolved[i]
+        solved.append(casc)
+    return solved
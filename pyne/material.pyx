@@ -60,6 +60,28 @@ cdef cpp_map[int, double] dict_to_comp(dict nucvec):
     return comp
 
 
+cdef tuple _series_values(cpp_material.MaterialSeries series, quantity):
+    # Returns the nuclides and the times by nuclides array of a quantity
+    cdef cpp_vector[double] values
+    if quantity == 'moles':
+        values = series.moles
+    elif quantity == 'activity':
+        values = series.activity()
+    elif quantity == 'decay_heat':
+        values = series.decay_heat()
+    else:
+        raise ValueError("quantity must be 'moles', 'activity' or "
+                         "'decay_heat', not {0!r}".format(quantity))
+    cdef int nt = series.size()
+    cdef int nc = series.nucs.size()
+    arr = np.empty((nt, nc), dtype=np.float64)
+    cdef double* data = <double*> np.PyArray_DATA(arr)
+    cdef size_t j
+    for j in range(values.size()):
+        data[j] = values[j]
+    return list(series.nucs), arr
+
+
 cdef class _Material:
 
     def __cinit__(self, nucvec=None, double mass=-1.0, double density=-1.0,
@@ -1142,6 +1164,32 @@ cdef class _Material:
         pymat.mat_pointer[0] = self.mat_pointer.sub_fp()
         return pymat
 
+    def group_masses(self, groups):
+        """group_masses(groups)
+        Computes the mass of the material in each of several nuclide groups in
+        one pass over the composition, e.g. the actinide and fission product
+        masses with groups=[nucname.act, nucname.fp].
+
+        Parameters
+        ----------
+        groups : sequence of collections of ints
+            The Z numbers of the elements of each group.
+
+        Returns
+        -------
+        masses : list of floats
+            The mass in each group. A nuclide counts towards every group that
+            holds its Z number.
+        """
+        cdef cpp_vector[cpp_set[int]] zgroups
+        cdef cpp_set[int] zs
+        for group in groups:
+            zs.clear()
+            for z in group:
+                zs.insert(z)
+            zgroups.push_back(zs)
+        return self.mat_pointer.group_masses(zgroups)
+
 
     #
     # Atom Fraction Methods
@@ -1293,13 +1341,48 @@ cdef class _Material:
         """
         return self.mat_pointer.photons(<cpp_bool> norm)
 
-    def decay(self, double t):
-        """decay(double t)
+    def photon_source(self, e_bounds, norm=False):
+        """photon_source(e_bounds, norm=False)
+        Returns the photons() intensities binned into energy groups. A line
+        of energy E is in group g when e_bounds[g] <= E < e_bounds[g + 1], the
+        last group also holding its upper bound.
+
+        Parameters
+        ----------
+        e_bounds : 1D array-like
+            The increasing group bounds [keV]
+        norm : boolean
+            Whether the group intensities are normalized to sum to one.
+
+        Returns
+        -------
+        src : 1D ndarray
+            The group intensities in decays/s/atom material.
+        """
+        cdef cpp_vector[double] bounds = list(e_bounds)
+        return np.array(self.mat_pointer.photon_source(bounds, <cpp_bool> norm))
+
+    def decay(self, t):
+        """decay(t)
         Decays a material for a time t, in seconds. Returns a new material.
+        If t is a sequence of times, returns the list of the materials at each
+        of them, which shares the work of the decay chains between the times.
         """
         cdef _Material pymat = Material()
-        pymat.mat_pointer[0] = self.mat_pointer.decay(t)
-        return pymat
+        cdef cpp_vector[double] ts
+        cdef cpp_vector[cpp_material.Material] cpp_mats
+        cdef int k
+        if np.ndim(t) == 0:
+            pymat.mat_pointer[0] = self.mat_pointer.decay(<double> t)
+            return pymat
+        ts = list(t)
+        cpp_mats = self.mat_pointer.decay(ts)
+        mats = []
+        for k in range(cpp_mats.size()):
+            pymat = Material()
+            pymat.mat_pointer[0] = cpp_mats[k]
+            mats.append(pymat)
+        return mats
 
     def cram(self, A, int order=14):
         """Transmutes the material via the CRAM method.
@@ -1326,6 +1409,62 @@ cdef class _Material:
         pymat.mat_pointer[0] = self.mat_pointer.cram(cpp_A, order)
         return pymat
 
+    def decay_series(self, times, quantity='moles'):
+        """decay_series(times, quantity='moles')
+        Decays the material to each of a series of cooling times, without
+        building a material per time.
+
+        Parameters
+        ----------
+        times : 1D array-like
+            The cooling times [s]
+        quantity : str, optional
+            The quantity of each nuclide that is returned: 'moles' [mol, for a
+            mass in grams], 'activity' [Bq] or 'decay_heat' [MW].
+
+        Returns
+        -------
+        nucs : list of ints
+            The nuclides that are present at some time.
+        values : 2D ndarray
+            The quantity of each nuclide at each time, with one row per time.
+        """
+        cdef cpp_vector[double] ts = list(times)
+        return _series_values(self.mat_pointer.decay_series(ts), quantity)
+
+    def cram_series(self, times, A=None, int order=14, quantity='moles'):
+        """cram_series(times, A=None, int order=14, quantity='moles')
+        Transmutes the material via the CRAM method to each of a series of
+        times under a constant rate matrix. Each time is reached by a step
+        from the previous one, and equally spaced times share one solver.
+
+        Parameters
+        ----------
+        times : 1D array-like
+            The non-decreasing times [s]
+        A : 1D array-like, optional
+            The flat rate matrix [1/s], the decay matrix by default.
+        order : int, optional
+            The CRAM approximation order (default 14).
+        quantity : str, optional
+            The quantity of each nuclide that is returned, see decay_series().
+
+        Returns
+        -------
+        nucs : list of ints
+            The nuclides that are present at some time.
+        values : 2D ndarray
+            The quantity of each nuclide at each time, with one row per time.
+        """
+        cdef cpp_vector[double] ts = list(times)
+        cdef cpp_vector[double] cpp_A
+        if A is None:
+            return _series_values(self.mat_pointer.cram_series(ts, order),
+                                  quantity)
+        cpp_A = list(np.asarray(A, dtype=np.float64))
+        return _series_values(self.mat_pointer.cram_series(cpp_A, ts, order),
+                              quantity)
+
 
     #
     # Operator Overloads
@@ -1810,6 +1949,230 @@ def from_atom_frac(atom_fracs, double mass=-1.0, double density=-1.0,
 
 
 
+def expand_elements(mats, exception_ids=None, int num_threads=1):
+    """expand_elements(mats, exception_ids=None, num_threads=1)
+    Expands the natural elements of every material of a collection in place,
+    as Material.expand_elements() does, e.g. for a library of element-level
+    CAD materials. The GIL is released while expanding.
+
+    Parameters
+    ----------
+    mats : sequence of Materials
+        The materials to expand.
+    exception_ids : collection of ints, optional
+        The element ids to keep as-is.
+    num_threads : int, optional
+        The number of threads, 0 for all available ones, when PyNE is built
+        with OpenMP.
+    """
+    _elements_all(mats, exception_ids, num_threads, True)
+
+
+def collapse_elements(mats, exception_ids=None, int num_threads=1):
+    """collapse_elements(mats, exception_ids=None, num_threads=1)
+    Collapses the isotopes of every material of a collection into their
+    elements in place, as Material.collapse_elements() does. The GIL is
+    released while collapsing.
+
+    Parameters
+    ----------
+    mats : sequence of Materials
+        The materials to collapse.
+    exception_ids : collection of ints, optional
+        The nuclide ids, without metastable state, to keep as-is.
+    num_threads : int, optional
+        The number of threads, 0 for all available ones, when PyNE is built
+        with OpenMP.
+    """
+    _elements_all(mats, exception_ids, num_threads, False)
+
+
+cdef _elements_all(mats, exception_ids, int num_threads, bint expand):
+    cdef cpp_set[int] ids
+    if exception_ids is not None:
+        for nuc in exception_ids:
+            ids.insert(nucname.id(nuc))
+    mats = list(mats)
+    cdef cpp_vector[cpp_material.Material] cpp_mats
+    cpp_mats.reserve(len(mats))
+    cdef _Material mat
+    for mat in mats:
+        cpp_mats.push_back(mat.mat_pointer[0])
+    with nogil:
+        if expand:
+            cpp_material.expand_elements(cpp_mats, ids, num_threads)
+        else:
+            cpp_material.collapse_elements(cpp_mats, ids, num_threads)
+    cdef int i
+    for i, mat in enumerate(mats):
+        mat.mat_pointer[0] = cpp_mats[i]
+
+
+def transmute_all(mats, A, int order=14):
+    """Transmutes every material of a collection in place via the CRAM
+    method, e.g. all voxel materials of a mesh. The materials are partitioned
+    across threads, when PyNE is built with OpenMP, and the GIL is released
+    while transmuting. Density and metadata of the materials are kept.
+
+    Parameters
+    ----------
+    mats : sequence of Materials
+        The materials to transmute.
+    A : 1D array-like
+        The transmutation matrix shared by all materials [unitless]
+    order : int, optional
+        The CRAM approximation order (default 14).
+    """
+    A = np.asarray(A, dtype=np.float64)
+    cdef int Alen = len(A)
+    cdef double* Aptr = <double*> np.PyArray_DATA(A)
+    cdef cpp_vector[double] cpp_A = cpp_vector[double]()
+    cpp_A.assign(Aptr, Aptr + Alen)
+    mats = list(mats)
+    cdef cpp_vector[cpp_material.Material] cpp_mats
+    cpp_mats.reserve(len(mats))
+    cdef _Material mat
+    for mat in mats:
+        cpp_mats.push_back(mat.mat_pointer[0])
+    with nogil:
+        cpp_material.transmute_all(cpp_mats, cpp_A, order)
+    cdef int i
+    for i, mat in enumerate(mats):
+        mat.mat_pointer[0] = cpp_mats[i]
+
+
+def mix(mats, weights):
+    """mix(mats, weights)
+    Mixes a collection of materials, as the sum of mats[i] * weights[i]. The
+    nuclide masses are accumulated in one buffer and the composition is
+    normalized once, rather than once per constituent as with the + operator,
+    e.g. for the homogenization of the cells of a mesh voxel.
+
+    Parameters
+    ----------
+    mats : sequence of Materials
+        The materials to mix.
+    weights : sequence of floats
+        The weight of each material, by which its mass is scaled.
+
+    Returns
+    -------
+    mix : Material
+        The mixture, whose mass is the sum of the weighted masses.
+    """
+    mats = list(mats)
+    cdef cpp_vector[double] cpp_weights = list(weights)
+    cdef cpp_vector[cpp_material.const_Material_ptr] cpp_mats
+    cpp_mats.reserve(len(mats))
+    cdef _Material mat
+    for mat in mats:
+        cpp_mats.push_back(mat.mat_pointer)
+    cdef _Material pymat = Material()
+    pymat.mat_pointer[0] = cpp_material.mix(cpp_mats, cpp_weights)
+    return pymat
+
+
+def photon_sources(mats, e_bounds, bint norm=False, int num_threads=1):
+    """photon_sources(mats, e_bounds, norm=False, num_threads=1)
+    Bins the photon sources of a collection of materials, e.g. the voxel
+    materials of an activated mesh, as Material.photon_source() does. The
+    line spectra of the nuclides are binned once for all materials, and the
+    GIL is released while binning.
+
+    Parameters
+    ----------
+    mats : sequence of Materials
+        The materials.
+    e_bounds : 1D array-like
+        The increasing group bounds [keV]
+    norm : bool, optional
+        Whether the intensities of each material sum to one.
+    num_threads : int, optional
+        The number of threads, 0 for all available ones, when PyNE is built
+        with OpenMP.
+
+    Returns
+    -------
+    src : 2D ndarray
+        The group intensities with one row per material, the layout of a
+        source density tag of the source Sampler.
+    """
+    cdef cpp_vector[double] bounds = list(e_bounds)
+    cdef cpp_vector[cpp_material.Material] cpp_mats
+    cdef cpp_vector[double] src
+    cdef _Material mat
+    for mat in mats:
+        cpp_mats.push_back(mat.mat_pointer[0])
+    with nogil:
+        src = cpp_material.photon_sources(cpp_mats, bounds, norm, num_threads)
+    return np.array(src).reshape((cpp_mats.size(), bounds.size() - 1))
+
+
+def write_mcnp(filename, mats, frac_type='mass', bint mult_den=True,
+               int num_threads=1):
+    """Appends the MCNP material cards of a collection of materials to a
+    file, as the concatenation of their Material.mcnp() strings, e.g. for all
+    voxel materials of a mesh. The cards are streamed to the file rather than
+    joined in memory, and the GIL is released while writing.
+
+    Parameters
+    ----------
+    filename : str
+        Path to the file to append to.
+    mats : sequence of Materials
+        The materials to write.
+    frac_type : str, optional
+        Either 'mass' or 'atom' fractions (default 'mass').
+    mult_den : bool, optional
+        Whether the fractions are multiplied by the density (default True).
+    num_threads : int, optional
+        The number of threads formatting the cards when PyNE is built with
+        OpenMP, 0 for all available ones (default 1). The file is the same
+        for any number of threads.
+    """
+    cdef std_string cpp_filename = filename.encode()
+    cdef std_string cpp_frac_type = frac_type.encode()
+    cdef cpp_vector[cpp_material.Material] cpp_mats
+    cdef _Material mat
+    for mat in mats:
+        cpp_mats.push_back(mat.mat_pointer[0])
+    with nogil:
+        cpp_material.write_mcnp(cpp_filename, cpp_mats, cpp_frac_type,
+                                mult_den, num_threads)
+
+
+def write_fluka(filename, mats, int first_id, frac_type='mass',
+                int num_threads=1):
+    """Appends the FLUKA material cards of a collection of materials to a
+    file, the k-th material getting the id first_id + k, as the concatenation
+    of their Material.fluka() strings. The cards are written as write_mcnp()
+    does.
+
+    Parameters
+    ----------
+    filename : str
+        Path to the file to append to.
+    mats : sequence of Materials
+        The materials to write.
+    first_id : int
+        The FLUKA material id of the first material.
+    frac_type : str, optional
+        Either 'mass' or 'atom' fractions (default 'mass').
+    num_threads : int, optional
+        The number of threads formatting the cards when PyNE is built with
+        OpenMP, 0 for all available ones (default 1).
+    """
+    cdef std_string cpp_filename = filename.encode()
+    cdef std_string cpp_frac_type = frac_type.encode()
+    cdef cpp_vector[cpp_material.Material] cpp_mats
+    cdef _Material mat
+    for mat in mats:
+        cpp_mats.push_back(mat.mat_pointer[0])
+    with nogil:
+        cpp_material.write_fluka(cpp_filename, cpp_mats, first_id,
+                                 cpp_frac_type, num_threads)
+
+
 def from_hdf5(filename, datapath, int row=-1, int protocol=1):
     """from_hdf5(char * filename, char * datapath, int row=-1, int protocol=1)
     Create a Material object from an HDF5 file.
@@ -1857,6 +2220,158 @@ def from_hdf5(filename, datapath, int row=-1, int protocol=1):
 
 
 
+def from_hdf5_rows(filename, datapath="/mat_name", int start=0, int count=-1):
+    """from_hdf5_rows(filename, datapath="/mat_name", int start=0, int count=-1)
+    Creates the Material objects of a range of rows of a protocol 1 HDF5
+    material table. The file is opened once and the rows are read with a
+    single hyperslab read, instead of once per row as with from_hdf5().
+
+    Parameters
+    ----------
+    filename : str
+        Path to HDF5 file that contains the data to read in.
+    datapath : str, optional
+        Path to HDF5 table or group that represents the data.
+    start : int, optional
+        The first row to read, defaults to 0.  Negative indexing is allowed.
+    count : int, optional
+        The number of rows to read, defaults to all rows from start.
+
+    Returns
+    -------
+    mats : list of Materials
+        The materials of the rows, in order.
+
+    See Also
+    --------
+    from_hdf5 : Reads a single row.
+
+    """
+    cdef std_string c_filename = filename.encode('UTF-8')
+    cdef std_string c_datapath = datapath.encode('UTF-8')
+    cdef cpp_material.MaterialTable * table = new cpp_material.MaterialTable(
+        c_filename, c_datapath, start, count)
+    cdef int k
+    cdef _Material mat
+    mats = []
+    try:
+        for k in range(table.size()):
+            mat = Material()
+            mat.mat_pointer[0] = table.material(k)
+            mats.append(mat)
+    finally:
+        del table
+    return mats
+
+
+def write_hdf5_rows(mats, filename, datapath="/mat_name", int chunksize=100,
+                    int deflate=1, shuffle=False):
+    """write_hdf5_rows(mats, filename, datapath="/mat_name", int chunksize=100, int deflate=1, shuffle=False)
+    Appends materials as rows of a protocol 1 HDF5 material table, like
+    calling Material.write_hdf5() on each of them, but with the table extended
+    once and all rows written at once.
+
+    Parameters
+    ----------
+    mats : sequence of Materials
+        The materials to append.
+    filename : str
+        Path to HDF5 file to write the data to.
+    datapath : str, optional
+        Path to HDF5 table or group that represents the data.
+    chunksize : int, optional
+        The chunksize of new material datasets on disk.
+    deflate : int, optional
+        The deflate compression level of new datasets, 0 for no compression.
+    shuffle : bool, optional
+        Whether new composition datasets use the shuffle filter.
+
+    See Also
+    --------
+    from_hdf5_rows : Reads the rows back.
+
+    """
+    cdef std_string c_filename = filename.encode('UTF-8')
+    cdef std_string c_datapath = datapath.encode('UTF-8')
+    cdef cpp_vector[cpp_material.Material] cpp_mats
+    cdef _Material mat
+    for mat in mats:
+        cpp_mats.push_back(mat.mat_pointer[0])
+    cpp_material.write_hdf5_rows(cpp_mats, c_filename, c_datapath, chunksize,
+                                 deflate, <cpp_bool> shuffle)
+
+
+def write_binary_library(mats, filename):
+    """write_binary_library(mats, filename)
+    Writes materials to a binary material library file, replacing it. The
+    compositions are stored as sparse rows over one table of all their
+    nuclides, next to columns of mass, density and atoms per molecule, so the
+    file is read back by memory mapping it rather than parsing it.
+
+    Parameters
+    ----------
+    mats : sequence of Materials
+        The materials to write, in order.
+    filename : str
+        Path to the file to write.
+
+    See Also
+    --------
+    from_binary_library : Reads the materials back.
+
+    """
+    cdef std_string c_filename = filename.encode('UTF-8')
+    cdef cpp_vector[cpp_material.Material] cpp_mats
+    cdef _Material mat
+    for mat in mats:
+        cpp_mats.push_back(mat.mat_pointer[0])
+    cpp_material.write_binary_library(cpp_mats, c_filename)
+
+
+def from_binary_library(filename, int start=0, int count=-1):
+    """from_binary_library(filename, int start=0, int count=-1)
+    Creates the Material objects of a range of a binary material library
+    written by write_binary_library(). The file is memory mapped, so only the
+    requested materials are read from it.
+
+    Parameters
+    ----------
+    filename : str
+        Path to the binary material library.
+    start : int, optional
+        The first material to read, defaults to 0.  Negative indexing is
+        allowed.
+    count : int, optional
+        The number of materials to read, defaults to all from start.
+
+    Returns
+    -------
+    mats : list of Materials
+        The materials of the range, in order.
+
+    """
+    cdef std_string c_filename = filename.encode('UTF-8')
+    cdef cpp_material.BinaryMaterialLibrary * lib = \
+        new cpp_material.BinaryMaterialLibrary(c_filename)
+    cdef int k
+    cdef _Material mat
+    mats = []
+    try:
+        if start < 0:
+            start += lib.size()
+        if count < 0:
+            count = lib.size() - start
+        if start < 0 or lib.size() < start + count:
+            raise IndexError("Material library index out of range.")
+        for k in range(start, start + count):
+            mat = Material()
+            mat.mat_pointer[0] = lib.material(k)
+            mats.append(mat)
+    finally:
+        del lib
+    return mats
+
+
 def from_text(filename, double mass=-1.0, double atoms_per_molecule=-1.0, metadata=None):
     """from_text(char * filename, double mass=-1.0, double atoms_per_molecule=-1.0)
     Create a Material object from a simple text file.
@@ -2262,59 +2777,74 @@ cdef class _MaterialLibrary(object):
         del self._lib[key]
 
     def from_json(self, file):
-        """Loads data from a JSON file into this material library.
+        """Loads data from a JSON file into this material library. The file is
+        read material by material, without building its JSON tree.
 
         Parameters
         ----------
-        file : str
-            A path to a JSON file.
+        file : str or file-like
+            A path to a JSON file, or an open file.
 
         """
         cdef std_string s
-        cdef bint opened_here = False
-        cdef cpp_jsoncpp.Value jsonlib
-        cdef cpp_jsoncpp.Reader reader = cpp_jsoncpp.Reader()
         cdef int i
-        cdef std_string key
-        cdef cpp_vector[std_string] keys
+        cdef cpp_vector[std_string] names
+        cdef cpp_vector[cpp_material.Material] cpp_mats
+        cdef char * cs
         cdef _Material mat
         cdef dict _lib = (<_MaterialLibrary> self)._lib
         if isinstance(file, basestring):
-            file = open(file, 'r')
-            opened_here = True
-        fstr = file.read()
-        if isinstance(fstr, str):
-            fstr = fstr.encode()
-        s = std_string(<char *> fstr)
-        if opened_here:
-            file.close()
-        reader.parse(s, jsonlib)
-        keys = jsonlib.getMemberNames()
-        for i in range(len(keys)):
+            s = file.encode()
+            with nogil:
+                cpp_material.read_json_library(s, names, cpp_mats)
+        else:
+            fstr = file.read()
+            if isinstance(fstr, str):
+                fstr = fstr.encode()
+            cs = fstr
+            with nogil:
+                cpp_material.read_json_library(cs, cs + len(fstr), names,
+                                               cpp_mats)
+        for i in range(cpp_mats.size()):
             mat = Material()
-            key = keys[i]
-            (<_Material> mat).mat_pointer.load_json(jsonlib[key])
-            _lib[bytes(key.c_str()).decode()] = mat
+            mat.mat_pointer[0] = cpp_mats[i]
+            _lib[bytes(names[i].c_str()).decode()] = mat
 
-    def write_json(self, file):
+    def write_json(self, file, compact=False):
         """Writes this material library to a JSON file.
 
         Parameters
         ----------
-        file : str
-            A path to a JSON file.
+        file : str or file-like
+            A path to a JSON file, or an open file.
+        compact : bool, optional
+            Whether to write the library on one line without indentation. A
+            compact library written to a path is streamed material by
+            material, without building its JSON tree.
 
         """
         cdef std_string s
         cdef std_string skey
         cdef bint opened_here = False
-        cdef cpp_jsoncpp.Value jsonlib = cpp_jsoncpp.Value(cpp_jsoncpp.objectValue)
-        cdef cpp_jsoncpp.StyledWriter writer = cpp_jsoncpp.StyledWriter()
+        cdef cpp_vector[std_string] names
+        cdef cpp_vector[cpp_material.Material] cpp_mats
+        cdef cpp_jsoncpp.Value jsonlib
+        cdef cpp_jsoncpp.StyledWriter writer
+        cdef cpp_jsoncpp.FastWriter fast_writer
+        if compact and isinstance(file, basestring):
+            for key, mat in self._lib.items():
+                names.push_back(key.encode())
+                cpp_mats.push_back((<_Material> mat).mat_pointer[0])
+            s = file.encode()
+            with nogil:
+                cpp_material.write_json_library(s, names, cpp_mats)
+            return
+        jsonlib = cpp_jsoncpp.Value(cpp_jsoncpp.objectValue)
         for key, mat in self._lib.items():
             key = key.encode()
             skey = std_string(<char *> key)
             jsonlib[skey] = (<_Material> mat).mat_pointer.dump_json()
-        s = writer.write(jsonlib)
+        s = fast_writer.write(jsonlib) if compact else writer.write(jsonlib)
         if isinstance(file, basestring):
             file = open(file, 'w')
             opened_here = True
@@ -85,6 +85,9 @@ import pyne.stlcontainers as conv
 
 warn(__name__ + " is not yet QA compliant.", QAWarning)
 
+# the maps are filled on first use, fill them before exposing them
+cpp_particle.ensure_maps()
+
 # names
 cdef conv._SetStr names_proxy = conv.SetStr(False)
 names_proxy.set_ptr = &cpp_particle.names
@@ -19,6 +19,10 @@ cdef class Sampler:
     cdef public bint _free_inst
 
 
+cdef class PartitionedSampler:
+    cdef cpp_source_sampling.PartitionedSampler * _inst
+
+
 cdef class AliasTable:
     cdef void * _inst
     cdef public bint _free_inst
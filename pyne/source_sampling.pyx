@@ -21,6 +21,54 @@ import numpy as np
 
 np.import_array()
 
+# In-group energy sampling modes, see Sampler.set_energy_mode
+E_LINEAR = cpp_source_sampling.E_LINEAR
+E_LOG = cpp_source_sampling.E_LOG
+E_TABULATED = cpp_source_sampling.E_TABULATED
+
+
+
+def measure_many(coords):
+    """measure_many(coords)
+    Returns the volumes of tetrahedral or hexahedral mesh volume elements, as
+    the Sampler computes them.
+
+    Parameters
+    ----------
+    coords : array-like of shape (number of elements, 4 or 8, 3)
+        The vertex coordinates of each element, in MOAB connectivity order.
+
+    Returns
+    -------
+    volumes : ndarray of float64
+        The signed volume of each element.
+    """
+    cdef np.ndarray[np.float64_t, ndim=3] c = np.asarray(coords,
+                                                         dtype=np.float64)
+    cdef size_t num_elems = c.shape[0]
+    cdef int num_vertices = c.shape[1]
+    cdef cpp_source_sampling.EntityType ve_type
+    if c.shape[2] != 3:
+        raise ValueError("coords must have 3 coordinates per vertex")
+    if num_vertices == 4:
+        ve_type = cpp_source_sampling.MBTET
+    elif num_vertices == 8:
+        ve_type = cpp_source_sampling.MBHEX
+    else:
+        raise ValueError("elements must be tets with 4 vertices or hexes "
+                         "with 8 vertices")
+    cdef np.ndarray xs = np.ascontiguousarray(c[:, :, 0]).ravel()
+    cdef np.ndarray ys = np.ascontiguousarray(c[:, :, 1]).ravel()
+    cdef np.ndarray zs = np.ascontiguousarray(c[:, :, 2]).ravel()
+    cdef np.ndarray volumes = np.empty(num_elems, dtype=np.float64)
+    cdef double * px = <double *> np.PyArray_DATA(xs)
+    cdef double * py = <double *> np.PyArray_DATA(ys)
+    cdef double * pz = <double *> np.PyArray_DATA(zs)
+    cdef double * pv = <double *> np.PyArray_DATA(volumes)
+    with nogil:
+        cpp_source_sampling.measure_many(ve_type, num_vertices, num_elems, NULL,
+                                         px, py, pz, pv)
+    return volumes
 
 
 cdef class AliasTable:
@@ -56,13 +104,16 @@ cdef class AliasTable:
         self._alias = None
         self._prob = None
 
-    def __init__(self, p):
-        """AliasTable(self, p)
+    def __init__(self, p, num_threads=1):
+        """AliasTable(self, p, num_threads=1)
         Constructor
         
         Parameters
         ----------
         p : std::vector< double >
+        num_threads : int
+            The number of threads to build the table with, all available if
+            less than 1.
         
         Returns
         -------
@@ -84,7 +135,7 @@ cdef class AliasTable:
             p_proxy = cpp_vector[double](<size_t> p_size)
             for ip in range(p_size):
                 p_proxy[ip] = <double> p[ip]
-        self._inst = new cpp_source_sampling.AliasTable(p_proxy)
+        self._inst = new cpp_source_sampling.AliasTable(p_proxy, <int> num_threads)
     
     
     def __dealloc__(self):
@@ -254,7 +305,12 @@ cdef class Sampler:
     sample_e
     sample_w
     sample_xyz
+    read_state
+    read_shared_state
+    set_energy_mode
+    set_group_spectra
     setup
+    write_state
     
     Notes
     -----
@@ -504,6 +560,197 @@ cdef class Sampler:
         return SourceParticle(c_src.get_x(), c_src.get_y(), c_src.get_z(), \
                 c_src.get_e(), c_src.get_w(), c_src.get_cell_list())
 
+    def set_energy_mode(self, e_mode):
+        """set_energy_mode(self, e_mode)
+        Sets how energies are sampled within an energy group.
+
+        Parameters
+        ----------
+        e_mode : int
+            E_LINEAR (default) samples uniformly in energy, E_LOG uniformly in
+            lethargy (all energy bounds must be positive) and E_TABULATED from
+            the sub-spectra given to set_group_spectra.
+
+        """
+        (<cpp_source_sampling.Sampler *> self._inst).set_energy_mode(
+                <cpp_source_sampling.EnergyMode> e_mode)
+
+    def set_group_spectra(self, bounds, pdfs):
+        """set_group_spectra(self, bounds, pdfs)
+        Supplies tabulated sub-spectra shared by all mesh volume elements,
+        one per energy group, and switches to E_TABULATED sampling.
+
+        Parameters
+        ----------
+        bounds : list of lists of floats
+            For each energy group, the ascending sub-bin energy boundaries,
+            which must lie within the group. An empty list samples the group
+            uniformly.
+        pdfs : list of lists of floats
+            For each energy group, the relative sub-bin probabilities.
+
+        """
+        cdef cpp_vector[cpp_vector[double]] bounds_proxy
+        cdef cpp_vector[cpp_vector[double]] pdfs_proxy
+        for b in bounds:
+            bounds_proxy.push_back(convert_nparray_to_vector(b) if len(b) > 0
+                                   else cpp_vector[double]())
+        for p in pdfs:
+            pdfs_proxy.push_back(convert_nparray_to_vector(p) if len(p) > 0
+                                 else cpp_vector[double]())
+        (<cpp_source_sampling.Sampler *> self._inst).set_group_spectra(
+                bounds_proxy, pdfs_proxy)
+
+    def write_state(self, filename):
+        """write_state(self, filename)
+        Writes the fully built source model to a flat binary state file that
+        read_state() maps read-only.
+
+        Parameters
+        ----------
+        filename : str
+            The path to the state file.
+
+        """
+        filename_bytes = filename.encode()
+        (<cpp_source_sampling.Sampler *> self._inst).write_state(
+                std_string(<char *> filename_bytes))
+
+    def matches_source(self, filename, mode):
+        """matches_source(self, filename, mode)
+        Returns True if the sampler was built in the given mode from the mesh
+        file, and the file has not changed since.
+
+        Parameters
+        ----------
+        filename : str
+            The path to the MOAB mesh (.h5m) file.
+        mode : int
+            The mode number, 0, 1, 2, 3, 4 or 5.
+
+        """
+        filename_bytes = filename.encode()
+        return bool((<cpp_source_sampling.Sampler *> self._inst).matches_source(
+                std_string(<char *> filename_bytes), <int> mode))
+
+    @staticmethod
+    def read_state(filename):
+        """read_state(filename)
+        Creates a sampler from a state file written by write_state(). The
+        file is mapped read-only instead of rebuilding the source model.
+
+        Parameters
+        ----------
+        filename : str
+            The path to the state file.
+
+        Returns
+        -------
+        sampler : Sampler
+
+        """
+        cdef Sampler sampler = Sampler.__new__(Sampler)
+        filename_bytes = filename.encode()
+        sampler._inst = cpp_source_sampling.Sampler.read_state(
+                std_string(<char *> filename_bytes))
+        return sampler
+
+    @staticmethod
+    def read_shared_state(state_file, filename, tag_names, e_bounds, mode):
+        """read_shared_state(state_file, filename, tag_names, e_bounds, mode)
+        Creates a sampler whose tables are shared by all the processes of a
+        node. The first process to find the state file missing or out of date
+        builds the sampler and writes the state file, and every process maps
+        it read-only. The other arguments are those of the constructor.
+
+        Parameters
+        ----------
+        state_file : str
+            The path to the shared state file, e.g. under /dev/shm.
+
+        Returns
+        -------
+        sampler : Sampler
+
+        """
+        cdef cpp_map[std_string, std_string] cpp_tag_names = \
+                cpp_map[std_string, std_string]()
+        for key, value in tag_names.items():
+            key = key.encode('utf-8')
+            value = value.encode('utf-8')
+            cpp_tag_names[key] = value
+        cdef Sampler sampler = Sampler.__new__(Sampler)
+        state_file_bytes = state_file.encode()
+        filename_bytes = filename.encode()
+        sampler._inst = cpp_source_sampling.Sampler.read_shared_state(
+                std_string(<char *> state_file_bytes),
+                std_string(<char *> filename_bytes), cpp_tag_names,
+                convert_nparray_to_vector(e_bounds), <int> mode)
+        return sampler
+
+    property source_strength:
+        """The total source of the mesh, density times volume summed over
+        all volume elements and energy groups."""
+        def __get__(self):
+            return (<cpp_source_sampling.Sampler *> self._inst)\
+                    .get_source_strength()
+
+    property biased_strength:
+        """The total biased source the sampler draws from."""
+        def __get__(self):
+            return (<cpp_source_sampling.Sampler *> self._inst)\
+                    .get_biased_strength()
+
+
+cdef class PartitionedSampler:
+    """Hierarchical sampler over a source mesh split into partitions, each
+    with its own sampler state file written by Sampler.write_state(). A top
+    level alias table over the partitions picks one, whose state file is only
+    mapped once a particle is first born in it.
+
+    Parameters
+    ----------
+    state_files : list of str
+        The state file of each partition. All partitions must have been built
+        in the same mode.
+
+    """
+
+    def __cinit__(self, state_files):
+        cdef cpp_vector[std_string] state_files_proxy
+        for f in state_files:
+            state_files_proxy.push_back(f.encode('utf-8'))
+        self._inst = new cpp_source_sampling.PartitionedSampler(
+                state_files_proxy)
+
+    def __dealloc__(self):
+        del self._inst
+
+    def particle_birth(self, rands):
+        """particle_birth(self, rands)
+        Samples particle birth parameters from six random numbers, the first
+        of which also selects the partition.
+
+        Returns
+        -------
+        res1 : SourceParticle
+
+        """
+        cdef cpp_source_sampling.SourceParticle c_src = \
+                self._inst.particle_birth(convert_nparray_to_vector(rands))
+        return SourceParticle(c_src.get_x(), c_src.get_y(), c_src.get_z(), \
+                c_src.get_e(), c_src.get_w(), c_src.get_cell_list())
+
+    property num_partitions:
+        """The number of partitions."""
+        def __get__(self):
+            return self._inst.num_partitions()
+
+    property cell_list_size:
+        """The length of the cell lists of the particles."""
+        def __get__(self):
+            return self._inst.get_cell_list_size()
+
 
 cdef class SourceParticle:
     """Constructor for class SourceParticle
@@ -40,6 +40,7 @@ def solve(inputdict_unchecked):
     |   converge_tolerance  |    float     |            Tolerance             |          1.e-10          |
     |     max_iterations    |     Int      |     Max Iterations for Sweep     |          10000           |
     |   moments_converged   |     Int      | Moments Converged Upon Per Quad  |            0             |
+    |      inner_solver     |    String    | Inner Iteration Solver SI/GMRES  |            SI            |
     +-----------------------+--------------+----------------------------------+--------------------------+
 
     Output Dictionary Key Pair Values 
@@ -53,6 +54,7 @@ def solve(inputdict_unchecked):
     | total_time |    Double    |    Total Solver Run Time    |
     | print_time |    Double    | Time Taken to Print Results |
     | error_msg  |    String    |  Error Message (if failure) |
+    | iterations |  Int Array   | Sweeps Taken for Each Group |
     +------------+--------------+-----------------------------+'
 
     For more detailed information about the input & output key-pair values, see:
@@ -96,7 +98,8 @@ def solve(inputdict_unchecked):
         inputdict['max_mom_printed'],
         inputdict['moment_sum_flag'],
         inputdict['mom_at_a_pt_flag'],
-        inputdict['quad_flux_print_flag'])
+        inputdict['quad_flux_print_flag'],
+        inputdict['inner_solver'])
 
     solver_output = inputdict;
     solver_output['flux'] = fortran_returns[6].tolist()
@@ -104,6 +107,7 @@ def solve(inputdict_unchecked):
     tsolve = fortran_returns[8]
     ttosolve = fortran_returns[9]
     tend = fortran_returns[10]
+    solver_output['iterations'] = fortran_returns[11].tolist()
   
     if(error_code == 0):
         solver_output['success'] = 1
@@ -154,7 +158,8 @@ def _error_to_string(error_code):
         1034: "ERROR: Illegal value for max moment to print, momp. Must be between 0 and lambda.",
         1035: "ERROR: Illegal value for flag for moment summing. Must be 0 for off or 1 for on.",
         1036: "ERROR: Illegal value for flag for moment sum at non-center point. Must be 0/1=off/on.",
-        1037: "ERROR: Illegal value for flag for printing average flux of the four quadrants. Must be 0/1 = off/on."
+        1037: "ERROR: Illegal value for flag for printing average flux of the four quadrants. Must be 0/1 = off/on.",
+        1038: "ERROR: Illegal inner solver. Must be SI or GMRES."
   };
     return err_dictionary[error_code] 
 
@@ -244,4 +249,8 @@ def _dict_complete(inputdict):
     except:
         formatted_dict['converge_tolerence'] = 1e-10
         warn(warning_msg + " converge_tolerence value of 1e-10")
+    try:
+        formatted_dict['inner_solver'] = inputdict['inner_solver']
+    except:
+        formatted_dict['inner_solver'] = "SI"
     return formatted_dict
@@ -28,4 +28,5 @@ cdef class Tally:
     cdef public stlcontainers._MapStrStr _rx2mcnp6
     pass
 
-
+cdef class TallyCollection:
+    cdef cpp_tally.TallyCollection * _inst
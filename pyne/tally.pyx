@@ -928,4 +928,76 @@ cdef class Tally:
 
 
 
+cdef class TallyCollection:
+    """A set of volume and surface tallies stored column by column, which is
+    written to or read from HDF5 in one operation. The HDF5 layout is that of
+    Tally.write_hdf5(), so either class can read back what the other wrote.
+
+    Parameters
+    ----------
+    tallies : sequence of Tally, optional
+        Volume or surface tallies of flux or current to start with.
+    """
+
+    def __cinit__(self, tallies=None):
+        self._inst = new cpp_tally.TallyCollection()
+        if tallies is not None:
+            for tal in tallies:
+                self.append(tal)
+
+    def __dealloc__(self):
+        del self._inst
+
+    def __len__(self):
+        return self._inst.size()
+
+    def __getitem__(self, int i):
+        cdef Tally tal = Tally()
+        if i < 0:
+            i += self._inst.size()
+        (<cpp_tally.Tally *> tal._inst)[0] = self._inst.at(i)
+        return tal
+
+    def __iter__(self):
+        for i in range(len(self)):
+            yield self[i]
+
+    def append(self, Tally tal):
+        """append(tal)
+        Appends a volume or surface tally of flux or current.
+        """
+        self._inst.push_back((<cpp_tally.Tally *> tal._inst)[0])
+
+    def clear(self):
+        """clear()
+        Removes all tallies.
+        """
+        self._inst.clear()
+
+    def write_hdf5(self, filename, datapath):
+        """write_hdf5(filename, datapath)
+        Writes all tallies with one HDF5 write, appending them to the dataset
+        at datapath if it exists and creating the file or dataset if not.
+        """
+        cdef std_string fname = filename.encode()
+        cdef std_string dpath = datapath.encode()
+        with nogil:
+            self._inst.write_hdf5(fname, dpath)
+
+    def from_hdf5(self, filename, datapath):
+        """from_hdf5(filename, datapath)
+        Replaces the tallies by the whole dataset at datapath, read with one
+        HDF5 read.
+        """
+        cdef std_string fname = filename.encode()
+        cdef std_string dpath = datapath.encode()
+        with nogil:
+            self._inst.from_hdf5(fname, dpath)
+
+    property strings:
+        """The distinct names of the tallies, entities and particles."""
+        def __get__(self):
+            return [s.decode() for s in self._inst.strings]
+
+
 {'cpppxd_footer': '', 'pyx_header': '', 'pxd_header': '', 'pxd_footer': '', 'cpppxd_header': '', 'pyx_footer': ''}
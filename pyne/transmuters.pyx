@@ -1,6 +1,7 @@
 # Cython Imports
 from libcpp.map cimport map as cpp_map
 from libcpp.vector cimport vector as cpp_vector
+from libcpp.string cimport string as std_string
 
 # Local imports
 cimport cpp_transmuters
@@ -50,3 +51,246 @@ def cram(A, n0, int order=14):
     cdef conv._MapIntDouble n1 = conv.MapIntDouble()
     n1.map_ptr = new cpp_map[int, double](cpp_n1)
     return n1
+
+
+cdef class CramSolver:
+    """CRAM solver for applying the same (flat) A matrix to many initial
+    compositions. The approximation order is resolved and the matrix and work
+    vectors are set up once, so each solve only evaluates the rational
+    approximation.
+
+    Parameters
+    ----------
+    A : 1D array-like
+        The transmutation matrix [unitless]
+    order : int, optional
+        The order of approximation, default 14.
+    """
+    cdef cpp_transmuters.CramSolver* _inst
+
+    def __cinit__(self, A, int order=14):
+        A = np.asarray(A, dtype=np.float64)
+        cdef int Alen = len(A)
+        cdef double* Aptr = <double*> np.PyArray_DATA(A)
+        cdef cpp_vector[double] cpp_A = cpp_vector[double]()
+        cpp_A.assign(Aptr, Aptr + Alen)
+        self._inst = new cpp_transmuters.CramSolver(cpp_A, order)
+
+    def __dealloc__(self):
+        del self._inst
+
+    property order:
+        """The order of approximation."""
+        def __get__(self):
+            return self._inst.get_order()
+
+    def solve(self, b):
+        """Transmutes dense compositions in the CRAM nuclide order
+        (pyne.cram.NUCS).
+
+        Parameters
+        ----------
+        b : array-like
+            Either one composition of length len(pyne.cram.NUCS), or a 2D
+            array with one composition per row [atom fraction].
+
+        Returns
+        -------
+        x : ndarray
+            The resulting compositions, with the same shape as b
+            [atom fraction].
+        """
+        cdef np.ndarray bb = np.ascontiguousarray(b, dtype=np.float64)
+        cdef int n = self._inst.size()
+        if bb.shape[bb.ndim - 1] != n:
+            raise ValueError("compositions must have {0} entries".format(n))
+        cdef np.ndarray x = np.empty_like(bb)
+        cdef int nrhs = bb.size // n
+        self._inst.solve_many(<double*> np.PyArray_DATA(bb), nrhs,
+                              <double*> np.PyArray_DATA(x))
+        return x
+
+    def transmute(self, n0):
+        """Transmutes a nuclide atom fraction composition map, see cram().
+
+        Parameters
+        ----------
+        n0 : Mapping
+            The initial compositions [atom fraction]
+
+        Returns
+        -------
+        n1 : Mapping
+            The result of the transmutation [atom fraction]
+        """
+        cdef cpp_map[int, double] cpp_n0 = cpp_map[int, double]()
+        for key, value in n0.items():
+            cpp_n0[nucname.id(key)] = value
+        cdef conv._MapIntDouble n1 = conv.MapIntDouble()
+        n1.map_ptr = new cpp_map[int, double](self._inst.solve(cpp_n0))
+        return n1
+
+
+cdef class CramDepletion:
+    """Dense nuclide vector in the CRAM index space that is carried through a
+    sequence of transmutation steps, so that no composition map is built
+    between steps.
+
+    Parameters
+    ----------
+    n0 : Mapping
+        The initial compositions [atom fraction]
+    order : int, optional
+        The order of approximation, default 14.
+    """
+    cdef cpp_transmuters.CramDepletion* _inst
+
+    def __cinit__(self, n0, int order=14):
+        cdef cpp_map[int, double] cpp_n0 = cpp_map[int, double]()
+        for key, value in n0.items():
+            cpp_n0[nucname.id(key)] = value
+        self._inst = new cpp_transmuters.CramDepletion(cpp_n0, order)
+
+    def __dealloc__(self):
+        del self._inst
+
+    property order:
+        """The order of approximation."""
+        def __get__(self):
+            return self._inst.get_order()
+
+    property vector:
+        """A copy of the current dense compositions, in the CRAM nuclide
+        order (pyne.cram.NUCS) [atom fraction]."""
+        def __get__(self):
+            cdef cpp_vector[double] x = self._inst.get_vector()
+            return np.array([x[i] for i in range(x.size())], dtype=np.float64)
+
+    def step(self, A, dt=None):
+        """Advances by one step.
+
+        Parameters
+        ----------
+        A : 1D array-like
+            The transmutation matrix of the step [unitless], or the rate
+            matrix [1/s] when dt is given.
+        dt : float, optional
+            The length of the step [s].
+        """
+        A = np.asarray(A, dtype=np.float64)
+        cdef int Alen = len(A)
+        cdef double* Aptr = <double*> np.PyArray_DATA(A)
+        cdef cpp_vector[double] cpp_A = cpp_vector[double]()
+        cpp_A.assign(Aptr, Aptr + Alen)
+        if dt is None:
+            self._inst.step(cpp_A)
+        else:
+            self._inst.step(cpp_A, <double> dt)
+
+    def comp(self):
+        """Returns the current compositions as a nuclide map [atom fraction].
+        """
+        cdef conv._MapIntDouble n1 = conv.MapIntDouble()
+        n1.map_ptr = new cpp_map[int, double](self._inst.get_comp())
+        return n1
+
+
+cdef class CramMatrixBuilder:
+    """Bulk assembler of flat A matrices in the fixed CRAM sparsity pattern.
+    Reaction channels are resolved to their matrix slots once, so rebuilding
+    A for a new set of reaction rates, e.g. for every mesh voxel, is a single
+    pass over the decay matrix and the channels.
+
+    Parameters
+    ----------
+    decay : bool, optional
+        Whether the decay matrix is included in the assembled matrices,
+        default True.
+    """
+    cdef cpp_transmuters.CramMatrixBuilder* _inst
+
+    def __cinit__(self, bint decay=True):
+        self._inst = new cpp_transmuters.CramMatrixBuilder(decay)
+
+    def __dealloc__(self):
+        del self._inst
+
+    property num_channels:
+        """The number of reaction channels added so far."""
+        def __get__(self):
+            return self._inst.num_channels()
+
+    def index(self, nuc):
+        """Returns the CRAM index of a nuclide, or -1 if it is not tracked."""
+        return self._inst.index(nucname.id(nuc))
+
+    def slot(self, int i, int j):
+        """Returns the slot of entry (i, j) in the flat array, or -1 if the
+        entry is not in the sparsity pattern."""
+        return self._inst.slot(i, j)
+
+    def add_channel(self, parent, child=None, rx=None, z='n'):
+        """Adds a reaction channel that removes parent and produces either
+        the given child nuclide or the product of reaction rx. A child that
+        is not tracked by CRAM only removes the parent.
+
+        Parameters
+        ----------
+        parent : str or int
+            The target nuclide.
+        child : str or int, optional
+            The product nuclide, 0 for none.
+        rx : str, optional
+            The reaction, used when child is not given.
+        z : str, optional
+            The incident particle type, default 'n'.
+
+        Returns
+        -------
+        idx : int
+            The index of the channel in the rates given to assemble().
+        """
+        cdef int p = nucname.id(parent)
+        if child is not None:
+            c = 0 if child == 0 else nucname.id(child)
+            return self._inst.add_channel(p, <int> c)
+        if rx is None:
+            raise ValueError("either child or rx must be given")
+        rx = rx.encode()
+        z = z.encode()
+        return self._inst.add_channel(p, <std_string> rx, <std_string> z)
+
+    def assemble(self, rates, double dt=1.0):
+        """Assembles the flat transmutation matrix dt*(D + R), where D is the
+        decay rate matrix and R holds the reaction rates of the channels.
+
+        Parameters
+        ----------
+        rates : array-like
+            Either num_channels reaction rates, or a 2D array with one set
+            of rates per row, e.g. per mesh voxel [1/s].
+        dt : float, optional
+            The length of the step [s], default 1.
+
+        Returns
+        -------
+        A : ndarray
+            The flat transmutation matrices, one per row of rates
+            [unitless].
+        """
+        cdef np.ndarray r = np.ascontiguousarray(rates, dtype=np.float64)
+        cdef int nch = self._inst.num_channels()
+        if r.ndim == 0 or r.shape[r.ndim - 1] != nch:
+            raise ValueError("rates must have {0} entries".format(nch))
+        cdef int nnz = self._inst.nnz()
+        cdef int nset = r.size // nch if nch > 0 else \
+            (1 if r.ndim == 1 else r.shape[0])
+        shape = (nnz,) if r.ndim == 1 else (nset, nnz)
+        cdef np.ndarray A = np.empty(shape, dtype=np.float64)
+        cdef double* rptr = <double*> np.PyArray_DATA(r)
+        cdef double* Aptr = <double*> np.PyArray_DATA(A)
+        cdef int k
+        with nogil:
+            for k in range(nset):
+                self._inst.assemble(rptr + k*nch, dt, Aptr + k*nnz)
+        return A
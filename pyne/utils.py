@@ -7,7 +7,7 @@ from io import open
 
 from pyne._utils import fromstring_split, fromstring_token, endftod,\
                         use_fast_endftod, fromendf_tok, toggle_warnings,\
-                        use_warnings, fromendl_tok
+                        use_warnings, fromendl_tok, stats, reset_stats
 
 
 class QAWarning(UserWarning):
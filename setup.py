@@ -287,6 +287,8 @@ def update_cmake_args(ns):
     if ns.fast is not None:
         fast = 'TRUE' if ns.fast else 'FALSE'
         ns.cmake_args.append('-DPYNE_FAST_COMPILE=' + fast)
+    if ns.instrument:
+        ns.cmake_args.append('-DPYNE_INSTRUMENT=TRUE')
 
 
 def update_make_args(ns):
@@ -335,6 +337,10 @@ def parse_args():
                        action='store_false', help="Will NOT try to compile "
                        "from assembly, if possible. This is slower as it "
                        "must compile from source.")
+    cmake.add_argument('--instrument', default=False, dest='instrument',
+                       action='store_true', help="Compiles in the counters "
+                       "and timers of the hot paths reported by "
+                       "pyne.utils.stats().")
 
     make = parser.add_argument_group('make', 'Make arguments.')
     make.add_argument('-j', help='Degree of parallelism for build.')
@@ -8,83 +8,219 @@
 // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 
-#ifndef PYNE_IS_AMALGAMATED
+// This file was generated with the following command:
+// decaygen.py --dummy --hdr _decay.h --src _decay.cpp --nucs H1 H2 H3 He3
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef PYNE_IS_AMALGAMATED
+#include "pyne.h"
+#else
 #include "decay.h"
+#include "nucname.h"
 #endif
 
 namespace pyne {
 namespace decayers {
 
-void decay_h(double t, std::map<int, double>::const_iterator &it, std::map<int, double> &outcomp, double (&out)[4]) {
-  //using std::exp2;
-  switch (it->first) {
-    case 10010000: {
-      out[0] += it->second;
-      break;
-    } case 10020000: {
-      out[1] += it->second;
-      break;
-    } case 10030000: {
-      double b0 = exp2(-2.572085e-09*t);
-      out[2] += (it->second) * (b0);
-      out[3] += (it->second) * (-1.000000e+00*b0 + 1.0);
-      break;
-    } default: {
-      outcomp.insert(*it);
-      break;
+namespace {
+
+// Per-thread state of an evaluation: the chain rows in use, the exponentials
+// they need, laid out as one contiguous run of nt values per exponent, and
+// the slot of each exponent in that layout
+struct Evaluation {
+  std::vector<int> parents;
+  std::vector<double> amounts;
+  std::vector<int> used;
+  std::vector<int> slot;
+  std::vector<double> b;
+
+  Evaluation() : slot(num_exps, -1) {};
+
+  // Starts a new evaluation
+  void clear() {
+    for (size_t u = 0; u < used.size(); u++)
+      slot[used[u]] = -1;
+    parents.clear();
+    amounts.clear();
+    used.clear();
+  };
+
+  // Adds amount x of nuclide index i, with its exponents
+  void add(int i, double x) {
+    parents.push_back(i);
+    amounts.push_back(x);
+    for (int j = chain_ptr[i]; j < chain_ptr[i + 1]; j++) {
+      int e = chain_exp[j];
+      if (slot[e] < 0) {
+        slot[e] = used.size();
+        used.push_back(e);
+      }
     }
-  }
-}
+  };
 
-void decay_he(double t, std::map<int, double>::const_iterator &it, std::map<int, double> &outcomp, double (&out)[4]) {
-  //using std::exp2;
-  switch (it->first) {
-    case 20030000: {
-      out[3] += it->second;
-      break;
-    } default: {
-      outcomp.insert(*it);
-      break;
+  // Evaluates the exponentials in use at each of the nt times ts
+  void exponentials(int nt, const double* ts) {
+    b.resize(used.size() * nt);
+    for (size_t u = 0; u < used.size(); u++) {
+      double a = decay_exps[used[u]];
+      double* bu = &b[u * nt];
+      for (int k = 0; k < nt; k++)
+        bu[k] = exp2(a * ts[k]);
+      if (first_t_exp <= used[u]) {
+        for (int k = 0; k < nt; k++)
+          bu[k] *= ts[k];
+      }
     }
-  }
-}
+  };
 
-std::map<int, double> decay(std::map<int, double> comp, double t) {
-  // setup
-  using std::map;
-  int nuc;
-  int i = 0;
-  double out [4] = {};  // init to zero
-  map<int, double> outcomp;
+  // Adds the decayed parents p0 to p1 into the nt by num_nucs array out
+  void accumulate(size_t p0, size_t p1, int nt, double* out) const {
+    for (size_t p = p0; p < p1; p++) {
+      int i = parents[p];
+      for (int j = chain_ptr[i]; j < chain_ptr[i + 1]; j++) {
+        double w = amounts[p] * chain_coef[j];
+        const double* bu = &b[slot[chain_exp[j]] * nt];
+        double* o = out + chain_child[j];
+        for (int k = 0; k < nt; k++)
+          o[k * num_nucs] += w * bu[k];
+      }
+    }
+  };
+};
 
-  // body
-  map<int, double>::const_iterator it = comp.begin();
+Evaluation& evaluation() {
+  static thread_local Evaluation ev;
+  ev.clear();
+  return ev;
+}
+
+// Adds the nuclides of comp that have chains to ev, and the others to passed
+std::map<int, double> gather(const std::map<int, double>& comp,
+                             Evaluation& ev) {
+  std::map<int, double> passed;
+  std::map<int, double>::const_iterator it = comp.begin();
   for (; it != comp.end(); ++it) {
-    switch (nucname::znum(it->first)) {
-      case 1:
-        decay_h(t, it, outcomp, out);
-        break;
-      case 2:
-        decay_he(t, it, outcomp, out);
-        break;
-      default:
-        outcomp.insert(*it);
-        break;
-    }
+    int i = nuc_index(it->first);
+    if (i < 0)
+      passed.insert(passed.end(), *it);
+    else
+      ev.add(i, it->second);
   }
+  return passed;
+}
 
-  // cleanup
-  for (i = 0; i < 4; ++i)
+// Returns the composition of the dense row out, over the passed nuclides
+std::map<int, double> scatter(const double* out,
+                              std::map<int, double> outcomp) {
+  for (int i = 0; i < num_nucs; ++i)
     if (out[i] > 0.0)
-      outcomp[all_nucs[i]] = out[i];
+      outcomp[nucname::state_id_to_id(all_nucs[i])] = out[i];
   return outcomp;
 }
 
+}  // namespace
+
+
+int nuc_index(int nuc) {
+  int state = nucname::id_to_state_id(nuc);
+  const int* it = std::lower_bound(all_nucs, all_nucs + num_nucs, state);
+  if (it == all_nucs + num_nucs || *it != state)
+    return -1;
+  return it - all_nucs;
+}
+
+
+void decay(const double* x, int nt, const double* ts, double* out) {
+  Evaluation& ev = evaluation();
+  for (int i = 0; i < num_nucs; i++)
+    if (x[i] != 0.0)
+      ev.add(i, x[i]);
+  ev.exponentials(nt, ts);
+  std::fill(out, out + (size_t) nt * num_nucs, 0.0);
+  ev.accumulate(0, ev.parents.size(), nt, out);
+}
+
+
+std::map<int, double> decay(const std::map<int, double>& comp, double t) {
+  Evaluation& ev = evaluation();
+  std::map<int, double> passed = gather(comp, ev);
+  ev.exponentials(1, &t);
+  std::vector<double> out (num_nucs, 0.0);
+  ev.accumulate(0, ev.parents.size(), 1, out.data());
+  return scatter(out.data(), passed);
+}
+
+
+std::vector<std::map<int, double> > decay(const std::map<int, double>& comp,
+                                          const std::vector<double>& ts) {
+  Evaluation& ev = evaluation();
+  std::map<int, double> passed = gather(comp, ev);
+  int nt = ts.size();
+  ev.exponentials(nt, ts.data());
+  std::vector<double> out ((size_t) nt * num_nucs, 0.0);
+  ev.accumulate(0, ev.parents.size(), nt, out.data());
+  std::vector<std::map<int, double> > outcomps;
+  outcomps.reserve(nt);
+  for (int k = 0; k < nt; k++)
+    outcomps.push_back(scatter(&out[(size_t) k * num_nucs], passed));
+  return outcomps;
+}
+
+
+std::vector<std::map<int, double> > decay(
+    const std::vector<std::map<int, double> >& comps, double t) {
+  Evaluation& ev = evaluation();
+  std::vector<std::map<int, double> > passed;
+  std::vector<size_t> ends;
+  passed.reserve(comps.size());
+  ends.reserve(comps.size());
+  for (size_t c = 0; c < comps.size(); c++) {
+    passed.push_back(gather(comps[c], ev));
+    ends.push_back(ev.parents.size());
+  }
+  ev.exponentials(1, &t);
+  std::vector<double> out (num_nucs);
+  std::vector<std::map<int, double> > outcomps;
+  outcomps.reserve(comps.size());
+  size_t start = 0;
+  for (size_t c = 0; c < comps.size(); c++) {
+    std::fill(out.begin(), out.end(), 0.0);
+    ev.accumulate(start, ends[c], 1, out.data());
+    outcomps.push_back(scatter(out.data(), passed[c]));
+    start = ends[c];
+  }
+  return outcomps;
+}
+
+
 const int all_nucs [4] = {
   10010000, 10020000, 10030000, 20030000
 };
 
+const double decay_exps [2] = {
+  0.00000000000000000e+00, -2.57208500000000002e-09
+};
+
+const int chain_ptr [5] = {
+  0, 1, 2, 5, 6
+};
+
+const int chain_child [6] = {
+  0, 1, 2, 3, 3, 3
+};
+
+const int chain_exp [6] = {
+  0, 0, 1, 1, 0, 0
+};
+
+const double chain_coef [6] = {
+  1.00000000000000000e+00, 1.00000000000000000e+00, 1.00000000000000000e+00,
+  -1.00000000000000000e+00, 1.00000000000000000e+00, 1.00000000000000000e+00
+};
+
 }  // namespace decayers
 }  // namespace pyne
 
-#endif  // PYNE_DECAY_IS_DUMMY
+#endif  // PYNE_DECAY_IS_DUMMY
\ No newline at end of file
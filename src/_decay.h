@@ -1,6 +1,7 @@
 #ifdef PYNE_DECAY_IS_DUMMY
 #ifndef PYNE_GEUP5PGEJBFGNHGI36TRBB4WGM
 #define PYNE_GEUP5PGEJBFGNHGI36TRBB4WGM
+#define PYNE_DECAY
 
 // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
@@ -11,20 +12,52 @@
 // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 // !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
 
-#include <map>
-//#include <cmath>
+// This file was generated with the following command:
+// decaygen.py --dummy --hdr _decay.h --src _decay.cpp --nucs H1 H2 H3 He3
 
-#ifndef PYNE_IS_AMALGAMATED
-#include "data.h"
-#include "nucname.h"
-#endif
+#include <map>
+#include <vector>
 
 namespace pyne {
 namespace decayers {
 
-extern const int all_nucs[4];
+// The decay chains are stored as sparse rows of Bateman terms, one row per
+// parent in all_nucs. Term j of the row of parent i adds
+// chain_coef[j] * b[chain_exp[j]] of the parent to chain_child[j], where
+// b[e] = exp2(decay_exps[e] * t), times t for the exponents from first_t_exp
+// on. Exponent 0 is zero, for the constant terms.
+
+const int num_nucs = 4;  ///< number of nuclides in all_nucs
+const int num_exps = 2;  ///< number of distinct exponents
+const int num_terms = 6;  ///< number of chain terms
+const int first_t_exp = 2;  ///< first exponent of a t * exp2() term
+
+extern const int all_nucs[4];  ///< sorted state ids
+extern const double decay_exps[2];  ///< exponents, per second
+extern const int chain_ptr[5];  ///< start of each row
+extern const int chain_child[6];  ///< term child indices
+extern const int chain_exp[6];  ///< term exponent indices
+extern const double chain_coef[6];  ///< term coefficients
+
+/// Returns the index of nuclide \a nuc in all_nucs, or -1 if it has no chains.
+int nuc_index(int nuc);
+
+/// Decays the dense composition \a x, given in the order of all_nucs, to each
+/// of the \a nt times \a ts. Row k of the nt by num_nucs array \a out is the
+/// composition at ts[k]. Every exponential is evaluated once per time.
+void decay(const double* x, int nt, const double* ts, double* out);
+
+/// Decays composition \a comp for time \a t.
+std::map<int, double> decay(const std::map<int, double>& comp, double t);
+
+/// Decays composition \a comp to each of the times \a ts.
+std::vector<std::map<int, double> > decay(const std::map<int, double>& comp,
+                                          const std::vector<double>& ts);
 
-std::map<int, double> decay(std::map<int, double> comp, double t);
+/// Decays each of the compositions \a comps for time \a t, evaluating the
+/// exponentials they share once.
+std::vector<std::map<int, double> > decay(
+    const std::vector<std::map<int, double> >& comps, double t);
 
 }  // namespace decayers
 }  // namespace pyne
@@ -0,0 +1,93 @@
+// Microbenchmark of the ENDF float parsers.
+// Build with "make bench_endf" and run the resulting executable; it prints the
+// mean time per field of endftod_f(), the Fortran reader, endftod_cpp() and
+// endftod_record() on generated records of TAB1 style data, floats in the
+// usual layouts with some integer fields.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include "utils.h"
+
+// Returns nlines 80 column records whose fields alternate between energies
+// and cross sections, every fifth record being integers
+std::string endf_records(int nlines) {
+  std::string text;
+  char field[32];
+  unsigned seed = 12345;
+  for (int l = 0; l < nlines; l++) {
+    for (int i = 0; i < 6; i++) {
+      seed = seed * 1103515245u + 12345u;
+      double frac = (seed >> 8) / 16777216.0;
+      if (l % 5 == 4) {
+        snprintf(field, sizeof(field), "%11d", (int) (frac * 100000));
+      } else {
+        int e = i % 2 == 0 ? (int) (frac * 18) - 5 : (int) (frac * 30) - 15;
+        double m = 1.0 + 8.9 * frac;
+        if (e > -10 && e < 10)
+          snprintf(field, sizeof(field), "%9.6f%+d", m, e);
+        else
+          snprintf(field, sizeof(field), "%8.5f%+d", m, e);
+      }
+      text += field;
+    }
+    text += "9228 3  1    1\n";
+  }
+  return text;
+}
+
+// Times f over all records, repeated until about 0.2 s have passed
+template <typename F>
+void bench(const std::string& label, const std::string& text, F f) {
+  typedef std::chrono::steady_clock clock;
+  int nlines = text.size() / 81;
+  double checksum = 0.0;
+  long fields = 0;
+  clock::time_point start = clock::now();
+  double elapsed = 0.0;
+  while (elapsed < 0.2) {
+    for (int l = 0; l < nlines; l++)
+      checksum += f(text.c_str() + 81*l);
+    fields += 6 * nlines;
+    elapsed = std::chrono::duration<double>(clock::now() - start).count();
+  }
+  std::cout << std::left << std::setw(21) << label << std::right
+            << std::setw(10) << std::fixed << std::setprecision(2)
+            << 1e9 * elapsed / fields << " ns/field   (checksum "
+            << std::scientific << std::setprecision(6) << checksum * nlines / fields
+            << ")" << std::endl;
+}
+
+// Converts a record one field at a time through a copy, as fromendf_tok did
+template <typename F>
+double per_field(const char* line, F f) {
+  char field[12];
+  field[11] = '\0';
+  double sum = 0.0;
+  for (int i = 0; i < 6; i++) {
+    memcpy(field, line + 11*i, 11);
+    sum += f(field);
+  }
+  return sum;
+}
+
+int main() {
+  std::string text = endf_records(10000);
+  bench("endftod_f", text, [](const char* line) {
+    return per_field(line, pyne::endftod_f);
+  });
+  bench("endftod_cpp", text, [](const char* line) {
+    return per_field(line, pyne::endftod_cpp);
+  });
+  bench("endftod_record", text, [](const char* line) {
+    double vals[6];
+    pyne::endftod_record(line, vals);
+    return vals[0] + vals[1] + vals[2] + vals[3] + vals[4] + vals[5];
+  });
+  return 0;
+}
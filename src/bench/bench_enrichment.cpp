@@ -0,0 +1,79 @@
+// Microbenchmark of the multicomponent enrichment cascade solvers.
+// Build with "make bench_enrichment" and run the resulting executable; it
+// prints the mean time per solve of solve_symbolic() on Cascades and on
+// DenseCascades, and of solve_numeric(), for uranium feeds with a growing
+// number of nuclides.
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include "enrichment.h"
+
+namespace enr = pyne::enrichment;
+
+// Times calls to f, repeated until about 0.2 s have passed
+template <typename F>
+void bench(const std::string& label, F f) {
+  typedef std::chrono::steady_clock clock;
+  double checksum = 0.0;
+  long calls = 0;
+  clock::time_point start = clock::now();
+  double elapsed = 0.0;
+  while (elapsed < 0.2) {
+    checksum += f();
+    calls++;
+    elapsed = std::chrono::duration<double>(clock::now() - start).count();
+  }
+  std::cout << std::left << std::setw(44) << label << std::right
+            << std::setw(10) << std::fixed << std::setprecision(2)
+            << 1e6 * elapsed / calls << " us/call   (checksum "
+            << std::setprecision(6) << checksum / calls << ")" << std::endl;
+}
+
+// Returns the default uranium cascade with a feed of ncomp nuclides, the
+// extra ones being actinides around the key masses that share the remainder.
+enr::Cascade feed_cascade(int ncomp) {
+  static const int extra[] = {
+    922340000, 922360000, 922320000, 922330000, 922370000, 922390000,
+    922300000, 922310000, 922400000, 912310000, 912330000, 912340000,
+    902280000, 902290000, 902300000, 902310000, 902320000, 902330000,
+    932360000, 932370000, 932380000, 932390000, 942360000, 942370000,
+    942380000, 942390000, 942400000, 942410000, 942420000, 952410000,
+    952420000, 952430000, 952440000, 962420000, 962430000, 962440000,
+    962450000, 962460000};
+  enr::Cascade casc = enr::_fill_default_uranium_cascade();
+  pyne::comp_map cm;
+  cm[922350000] = 0.0072;
+  cm[922380000] = 0.98;
+  for (int i = 0; i < ncomp - 2; i++)
+    cm[extra[i]] = (1.0 - 0.0072 - 0.98) / (ncomp - 2);
+  casc.mat_feed = pyne::Material(cm, 1.0, 1.0);
+  return casc;
+}
+
+int main() {
+  pyne::USE_WARNINGS = false;
+  int ncomps[] = {3, 5, 10, 20, 40};
+  for (int n = 0; n < 5; n++) {
+    int ncomp = ncomps[n];
+    enr::Cascade casc = feed_cascade(ncomp);
+    enr::DenseCascade dense(casc);
+    std::ostringstream suffix;
+    suffix << ", " << ncomp << " nuclides";
+
+    bench("solve_symbolic(Cascade)" + suffix.str(),
+          [&casc]() {return enr::solve_symbolic(casc).l_t_per_feed;});
+    bench("solve_symbolic(DenseCascade)" + suffix.str(),
+          [&casc, &dense]() {
+            dense.N = casc.N;
+            enr::solve_symbolic(dense);
+            return dense.l_t_per_feed;
+          });
+    bench("solve_numeric(Cascade)" + suffix.str(),
+          [&casc]() {return enr::solve_numeric(casc).l_t_per_feed;});
+  }
+  return 0;
+}
@@ -0,0 +1,72 @@
+// Microbenchmark of nucname::id for the integer and string forms.
+// Build with "make bench_nucname" and run the resulting executable; it prints
+// the mean time per call of each form.
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include "nucname.h"
+
+// Times calls to f over all inputs, repeated until about 0.2 s have passed
+template <typename T, typename F>
+void bench(const std::string& label, const std::vector<T>& inputs, F f) {
+  typedef std::chrono::steady_clock clock;
+  long checksum = 0;
+  long calls = 0;
+  clock::time_point start = clock::now();
+  double elapsed = 0.0;
+  while (elapsed < 0.2) {
+    for (size_t i = 0; i < inputs.size(); i++)
+      checksum += f(inputs[i]);
+    calls += inputs.size();
+    elapsed = std::chrono::duration<double>(clock::now() - start).count();
+  }
+  std::cout << std::left << std::setw(36) << label << std::right
+            << std::setw(10) << std::fixed << std::setprecision(1)
+            << 1e9 * elapsed / calls << " ns/call   (checksum "
+            << checksum << ")" << std::endl;
+}
+
+int main() {
+  pyne::USE_WARNINGS = false;
+  const char* names[] = {"H1", "He4", "B10", "C12", "O16", "Fe56", "Zr90",
+                         "Tc99m", "Xe135", "Cs137", "U235", "U238", "Pu239",
+                         "Am242m", "Cm244"};
+  std::vector<std::string> name_form, dash_form, nist_form;
+  std::vector<const char*> cstr_form;
+  std::vector<int> id_form, zzaaam_form, mcnp_form;
+  for (int i = 0; i < 15; i++) {
+    std::string name = names[i];
+    int nucid = pyne::nucname::id(name);
+    size_t split = name.find_first_of("0123456789");
+    name_form.push_back(name);
+    cstr_form.push_back(names[i]);
+    dash_form.push_back(name.substr(0, split) + "-" + name.substr(split));
+    nist_form.push_back(pyne::to_str((nucid / 10000) % 1000) +
+                        name.substr(0, split));
+    id_form.push_back(nucid);
+    zzaaam_form.push_back(pyne::nucname::zzaaam(nucid));
+    mcnp_form.push_back(pyne::nucname::mcnp(nucid));
+  }
+
+  bench("id(int), id form", id_form,
+        [](int n) {return pyne::nucname::id(n);});
+  bench("id_fast(int), id form", id_form,
+        [](int n) {return pyne::nucname::id_fast(n);});
+  bench("id(int), zzaaam form", zzaaam_form,
+        [](int n) {return pyne::nucname::id(n);});
+  bench("id(int), MCNP form", mcnp_form,
+        [](int n) {return pyne::nucname::id(n);});
+  bench("id(std::string), name form", name_form,
+        [](const std::string& s) {return pyne::nucname::id(s);});
+  bench("id(std::string), dashed name form", dash_form,
+        [](const std::string& s) {return pyne::nucname::id(s);});
+  bench("id(std::string), NIST form", nist_form,
+        [](const std::string& s) {return pyne::nucname::id(s);});
+  bench("id(const char*), name form", cstr_form,
+        [](const char* s) {return pyne::nucname::id(s);});
+  return 0;
+}
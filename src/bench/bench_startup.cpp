@@ -0,0 +1,72 @@
+// Startup-time benchmark of the pyne library.
+// Build with "make bench_startup" and run the resulting executable; it starts
+// itself repeatedly and prints the mean wall time of a process that links pyne
+// and exits at once, and of one that also makes a first rxname and particle
+// lookup, which fills their maps.
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#if !defined(_WIN32)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "particle.h"
+#include "rxname.h"
+
+#if !defined(_WIN32)
+// Returns the mean wall time in ms of running this program with arg
+double mean_run_time(const char* self, const char* arg, int runs) {
+  typedef std::chrono::steady_clock clock;
+  double total = 0.0;
+  for (int i = 0; i < runs; i++) {
+    clock::time_point start = clock::now();
+    pid_t pid = fork();
+    if (pid == 0) {
+      execl(self, self, arg, (char*) NULL);
+      _exit(127);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    total += std::chrono::duration<double>(clock::now() - start).count();
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      std::cerr << "child run failed" << std::endl;
+      std::exit(1);
+    }
+  }
+  return 1e3 * total / runs;
+}
+#endif
+
+int main(int argc, char* argv[]) {
+  if (argc > 1 && std::strcmp(argv[1], "--idle") == 0)
+    return 0;
+  if (argc > 1 && std::strcmp(argv[1], "--lookup") == 0) {
+    int rx = pyne::rxname::id("fission");
+    int part = pyne::particle::id(std::string("Neutron"));
+    return (rx != 0 && part != 0) ? 0 : 1;
+  }
+#if defined(_WIN32)
+  std::cout << "bench_startup needs fork/exec and is not supported here"
+            << std::endl;
+  return 0;
+#else
+  int runs = argc > 1 ? std::atoi(argv[1]) : 50;
+  if (runs < 1)
+    runs = 1;
+  std::cout << std::fixed << std::setprecision(3);
+  std::cout << std::left << std::setw(36) << "start and exit" << std::right
+            << std::setw(10) << mean_run_time(argv[0], "--idle", runs)
+            << " ms/run" << std::endl;
+  std::cout << std::left << std::setw(36) << "start, first lookups and exit"
+            << std::right << std::setw(10)
+            << mean_run_time(argv[0], "--lookup", runs) << " ms/run"
+            << std::endl;
+  return 0;
+#endif
+}
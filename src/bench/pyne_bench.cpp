@@ -0,0 +1,493 @@
+// Benchmark suite of the C++ hot paths, with JSON output that can be tracked
+// and compared against a baseline.
+// Build with "make pyne_bench" and run the resulting executable:
+//
+//   pyne_bench [--filter substr] [--min-time s] [--json out.json]
+//              [--baseline base.json] [--tolerance frac] [--mesh file.h5m]
+//
+// It prints the mean time per item of each benchmark. --json writes the
+// results in the layout of Google Benchmark ("benchmarks" entries with
+// "name", "real_time", "time_unit" and "iterations"), so its compare tools
+// also work on them. --baseline reads such a file, prints the ratio of each
+// time to the baseline and exits with status 1 if any benchmark is slower by
+// more than the tolerance, default 0.1. Benchmarks whose data cannot be
+// loaded, e.g. without nuc_data.h5, are reported as skipped and are left out
+// of the JSON. The sampling benchmarks are only built with MOAB, and
+// Sampler::particle_birth needs --mesh, a mesh with a one group
+// "source_density" tag.
+//
+// The tracked baseline is bench/baseline.json, which "make pyne_bench_compare"
+// runs the suite against. "make pyne_bench_baseline" records a run on the
+// current machine into the build tree; to regenerate the tracked file, on the
+// reference machine whenever a change is meant to move the numbers, configure
+// with -DPYNE_BENCH_BASELINE_OUT pointing at it and commit the result.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "json.h"
+#include "nucname.h"
+#include "rxname.h"
+#include "data.h"
+#include "material.h"
+#include "transmuters.h"
+#ifdef PYNE_BENCH_SOURCE_SAMPLING
+#include "source_sampling.h"
+#endif
+
+namespace {
+
+// A named benchmark. setup is run once before timing and may throw to skip
+// the benchmark; run is timed and processes items items per call.
+struct Benchmark {
+  std::string name;
+  long items;
+  std::function<void()> setup;
+  std::function<double()> run;
+};
+
+struct Result {
+  std::string name;
+  double ns_per_item;
+  long iterations;
+  double checksum;
+};
+
+std::vector<Benchmark>& registry() {
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+void add(const std::string& name, long items, std::function<void()> setup,
+         std::function<double()> run) {
+  Benchmark b = {name, items, setup, run};
+  registry().push_back(b);
+}
+
+void add(const std::string& name, long items, std::function<double()> run) {
+  add(name, items, [](){}, run);
+}
+
+// Times calls to b.run, after one warm up call, until min_time seconds have
+// passed
+Result time_benchmark(const Benchmark& b, double min_time) {
+  typedef std::chrono::steady_clock clock;
+  Result r;
+  r.name = b.name;
+  r.checksum = b.run();
+  long calls = 0;
+  clock::time_point start = clock::now();
+  double elapsed = 0.0;
+  while (elapsed < min_time) {
+    r.checksum += b.run();
+    calls++;
+    elapsed = std::chrono::duration<double>(clock::now() - start).count();
+  }
+  r.iterations = calls * b.items;
+  r.ns_per_item = 1e9 * elapsed / r.iterations;
+  return r;
+}
+
+// Inputs shared by the benchmarks
+
+const char* nuc_names[] = {"H1", "He4", "B10", "C12", "O16", "Fe56", "Zr90",
+                           "Tc99m", "Xe135", "Cs137", "U235", "U238", "Pu239",
+                           "Am242m", "Cm244"};
+const int num_nuc_names = 15;
+
+const char* rx_names[] = {"total", "scattering", "elastic", "absorption",
+                          "fission", "gamma", "proton", "alpha", "z_2n",
+                          "z_3n", "deuteron", "triton", "a", "p"};
+const int num_rx_names = 14;
+
+pyne::comp_map fuel_comp() {
+  pyne::comp_map cm;
+  cm[10010000] = 0.01;
+  cm[80160000] = 0.11;
+  cm[400900000] = 0.02;
+  cm[541350000] = 1e-8;
+  cm[551370000] = 1e-6;
+  cm[922340000] = 0.0003;
+  cm[922350000] = 0.03;
+  cm[922380000] = 0.8;
+  cm[942390000] = 0.002;
+  cm[942410000] = 0.0002;
+  return cm;
+}
+
+std::vector<std::string> nucname_strings;
+std::vector<int> nucname_ids;
+std::vector<std::string> rxname_strings;
+pyne::Material fuel;
+pyne::Material water;
+std::vector<double> cram_matrix;
+pyne::comp_map cram_n0;
+std::vector<int> fpyield_parents;
+std::vector<int> gamma_parents;
+std::string hdf5_file = "pyne_bench.h5";
+
+void register_nucname() {
+  for (int i = 0; i < num_nuc_names; i++) {
+    nucname_strings.push_back(nuc_names[i]);
+    nucname_ids.push_back(pyne::nucname::id(nuc_names[i]));
+  }
+  add("nucname::id(int)", num_nuc_names, []() {
+    double s = 0.0;
+    for (int i = 0; i < num_nuc_names; i++)
+      s += pyne::nucname::id(nucname_ids[i]);
+    return s;
+  });
+  add("nucname::id(std::string)", num_nuc_names, []() {
+    double s = 0.0;
+    for (int i = 0; i < num_nuc_names; i++)
+      s += pyne::nucname::id(nucname_strings[i]);
+    return s;
+  });
+  add("nucname::id(const char*)", num_nuc_names, []() {
+    double s = 0.0;
+    for (int i = 0; i < num_nuc_names; i++)
+      s += pyne::nucname::id(nuc_names[i]);
+    return s;
+  });
+}
+
+void register_rxname() {
+  for (int i = 0; i < num_rx_names; i++)
+    rxname_strings.push_back(rx_names[i]);
+  add("rxname::id(std::string)", num_rx_names, []() {
+    double s = 0.0;
+    for (int i = 0; i < num_rx_names; i++)
+      s += pyne::rxname::id(rxname_strings[i]);
+    return s;
+  });
+  add("rxname::hash(const char*)", num_rx_names, []() {
+    double s = 0.0;
+    for (int i = 0; i < num_rx_names; i++)
+      s += pyne::rxname::hash(rx_names[i]);
+    return s;
+  });
+}
+
+void register_material() {
+  add("Material(comp_map)", 1, []() {
+    pyne::Material mat(fuel_comp(), 1.0, 10.0);
+    return mat.mass;
+  });
+  add("Material::norm_comp", 1, []() {
+    fuel = pyne::Material(fuel_comp(), 1.0, 10.0);
+  }, []() {
+    fuel.comp[922350000] += 1e-3;
+    fuel.norm_comp();
+    return fuel.comp[922350000];
+  });
+  add("Material::operator+", 1, []() {
+    fuel = pyne::Material(fuel_comp(), 1.0, 10.0);
+    pyne::comp_map cm;
+    cm[10010000] = 2.0;
+    cm[80160000] = 1.0;
+    water = pyne::Material(cm, 0.5, 1.0, -1.0);
+  }, []() {
+    return (fuel + water).mass;
+  });
+  add("Material::molecular_mass", 1, []() {
+    fuel = pyne::Material(fuel_comp(), 1.0, 10.0);
+    fuel.molecular_mass();
+  }, []() {
+    return fuel.molecular_mass();
+  });
+#ifdef PYNE_DECAY
+  add("Material::decay", 1, []() {
+    fuel = pyne::Material(fuel_comp(), 1.0, 10.0);
+    fuel.decay(3.15e7);
+  }, []() {
+    return fuel.decay(3.15e7).mass;
+  });
+#endif
+}
+
+void register_cram() {
+  for (int order = 6; order <= 18; order += 2) {
+    std::ostringstream name;
+    name << "transmuters::cram, order " << order;
+    add(name.str(), 1, []() {
+      pyne::transmuters::CramMatrixBuilder builder;
+      cram_matrix = builder.assemble(std::vector<double>(), 3.15e7);
+      cram_n0.clear();
+      std::vector<int> nucids = pyne::transmuters::cram_nucids();
+      for (size_t i = 0; i < nucids.size(); i += 97)
+        cram_n0[nucids[i]] = 1.0;
+    }, [order]() {
+      std::map<int, double> n1 = pyne::transmuters::cram(cram_matrix, cram_n0,
+                                                         order);
+      return n1.empty() ? 0.0 : n1.begin()->second;
+    });
+  }
+}
+
+void register_data() {
+  add("fpyield(int, int)", 6, []() {
+    fpyield_parents.clear();
+    fpyield_parents.push_back(922350000);
+    fpyield_parents.push_back(942390000);
+    pyne::fpyield(922350000, 551370000, 0, false);
+  }, []() {
+    static const int children[] = {551370000, 400900000, 541350000};
+    double s = 0.0;
+    for (int i = 0; i < 2; i++)
+      for (int j = 0; j < 3; j++)
+        s += pyne::fpyield(fpyield_parents[i], children[j], 0, false);
+    return s;
+  });
+  add("gamma_energy(int)", 3, []() {
+    gamma_parents.clear();
+    gamma_parents.push_back(551370000);
+    gamma_parents.push_back(270600000);
+    gamma_parents.push_back(922350000);
+    if (pyne::gamma_energy(gamma_parents[0]).empty())
+      throw std::runtime_error("no gamma data");
+  }, []() {
+    double s = 0.0;
+    for (int i = 0; i < 3; i++)
+      s += pyne::gamma_energy(gamma_parents[i]).size();
+    return s;
+  });
+}
+
+void register_hdf5() {
+  add("Material::write_hdf5", 1, []() {
+    std::remove(hdf5_file.c_str());
+    fuel = pyne::Material(fuel_comp(), 1.0, 10.0);
+    fuel.metadata["name"] = "fuel";
+  }, []() {
+    fuel.write_hdf5(hdf5_file, "/material");
+    return fuel.mass;
+  });
+  add("Material::from_hdf5", 1, []() {
+    fuel = pyne::Material(fuel_comp(), 1.0, 10.0);
+    fuel.write_hdf5(hdf5_file, "/material");
+  }, []() {
+    pyne::Material mat;
+    mat.from_hdf5(hdf5_file, "/material", 0);
+    return mat.mass;
+  });
+}
+
+#ifdef PYNE_BENCH_SOURCE_SAMPLING
+std::vector<double> alias_pdf;
+pyne::AliasTable* alias_table = NULL;
+pyne::Sampler* sampler = NULL;
+std::string mesh_file;
+
+// Returns a pseudo-random number in [0, 1) from a 64 bit LCG, so that the
+// sampling benchmarks do not time the library's generator
+double next_rand() {
+  static unsigned long long state = 12345;
+  state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+  return (state >> 11) * (1.0 / 9007199254740992.0);
+}
+
+void register_source_sampling() {
+  add("AliasTable build, 1e5 bins", 1, []() {
+    alias_pdf.resize(100000);
+    for (size_t i = 0; i < alias_pdf.size(); i++)
+      alias_pdf[i] = 1.0 + (i % 17);
+  }, []() {
+    pyne::AliasTable table(alias_pdf);
+    return table.sample_pdf(0.5, 0.5);
+  });
+  add("AliasTable::sample_pdf, 1e5 bins", 1000, []() {
+    alias_pdf.resize(100000);
+    for (size_t i = 0; i < alias_pdf.size(); i++)
+      alias_pdf[i] = 1.0 + (i % 17);
+    delete alias_table;
+    alias_table = new pyne::AliasTable(alias_pdf);
+  }, []() {
+    double s = 0.0;
+    for (int i = 0; i < 1000; i++)
+      s += alias_table->sample_pdf(next_rand(), next_rand());
+    return s;
+  });
+  add("Sampler::particle_birth", 1000, []() {
+    if (mesh_file.empty())
+      throw std::runtime_error("no --mesh given");
+    std::map<std::string, std::string> tag_names;
+    tag_names["src_tag_name"] = "source_density";
+    std::vector<double> e_bounds;
+    e_bounds.push_back(0.0);
+    e_bounds.push_back(1.0);
+    delete sampler;
+    sampler = new pyne::Sampler(mesh_file, tag_names, e_bounds, 0);
+  }, []() {
+    std::vector<double> rands(6);
+    double s = 0.0;
+    for (int i = 0; i < 1000; i++) {
+      for (int j = 0; j < 6; j++)
+        rands[j] = next_rand();
+      s += sampler->particle_birth(rands).get_x();
+    }
+    return s;
+  });
+}
+#endif
+
+// Reads the ns per item of each benchmark of a JSON results file
+std::map<std::string, double> read_baseline(const std::string& filename) {
+  std::ifstream f(filename.c_str());
+  if (!f.is_open())
+    throw std::runtime_error("could not open baseline " + filename);
+  Json::Value root;
+  Json::Reader reader;
+  if (!reader.parse(f, root))
+    throw std::runtime_error("could not parse baseline " + filename);
+  std::map<std::string, double> times;
+  const Json::Value& benchmarks = root["benchmarks"];
+  for (Json::Value::ArrayIndex i = 0; i < benchmarks.size(); i++)
+    times[benchmarks[i]["name"].asString()] =
+        benchmarks[i]["real_time"].asDouble();
+  return times;
+}
+
+void write_json(const std::string& filename, const std::vector<Result>& results,
+                double min_time) {
+  Json::Value root;
+  char date[32];
+  std::time_t now = std::time(NULL);
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+  root["context"]["date"] = date;
+  root["context"]["min_time"] = min_time;
+#ifdef __VERSION__
+  root["context"]["compiler"] = __VERSION__;
+#endif
+#ifdef NDEBUG
+  root["context"]["library_build_type"] = "release";
+#else
+  root["context"]["library_build_type"] = "debug";
+#endif
+  root["benchmarks"] = Json::Value(Json::arrayValue);
+  for (size_t i = 0; i < results.size(); i++) {
+    Json::Value b;
+    b["name"] = results[i].name;
+    b["iterations"] = (Json::Int64) results[i].iterations;
+    b["real_time"] = results[i].ns_per_item;
+    b["time_unit"] = "ns";
+    root["benchmarks"].append(b);
+  }
+  std::ofstream f(filename.c_str());
+  Json::StyledStreamWriter writer("  ");
+  writer.write(f, root);
+}
+
+void usage() {
+  std::cerr << "usage: pyne_bench [--filter substr] [--min-time s] "
+               "[--json out.json]\n"
+               "                  [--baseline base.json] [--tolerance frac] "
+               "[--mesh file.h5m]" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  pyne::USE_WARNINGS = false;
+  std::string filter, json_file, baseline_file;
+  double min_time = 0.2;
+  double tolerance = 0.1;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--help" || arg == "-h") {
+      usage();
+      return 0;
+    }
+    if (i + 1 >= argc) {
+      usage();
+      return 2;
+    }
+    std::string val = argv[++i];
+    if (arg == "--filter")
+      filter = val;
+    else if (arg == "--min-time")
+      min_time = std::atof(val.c_str());
+    else if (arg == "--json")
+      json_file = val;
+    else if (arg == "--baseline")
+      baseline_file = val;
+    else if (arg == "--tolerance")
+      tolerance = std::atof(val.c_str());
+#ifdef PYNE_BENCH_SOURCE_SAMPLING
+    else if (arg == "--mesh")
+      mesh_file = val;
+#endif
+    else {
+      usage();
+      return 2;
+    }
+  }
+
+  register_nucname();
+  register_rxname();
+  register_material();
+  register_cram();
+  register_data();
+  register_hdf5();
+#ifdef PYNE_BENCH_SOURCE_SAMPLING
+  register_source_sampling();
+#endif
+
+  std::map<std::string, double> baseline;
+  if (!baseline_file.empty())
+    baseline = read_baseline(baseline_file);
+
+  std::vector<Result> results;
+  int regressions = 0;
+  const std::vector<Benchmark>& benchmarks = registry();
+  for (size_t i = 0; i < benchmarks.size(); i++) {
+    const Benchmark& b = benchmarks[i];
+    if (b.name.find(filter) == std::string::npos)
+      continue;
+    std::cout << std::left << std::setw(40) << b.name << std::right;
+    Result r;
+    try {
+      b.setup();
+      r = time_benchmark(b, min_time);
+    } catch (std::exception& e) {
+      std::cout << "   skipped (" << e.what() << ")" << std::endl;
+      continue;
+    }
+    results.push_back(r);
+    std::cout << std::setw(12) << std::fixed << std::setprecision(1)
+              << r.ns_per_item << " ns/item";
+    std::map<std::string, double>::const_iterator base = baseline.find(b.name);
+    if (base != baseline.end() && base->second > 0.0) {
+      double ratio = r.ns_per_item / base->second;
+      std::cout << "   x" << std::setprecision(3) << ratio;
+      if (ratio > 1.0 + tolerance) {
+        std::cout << " REGRESSION";
+        regressions++;
+      }
+    }
+    std::cout << "   (checksum " << std::setprecision(6)
+              << r.checksum / (r.iterations / b.items + 1) << ")" << std::endl;
+  }
+  std::remove(hdf5_file.c_str());
+
+  if (!json_file.empty())
+    write_json(json_file, results, min_time);
+  if (regressions > 0) {
+    std::cout << regressions << " benchmark(s) slower than the baseline by "
+              << "more than " << std::setprecision(1) << 100.0 * tolerance
+              << "%" << std::endl;
+    return 1;
+  }
+  return 0;
+}
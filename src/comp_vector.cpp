@@ -0,0 +1,98 @@
+// comp_vector.cpp
+// Flat composition container
+
+#include <algorithm>
+
+#ifndef PYNE_IS_AMALGAMATED
+#include "comp_vector.h"
+#endif
+
+// Orders entries by nuclide id only
+static bool key_less(const pyne::CompVector::value_type& v, int nuc) {
+  return v.first < nuc;
+}
+
+pyne::CompVector::iterator pyne::CompVector::lower_bound(int nuc) {
+  return std::lower_bound(data.begin(), data.end(), nuc, key_less);
+}
+
+pyne::CompVector::const_iterator pyne::CompVector::lower_bound(int nuc) const {
+  return std::lower_bound(data.begin(), data.end(), nuc, key_less);
+}
+
+pyne::CompVector::iterator pyne::CompVector::find(int nuc) {
+  iterator it = lower_bound(nuc);
+  if (it != data.end() && it->first == nuc)
+    return it;
+  return data.end();
+}
+
+pyne::CompVector::const_iterator pyne::CompVector::find(int nuc) const {
+  const_iterator it = lower_bound(nuc);
+  if (it != data.end() && it->first == nuc)
+    return it;
+  return data.end();
+}
+
+double& pyne::CompVector::operator[](int nuc) {
+  return insert(value_type(nuc, 0.0)).first->second;
+}
+
+std::pair<pyne::CompVector::iterator, bool> pyne::CompVector::insert(
+    const value_type& v) {
+  // appending in id order, the common case when building, skips the search
+  if (data.empty() || data.back().first < v.first) {
+    data.push_back(v);
+    return std::make_pair(data.end() - 1, true);
+  }
+  iterator it = lower_bound(v.first);
+  if (it->first == v.first)
+    return std::make_pair(it, false);
+  return std::make_pair(data.insert(it, v), true);
+}
+
+size_t pyne::CompVector::erase(int nuc) {
+  iterator it = find(nuc);
+  if (it == data.end())
+    return 0;
+  data.erase(it);
+  return 1;
+}
+
+void pyne::CompVector::scale(double a) {
+  for (iterator it = data.begin(); it != data.end(); ++it)
+    it->second *= a;
+}
+
+double pyne::CompVector::sum() const {
+  double s = 0.0;
+  for (const_iterator it = data.begin(); it != data.end(); ++it)
+    s += it->second;
+  return s;
+}
+
+
+pyne::CompVector pyne::comp_merge(const CompVector& x, double a,
+                                  const CompVector& y, double b) {
+  CompVector z;
+  z.reserve(x.size() + y.size());
+  CompVector::const_iterator xi = x.begin(), yi = y.begin();
+  while (xi != x.end() && yi != y.end()) {
+    if (xi->first < yi->first) {
+      z.push_back(xi->first, a * xi->second);
+      ++xi;
+    } else if (yi->first < xi->first) {
+      z.push_back(yi->first, b * yi->second);
+      ++yi;
+    } else {
+      z.push_back(xi->first, a * xi->second + b * yi->second);
+      ++xi;
+      ++yi;
+    }
+  }
+  for (; xi != x.end(); ++xi)
+    z.push_back(xi->first, a * xi->second);
+  for (; yi != y.end(); ++yi)
+    z.push_back(yi->first, b * yi->second);
+  return z;
+}
@@ -0,0 +1,89 @@
+/// \file comp_vector.h
+/// \brief Flat composition container.
+///
+/// A nuclide composition stored as one contiguous array of (nuclide id, value)
+/// pairs sorted by id. It offers the subset of the std::map<int, double> API
+/// that the composition code uses, so loops over it are walks over contiguous
+/// memory and two compositions merge in a single linear pass.
+
+#ifndef PYNE_3XQO6BVKJRH4LZDWPGNEQ5TCMA
+#define PYNE_3XQO6BVKJRH4LZDWPGNEQ5TCMA
+
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace pyne
+{
+  /// Composition of nuclides sorted by id in contiguous storage.
+  class CompVector {
+  public:
+    typedef int key_type; ///< Nuclide id type
+    typedef double mapped_type; ///< Composition value type
+    typedef std::pair<int, double> value_type; ///< (nuclide id, value) pair
+    typedef std::vector<value_type>::iterator iterator; ///< Iterator type
+    /// Constant iterator type
+    typedef std::vector<value_type>::const_iterator const_iterator;
+
+    /// Empty composition constructor
+    CompVector() {};
+    /// Constructor from a composition map, which is already sorted.
+    CompVector(const std::map<int, double>& cm) : data(cm.begin(), cm.end()) {};
+
+    /// Returns the composition as a map, built in one pass.
+    std::map<int, double> to_map() const {
+      return std::map<int, double>(data.begin(), data.end());
+    };
+
+    // map-compatible interface
+    iterator begin() {return data.begin();};
+    iterator end() {return data.end();};
+    const_iterator begin() const {return data.begin();};
+    const_iterator end() const {return data.end();};
+    size_t size() const {return data.size();};
+    bool empty() const {return data.empty();};
+    void clear() {data.clear();};
+
+    /// Returns the first entry whose id is not less than \a nuc.
+    iterator lower_bound(int nuc);
+    /// Returns the first entry whose id is not less than \a nuc.
+    const_iterator lower_bound(int nuc) const;
+    /// Returns the entry of \a nuc, or end() if there is none.
+    iterator find(int nuc);
+    /// Returns the entry of \a nuc, or end() if there is none.
+    const_iterator find(int nuc) const;
+    /// Returns 1 if \a nuc has an entry and 0 otherwise.
+    size_t count(int nuc) const {return find(nuc) == end() ? 0 : 1;};
+    /// Returns the value of \a nuc, inserting a zero if there is no entry.
+    double& operator[](int nuc);
+    /// Inserts an entry if its id is not there yet. Returns the entry of the
+    /// id and whether it was inserted, like std::map::insert().
+    std::pair<iterator, bool> insert(const value_type& v);
+    /// Removes the entry of \a nuc, returns the number of removed entries.
+    size_t erase(int nuc);
+
+    // bulk interface
+    /// Reserves storage for \a n entries.
+    void reserve(size_t n) {data.reserve(n);};
+    /// Appends an entry whose id must be greater than all present ids.
+    void push_back(int nuc, double value) {
+      data.push_back(value_type(nuc, value));
+    };
+    /// Multiplies all values by \a a.
+    void scale(double a);
+    /// Returns the sum of all values.
+    double sum() const;
+
+  private:
+    std::vector<value_type> data; ///< Entries sorted by nuclide id
+  };
+
+  /// Returns a*x + b*y, merging the two compositions in one linear pass.
+  CompVector comp_merge(const CompVector& x, double a, const CompVector& y,
+                        double b);
+
+// End pyne namespace
+}
+
+#endif  // PYNE_3XQO6BVKJRH4LZDWPGNEQ5TCMA
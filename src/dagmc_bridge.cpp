@@ -7,8 +7,16 @@
 
 using moab::CartVect;
 
-#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <exception>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
 
 using moab::DagMC;
 using moab::EntityHandle;
@@ -32,6 +40,8 @@ int dag_ent_handle_size(void) {
 
 static std::vector<int> surfList;
 static std::vector<int> volList;
+// the file dag_load read into DAG, which dag_ray_discretize loads again
+static std::string loadedFile;
 
 const int* geom_id_list(int dimension, int* number_of_items) {
     switch(dimension) {
@@ -88,6 +98,9 @@ ErrorCode dag_load(const char* filename){
         volList.push_back(DAG->id_by_index(3, i));
     }
 
+    err = dag_build_volume_table();
+    CHECKERR(err);
+    loadedFile = filename;
     return err;
 }
 
@@ -121,17 +134,35 @@ class ray_buffers {
     std::vector<EntityHandle> surfs;
     std::vector<double> dists;
     std::vector<EntityHandle> vols;
+    std::vector<int> offsets;
+
+    // empties the results, keeping the storage
+    void clear() {
+        surfs.clear();
+        dists.clear();
+        vols.clear();
+        offsets.clear();
+    }
 
 };
 
-ErrorCode dag_ray_follow(EntityHandle firstvol, vec3 ray_start, vec3 ray_dir,
-                          double distance_limit, int* num_intersections,
-                          EntityHandle** surfs, double** distances, EntityHandle** volumes,
-                          void* data_buffers){
+void* dag_alloc_ray_buffer(void) {
+    return new ray_buffers();
+}
 
-    ray_buffers* buf = new ray_buffers;
-    ErrorCode err;
-    DagMC* dag = DAG;
+// Returns the caller's buffer, or this thread's own buffer when there is none
+static ray_buffers* ray_buffer_or_local(void* data_buffers) {
+    static thread_local ray_buffers local_buffer;
+    if(data_buffers)
+        return static_cast<ray_buffers*>(data_buffers);
+    return &local_buffer;
+}
+
+// Follows one ray through the geometry, appending its intersections to buf
+static ErrorCode follow_ray(DagMC* dag, EntityHandle firstvol, const double* ray_start,
+                            const double* ray_dir, double distance_limit,
+                            ray_buffers* buf) {
+    ErrorCode err = moab::MB_SUCCESS;
 
     EntityHandle vol = firstvol;
     double dlimit = distance_limit;
@@ -140,6 +171,7 @@ ErrorCode dag_ray_follow(EntityHandle firstvol, vec3 ray_start, vec3 ray_dir,
     double next_surf_dist;
 
     CartVect uvw(ray_dir);
+    buf->history.reset();
 
     // iterate over the ray until no more intersections are available
     while(vol) {
@@ -161,12 +193,54 @@ ErrorCode dag_ray_follow(EntityHandle firstvol, vec3 ray_start, vec3 ray_dir,
         else vol = 0;
     }
 
+    return err;
+}
+
+ErrorCode dag_ray_follow(EntityHandle firstvol, vec3 ray_start, vec3 ray_dir,
+                          double distance_limit, int* num_intersections,
+                          EntityHandle** surfs, double** distances, EntityHandle** volumes,
+                          void* data_buffers){
+
+    ray_buffers* buf = ray_buffer_or_local(data_buffers);
+    buf->clear();
+
+    ErrorCode err = follow_ray(DAG, firstvol, ray_start, ray_dir, distance_limit, buf);
+    CHECKERR(err);
+
     // assign to the output variables
     *num_intersections = buf->surfs.size();
-    *surfs = &(buf->surfs[0]);
-    *distances = &(buf->dists[0]);
-    *volumes = &(buf->vols[0]);
-    data_buffers = buf;
+    *surfs = buf->surfs.data();
+    *distances = buf->dists.data();
+    *volumes = buf->vols.data();
+
+    return err;
+}
+
+ErrorCode dag_ray_follow_many(const EntityHandle* firstvols, const double* ray_starts,
+                               const double* ray_dirs, int num_rays,
+                               double distance_limit, int** offsets,
+                               EntityHandle** surfs, double** distances,
+                               EntityHandle** volumes, void* data_buffers) {
+
+    ray_buffers* buf = ray_buffer_or_local(data_buffers);
+    buf->clear();
+    buf->offsets.reserve(num_rays + 1);
+    buf->offsets.push_back(0);
+
+    ErrorCode err = moab::MB_SUCCESS;
+    DagMC* dag = DAG;
+    for(int i = 0; i < num_rays; ++i) {
+        err = follow_ray(dag, firstvols[i], ray_starts + 3*i, ray_dirs + 3*i,
+                         distance_limit, buf);
+        CHECKERR(err);
+        buf->offsets.push_back(buf->surfs.size());
+    }
+
+    // assign to the output variables
+    *offsets = buf->offsets.data();
+    *surfs = buf->surfs.data();
+    *distances = buf->dists.data();
+    *volumes = buf->vols.data();
 
     return err;
 }
@@ -176,6 +250,302 @@ void dag_dealloc_ray_buffer(void* data_buffers) {
     delete b;
 }
 
+// The smallest volume fraction tallied by dag_ray_discretize, as
+// VOL_FRAC_TOLERANCE in dagmc.pyx
+static const double VOL_FRAC_TOLERANCE = 1E-10;
+
+class discretize_buffers {
+
+    public:
+    std::vector<int> ves;
+    std::vector<int> cells;
+    std::vector<double> vol_fracs;
+    std::vector<double> rel_errors;
+
+};
+
+void* dag_alloc_discretize_buffer(void) {
+    return new discretize_buffers();
+}
+
+void dag_dealloc_discretize_buffer(void* data_buffers) {
+    delete static_cast<discretize_buffers*>(data_buffers);
+}
+
+// Sums of the samples and of their squares of each cell in one mesh ve
+typedef std::map<int, std::pair<double, double> > cell_sums;
+
+// A row of mesh ves along axis di, at index a and b of the other two axes
+struct mesh_row {
+    int di, a, b;
+};
+
+// The query state of one thread of dag_ray_discretize. DagMC queries keep
+// state in the instance, so each thread fires its rays at its own instance.
+struct discretize_worker {
+    DagMC* dag;
+    std::unique_ptr<DagMC> own_dag;  // the copy of the geometry of this thread
+    std::vector<EntityHandle> vols;  // the volumes of volList in dag
+    ray_buffers buf;
+    EntityHandle last_vol;
+};
+
+// Points w at dag, or at a copy of the geometry loaded from loadedFile
+static ErrorCode init_worker(DagMC* dag, bool copy, discretize_worker& w) {
+    ErrorCode err;
+    w.last_vol = 0;
+    w.dag = dag;
+    if(copy) {
+        // MOAB reads the file through HDF5, which takes one thread at a time
+        static std::mutex load_mutex;
+        std::lock_guard<std::mutex> lock(load_mutex);
+        w.own_dag.reset(new DagMC());
+        err = w.own_dag->load_file(loadedFile.c_str());
+        CHECKERR(err);
+        err = w.own_dag->init_OBBTree();
+        CHECKERR(err);
+        w.dag = w.own_dag.get();
+    }
+    w.vols.reserve(volList.size());
+    for(size_t i = 0; i < volList.size(); ++i)
+        w.vols.push_back(w.dag->entity_by_id(3, volList[i]));
+    return moab::MB_SUCCESS;
+}
+
+// Returns the volume that contains pt, trying the last volume found first
+static ErrorCode find_start_volume(const double* pt, const double* dir,
+                                   discretize_worker& w, EntityHandle* vol) {
+    ErrorCode err;
+    DagMC* dag = w.dag;
+    const std::vector<EntityHandle>& vols = w.vols;
+    int result = 0;
+    if(w.last_vol) {
+        err = dag->point_in_volume(w.last_vol, pt, result, dir, NULL);
+        CHECKERR(err);
+        if(result == 1) {
+            *vol = w.last_vol;
+            return moab::MB_SUCCESS;
+        }
+    }
+    for(size_t i = 0; i < vols.size(); ++i) {
+        err = dag->point_in_volume(vols[i], pt, result, dir, NULL);
+        CHECKERR(err);
+        if(result == 1) {
+            *vol = w.last_vol = vols[i];
+            return moab::MB_SUCCESS;
+        }
+    }
+    return moab::MB_ENTITY_NOT_FOUND;
+}
+
+// Fires the rays of one mesh row and tallies the track length fractions of
+// each cell in each ve of the row, as _MeshRow._evaluate_row used to.
+static ErrorCode evaluate_row(const double* const divs[3], const int num_divs[3],
+                              int num_rays, int grid, unsigned long seed,
+                              size_t row_index, const mesh_row& row,
+                              discretize_worker& w, std::vector<cell_sums>& row_sums) {
+    ErrorCode err;
+    DagMC* dag = w.dag;
+    int di = row.di;
+    int s0 = di == 0 ? 1 : 0;
+    int s1 = di == 2 ? 1 : 2;
+    double s_min_0 = divs[s0][row.a], s_max_0 = divs[s0][row.a + 1];
+    double s_min_1 = divs[s1][row.b], s_max_1 = divs[s1][row.b + 1];
+    const double* row_divs = divs[di];
+    int num_ve = num_divs[di] - 1;
+
+    // starting points, from a generator of this row alone so that the
+    // result does not depend on the number of threads
+    std::vector<double> starts(3 * num_rays);
+    if(grid) {
+        int square_dim = static_cast<int>(std::sqrt(static_cast<double>(num_rays)) + 0.5);
+        double step_0 = (s_max_0 - s_min_0) / (square_dim + 1.0);
+        double step_1 = (s_max_1 - s_min_1) / (square_dim + 1.0);
+        double low_0 = s_min_0 + step_0, low_1 = s_min_1 + step_1;
+        int n = 0;
+        for(int i = 0; i < square_dim; ++i) {
+            for(int j = 0; j < square_dim; ++j, ++n) {
+                starts[3*n + di] = row_divs[0];
+                starts[3*n + s0] = low_0 + i * (s_max_0 - low_0) / square_dim;
+                starts[3*n + s1] = low_1 + j * (s_max_1 - low_1) / square_dim;
+            }
+        }
+    } else {
+        std::mt19937_64 rng(seed + row_index);
+        std::uniform_real_distribution<double> u0(s_min_0, s_max_0);
+        std::uniform_real_distribution<double> u1(s_min_1, s_max_1);
+        for(int n = 0; n < num_rays; ++n) {
+            starts[3*n + di] = row_divs[0];
+            starts[3*n + s0] = u0(rng);
+            starts[3*n + s1] = u1(rng);
+        }
+    }
+
+    double dir[3] = {0.0, 0.0, 0.0};
+    dir[di] = 1.0;
+    row_sums.assign(num_ve, cell_sums());
+
+    for(int n = 0; n < num_rays; ++n) {
+        const double* pt = &starts[3*n];
+        EntityHandle vol;
+        err = find_start_volume(pt, dir, w, &vol);
+        CHECKERR(err);
+
+        w.buf.clear();
+        err = follow_ray(dag, vol, pt, dir, 0.0, &(w.buf));
+        CHECKERR(err);
+
+        double mesh_dist = row_divs[1] - row_divs[0];
+        int ve_count = 0;
+        bool complete = false;
+        for(size_t k = 0; k < w.buf.vols.size() && !complete; ++k) {
+            int cell = dag->get_entity_id(vol);
+            double distance = w.buf.dists[k];
+            double width = row_divs[ve_count + 1] - row_divs[ve_count];
+
+            // the volume extends past the ve boundary
+            while(distance >= mesh_dist) {
+                std::pair<double, double>& sums = row_sums[ve_count][cell];
+                double sample = mesh_dist / width;
+                sums.first += sample;
+                sums.second += sample * sample;
+                distance -= mesh_dist;
+                if(ve_count == num_ve - 1) {
+                    complete = true;
+                    break;
+                }
+                ++ve_count;
+                mesh_dist = width = row_divs[ve_count + 1] - row_divs[ve_count];
+            }
+
+            // the volume ends inside the ve
+            if(!complete && distance < mesh_dist && distance > VOL_FRAC_TOLERANCE) {
+                std::pair<double, double>& sums = row_sums[ve_count][cell];
+                double sample = distance / width;
+                sums.first += sample;
+                sums.second += sample * sample;
+                mesh_dist -= distance;
+            }
+
+            vol = w.buf.vols[k];
+        }
+    }
+    return moab::MB_SUCCESS;
+}
+
+ErrorCode dag_ray_discretize(const double* x_divs, int num_x, const double* y_divs,
+                              int num_y, const double* z_divs, int num_z,
+                              int num_rays, int grid, unsigned long seed,
+                              int num_threads, int* num_results, int** ves,
+                              int** cells, double** vol_fracs, double** rel_errors,
+                              void* data_buffers) {
+    DagMC* dag = DAG;
+    const double* const divs[3] = {x_divs, y_divs, z_divs};
+    const int num_divs[3] = {num_x, num_y, num_z};
+    if(num_x < 2 || num_y < 2 || num_z < 2 || num_rays < 1)
+        return moab::MB_INVALID_SIZE;
+    if(grid) {
+        int square_dim = static_cast<int>(std::sqrt(static_cast<double>(num_rays)) + 0.5);
+        if(square_dim * square_dim != num_rays)
+            return moab::MB_INVALID_SIZE;
+    }
+
+    // the rows in the order the serial version fired them
+    std::vector<mesh_row> rows;
+    for(int di = 0; di < 3; ++di) {
+        int s0 = di == 0 ? 1 : 0;
+        int s1 = di == 2 ? 1 : 2;
+        for(int a = 0; a < num_divs[s0] - 1; ++a) {
+            for(int b = 0; b < num_divs[s1] - 1; ++b) {
+                mesh_row row = {di, a, b};
+                rows.push_back(row);
+            }
+        }
+    }
+
+    // each thread takes every num_threads-th row; the per-row sums are merged
+    // in row order below, so the result does not depend on num_threads
+    if(num_threads < 1 || loadedFile.empty())
+        num_threads = 1;
+    num_threads = std::min<int>(num_threads, rows.size());
+    std::vector<std::vector<cell_sums> > row_sums(rows.size());
+    std::vector<ErrorCode> errs(num_threads, moab::MB_SUCCESS);
+    std::vector<std::exception_ptr> errors(num_threads);
+    std::vector<std::thread> threads;
+    for(int t = 0; t < num_threads; ++t) {
+        threads.push_back(std::thread([&, t]() {
+            try {
+                // the first thread queries DAG itself, the others a copy each
+                discretize_worker w;
+                errs[t] = init_worker(dag, t > 0, w);
+                if(errs[t] != moab::MB_SUCCESS)
+                    return;
+                for(size_t r = t; r < rows.size(); r += num_threads) {
+                    errs[t] = evaluate_row(divs, num_divs, num_rays, grid,
+                                           seed, r, rows[r], w, row_sums[r]);
+                    if(errs[t] != moab::MB_SUCCESS)
+                        return;
+                }
+            } catch(...) {
+                errors[t] = std::current_exception();
+            }
+        }));
+    }
+    for(size_t t = 0; t < threads.size(); ++t)
+        threads[t].join();
+    for(int t = 0; t < num_threads; ++t) {
+        if(errors[t])
+            std::rethrow_exception(errors[t]);
+        CHECKERR(errs[t]);
+    }
+
+    // add the rows to the sums of the whole mesh
+    int nx = num_x - 1, ny = num_y - 1, nz = num_z - 1;
+    std::vector<cell_sums> mesh_sums(nx * ny * nz);
+    for(size_t r = 0; r < rows.size(); ++r) {
+        const mesh_row& row = rows[r];
+        for(size_t j = 0; j < row_sums[r].size(); ++j) {
+            int ijk[3];
+            ijk[row.di] = j;
+            ijk[row.di == 0 ? 1 : 0] = row.a;
+            ijk[row.di == 2 ? 1 : 2] = row.b;
+            cell_sums& ve_sums = mesh_sums[ijk[0] + nx * (ijk[1] + ny * ijk[2])];
+            for(cell_sums::const_iterator it = row_sums[r][j].begin();
+                it != row_sums[r][j].end(); ++it) {
+                if(it->second.first < VOL_FRAC_TOLERANCE)
+                    continue;
+                std::pair<double, double>& sums = ve_sums[it->first];
+                sums.first += it->second.first;
+                sums.second += it->second.second;
+            }
+        }
+    }
+
+    discretize_buffers* buf = static_cast<discretize_buffers*>(data_buffers);
+    buf->ves.clear();
+    buf->cells.clear();
+    buf->vol_fracs.clear();
+    buf->rel_errors.clear();
+    double total_rays = 3.0 * num_rays;
+    for(size_t i = 0; i < mesh_sums.size(); ++i) {
+        for(cell_sums::const_iterator it = mesh_sums[i].begin();
+            it != mesh_sums[i].end(); ++it) {
+            double s = it->second.first, s2 = it->second.second;
+            buf->ves.push_back(i);
+            buf->cells.push_back(it->first);
+            buf->vol_fracs.push_back(s / total_rays);
+            buf->rel_errors.push_back(std::sqrt(s2 / (s * s) - 1.0 / total_rays));
+        }
+    }
+
+    *num_results = buf->ves.size();
+    *ves = buf->ves.data();
+    *cells = buf->cells.data();
+    *vol_fracs = buf->vol_fracs.data();
+    *rel_errors = buf->rel_errors.data();
+    return moab::MB_SUCCESS;
+}
+
 ErrorCode dag_pt_in_vol(EntityHandle vol, vec3 pt, int* result, vec3 dir, const void* history) {
 
     ErrorCode err;
@@ -197,7 +567,24 @@ ErrorCode dag_next_vol(EntityHandle surface, EntityHandle volume, EntityHandle*
     return err;
 }
 
+static std::vector<dag_volume_info> volTable;
+// (handle, table index) pairs sorted by handle
+static std::vector<std::pair<EntityHandle, int> > volTableIndex;
+
+// Returns the table entry of vol, or NULL if the table does not have it
+static const dag_volume_info* find_volume_info(EntityHandle vol) {
+    std::vector<std::pair<EntityHandle, int> >::const_iterator it =
+        std::lower_bound(volTableIndex.begin(), volTableIndex.end(),
+                         std::make_pair(vol, 0));
+    if(it == volTableIndex.end() || it->first != vol)
+        return NULL;
+    return &volTable[it->second];
+}
+
 int vol_is_graveyard(EntityHandle vol) {
+    const dag_volume_info* info = find_volume_info(vol);
+    if(info)
+        return (info->flags & DAG_VOL_GRAVEYARD) != 0;
     return DAG->has_prop(vol, "graveyard");
 }
 
@@ -205,10 +592,15 @@ int vol_is_graveyard(EntityHandle vol) {
 /* int surf_is_white_refl(EntityHandle surf); */
 
 int vol_is_implicit_complement(EntityHandle vol){
+    const dag_volume_info* info = find_volume_info(vol);
+    if(info)
+        return (info->flags & DAG_VOL_IMPLICIT_COMPLEMENT) != 0;
     return DAG->is_implicit_complement(vol);
 }
 
-ErrorCode get_volume_metadata(EntityHandle vol, int* material, double* density, double* importance) {
+// Queries the metadata of vol from DagMC
+static ErrorCode query_volume_metadata(EntityHandle vol, int* material, double* density,
+                                       double* importance) {
     ErrorCode err;
     DagMC* dag = DAG;
 
@@ -250,8 +642,66 @@ ErrorCode get_volume_metadata(EntityHandle vol, int* material, double* density,
     return moab::MB_SUCCESS;
 }
 
+ErrorCode get_volume_metadata(EntityHandle vol, int* material, double* density, double* importance) {
+    const dag_volume_info* info = find_volume_info(vol);
+    if(info) {
+        *material = info->material;
+        *density = info->density;
+        *importance = info->importance;
+        return moab::MB_SUCCESS;
+    }
+    return query_volume_metadata(vol, material, density, importance);
+}
+
 ErrorCode get_volume_boundary(EntityHandle vol, vec3 minPt, vec3 maxPt) {
+    const dag_volume_info* info = find_volume_info(vol);
+    if(info && !(info->flags & DAG_VOL_NO_BOUNDARY)) {
+        for(int i = 0; i < 3; ++i) {
+            minPt[i] = info->bbox_min[i];
+            maxPt[i] = info->bbox_max[i];
+        }
+        return moab::MB_SUCCESS;
+    }
     return DAG->getobb(vol, minPt, maxPt);
 }
 
+ErrorCode dag_build_volume_table(void) {
+    ErrorCode err;
+    DagMC* dag = DAG;
+
+    volTable.clear();
+    volTableIndex.clear();
+    int num_vols = dag->num_entities(3);
+    std::vector<dag_volume_info> table(num_vols);
+    for(int i = 0; i < num_vols; ++i) {
+        dag_volume_info& info = table[i];
+        info.id = dag->id_by_index(3, i + 1);
+        info.handle = dag->entity_by_id(3, info.id);
+        err = query_volume_metadata(info.handle, &info.material, &info.density,
+                                    &info.importance);
+        CHECKERR(err);
+        info.flags = 0;
+        if(dag->has_prop(info.handle, "graveyard"))
+            info.flags |= DAG_VOL_GRAVEYARD;
+        if(dag->is_implicit_complement(info.handle))
+            info.flags |= DAG_VOL_IMPLICIT_COMPLEMENT;
+        if(dag->getobb(info.handle, info.bbox_min, info.bbox_max) != moab::MB_SUCCESS)
+            info.flags |= DAG_VOL_NO_BOUNDARY;
+    }
+
+    std::vector<std::pair<EntityHandle, int> > index(num_vols);
+    for(int i = 0; i < num_vols; ++i)
+        index[i] = std::make_pair(table[i].handle, i);
+    std::sort(index.begin(), index.end());
+
+    volTable.swap(table);
+    volTableIndex.swap(index);
+    return moab::MB_SUCCESS;
+}
+
+const dag_volume_info* dag_volume_table(int* num_volumes) {
+    *num_volumes = volTable.size();
+    return volTable.data();
+}
+
 } // namespace pyne
@@ -46,13 +46,69 @@ ErrorCode dag_ray_fire(EntityHandle vol, vec3 ray_start, vec3 ray_dir,
                         EntityHandle* next_surf, double* next_surf_dist,
                         void* history, double distance_limit);
 
+/* Allocates a buffer for the results of dag_ray_follow and
+ * dag_ray_follow_many. A buffer is reused by every call it is passed to, so it
+ * only grows to the largest result; each thread must use its own buffer.
+ * Free it with dag_dealloc_ray_buffer.
+ */
+void* dag_alloc_ray_buffer(void);
+
+/* Follows a ray through the geometry. The result arrays live in data_buffers
+ * and stay valid until its next use. A NULL data_buffers uses a buffer
+ * owned by the calling thread.
+ */
 ErrorCode dag_ray_follow(EntityHandle firstvol, vec3 ray_start, vec3 ray_dir,
                           double distance_limit, int* num_intersections,
                           EntityHandle** surfs, double** distances,
                           EntityHandle** volumes, void* data_buffers);
 
+/* Follows num_rays rays, ray i starting at ray_starts[3*i] in firstvols[i]
+ * with direction ray_dirs[3*i]. The intersections of all rays are stored
+ * one after the other in surfs, distances, and volumes; those of ray i are
+ * the entries offsets[i] to offsets[i+1] - 1. The buffers are handled as in
+ * dag_ray_follow.
+ */
+ErrorCode dag_ray_follow_many(const EntityHandle* firstvols, const double* ray_starts,
+                               const double* ray_dirs, int num_rays,
+                               double distance_limit, int** offsets,
+                               EntityHandle** surfs, double** distances,
+                               EntityHandle** volumes, void* data_buffers);
+
 void dag_dealloc_ray_buffer(void* data_buffers);
 
+/* Allocates and frees a buffer for the results of dag_ray_discretize. */
+void* dag_alloc_discretize_buffer(void);
+void dag_dealloc_discretize_buffer(void* data_buffers);
+
+/* Discretizes the geometry onto the structured mesh with the given x, y, and z
+ * divisions by firing num_rays rays down every mesh row in each of the three
+ * directions, as dagmc.ray_discretize. Starting points are a grid when grid is
+ * nonzero, num_rays must then be a perfect square, and are otherwise drawn
+ * from a generator seeded with seed and the row index.
+ *
+ * The rows are shared out over num_threads threads, each with its own ray
+ * history and buffers. DagMC's ray_fire, point_in_volume and next_vol keep
+ * query state in the DagMC instance and must not run on one instance from two
+ * threads at once, so the first thread queries the geometry of dag_load and
+ * every other thread a copy of its own, loaded from the same file one thread
+ * at a time. Each extra thread thus costs the load time and memory of one
+ * copy of the geometry. The result does not depend on num_threads.
+ *
+ * None of the other functions here may be called while dag_ray_discretize
+ * runs, or from several threads at once, since they all query DAG.
+ *
+ * On return there are num_results entries in each of the result arrays, giving
+ * the ve index (x changing fastest), cell id, volume fraction, and relative
+ * error, sorted by ve and cell. The arrays live in data_buffers, from
+ * dag_alloc_discretize_buffer, and stay valid until its next use.
+ */
+ErrorCode dag_ray_discretize(const double* x_divs, int num_x, const double* y_divs,
+                              int num_y, const double* z_divs, int num_z,
+                              int num_rays, int grid, unsigned long seed,
+                              int num_threads, int* num_results, int** ves,
+                              int** cells, double** vol_fracs, double** rel_errors,
+                              void* data_buffers);
+
 ErrorCode dag_pt_in_vol(EntityHandle vol, vec3 pt, int* result, vec3 dir,
                          const void* history);
 
@@ -68,6 +124,35 @@ ErrorCode get_volume_metadata(EntityHandle vol, int* material, double* density,
 
 ErrorCode get_volume_boundary(EntityHandle vol, vec3 minPt, vec3 maxPt);
 
+/* Flags of dag_volume_info */
+#define DAG_VOL_GRAVEYARD 1
+#define DAG_VOL_IMPLICIT_COMPLEMENT 2
+#define DAG_VOL_NO_BOUNDARY 4  /* the bounding box query failed */
+
+/* The metadata, bounding box, and flags of a volume */
+typedef struct {
+    int id;
+    EntityHandle handle;
+    int material;
+    double density;
+    double importance;
+    double bbox_min[3];
+    double bbox_max[3];
+    int flags;
+} dag_volume_info;
+
+/* Queries the metadata, bounding box, and flags of every volume once and
+ * keeps them in a table, which get_volume_metadata, get_volume_boundary,
+ * vol_is_graveyard, and vol_is_implicit_complement then read instead of
+ * DagMC. dag_load calls it; calling it again rebuilds the table.
+ */
+ErrorCode dag_build_volume_table(void);
+
+/* Returns the table of dag_build_volume_table, with its length in
+ * num_volumes, in the order of the volume indices.
+ */
+const dag_volume_info* dag_volume_table(int* num_volumes);
+
 #ifdef __cplusplus
 } // namespace pyne
 } // extern "C"
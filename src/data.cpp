@@ -1,7 +1,19 @@
 // Implements basic nuclear data functions.
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <stdint.h>
+
 #ifndef PYNE_IS_AMALGAMATED
 #include "data.h"
 #include "atomic_data.h"
+#include "instrument.h"
 #endif
 
 //
@@ -19,6 +31,194 @@ const double pyne::Bq_per_Ci = 3.7e10;
 const double pyne::Ci_per_Bq = 2.7027027e-11;
 
 
+/***************************/
+/*** Table Loading Guard ***/
+/***************************/
+
+namespace {
+// Guard for the lazy loading of one nuc_data table. The first callers run the
+// loader under a lock while concurrent callers wait for it, after which every
+// call only reads an atomic flag. If the loader throws, the next call retries.
+class TableGuard {
+ public:
+  TableGuard() : done(false) {};
+  template <typename Loader> void load(Loader loader) {
+    if (done.load(std::memory_order_acquire))
+      return;
+    std::lock_guard<std::recursive_mutex> lock(load_mutex());
+    if (done.load(std::memory_order_relaxed))
+      return;
+    loader();
+    done.store(true, std::memory_order_release);
+  };
+
+ private:
+  TableGuard(const TableGuard&);
+  TableGuard& operator=(const TableGuard&);
+  std::atomic<bool> done;
+#ifdef H5_HAVE_THREADSAFE
+  std::recursive_mutex mutex;
+  std::recursive_mutex& load_mutex() {return mutex;};
+#else
+  // HDF5 without thread safety must not be entered by two threads at once,
+  // so all tables share one lock. It is recursive since some loaders look
+  // up other tables.
+  static std::recursive_mutex& load_mutex() {
+    static std::recursive_mutex mutex;
+    return mutex;
+  };
+#endif
+};
+
+// Loads a table through its guard, unless it has already been filled by hand.
+template <typename Table, typename Loader>
+void load_table(TableGuard& guard, Table& table, Loader loader) {
+  guard.load([&]() {
+    if (table.empty()) {
+      PYNE_COUNT(COUNT_DATA_LOADS);
+      PYNE_TIME(TIME_DATA_LOAD);
+      loader();
+    }
+  });
+}
+
+// Loads the two tables filled by one loader through the guard of that loader,
+// unless both have already been filled by hand. Either table may be looked up
+// first, so a guard per table would let two threads run the loader at once.
+template <typename Table1, typename Table2, typename Loader>
+void load_tables(TableGuard& guard, Table1& table1, Table2& table2,
+                 Loader loader) {
+  guard.load([&]() {
+    if (table1.empty() || table2.empty()) {
+      PYNE_COUNT(COUNT_DATA_LOADS);
+      PYNE_TIME(TIME_DATA_LOAD);
+      loader();
+    }
+  });
+}
+
+TableGuard atomic_mass_guard, q_val_guard, scattering_lengths_guard,
+           wimsdfpy_guard, ndsfpy_guard;
+
+// atomic_mass_map and natural_abund_map
+void ensure_atomic_mass() {
+  load_tables(atomic_mass_guard, pyne::atomic_mass_map,
+              pyne::natural_abund_map, pyne::_load_atomic_mass_map);
+}
+
+// q_val_map and gamma_frac_map
+void ensure_q_val() {
+  load_tables(q_val_guard, pyne::q_val_map, pyne::gamma_frac_map,
+              pyne::_load_q_val_map);
+}
+
+// b_coherent_map and b_incoherent_map
+void ensure_scattering_lengths() {
+  load_tables(scattering_lengths_guard, pyne::b_coherent_map,
+              pyne::b_incoherent_map, pyne::_load_scattering_lengths);
+}
+
+void ensure_wimsdfpy() {
+  load_table(wimsdfpy_guard, pyne::wimsdfpy_data, pyne::_load_wimsdfpy);
+}
+
+void ensure_ndsfpy() {
+  load_table(ndsfpy_guard, pyne::ndsfpy_data, pyne::_load_ndsfpy);
+}
+
+// One guard per decay-data record type, shared by the maps of that type.
+template <typename U> TableGuard& data_guard() {
+  static TableGuard guard;
+  return guard;
+}
+
+template <typename U, typename Table> void ensure_data(Table& data) {
+  load_table(data_guard<U>(), data, pyne::_load_data<U>);
+}
+
+
+// Append-only, lock-free memo of the values estimated for nuclides that are
+// missing from a data map, so that the loaded maps are never written by a
+// lookup. It is an open addressed table of a fixed number of slots. A writer
+// claims an empty slot with a compare-and-swap, fills it in, and then marks it
+// ready; readers skip the slots that are still being written. Since the
+// estimates only depend on the loaded data, a reader that misses a value being
+// published just computes it again, and a crowded table stops memoizing.
+template <typename V> class MissCache {
+ public:
+  MissCache() {clear();};
+
+  bool find(int nuc, V& value) const {
+    for (unsigned int n = 0, i = slot_of(nuc); n < PROBES; n++, i = (i + 1) % SIZE) {
+      unsigned char state = slots[i].state.load(std::memory_order_acquire);
+      if (state == EMPTY)
+        return false;
+      if (state == READY && slots[i].nuc == nuc) {
+        value = slots[i].value;
+        return true;
+      }
+    }
+    return false;
+  };
+
+  void insert(int nuc, const V& value) {
+    for (unsigned int n = 0, i = slot_of(nuc); n < PROBES; n++, i = (i + 1) % SIZE) {
+      unsigned char state = EMPTY;
+      if (slots[i].state.compare_exchange_strong(state, WRITING,
+                                                 std::memory_order_acquire)) {
+        slots[i].nuc = nuc;
+        slots[i].value = value;
+        slots[i].state.store(READY, std::memory_order_release);
+        return;
+      }
+      if (state == READY && slots[i].nuc == nuc)
+        return;
+    }
+  };
+
+  // Not safe while other threads look nuclides up.
+  void clear() {
+    for (unsigned int i = 0; i < SIZE; i++)
+      slots[i].state.store(EMPTY, std::memory_order_relaxed);
+  };
+
+ private:
+  enum {EMPTY, WRITING, READY};
+  static const unsigned int BITS = 12;
+  static const unsigned int SIZE = 1u << BITS;
+  // linear probing gives up after this many slots, as when the table is full
+  static const unsigned int PROBES = 64;
+  struct Slot {
+    std::atomic<unsigned char> state;
+    int nuc;
+    V value;
+  };
+  static unsigned int slot_of(int nuc) {
+    // Fibonacci hashing spreads the nuclide ids, whose low digits are mostly 0
+    return ((uint32_t) nuc * UINT32_C(2654435769)) >> (32 - BITS);
+  };
+  MissCache(const MissCache&);
+  MissCache& operator=(const MissCache&);
+  Slot slots[SIZE];
+};
+
+MissCache<double> atomic_mass_misses, natural_abund_misses, q_val_misses,
+                  gamma_frac_misses;
+MissCache<xd_complex_t> b_coherent_misses, b_incoherent_misses;
+}  // namespace
+
+
+void pyne::clear_miss_caches() {
+  atomic_mass_misses.clear();
+  natural_abund_misses.clear();
+  q_val_misses.clear();
+  gamma_frac_misses.clear();
+  b_coherent_misses.clear();
+  b_incoherent_misses.clear();
+  nuc_property_table.clear();
+}
+
+
 /********************************/
 /*** data_checksums Functions ***/
 /********************************/
@@ -93,6 +293,7 @@ void pyne::_load_atomic_mass_map() {
 
 
 double pyne::atomic_mass(int nuc) {
+  ensure_atomic_mass();
   // Find the nuclide's mass in AMU
   std::map<int, double>::iterator nuc_iter, nuc_end;
 
@@ -112,16 +313,18 @@ double pyne::atomic_mass(int nuc) {
     return atomic_mass(nuc);
   }
 
+  // Then check the estimates made before
   double aw;
+  if (atomic_mass_misses.find(nuc, aw))
+    return aw;
+
   int nucid = nucname::id(nuc);
 
   // If in an excited state, return the ground
   // state mass...not strictly true, but good guess.
   if (0 < nucid%10000) {
     aw = atomic_mass((nucid/10000)*10000);
-    if (atomic_mass_map.count(nuc) != 1) {
-      atomic_mass_map.insert(std::pair<int, double>(nuc, aw));
-    }
+    atomic_mass_misses.insert(nuc, aw);
     return aw;
   };
 
@@ -129,9 +332,7 @@ double pyne::atomic_mass(int nuc) {
   // take a best guess based on the
   // aaa number.
   aw = (double) ((nucid/10000)%1000);
-  if (atomic_mass_map.count(nuc) != 1) {
-    atomic_mass_map.insert(std::pair<int, double>(nuc, aw));
-  }
+  atomic_mass_misses.insert(nuc, aw);
   return aw;
 }
 
@@ -155,6 +356,7 @@ double pyne::atomic_mass(std::string nuc) {
 std::map<int, double> pyne::natural_abund_map = std::map<int, double>();
 
 double pyne::natural_abund(int nuc) {
+  ensure_atomic_mass();
   // Find the nuclide's natural abundance
   std::map<int, double>::iterator nuc_iter, nuc_end;
 
@@ -173,14 +375,18 @@ double pyne::natural_abund(int nuc) {
       return natural_abund(nuc);
   }
 
+  // Then check the estimates made before
   double na;
+  if (natural_abund_misses.find(nuc, na))
+    return na;
+
   int nucid = nucname::id(nuc);
 
   // If in an excited state, return the ground
   // state abundance...not strictly true, but good guess.
   if (0 < nucid%10000) {
     na = natural_abund((nucid/10000)*10000);
-    natural_abund_map[nuc] = na;
+    natural_abund_misses.insert(nuc, na);
     return na;
   }
 
@@ -188,7 +394,7 @@ double pyne::natural_abund(int nuc) {
   // take a best guess based on the
   // aaa number.
   na = 0.0;
-  natural_abund_map[nuc] = na;
+  natural_abund_misses.insert(nuc, na);
   return na;
 }
 
@@ -255,6 +461,7 @@ void pyne::_load_q_val_map() {
 std::map<int, double> pyne::q_val_map = std::map<int, double>();
 
 double pyne::q_val(int nuc) {
+  ensure_q_val();
   // Find the nuclide's q_val in MeV/fission
   std::map<int, double>::iterator nuc_iter, nuc_end;
 
@@ -272,13 +479,15 @@ double pyne::q_val(int nuc) {
   };
 
   double qv;
+  if (q_val_misses.find(nuc, qv))
+    return qv;
   int nucid = nucname::id(nuc);
   if (nucid != nuc)
     return q_val(nucid);
 
   // If nuclide is not found, return 0
   qv = 0.0;
-  q_val_map[nuc] = qv;
+  q_val_misses.insert(nuc, qv);
   return qv;
 }
 
@@ -302,6 +511,7 @@ double pyne::q_val(std::string nuc) {
 std::map<int, double> pyne::gamma_frac_map = std::map<int, double>();
 
 double pyne::gamma_frac(int nuc) {
+  ensure_q_val();
   // Find the nuclide's fraction of Q that comes from gammas
   std::map<int, double>::iterator nuc_iter, nuc_end;
 
@@ -319,13 +529,15 @@ double pyne::gamma_frac(int nuc) {
   }
 
   double gf;
+  if (gamma_frac_misses.find(nuc, gf))
+    return gf;
   int nucid = nucname::id(nuc);
   if (nucid != nuc)
     return gamma_frac(nucid);
 
   // If nuclide is not found, return 0
   gf = 0.0;
-  gamma_frac_map[nucid] = gf;
+  gamma_frac_misses.insert(nucid, gf);
   return gf;
 }
 
@@ -438,10 +650,10 @@ std::map<int, pyne::dose>& dose_source_map(int source) {
   } else {
     dm = &pyne::epa_dose_map;
   }
-  if (dm->empty()) {
-      std::string source_path = source_string(source);
-      _load_dose_map(*dm, source_path);
-  }
+  static TableGuard dose_guards[3];
+  load_table(dose_guards[source == 1 || source == 2 ? source : 0], *dm, [&]() {
+    _load_dose_map(*dm, source_string(source));
+  });
   return *dm;
 }
 
@@ -692,6 +904,7 @@ void pyne::_load_scattering_lengths() {
 
 
 xd_complex_t pyne::b_coherent(int nuc) {
+  ensure_scattering_lengths();
   // Find the nuclide's bound scattering length in cm
   std::map<int, xd_complex_t>::iterator nuc_iter, nuc_end;
 
@@ -709,7 +922,11 @@ xd_complex_t pyne::b_coherent(int nuc) {
     return b_coherent(nuc);
   }
 
+  // Then check the estimates made before
   xd_complex_t bc;
+  if (b_coherent_misses.find(nuc, bc))
+    return bc;
+
   int nucid = nucname::id(nuc);
   int znum = nucname::znum(nucid);
   int anum = nucname::anum(nucid);
@@ -719,7 +936,7 @@ xd_complex_t pyne::b_coherent(int nuc) {
   while (nuc_iter != nuc_end) {
     if (anum == nucname::anum((*nuc_iter).first)) {
       bc = (*nuc_iter).second;
-      b_coherent_map[nuc] = bc;
+      b_coherent_misses.insert(nuc, bc);
       return bc;
     }
     nuc_iter++;
@@ -730,7 +947,7 @@ xd_complex_t pyne::b_coherent(int nuc) {
   while (nuc_iter != nuc_end) {
     if (znum == nucname::znum((*nuc_iter).first)) {
       bc = (*nuc_iter).second;
-      b_coherent_map[nuc] = bc;
+      b_coherent_misses.insert(nuc, bc);
       return bc;
     }
     nuc_iter++;
@@ -740,7 +957,7 @@ xd_complex_t pyne::b_coherent(int nuc) {
   // just return zero...
   bc.re = 0.0;
   bc.im = 0.0;
-  b_coherent_map[nuc] = bc;
+  b_coherent_misses.insert(nuc, bc);
   return bc;
 }
 
@@ -764,6 +981,7 @@ xd_complex_t pyne::b_coherent(std::string nuc) {
 
 
 xd_complex_t pyne::b_incoherent(int nuc) {
+  ensure_scattering_lengths();
   // Find the nuclide's bound inchoherent scattering length in cm
   std::map<int, xd_complex_t>::iterator nuc_iter, nuc_end;
 
@@ -781,7 +999,11 @@ xd_complex_t pyne::b_incoherent(int nuc) {
     return b_incoherent(nuc);
   }
 
+  // Then check the estimates made before
   xd_complex_t bi;
+  if (b_incoherent_misses.find(nuc, bi))
+    return bi;
+
   int nucid = nucname::id(nuc);
   int znum = nucname::znum(nucid);
   int anum = nucname::anum(nucid);
@@ -791,7 +1013,7 @@ xd_complex_t pyne::b_incoherent(int nuc) {
   while (nuc_iter != nuc_end) {
     if (anum == nucname::anum((*nuc_iter).first)) {
       bi = (*nuc_iter).second;
-      b_incoherent_map[nuc] = bi;
+      b_incoherent_misses.insert(nuc, bi);
       return bi;
     }
     nuc_iter++;
@@ -802,7 +1024,7 @@ xd_complex_t pyne::b_incoherent(int nuc) {
   while (nuc_iter != nuc_end) {
     if (znum == nucname::znum((*nuc_iter).first)) {
       bi = (*nuc_iter).second;
-      b_incoherent_map[nuc] = bi;
+      b_incoherent_misses.insert(nuc, bi);
       return bi;
     }
     nuc_iter++;
@@ -812,7 +1034,7 @@ xd_complex_t pyne::b_incoherent(int nuc) {
   // just return zero...
   bi.re = 0.0;
   bi.im = 0.0;
-  b_incoherent_map[nuc] = bi;
+  b_incoherent_misses.insert(nuc, bi);
   return bi;
 }
 
@@ -991,6 +1213,11 @@ void pyne::_load_ndsfpy() {
 }
 
 double pyne::fpyield(std::pair<int, int> from_to, int source, bool get_error) {
+  PYNE_COUNT(COUNT_FPYIELD_LOOKUPS);
+  if (source == 0)
+    ensure_wimsdfpy();
+  else
+    ensure_ndsfpy();
   // Note that this may be expanded eventually to include other
   // sources of fission product data.
 
@@ -1027,22 +1254,10 @@ double pyne::fpyield(std::pair<int, int> from_to, int source, bool get_error) {
     }
   }
 
-
-  // Next, fill up the map with values from the
-  // nuc_data.h5, if the map is empty.
-  if ((source == 0 ) && (wimsdfpy_data.empty())) {
-    _load_wimsdfpy();
-    return fpyield(from_to, 0, get_error);
-  }else if (ndsfpy_data.empty()) {
-    _load_ndsfpy();
-    return fpyield(from_to, source, get_error);
-  }
-
-  // Finally, if none of these work,
-  // assume the value is stable
-  double fpy = 0.0;
-  wimsdfpy_data[from_to] = fpy;
-  return fpy;
+  // Finally, if none of these work, assume the process is impossible. The
+  // data are not changed, so that concurrent lookups only read them.
+  PYNE_COUNT(COUNT_FPYIELD_MISSES);
+  return 0.0;
 }
 
 double pyne::fpyield(int from_nuc, int to_nuc, int source, bool get_error) {
@@ -1062,6 +1277,127 @@ double pyne::fpyield(std::string from_nuc, std::string to_nuc, int source,
 }
 
 
+// Selects the yield of source, or its error, from an NDS record
+static double nds_yield(const pyne::ndsfpysub& sub, int source, bool get_error) {
+  switch (source) {
+    case 1:
+      return get_error ? sub.yield_thermal_err : sub.yield_thermal;
+    case 2:
+      return get_error ? sub.yield_fast_err : sub.yield_fast;
+    case 3:
+      return get_error ? sub.yield_14MeV_err : sub.yield_14MeV;
+  }
+  return 0.0;
+}
+
+
+pyne::FissionYieldMatrix::FissionYieldMatrix(int source, bool get_error) {
+  if (source < 0 || 3 < source)
+    throw std::invalid_argument("The fission yield source must be 0, 1, 2 "
+                                "or 3.");
+  // the (parent, product) pairs of the data in order, i.e. row by row
+  std::vector<std::pair<int, int> > pairs;
+  std::vector<double> yields;
+  if (source == 0) {
+    ensure_wimsdfpy();
+    std::map<std::pair<int, int>, double>::const_iterator it;
+    for (it = wimsdfpy_data.begin(); it != wimsdfpy_data.end(); ++it) {
+      if (it->second != 0.0) {
+        pairs.push_back(it->first);
+        yields.push_back(it->second);
+      }
+    }
+  } else {
+    ensure_ndsfpy();
+    std::map<std::pair<int, int>, ndsfpysub>::const_iterator it;
+    for (it = ndsfpy_data.begin(); it != ndsfpy_data.end(); ++it) {
+      double y = nds_yield(it->second, source, get_error);
+      if (y != 0.0) {
+        pairs.push_back(it->first);
+        yields.push_back(y);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < pairs.size(); i++) {
+    if (parent_ids.empty() || parent_ids.back() != pairs[i].first)
+      parent_ids.push_back(pairs[i].first);
+    product_ids.push_back(pairs[i].second);
+  }
+  std::sort(product_ids.begin(), product_ids.end());
+  product_ids.erase(std::unique(product_ids.begin(), product_ids.end()),
+                    product_ids.end());
+
+  ptr.assign(1, 0);
+  cols.reserve(pairs.size());
+  vals.reserve(pairs.size());
+  for (size_t i = 0; i < pairs.size(); i++) {
+    if (0 < i && pairs[i].first != pairs[i - 1].first)
+      ptr.push_back(cols.size());
+    cols.push_back(product_index(pairs[i].second));
+    vals.push_back(yields[i]);
+  }
+  if (!pairs.empty())
+    ptr.push_back(cols.size());
+}
+
+
+int pyne::FissionYieldMatrix::parent_index(int nuc) const {
+  std::vector<int>::const_iterator it = std::lower_bound(parent_ids.begin(),
+                                                         parent_ids.end(), nuc);
+  if (it == parent_ids.end() || *it != nuc)
+    return -1;
+  return it - parent_ids.begin();
+}
+
+
+int pyne::FissionYieldMatrix::product_index(int nuc) const {
+  std::vector<int>::const_iterator it = std::lower_bound(product_ids.begin(),
+                                                         product_ids.end(), nuc);
+  if (it == product_ids.end() || *it != nuc)
+    return -1;
+  return it - product_ids.begin();
+}
+
+
+double pyne::FissionYieldMatrix::operator()(int p, int c) const {
+  const int* first = row_products(p);
+  const int* last = first + row_size(p);
+  const int* it = std::lower_bound(first, last, c);
+  if (it == last || *it != c)
+    return 0.0;
+  return row_yields(p)[it - first];
+}
+
+
+double pyne::FissionYieldMatrix::yield(int from_nuc, int to_nuc) const {
+  int p = parent_index(from_nuc);
+  int c = product_index(to_nuc);
+  if (p < 0 || c < 0)
+    return 0.0;
+  return (*this)(p, c);
+}
+
+
+const pyne::FissionYieldMatrix& pyne::fpyield_matrix(int source,
+                                                     bool get_error) {
+  // one matrix per source and kind, each built by the first call asking
+  if (source < 0 || 3 < source)
+    throw std::invalid_argument("The fission yield source must be 0, 1, 2 "
+                                "or 3.");
+  switch (2 * source + get_error) {
+    case 0: {static const FissionYieldMatrix m (0, false); return m;}
+    case 1: {static const FissionYieldMatrix m (0, true); return m;}
+    case 2: {static const FissionYieldMatrix m (1, false); return m;}
+    case 3: {static const FissionYieldMatrix m (1, true); return m;}
+    case 4: {static const FissionYieldMatrix m (2, false); return m;}
+    case 5: {static const FissionYieldMatrix m (2, true); return m;}
+    case 6: {static const FissionYieldMatrix m (3, false); return m;}
+    default: {static const FissionYieldMatrix m (3, true); return m;}
+  }
+}
+
+
 /***********************/
 /*** decay functions ***/
 /***********************/
@@ -1076,26 +1412,90 @@ const std::pair<int, double>& rhs) const {
       lhs.first<rhs.first);
 }
 
+namespace {
+// Contiguous copy of a (parent, energy) keyed data map with two sorted
+// indexes, so that parent and energy range queries are binary searches over
+// arrays. It is rebuilt when a different map or a map of another size is
+// queried, since the maps are only changed by loading or by hand.
+template <typename U> class RecordIndex {
+ public:
+  RecordIndex() : source(NULL), built_size(0) {};
+  void update(const std::map<std::pair<int, double>, U>& data) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (source == &data && built_size == data.size())
+      return;
+    keys.clear();
+    records.clear();
+    energy_keys.clear();
+    energy_order.clear();
+    keys.reserve(data.size());
+    records.reserve(data.size());
+    typename std::map<std::pair<int, double>, U>::const_iterator it;
+    for (it = data.begin(); it != data.end(); ++it) {
+      keys.push_back(it->first);
+      records.push_back(it->second);
+    }
+    std::vector<std::pair<std::pair<double, int>, size_t> > order;
+    order.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); i++)
+      if (!isnan(keys[i].second))
+        order.push_back(std::make_pair(std::make_pair(keys[i].second,
+                                                      keys[i].first), i));
+    std::sort(order.begin(), order.end());
+    energy_keys.reserve(order.size());
+    energy_order.reserve(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+      energy_keys.push_back(order[i].first);
+      energy_order.push_back(order[i].second);
+    }
+    source = &data;
+    built_size = data.size();
+  };
+
+  std::vector<std::pair<int, double> > keys;  ///< sorted by parent, energy
+  std::vector<U> records;  ///< records in the order of keys
+  std::vector<std::pair<double, int> > energy_keys;  ///< sorted by energy
+  std::vector<size_t> energy_order;  ///< record offsets of energy_keys
+
+ private:
+  std::mutex mutex;
+  const void* source;
+  size_t built_size;
+};
+
+template <typename U> const RecordIndex<U>& record_index(
+    const std::map<std::pair<int, double>, U>& data) {
+  static RecordIndex<U> index;
+  index.update(data);
+  return index;
+}
+
+template <typename T, typename U> const T& record_value(const U& record,
+                                                        size_t valoffset) {
+  return *(const T*)((const char*)&record + valoffset);
+}
+}  // namespace
+
 template<typename T, typename U> std::vector<T> pyne::data_access(
 double energy_min, double energy_max, size_t valoffset, std::map<std::pair<int,
 double>, U>  &data) {
-  typename std::map<std::pair<int, double>, U, swapmapcompare>::iterator
-    nuc_iter, nuc_end, it;
-  std::map<std::pair<int, double>, U, swapmapcompare> dc(data.begin(),
-    data.end());
+  ensure_data<U>(data);
   std::vector<T> result;
   if (energy_max < energy_min){
     double temp = energy_max;
     energy_max = energy_min;
     energy_min = temp;
   }
-  nuc_iter = dc.lower_bound(std::make_pair(0, energy_min));
-  nuc_end = dc.upper_bound(std::make_pair(9999999999, energy_max));
-  T *ret;
-  // First check if we already have the nuc in the map
-  for (it = nuc_iter; it!= nuc_end; ++it){
-    ret = (T *)((char *)&(it->second) + valoffset);
-    result.push_back(*ret);
+  const RecordIndex<U>& index = record_index(data);
+  std::vector<std::pair<double, int> >::const_iterator lo, hi, it;
+  lo = std::lower_bound(index.energy_keys.begin(), index.energy_keys.end(),
+                        std::make_pair(energy_min, 0));
+  hi = std::upper_bound(lo, index.energy_keys.end(),
+                        std::make_pair(energy_max, INT_MAX));
+  result.reserve(hi - lo);
+  for (it = lo; it != hi; ++it) {
+    size_t n = index.energy_order[it - index.energy_keys.begin()];
+    result.push_back(record_value<T>(index.records[n], valoffset));
   }
   // Next, fill up the map with values from the
   // nuc_data.h5, if the map is empty.
@@ -1110,16 +1510,17 @@ double>, U>  &data) {
 template<typename T, typename U> std::vector<T> pyne::data_access(int parent,
 double min, double max, size_t valoffset,
 std::map<std::pair<int, double>, U>  &data) {
-  typename std::map<std::pair<int, double>, U>::iterator nuc_iter, nuc_end, it;
+  ensure_data<U>(data);
   std::vector<T> result;
-  nuc_iter = data.lower_bound(std::make_pair(parent,min));
-  nuc_end = data.upper_bound(std::make_pair(parent,max));
-  T *ret;
-  // First check if we already have the nuc in the map
-  for (it = nuc_iter; it!= nuc_end; ++it){
-    ret = (T *)((char *)&(it->second) + valoffset);
-    result.push_back(*ret);
-  }
+  const RecordIndex<U>& index = record_index(data);
+  std::vector<std::pair<int, double> >::const_iterator lo, hi, it;
+  lo = std::lower_bound(index.keys.begin(), index.keys.end(),
+                        std::make_pair(parent, min));
+  hi = std::upper_bound(lo, index.keys.end(), std::make_pair(parent, max));
+  result.reserve(hi - lo);
+  for (it = lo; it != hi; ++it)
+    result.push_back(record_value<T>(index.records[it - index.keys.begin()],
+                                     valoffset));
   // Next, fill up the map with values from the
   // nuc_data.h5, if the map is empty.
   if (data.empty())
@@ -1132,6 +1533,7 @@ std::map<std::pair<int, double>, U>  &data) {
 
 template<typename T, typename U> T pyne::data_access(std::pair<int, int>
 from_to, size_t valoffset, std::map<std::pair<int, int>, U> &data) {
+  ensure_data<U>(data);
   typename std::map<std::pair<int, int>, U>::iterator nuc_iter, nuc_end;
 
   nuc_iter = data.find(from_to);
@@ -1155,6 +1557,7 @@ from_to, size_t valoffset, std::map<std::pair<int, int>, U> &data) {
 
 template<typename T, typename U> std::vector<T> pyne::data_access(int parent,
 size_t valoffset, std::map<std::pair<int, int>, U> &data){
+  ensure_data<U>(data);
   typename std::map<std::pair<int, int>, U>::iterator nuc_iter, nuc_end, it;
   std::vector<T> result;
   nuc_iter = data.lower_bound(std::make_pair(parent,0));
@@ -1177,6 +1580,7 @@ size_t valoffset, std::map<std::pair<int, int>, U> &data){
 
 template<typename T, typename U> std::vector<T> pyne::data_access(int parent,
 size_t valoffset, std::map<std::pair<int, unsigned int>, U> &data){
+  ensure_data<U>(data);
   typename std::map<std::pair<int, unsigned int>, U>::iterator nuc_iter,
    nuc_end, it;
   std::vector<T> result;
@@ -1200,6 +1604,7 @@ size_t valoffset, std::map<std::pair<int, unsigned int>, U> &data){
 
 template<typename U> double pyne::data_access(int nuc,
 size_t valoffset, std::map<int, U> &data){
+  ensure_data<U>(data);
   typename std::map<int, U>::iterator nuc_iter,
    nuc_end;
   nuc_iter = data.find(nuc);
@@ -1430,9 +1835,7 @@ template<> void pyne::_load_data<pyne::level_data>()
 //
 int pyne::id_from_level(int nuc, double level, std::string special) {
   int nostate = (nuc / 10000) * 10000;
-  if (level_data_lvl_map.empty()) {
-    _load_data<level_data>();
-  }
+  ensure_data<pyne::level_data>(level_data_lvl_map);
 
   std::map<std::pair<int, double>, level_data>::iterator nuc_lower, nuc_upper;
 
@@ -1468,22 +1871,7 @@ int pyne::id_from_level(int nuc, double level){
 int pyne::metastable_id(int nuc, int m) {
   int nostate = (nuc / 10000) * 10000;
   if (m==0) return nostate;
-  if (level_data_lvl_map.empty()) {
-    _load_data<level_data>();
-  }
-
-  std::map<std::pair<int, double>, level_data>::iterator nuc_lower, nuc_upper;
-
-  nuc_lower = level_data_lvl_map.lower_bound(std::make_pair(nostate, 0.0));
-  nuc_upper = level_data_lvl_map.upper_bound(std::make_pair(nostate+9999,
-                                                            DBL_MAX));
-  for (std::map<std::pair<int, double>, level_data>::iterator it=nuc_lower;
-  it!=nuc_upper; ++it) {
-    if (it->second.metastable == m)
-        return it->second.nuc_id;
-  }
-
-  return -1;
+  return decay_graph()->metastable_id(nuc, m);
 }
 
 int pyne::metastable_id(int nuc) {
@@ -1496,38 +1884,12 @@ int pyne::metastable_id(int nuc) {
 
 
 std::set<int> pyne::decay_children(int nuc) {
-  // make sure spontaneous fission data is loaded
-  if (wimsdfpy_data.empty())
-    _load_wimsdfpy();
-
-  std::vector<unsigned int> part = data_access<unsigned int, level_data>(nuc,
-    offsetof(level_data, rx_id), level_data_rx_map);
-  std::vector<unsigned int>::iterator it = part.begin();
-  std::set<int> result;
-  for (; it != part.end(); ++it) {
-    switch (*it) {
-      case 36125: {
-        // internal transition, rx == 'it'
-        result.insert((nuc /10000) * 10000);
-        break;
-      }
-      case 36565:
-      case 1794828612:
-      {
-        // spontaneous fission, rx == 'sf', 36565
-        // beta- & spontaneous fission, rx == 'b-sf', 1794828612
-        std::map<std::pair<int, int>, double>::iterator sf = wimsdfpy_data.begin();
-        for (; sf != wimsdfpy_data.end(); ++sf)
-          if (sf->first.first == nuc)
-            result.insert(sf->first.second);
-        break;
-      }
-      default: {
-        result.insert((rxname::child(nuc, *it, "decay") /10000) * 10000);
-      }
-    }
-  }
-  return result;
+  std::shared_ptr<const DecayGraph> graph = decay_graph();
+  int p = graph->index(nuc);
+  if (p < 0)
+    return std::set<int>();
+  return std::set<int>(graph->children(p),
+                       graph->children(p) + graph->num_children(p));
 }
 
 std::set<int> pyne::decay_children(char * nuc)
@@ -1620,38 +1982,144 @@ double pyne::half_life(std::string nuc) {
 // Branch ratio data
 //
 double pyne::branch_ratio(std::pair<int, int> from_to) {
-  using std::vector;
-  using pyne::nucname::groundstate;
-  // make sure spontaneous fission data is loaded
-  if (wimsdfpy_data.empty())
-    _load_wimsdfpy();
-
-  vector<unsigned int> part1 = \
-    data_access<unsigned int, level_data>(from_to.first, offsetof(level_data, rx_id),
-                                          level_data_rx_map);
-  vector<double> part2 = \
-    data_access<double, level_data>(from_to.first, offsetof(level_data, branch_ratio),
-                                    level_data_rx_map);
-  double result = 0.0;
+  std::shared_ptr<const DecayGraph> graph = decay_graph();
   if ((from_to.first == from_to.second) && (decay_const(from_to.first) == 0.0))
     return 1.0;
-  for (vector<unsigned int>::size_type i = 0; i < part1.size(); ++i) {
-    if ((part1[i] == 36125) &&
-        (groundstate(from_to.first) == groundstate(from_to.second)) &&
-        (from_to.second % 10000 == 0)) {
-      // internal transition, rx == 'it', 36125
-      result = part2[i] * 0.01;
-      break;
-    } else if (part1[i] == 36565 || part1[i] == 1794828612) {
-      // spontaneous fission, rx == 'sf', 36565
-      // beta- & spontaneous fission, rx == 'b-sf', 1794828612
-      result += part2[i] * 0.01 * wimsdfpy_data[from_to];
-    } else if ((part1[i] != 0) && (groundstate(rxname::child(from_to.first,
-                                   part1[i], "decay")) == from_to.second)) {
-      result += part2[i] * 0.01;
+  return graph->branch_ratio(from_to.first, from_to.second);
+}
+
+
+//
+// Decay graph
+//
+pyne::DecayGraph::DecayGraph() {
+  // the products of spontaneous fission of each parent
+  std::map<int, std::vector<std::pair<int, double> > > sf_products;
+  std::map<std::pair<int, int>, double>::const_iterator sf;
+  for (sf = wimsdfpy_data.begin(); sf != wimsdfpy_data.end(); ++sf)
+    sf_products[sf->first.first].push_back(std::make_pair(sf->first.second,
+                                                          sf->second));
+
+  // children of each parent, as the decays in the rx map add up their branch
+  // ratios; an internal transition fixes the ratio of the ground state
+  std::map<std::pair<int, unsigned int>, level_data>::const_iterator it;
+  it = level_data_rx_map.begin();
+  ptr.push_back(0);
+  while (it != level_data_rx_map.end()) {
+    int nuc = it->first.first;
+    int ground = (nuc / 10000) * 10000;
+    std::map<int, std::pair<double, bool> > kids;
+    for (; it != level_data_rx_map.end() && it->first.first == nuc; ++it) {
+      unsigned int rx = it->first.second;
+      double br = it->second.branch_ratio * 0.01;
+      if (rx == 36125) {
+        // internal transition, rx == 'it'
+        kids[ground] = std::make_pair(br, true);
+      } else if (rx == 36565 || rx == 1794828612) {
+        // spontaneous fission, rx == 'sf', 36565
+        // beta- & spontaneous fission, rx == 'b-sf', 1794828612
+        std::vector<std::pair<int, double> >& prods = sf_products[nuc];
+        for (size_t i = 0; i < prods.size(); i++) {
+          std::pair<double, bool>& kid = kids[prods[i].first];
+          if (!kid.second)
+            kid.first += br * prods[i].second;
+        }
+      } else {
+        int child;
+        try {
+          child = (rxname::child(nuc, rx, "decay") / 10000) * 10000;
+        } catch (std::exception& e) {
+          continue;
+        }
+        std::pair<double, bool>& kid = kids[child];
+        if (!kid.second)
+          kid.first += br;
+      }
     }
+    parent_ids.push_back(nuc);
+    decay_consts.push_back(pyne::decay_const(nuc));
+    std::map<int, std::pair<double, bool> >::const_iterator kid;
+    for (kid = kids.begin(); kid != kids.end(); ++kid) {
+      child_ids.push_back(kid->first);
+      ratios.push_back(kid->second.first);
+    }
+    ptr.push_back(child_ids.size());
+  }
+
+  // the first level of each metastable state number of each ground state
+  std::map<int, std::map<int, int> > metas;
+  std::map<std::pair<int, double>, level_data>::const_iterator lvl;
+  for (lvl = level_data_lvl_map.begin(); lvl != level_data_lvl_map.end();
+       ++lvl) {
+    std::map<int, int>& states = metas[(lvl->second.nuc_id / 10000) * 10000];
+    if (0 == states.count(lvl->second.metastable))
+      states[lvl->second.metastable] = lvl->second.nuc_id;
+  }
+  meta_ptr.push_back(0);
+  std::map<int, std::map<int, int> >::const_iterator g;
+  for (g = metas.begin(); g != metas.end(); ++g) {
+    ground_ids.push_back(g->first);
+    std::map<int, int>::const_iterator m;
+    for (m = g->second.begin(); m != g->second.end(); ++m) {
+      meta_states.push_back(m->first);
+      meta_ids.push_back(m->second);
+    }
+    meta_ptr.push_back(meta_states.size());
   }
-  return result;
+}
+
+
+int pyne::DecayGraph::index(int nuc) const {
+  std::vector<int>::const_iterator it = std::lower_bound(parent_ids.begin(),
+                                                         parent_ids.end(), nuc);
+  if (it == parent_ids.end() || *it != nuc)
+    return -1;
+  return it - parent_ids.begin();
+}
+
+
+double pyne::DecayGraph::branch_ratio(int from_nuc, int to_nuc) const {
+  int p = index(from_nuc);
+  if (p < 0)
+    return 0.0;
+  const int* first = children(p);
+  const int* last = first + num_children(p);
+  const int* it = std::lower_bound(first, last, to_nuc);
+  if (it == last || *it != to_nuc)
+    return 0.0;
+  return branch_ratios(p)[it - first];
+}
+
+
+int pyne::DecayGraph::metastable_id(int nuc, int m) const {
+  int nostate = (nuc / 10000) * 10000;
+  std::vector<int>::const_iterator it = std::lower_bound(ground_ids.begin(),
+                                                         ground_ids.end(),
+                                                         nostate);
+  if (it == ground_ids.end() || *it != nostate)
+    return -1;
+  int g = it - ground_ids.begin();
+  for (int k = meta_ptr[g]; k < meta_ptr[g + 1]; k++)
+    if (meta_states[k] == m)
+      return meta_ids[k];
+  return -1;
+}
+
+
+std::shared_ptr<const pyne::DecayGraph> pyne::decay_graph() {
+  ensure_data<pyne::level_data>(level_data_lvl_map);
+  ensure_wimsdfpy();
+  static std::mutex mutex;
+  static std::shared_ptr<const DecayGraph> graph;
+  static size_t built_sizes[3] = {0, 0, 0};
+  size_t sizes[3] = {level_data_lvl_map.size(), level_data_rx_map.size(),
+                     wimsdfpy_data.size()};
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!graph || !std::equal(sizes, sizes + 3, built_sizes)) {
+    graph = std::make_shared<const DecayGraph>();
+    std::copy(sizes, sizes + 3, built_sizes);
+  }
+  return graph;
 }
 
 double pyne::branch_ratio(int from_nuc, int to_nuc) {
@@ -2058,6 +2526,119 @@ std::vector<std::pair<double, double> > pyne::gamma_xrays(int parent) {
   return result;
 }
 
+//
+// Gamma line index
+//
+namespace {
+struct GammaLine {
+  double energy;
+  double energy_err;
+  double intensity;
+  int parent;
+  int child;
+  bool operator<(const GammaLine& other) const {
+    if (energy != other.energy)
+      return energy < other.energy;
+    if (parent != other.parent)
+      return parent < other.parent;
+    return child > other.child;  // gammas before x-rays
+  };
+};
+}  // namespace
+
+pyne::GammaLineIndex::GammaLineIndex() : max_energy_err(0.0) {
+  std::vector<GammaLine> lines;
+  lines.reserve(gamma_data.size());
+  std::vector<int> gamma_parents;
+  std::map<std::pair<int, double>, gamma>::const_iterator it;
+  for (it = gamma_data.begin(); it != gamma_data.end(); ++it) {
+    const gamma& g = it->second;
+    GammaLine line = {g.energy, g.energy_err, g.photon_intensity,
+                      g.parent_nuc, g.child_nuc};
+    lines.push_back(line);
+    if (gamma_parents.empty() || gamma_parents.back() != g.parent_nuc)
+      gamma_parents.push_back(g.parent_nuc);
+  }
+  for (int p = 0; p < gamma_parents.size(); ++p) {
+    std::vector<std::pair<double, double> > xr = gamma_xrays(gamma_parents[p]);
+    for (int i = 0; i < xr.size(); ++i) {
+      GammaLine line = {xr[i].first, 0.0, xr[i].second, gamma_parents[p], 0};
+      lines.push_back(line);
+    }
+  }
+  std::sort(lines.begin(), lines.end());
+
+  int n = lines.size();
+  energies.resize(n);
+  energy_errs.resize(n);
+  intensities.resize(n);
+  parents.resize(n);
+  children.resize(n);
+  for (int i = 0; i < n; ++i) {
+    energies[i] = lines[i].energy;
+    energy_errs[i] = lines[i].energy_err;
+    intensities[i] = lines[i].intensity;
+    parents[i] = lines[i].parent;
+    children[i] = lines[i].child;
+    if (!isnan(energy_errs[i]) && energy_errs[i] > max_energy_err)
+      max_energy_err = energy_errs[i];
+  }
+}
+
+std::pair<int, int> pyne::GammaLineIndex::range(double emin,
+                                                double emax) const {
+  if (emax < emin)
+    std::swap(emin, emax);
+  std::vector<double>::const_iterator lo, hi;
+  lo = std::lower_bound(energies.begin(), energies.end(), emin);
+  hi = std::upper_bound(lo, energies.end(), emax);
+  return std::make_pair((int) (lo - energies.begin()),
+                        (int) (hi - energies.begin()));
+}
+
+void pyne::GammaLineIndex::match(int n, const double* energy,
+                                 const double* error, std::vector<int>& ptr,
+                                 std::vector<int>& lines,
+                                 bool line_errors) const {
+  // With line errors the window is widened by the largest of them and the
+  // lines in it are checked one by one.
+  double pad = line_errors ? max_energy_err : 0.0;
+  ptr.resize(n + 1);
+  ptr[0] = 0;
+  lines.clear();
+  for (int k = 0; k < n; ++k) {
+    double width = fabs(error[k]);
+    std::pair<int, int> r = range(energy[k] - width - pad,
+                                  energy[k] + width + pad);
+    for (int i = r.first; i < r.second; ++i) {
+      if (line_errors) {
+        double err = isnan(energy_errs[i]) ? 0.0 : energy_errs[i];
+        if (fabs(energies[i] - energy[k]) > width + err)
+          continue;
+      }
+      lines.push_back(i);
+    }
+    ptr[k + 1] = lines.size();
+  }
+}
+
+std::shared_ptr<const pyne::GammaLineIndex> pyne::gamma_line_index() {
+  ensure_data<pyne::gamma>(gamma_data);
+  ensure_data<pyne::decay>(decay_data);
+  ensure_data<pyne::atomic>(atomic_data_map);
+  static std::mutex mutex;
+  static std::shared_ptr<const GammaLineIndex> index;
+  static size_t built_sizes[3] = {0, 0, 0};
+  size_t sizes[3] = {gamma_data.size(), decay_data.size(),
+                     atomic_data_map.size()};
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!index || !std::equal(sizes, sizes + 3, built_sizes)) {
+    index = std::make_shared<const GammaLineIndex>();
+    std::copy(sizes, sizes + 3, built_sizes);
+  }
+  return index;
+}
+
 std::map<std::pair<int, double>, pyne::alpha> pyne::alpha_data;
 
 template<> void pyne::_load_data<pyne::alpha>() {
@@ -2595,13 +3176,15 @@ static void _load_simple_xs_map(std::string energy) {
   delete[] array;
 }
 
+// the energy groups load into one nested map, so lookups are serialized
+static std::mutex simple_xs_mutex;
+
+static const char* simple_xs_energies[] = {"thermal", "thermal_maxwell_ave",
+    "resonance_integral", "fourteen_MeV", "fission_spectrum_ave"};
+
 double pyne::simple_xs(int nuc, int rx_id, std::string energy) {
-  std::set<std::string> energies;
-  energies.insert("thermal");
-  energies.insert("thermal_maxwell_ave");
-  energies.insert("resonance_integral");
-  energies.insert("fourteen_MeV");
-  energies.insert("fission_spectrum_ave");
+  std::lock_guard<std::mutex> lock(simple_xs_mutex);
+  std::set<std::string> energies(simple_xs_energies, simple_xs_energies + 5);
 
   if (energies.count(energy) == 0) {
     throw InvalidSimpleXS("Energy '" + energy +
@@ -2630,3 +3213,499 @@ double pyne::simple_xs(std::string nuc, int rx, std::string energy) {
 double pyne::simple_xs(std::string nuc, std::string rx, std::string energy) {
   return pyne::simple_xs(nucname::id(nuc), rxname::id(rx), energy);
 }
+
+
+//
+// Preloading
+//
+
+static void _preload_simple_xs() {
+  std::lock_guard<std::mutex> lock(simple_xs_mutex);
+  for (int i = 0; i < 5; i++)
+    if (pyne::simple_xs_map.count(simple_xs_energies[i]) == 0)
+      _load_simple_xs_map(simple_xs_energies[i]);
+}
+
+static void _preload_table(const std::string& table) {
+  using namespace pyne;
+  if (table == "atomic_mass") {
+    ensure_atomic_mass();
+  } else if (table == "q_val") {
+    ensure_q_val();
+  } else if (table == "dose") {
+    for (int source = 0; source < 3; source++)
+      dose_source_map(source);
+  } else if (table == "scattering_lengths") {
+    ensure_scattering_lengths();
+  } else if (table == "wimsd_fpy") {
+    ensure_wimsdfpy();
+  } else if (table == "nds_fpy") {
+    ensure_ndsfpy();
+  } else if (table == "atomic") {
+    ensure_data<pyne::atomic>(atomic_data_map);
+  } else if (table == "level") {
+    ensure_data<pyne::level_data>(level_data_lvl_map);
+  } else if (table == "decay") {
+    ensure_data<pyne::decay>(decay_data);
+  } else if (table == "gamma") {
+    ensure_data<pyne::gamma>(gamma_data);
+  } else if (table == "alpha") {
+    ensure_data<pyne::alpha>(alpha_data);
+  } else if (table == "beta") {
+    ensure_data<pyne::beta>(beta_data);
+  } else if (table == "ecbp") {
+    ensure_data<pyne::ecbp>(ecbp_data);
+  } else if (table == "simple_xs") {
+    _preload_simple_xs();
+  }
+}
+
+void pyne::preload_nuc_data(const std::vector<std::string>& tables) {
+  static const char* all_tables[] = {"atomic_mass", "q_val", "dose",
+      "scattering_lengths", "wimsd_fpy", "nds_fpy", "atomic", "level",
+      "decay", "gamma", "alpha", "beta", "ecbp", "simple_xs"};
+  std::set<std::string> known(all_tables, all_tables + 14);
+  std::vector<std::string> todo = tables;
+  if (todo.empty())
+    todo.assign(all_tables, all_tables + 14);
+  for (int i = 0; i < todo.size(); i++)
+    if (known.count(todo[i]) == 0)
+      throw std::invalid_argument("unknown nuc_data table '" + todo[i] +
+                                  "' to preload");
+
+#ifdef H5_HAVE_THREADSAFE
+  // one loader thread per table, the first failure is rethrown
+  std::vector<std::exception_ptr> errors(todo.size());
+  std::vector<std::thread> threads;
+  for (int i = 0; i < todo.size(); i++) {
+    threads.push_back(std::thread([&todo, &errors, i]() {
+      try {
+        _preload_table(todo[i]);
+      } catch (...) {
+        errors[i] = std::current_exception();
+      }
+    }));
+  }
+  for (int i = 0; i < threads.size(); i++)
+    threads[i].join();
+  for (int i = 0; i < errors.size(); i++)
+    if (errors[i])
+      std::rethrow_exception(errors[i]);
+#else
+  // HDF5 is not thread safe, so the tables load one after another
+  for (int i = 0; i < todo.size(); i++)
+    _preload_table(todo[i]);
+#endif
+}
+
+
+//
+// Snapshots
+//
+
+namespace {
+const char snapshot_magic[8] = {'P', 'Y', 'N', 'E', 'S', 'N', 'A', 'P'};
+const uint32_t snapshot_byte_order = 0x01020304;
+
+// Snapshot file header, followed by one entry per table
+struct SnapshotHeader {
+  char magic[8];
+  uint32_t byte_order;
+  uint32_t version;
+  uint32_t ntables;
+  uint32_t reserved;
+  char checksum[40];  ///< data_checksums["/decay"] of the source data
+};
+
+struct SnapshotEntry {
+  char name[16];
+  uint64_t record_size;
+  uint64_t count;
+  uint64_t offset;  ///< from the start of the file, aligned to 8 bytes
+};
+
+// Map keys of the records, as the HDF5 loaders build them
+int snapshot_key(const pyne::atomic& r) {return r.z;}
+std::pair<int, int> snapshot_key(const pyne::decay& r) {
+  return std::make_pair(r.parent, r.child);
+}
+std::pair<int, double> snapshot_key(const pyne::gamma& r) {
+  return std::make_pair(r.parent_nuc, r.energy);
+}
+std::pair<int, double> snapshot_key(const pyne::alpha& r) {
+  return std::make_pair(r.from_nuc, r.energy);
+}
+std::pair<int, double> snapshot_key(const pyne::beta& r) {
+  return std::make_pair(r.from_nuc, r.avg_energy);
+}
+std::pair<int, double> snapshot_key(const pyne::ecbp& r) {
+  return std::make_pair(r.from_nuc, r.avg_energy);
+}
+
+void snapshot_name(char* dest, const std::string& name) {
+  std::memset(dest, 0, 16);
+  std::strncpy(dest, name.c_str(), 15);
+}
+
+template <typename K, typename T>
+void snapshot_write(std::ofstream& f, const std::map<K, T>& m) {
+  typename std::map<K, T>::const_iterator it;
+  for (it = m.begin(); it != m.end(); ++it)
+    f.write(reinterpret_cast<const char*>(&it->second), sizeof(T));
+}
+
+// The records are sorted by key, so every insert is hinted at the end.
+template <typename K, typename T>
+void snapshot_fill(std::map<K, T>& m, const T* records, size_t n) {
+  for (size_t i = 0; i < n; i++)
+    m.insert(m.end(), std::make_pair(snapshot_key(records[i]), records[i]));
+}
+}  // namespace
+
+pyne::NucDataSnapshot::NucDataSnapshot(std::string filename)
+    : file(filename) {
+  const char* base = file.data();
+  size_t len = file.size();
+  if (len < sizeof(SnapshotHeader))
+    throw std::runtime_error("nuc_data snapshot " + filename +
+                             " is truncated");
+  SnapshotHeader header;
+  std::memcpy(&header, base, sizeof(header));
+  if (std::memcmp(header.magic, snapshot_magic, 8) != 0)
+    throw std::runtime_error(filename + " is not a nuc_data snapshot");
+  if (header.byte_order != snapshot_byte_order ||
+      header.version != NUC_DATA_SNAPSHOT_VERSION)
+    throw std::runtime_error("nuc_data snapshot " + filename +
+                             " was written by an incompatible build");
+  header.checksum[39] = '\0';
+  checksum_ = header.checksum;
+
+  size_t entries_end = sizeof(header) + header.ntables * sizeof(SnapshotEntry);
+  if (len < entries_end)
+    throw std::runtime_error("nuc_data snapshot " + filename +
+                             " is truncated");
+  for (uint32_t i = 0; i < header.ntables; i++) {
+    SnapshotEntry entry;
+    std::memcpy(&entry, base + sizeof(header) + i * sizeof(entry),
+                sizeof(entry));
+    entry.name[15] = '\0';
+    if (entry.offset % 8 != 0 || entry.offset > len ||
+        entry.count * entry.record_size > len - entry.offset)
+      throw std::runtime_error("nuc_data snapshot " + filename +
+                               " is truncated");
+    Table t = {base + entry.offset, (size_t) entry.count,
+               (size_t) entry.record_size};
+    tables[entry.name] = t;
+  }
+}
+
+bool pyne::NucDataSnapshot::is_current() const {
+  std::map<std::string, std::string>::const_iterator it =
+      data_checksums.find("/decay");
+  return it != data_checksums.end() && it->second == checksum_;
+}
+
+const void* pyne::NucDataSnapshot::records(const std::string& table,
+                                           size_t record_size,
+                                           size_t& n) const {
+  std::map<std::string, Table>::const_iterator it = tables.find(table);
+  if (it == tables.end())
+    throw std::out_of_range("nuc_data snapshot has no table " + table);
+  if (it->second.record_size != record_size)
+    throw std::runtime_error("nuc_data snapshot table " + table +
+                             " has records of a different layout");
+  n = it->second.count;
+  return it->second.data;
+}
+
+void pyne::NucDataSnapshot::load() const {
+  size_t n;
+  const atomic* atomics = view<atomic>("atomic", n);
+  data_guard<atomic>().load([&]() {
+    if (atomic_data_map.empty())
+      snapshot_fill(atomic_data_map, atomics, n);
+  });
+
+  // level records hold the level map entries, then the reaction entries
+  const level_data* levels = view<level_data>("level", n);
+  data_guard<level_data>().load([&]() {
+    if (!level_data_lvl_map.empty() || !level_data_rx_map.empty())
+      return;
+    for (size_t i = 0; i < n; i++) {
+      const level_data& r = levels[i];
+      if (r.rx_id == 0)
+        level_data_lvl_map.insert(level_data_lvl_map.end(), std::make_pair(
+            std::make_pair(r.nuc_id, r.level), r));
+      else
+        level_data_rx_map.insert(level_data_rx_map.end(), std::make_pair(
+            std::make_pair(r.nuc_id, r.rx_id), r));
+    }
+  });
+
+  const decay* decays = view<decay>("decay", n);
+  data_guard<decay>().load([&]() {
+    if (decay_data.empty())
+      snapshot_fill(decay_data, decays, n);
+  });
+  const gamma* gammas = view<gamma>("gamma", n);
+  data_guard<gamma>().load([&]() {
+    if (gamma_data.empty())
+      snapshot_fill(gamma_data, gammas, n);
+  });
+  const alpha* alphas = view<alpha>("alpha", n);
+  data_guard<alpha>().load([&]() {
+    if (alpha_data.empty())
+      snapshot_fill(alpha_data, alphas, n);
+  });
+  const beta* betas = view<beta>("beta", n);
+  data_guard<beta>().load([&]() {
+    if (beta_data.empty())
+      snapshot_fill(beta_data, betas, n);
+  });
+  const ecbp* ecbps = view<ecbp>("ecbp", n);
+  data_guard<ecbp>().load([&]() {
+    if (ecbp_data.empty())
+      snapshot_fill(ecbp_data, ecbps, n);
+  });
+}
+
+void pyne::write_nuc_data_snapshot(std::string filename) {
+  static const char* decay_tables[] = {"atomic", "level", "decay", "gamma",
+                                       "alpha", "beta", "ecbp"};
+  preload_nuc_data(std::vector<std::string>(decay_tables, decay_tables + 7));
+
+  SnapshotHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, snapshot_magic, 8);
+  header.byte_order = snapshot_byte_order;
+  header.version = NUC_DATA_SNAPSHOT_VERSION;
+  header.ntables = 7;
+  std::strncpy(header.checksum, data_checksums["/decay"].c_str(), 39);
+
+  // record layout of each table, in file order
+  size_t sizes[7] = {sizeof(atomic), sizeof(level_data), sizeof(decay),
+                     sizeof(gamma), sizeof(alpha), sizeof(beta), sizeof(ecbp)};
+  size_t counts[7] = {atomic_data_map.size(),
+                      level_data_lvl_map.size() + level_data_rx_map.size(),
+                      decay_data.size(), gamma_data.size(), alpha_data.size(),
+                      beta_data.size(), ecbp_data.size()};
+  SnapshotEntry entries[7];
+  uint64_t offset = sizeof(header) + sizeof(entries);
+  for (int i = 0; i < 7; i++) {
+    offset = (offset + 7) / 8 * 8;
+    snapshot_name(entries[i].name, decay_tables[i]);
+    entries[i].record_size = sizes[i];
+    entries[i].count = counts[i];
+    entries[i].offset = offset;
+    offset += sizes[i] * counts[i];
+  }
+
+  // write to a temporary file first, so readers never map a partial file
+  std::string tmpname = filename + ".tmp";
+  std::ofstream f(tmpname.c_str(), std::ios::binary | std::ios::trunc);
+  if (!f)
+    throw FileNotFound(tmpname);
+  f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  f.write(reinterpret_cast<const char*>(entries), sizeof(entries));
+  for (int i = 0; i < 7; i++) {
+    static const char zeros[8] = {0};
+    f.write(zeros, entries[i].offset - f.tellp());
+    switch (i) {
+      case 0: snapshot_write(f, atomic_data_map); break;
+      case 1:
+        snapshot_write(f, level_data_lvl_map);
+        snapshot_write(f, level_data_rx_map);
+        break;
+      case 2: snapshot_write(f, decay_data); break;
+      case 3: snapshot_write(f, gamma_data); break;
+      case 4: snapshot_write(f, alpha_data); break;
+      case 5: snapshot_write(f, beta_data); break;
+      case 6: snapshot_write(f, ecbp_data); break;
+    }
+  }
+  f.close();
+  if (!f || std::rename(tmpname.c_str(), filename.c_str()) != 0) {
+    std::remove(tmpname.c_str());
+    throw std::runtime_error("could not write nuc_data snapshot " + filename);
+  }
+}
+
+bool pyne::load_nuc_data_snapshot(std::string filename, bool create) {
+  if (file_exists(filename)) {
+    try {
+      NucDataSnapshot snapshot(filename);
+      if (snapshot.is_current()) {
+        snapshot.load();
+        return true;
+      }
+    } catch (std::runtime_error& e) {
+      // an unusable snapshot is replaced below
+    }
+  }
+  if (create)
+    write_nuc_data_snapshot(filename);
+  return false;
+}
+
+
+//
+// Nuclide Property Table
+//
+
+pyne::NucPropertyTable pyne::nuc_property_table;
+
+pyne::NucPropertyTable::Index::Index(unsigned int bits)
+    : bits(bits), nucs(new int[1u << bits]),
+      ords(new std::atomic<int>[1u << bits]) {
+  for (unsigned int i = 0; i < (1u << bits); i++)
+    ords[i].store(-1, std::memory_order_relaxed);
+}
+
+int pyne::NucPropertyTable::Index::find(int nuc) const {
+  // Fibonacci hashing as in MissCache, the index is never more than half full
+  unsigned int mask = (1u << bits) - 1;
+  unsigned int i = ((uint32_t) nuc * UINT32_C(2654435769)) >> (32 - bits);
+  for (;; i = (i + 1) & mask) {
+    int ord = ords[i].load(std::memory_order_acquire);
+    if (ord < 0)
+      return -1;
+    if (nucs[i] == nuc)
+      return ord;
+  }
+}
+
+void pyne::NucPropertyTable::Index::insert(int nuc, int ord) {
+  unsigned int mask = (1u << bits) - 1;
+  unsigned int i = ((uint32_t) nuc * UINT32_C(2654435769)) >> (32 - bits);
+  while (ords[i].load(std::memory_order_relaxed) >= 0)
+    i = (i + 1) & mask;
+  nucs[i] = nuc;
+  ords[i].store(ord, std::memory_order_release);
+}
+
+pyne::NucPropertyTable::NucPropertyTable() : index(NULL), count(0) {
+  for (int c = 0; c < MAX_CHUNKS; c++)
+    chunks[c].store(NULL, std::memory_order_relaxed);
+  clear();
+}
+
+pyne::NucPropertyTable::~NucPropertyTable() {
+  for (int c = 0; c < MAX_CHUNKS; c++)
+    delete[] chunks[c].load(std::memory_order_relaxed);
+}
+
+int pyne::NucPropertyTable::ordinal(int nuc) {
+  int ord = index.load(std::memory_order_acquire)->find(nuc);
+  if (0 <= ord)
+    return ord;
+
+  std::lock_guard<std::mutex> lock(insert_mutex);
+  Index* idx = index.load(std::memory_order_relaxed);
+  ord = idx->find(nuc);
+  if (0 <= ord)
+    return ord;
+  ord = count.load(std::memory_order_relaxed);
+  if (MAX_CHUNKS <= (ord >> CHUNK_BITS))
+    throw std::length_error("nuclide property table is full");
+  Row* chunk = chunks[ord >> CHUNK_BITS].load(std::memory_order_relaxed);
+  if (chunk == NULL) {
+    chunk = new Row[1 << CHUNK_BITS];
+    chunks[ord >> CHUNK_BITS].store(chunk, std::memory_order_release);
+  }
+  Row& r = chunk[ord & ((1 << CHUNK_BITS) - 1)];
+  double nan = std::numeric_limits<double>::quiet_NaN();
+  r.nucid = nuc;
+  r.mass.store(nan, std::memory_order_relaxed);
+  r.decay_const.store(nan, std::memory_order_relaxed);
+  r.q_val.store(nan, std::memory_order_relaxed);
+  r.metastable_decay_const.store(nan, std::memory_order_relaxed);
+  for (int i = 0; i < 12; i++)
+    r.doses[i].store(nan, std::memory_order_relaxed);
+
+  if ((1u << idx->bits) < 2u * (ord + 1)) {
+    // readers of the full index keep using it, and come here for what it lacks
+    Index* grown = new Index(idx->bits + 1);
+    indexes.push_back(std::unique_ptr<Index>(grown));
+    for (int i = 0; i < ord; i++)
+      grown->insert(row(i).nucid, i);
+    grown->insert(nuc, ord);
+    index.store(grown, std::memory_order_release);
+  } else {
+    idx->insert(nuc, ord);
+  }
+  count.store(ord + 1, std::memory_order_release);
+  return ord;
+}
+
+double pyne::NucPropertyTable::lookup(std::atomic<double>& v,
+                                      double (*f)(int), int nuc) {
+  double x = v.load(std::memory_order_relaxed);
+  if (isnan(x)) {
+    x = f(nuc);
+    v.store(x, std::memory_order_relaxed);
+  }
+  return x;
+}
+
+double pyne::NucPropertyTable::atomic_mass(int ord) {
+  Row& r = row(ord);
+  return lookup(r.mass, pyne::atomic_mass, r.nucid);
+}
+
+double pyne::NucPropertyTable::decay_const(int ord) {
+  Row& r = row(ord);
+  return lookup(r.decay_const, pyne::decay_const, r.nucid);
+}
+
+double pyne::NucPropertyTable::q_val(int ord) {
+  Row& r = row(ord);
+  return lookup(r.q_val, pyne::q_val, r.nucid);
+}
+
+double pyne::NucPropertyTable::metastable_decay_const(int ord) {
+  Row& r = row(ord);
+  double v = r.metastable_decay_const.load(std::memory_order_relaxed);
+  if (isnan(v)) {
+    v = pyne::decay_const(pyne::metastable_id(r.nucid, nucname::snum(r.nucid)));
+    r.metastable_decay_const.store(v, std::memory_order_relaxed);
+  }
+  return v;
+}
+
+double pyne::NucPropertyTable::dose(int ord, DoseKind kind, int source) {
+  // any other source falls back to EPA, as in dose_source_map()
+  if (source != 1 && source != 2)
+    source = 0;
+  Row& r = row(ord);
+  std::atomic<double>& slot = r.doses[3*kind + source];
+  double v = slot.load(std::memory_order_relaxed);
+  if (isnan(v)) {
+    switch (kind) {
+      case EXT_AIR_DOSE:
+        v = pyne::ext_air_dose(r.nucid, source);
+        break;
+      case EXT_SOIL_DOSE:
+        v = pyne::ext_soil_dose(r.nucid, source);
+        break;
+      case INGEST_DOSE:
+        v = pyne::ingest_dose(r.nucid, source);
+        break;
+      case INHALE_DOSE:
+        v = pyne::inhale_dose(r.nucid, source);
+        break;
+    }
+    slot.store(v, std::memory_order_relaxed);
+  }
+  return v;
+}
+
+void pyne::NucPropertyTable::clear() {
+  for (int c = 0; c < MAX_CHUNKS; c++) {
+    delete[] chunks[c].load(std::memory_order_relaxed);
+    chunks[c].store(NULL, std::memory_order_relaxed);
+  }
+  indexes.clear();
+  indexes.push_back(std::unique_ptr<Index>(new Index(10)));
+  index.store(indexes.back().get(), std::memory_order_release);
+  count.store(0, std::memory_order_release);
+}
@@ -5,11 +5,16 @@
 
 #ifndef PYNE_TEWK4A7VOFFLHDDXD5ZZ7KPXEQ
 #define PYNE_TEWK4A7VOFFLHDDXD5ZZ7KPXEQ
+#include <atomic>
 #include <iostream>
 #include <string>
 #include <utility>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <unordered_map>
+#include <vector>
 #include <limits>
 #include <exception>
 #include <stdlib.h>
@@ -292,7 +297,7 @@ namespace pyne
   /// This function works by first checking the fission yield data.  If this is
   /// empty it loads the data from disk. If the parent/child nuclide pair
   /// is still not found, then the process is assumed to be impossible
-  /// and 0.0 is returned. The data source is determined by the type value
+  /// and 0.0 is returned, without changing the data. The data source is determined by the type value
   /// as follows: 0 WIMS, 1 thermal NDS, 2 fast NDS, 3 14 MeV NDS.
   /// negative type values return error for that data type.
   double fpyield(std::pair<int, int> from_to, int source, bool get_error);
@@ -303,6 +308,52 @@ namespace pyne
   /// Returns the fission product yield for a parent/child nuclide pair
   double fpyield(std::string from_nuc, std::string to_nuc, int source, bool get_error);
 
+  /// The fission product yields of one source as a CSR matrix, with a row per
+  /// fissioning nuclide and a column per fission product. Rows and columns
+  /// are compact indices into the sorted parent and product ids. The matrix is
+  /// built once from the yield data and only read afterwards, so it may be
+  /// shared by threads.
+  class FissionYieldMatrix {
+   public:
+    /// Builds the matrix of \a source, as fpyield() numbers them, with the
+    /// yields or, if \a get_error, their errors.
+    FissionYieldMatrix(int source, bool get_error=false);
+    /// Returns the number of fissioning nuclides.
+    int num_parents() const {return (int) parent_ids.size();};
+    /// Returns the number of fission products.
+    int num_products() const {return (int) product_ids.size();};
+    /// Returns the sorted ids of the fissioning nuclides.
+    const std::vector<int>& parents() const {return parent_ids;};
+    /// Returns the sorted ids of the fission products.
+    const std::vector<int>& products() const {return product_ids;};
+    /// Returns the row of nuclide \a nuc, or -1 if it has no yields.
+    int parent_index(int nuc) const;
+    /// Returns the column of nuclide \a nuc, or -1 if it is no product.
+    int product_index(int nuc) const;
+    /// Returns the number of products in row \a p.
+    int row_size(int p) const {return ptr[p + 1] - ptr[p];};
+    /// Returns the product columns of row \a p, in increasing order.
+    const int* row_products(int p) const {return cols.data() + ptr[p];};
+    /// Returns the yields of row \a p, matching row_products().
+    const double* row_yields(int p) const {return vals.data() + ptr[p];};
+    /// Returns the yield of product column \a c from parent row \a p.
+    double operator()(int p, int c) const;
+    /// Returns the yield of \a to_nuc from \a from_nuc in id form, 0.0 for
+    /// pairs without data.
+    double yield(int from_nuc, int to_nuc) const;
+
+   private:
+    std::vector<int> parent_ids;  ///< id of each row
+    std::vector<int> product_ids;  ///< id of each column
+    std::vector<int> ptr;  ///< start of each row in cols and vals
+    std::vector<int> cols;  ///< product column of each yield
+    std::vector<double> vals;  ///< the nonzero yields
+  };
+
+  /// Returns the shared yield matrix of \a source, 0 WIMS, 1 thermal NDS,
+  /// 2 fast NDS and 3 14 MeV NDS, built on first use.
+  const FissionYieldMatrix& fpyield_matrix(int source, bool get_error=false);
+
   /// \}
 
 
@@ -479,6 +530,55 @@ namespace pyne
   /// Returns the decay constant for a nuclide \a nuc.
   std::set<int> decay_children(std::string nuc);
 
+  /// The decay graph of the level data, built once: the decay constant of
+  /// each decaying nuclide, its children with their branch ratios in CSR
+  /// form, and a table of the metastable states of each ground state.
+  /// decay_children(), branch_ratio() and metastable_id() are views of it.
+  class DecayGraph {
+   public:
+    /// Builds the graph from the level data and the WIMSD fission yields,
+    /// which must be loaded. A decay whose child rxname cannot resolve is
+    /// left out.
+    DecayGraph();
+    /// Returns the number of decaying nuclides.
+    int size() const {return (int) parent_ids.size();};
+    /// Returns the sorted ids of the decaying nuclides.
+    const std::vector<int>& nucs() const {return parent_ids;};
+    /// Returns the index of nuclide \a nuc, or -1 if it does not decay.
+    int index(int nuc) const;
+    /// Returns the decay constant of nuclide index \a p [1/s].
+    double decay_const(int p) const {return decay_consts[p];};
+    /// Returns the number of children of nuclide index \a p.
+    int num_children(int p) const {return ptr[p + 1] - ptr[p];};
+    /// Returns the sorted ids of the children of nuclide index \a p.
+    const int* children(int p) const {return child_ids.data() + ptr[p];};
+    /// Returns the branch ratios of nuclide index \a p, matching children()
+    /// [fraction].
+    const double* branch_ratios(int p) const {return ratios.data() + ptr[p];};
+    /// Returns the branch ratio of \a to_nuc from \a from_nuc, 0.0 if it is
+    /// no decay child [fraction].
+    double branch_ratio(int from_nuc, int to_nuc) const;
+    /// Returns the id of metastable state \a m of \a nuc, or -1, see
+    /// pyne::metastable_id().
+    int metastable_id(int nuc, int m) const;
+
+   private:
+    std::vector<int> parent_ids;  ///< id of each decaying nuclide
+    std::vector<double> decay_consts;  ///< decay constant of each [1/s]
+    std::vector<int> ptr;  ///< start of the children of each
+    std::vector<int> child_ids;  ///< child ids
+    std::vector<double> ratios;  ///< branch ratio of each child [fraction]
+    std::vector<int> ground_ids;  ///< sorted ground states with metastables
+    std::vector<int> meta_ptr;  ///< start of the states of each ground state
+    std::vector<int> meta_states;  ///< metastable state numbers
+    std::vector<int> meta_ids;  ///< id of each metastable state
+  };
+
+  /// Returns the decay graph of the level data, loading the data if needed.
+  /// The graph is built on first use and rebuilt only when the level or
+  /// fission yield maps have changed size, e.g. after being filled by hand.
+  std::shared_ptr<const DecayGraph> decay_graph();
+
   /// a struct matching the '/decay/decays' table in nuc_data.h5.
   typedef struct decay{
     int parent; ///< state id of decay parent
@@ -569,6 +669,60 @@ namespace pyne
   //given parent
   std::vector<std::pair<double, double> > gamma_xrays(int parent);
 
+  /// Energy sorted index of all gamma and x-ray lines, for matching many
+  /// spectrum peaks at once. The gamma lines are those of gamma_data, with
+  /// their photon intensities, and the x-ray lines those of gamma_xrays() for
+  /// each gamma parent. Lines of equal energy are ordered by parent.
+  class GammaLineIndex {
+   public:
+    /// Builds the index from the gamma, decay and atomic data, which must be
+    /// loaded.
+    GammaLineIndex();
+    /// Returns the number of lines.
+    int size() const {return (int) energies.size();};
+    /// Returns the energy of line \a i [keV].
+    double energy(int i) const {return energies[i];};
+    /// Returns the energy error of line \a i, 0.0 for x-rays [keV].
+    double energy_err(int i) const {return energy_errs[i];};
+    /// Returns the intensity of line \a i.
+    double intensity(int i) const {return intensities[i];};
+    /// Returns the state id of the parent of line \a i.
+    int parent(int i) const {return parents[i];};
+    /// Returns the id of the child of line \a i, 0 for x-rays.
+    int child(int i) const {return children[i];};
+    /// Returns true if line \a i is an x-ray.
+    bool is_xray(int i) const {return children[i] == 0;};
+    /// Returns the first line with an energy of at least \a emin and the one
+    /// past the last line with an energy of at most \a emax.
+    std::pair<int, int> range(double emin, double emax) const;
+    /// Finds the candidate lines of \a n peaks in compressed sparse row form:
+    /// those of peak k are lines[ptr[k]] to lines[ptr[k + 1] - 1], in energy
+    /// order.
+    /// \param n The number of peaks
+    /// \param energy The n peak energies [keV]
+    /// \param error The n half widths of the peak windows [keV]
+    /// \param ptr The n + 1 starts of the candidates of each peak, returned
+    /// \param lines The candidate line indices, returned
+    /// \param line_errors If true a line also matches when its own energy
+    ///        error brings it within the window.
+    void match(int n, const double* energy, const double* error,
+               std::vector<int>& ptr, std::vector<int>& lines,
+               bool line_errors=false) const;
+
+   private:
+    std::vector<double> energies;  ///< sorted energy of each line [keV]
+    std::vector<double> energy_errs;  ///< energy error of each line [keV]
+    std::vector<double> intensities;  ///< intensity of each line
+    std::vector<int> parents;  ///< parent of each line
+    std::vector<int> children;  ///< child of each line, 0 for x-rays
+    double max_energy_err;  ///< largest of energy_errs [keV]
+  };
+
+  /// Returns the gamma line index, loading the data if needed. It is built
+  /// on first use and rebuilt only when the gamma, decay or atomic data maps
+  /// have changed size.
+  std::shared_ptr<const GammaLineIndex> gamma_line_index();
+
   /// Returns a list of energies and intensities normalized to branching ratios
   std::vector<std::pair<double, double> > gammas(int parent_state_id);
   std::vector<std::pair<double, double> > alphas(int parent_state_id);
@@ -712,6 +866,180 @@ namespace pyne
     std::string msg_;
   };
 
+
+  /// \name Preloading
+  /// \{
+
+  /// Loads nuc_data tables ahead of their first lookup, so that services can
+  /// pay the loading cost at startup. Each table is loaded at most once, and
+  /// the lookup functions may be called from several threads. The table
+  /// names are "atomic_mass", "q_val", "dose", "scattering_lengths",
+  /// "wimsd_fpy", "nds_fpy", "atomic", "level", "decay", "gamma", "alpha",
+  /// "beta", "ecbp", and "simple_xs"; an empty list loads all of them. When
+  /// HDF5 is built thread safe the tables load in parallel.
+  /// \param tables names of the tables to load
+  void preload_nuc_data(const std::vector<std::string>& tables =
+                        std::vector<std::string>());
+
+  /// Empties the caches of the values that atomic_mass(), natural_abund(),
+  /// q_val(), gamma_frac(), b_coherent() and b_incoherent() estimate for
+  /// nuclides missing from their data maps. The maps are only read by these
+  /// lookups, and the estimates are kept apart in lock-free caches, so call
+  /// this after changing the maps. It also empties nuc_property_table, which
+  /// caches the results of these lookups. It must not run concurrently with
+  /// lookups.
+  void clear_miss_caches();
+  /// \}
+
+  /// \name Snapshots
+  /// \{
+
+  /// Version of the nuc_data snapshot file format.
+  const unsigned int NUC_DATA_SNAPSHOT_VERSION = 1;
+
+  /// Read-only view of a nuc_data snapshot file. A snapshot holds the atomic,
+  /// level, decay, gamma, alpha, beta, and ecbp tables as flat arrays of their
+  /// record structs, sorted by the keys of the corresponding data maps. The
+  /// file is memory mapped, so opening it costs no parsing and the record
+  /// arrays may be binary searched in place. Snapshots are only readable on
+  /// builds with the same struct layout and byte order as the writer.
+  class NucDataSnapshot {
+  public:
+    /// Maps the snapshot \a filename and checks its header. Throws
+    /// FileNotFound if it can't be opened and std::runtime_error if it is
+    /// not a valid snapshot for this build.
+    NucDataSnapshot(std::string filename);
+    /// Returns true if the snapshot was taken from the nuc_data whose
+    /// checksum is in data_checksums.
+    bool is_current() const;
+    /// Returns the records of \a table in place and stores their number in
+    /// \a n. Throws std::out_of_range if the table is not in the snapshot.
+    template <typename T> const T* view(const std::string& table,
+                                        size_t& n) const {
+      return static_cast<const T*>(records(table, sizeof(T), n));
+    };
+    /// Fills the data maps that have not been loaded yet from the snapshot,
+    /// without reading nuc_data.h5.
+    void load() const;
+  private:
+    NucDataSnapshot(const NucDataSnapshot&);
+    NucDataSnapshot& operator=(const NucDataSnapshot&);
+    const void* records(const std::string& table, size_t record_size,
+                        size_t& n) const;
+    /// Location of one table in the file
+    struct Table {
+      const char* data;
+      size_t count;
+      size_t record_size;
+    };
+    MappedFile file; ///< Snapshot contents
+    std::map<std::string, Table> tables; ///< Tables by name
+    std::string checksum_; ///< Checksum of the source nuc_data
+  };
+
+  /// Loads the decay data tables from nuc_data.h5 if needed and writes them
+  /// to the snapshot \a filename.
+  void write_nuc_data_snapshot(std::string filename);
+  /// Fills the decay data maps from the snapshot \a filename. Returns false
+  /// if the snapshot is missing, unreadable, or taken from other nuc_data,
+  /// in which case a new snapshot is written when \a create is true.
+  bool load_nuc_data_snapshot(std::string filename, bool create=true);
+  /// \}
+
+  /// \name Nuclide Property Table
+  /// \{
+
+  /// Kinds of dose factors in the nuclide property table.
+  enum DoseKind {EXT_AIR_DOSE, EXT_SOIL_DOSE, INGEST_DOSE, INHALE_DOSE};
+
+  /// \brief Dense table of the per-nuclide properties used in Material loops.
+  ///
+  /// Each nuclide is resolved once to a compact ordinal, after which its
+  /// properties are read from contiguous arrays. A property is looked up through
+  /// the functions above the first time it is asked for, so the table caches
+  /// whatever those return, and only the data that is used gets loaded.
+  ///
+  /// All members but clear() may be called from several threads at once.
+  /// Looking up a nuclide that is already in the table and reading its
+  /// properties take no lock: the ordinal index is append-only and grown by a
+  /// copy, the rows are never moved, and a property that two threads fill at
+  /// once gets the same value from both. Only adding a nuclide takes a lock.
+  /// clear() must not run concurrently with any other call, and is also run
+  /// by clear_miss_caches(); call either after changing the data maps.
+  class NucPropertyTable {
+   public:
+    NucPropertyTable();
+    ~NucPropertyTable();
+    /// Returns the ordinal of a nuclide, adding it to the table if needed.
+    int ordinal(int nuc);
+    /// Returns the number of nuclides in the table.
+    int size() const {return count.load(std::memory_order_acquire);};
+    /// Returns the nuclide id of an ordinal.
+    int nucid(int ord) const {return row(ord).nucid;};
+    /// Returns the atomic mass, see pyne::atomic_mass() [amu]
+    double atomic_mass(int ord);
+    /// Returns the decay constant, see pyne::decay_const() [1/s]
+    double decay_const(int ord);
+    /// Returns the Q value, see pyne::q_val() [MeV]
+    double q_val(int ord);
+    /// Returns the decay constant of the metastable state given by the state
+    /// number of the nuclide [1/s]
+    double metastable_decay_const(int ord);
+    /// Returns a dose factor, see pyne::ext_air_dose() and friends.
+    /// \param ord The ordinal of the nuclide
+    /// \param kind The kind of dose factor
+    /// \param source The dose factor source, 0 EPA, 1 DOE, 2 GENII
+    double dose(int ord, DoseKind kind, int source);
+    /// Empties the table.
+    void clear();
+
+   private:
+    NucPropertyTable(const NucPropertyTable&);
+    NucPropertyTable& operator=(const NucPropertyTable&);
+
+    /// Properties of one nuclide, NaN until looked up
+    struct Row {
+      int nucid;
+      std::atomic<double> mass;
+      std::atomic<double> decay_const;
+      std::atomic<double> q_val;
+      std::atomic<double> metastable_decay_const;
+      /// Dose factors, 4 kinds times 3 sources
+      std::atomic<double> doses[12];
+    };
+    /// Open addressed index from nuclide ids to ordinals. A slot is written
+    /// once, its ordinal last, so readers take a negative ordinal as empty.
+    struct Index {
+      explicit Index(unsigned int bits);
+      unsigned int bits;
+      std::unique_ptr<int[]> nucs;
+      std::unique_ptr<std::atomic<int>[]> ords;
+      int find(int nuc) const;
+      void insert(int nuc, int ord);
+    };
+    static const int CHUNK_BITS = 8;  ///< rows per chunk is 2^CHUNK_BITS
+    static const int MAX_CHUNKS = 4096;
+    const Row& row(int ord) const {
+      return chunks[ord >> CHUNK_BITS].load(std::memory_order_acquire)
+          [ord & ((1 << CHUNK_BITS) - 1)];
+    };
+    Row& row(int ord) {
+      return chunks[ord >> CHUNK_BITS].load(std::memory_order_acquire)
+          [ord & ((1 << CHUNK_BITS) - 1)];
+    };
+    double lookup(std::atomic<double>& v, double (*f)(int), int nuc);
+
+    std::mutex insert_mutex;  ///< Held while adding a nuclide
+    std::atomic<Index*> index;  ///< Current index, its older copies are
+    std::vector<std::unique_ptr<Index> > indexes;  ///< kept until clear()
+    std::atomic<int> count;  ///< Number of nuclides
+    std::atomic<Row*> chunks[MAX_CHUNKS];  ///< Rows, allocated a chunk at a time
+  };
+
+  /// The nuclide property table shared by the Material methods.
+  extern NucPropertyTable nuc_property_table;
+  /// \}
+
 } // namespace pyne
 
 #endif
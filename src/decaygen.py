@@ -1,6 +1,7 @@
 #! /usr/bin/env python
 """This file generates a static C++ decayer function for use with PyNE.
-It is suppossed to be fast.
+It is suppossed to be fast. The decay chains are written as constant tables
+of Bateman terms, which one evaluator walks for all nuclides.
 """
 import os
 import io
@@ -51,13 +52,48 @@ HEADER = ENV.from_string("""
 // {{ args }}
 
 #include <map>
+#include <vector>
 
 namespace pyne {
 namespace decayers {
 
-extern const int all_nucs[{{ nucs|length }}];
+// The decay chains are stored as sparse rows of Bateman terms, one row per
+// parent in all_nucs. Term j of the row of parent i adds
+// chain_coef[j] * b[chain_exp[j]] of the parent to chain_child[j], where
+// b[e] = exp2(decay_exps[e] * t), times t for the exponents from first_t_exp
+// on. Exponent 0 is zero, for the constant terms.
 
-std::map<int, double> decay(std::map<int, double> comp, double t);
+const int num_nucs = {{ nucs|length }};  ///< number of nuclides in all_nucs
+const int num_exps = {{ exps|length }};  ///< number of distinct exponents
+const int num_terms = {{ terms|length }};  ///< number of chain terms
+const int first_t_exp = {{ first_t_exp }};  ///< first exponent of a t * exp2() term
+
+extern const int all_nucs[{{ nucs|length }}];  ///< sorted state ids
+extern const double decay_exps[{{ exps|length }}];  ///< exponents, per second
+extern const int chain_ptr[{{ nucs|length + 1 }}];  ///< start of each row
+extern const int chain_child[{{ terms|length }}];  ///< term child indices
+extern const int chain_exp[{{ terms|length }}];  ///< term exponent indices
+extern const double chain_coef[{{ terms|length }}];  ///< term coefficients
+
+/// Returns the index of nuclide \\a nuc in all_nucs, or -1 if it has no chains.
+int nuc_index(int nuc);
+
+/// Decays the dense composition \\a x, given in the order of all_nucs, to each
+/// of the \\a nt times \\a ts. Row k of the nt by num_nucs array \\a out is the
+/// composition at ts[k]. Every exponential is evaluated once per time.
+void decay(const double* x, int nt, const double* ts, double* out);
+
+/// Decays composition \\a comp for time \\a t.
+std::map<int, double> decay(const std::map<int, double>& comp, double t);
+
+/// Decays composition \\a comp to each of the times \\a ts.
+std::vector<std::map<int, double> > decay(const std::map<int, double>& comp,
+                                          const std::vector<double>& ts);
+
+/// Decays each of the compositions \\a comps for time \\a t, evaluating the
+/// exponentials they share once.
+std::vector<std::map<int, double> > decay(
+    const std::vector<std::map<int, double> >& comps, double t);
 
 }  // namespace decayers
 }  // namespace pyne
@@ -73,50 +109,214 @@ SOURCE = ENV.from_string("""
 // This file was generated with the following command:
 // {{ args }}
 
+#include <algorithm>
 #include <cmath>
-#include "decay.h"
 
 #ifdef PYNE_IS_AMALGAMATED
 #include "pyne.h"
 #else
+#include "decay.h"
 #include "nucname.h"
 #endif
 
 namespace pyne {
 namespace decayers {
 
-{{ funcs }}
+namespace {
+
+// Per-thread state of an evaluation: the chain rows in use, the exponentials
+// they need, laid out as one contiguous run of nt values per exponent, and
+// the slot of each exponent in that layout
+struct Evaluation {
+  std::vector<int> parents;
+  std::vector<double> amounts;
+  std::vector<int> used;
+  std::vector<int> slot;
+  std::vector<double> b;
+
+  Evaluation() : slot(num_exps, -1) {};
+
+  // Starts a new evaluation
+  void clear() {
+    for (size_t u = 0; u < used.size(); u++)
+      slot[used[u]] = -1;
+    parents.clear();
+    amounts.clear();
+    used.clear();
+  };
+
+  // Adds amount x of nuclide index i, with its exponents
+  void add(int i, double x) {
+    parents.push_back(i);
+    amounts.push_back(x);
+    for (int j = chain_ptr[i]; j < chain_ptr[i + 1]; j++) {
+      int e = chain_exp[j];
+      if (slot[e] < 0) {
+        slot[e] = used.size();
+        used.push_back(e);
+      }
+    }
+  };
+
+  // Evaluates the exponentials in use at each of the nt times ts
+  void exponentials(int nt, const double* ts) {
+    b.resize(used.size() * nt);
+    for (size_t u = 0; u < used.size(); u++) {
+      double a = decay_exps[used[u]];
+      double* bu = &b[u * nt];
+      for (int k = 0; k < nt; k++)
+        bu[k] = exp2(a * ts[k]);
+      if (first_t_exp <= used[u]) {
+        for (int k = 0; k < nt; k++)
+          bu[k] *= ts[k];
+      }
+    }
+  };
+
+  // Adds the decayed parents p0 to p1 into the nt by num_nucs array out
+  void accumulate(size_t p0, size_t p1, int nt, double* out) const {
+    for (size_t p = p0; p < p1; p++) {
+      int i = parents[p];
+      for (int j = chain_ptr[i]; j < chain_ptr[i + 1]; j++) {
+        double w = amounts[p] * chain_coef[j];
+        const double* bu = &b[slot[chain_exp[j]] * nt];
+        double* o = out + chain_child[j];
+        for (int k = 0; k < nt; k++)
+          o[k * num_nucs] += w * bu[k];
+      }
+    }
+  };
+};
 
-std::map<int, double> decay(std::map<int, double> comp, double t) {
-  // setup
-  using std::map;
-  int nuc;
-  int i = 0;
-  double out [{{ nucs|length }}] = {};  // init to zero
-  map<int, double> outcomp;
+Evaluation& evaluation() {
+  static thread_local Evaluation ev;
+  ev.clear();
+  return ev;
+}
 
-  // body
-  map<int, double>::const_iterator it = comp.begin();
+// Adds the nuclides of comp that have chains to ev, and the others to passed
+std::map<int, double> gather(const std::map<int, double>& comp,
+                             Evaluation& ev) {
+  std::map<int, double> passed;
+  std::map<int, double>::const_iterator it = comp.begin();
   for (; it != comp.end(); ++it) {
-    switch (nucname::znum(it->first)) {
-      {{ cases|indent(6) }}
-      default:
-        outcomp.insert(*it);
-        break;
-    }
+    int i = nuc_index(it->first);
+    if (i < 0)
+      passed.insert(passed.end(), *it);
+    else
+      ev.add(i, it->second);
   }
+  return passed;
+}
 
-  // cleanup
-  for (i = 0; i < {{ nucs|length }}; ++i)
+// Returns the composition of the dense row out, over the passed nuclides
+std::map<int, double> scatter(const double* out,
+                              std::map<int, double> outcomp) {
+  for (int i = 0; i < num_nucs; ++i)
     if (out[i] > 0.0)
       outcomp[nucname::state_id_to_id(all_nucs[i])] = out[i];
   return outcomp;
 }
 
+}  // namespace
+
+
+int nuc_index(int nuc) {
+  int state = nucname::id_to_state_id(nuc);
+  const int* it = std::lower_bound(all_nucs, all_nucs + num_nucs, state);
+  if (it == all_nucs + num_nucs || *it != state)
+    return -1;
+  return it - all_nucs;
+}
+
+
+void decay(const double* x, int nt, const double* ts, double* out) {
+  Evaluation& ev = evaluation();
+  for (int i = 0; i < num_nucs; i++)
+    if (x[i] != 0.0)
+      ev.add(i, x[i]);
+  ev.exponentials(nt, ts);
+  std::fill(out, out + (size_t) nt * num_nucs, 0.0);
+  ev.accumulate(0, ev.parents.size(), nt, out);
+}
+
+
+std::map<int, double> decay(const std::map<int, double>& comp, double t) {
+  Evaluation& ev = evaluation();
+  std::map<int, double> passed = gather(comp, ev);
+  ev.exponentials(1, &t);
+  std::vector<double> out (num_nucs, 0.0);
+  ev.accumulate(0, ev.parents.size(), 1, out.data());
+  return scatter(out.data(), passed);
+}
+
+
+std::vector<std::map<int, double> > decay(const std::map<int, double>& comp,
+                                          const std::vector<double>& ts) {
+  Evaluation& ev = evaluation();
+  std::map<int, double> passed = gather(comp, ev);
+  int nt = ts.size();
+  ev.exponentials(nt, ts.data());
+  std::vector<double> out ((size_t) nt * num_nucs, 0.0);
+  ev.accumulate(0, ev.parents.size(), nt, out.data());
+  std::vector<std::map<int, double> > outcomps;
+  outcomps.reserve(nt);
+  for (int k = 0; k < nt; k++)
+    outcomps.push_back(scatter(&out[(size_t) k * num_nucs], passed));
+  return outcomps;
+}
+
+
+std::vector<std::map<int, double> > decay(
+    const std::vector<std::map<int, double> >& comps, double t) {
+  Evaluation& ev = evaluation();
+  std::vector<std::map<int, double> > passed;
+  std::vector<size_t> ends;
+  passed.reserve(comps.size());
+  ends.reserve(comps.size());
+  for (size_t c = 0; c < comps.size(); c++) {
+    passed.push_back(gather(comps[c], ev));
+    ends.push_back(ev.parents.size());
+  }
+  ev.exponentials(1, &t);
+  std::vector<double> out (num_nucs);
+  std::vector<std::map<int, double> > outcomps;
+  outcomps.reserve(comps.size());
+  size_t start = 0;
+  for (size_t c = 0; c < comps.size(); c++) {
+    std::fill(out.begin(), out.end(), 0.0);
+    ev.accumulate(start, ends[c], 1, out.data());
+    outcomps.push_back(scatter(out.data(), passed[c]));
+    start = ends[c];
+  }
+  return outcomps;
+}
+
+
 const int all_nucs [{{ nucs|length }}] = {
 {{ nucs | join(", ") | wordwrap(width=78, break_long_words=False) | indent(2, True) }}
 };
 
+const double decay_exps [{{ exps|length }}] = {
+{{ exps | join(", ") | wordwrap(width=78, break_long_words=False) | indent(2, True) }}
+};
+
+const int chain_ptr [{{ nucs|length + 1 }}] = {
+{{ ptr | join(", ") | wordwrap(width=78, break_long_words=False) | indent(2, True) }}
+};
+
+const int chain_child [{{ terms|length }}] = {
+{{ children | join(", ") | wordwrap(width=78, break_long_words=False) | indent(2, True) }}
+};
+
+const int chain_exp [{{ terms|length }}] = {
+{{ terms | join(", ") | wordwrap(width=78, break_long_words=False) | indent(2, True) }}
+};
+
+const double chain_coef [{{ terms|length }}] = {
+{{ coefs | join(", ") | wordwrap(width=78, break_long_words=False) | indent(2, True) }}
+};
+
 }  // namespace decayers
 }  // namespace pyne
 
@@ -124,40 +324,19 @@ const int all_nucs [{{ nucs|length }}] = {
 """.strip())
 
 
-ELEM_FUNC = ENV.from_string("""
-void decay_{{ elem|lower }}(double t, std::map<int, double>::const_iterator &it, std::map<int, double> &outcomp, double (&out)[{{ nucs|length }}]) {
-  //using std::exp2;
-  switch (nucname::id_to_state_id(it->first)) {
-    {{ cases|indent(4) }}
-    } default: {
-      outcomp.insert(*it);
-      break;
-    }
-  }
-}
-""".strip())
-
-
 # Some strings that need not be redefined
-BREAK = '  break;'
-CHAIN_STMT = '  out[{0}] += {1};'
-CHAIN_EXPR = '(it->second) * ({0})'
-EXP_EXPR = 'exp2({a:.17e}*t)'
-KEXP_EXPR = '{k:.17e}*' + EXP_EXPR
-B_STMT = 'double b{b} = {exp};'
-B_EXPR = 'b{b}'
-KB_EXPR = '{k:.17e}*' + B_EXPR
+FLOAT_FMT = '{0:.17e}'
 
 
 def genfiles(nucs, short=1e-16, small=1e-16, sf=False, dummy=False, debug=False):
+    nucs = sorted(nucs)
     ctx = Namespace(
         nucs=nucs,
         autogenwarn=autogenwarn,
         dummy_ifdef=('ifdef' if dummy else 'ifndef'),
         args=' '.join(sys.argv)
         )
-    ctx.cases = gencases(nucs, debug=debug)
-    ctx.funcs = genelemfuncs(nucs, short=short, small=small, sf=sf, debug=debug)
+    gentables(ctx, short=short, small=small, sf=sf, debug=debug)
     hdr = HEADER.render(ctx.__dict__)
     src = SOURCE.render(ctx.__dict__)
     return hdr, src
@@ -329,119 +508,96 @@ def k_a_from_hl(chain, short=1e-16, small=1e-16):
     return k[mask], a[mask], t_term[mask]
 
 
-def kbexpr(k, b):
-    if k == 1.0:
-        return B_EXPR.format(b=b)
-    else:
-        return KB_EXPR.format(k=k, b=b)
-
-
-def ensure_cse(a_i, b, cse):
-    bkey = EXP_EXPR.format(a=a_i)
-    if bkey not in cse:
-        b += 1
-        cse[bkey] = b
-    return b
-
-def b_from_a(cse, a_i):
-    bkey = EXP_EXPR.format(a=a_i)
-    return cse[bkey]
-
-
-def chainexpr(chain, cse, b, bt, short=1e-16, small=1e-16):
+def chainterms(chain, bt, short=1e-16, small=1e-16):
+    """Returns the (k, a, t_term) Bateman terms of the amount of the last
+    nuclide of a chain per amount of its first, with the running sum of the
+    constant terms of the parent, which is kept at most 1.
+    """
     child = chain[-1]
     if len(chain) == 1:
-        a_i = -1.0 / half_life(child, False)
-        b = ensure_cse(a_i, b, cse)
-        terms = B_EXPR.format(b=b_from_a(cse, a_i))
-    else:
-        k, a, t_term = k_a_from_hl(chain, short=short, small=small)
-        if k is None:
-            return None, b, bt
-        terms = []
-        for k_i, a_i, t_term_i in zip(k, a, t_term):
-            if k_i == 1.0 and a_i == 0.0:
-                term = str(1.0 - bt)  # a slight optimization
-                bt = 1
-            elif a_i == 0.0:
-                if not np.isnan(k_i):
-                    if bt < 1:
-                        if k_i + bt < 1:
-                            term = '{0:.17e}'.format(k_i)  # another slight optimization
-                            bt += k_i
-                        else:
-                            term = '{0:.17e}'.format(1.0 - bt)
-                            bt = 1.0
+        return [(1.0, -1.0 / half_life(child, False), False)], bt
+    k, a, t_term = k_a_from_hl(chain, short=short, small=small)
+    if k is None:
+        return None, bt
+    terms = []
+    for k_i, a_i, t_term_i in zip(k, a, t_term):
+        if k_i == 1.0 and a_i == 0.0:
+            term = 1.0 - bt  # a slight optimization
+            bt = 1
+        elif a_i == 0.0:
+            if not np.isnan(k_i):
+                if bt < 1:
+                    if k_i + bt < 1:
+                        term = k_i  # another slight optimization
+                        bt += k_i
                     else:
-                        term = '0'
+                        term = 1.0 - bt
+                        bt = 1.0
                 else:
-                    term = '0'
+                    term = 0.0
             else:
-                b = ensure_cse(a_i, b, cse)
-                term = kbexpr(k_i, b_from_a(cse, a_i))
-            # multiply by t if needed
-            if t_term_i:
-                term += '*t'
-            terms.append(term)
-        terms = ' + '.join(terms)
-    return CHAIN_EXPR.format(terms), b, bt
-
-
-def gencase(nuc, idx, b, short=1e-16, small=1e-16, sf=False, debug=False):
-    case = ['}} case {0}: {{'.format(nuc)]
+                term = 0.0
+        else:
+            terms.append((k_i, a_i, bool(t_term_i)))
+            continue
+        if term != 0.0:
+            terms.append((term, 0.0, bool(t_term_i)))
+    return terms, bt
+
+
+def genterms(nuc, idx, short=1e-16, small=1e-16, sf=False, debug=False):
+    """Returns the (child index, k, a, t_term) terms of the row of a parent,
+    with the terms of a child that share an exponent summed.
+    """
     dc = decay_const(nuc, False)
     if dc == 0.0:
         # stable nuclide
-        case.append(CHAIN_STMT.format(idx[nuc], 'it->second'))
-    else:
-        chains = genchains([(nuc,)], sf=sf)
-        print('{} has {} chains'.format(nucname.name(nuc), len(set(chains))))
-        cse = {}  # common sub-expression exponents to elimnate
-        bt = 0
-        for c in chains:
-            if c[-1] not in idx:
-                continue
-            cexpr, b, bt = chainexpr(c, cse, b, bt, short=short, small=small)
-            if cexpr is None:
-                continue
-            if debug:
-                case.append('  // ' + ' -> '.join(map(nucname.name, c)))
-            case.append(CHAIN_STMT.format(idx[c[-1]], cexpr))
-        bstmts = ['  ' + B_STMT.format(exp=exp, b=bval) for exp, bval in \
-                  sorted(cse.items(), key=lambda x: x[1])]
-        case = case[:1] + bstmts + case[1:]
-    case.append(BREAK)
-    return case, b
-
-
-def elems(nucs):
-    return sorted(set(map(nucname.znum, nucs)))
-
-
-def gencases(nucs, debug=False):
-    switches = []
-    for i in elems(nucs):
-        c = ['case {0}:'.format(i),
-             '  decay_{0}(t, it, outcomp, out);'.format(nucname.name(i).lower()),
-             '  break;']
-        switches.append('\n'.join(c))
-    return '\n'.join(switches)
-
-
-def genelemfuncs(nucs, short=1e-16, small=1e-16, sf=False, debug=False,):
+        return [(idx[nuc], 1.0, 0.0, False)]
+    chains = genchains([(nuc,)], sf=sf)
+    print('{} has {} chains'.format(nucname.name(nuc), len(set(chains))))
+    row = {}
+    bt = 0
+    for c in chains:
+        if c[-1] not in idx:
+            continue
+        terms, bt = chainterms(c, bt, short=short, small=small)
+        if terms is None:
+            continue
+        if debug:
+            print('  ' + ' -> '.join(map(nucname.name, c)))
+        for k_i, a_i, t_term_i in terms:
+            key = (idx[c[-1]], a_i, t_term_i)
+            row[key] = row.get(key, 0.0) + k_i
+    return [key[:1] + (k,) + key[1:] for key, k in sorted(row.items())]
+
+
+def gentables(ctx, short=1e-16, small=1e-16, sf=False, debug=False):
+    """Fills ctx with the chain tables of its nucs: the distinct exponents,
+    the start of the row of each parent, and the child, exponent and
+    coefficient of each term.
+    """
+    nucs = ctx.nucs
     idx = dict(zip(nucs, range(len(nucs))))
-    cases = {i: [-1, []] for i in elems(nucs)}
-    for nuc in nucs:
-        z = nucname.znum(nuc)
-        case, cases[z][0] = gencase(nuc, idx, cases[z][0], short=short, sf=sf,
-                                    debug=debug, small=small)
-        cases[z][1] += case
-    funcs = []
-    for i, (b, kases) in cases.items():
-        kases[0] = kases[0][2:]
-        ctx = dict(nucs=nucs, elem=nucname.name(i), cases='\n'.join(kases))
-        funcs.append(ELEM_FUNC.render(ctx))
-    return "\n\n".join(funcs)
+    rows = [genterms(nuc, idx, short=short, small=small, sf=sf, debug=debug)
+            for nuc in nucs]
+    # the constant exponent comes first and the t * exp2() terms last
+    keys = {(0.0, False)}
+    for row in rows:
+        keys.update((a_i, t_term_i) for _, _, a_i, t_term_i in row)
+    keys = sorted(keys, key=lambda x: (x[1], x != (0.0, False), x[0]))
+    exps = dict(zip(keys, range(len(keys))))
+    ctx.exps = [FLOAT_FMT.format(a_i) for a_i, _ in keys]
+    ctx.first_t_exp = len([key for key in keys if not key[1]])
+    ctx.ptr = [0]
+    ctx.children = []
+    ctx.terms = []
+    ctx.coefs = []
+    for row in rows:
+        for child, k_i, a_i, t_term_i in row:
+            ctx.children.append(child)
+            ctx.terms.append(exps[(a_i, t_term_i)])
+            ctx.coefs.append(FLOAT_FMT.format(k_i))
+        ctx.ptr.append(len(ctx.terms))
 
 
 def load_default_nucs():
@@ -1,4 +1,12 @@
 // Enrichment
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <stdint.h>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
 #ifndef PYNE_IS_AMALGAMATED
 #include "enrichment.h"
 #endif
@@ -84,6 +92,164 @@ double pyne_enr::swu_per_tail(double x_feed, double x_prod, double x_tail) {
 }
 
 
+// Natural log of a positive normal x, after e_log.c of fdlibm with its final
+// reconstruction used for all f, as musl does. It has no branches, tables or
+// 64-bit integer compares, so loops calling it vectorize even with SSE2.
+// Other arguments give garbage.
+static inline double log_normal(double x) {
+  const double ln2_hi = 6.93147180369123816490e-01;
+  const double ln2_lo = 1.90821492927058770002e-10;
+  const double Lg1 = 6.666666666666735130e-01;
+  const double Lg2 = 3.999999999940941908e-01;
+  const double Lg3 = 2.857142874366239149e-01;
+  const double Lg4 = 2.222219843214978396e-01;
+  const double Lg5 = 1.818357216161805012e-01;
+  const double Lg6 = 1.531383769920937332e-01;
+  const double Lg7 = 1.479819860511658591e-01;
+  uint64_t u;
+  memcpy(&u, &x, sizeof(u));
+  uint64_t hx = (u >> 32) & 0x000fffff;
+  // scale the mantissa into [sqrt(2)/2, sqrt(2)) and adjust the exponent
+  uint64_t i = (hx + 0x95f64) & 0x100000;
+  uint64_t biased_k = (u >> 52) + (i >> 20);
+  u = ((hx | (i ^ 0x3ff00000)) << 32) | (u & 0xffffffff);
+  double m;
+  memcpy(&m, &u, sizeof(m));
+  double f = m - 1.0;
+  // the exponent as a double, without an int64 conversion
+  uint64_t kbits = 0x4330000000000000ULL | biased_k;
+  double dk;
+  memcpy(&dk, &kbits, sizeof(dk));
+  dk = dk - 4503599627370496.0 - 1023.0;
+
+  double s = f / (2.0 + f);
+  double z = s * s;
+  double w = z * z;
+  double t1 = w * (Lg2 + w * (Lg4 + w * Lg6));
+  double t2 = z * (Lg1 + w * (Lg3 + w * (Lg5 + w * Lg7)));
+  double R = t2 + t1;
+  double hfsq = 0.5 * f * f;
+  return s * (hfsq + R) + dk * ln2_lo - hfsq + f + dk * ln2_hi;
+}
+
+// value_func() with log_normal()
+static inline double value_func_normal(double x) {
+  return (2 * x - 1) * log_normal(x / (1 - x));
+}
+
+// Whether value_func_normal() is valid for x, which is when x / (1 - x) is
+// positive, normal and finite
+static inline bool value_func_normal_arg(double x) {
+  return x >= DBL_MIN && x < 1.0;
+}
+
+// Redoes the points whose value function arguments log_normal() can't take
+template <typename F>
+static void fix_special_swu(const double * x_feed, const double * x_prod,
+                            const double * x_tail, double * out, size_t n,
+                            F scalar) {
+  for (size_t i = 0; i < n; i++) {
+    if (!value_func_normal_arg(x_feed[i]) || !value_func_normal_arg(x_prod[i]) ||
+        !value_func_normal_arg(x_tail[i]))
+      out[i] = scalar(x_feed[i], x_prod[i], x_tail[i]);
+  }
+}
+
+void pyne_enr::feed_per_prod_n(const double * x_feed, const double * x_prod,
+                               const double * x_tail, double * out, size_t n) {
+  #pragma omp simd
+  for (size_t i = 0; i < n; i++)
+    out[i] = (x_prod[i] - x_tail[i]) / (x_feed[i] - x_tail[i]);
+}
+
+void pyne_enr::feed_per_tail_n(const double * x_feed, const double * x_prod,
+                               const double * x_tail, double * out, size_t n) {
+  #pragma omp simd
+  for (size_t i = 0; i < n; i++)
+    out[i] = (x_tail[i] - x_prod[i]) / (x_feed[i] - x_prod[i]);
+}
+
+void pyne_enr::prod_per_feed_n(const double * x_feed, const double * x_prod,
+                               const double * x_tail, double * out, size_t n) {
+  #pragma omp simd
+  for (size_t i = 0; i < n; i++)
+    out[i] = (x_feed[i] - x_tail[i]) / (x_prod[i] - x_tail[i]);
+}
+
+void pyne_enr::prod_per_tail_n(const double * x_feed, const double * x_prod,
+                               const double * x_tail, double * out, size_t n) {
+  #pragma omp simd
+  for (size_t i = 0; i < n; i++)
+    out[i] = (x_tail[i] - x_feed[i]) / (x_feed[i] - x_prod[i]);
+}
+
+void pyne_enr::tail_per_feed_n(const double * x_feed, const double * x_prod,
+                               const double * x_tail, double * out, size_t n) {
+  #pragma omp simd
+  for (size_t i = 0; i < n; i++)
+    out[i] = (x_feed[i] - x_prod[i]) / (x_tail[i] - x_prod[i]);
+}
+
+void pyne_enr::tail_per_prod_n(const double * x_feed, const double * x_prod,
+                               const double * x_tail, double * out, size_t n) {
+  #pragma omp simd
+  for (size_t i = 0; i < n; i++)
+    out[i] = (x_feed[i] - x_prod[i]) / (x_tail[i] - x_feed[i]);
+}
+
+void pyne_enr::value_func_n(const double * x, double * out, size_t n) {
+  #pragma omp simd
+  for (size_t i = 0; i < n; i++)
+    out[i] = value_func_normal(x[i]);
+  for (size_t i = 0; i < n; i++) {
+    if (!value_func_normal_arg(x[i]))
+      out[i] = value_func(x[i]);
+  }
+}
+
+// The flow rate ratios of each SWU function below share a denominator, so it
+// is divided once.
+void pyne_enr::swu_per_feed_n(const double * x_feed, const double * x_prod,
+                              const double * x_tail, double * out, size_t n) {
+  #pragma omp simd
+  for (size_t i = 0; i < n; i++) {
+    double r = 1.0 / (x_prod[i] - x_tail[i]);
+    double ppf = (x_feed[i] - x_tail[i]) * r;
+    double tpf = (x_prod[i] - x_feed[i]) * r;
+    out[i] = ppf * value_func_normal(x_prod[i]) + \
+             tpf * value_func_normal(x_tail[i]) - value_func_normal(x_feed[i]);
+  }
+  fix_special_swu(x_feed, x_prod, x_tail, out, n, swu_per_feed);
+}
+
+void pyne_enr::swu_per_prod_n(const double * x_feed, const double * x_prod,
+                              const double * x_tail, double * out, size_t n) {
+  #pragma omp simd
+  for (size_t i = 0; i < n; i++) {
+    double r = 1.0 / (x_feed[i] - x_tail[i]);
+    double tpp = (x_prod[i] - x_feed[i]) * r;
+    double fpp = (x_prod[i] - x_tail[i]) * r;
+    out[i] = value_func_normal(x_prod[i]) + \
+             tpp * value_func_normal(x_tail[i]) - \
+             fpp * value_func_normal(x_feed[i]);
+  }
+  fix_special_swu(x_feed, x_prod, x_tail, out, n, swu_per_prod);
+}
+
+void pyne_enr::swu_per_tail_n(const double * x_feed, const double * x_prod,
+                              const double * x_tail, double * out, size_t n) {
+  #pragma omp simd
+  for (size_t i = 0; i < n; i++) {
+    double r = 1.0 / (x_feed[i] - x_prod[i]);
+    double ppt = (x_tail[i] - x_feed[i]) * r;
+    double fpt = (x_tail[i] - x_prod[i]) * r;
+    out[i] = ppt * value_func_normal(x_prod[i]) + \
+             value_func_normal(x_tail[i]) - fpt * value_func_normal(x_feed[i]);
+  }
+  fix_special_swu(x_feed, x_prod, x_tail, out, n, swu_per_tail);
+}
+
+
 double pyne_enr::alphastar_i(double alpha, double Mstar, double M_i) {
   // M_i is the mass of the ith nuclide
   return pow(alpha, (Mstar - M_i));
@@ -358,6 +524,409 @@ pyne_enr::Cascade pyne_enr::solve_numeric(pyne_enr::Cascade & orig_casc, \
   return casc;
 }
 
+// The dense versions of _recompute_nm(), _recompute_prod_tail_mats() and
+// _norm_comp_secant() below follow the Cascade ones operation for operation,
+// so that both give the same numbers.
+static void recompute_nm(pyne_enr::DenseCascade & casc, double tolerance) {
+  double x_feed_j = casc.x_feed[casc.jdx];
+  double ppf = pyne_enr::prod_per_feed(x_feed_j, casc.x_prod_j, casc.x_tail_j);
+  double tpf = pyne_enr::tail_per_feed(x_feed_j, casc.x_prod_j, casc.x_tail_j);
+  double astar_j = pyne_enr::alphastar_i(casc.alpha, casc.Mstar,
+                                         casc.mw[casc.jdx]);
+
+  // Save original state of N & M
+  double N = casc.N;
+  double M = casc.M;
+  double origN = casc.N;
+  double origM = casc.M;
+
+  double lhs_prod = ppf * casc.x_prod_j / x_feed_j;
+  double rhs_prod = (pow(astar_j, M+1.0) - 1.0) / (pow(astar_j, M+1.0) - pow(astar_j, -N));
+  double lhs_tail = tpf * casc.x_tail_j / x_feed_j;
+  double rhs_tail = (1.0 - pow(astar_j, -N)) / (pow(astar_j, M+1.0) - pow(astar_j, -N));
+
+  double n = 1.0;
+  double delta_prod = lhs_prod - rhs_prod;
+  double delta_tail = lhs_tail - rhs_tail;
+  while (tolerance < fabs(delta_prod) && tolerance < fabs(delta_tail)) {
+    delta_prod = lhs_prod - rhs_prod;
+    delta_tail = lhs_tail - rhs_tail;
+
+    if (tolerance < fabs(delta_prod)) {
+      N = N - (delta_prod * N);
+      rhs_prod = (pow(astar_j, M+1.0) - 1.0) / (pow(astar_j, M+1.0) - pow(astar_j, -N));
+    }
+
+    if (tolerance < fabs(delta_tail)) {
+      M = M - (delta_tail * M);
+      rhs_tail = (1.0 - pow(astar_j, -N)) / (pow(astar_j, M+1.0) - pow(astar_j, -N));
+    }
+
+    if (N < tolerance) {
+      N = origN + n;
+      M = origM + n;
+      n = n + 1.0;
+    }
+
+    if (M < tolerance) {
+      N = origN + n;
+      M = origM + n;
+      n = n + 1.0;
+    }
+  }
+
+  casc.N = N;
+  casc.M = M;
+}
+
+
+// Divides the fractions by their sum, as Material::norm_comp() does
+static void norm_fractions(std::vector<double> & x) {
+  double sum = 0.0;
+  for (size_t i = 0; i < x.size(); i++)
+    sum += x[i];
+  if (sum != 1.0 && sum != 0.0) {
+    for (size_t i = 0; i < x.size(); i++)
+      x[i] = x[i] / sum;
+  }
+}
+
+
+static void recompute_prod_tail(pyne_enr::DenseCascade & casc) {
+  double astar_i, numer_prod, numer_tail, denom_prod, denom_tail;
+  double N = casc.N;
+  double M = casc.M;
+  double x_feed_j = casc.x_feed[casc.jdx];
+  double ppf = pyne_enr::prod_per_feed(x_feed_j, casc.x_prod_j, casc.x_tail_j);
+  double tpf = pyne_enr::tail_per_feed(x_feed_j, casc.x_prod_j, casc.x_tail_j);
+
+  for (size_t i = 0; i < casc.nucs.size(); i++) {
+    astar_i = pyne_enr::alphastar_i(casc.alpha, casc.Mstar, casc.mw[i]);
+
+    // calc prod comp
+    numer_prod = casc.x_feed[i] * (pow(astar_i, M+1.0) - 1.0);
+    denom_prod = (pow(astar_i, M+1.0) - pow(astar_i, -N)) / ppf;
+    casc.x_prod[i] = numer_prod / denom_prod;
+
+    // calc tail comp
+    numer_tail = casc.x_feed[i] * (1.0 - pow(astar_i, -N));
+    denom_tail = (pow(astar_i, M+1.0) - pow(astar_i, -N)) / tpf;
+    casc.x_tail[i] = numer_tail / denom_tail;
+  }
+  norm_fractions(casc.x_prod);
+  norm_fractions(casc.x_tail);
+}
+
+
+static void norm_comp_secant(pyne_enr::DenseCascade & casc, double tolerance,
+                             int max_iter) {
+  // Only the key component fractions of the previous point enter the secant
+  // steps, so they are all that is kept of it.
+  int jdx = casc.jdx;
+  double target_prod_j = casc.x_prod_j;
+  double target_tail_j = casc.x_tail_j;
+
+  unsigned int h;
+  int niter = 0;
+  int max_hist = max_iter / 10;
+  std::vector<double> historyN;
+  std::vector<double> historyM;
+
+  // Initialize prev point
+  double N0 = casc.N;
+  double M0 = casc.M;
+  casc.N = N0 + 1.0;
+  casc.M = M0 + 1.0;
+  recompute_nm(casc, tolerance);
+  recompute_prod_tail(casc);
+  historyN.push_back(casc.N);
+  historyM.push_back(casc.M);
+  double prev_N = casc.N;
+  double prev_M = casc.M;
+  double prev_prod_j = casc.x_prod[jdx];
+  double prev_tail_j = casc.x_tail[jdx];
+
+  // Initialize current point
+  casc.N = N0;
+  casc.M = M0;
+  recompute_nm(casc, tolerance);
+  recompute_prod_tail(casc);
+  historyN.push_back(casc.N);
+  historyM.push_back(casc.M);
+  double curr_N = casc.N;
+  double curr_M = casc.M;
+  double temp_prev_N = 0.0;
+  double temp_prev_M = 0.0;
+  double temp_curr_N = 0.0;
+  double temp_curr_M = 0.0;
+
+  double delta_x_prod_j = target_prod_j - casc.x_prod[jdx];
+  double delta_x_tail_j = target_tail_j - casc.x_tail[jdx];
+
+  while ((tolerance < fabs(delta_x_prod_j) / casc.x_prod[jdx]  || \
+          tolerance < fabs(delta_x_tail_j) / casc.x_tail[jdx]) && \
+          niter < max_iter) {
+    double curr_prod_j = casc.x_prod[jdx];
+    double curr_tail_j = casc.x_tail[jdx];
+    delta_x_prod_j = target_prod_j - curr_prod_j;
+    delta_x_tail_j = target_tail_j - curr_tail_j;
+
+    if (tolerance <= fabs(delta_x_prod_j)/curr_prod_j) {
+      // Make a new guess for N
+      temp_curr_N = curr_N;
+      temp_prev_N = prev_N;
+      curr_N = curr_N + delta_x_prod_j*\
+              ((curr_N - prev_N)/(curr_prod_j - prev_prod_j));
+      prev_N = temp_curr_N;
+
+      // If the new value of N is less than zero, reset.
+      if (curr_N < 0.0)
+        curr_N = (temp_curr_N + temp_prev_N)/2.0;
+    }
+
+    if (tolerance <= fabs(delta_x_tail_j)/curr_tail_j) {
+      // Make a new guess for M
+      temp_curr_M = curr_M;
+      temp_prev_M = prev_M;
+      curr_M = curr_M + delta_x_tail_j*\
+               ((curr_M - prev_M)/(curr_tail_j - prev_tail_j));
+      prev_M = temp_curr_M;
+
+      // If the new value of M is less than zero, reset.
+      if (curr_M < 0.0)
+        curr_M = (temp_curr_M + temp_prev_M)/2.0;
+    }
+
+    // Check for infinite loops
+    for (h = 0; h < historyN.size(); h++) {
+      if (historyN[h] == curr_N && historyM[h] == curr_M) {
+        curr_N = curr_N + delta_x_prod_j * \
+              ((curr_N - prev_N)/(curr_prod_j - prev_prod_j));
+        curr_M = curr_M + delta_x_tail_j * \
+               ((curr_M - prev_M)/(curr_tail_j - prev_tail_j));
+        break;
+      }
+    }
+
+    if (max_hist <= historyN.size()) {
+      historyN.erase(historyN.begin());
+      historyM.erase(historyM.begin());
+    }
+    historyN.push_back(curr_N);
+    historyM.push_back(curr_M);
+
+    niter += 1;
+
+    // Calculate new isotopics for valid (N, M)
+    prev_prod_j = curr_prod_j;
+    prev_tail_j = curr_tail_j;
+    casc.N = curr_N;
+    casc.M = curr_M;
+    recompute_nm(casc, tolerance);
+    recompute_prod_tail(casc);
+  }
+}
+
+
+void pyne_enr::solve_numeric(pyne_enr::DenseCascade & casc, double tolerance,
+                             int max_iter) {
+  norm_comp_secant(casc, tolerance, max_iter);
+
+  int jdx = casc.jdx;
+  int kdx = casc.kdx;
+  double x_feed_j = casc.x_feed[jdx];
+  double ppf = prod_per_feed(x_feed_j, casc.x_prod_j, casc.x_tail_j);
+  double tpf = tail_per_feed(x_feed_j, casc.x_prod_j, casc.x_tail_j);
+
+  // Matched Flow Ratios
+  double rfeed = x_feed_j / casc.x_feed[kdx];
+  double rprod = casc.x_prod[jdx] / casc.x_prod[kdx];
+  double rtail = casc.x_tail[jdx] / casc.x_tail[kdx];
+
+  // the log of alphastar_j, which _deltaU_i_OverG() recomputes per nuclide
+  double log_astar_j = log(pow(casc.alpha, (casc.Mstar - casc.mw[jdx])));
+
+  double ltotpf = 0.0;
+  double swupf = 0.0;
+  double temp_numer = 0.0;
+  double astar_i = 0.0;
+  for (size_t i = 0; i < casc.nucs.size(); i++) {
+    temp_numer = (ppf*casc.x_prod[i]*log(rprod) + \
+                  tpf*casc.x_tail[i]*log(rtail) - \
+                      casc.x_feed[i]*log(rfeed));
+    astar_i = alphastar_i(casc.alpha, casc.Mstar, casc.mw[i]);
+    ltotpf = ltotpf + (temp_numer / (log_astar_j * \
+                                     ((astar_i - 1.0)/(astar_i + 1.0))));
+    swupf = swupf + temp_numer;
+  }
+
+  casc.l_t_per_feed = ltotpf;
+  casc.swu_per_feed = -1 * swupf;
+  casc.swu_per_prod = -1 * swupf / ppf;
+  casc.prod_mass = casc.feed_mass * ppf;
+  casc.tail_mass = casc.feed_mass * tpf;
+}
+
+
+// Solves one dense cascade with the solver of the given code
+static void solve_dense(pyne_enr::DenseCascade & casc, int solver_code,
+                        double tolerance, int max_iter) {
+  if (solver_code == 0)
+    pyne_enr::solve_symbolic(casc);
+  else
+    pyne_enr::solve_numeric(casc, tolerance, max_iter);
+}
+
+
+// The Mstar search of multicomponent() on a dense cascade, whose Mstar, N
+// and M are the initial guesses and which holds the solution on return.
+static void multicomponent_dense(pyne_enr::DenseCascade & casc,
+                                 int solver_code, double tolerance,
+                                 int max_iter) {
+  pyne_enr::DenseCascade temp_casc = casc;
+  pyne_enr::DenseCascade prev_casc = casc;
+  pyne_enr::DenseCascade & curr_casc = casc;
+  double mw_j = casc.mw[casc.jdx];
+  double mw_k = casc.mw[casc.kdx];
+
+  // validate Mstar or pick new value
+  if ((casc.Mstar < mw_j && casc.Mstar < mw_k) || \
+      (casc.Mstar > mw_j && casc.Mstar > mw_k)) {
+    double ms = (mw_j + mw_k) / 2.0;
+    prev_casc.Mstar = ms;
+    curr_casc.Mstar = ms;
+  }
+
+  // xpn is the exponential index
+  double xpn = 1.0;
+
+  // Initialize previous point
+  solve_dense(prev_casc, solver_code, tolerance, max_iter);
+
+  // Initialize current point
+  curr_casc.Mstar = (mw_j + curr_casc.Mstar) / 2.0;
+  solve_dense(curr_casc, solver_code, tolerance, max_iter);
+
+  double m = pyne::slope(curr_casc.Mstar, curr_casc.l_t_per_feed, \
+                         prev_casc.Mstar, prev_casc.l_t_per_feed);
+  double m_sign = m / fabs(m);
+
+  double temp_m;
+  double temp_m_sign;
+
+  while (tolerance < fabs(curr_casc.l_t_per_feed - prev_casc.l_t_per_feed) / curr_casc.l_t_per_feed) {
+    // Check that parameters are still well-formed
+    if (isnan(curr_casc.Mstar) || isnan(curr_casc.l_t_per_feed) || \
+        isnan(prev_casc.Mstar) || isnan(prev_casc.l_t_per_feed))
+      throw pyne_enr::EnrichmentIterationNaN();
+
+    prev_casc = curr_casc;
+
+    curr_casc.Mstar = curr_casc.Mstar - (m_sign * pow(10.0, -xpn));
+    solve_dense(curr_casc, solver_code, tolerance, max_iter);
+
+    if (prev_casc.l_t_per_feed < curr_casc.l_t_per_feed) {
+      temp_casc = curr_casc;
+      temp_casc.Mstar = temp_casc.Mstar - (m_sign * pow(10.0, -xpn));
+      solve_dense(temp_casc, solver_code, tolerance, max_iter);
+
+      temp_m = pyne::slope(curr_casc.Mstar, curr_casc.l_t_per_feed, \
+                           temp_casc.Mstar, temp_casc.l_t_per_feed);
+      if (temp_m == 0.0) {
+        prev_casc = curr_casc;
+        curr_casc = temp_casc;
+        break;
+      }
+
+      temp_m_sign = temp_m / fabs(temp_m);
+      if (m_sign != temp_m_sign) {
+        xpn = xpn + 1;
+
+        temp_casc = prev_casc;
+        temp_casc.Mstar = temp_casc.Mstar + (m_sign * pow(10.0, -xpn));
+        solve_dense(temp_casc, solver_code, tolerance, max_iter);
+        temp_m = pyne::slope(prev_casc.Mstar, prev_casc.l_t_per_feed, \
+                             temp_casc.Mstar, temp_casc.l_t_per_feed);
+
+        if (temp_m == 0.0) {
+          prev_casc = curr_casc;
+          curr_casc = temp_casc;
+          break;
+        }
+
+        m_sign = temp_m / fabs(temp_m);
+        m = temp_m;
+        prev_casc = curr_casc;
+        curr_casc = temp_casc;
+      }
+    }
+  }
+}
+
+
+std::vector<pyne_enr::Cascade> pyne_enr::multicomponent_many(
+    const std::vector<pyne_enr::Cascade> & cascs, std::string solver,
+    double tolerance, int max_iter, bool warm_start, int num_threads) {
+  int solver_code;
+  if (solver == "symbolic")
+    solver_code = 0;
+  else if (solver == "numeric")
+    solver_code = 1;
+  else
+    throw std::invalid_argument("solver not known: " + solver);
+
+  int n = cascs.size();
+  std::vector<pyne_enr::Cascade> solved(n);
+  if (n == 0)
+    return solved;
+  if (num_threads <= 0)
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  num_threads = std::min(num_threads, n);
+
+  // the dense cascades are built up front, as atomic_mass() may fill its
+  // table and must not be called from several threads at once
+  std::vector<pyne_enr::DenseCascade> dense;
+  dense.reserve(n);
+  for (int i = 0; i < n; i++)
+    dense.push_back(pyne_enr::DenseCascade(cascs[i]));
+
+  // each thread solves a contiguous run, warm starting along it. Only the
+  // stage numbers are carried over; the Mstar search stops on the change in
+  // L/F rather than in Mstar, so starting it elsewhere would only move its end.
+  std::vector<std::exception_ptr> errors(num_threads);
+  auto solve_run = [&](int t) {
+    int begin = (long) n * t / num_threads;
+    int end = (long) n * (t + 1) / num_threads;
+    try {
+      for (int i = begin; i < end; i++) {
+        pyne_enr::DenseCascade & casc = dense[i];
+        if (warm_start && i > begin && casc.same_shape(dense[i - 1])) {
+          casc.N = dense[i - 1].N;
+          casc.M = dense[i - 1].M;
+        }
+        multicomponent_dense(casc, solver_code, tolerance, max_iter);
+        solved[i] = casc.to_cascade(cascs[i]);
+      }
+    } catch (...) {
+      errors[t] = std::current_exception();
+    }
+  };
+  if (num_threads == 1) {
+    solve_run(0);
+  } else {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++)
+      threads.push_back(std::thread(solve_run, t));
+    for (int t = 0; t < num_threads; t++)
+      threads[t].join();
+  }
+  for (int t = 0; t < num_threads; t++)
+    if (errors[t])
+      std::rethrow_exception(errors[t]);
+  return solved;
+}
+
+
 pyne_enr::Cascade pyne_enr::multicomponent(pyne_enr::Cascade & orig_casc, \
                                     char * solver, double tolerance, int max_iter) {
   std::string strsolver(solver);
@@ -10,6 +10,10 @@
 #include "enrichment_symbolic.h"
 #endif
 
+#include <cstddef>
+#include <string>
+#include <vector>
+
 /************************************************/
 /*** Enrichment Component Class and Functions ***/
 /************************************************/
@@ -53,6 +57,42 @@ namespace enrichment {
   /// enrichments \a x_feed, \a x_prod, and \a x_tails.
   double swu_per_tail(double x_feed, double x_prod, double x_tail);
 
+  /// \name Batch Flow Rate and SWU Functions
+  /// \{
+  /// These compute the functions above for \a n enrichment points at once,
+  /// reading the i-th point from \a x_feed[i], \a x_prod[i], and \a x_tail[i]
+  /// and writing its result to \a out[i]. The loops vectorize, with the logs
+  /// of the value function taken by a branch-free log. The ratios and
+  /// value_func_n() agree with the scalar functions to within 2 ulp. The SWU
+  /// functions sum three value functions weighted by flow ratios, which
+  /// cancel as the feed assay nears the tails or product assay. They agree
+  /// with the scalar functions to within 4 DBL_EPSILON times the sum of the
+  /// magnitudes of the three terms, so only to about 1e-13 relative while
+  /// the terms cancel by less than a factor of 100; the scalar functions
+  /// lose the same digits there. Points with an assay outside of
+  /// [DBL_MIN, 1) go through the scalar SWU and value functions.
+  void feed_per_prod_n(const double * x_feed, const double * x_prod,
+                       const double * x_tail, double * out, size_t n);
+  void feed_per_tail_n(const double * x_feed, const double * x_prod,
+                       const double * x_tail, double * out, size_t n);
+  void prod_per_feed_n(const double * x_feed, const double * x_prod,
+                       const double * x_tail, double * out, size_t n);
+  void prod_per_tail_n(const double * x_feed, const double * x_prod,
+                       const double * x_tail, double * out, size_t n);
+  void tail_per_feed_n(const double * x_feed, const double * x_prod,
+                       const double * x_tail, double * out, size_t n);
+  void tail_per_prod_n(const double * x_feed, const double * x_prod,
+                       const double * x_tail, double * out, size_t n);
+  /// Computes value_func() of the \a n assays \a x into \a out.
+  void value_func_n(const double * x, double * out, size_t n);
+  void swu_per_feed_n(const double * x_feed, const double * x_prod,
+                      const double * x_tail, double * out, size_t n);
+  void swu_per_prod_n(const double * x_feed, const double * x_prod,
+                      const double * x_tail, double * out, size_t n);
+  void swu_per_tail_n(const double * x_feed, const double * x_prod,
+                      const double * x_tail, double * out, size_t n);
+  /// \}
+
   /// Computes the nuclide-specific stage separation factor from the
   /// overall stage separation factor \a alpha, the key mass \a Mstar,
   /// and the nulide's atomic mass \a M_i.
@@ -101,6 +141,14 @@ namespace enrichment {
   /// \param casc Input cascade.
   /// \param i nuclide in id form.
   double _deltaU_i_OverG(Cascade & casc, int i);
+  /// Runs solve_numeric() on the dense arrays of \a casc, without building any
+  /// Material during the iterations. The results match those of the Cascade
+  /// version.
+  /// \param casc Cascade instance, modified in-place.
+  /// \param tolerance Maximum numerical error allowed in L/F, N, and M.
+  /// \param max_iter Maximum number of iterations for to perform.
+  void solve_numeric(DenseCascade & casc, double tolerance=1.0E-7,
+                     int max_iter=100);
   /// \}
 
   /// \name Multicomponent Functions
@@ -118,6 +166,29 @@ namespace enrichment {
                          double tolerance=1.0E-7, int max_iter=100);
   Cascade multicomponent(Cascade & orig_casc, std::string solver="symbolic",
                          double tolerance=1.0E-7, int max_iter=100);
+  /// Runs multicomponent() on each of \a cascs, spreading them over
+  /// \a num_threads threads, and returns the solved cascades in input order.
+  /// Each thread takes a contiguous run of the cascades, so a sweep over a
+  /// parameter keeps neighboring cascades together. With \a warm_start, a
+  /// cascade whose key components and feed nuclides match those of the one
+  /// solved just before it starts from that solution's N and M instead of its
+  /// own, which saves most of the numeric solver's iterations in a smooth
+  /// sweep. The results then agree with multicomponent() to the accuracy of
+  /// its Mstar search rather than exactly. The iterations work on
+  /// DenseCascade arrays.
+  /// \param cascs Input cascades.
+  /// \param solver flag for solver to use, may be 'symbolic' or 'numeric'.
+  /// \param tolerance Maximum numerical error allowed in L/F, N, and M.
+  /// \param max_iter Maximum number of iterations for to perform.
+  /// \param warm_start Whether to start from the previous solution.
+  /// \param num_threads Number of threads, or 0 for one per hardware thread.
+  /// \return The solved cascades.
+  std::vector<Cascade> multicomponent_many(const std::vector<Cascade> & cascs,
+                                           std::string solver="symbolic",
+                                           double tolerance=1.0E-7,
+                                           int max_iter=100,
+                                           bool warm_start=true,
+                                           int num_threads=0);
   /// \}
 
   /// Custom exception for when an enrichment solver has entered an infinite loop.
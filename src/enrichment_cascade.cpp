@@ -43,3 +43,118 @@ void pyne_enr::Cascade::_reset_xjs() {
   x_tail_j = mat_tail.comp[j];
 }
 
+
+
+pyne_enr::DenseCascade::DenseCascade() {
+  alpha = 0.0;
+  Mstar = 0.0;
+  N = 0.0;
+  M = 0.0;
+  x_prod_j = 0.0;
+  x_tail_j = 0.0;
+  feed_mass = 0.0;
+
+  j = 0;
+  k = 0;
+  jdx = 0;
+  kdx = 0;
+
+  prod_mass = 0.0;
+  tail_mass = 0.0;
+  l_t_per_feed = 0.0;
+  swu_per_feed = 0.0;
+  swu_per_prod = 0.0;
+}
+
+
+pyne_enr::DenseCascade::DenseCascade(const pyne_enr::Cascade & casc) {
+  alpha = casc.alpha;
+  Mstar = casc.Mstar;
+  N = casc.N;
+  M = casc.M;
+  x_prod_j = casc.x_prod_j;
+  x_tail_j = casc.x_tail_j;
+  feed_mass = casc.mat_feed.mass;
+  j = casc.j;
+  k = casc.k;
+
+  // the map solvers read the key components with operator[], which inserts
+  // them, so they take part in the stream sums the same way here
+  pyne::comp_map cm = casc.mat_feed.comp;
+  cm.insert(std::make_pair(j, 0.0));
+  cm.insert(std::make_pair(k, 0.0));
+
+  nucs.reserve(cm.size());
+  mw.reserve(cm.size());
+  x_feed.reserve(cm.size());
+  for (pyne::comp_iter i = cm.begin(); i != cm.end(); i++) {
+    if (i->first == j)
+      jdx = nucs.size();
+    if (i->first == k)
+      kdx = nucs.size();
+    nucs.push_back(i->first);
+    mw.push_back(pyne::atomic_mass(i->first));
+    x_feed.push_back(i->second);
+  }
+  x_prod.assign(nucs.size(), 0.0);
+  x_tail.assign(nucs.size(), 0.0);
+
+  prod_mass = casc.mat_prod.mass;
+  tail_mass = casc.mat_tail.mass;
+  l_t_per_feed = casc.l_t_per_feed;
+  swu_per_feed = casc.swu_per_feed;
+  swu_per_prod = casc.swu_per_prod;
+}
+
+
+pyne_enr::Cascade pyne_enr::DenseCascade::to_cascade(
+    const pyne_enr::Cascade & casc) const {
+  pyne_enr::Cascade out = casc;
+  out.Mstar = Mstar;
+  out.N = N;
+  out.M = M;
+
+  // the fractions are already normalized, so they are set directly rather
+  // than through the Material constructor, which would normalize them again
+  pyne::comp_map comp_prod;
+  pyne::comp_map comp_tail;
+  for (size_t i = 0; i < nucs.size(); i++) {
+    comp_prod.insert(comp_prod.end(), std::make_pair(nucs[i], x_prod[i]));
+    comp_tail.insert(comp_tail.end(), std::make_pair(nucs[i], x_tail[i]));
+  }
+  out.mat_prod = pyne::Material();
+  out.mat_prod.comp = comp_prod;
+  out.mat_prod.mass = prod_mass;
+  out.mat_tail = pyne::Material();
+  out.mat_tail.comp = comp_tail;
+  out.mat_tail.mass = tail_mass;
+
+  out.l_t_per_feed = l_t_per_feed;
+  out.swu_per_feed = swu_per_feed;
+  out.swu_per_prod = swu_per_prod;
+  return out;
+}
+
+
+void pyne_enr::DenseCascade::from_cascade(const pyne_enr::Cascade & casc) {
+  Mstar = casc.Mstar;
+  N = casc.N;
+  M = casc.M;
+  for (size_t i = 0; i < nucs.size(); i++) {
+    pyne::comp_map::const_iterator p = casc.mat_prod.comp.find(nucs[i]);
+    pyne::comp_map::const_iterator t = casc.mat_tail.comp.find(nucs[i]);
+    x_prod[i] = p == casc.mat_prod.comp.end() ? 0.0 : p->second;
+    x_tail[i] = t == casc.mat_tail.comp.end() ? 0.0 : t->second;
+  }
+  prod_mass = casc.mat_prod.mass;
+  tail_mass = casc.mat_tail.mass;
+  l_t_per_feed = casc.l_t_per_feed;
+  swu_per_feed = casc.swu_per_feed;
+  swu_per_prod = casc.swu_per_prod;
+}
+
+
+bool pyne_enr::DenseCascade::same_shape(
+    const pyne_enr::DenseCascade & other) const {
+  return j == other.j && k == other.k && nucs == other.nucs;
+}
@@ -10,6 +10,8 @@
 #include "material.h"
 #endif
 
+#include <vector>
+
 /************************************************/
 /*** Enrichment Component Class and Functions ***/
 /************************************************/
@@ -55,6 +57,56 @@ namespace enrichment {
     void _reset_xjs();  ///< Sets #x_feed_j to #j-th value of #mat_feed.
   };
 
+  /// A cascade whose streams are dense arrays over the feed nuclides, in id
+  /// order, rather than Materials. The cascade solvers work on this form so
+  /// that their iterations only touch flat arrays.
+  class DenseCascade
+  {
+
+  public:
+
+    /// default constructor
+    DenseCascade();
+    /// Builds the arrays from the feed material of \a casc. The key
+    /// components are added with a zero fraction if the feed lacks them.
+    DenseCascade(const Cascade & casc);
+
+    /// Returns a copy of \a casc carrying the solved stage numbers, flow rates
+    /// and product and tails materials of this cascade.
+    Cascade to_cascade(const Cascade & casc) const;
+    /// Reads the solved stage numbers, flow rates and streams from \a casc,
+    /// which must have the same feed nuclides as this cascade.
+    void from_cascade(const Cascade & casc);
+    /// Returns true if \a other has the same key components and feed nuclides.
+    bool same_shape(const DenseCascade & other) const;
+
+    // Attributes
+    double alpha; ///< stage separation factor
+    double Mstar; ///< mass separation factor
+    double N; ///< number of enriching stages
+    double M; ///< number of stripping stages
+    double x_prod_j; ///< target enrichment of the key component in the product
+    double x_tail_j; ///< target enrichment of the key component in the tails
+    double feed_mass; ///< mass of the feed stream
+
+    int j; ///< Component to enrich, id form
+    int k; ///< Component to de-enrich, id form
+    int jdx; ///< index of #j in the arrays
+    int kdx; ///< index of #k in the arrays
+
+    std::vector<int> nucs; ///< feed nuclide ids, sorted
+    std::vector<double> mw; ///< atomic masses of #nucs
+    std::vector<double> x_feed; ///< feed mass fractions
+    std::vector<double> x_prod; ///< normalized product mass fractions
+    std::vector<double> x_tail; ///< normalized tails mass fractions
+
+    double prod_mass; ///< product stream mass
+    double tail_mass; ///< tails stream mass
+    double l_t_per_feed; ///< Total flow rate per feed rate.
+    double swu_per_feed; ///< This is the SWU for 1 kg of Feed material.
+    double swu_per_prod; ///< This is the SWU for 1 kg of Product material.
+  };
+
 // end enrichment
 }
 // end pyne
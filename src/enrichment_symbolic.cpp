@@ -1 +1,180 @@
-#include "enrichment_symbolic40.cpp"
+// Symbolic Enrichment Functions
+#include <vector>
+
+#ifndef PYNE_IS_AMALGAMATED
+#include "enrichment_symbolic.h"
+#endif
+
+namespace pyne_enr = pyne::enrichment;
+
+namespace {
+
+// A value with its first and second derivatives with respect to the number of
+// enriching stages, which carries the Taylor coefficients of the NP
+// constraint through its terms.
+struct Jet2 {
+  double v;
+  double d;
+  double dd;
+  Jet2(double v_=0.0, double d_=0.0, double dd_=0.0) : v(v_), d(d_), dd(dd_) {};
+};
+
+inline Jet2 operator+(const Jet2 & a, const Jet2 & b) {
+  return Jet2(a.v + b.v, a.d + b.d, a.dd + b.dd);
+}
+
+inline Jet2 operator+(const Jet2 & a, double s) {
+  return Jet2(a.v + s, a.d, a.dd);
+}
+
+inline Jet2 operator-(const Jet2 & a, const Jet2 & b) {
+  return Jet2(a.v - b.v, a.d - b.d, a.dd - b.dd);
+}
+
+inline Jet2 operator-(double s, const Jet2 & a) {
+  return Jet2(s - a.v, -a.d, -a.dd);
+}
+
+inline Jet2 operator*(const Jet2 & a, double s) {
+  return Jet2(a.v * s, a.d * s, a.dd * s);
+}
+
+inline Jet2 operator*(const Jet2 & a, const Jet2 & b) {
+  return Jet2(a.v * b.v, a.d * b.v + a.v * b.d,
+              a.dd * b.v + 2.0 * a.d * b.d + a.v * b.dd);
+}
+
+inline Jet2 operator/(const Jet2 & a, double s) {
+  return Jet2(a.v / s, a.d / s, a.dd / s);
+}
+
+inline Jet2 operator/(const Jet2 & a, const Jet2 & b) {
+  double q = a.v / b.v;
+  double dq = (a.d - q * b.d) / b.v;
+  return Jet2(q, dq, (a.dd - 2.0 * dq * b.d - q * b.dd) / b.v);
+}
+
+inline Jet2 jet_exp(const Jet2 & a) {
+  double e = exp(a.v);
+  return Jet2(e, e * a.d, e * (a.dd + a.d * a.d));
+}
+
+inline Jet2 jet_log(const Jet2 & a) {
+  double r = a.d / a.v;
+  return Jet2(log(a.v), r, a.dd / a.v - r * r);
+}
+
+}  // namespace
+
+
+void pyne_enr::solve_symbolic(pyne_enr::DenseCascade & casc) {
+  int ncomp = casc.nucs.size();
+  int jdx = casc.jdx;
+  int kdx = casc.kdx;
+  double alpha = casc.alpha;
+  double NP0 = casc.N;
+  double Mstar = casc.Mstar;
+  double xPj = casc.x_prod_j;
+  double xTj = casc.x_tail_j;
+  double xFj = casc.x_feed[jdx];
+  double MWj = casc.mw[jdx];
+  const std::vector<double> & xF = casc.x_feed;
+  double ppf = (xFj - xTj) / (xPj - xTj);
+  double tpf = (xFj - xPj) / (xTj - xPj);
+
+  // alphastar_i and its log for each nuclide, every power of alphastar_i
+  // below is taken through the log
+  static thread_local std::vector<double> beta;
+  static thread_local std::vector<double> log_beta;
+  beta.resize(ncomp);
+  log_beta.resize(ncomp);
+  double log_alpha = log(alpha);
+  for (int i = 0; i < ncomp; i++) {
+    log_beta[i] = (Mstar - casc.mw[i]) * log_alpha;
+    beta[i] = exp(log_beta[i]);
+  }
+
+  // NT as a function of NP, the product constraint solved for NT
+  double nt_denom = (MWj - Mstar) * log_alpha;
+  double nt_const = -MWj*log_alpha + Mstar*log_alpha + log(xTj) + \
+                    log((-1.0 + xPj/xFj) / (xPj - xTj));
+  double nt_ratio = (xFj*xPj - xPj*xTj) / (-xFj*xPj + xFj*xTj);
+
+  // the tails constraint xT_j - xTj * sum(xT) and its first two derivatives
+  // at the initial guess NP0
+  Jet2 NP(NP0, 1.0, 0.0);
+  Jet2 NT = (nt_const - jet_log(jet_exp(NP * nt_denom) * nt_ratio + 1.0)) / \
+            nt_denom;
+  Jet2 xT_j;
+  Jet2 xT_sum;
+  for (int i = 0; i < ncomp; i++) {
+    Jet2 beta_np = jet_exp(NP * -log_beta[i]);
+    Jet2 beta_nt = jet_exp((NT + 1.0) * log_beta[i]);
+    Jet2 xT_i = (1.0 - beta_np) * (xF[i] / tpf) / (beta_nt - beta_np);
+    xT_sum = xT_sum + xT_i;
+    if (i == jdx)
+      xT_j = xT_i;
+  }
+  Jet2 np_constraint = xT_j - xT_sum * xTj;
+
+  // second order Taylor polynomial a*NP**2 + b*NP + c, whose smaller root is
+  // the new NP. The absolute value guards against a discriminant that is
+  // zero but has come out slightly negative.
+  double a = np_constraint.dd / 2.0;
+  double b = np_constraint.d - 2.0*NP0*a;
+  double c = np_constraint.v - NP0*np_constraint.d + NP0*NP0*a;
+  double NP_sqrt_base = fabs(b*b - 4.0*a*c);
+  double NP1 = (-b - sqrt(NP_sqrt_base)) / (2.0*a);
+  double NT1 = (nt_const - log(exp(NP1 * nt_denom) * nt_ratio + 1.0)) / nt_denom;
+
+  // product and tails streams
+  std::vector<double> & xP = casc.x_prod;
+  std::vector<double> & xT = casc.x_tail;
+  for (int i = 0; i < ncomp; i++) {
+    double beta_np = exp(-NP1 * log_beta[i]);
+    double beta_nt = exp((NT1 + 1.0) * log_beta[i]);
+    xP[i] = (xF[i] / ppf) * (beta_nt - 1.0) / (beta_nt - beta_np);
+    xT[i] = (xF[i] / tpf) * (1.0 - beta_np) / (beta_nt - beta_np);
+  }
+
+  // flow rates, from the unnormalized streams
+  double log_rfeed = log(xFj / xF[kdx]);
+  double log_rprod = log(xPj / xP[kdx]);
+  double log_rtail = log(xTj / xT[kdx]);
+  double LpF = 0.0;
+  double swu = 0.0;
+  for (int i = 0; i < ncomp; i++) {
+    double numer = ppf*xP[i]*log_rprod + tpf*xT[i]*log_rtail - xF[i]*log_rfeed;
+    LpF += numer / (log_beta[jdx] * ((beta[i] - 1.0) / (beta[i] + 1.0)));
+    swu += numer;
+  }
+
+  // must renormalize to eliminate numerical error
+  double prod_sum = 0.0;
+  double tail_sum = 0.0;
+  for (int i = 0; i < ncomp; i++) {
+    prod_sum += xP[i];
+    tail_sum += xT[i];
+  }
+  for (int i = 0; i < ncomp; i++) {
+    if (prod_sum != 1.0 && prod_sum != 0.0)
+      xP[i] = xP[i] / prod_sum;
+    if (tail_sum != 1.0 && tail_sum != 0.0)
+      xT[i] = xT[i] / tail_sum;
+  }
+  casc.prod_mass = ppf;
+  casc.tail_mass = tpf;
+
+  casc.N = NP1;
+  casc.M = NT1;
+  casc.l_t_per_feed = LpF;
+  casc.swu_per_feed = -1.0 * swu;
+  casc.swu_per_prod = -1.0 * swu / ppf;
+}
+
+
+pyne_enr::Cascade pyne_enr::solve_symbolic(pyne_enr::Cascade & orig_casc) {
+  pyne_enr::DenseCascade casc(orig_casc);
+  solve_symbolic(casc);
+  return casc.to_cascade(orig_casc);
+}
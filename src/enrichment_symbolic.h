@@ -1,15 +1,16 @@
-
 /// \file enrichment_symbolic.h
 /// \author Anthony Scopatz (scopatz\@gmail.com)
 ///
 /// \brief A multicomponent enrichment cascade solver using
 ///     a symbolic solution to the mass flow rate equations.
-
-/*********************************************************/
-/***            Symbolic Enrichment Functions          ***/
-/*** WARNING: This file is auto-generated.             ***/
-/***                  DO NOT MODIFY!!!                 ***/
-/*********************************************************/
+///
+/// The solution is the one derived by pyne/apigen/enrich_multi_sym.py: the
+/// number of enriching stages comes from a second order Taylor expansion of
+/// the tails constraint about the initial guess, and the number of stripping
+/// stages from the closed form of the product constraint. Rather than the
+/// generated straight-line code for each number of components, the solver
+/// evaluates these expressions over dense arrays of the feed nuclides, with
+/// the derivatives taken in forward mode, so it handles any number of them.
 
 #ifndef PYNE_OU4PO4TJDBDM5PY4VKAVL7JCSM
 #define PYNE_OU4PO4TJDBDM5PY4VKAVL7JCSM
@@ -23,13 +24,17 @@
 namespace pyne {
 namespace enrichment {
 
-  /// A multicomponent enrichment cascade solver using 
+  /// A multicomponent enrichment cascade solver using
   /// a symbolic solution to the mass flow rate equations.
   /// \param orig_casc The original state of the cascade.
   /// \return A cascade solved for new N, M, and total flow
   ///         rates.
   Cascade solve_symbolic(Cascade & orig_casc);
 
+  /// Runs solve_symbolic() on the dense arrays of \a casc.
+  /// \param casc Cascade instance, modified in-place.
+  void solve_symbolic(DenseCascade & casc);
+
 // end enrichment
 }
 // end pyne
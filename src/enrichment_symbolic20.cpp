@@ -1,10443 +0,0 @@
-
-/*********************************************************/
-/***            Symbolic Enrichment Functions          ***/
-/*** WARNING: This file is auto-generated.             ***/
-/***                  DO NOT MODIFY!!!                 ***/
-/*********************************************************/
-#ifndef PYNE_IS_AMALGAMATED
-#include "enrichment_symbolic.h"
-#endif
-
-pyne::enrichment::Cascade pyne::enrichment::solve_symbolic(pyne::enrichment::Cascade & orig_casc)
-{
-  pyne::enrichment::Cascade casc = orig_casc;
-  int j = casc.j;
-  int k = casc.k;
-  double alpha = casc.alpha;
-  double NP0 = casc.N;
-  //double NT0 = casc.M;
-  double Mstar = casc.Mstar;
-  double xPj = casc.x_prod_j;
-  //double xFj = casc.x_feed_j;
-  double xTj = casc.x_tail_j;
-  int ncomp = casc.mat_feed.comp.size();
-  double LpF = -1.0, PpF = -1.0, TpF = -1.0,
-         SWUpF = -1.0, SWUpP = -1.0,
-         NP_b = -1.0, NP_sqrt_base = -1.0, NP_2a = -1.0,
-         NP1 = -1.0, NT1 = -1.0;
-  double * MW = new double [ncomp];
-  double * xP = new double [ncomp];
-  double * xF = new double [ncomp];
-  double * xT = new double [ncomp];
-  double n538 = 0.0,
-         n539 = 0.0,
-         n536 = 0.0,
-         n537 = 0.0,
-         n534 = 0.0,
-         n535 = 0.0,
-         n532 = 0.0,
-         n533 = 0.0,
-         n530 = 0.0,
-         n531 = 0.0,
-         n408 = 0.0,
-         n409 = 0.0,
-         n402 = 0.0,
-         n403 = 0.0,
-         n400 = 0.0,
-         n401 = 0.0,
-         n406 = 0.0,
-         n407 = 0.0,
-         n404 = 0.0,
-         n405 = 0.0,
-         n392 = 0.0,
-         n393 = 0.0,
-         n390 = 0.0,
-         n391 = 0.0,
-         n396 = 0.0,
-         n397 = 0.0,
-         n394 = 0.0,
-         n395 = 0.0,
-         n398 = 0.0,
-         n399 = 0.0,
-         n240 = 0.0,
-         n241 = 0.0,
-         n242 = 0.0,
-         n243 = 0.0,
-         n244 = 0.0,
-         n245 = 0.0,
-         n246 = 0.0,
-         n247 = 0.0,
-         n248 = 0.0,
-         n249 = 0.0,
-         n499 = 0.0,
-         n498 = 0.0,
-         n329 = 0.0,
-         n328 = 0.0,
-         n327 = 0.0,
-         n326 = 0.0,
-         n325 = 0.0,
-         n324 = 0.0,
-         n323 = 0.0,
-         n322 = 0.0,
-         n321 = 0.0,
-         n320 = 0.0,
-         n149 = 0.0,
-         n148 = 0.0,
-         n143 = 0.0,
-         n142 = 0.0,
-         n141 = 0.0,
-         n140 = 0.0,
-         n147 = 0.0,
-         n146 = 0.0,
-         n145 = 0.0,
-         n144 = 0.0,
-         n74 = 0.0,
-         n75 = 0.0,
-         n76 = 0.0,
-         n77 = 0.0,
-         n70 = 0.0,
-         n71 = 0.0,
-         n72 = 0.0,
-         n73 = 0.0,
-         n78 = 0.0,
-         n79 = 0.0,
-         n615 = 0.0,
-         g128 = 0.0,
-         g129 = 0.0,
-         g126 = 0.0,
-         g127 = 0.0,
-         g124 = 0.0,
-         g125 = 0.0,
-         g122 = 0.0,
-         g123 = 0.0,
-         g120 = 0.0,
-         g121 = 0.0,
-         g221 = 0.0,
-         g220 = 0.0,
-         g223 = 0.0,
-         g222 = 0.0,
-         g225 = 0.0,
-         g224 = 0.0,
-         g227 = 0.0,
-         g226 = 0.0,
-         g229 = 0.0,
-         g228 = 0.0,
-         g254 = 0.0,
-         g255 = 0.0,
-         g256 = 0.0,
-         g257 = 0.0,
-         g319 = 0.0,
-         g251 = 0.0,
-         g252 = 0.0,
-         g253 = 0.0,
-         g315 = 0.0,
-         g314 = 0.0,
-         g317 = 0.0,
-         g316 = 0.0,
-         g258 = 0.0,
-         g259 = 0.0,
-         g313 = 0.0,
-         g312 = 0.0,
-         g19 = 0.0,
-         g18 = 0.0,
-         g17 = 0.0,
-         g16 = 0.0,
-         g15 = 0.0,
-         g14 = 0.0,
-         g13 = 0.0,
-         g12 = 0.0,
-         g11 = 0.0,
-         g10 = 0.0,
-         n529 = 0.0,
-         n528 = 0.0,
-         n521 = 0.0,
-         n520 = 0.0,
-         n523 = 0.0,
-         n522 = 0.0,
-         n525 = 0.0,
-         n524 = 0.0,
-         n527 = 0.0,
-         n526 = 0.0,
-         n415 = 0.0,
-         n414 = 0.0,
-         n417 = 0.0,
-         n416 = 0.0,
-         n411 = 0.0,
-         n410 = 0.0,
-         n413 = 0.0,
-         n412 = 0.0,
-         n419 = 0.0,
-         n418 = 0.0,
-         n558 = 0.0,
-         n559 = 0.0,
-         n554 = 0.0,
-         n555 = 0.0,
-         n556 = 0.0,
-         n557 = 0.0,
-         n550 = 0.0,
-         n551 = 0.0,
-         n552 = 0.0,
-         n553 = 0.0,
-         n389 = 0.0,
-         n388 = 0.0,
-         n385 = 0.0,
-         n384 = 0.0,
-         n387 = 0.0,
-         n386 = 0.0,
-         n381 = 0.0,
-         n380 = 0.0,
-         n383 = 0.0,
-         n382 = 0.0,
-         n253 = 0.0,
-         n252 = 0.0,
-         n251 = 0.0,
-         n250 = 0.0,
-         n257 = 0.0,
-         n256 = 0.0,
-         n255 = 0.0,
-         n254 = 0.0,
-         n259 = 0.0,
-         n258 = 0.0,
-         n318 = 0.0,
-         n319 = 0.0,
-         n312 = 0.0,
-         n313 = 0.0,
-         n310 = 0.0,
-         n311 = 0.0,
-         n316 = 0.0,
-         n317 = 0.0,
-         n314 = 0.0,
-         n315 = 0.0,
-         n176 = 0.0,
-         n177 = 0.0,
-         n174 = 0.0,
-         n175 = 0.0,
-         n172 = 0.0,
-         n173 = 0.0,
-         n170 = 0.0,
-         n171 = 0.0,
-         n178 = 0.0,
-         n179 = 0.0,
-         n49 = 0.0,
-         n48 = 0.0,
-         n41 = 0.0,
-         n40 = 0.0,
-         n43 = 0.0,
-         n42 = 0.0,
-         n45 = 0.0,
-         n44 = 0.0,
-         n47 = 0.0,
-         n46 = 0.0,
-         g139 = 0.0,
-         g138 = 0.0,
-         g131 = 0.0,
-         g130 = 0.0,
-         g133 = 0.0,
-         g132 = 0.0,
-         g135 = 0.0,
-         g134 = 0.0,
-         g137 = 0.0,
-         g136 = 0.0,
-         n294 = 0.0,
-         g97 = 0.0,
-         g96 = 0.0,
-         g95 = 0.0,
-         g94 = 0.0,
-         g93 = 0.0,
-         g92 = 0.0,
-         g91 = 0.0,
-         g90 = 0.0,
-         g144 = 0.0,
-         g145 = 0.0,
-         g146 = 0.0,
-         g147 = 0.0,
-         g140 = 0.0,
-         g141 = 0.0,
-         g99 = 0.0,
-         g98 = 0.0,
-         g247 = 0.0,
-         g246 = 0.0,
-         g245 = 0.0,
-         g244 = 0.0,
-         g243 = 0.0,
-         g242 = 0.0,
-         g241 = 0.0,
-         g240 = 0.0,
-         g360 = 0.0,
-         g249 = 0.0,
-         g248 = 0.0,
-         n495 = 0.0,
-         n494 = 0.0,
-         n497 = 0.0,
-         n496 = 0.0,
-         n491 = 0.0,
-         n490 = 0.0,
-         n493 = 0.0,
-         n492 = 0.0,
-         g159 = 0.0,
-         g83 = 0.0,
-         g88 = 0.0,
-         g89 = 0.0,
-         n460 = 0.0,
-         n461 = 0.0,
-         n462 = 0.0,
-         n463 = 0.0,
-         n464 = 0.0,
-         n465 = 0.0,
-         n466 = 0.0,
-         n467 = 0.0,
-         n468 = 0.0,
-         n469 = 0.0,
-         n549 = 0.0,
-         n548 = 0.0,
-         n547 = 0.0,
-         n546 = 0.0,
-         n545 = 0.0,
-         n544 = 0.0,
-         n543 = 0.0,
-         n542 = 0.0,
-         n541 = 0.0,
-         n540 = 0.0,
-         n341 = 0.0,
-         n340 = 0.0,
-         n343 = 0.0,
-         n342 = 0.0,
-         n345 = 0.0,
-         n344 = 0.0,
-         n347 = 0.0,
-         n346 = 0.0,
-         n305 = 0.0,
-         n304 = 0.0,
-         n307 = 0.0,
-         n306 = 0.0,
-         n301 = 0.0,
-         n300 = 0.0,
-         n268 = 0.0,
-         n269 = 0.0,
-         n266 = 0.0,
-         n267 = 0.0,
-         n264 = 0.0,
-         n265 = 0.0,
-         n309 = 0.0,
-         n263 = 0.0,
-         n260 = 0.0,
-         n261 = 0.0,
-         n284 = 0.0,
-         n285 = 0.0,
-         n286 = 0.0,
-         n287 = 0.0,
-         n280 = 0.0,
-         n281 = 0.0,
-         n282 = 0.0,
-         n283 = 0.0,
-         n288 = 0.0,
-         n289 = 0.0,
-         n161 = 0.0,
-         n160 = 0.0,
-         n163 = 0.0,
-         n162 = 0.0,
-         n165 = 0.0,
-         n164 = 0.0,
-         n167 = 0.0,
-         n166 = 0.0,
-         n169 = 0.0,
-         n168 = 0.0,
-         n608 = 0.0,
-         n609 = 0.0,
-         n600 = 0.0,
-         n601 = 0.0,
-         n602 = 0.0,
-         n603 = 0.0,
-         n604 = 0.0,
-         n605 = 0.0,
-         n606 = 0.0,
-         n515 = 0.0,
-         n58 = 0.0,
-         n59 = 0.0,
-         n56 = 0.0,
-         n57 = 0.0,
-         n54 = 0.0,
-         n55 = 0.0,
-         n52 = 0.0,
-         n53 = 0.0,
-         n50 = 0.0,
-         n51 = 0.0,
-         n518 = 0.0,
-         n519 = 0.0,
-         n114 = 0.0,
-         n115 = 0.0,
-         n116 = 0.0,
-         n117 = 0.0,
-         n110 = 0.0,
-         n111 = 0.0,
-         n112 = 0.0,
-         n113 = 0.0,
-         n118 = 0.0,
-         n119 = 0.0,
-         n29 = 0.0,
-         n28 = 0.0,
-         n23 = 0.0,
-         n22 = 0.0,
-         n21 = 0.0,
-         n20 = 0.0,
-         n27 = 0.0,
-         n26 = 0.0,
-         n25 = 0.0,
-         n24 = 0.0,
-         g84 = 0.0,
-         g85 = 0.0,
-         g86 = 0.0,
-         g87 = 0.0,
-         g80 = 0.0,
-         g81 = 0.0,
-         g82 = 0.0,
-         g158 = 0.0,
-         g157 = 0.0,
-         g156 = 0.0,
-         g155 = 0.0,
-         g154 = 0.0,
-         g153 = 0.0,
-         g152 = 0.0,
-         g151 = 0.0,
-         g150 = 0.0,
-         g272 = 0.0,
-         g273 = 0.0,
-         g270 = 0.0,
-         g271 = 0.0,
-         g276 = 0.0,
-         g277 = 0.0,
-         g274 = 0.0,
-         g275 = 0.0,
-         g278 = 0.0,
-         g279 = 0.0,
-         g31 = 0.0,
-         g30 = 0.0,
-         g33 = 0.0,
-         g32 = 0.0,
-         g35 = 0.0,
-         g34 = 0.0,
-         g37 = 0.0,
-         g36 = 0.0,
-         g39 = 0.0,
-         g38 = 0.0,
-         n486 = 0.0,
-         n487 = 0.0,
-         n488 = 0.0,
-         n489 = 0.0,
-         g148 = 0.0,
-         g149 = 0.0,
-         n473 = 0.0,
-         n472 = 0.0,
-         n471 = 0.0,
-         n470 = 0.0,
-         n477 = 0.0,
-         n476 = 0.0,
-         n475 = 0.0,
-         n474 = 0.0,
-         n479 = 0.0,
-         n478 = 0.0,
-         n578 = 0.0,
-         n579 = 0.0,
-         n572 = 0.0,
-         n573 = 0.0,
-         n570 = 0.0,
-         n571 = 0.0,
-         n576 = 0.0,
-         n577 = 0.0,
-         n574 = 0.0,
-         n575 = 0.0,
-         g142 = 0.0,
-         g143 = 0.0,
-         n370 = 0.0,
-         n371 = 0.0,
-         n372 = 0.0,
-         n373 = 0.0,
-         n374 = 0.0,
-         n375 = 0.0,
-         n376 = 0.0,
-         n377 = 0.0,
-         n378 = 0.0,
-         n379 = 0.0,
-         n273 = 0.0,
-         n272 = 0.0,
-         n275 = 0.0,
-         n274 = 0.0,
-         n277 = 0.0,
-         n276 = 0.0,
-         n424 = 0.0,
-         n357 = 0.0,
-         n426 = 0.0,
-         n297 = 0.0,
-         n296 = 0.0,
-         n295 = 0.0,
-         n427 = 0.0,
-         n293 = 0.0,
-         n292 = 0.0,
-         n291 = 0.0,
-         n290 = 0.0,
-         n420 = 0.0,
-         n299 = 0.0,
-         n421 = 0.0,
-         n422 = 0.0,
-         n351 = 0.0,
-         n198 = 0.0,
-         n199 = 0.0,
-         n194 = 0.0,
-         n195 = 0.0,
-         n196 = 0.0,
-         n197 = 0.0,
-         n190 = 0.0,
-         n191 = 0.0,
-         n192 = 0.0,
-         n193 = 0.0,
-         n619 = 0.0,
-         n618 = 0.0,
-         n208 = 0.0,
-         n209 = 0.0,
-         n204 = 0.0,
-         n205 = 0.0,
-         n206 = 0.0,
-         n207 = 0.0,
-         n200 = 0.0,
-         n201 = 0.0,
-         n202 = 0.0,
-         n203 = 0.0,
-         n107 = 0.0,
-         n106 = 0.0,
-         n105 = 0.0,
-         n104 = 0.0,
-         n103 = 0.0,
-         n102 = 0.0,
-         n101 = 0.0,
-         n100 = 0.0,
-         n0 = 0.0,
-         n1 = 0.0,
-         n2 = 0.0,
-         n3 = 0.0,
-         n4 = 0.0,
-         n5 = 0.0,
-         n6 = 0.0,
-         n7 = 0.0,
-         n563 = 0.0,
-         n562 = 0.0,
-         n38 = 0.0,
-         n39 = 0.0,
-         n30 = 0.0,
-         n31 = 0.0,
-         n32 = 0.0,
-         n33 = 0.0,
-         n34 = 0.0,
-         n35 = 0.0,
-         n36 = 0.0,
-         n37 = 0.0,
-         n569 = 0.0,
-         n568 = 0.0,
-         g7 = 0.0,
-         g6 = 0.0,
-         g5 = 0.0,
-         g4 = 0.0,
-         g3 = 0.0,
-         g2 = 0.0,
-         g1 = 0.0,
-         g0 = 0.0,
-         g9 = 0.0,
-         g8 = 0.0,
-         g168 = 0.0,
-         g169 = 0.0,
-         n629 = 0.0,
-         g162 = 0.0,
-         g163 = 0.0,
-         g160 = 0.0,
-         g161 = 0.0,
-         g166 = 0.0,
-         g167 = 0.0,
-         g164 = 0.0,
-         g165 = 0.0,
-         n85 = 0.0,
-         n84 = 0.0,
-         n87 = 0.0,
-         n86 = 0.0,
-         n81 = 0.0,
-         n80 = 0.0,
-         n83 = 0.0,
-         n82 = 0.0,
-         n89 = 0.0,
-         n88 = 0.0,
-         g346 = 0.0,
-         g347 = 0.0,
-         g344 = 0.0,
-         g345 = 0.0,
-         g342 = 0.0,
-         g343 = 0.0,
-         g340 = 0.0,
-         g341 = 0.0,
-         g348 = 0.0,
-         g349 = 0.0,
-         g269 = 0.0,
-         g268 = 0.0,
-         g265 = 0.0,
-         g264 = 0.0,
-         g267 = 0.0,
-         g266 = 0.0,
-         g261 = 0.0,
-         g260 = 0.0,
-         g263 = 0.0,
-         g262 = 0.0,
-         g26 = 0.0,
-         g27 = 0.0,
-         g24 = 0.0,
-         g25 = 0.0,
-         g22 = 0.0,
-         g23 = 0.0,
-         g20 = 0.0,
-         g21 = 0.0,
-         g28 = 0.0,
-         g29 = 0.0,
-         g53 = 0.0,
-         g52 = 0.0,
-         g51 = 0.0,
-         g50 = 0.0,
-         g57 = 0.0,
-         g56 = 0.0,
-         g55 = 0.0,
-         g54 = 0.0,
-         g59 = 0.0,
-         g58 = 0.0,
-         n565 = 0.0,
-         n564 = 0.0,
-         n567 = 0.0,
-         n566 = 0.0,
-         n561 = 0.0,
-         n560 = 0.0,
-         n448 = 0.0,
-         n449 = 0.0,
-         n446 = 0.0,
-         n447 = 0.0,
-         n444 = 0.0,
-         n445 = 0.0,
-         n442 = 0.0,
-         n443 = 0.0,
-         n440 = 0.0,
-         n441 = 0.0,
-         n363 = 0.0,
-         n362 = 0.0,
-         n361 = 0.0,
-         n360 = 0.0,
-         n367 = 0.0,
-         n366 = 0.0,
-         n365 = 0.0,
-         n364 = 0.0,
-         n369 = 0.0,
-         n368 = 0.0,
-         n598 = 0.0,
-         n599 = 0.0,
-         n590 = 0.0,
-         n591 = 0.0,
-         n592 = 0.0,
-         n593 = 0.0,
-         n594 = 0.0,
-         n595 = 0.0,
-         n596 = 0.0,
-         n597 = 0.0,
-         n510 = 0.0,
-         n626 = 0.0,
-         n627 = 0.0,
-         n624 = 0.0,
-         n625 = 0.0,
-         n622 = 0.0,
-         n623 = 0.0,
-         n189 = 0.0,
-         n188 = 0.0,
-         n187 = 0.0,
-         n186 = 0.0,
-         n185 = 0.0,
-         n184 = 0.0,
-         n183 = 0.0,
-         n182 = 0.0,
-         n181 = 0.0,
-         n180 = 0.0,
-         n219 = 0.0,
-         n218 = 0.0,
-         n217 = 0.0,
-         n216 = 0.0,
-         n215 = 0.0,
-         n214 = 0.0,
-         n213 = 0.0,
-         n212 = 0.0,
-         n211 = 0.0,
-         n210 = 0.0,
-         n132 = 0.0,
-         n133 = 0.0,
-         n130 = 0.0,
-         n131 = 0.0,
-         n136 = 0.0,
-         n137 = 0.0,
-         n134 = 0.0,
-         n135 = 0.0,
-         n138 = 0.0,
-         n139 = 0.0,
-         g175 = 0.0,
-         g174 = 0.0,
-         g177 = 0.0,
-         g176 = 0.0,
-         g171 = 0.0,
-         g170 = 0.0,
-         g173 = 0.0,
-         g172 = 0.0,
-         g179 = 0.0,
-         g178 = 0.0,
-         n98 = 0.0,
-         n99 = 0.0,
-         n92 = 0.0,
-         n93 = 0.0,
-         n90 = 0.0,
-         n91 = 0.0,
-         n96 = 0.0,
-         n97 = 0.0,
-         n94 = 0.0,
-         n95 = 0.0,
-         g351 = 0.0,
-         g350 = 0.0,
-         g353 = 0.0,
-         g352 = 0.0,
-         g355 = 0.0,
-         g354 = 0.0,
-         g357 = 0.0,
-         g356 = 0.0,
-         g359 = 0.0,
-         g358 = 0.0,
-         g218 = 0.0,
-         g219 = 0.0,
-         g210 = 0.0,
-         g211 = 0.0,
-         g212 = 0.0,
-         g213 = 0.0,
-         g214 = 0.0,
-         g215 = 0.0,
-         g216 = 0.0,
-         g217 = 0.0,
-         g188 = 0.0,
-         g189 = 0.0,
-         g180 = 0.0,
-         g181 = 0.0,
-         g182 = 0.0,
-         g183 = 0.0,
-         g184 = 0.0,
-         g185 = 0.0,
-         g186 = 0.0,
-         g187 = 0.0,
-         g250 = 0.0,
-         g318 = 0.0,
-         g324 = 0.0,
-         g325 = 0.0,
-         g326 = 0.0,
-         g327 = 0.0,
-         g320 = 0.0,
-         g321 = 0.0,
-         g322 = 0.0,
-         g323 = 0.0,
-         g328 = 0.0,
-         g329 = 0.0,
-         g311 = 0.0,
-         g310 = 0.0,
-         g40 = 0.0,
-         g41 = 0.0,
-         g42 = 0.0,
-         g43 = 0.0,
-         g44 = 0.0,
-         g45 = 0.0,
-         g46 = 0.0,
-         g47 = 0.0,
-         g48 = 0.0,
-         g49 = 0.0,
-         n620 = 0.0,
-         n621 = 0.0,
-         n459 = 0.0,
-         n458 = 0.0,
-         n512 = 0.0,
-         n513 = 0.0,
-         n514 = 0.0,
-         n628 = 0.0,
-         n516 = 0.0,
-         n517 = 0.0,
-         n451 = 0.0,
-         n450 = 0.0,
-         n453 = 0.0,
-         n452 = 0.0,
-         n455 = 0.0,
-         n454 = 0.0,
-         n457 = 0.0,
-         n456 = 0.0,
-         n428 = 0.0,
-         n429 = 0.0,
-         n358 = 0.0,
-         n359 = 0.0,
-         n356 = 0.0,
-         n425 = 0.0,
-         n354 = 0.0,
-         n355 = 0.0,
-         n352 = 0.0,
-         n353 = 0.0,
-         n350 = 0.0,
-         n423 = 0.0,
-         n589 = 0.0,
-         n588 = 0.0,
-         n583 = 0.0,
-         n582 = 0.0,
-         n581 = 0.0,
-         n580 = 0.0,
-         n587 = 0.0,
-         n586 = 0.0,
-         n585 = 0.0,
-         n584 = 0.0,
-         n631 = 0.0,
-         n630 = 0.0,
-         n633 = 0.0,
-         n632 = 0.0,
-         n635 = 0.0,
-         n634 = 0.0,
-         n637 = 0.0,
-         n636 = 0.0,
-         n638 = 0.0,
-         n610 = 0.0,
-         n228 = 0.0,
-         n229 = 0.0,
-         n222 = 0.0,
-         n223 = 0.0,
-         n220 = 0.0,
-         n221 = 0.0,
-         n226 = 0.0,
-         n227 = 0.0,
-         n224 = 0.0,
-         n225 = 0.0,
-         n279 = 0.0,
-         n278 = 0.0,
-         n271 = 0.0,
-         n129 = 0.0,
-         n128 = 0.0,
-         n270 = 0.0,
-         n125 = 0.0,
-         n124 = 0.0,
-         n127 = 0.0,
-         n126 = 0.0,
-         n121 = 0.0,
-         n120 = 0.0,
-         n123 = 0.0,
-         n122 = 0.0,
-         n12 = 0.0,
-         n13 = 0.0,
-         n10 = 0.0,
-         n11 = 0.0,
-         n16 = 0.0,
-         n17 = 0.0,
-         n14 = 0.0,
-         n15 = 0.0,
-         n18 = 0.0,
-         n19 = 0.0,
-         n614 = 0.0,
-         g100 = 0.0,
-         g101 = 0.0,
-         g102 = 0.0,
-         g103 = 0.0,
-         g104 = 0.0,
-         g105 = 0.0,
-         g106 = 0.0,
-         g107 = 0.0,
-         g108 = 0.0,
-         g109 = 0.0,
-         n511 = 0.0,
-         g209 = 0.0,
-         g208 = 0.0,
-         g203 = 0.0,
-         g202 = 0.0,
-         g201 = 0.0,
-         g200 = 0.0,
-         g207 = 0.0,
-         g206 = 0.0,
-         g205 = 0.0,
-         g204 = 0.0,
-         g199 = 0.0,
-         g198 = 0.0,
-         g193 = 0.0,
-         g192 = 0.0,
-         g191 = 0.0,
-         g190 = 0.0,
-         g197 = 0.0,
-         g196 = 0.0,
-         g195 = 0.0,
-         g194 = 0.0,
-         g290 = 0.0,
-         g291 = 0.0,
-         g292 = 0.0,
-         g293 = 0.0,
-         g294 = 0.0,
-         g295 = 0.0,
-         g296 = 0.0,
-         g297 = 0.0,
-         g298 = 0.0,
-         g299 = 0.0,
-         g337 = 0.0,
-         g336 = 0.0,
-         g335 = 0.0,
-         g334 = 0.0,
-         g333 = 0.0,
-         g332 = 0.0,
-         g331 = 0.0,
-         g330 = 0.0,
-         n298 = 0.0,
-         g339 = 0.0,
-         g338 = 0.0,
-         g75 = 0.0,
-         g74 = 0.0,
-         g77 = 0.0,
-         g76 = 0.0,
-         g71 = 0.0,
-         g70 = 0.0,
-         g73 = 0.0,
-         g72 = 0.0,
-         g79 = 0.0,
-         g78 = 0.0,
-         n503 = 0.0,
-         n502 = 0.0,
-         n501 = 0.0,
-         n500 = 0.0,
-         n507 = 0.0,
-         n506 = 0.0,
-         n505 = 0.0,
-         n504 = 0.0,
-         n509 = 0.0,
-         n508 = 0.0,
-         n349 = 0.0,
-         n348 = 0.0,
-         n439 = 0.0,
-         n438 = 0.0,
-         n437 = 0.0,
-         n436 = 0.0,
-         n435 = 0.0,
-         n434 = 0.0,
-         n433 = 0.0,
-         n432 = 0.0,
-         n431 = 0.0,
-         n430 = 0.0,
-         n613 = 0.0,
-         n612 = 0.0,
-         n611 = 0.0,
-         n235 = 0.0,
-         n234 = 0.0,
-         n237 = 0.0,
-         n236 = 0.0,
-         n231 = 0.0,
-         n230 = 0.0,
-         n233 = 0.0,
-         n232 = 0.0,
-         n617 = 0.0,
-         n239 = 0.0,
-         n238 = 0.0,
-         n616 = 0.0,
-         n482 = 0.0,
-         n483 = 0.0,
-         n480 = 0.0,
-         n481 = 0.0,
-         n338 = 0.0,
-         n339 = 0.0,
-         n484 = 0.0,
-         n485 = 0.0,
-         n334 = 0.0,
-         n335 = 0.0,
-         n336 = 0.0,
-         n337 = 0.0,
-         n330 = 0.0,
-         n331 = 0.0,
-         n332 = 0.0,
-         n333 = 0.0,
-         n158 = 0.0,
-         n159 = 0.0,
-         n150 = 0.0,
-         n151 = 0.0,
-         n152 = 0.0,
-         n153 = 0.0,
-         n154 = 0.0,
-         n155 = 0.0,
-         n156 = 0.0,
-         n157 = 0.0,
-         n67 = 0.0,
-         n66 = 0.0,
-         n65 = 0.0,
-         n64 = 0.0,
-         n63 = 0.0,
-         n62 = 0.0,
-         n61 = 0.0,
-         n60 = 0.0,
-         n69 = 0.0,
-         n68 = 0.0,
-         n303 = 0.0,
-         n302 = 0.0,
-         g113 = 0.0,
-         g112 = 0.0,
-         g111 = 0.0,
-         g110 = 0.0,
-         g117 = 0.0,
-         g116 = 0.0,
-         g115 = 0.0,
-         g114 = 0.0,
-         n262 = 0.0,
-         g119 = 0.0,
-         g118 = 0.0,
-         n308 = 0.0,
-         n607 = 0.0,
-         g236 = 0.0,
-         g237 = 0.0,
-         g234 = 0.0,
-         g235 = 0.0,
-         g232 = 0.0,
-         g233 = 0.0,
-         g230 = 0.0,
-         g231 = 0.0,
-         g238 = 0.0,
-         g239 = 0.0,
-         g283 = 0.0,
-         g282 = 0.0,
-         g281 = 0.0,
-         g280 = 0.0,
-         g287 = 0.0,
-         g286 = 0.0,
-         g285 = 0.0,
-         g284 = 0.0,
-         g289 = 0.0,
-         g288 = 0.0,
-         g302 = 0.0,
-         g303 = 0.0,
-         g300 = 0.0,
-         g301 = 0.0,
-         g306 = 0.0,
-         g307 = 0.0,
-         g304 = 0.0,
-         g305 = 0.0,
-         g308 = 0.0,
-         g309 = 0.0,
-         n8 = 0.0,
-         n9 = 0.0,
-         g68 = 0.0,
-         g69 = 0.0,
-         g62 = 0.0,
-         g63 = 0.0,
-         g60 = 0.0,
-         g61 = 0.0,
-         g66 = 0.0,
-         g67 = 0.0,
-         g64 = 0.0,
-         g65 = 0.0,
-         n109 = 0.0,
-         n108 = 0.0;
-
-  int nuc;
-  int i = 2;
-  MW[0] = pyne::atomic_mass(j);
-  MW[1] = pyne::atomic_mass(k);
-  xF[0] = casc.mat_feed.comp[j];
-  xF[1] = casc.mat_feed.comp[k];
-  for(pyne::comp_iter ci = casc.mat_feed.comp.begin(); ci != casc.mat_feed.comp.end(); ci++)
-  {
-    nuc = (*ci).first;
-    if (nuc == j || nuc == k)
-        continue;
-    MW[i] = pyne::atomic_mass(nuc);
-    xF[i] = (*ci).second;
-    i++;
-  };
-
-  switch (ncomp)
-  {
-    case 3:
-      n0 = -2.00000000000000;
-      n1 = MW[0] - Mstar;
-      n2 = log(alpha);
-      n3 = xPj - xTj;
-      n4 = xF[0] - xPj;
-      n5 = MW[1] - Mstar;
-      n6 = MW[2] - Mstar;
-      n7 = log(xTj);
-      n8 = -2;
-      n9 = xF[0]*xPj;
-      n10 = -Mstar;
-      n11 = -xTj;
-      n12 = -NP0*n0;
-      n13 = pow(n1, -n0);
-      n14 = pow(n2, -n0);
-      n15 = pow(n5, -n0);
-      n16 = pow(n6, -n0);
-      n17 = Mstar*n2;
-      n18 = -n0*n2;
-      n19 = -n2;
-      n20 = pow(alpha, NP0*n1);
-      n21 = n11*xF[0] + n9;
-      n22 = n11*xPj + n9;
-      n23 = pow(alpha, NP0*n5);
-      n24 = pow(alpha, NP0*n6);
-      n25 = MW[0]*n19;
-      n26 = n3/n4;
-      n27 = -n14;
-      n28 = -n20 + 1;
-      n29 = -n23 + 1;
-      n30 = pow(alpha, n1*n12);
-      n31 = pow(n22, -n0);
-      n32 = -n24 + 1;
-      n33 = -n32;
-      n34 = -n20;
-      n35 = n1*n14;
-      n36 = 1/(n1*n2);
-      n37 = n24*n6;
-      n38 = n23*n5;
-      n39 = n1*n20;
-      n40 = n28*xF[0];
-      n41 = log((-1.0 + xPj/xF[0])/n3);
-      n42 = n39*xF[0];
-      n43 = -n29*xF[1];
-      n44 = n22/n21;
-      n45 = n14*n16*n24;
-      n46 = n13*n14*n20;
-      n47 = n13*n14*n30;
-      n48 = n34*n44 + 1;
-      n49 = n17 + n25 + n41 + n7;
-      n50 = n36*(n49 - log(n48)) + 1;
-      n51 = pow(alpha, n1*n50);
-      n52 = pow(alpha, n5*n50);
-      n53 = pow(alpha, n50*n6);
-      n54 = n28 - 1 + 1.0/n51;
-      n55 = n29 - 1 + 1.0/n52;
-      n56 = n32 - 1 + 1.0/n53;
-      n57 = pow(n54, 3);
-      n58 = pow(n55, 3);
-      n59 = pow(n56, 3);
-      n60 = xF[2]/n56;
-      n61 = n2/n54;
-      n62 = n40/n57;
-      n63 = n2*n38*xF[1]/n55;
-      n64 = 1/(n48*n51);
-      n65 = n46*xF[0]/n54;
-      n66 = n14*n15*n23*xF[1]/n55;
-      n67 = n26*n42*n61;
-      n68 = n19*n26*n42/n54;
-      n69 = n20*n5/(n48*n52);
-      n70 = n20*n6/(n48*n53);
-      n71 = n26*n65;
-      n72 = n26*n66;
-      n73 = n26*n45*n60;
-      n74 = 0.5*n71;
-      n75 = n44*n64 + 1;
-      n76 = pow(n21, n8)*n30*n31*pow(n48, n8)/n53;
-      n77 = pow(n21, n8)*n30*n31*pow(n48, n8)/n52;
-      n78 = n2*n39*n44*n64 + n2*n39;
-      n79 = n2*n38 + n2*n44*n69;
-      n80 = n2*n37 + n2*n44*n70;
-      n81 = pow(n78, -n0);
-      n82 = pow(n79, -n0);
-      n83 = pow(n80, -n0);
-      n84 = n80*xF[2];
-      n85 = n18*n39*n44*n64 + n18*n39;
-      n86 = n44*n46*n64 + n46;
-      n87 = pow(n54, n8)*n78;
-      n88 = pow(n55, n8)*n79;
-      n89 = n29*n82*xF[1]/n58;
-      n90 = n40*pow(n54, n8)*n86;
-      n91 = -n26*n40*n87;
-      n92 = n18*n26*n42*pow(n54, n8)*(pow(alpha, NP0*n1 - n1*n50)*n1*n2*n44/n48 + n2*n39);
-      n93 = n18*n26*n38*pow(n55, n8)*xF[1]*(pow(alpha, NP0*n1 - n5*n50)*n2*n44*n5/n48 + n2*n38);
-      n94 = n18*n26*n37*pow(n56, n8)*xF[2]*(pow(alpha, NP0*n1 - n50*n6)*n2*n44*n6/n48 + n2*n37);
-      n95 = 1.0*n2*n26*n42*n87;
-      n96 = -n26*n90;
-      n97 = -0.5*n26*n90;
-      n98 = -n78*n85;
-      n99 = n67 + n91;
-      n100 = n14*n15*n23 + n15*n27*n77 + n35*n44*n69 + n35*n5*n77;
-      n101 = n16*n27*n76 + n35*n44*n70 + n35*n6*n76 + n45;
-      n102 = n26*n43*pow(n55, n8)*(pow(alpha, n1*n12 - n5*n50)*n15*pow(n21, n8)*n27*n31*pow(n48, n8) + pow(alpha, n1*n12 - n5*n50)*pow(n21, n8)*n31*n35*pow(n48, n8)*n5 + n14*n15*n23 + n35*n44*n69);
-      n103 = n26*n33*pow(n56, n8)*xF[2]*(pow(alpha, n1*n12 - n50*n6)*n16*pow(n21, n8)*n27*n31*pow(n48, n8) + pow(alpha, n1*n12 - n50*n6)*pow(n21, n8)*n31*n35*pow(n48, n8)*n6 + n35*n44*n70 + n45);
-      n104 = n74 + n95 + n97;
-      n105 = n2*n26*n37*n60 + n26*n33*pow(n56, n8)*n84 + n26*n43*n88 + n26*n63 + n99;
-      n106 = n102 + n103 + n71 + n72 + n73 + n92 + n93 + n94 + n96;
-      n107 = n106 + n26*n33*n84*(n18*n37 + n18*n44*n70)/n59 + n26*n43*n79*(n18*n38 + n18*n44*n69)/n58 + n26*n62*n98;
-      NP_b = -n12*(1.0*n2*n26*n42*pow(n54, n8)*(pow(alpha, NP0*n1 - n1*n50)*n1*n2*n44/n48 + n2*n39) - 0.5*n26*n40*pow(n54, n8)*(pow(alpha, NP0*n1 - n1*n50)*n13*n14*n44/n48 + n46) - 1.0*n26*n62*n81 + n74 - 0.5*xTj*(n26*n32*n8*n83*xF[2]/n59 + n26*n33*pow(n56, n8)*xF[2]*(pow(alpha, NP0*n1 - n50*n6)*n35*n44*n6/n48 + pow(alpha, n1*n12 - n50*n6)*n16*pow(n21, n8)*n27*n31*pow(n48, n8) + pow(alpha, n1*n12 - n50*n6)*pow(n21, n8)*n31*n35*pow(n48, n8)*n6 + n45) - n26*n40*pow(n54, n8)*(pow(alpha, NP0*n1 - n1*n50)*n13*n14*n44/n48 + n46) + n26*n43*pow(n55, n8)*(pow(alpha, NP0*n1 - n5*n50)*n35*n44*n5/n48 + pow(alpha, n1*n12 - n5*n50)*n15*pow(n21, n8)*n27*n31*pow(n48, n8) + pow(alpha, n1*n12 - n5*n50)*pow(n21, n8)*n31*n35*pow(n48, n8)*n5 + n14*n15*n23) + n26*n62*n8*n81 + n26*n8*n89 + n71 + n72 + n73 + n92 + n93 + n94)) - n2*n26*n39*n40*pow(n54, n8)*n75 - n26*xTj*(n2*n37*n60 + n33*pow(n56, n8)*n84 - n40*n87 + n42*n61 + n43*n88 + n63) - n68;
-      NP_2a = -n26*(n0*n13*n27*n30*n62*pow(n75, -n0) + n0*n47*pow(n54, n8)*n75*xF[0] + n40*n46*pow(n54, n8)*n75 - 1.0*n65 + 1.0*xTj*(n18*n37*pow(n56, n8)*xF[2]*(pow(alpha, NP0*n1 - n50*n6)*n2*n44*n6/n48 + n2*n37) + n18*n38*pow(n55, n8)*xF[1]*(pow(alpha, NP0*n1 - n5*n50)*n2*n44*n5/n48 + n2*n38) + n18*n42*pow(n54, n8)*(pow(alpha, NP0*n1 - n1*n50)*n1*n2*n44/n48 + n2*n39) + n32*n8*n83*xF[2]/n59 + n33*pow(n56, n8)*xF[2]*(pow(alpha, n1*n12 - n50*n6)*n16*pow(n21, n8)*n27*n31*pow(n48, n8) + pow(alpha, n1*n12 - n50*n6)*pow(n21, n8)*n31*n35*pow(n48, n8)*n6 + n35*n44*n70 + n45) + n43*pow(n55, n8)*(pow(alpha, n1*n12 - n5*n50)*n15*pow(n21, n8)*n27*n31*pow(n48, n8) + pow(alpha, n1*n12 - n5*n50)*pow(n21, n8)*n31*n35*pow(n48, n8)*n5 + n14*n15*n23 + n35*n44*n69) + n45*n60 + n62*n8*n81 + n65 + n66 + n8*n89 - n90));
-      NP_sqrt_base = (NP0*(n11*(n2*n26*n37*n60 + n26*n33*pow(n56, n8)*xF[2]*(pow(alpha, NP0*n1 - n50*n6)*n2*n44*n6/n48 + n2*n37) - n26*n40*pow(n54, n8)*(pow(alpha, NP0*n1 - n1*n50)*n1*n2*n44/n48 + n2*n39) + n26*n43*pow(n55, n8)*(pow(alpha, NP0*n1 - n5*n50)*n2*n44*n5/n48 + n2*n38) + n26*n63 + n67) + n99) + n26*n40/n54 + xTj*(n26*n33*n60 - n26*n40/n54 + n26*n43/n55) + pow(NP0, -n0)*(0.5*n107*xTj - 1.0*n2*n26*n42*n87 + 0.5*n26*n62*n78*n85 + 0.5*n26*n90 - 0.5*n71))*(-n0*n11*(n26*n33*pow(n56, n8)*xF[2]*(pow(alpha, NP0*n1 - n50*n6)*n35*n44*n6/n48 + pow(alpha, n1*n12 - n50*n6)*n16*pow(n21, n8)*n27*n31*pow(n48, n8) + pow(alpha, n1*n12 - n50*n6)*pow(n21, n8)*n31*n35*pow(n48, n8)*n6 + n45) + n26*n33*xF[2]*(pow(alpha, NP0*n1 - n50*n6)*n18*n44*n6/n48 + n18*n37)*(pow(alpha, NP0*n1 - n50*n6)*n2*n44*n6/n48 + n2*n37)/n59 - n26*n40*pow(n54, n8)*(pow(alpha, NP0*n1 - n1*n50)*n13*n14*n44/n48 + n46) + n26*n43*pow(n55, n8)*(pow(alpha, NP0*n1 - n5*n50)*n35*n44*n5/n48 + pow(alpha, n1*n12 - n5*n50)*n15*pow(n21, n8)*n27*n31*pow(n48, n8) + pow(alpha, n1*n12 - n5*n50)*pow(n21, n8)*n31*n35*pow(n48, n8)*n5 + n14*n15*n23) + n26*n43*(pow(alpha, NP0*n1 - n5*n50)*n18*n44*n5/n48 + n18*n38)*(pow(alpha, NP0*n1 - n5*n50)*n2*n44*n5/n48 + n2*n38)/n58 - n26*n62*(pow(alpha, NP0*n1 - n1*n50)*n1*n18*n44/n48 + n18*n39)*(pow(alpha, NP0*n1 - n1*n50)*n1*n2*n44/n48 + n2*n39) + n71 + n72 + n73 + n92 + n93 + n94) - n0*n71 - n0*n96 + 4.0*n2*n26*n42*n87 - 4.0*n26*n62*n81) + pow(-n105*xTj - n12*(1.0*n2*n26*n42*pow(n54, n8)*(pow(alpha, NP0*n1 - n1*n50)*n1*n2*n44/n48 + n2*n39) - 0.5*n26*n40*pow(n54, n8)*(pow(alpha, NP0*n1 - n1*n50)*n13*n14*n44/n48 + n46) - 0.5*n26*n62*(pow(alpha, NP0*n1 - n1*n50)*n1*n18*n44/n48 + n18*n39)*(pow(alpha, NP0*n1 - n1*n50)*n1*n2*n44/n48 + n2*n39) + n74 - 0.5*xTj*(n26*n33*pow(n56, n8)*xF[2]*(pow(alpha, NP0*n1 - n50*n6)*n35*n44*n6/n48 + pow(alpha, n1*n12 - n50*n6)*n16*pow(n21, n8)*n27*n31*pow(n48, n8) + pow(alpha, n1*n12 - n50*n6)*pow(n21, n8)*n31*n35*pow(n48, n8)*n6 + n45) + n26*n33*xF[2]*(pow(alpha, NP0*n1 - n50*n6)*n18*n44*n6/n48 + n18*n37)*(pow(alpha, NP0*n1 - n50*n6)*n2*n44*n6/n48 + n2*n37)/n59 - n26*n40*pow(n54, n8)*(pow(alpha, NP0*n1 - n1*n50)*n13*n14*n44/n48 + n46) + n26*n43*pow(n55, n8)*(pow(alpha, NP0*n1 - n5*n50)*n35*n44*n5/n48 + pow(alpha, n1*n12 - n5*n50)*n15*pow(n21, n8)*n27*n31*pow(n48, n8) + pow(alpha, n1*n12 - n5*n50)*pow(n21, n8)*n31*n35*pow(n48, n8)*n5 + n14*n15*n23) + n26*n43*(pow(alpha, NP0*n1 - n5*n50)*n18*n44*n5/n48 + n18*n38)*(pow(alpha, NP0*n1 - n5*n50)*n2*n44*n5/n48 + n2*n38)/n58 - n26*n62*(pow(alpha, NP0*n1 - n1*n50)*n1*n18*n44/n48 + n18*n39)*(pow(alpha, NP0*n1 - n1*n50)*n1*n2*n44/n48 + n2*n39) + n71 + n72 + n73 + n92 + n93 + n94)) - n26*n40*n87 - n68, -n0);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n36*(n49 - log(-pow(alpha, NP1*n1)*n44 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[2] - Mstar;
-      g5 = xF[0] - xTj;
-      g6 = xF[0] - xPj;
-      g7 = -xTj;
-      g8 = xPj/xF[1];
-      g9 = pow(alpha, -g1);
-      g10 = pow(alpha, -g0);
-      g11 = pow(alpha, -g4);
-      g12 = log(xF[0]/xF[1]);
-      g13 = -g2;
-      g14 = pow(alpha, NP1*g0);
-      g15 = pow(alpha, NP1*g1);
-      g16 = log(g9);
-      g17 = pow(alpha, NP1*g4);
-      g18 = -g12;
-      g19 = g3/g5;
-      g20 = g5/g3;
-      g21 = -g14 + 1;
-      g22 = -g14 + 1;
-      g23 = -g15 + 1;
-      g24 = -g17 + 1;
-      g25 = -g15;
-      g26 = -g17;
-      g27 = -1.0*g12;
-      g28 = -g3/g6;
-      g29 = pow(alpha, g0*g13) - 1;
-      g30 = pow(alpha, g0*g13) - 1;
-      g31 = pow(alpha, g1*g13) - 1;
-      g32 = pow(alpha, g13*g4) - 1;
-      g33 = -pow(alpha, g1*g13);
-      g34 = -pow(alpha, g13*g4);
-      g35 = g6*g7/(g3*xF[1]);
-      g36 = g22 + g30;
-      g37 = -g15 - g33;
-      g38 = -g17 - g34;
-      g39 = pow(alpha, g1*g13) + g25;
-      g40 = g22 + g30;
-      g41 = pow(alpha, g13*g4) + g26;
-      g42 = xF[1]/g40;
-      g43 = xF[2]/g41;
-      g44 = xF[0]/g39;
-      g45 = xF[2]/g38;
-      g46 = xF[1]/g36;
-      g47 = xF[0]/g37;
-      g48 = g23/g37;
-      g49 = g21/g36;
-      g50 = g24/g38;
-      g51 = g32/g38;
-      g52 = g29/g36;
-      g53 = g31/g37;
-      g54 = log(g35*g40/g22);
-      g55 = log(g35*g36/g21);
-      g56 = log(g20*g40*g8/g30);
-      g57 = 1.0*g54;
-      g58 = log(g20*g36*g8/g29);
-      g59 = 1.0*g56;
-      g60 = -g22*g42*g57 - g27*xF[0] - g27*xF[1] - g27*xF[2] - g30*g42*g59 - g43*g57*(g26 + 1) - g43*g59*(pow(alpha, g13*g4) - 1) - g44*g57*(g25 + 1) - g44*g59*(pow(alpha, g1*g13) - 1);
-      LpF = xF[0]*(g9 + 1.0)*(g18 + g48*g55 + g53*g58)/(g16*(g9 - 1.0)) + xF[1]*(g10 + 1.0)*(g18 + g49*g55 + g52*g58)/(g16*(g10 - 1.0)) + xF[2]*(g11 + 1.0)*(g18 + g50*g55 + g51*g58)/(g16*(g11 - 1.0));
-      PpF = g20;
-      TpF = -g6/g3;
-      SWUpF = g60;
-      SWUpP = g19*g60;
-      xP[0] = g19*g31*g47;
-      xP[1] = g19*g29*g46;
-      xP[2] = g19*g32*g45;
-      xT[0] = g23*g28*g47;
-      xT[1] = g21*g28*g46;
-      xT[2] = g24*g28*g45;
-      break;
-    case 4:
-      n0 = -0.500000000000000;
-      n1 = MW[0] - Mstar;
-      n2 = log(alpha);
-      n3 = xPj - xTj;
-      n4 = xF[0] - xPj;
-      n5 = MW[1] - Mstar;
-      n6 = MW[2] - Mstar;
-      n7 = MW[3] - Mstar;
-      n8 = log(xTj);
-      n9 = -2;
-      n10 = xF[0]*xPj;
-      n11 = -Mstar;
-      n12 = -xF[0];
-      n13 = -xPj;
-      n14 = -NP0*n9;
-      n15 = -xTj;
-      n16 = pow(n1, -n9);
-      n17 = pow(n2, -n9);
-      n18 = pow(n5, -n9);
-      n19 = pow(n6, -n9);
-      n20 = pow(n7, -n9);
-      n21 = Mstar*n2;
-      n22 = -n2*n9;
-      n23 = pow(alpha, NP0*n1);
-      n24 = n10 + n12*xTj;
-      n25 = n10 + n13*xTj;
-      n26 = pow(alpha, NP0*n5);
-      n27 = pow(alpha, NP0*n6);
-      n28 = pow(alpha, NP0*n7);
-      n29 = -MW[0]*n2;
-      n30 = n3/n4;
-      n31 = -n23 + 1;
-      n32 = -n26 + 1;
-      n33 = pow(alpha, n1*n14);
-      n34 = pow(n24, -n9);
-      n35 = pow(n25, -n9);
-      n36 = -n27 + 1;
-      n37 = -n28 + 1;
-      n38 = -n36;
-      n39 = -n23;
-      n40 = -n26;
-      n41 = 1/(n1*n2);
-      n42 = n1*n17;
-      n43 = n27*n6;
-      n44 = n37*xF[3];
-      n45 = n28*n7;
-      n46 = n1*n23;
-      n47 = n32*xF[1];
-      n48 = n26*n5;
-      n49 = n16*n17;
-      n50 = log((-1.0 + xPj/xF[0])/n3);
-      n51 = n25/n24;
-      n52 = n17*n19*n27;
-      n53 = n23*n49;
-      n54 = n17*n20*n28;
-      n55 = n39*n51 + 1;
-      n56 = pow(n55, -n9);
-      n57 = n21 + n29 + n50 + n8;
-      n58 = n23*n51/n55;
-      n59 = n17*n33*n35/(n34*n56);
-      n60 = n41*(n57 - log(n55)) + 1;
-      n61 = pow(alpha, n1*n60);
-      n62 = pow(alpha, n5*n60);
-      n63 = pow(alpha, n6*n60);
-      n64 = pow(alpha, n60*n7);
-      n65 = n5/n62;
-      n66 = n7/n64;
-      n67 = n6/n63;
-      n68 = n31 - 1 + 1.0/n61;
-      n69 = n32 - 1 + 1.0/n62;
-      n70 = n36 - 1 + 1.0/n63;
-      n71 = n37 - 1 + 1.0/n64;
-      n72 = pow(n68, -n9);
-      n73 = pow(n69, -n9);
-      n74 = pow(n70, -n9);
-      n75 = pow(n71, -n9);
-      n76 = pow(n68, 3);
-      n77 = pow(n69, 3);
-      n78 = pow(n70, 3);
-      n79 = pow(n71, 3);
-      n80 = xF[2]/n70;
-      n81 = xF[3]/n71;
-      n82 = n2/n68;
-      n83 = xF[0]/n72;
-      n84 = n2*n81;
-      n85 = n31*xF[0]/n76;
-      n86 = -n44/n75;
-      n87 = n2*n48*xF[1]/n69;
-      n88 = n53*xF[0]/n68;
-      n89 = n17*n18*n26*xF[1]/n69;
-      n90 = n12*n30*n46*n82;
-      n91 = n30*n88;
-      n92 = n30*n89;
-      n93 = n30*n52*n80;
-      n94 = n30*n54*n81;
-      n95 = n0*n12*n30*n53/n68;
-      n96 = n51/(n55*n61) + 1;
-      n97 = n31*n96;
-      n98 = n2*n46*n51/(n55*n61) + n2*n46;
-      n99 = n2*n48 + n2*n58*n65;
-      n100 = n2*n43 + n2*n58*n67;
-      n101 = n2*n45 + n2*n58*n66;
-      n102 = pow(n98, -n9);
-      n103 = pow(n99, -n9);
-      n104 = pow(n100, -n9);
-      n105 = pow(n101, -n9);
-      n106 = n100*xF[2];
-      n107 = n22*n46*n51/(n55*n61) + n22*n46;
-      n108 = n2*n98;
-      n109 = n51*n53/(n55*n61) + n53;
-      n110 = n103/n77;
-      n111 = n105*n9/n79;
-      n112 = n30*n31*n83*n98;
-      n113 = n12*n2*n30*n46*n9*(pow(alpha, NP0*n1 - n1*n60)*n1*n2*n51/n55 + n2*n46)/n72;
-      n114 = n22*n30*n48*xF[1]*(pow(alpha, NP0*n1 - n5*n60)*n2*n5*n51/n55 + n2*n48)/n73;
-      n115 = n22*n30*n43*xF[2]*(pow(alpha, NP0*n1 - n6*n60)*n2*n51*n6/n55 + n2*n43)/n74;
-      n116 = n22*n30*n45*xF[3]*(pow(alpha, NP0*n1 - n60*n7)*n2*n51*n7/n55 + n2*n45)/n75;
-      n117 = 1.0*n108*n30*n46*n83;
-      n118 = n12*n30*n31*(pow(alpha, NP0*n1 - n1*n60)*n49*n51/n55 + n53)/n72;
-      n119 = n0*n109*n30*n31*n83;
-      n120 = n17*n18*n26 - n18*n59/n62 + n33*n35*n42*n65/(n34*n56) + n42*n58*n65;
-      n121 = -n19*n59/n63 + n33*n35*n42*n67/(n34*n56) + n42*n58*n67 + n52;
-      n122 = -n30*n47*(-pow(alpha, n1*n14 - n5*n60)*n17*n18*n35/(n34*n56) + pow(alpha, n1*n14 - n5*n60)*n35*n42*n5/(n34*n56) + n17*n18*n26 + n42*n58*n65)/n73;
-      n123 = n30*n38*xF[2]*(-pow(alpha, n1*n14 - n6*n60)*n17*n19*n35/(n34*n56) + pow(alpha, n1*n14 - n6*n60)*n35*n42*n6/(n34*n56) + n42*n58*n67 + n52)/n74;
-      n124 = n30*n86*(-pow(alpha, n1*n14 - n60*n7)*n17*n20*n35/(n34*n56) + pow(alpha, n1*n14 - n60*n7)*n35*n42*n7/(n34*n56) + n42*n58*n66 + n54);
-      n125 = xTj*(n101*n30*n86 + n106*n30*n38/n74 + n12*n30*n31*(pow(alpha, NP0*n1 - n1*n60)*n1*n2*n51/n55 + n2*n46)/n72 + n2*n30*n43*n80 + n30*n45*n84 + n30*n46*n82*xF[0] - n30*n47*n99/n73 + n30*n87);
-      n126 = n112 + n125 + n90;
-      n127 = n113 + n114 + n115 + n116 + n118 + n122 + n123 + n124 + n91 + n92 + n93 + n94;
-      n128 = -n101*n30*n44*(n22*n45 + n22*n58*n66)/n79 + n106*n30*n38*(n22*n43 + n22*n58*n67)/n78 + n12*n30*n31*(pow(alpha, NP0*n1 - n1*n60)*n1*n2*n51/n55 + n2*n46)*(pow(alpha, NP0*n1 - n1*n60)*n1*n22*n51/n55 + n22*n46)/n76 + n127 - n30*n47*n99*(n22*n48 + n22*n58*n65)/n77;
-      NP_b = -n14*(n0*n30*n31*n83*(pow(alpha, NP0*n1 - n1*n60)*n49*n51/n55 + n53) + n0*xTj*(n102*n30*n85*n9 + n104*n30*n36*n9*xF[2]/n78 + n110*n30*n47*n9 + n111*n30*n44 + n113 + n114 + n115 + n116 + n118 + n30*n38*xF[2]*(pow(alpha, NP0*n1 - n6*n60)*n42*n51*n6/n55 - pow(alpha, n1*n14 - n6*n60)*n17*n19*n35/(n34*n56) + pow(alpha, n1*n14 - n6*n60)*n35*n42*n6/(n34*n56) + n52)/n74 - n30*n47*(pow(alpha, NP0*n1 - n5*n60)*n42*n5*n51/n55 - pow(alpha, n1*n14 - n5*n60)*n17*n18*n35/(n34*n56) + pow(alpha, n1*n14 - n5*n60)*n35*n42*n5/(n34*n56) + n17*n18*n26)/n73 + n30*n86*(pow(alpha, NP0*n1 - n60*n7)*n42*n51*n7/n55 - pow(alpha, n1*n14 - n60*n7)*n17*n20*n35/(n34*n56) + pow(alpha, n1*n14 - n60*n7)*n35*n42*n7/(n34*n56) + n54) + n91 + n92 + n93 + n94) - 1.0*n102*n30*n85 + 1.0*n2*n30*n46*n83*(pow(alpha, NP0*n1 - n1*n60)*n1*n2*n51/n55 + n2*n46) + n95) - n2*n30*n46*n83*n97 - n30*xTj*(n101*n86 + n106*n38/n74 + n12*n31*(pow(alpha, NP0*n1 - n1*n60)*n1*n2*n51/n55 + n2*n46)/n72 + n2*n43*n80 + n45*n84 + n46*n82*xF[0] - n47*n99/n73 + n87) - n90;
-      NP_2a = -n30*(n12*n31*n33*n49*n9*pow(n96, -n9)/n76 - 2.0*n33*n49*n83*n96 + n53*n83*n97 - 1.0*n88 + 1.0*xTj*(n102*n85*n9 + n104*n36*n9*xF[2]/n78 + n110*n47*n9 + n111*n44 + n12*n2*n46*n9*(pow(alpha, NP0*n1 - n1*n60)*n1*n2*n51/n55 + n2*n46)/n72 + n12*n31*(pow(alpha, NP0*n1 - n1*n60)*n49*n51/n55 + n53)/n72 + n22*n43*xF[2]*(pow(alpha, NP0*n1 - n6*n60)*n2*n51*n6/n55 + n2*n43)/n74 + n22*n45*xF[3]*(pow(alpha, NP0*n1 - n60*n7)*n2*n51*n7/n55 + n2*n45)/n75 + n22*n48*xF[1]*(pow(alpha, NP0*n1 - n5*n60)*n2*n5*n51/n55 + n2*n48)/n73 + n38*xF[2]*(-pow(alpha, n1*n14 - n6*n60)*n17*n19*n35/(n34*n56) + pow(alpha, n1*n14 - n6*n60)*n35*n42*n6/(n34*n56) + n42*n58*n67 + n52)/n74 - n47*(-pow(alpha, n1*n14 - n5*n60)*n17*n18*n35/(n34*n56) + pow(alpha, n1*n14 - n5*n60)*n35*n42*n5/(n34*n56) + n17*n18*n26 + n42*n58*n65)/n73 + n52*n80 + n54*n81 + n86*(-pow(alpha, n1*n14 - n60*n7)*n17*n20*n35/(n34*n56) + pow(alpha, n1*n14 - n60*n7)*n35*n42*n7/(n34*n56) + n42*n58*n66 + n54) + n88 + n89));
-      NP_sqrt_base = (-NP0*n126 - n12*n30*n31/(n31 - 1 + pow(alpha, -n1*(n41*(n57 - log(n25*n39/(n10 + n15*xF[0]) + 1)) + 1))) - n15*(-n30*n31*xF[0]/n68 - n30*n36*n80 - n30*n44/n71 - n30*n47/n69) - pow(NP0, -n9)*(-n0*n118 - n0*n12*n30*n31*(pow(alpha, NP0*n1 - n1*n60)*n1*n2*n51/n55 + n2*n46)*(pow(alpha, NP0*n1 - n1*n60)*n1*n22*n51/n55 + n22*n46)/n76 - n0*n15*(n113 + n114 + n115 + n116 + n118 + n12*n30*n31*(pow(alpha, NP0*n1 - n1*n60)*n1*n2*n51/n55 + n2*n46)*(pow(alpha, NP0*n1 - n1*n60)*n1*n22*n51/n55 + n22*n46)/n76 + n30*n38*xF[2]*(pow(alpha, NP0*n1 - n6*n60)*n2*n51*n6/n55 + n2*n43)*(pow(alpha, NP0*n1 - n6*n60)*n22*n51*n6/n55 + n22*n43)/n78 + n30*n38*xF[2]*(pow(alpha, NP0*n1 - n6*n60)*n42*n51*n6/n55 - pow(alpha, n1*n14 - n6*n60)*n17*n19*n35/(n34*n56) + pow(alpha, n1*n14 - n6*n60)*n35*n42*n6/(n34*n56) + n52)/n74 - n30*n44*(pow(alpha, NP0*n1 - n60*n7)*n2*n51*n7/n55 + n2*n45)*(pow(alpha, NP0*n1 - n60*n7)*n22*n51*n7/n55 + n22*n45)/n79 - n30*n47*(pow(alpha, NP0*n1 - n5*n60)*n2*n5*n51/n55 + n2*n48)*(pow(alpha, NP0*n1 - n5*n60)*n22*n5*n51/n55 + n22*n48)/n77 - n30*n47*(pow(alpha, NP0*n1 - n5*n60)*n42*n5*n51/n55 - pow(alpha, n1*n14 - n5*n60)*n17*n18*n35/(n34*n56) + pow(alpha, n1*n14 - n5*n60)*n35*n42*n5/(n34*n56) + n17*n18*n26)/n73 + n30*n86*(pow(alpha, NP0*n1 - n60*n7)*n42*n51*n7/n55 - pow(alpha, n1*n14 - n60*n7)*n17*n20*n35/(n34*n56) + pow(alpha, n1*n14 - n60*n7)*n35*n42*n7/(n34*n56) + n54) + n91 + n92 + n93 + n94) - n0*n91 + 1.0*n108*n30*n46*n83))*(-4.0*n102*n30*n85 + 4.0*n108*n30*n46*n83 - n118*n9 - n15*n9*(n113 + n114 + n115 + n116 + n118 + n12*n30*n31*(pow(alpha, NP0*n1 - n1*n60)*n1*n2*n51/n55 + n2*n46)*(pow(alpha, NP0*n1 - n1*n60)*n1*n22*n51/n55 + n22*n46)/n76 + n30*n38*xF[2]*(pow(alpha, NP0*n1 - n6*n60)*n2*n51*n6/n55 + n2*n43)*(pow(alpha, NP0*n1 - n6*n60)*n22*n51*n6/n55 + n22*n43)/n78 + n30*n38*xF[2]*(pow(alpha, NP0*n1 - n6*n60)*n42*n51*n6/n55 - pow(alpha, n1*n14 - n6*n60)*n17*n19*n35/(n34*n56) + pow(alpha, n1*n14 - n6*n60)*n35*n42*n6/(n34*n56) + n52)/n74 - n30*n44*(pow(alpha, NP0*n1 - n60*n7)*n2*n51*n7/n55 + n2*n45)*(pow(alpha, NP0*n1 - n60*n7)*n22*n51*n7/n55 + n22*n45)/n79 - n30*n47*(pow(alpha, NP0*n1 - n5*n60)*n2*n5*n51/n55 + n2*n48)*(pow(alpha, NP0*n1 - n5*n60)*n22*n5*n51/n55 + n22*n48)/n77 - n30*n47*(pow(alpha, NP0*n1 - n5*n60)*n42*n5*n51/n55 - pow(alpha, n1*n14 - n5*n60)*n17*n18*n35/(n34*n56) + pow(alpha, n1*n14 - n5*n60)*n35*n42*n5/(n34*n56) + n17*n18*n26)/n73 + n30*n86*(pow(alpha, NP0*n1 - n60*n7)*n42*n51*n7/n55 - pow(alpha, n1*n14 - n60*n7)*n17*n20*n35/(n34*n56) + pow(alpha, n1*n14 - n60*n7)*n35*n42*n7/(n34*n56) + n54) + n91 + n92 + n93 + n94) + 2.0*n91) + pow(-n126 - n14*(n0*n30*n31*n83*(pow(alpha, NP0*n1 - n1*n60)*n49*n51/n55 + n53) + n0*n30*n85*(pow(alpha, NP0*n1 - n1*n60)*n1*n2*n51/n55 + n2*n46)*(pow(alpha, NP0*n1 - n1*n60)*n1*n22*n51/n55 + n22*n46) + n0*xTj*(n113 + n114 + n115 + n116 + n118 + n12*n30*n31*(pow(alpha, NP0*n1 - n1*n60)*n1*n2*n51/n55 + n2*n46)*(pow(alpha, NP0*n1 - n1*n60)*n1*n22*n51/n55 + n22*n46)/n76 + n30*n38*xF[2]*(pow(alpha, NP0*n1 - n6*n60)*n2*n51*n6/n55 + n2*n43)*(pow(alpha, NP0*n1 - n6*n60)*n22*n51*n6/n55 + n22*n43)/n78 + n30*n38*xF[2]*(pow(alpha, NP0*n1 - n6*n60)*n42*n51*n6/n55 - pow(alpha, n1*n14 - n6*n60)*n17*n19*n35/(n34*n56) + pow(alpha, n1*n14 - n6*n60)*n35*n42*n6/(n34*n56) + n52)/n74 - n30*n44*(pow(alpha, NP0*n1 - n60*n7)*n2*n51*n7/n55 + n2*n45)*(pow(alpha, NP0*n1 - n60*n7)*n22*n51*n7/n55 + n22*n45)/n79 - n30*n47*(pow(alpha, NP0*n1 - n5*n60)*n2*n5*n51/n55 + n2*n48)*(pow(alpha, NP0*n1 - n5*n60)*n22*n5*n51/n55 + n22*n48)/n77 - n30*n47*(pow(alpha, NP0*n1 - n5*n60)*n42*n5*n51/n55 - pow(alpha, n1*n14 - n5*n60)*n17*n18*n35/(n34*n56) + pow(alpha, n1*n14 - n5*n60)*n35*n42*n5/(n34*n56) + n17*n18*n26)/n73 + n30*n86*(pow(alpha, NP0*n1 - n60*n7)*n42*n51*n7/n55 - pow(alpha, n1*n14 - n60*n7)*n17*n20*n35/(n34*n56) + pow(alpha, n1*n14 - n60*n7)*n35*n42*n7/(n34*n56) + n54) + n91 + n92 + n93 + n94) + 1.0*n2*n30*n46*n83*(pow(alpha, NP0*n1 - n1*n60)*n1*n2*n51/n55 + n2*n46) + n95), -n9);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - pow(NP_sqrt_base, -n0))/NP_2a;
-      NT1 = n41*(n57 - log(-pow(alpha, NP1*n1)*n51 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[2] - Mstar;
-      g5 = MW[3] - Mstar;
-      g6 = xF[0] - xTj;
-      g7 = xF[0] - xPj;
-      g8 = -xTj;
-      g9 = xPj/xF[1];
-      g10 = pow(alpha, -g1);
-      g11 = pow(alpha, -g0);
-      g12 = pow(alpha, -g4);
-      g13 = pow(alpha, -g5);
-      g14 = log(xF[0]/xF[1]);
-      g15 = -g2;
-      g16 = pow(alpha, NP1*g0);
-      g17 = pow(alpha, NP1*g1);
-      g18 = log(g10);
-      g19 = pow(alpha, NP1*g4);
-      g20 = pow(alpha, NP1*g5);
-      g21 = -g14;
-      g22 = g3/g6;
-      g23 = g6/g3;
-      g24 = -g16 + 1;
-      g25 = -g16 + 1;
-      g26 = -g17 + 1;
-      g27 = -g19 + 1;
-      g28 = -g20 + 1;
-      g29 = -g17;
-      g30 = -g19;
-      g31 = -g20;
-      g32 = -1.0*g14;
-      g33 = -g3/g7;
-      g34 = pow(alpha, g0*g15) - 1;
-      g35 = pow(alpha, g0*g15) - 1;
-      g36 = pow(alpha, g1*g15) - 1;
-      g37 = pow(alpha, g15*g4) - 1;
-      g38 = pow(alpha, g15*g5) - 1;
-      g39 = -pow(alpha, g1*g15);
-      g40 = -pow(alpha, g15*g4);
-      g41 = -pow(alpha, g15*g5);
-      g42 = g7*g8/(g3*xF[1]);
-      g43 = g25 + g35;
-      g44 = -g17 - g39;
-      g45 = -g19 - g40;
-      g46 = -g20 - g41;
-      g47 = pow(alpha, g1*g15) + g29;
-      g48 = g25 + g35;
-      g49 = pow(alpha, g15*g4) + g30;
-      g50 = pow(alpha, g15*g5) + g31;
-      g51 = xF[0]/g47;
-      g52 = xF[1]/g48;
-      g53 = xF[3]/g50;
-      g54 = xF[2]/g49;
-      g55 = xF[1]/g43;
-      g56 = xF[0]/g44;
-      g57 = xF[3]/g46;
-      g58 = xF[2]/g45;
-      g59 = g26/g44;
-      g60 = g28/g46;
-      g61 = g24/g43;
-      g62 = g27/g45;
-      g63 = g34/g43;
-      g64 = g37/g45;
-      g65 = g36/g44;
-      g66 = g38/g46;
-      g67 = log(g42*g48/g25);
-      g68 = log(g42*g43/g24);
-      g69 = log(g23*g48*g9/g35);
-      g70 = 1.0*g67;
-      g71 = log(g23*g43*g9/g34);
-      g72 = 1.0*g69;
-      g73 = -g25*g52*g70 - g32*xF[0] - g32*xF[1] - g32*xF[2] - g32*xF[3] - g35*g52*g72 - g51*g70*(g29 + 1) - g51*g72*(pow(alpha, g1*g15) - 1) - g53*g70*(g31 + 1) - g53*g72*(pow(alpha, g15*g5) - 1) - g54*g70*(g30 + 1) - g54*g72*(pow(alpha, g15*g4) - 1);
-      LpF = xF[0]*(g10 + 1.0)*(g21 + g59*g68 + g65*g71)/(g18*(g10 - 1.0)) + xF[1]*(g11 + 1.0)*(g21 + g61*g68 + g63*g71)/(g18*(g11 - 1.0)) + xF[2]*(g12 + 1.0)*(g21 + g62*g68 + g64*g71)/(g18*(g12 - 1.0)) + xF[3]*(g13 + 1.0)*(g21 + g60*g68 + g66*g71)/(g18*(g13 - 1.0));
-      PpF = g23;
-      TpF = -g7/g3;
-      SWUpF = g73;
-      SWUpP = g22*g73;
-      xP[0] = g22*g36*g56;
-      xP[1] = g22*g34*g55;
-      xP[2] = g22*g37*g58;
-      xP[3] = g22*g38*g57;
-      xT[0] = g26*g33*g56;
-      xT[1] = g24*g33*g55;
-      xT[2] = g27*g33*g58;
-      xT[3] = g28*g33*g57;
-      break;
-    case 5:
-      n0 = MW[0] - Mstar;
-      n1 = log(alpha);
-      n2 = xPj - xTj;
-      n3 = xF[0] - xPj;
-      n4 = MW[1] - Mstar;
-      n5 = MW[2] - Mstar;
-      n6 = MW[3] - Mstar;
-      n7 = MW[4] - Mstar;
-      n8 = log(xTj);
-      n9 = xF[0]*xPj;
-      n10 = -Mstar;
-      n11 = 2*NP0;
-      n12 = -xPj;
-      n13 = -xF[0];
-      n14 = -xTj;
-      n15 = pow(n0, 2);
-      n16 = pow(n1, 2);
-      n17 = pow(n4, 2);
-      n18 = pow(n5, 2);
-      n19 = pow(n6, 2);
-      n20 = pow(n7, 2);
-      n21 = Mstar*n1;
-      n22 = 2*n1;
-      n23 = pow(alpha, NP0*n0);
-      n24 = n13*xTj + n9;
-      n25 = n12*xTj + n9;
-      n26 = pow(alpha, NP0*n4);
-      n27 = pow(alpha, NP0*n5);
-      n28 = pow(alpha, NP0*n6);
-      n29 = pow(alpha, NP0*n7);
-      n30 = -MW[0]*n1;
-      n31 = n2/n3;
-      n32 = -n23 + 1;
-      n33 = -n26 + 1;
-      n34 = pow(alpha, n0*n11);
-      n35 = pow(n24, 2);
-      n36 = pow(n25, 2);
-      n37 = -n27 + 1;
-      n38 = -n28 + 1;
-      n39 = -n29 + 1;
-      n40 = -n37;
-      n41 = -n38;
-      n42 = -n23;
-      n43 = 1/(n0*n1);
-      n44 = n0*n16;
-      n45 = n27*n5;
-      n46 = n28*n6;
-      n47 = n29*n7;
-      n48 = n0*n23;
-      n49 = n26*n4;
-      n50 = n15*n16;
-      n51 = log((-1.0 + xPj/xF[0])/n2);
-      n52 = -n33*xF[1];
-      n53 = -n39*xF[4];
-      n54 = n25/n24;
-      n55 = n16*n18*n27;
-      n56 = n16*n20*n29;
-      n57 = n23*n50;
-      n58 = n16*n19*n28;
-      n59 = n42*n54 + 1;
-      n60 = pow(n59, 2);
-      n61 = n21 + n30 + n51 + n8;
-      n62 = n23*n54/n59;
-      n63 = n16*n34*n36/(n35*n60);
-      n64 = n43*(n61 - log(n59)) + 1;
-      n65 = pow(alpha, n0*n64);
-      n66 = pow(alpha, n4*n64);
-      n67 = pow(alpha, n5*n64);
-      n68 = pow(alpha, n6*n64);
-      n69 = pow(alpha, n64*n7);
-      n70 = n4/n66;
-      n71 = n7/n69;
-      n72 = n6/n68;
-      n73 = n5/n67;
-      n74 = n32 - 1 + 1.0/n65;
-      n75 = n33 - 1 + 1.0/n66;
-      n76 = n37 - 1 + 1.0/n67;
-      n77 = n38 - 1 + 1.0/n68;
-      n78 = n39 - 1 + 1.0/n69;
-      n79 = pow(n74, 2);
-      n80 = pow(n75, 2);
-      n81 = pow(n76, 2);
-      n82 = pow(n77, 2);
-      n83 = pow(n78, 2);
-      n84 = pow(n74, 3);
-      n85 = pow(n75, 3);
-      n86 = pow(n76, 3);
-      n87 = pow(n77, 3);
-      n88 = pow(n78, 3);
-      n89 = xF[2]/n76;
-      n90 = xF[4]/n78;
-      n91 = xF[3]/n77;
-      n92 = n1/n74;
-      n93 = xF[0]/n79;
-      n94 = n1*n91;
-      n95 = n32/n74;
-      n96 = n32*xF[0]/n84;
-      n97 = n41*xF[3]/n82;
-      n98 = n1*n49*xF[1]/n75;
-      n99 = n57*xF[0]/n74;
-      n100 = n16*n17*n26*xF[1]/n75;
-      n101 = n31*n48*n92*xF[0];
-      n102 = n13*n31*n48*n92;
-      n103 = n31*n99;
-      n104 = n100*n31;
-      n105 = n31*n55*n89;
-      n106 = n31*n58*n91;
-      n107 = n31*n56*n90;
-      n108 = 0.5*n103;
-      n109 = n54/(n59*n65) + 1;
-      n110 = n109*n32;
-      n111 = n1*n48*n54/(n59*n65) + n1*n48;
-      n112 = n1*n49 + n1*n62*n70;
-      n113 = n1*n45 + n1*n62*n73;
-      n114 = n1*n46 + n1*n62*n72;
-      n115 = n1*n47 + n1*n62*n71;
-      n116 = pow(n111, 2);
-      n117 = pow(n112, 2);
-      n118 = pow(n113, 2);
-      n119 = pow(n114, 2);
-      n120 = pow(n115, 2);
-      n121 = n113*xF[2];
-      n122 = n114*xF[3];
-      n123 = n22*n48*n54/(n59*n65) + n22*n48;
-      n124 = n1*n111;
-      n125 = -2*n116;
-      n126 = n54*n57/(n59*n65) + n57;
-      n127 = n111*n32;
-      n128 = n115*n53;
-      n129 = n112/n80;
-      n130 = 2*n120/n88;
-      n131 = 2*n117/n85;
-      n132 = 2*n118*xF[2]/n86;
-      n133 = -2*n119*n38*xF[3]/n87;
-      n134 = n13*n31*n32*(pow(alpha, NP0*n0 - n0*n64)*n0*n1*n54/n59 + n1*n48)/n79;
-      n135 = n22*n31*n48*n93*(pow(alpha, NP0*n0 - n0*n64)*n0*n1*n54/n59 + n1*n48);
-      n136 = n22*n31*n49*xF[1]*(pow(alpha, NP0*n0 - n4*n64)*n1*n4*n54/n59 + n1*n49)/n80;
-      n137 = n22*n31*n45*xF[2]*(pow(alpha, NP0*n0 - n5*n64)*n1*n5*n54/n59 + n1*n45)/n81;
-      n138 = n22*n31*n46*xF[3]*(pow(alpha, NP0*n0 - n6*n64)*n1*n54*n6/n59 + n1*n46)/n82;
-      n139 = n22*n31*n47*xF[4]*(pow(alpha, NP0*n0 - n64*n7)*n1*n54*n7/n59 + n1*n47)/n83;
-      n140 = 1.0*n124*n31*n48*n93;
-      n141 = n13*n31*n32*(pow(alpha, NP0*n0 - n0*n64)*n50*n54/n59 + n57)/n79;
-      n142 = -0.5*n126*n31*n32*n93;
-      n143 = n101 + n134;
-      n144 = n16*n17*n26 - n17*n63/n66 + n34*n36*n44*n70/(n35*n60) + n44*n62*n70;
-      n145 = -n18*n63/n67 + n34*n36*n44*n73/(n35*n60) + n44*n62*n73 + n55;
-      n146 = -n20*n63/n69 + n34*n36*n44*n71/(n35*n60) + n44*n62*n71 + n56;
-      n147 = n31*n52*(-pow(alpha, n0*n11 - n4*n64)*n16*n17*n36/(n35*n60) + pow(alpha, n0*n11 - n4*n64)*n36*n4*n44/(n35*n60) + n16*n17*n26 + n44*n62*n70)/n80;
-      n148 = n31*n40*xF[2]*(-pow(alpha, n0*n11 - n5*n64)*n16*n18*n36/(n35*n60) + pow(alpha, n0*n11 - n5*n64)*n36*n44*n5/(n35*n60) + n44*n62*n73 + n55)/n81;
-      n149 = n31*n97*(-pow(alpha, n0*n11 - n6*n64)*n16*n19*n36/(n35*n60) + pow(alpha, n0*n11 - n6*n64)*n36*n44*n6/(n35*n60) + n44*n62*n72 + n58);
-      n150 = n31*n53*(-pow(alpha, n0*n11 - n64*n7)*n16*n20*n36/(n35*n60) + pow(alpha, n0*n11 - n64*n7)*n36*n44*n7/(n35*n60) + n44*n62*n71 + n56)/n83;
-      n151 = n108 + n140 + n142;
-      n152 = n1*n31*n45*n89 + n1*n31*n47*n90 + n114*n31*n97 + n121*n31*n40/n81 + n128*n31/n83 + n129*n31*n52 + n143 + n31*n46*n94 + n31*n98;
-      n153 = n152*xTj;
-      n154 = n103 + n104 + n105 + n106 + n107 + n135 + n136 + n137 + n138 + n139 + n141 + n147 + n148 + n149 + n150;
-      n155 = n112*n31*n52*(n22*n49 + n22*n62*n70)/n85 + n121*n31*n40*(n22*n45 + n22*n62*n73)/n86 + n122*n31*n41*(n22*n46 + n22*n62*n72)/n87 + n128*n31*(n22*n47 + n22*n62*n71)/n88 + n13*n31*n32*(pow(alpha, NP0*n0 - n0*n64)*n0*n1*n54/n59 + n1*n48)*(pow(alpha, NP0*n0 - n0*n64)*n0*n22*n54/n59 + n22*n48)/n84 + n154;
-      n156 = n155*xTj;
-      n157 = -0.5*n111*n123*n31*n96 + n151 - 0.5*n156;
-      NP_b = -n1*n110*n31*n48*n93 - n102 - n11*(1.0*n1*n31*n48*n93*(pow(alpha, NP0*n0 - n0*n64)*n0*n1*n54/n59 + n1*n48) + n108 - 1.0*n116*n31*n96 - 0.5*n31*n32*n93*(pow(alpha, NP0*n0 - n0*n64)*n50*n54/n59 + n57) - 0.5*xTj*(n103 + n104 + n105 + n106 + n107 + n125*n31*n96 - n130*n31*n39*xF[4] - n131*n31*n33*xF[1] - n132*n31*n37 + n133*n31 + n135 + n136 + n137 + n138 + n139 + n141 + n31*n40*xF[2]*(pow(alpha, NP0*n0 - n5*n64)*n44*n5*n54/n59 - pow(alpha, n0*n11 - n5*n64)*n16*n18*n36/(n35*n60) + pow(alpha, n0*n11 - n5*n64)*n36*n44*n5/(n35*n60) + n55)/n81 + n31*n52*(pow(alpha, NP0*n0 - n4*n64)*n4*n44*n54/n59 - pow(alpha, n0*n11 - n4*n64)*n16*n17*n36/(n35*n60) + pow(alpha, n0*n11 - n4*n64)*n36*n4*n44/(n35*n60) + n16*n17*n26)/n80 + n31*n53*(pow(alpha, NP0*n0 - n64*n7)*n44*n54*n7/n59 - pow(alpha, n0*n11 - n64*n7)*n16*n20*n36/(n35*n60) + pow(alpha, n0*n11 - n64*n7)*n36*n44*n7/(n35*n60) + n56)/n83 + n31*n97*(pow(alpha, NP0*n0 - n6*n64)*n44*n54*n6/n59 - pow(alpha, n0*n11 - n6*n64)*n16*n19*n36/(n35*n60) + pow(alpha, n0*n11 - n6*n64)*n36*n44*n6/(n35*n60) + n58))) - n31*xTj*(n1*n45*n89 + n1*n47*n90 + n114*n97 + n121*n40/n81 + n128/n83 + n129*n52 + n13*n32*(pow(alpha, NP0*n0 - n0*n64)*n0*n1*n54/n59 + n1*n48)/n79 + n46*n94 + n48*n92*xF[0] + n98);
-      NP_2a = -n31*(2*pow(n109, 2)*n34*n50*n96 - 2.0*n109*n34*n50*n93 + n110*n57*n93 - 1.0*n99 + 1.0*xTj*(n100 + n125*n96 + n13*n32*(pow(alpha, NP0*n0 - n0*n64)*n50*n54/n59 + n57)/n79 - n130*n39*xF[4] - n131*n33*xF[1] - n132*n37 + n133 + n22*n45*xF[2]*(pow(alpha, NP0*n0 - n5*n64)*n1*n5*n54/n59 + n1*n45)/n81 + n22*n46*xF[3]*(pow(alpha, NP0*n0 - n6*n64)*n1*n54*n6/n59 + n1*n46)/n82 + n22*n47*xF[4]*(pow(alpha, NP0*n0 - n64*n7)*n1*n54*n7/n59 + n1*n47)/n83 + n22*n48*n93*(pow(alpha, NP0*n0 - n0*n64)*n0*n1*n54/n59 + n1*n48) + n22*n49*xF[1]*(pow(alpha, NP0*n0 - n4*n64)*n1*n4*n54/n59 + n1*n49)/n80 + n40*xF[2]*(-pow(alpha, n0*n11 - n5*n64)*n16*n18*n36/(n35*n60) + pow(alpha, n0*n11 - n5*n64)*n36*n44*n5/(n35*n60) + n44*n62*n73 + n55)/n81 + n52*(-pow(alpha, n0*n11 - n4*n64)*n16*n17*n36/(n35*n60) + pow(alpha, n0*n11 - n4*n64)*n36*n4*n44/(n35*n60) + n16*n17*n26 + n44*n62*n70)/n80 + n53*(-pow(alpha, n0*n11 - n64*n7)*n16*n20*n36/(n35*n60) + pow(alpha, n0*n11 - n64*n7)*n36*n44*n7/(n35*n60) + n44*n62*n71 + n56)/n83 + n55*n89 + n56*n90 + n58*n91 + n97*(-pow(alpha, n0*n11 - n6*n64)*n16*n19*n36/(n35*n60) + pow(alpha, n0*n11 - n6*n64)*n36*n44*n6/(n35*n60) + n44*n62*n72 + n58) + n99));
-      NP_sqrt_base = pow(-n102 - n11*(1.0*n1*n31*n48*n93*(pow(alpha, NP0*n0 - n0*n64)*n0*n1*n54/n59 + n1*n48) + n108 - 0.5*n31*n32*n93*(pow(alpha, NP0*n0 - n0*n64)*n50*n54/n59 + n57) - 0.5*n31*n96*(pow(alpha, NP0*n0 - n0*n64)*n0*n1*n54/n59 + n1*n48)*(pow(alpha, NP0*n0 - n0*n64)*n0*n22*n54/n59 + n22*n48) - 0.5*xTj*(n103 + n104 + n105 + n106 + n107 + n13*n31*n32*(pow(alpha, NP0*n0 - n0*n64)*n0*n1*n54/n59 + n1*n48)*(pow(alpha, NP0*n0 - n0*n64)*n0*n22*n54/n59 + n22*n48)/n84 + n135 + n136 + n137 + n138 + n139 + n141 + n31*n40*xF[2]*(pow(alpha, NP0*n0 - n5*n64)*n1*n5*n54/n59 + n1*n45)*(pow(alpha, NP0*n0 - n5*n64)*n22*n5*n54/n59 + n22*n45)/n86 + n31*n40*xF[2]*(pow(alpha, NP0*n0 - n5*n64)*n44*n5*n54/n59 - pow(alpha, n0*n11 - n5*n64)*n16*n18*n36/(n35*n60) + pow(alpha, n0*n11 - n5*n64)*n36*n44*n5/(n35*n60) + n55)/n81 + n31*n41*xF[3]*(pow(alpha, NP0*n0 - n6*n64)*n1*n54*n6/n59 + n1*n46)*(pow(alpha, NP0*n0 - n6*n64)*n22*n54*n6/n59 + n22*n46)/n87 + n31*n52*(pow(alpha, NP0*n0 - n4*n64)*n1*n4*n54/n59 + n1*n49)*(pow(alpha, NP0*n0 - n4*n64)*n22*n4*n54/n59 + n22*n49)/n85 + n31*n52*(pow(alpha, NP0*n0 - n4*n64)*n4*n44*n54/n59 - pow(alpha, n0*n11 - n4*n64)*n16*n17*n36/(n35*n60) + pow(alpha, n0*n11 - n4*n64)*n36*n4*n44/(n35*n60) + n16*n17*n26)/n80 + n31*n53*(pow(alpha, NP0*n0 - n64*n7)*n1*n54*n7/n59 + n1*n47)*(pow(alpha, NP0*n0 - n64*n7)*n22*n54*n7/n59 + n22*n47)/n88 + n31*n53*(pow(alpha, NP0*n0 - n64*n7)*n44*n54*n7/n59 - pow(alpha, n0*n11 - n64*n7)*n16*n20*n36/(n35*n60) + pow(alpha, n0*n11 - n64*n7)*n36*n44*n7/(n35*n60) + n56)/n83 + n31*n97*(pow(alpha, NP0*n0 - n6*n64)*n44*n54*n6/n59 - pow(alpha, n0*n11 - n6*n64)*n16*n19*n36/(n35*n60) + pow(alpha, n0*n11 - n6*n64)*n36*n44*n6/(n35*n60) + n58))) - n127*n31*n93 - n153, 2) + (-pow(NP0, 2)*n157 + NP0*(n14*(n1*n31*n45*n89 + n1*n31*n47*n90 + n143 + n31*n40*xF[2]*(pow(alpha, NP0*n0 - n5*n64)*n1*n5*n54/n59 + n1*n45)/n81 + n31*n46*n94 + n31*n52*(pow(alpha, NP0*n0 - n4*n64)*n1*n4*n54/n59 + n1*n49)/n80 + n31*n53*(pow(alpha, NP0*n0 - n64*n7)*n1*n54*n7/n59 + n1*n47)/n83 + n31*n97*(pow(alpha, NP0*n0 - n6*n64)*n1*n54*n6/n59 + n1*n46) + n31*n98) + n143) + n31*n95*xF[0] + xTj*(n13*n31*n95 + n31*n40*n89 + n31*n41*n91 + n31*n52/n75 + n31*n53/n78))*(2.0*n103 - 4.0*n116*n31*n96 + 4.0*n124*n31*n48*n93 - 2.0*n126*n31*n32*n93 - 2.0*n156);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n43*(n61 - log(-pow(alpha, NP1*n0)*n54 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[2] - Mstar;
-      g5 = MW[3] - Mstar;
-      g6 = MW[4] - Mstar;
-      g7 = xF[0] - xTj;
-      g8 = xF[0] - xPj;
-      g9 = -xTj;
-      g10 = 1.0*xF[4];
-      g11 = 1.0*xF[3];
-      g12 = 1.0*xF[0];
-      g13 = xPj/xF[1];
-      g14 = pow(alpha, -g1);
-      g15 = pow(alpha, -g0);
-      g16 = pow(alpha, -g4);
-      g17 = pow(alpha, -g5);
-      g18 = pow(alpha, -g6);
-      g19 = log(xF[0]/xF[1]);
-      g20 = -g2;
-      g21 = pow(alpha, NP1*g0);
-      g22 = pow(alpha, NP1*g1);
-      g23 = log(g14);
-      g24 = pow(alpha, NP1*g4);
-      g25 = pow(alpha, NP1*g5);
-      g26 = pow(alpha, NP1*g6);
-      g27 = -g19;
-      g28 = g3/g7;
-      g29 = g7/g3;
-      g30 = -g21 + 1;
-      g31 = -g21 + 1;
-      g32 = -g22 + 1;
-      g33 = -g24 + 1;
-      g34 = -g25 + 1;
-      g35 = -g26 + 1;
-      g36 = -g22;
-      g37 = -g24;
-      g38 = -g25;
-      g39 = -g26;
-      g40 = -1.0*g19;
-      g41 = -g3/g8;
-      g42 = g40*xF[0];
-      g43 = g40*xF[1];
-      g44 = g40*xF[2];
-      g45 = g40*xF[3];
-      g46 = g40*xF[4];
-      g47 = pow(alpha, g0*g20) - 1;
-      g48 = pow(alpha, g0*g20) - 1;
-      g49 = pow(alpha, g1*g20) - 1;
-      g50 = pow(alpha, g20*g4) - 1;
-      g51 = pow(alpha, g20*g5) - 1;
-      g52 = pow(alpha, g20*g6) - 1;
-      g53 = -pow(alpha, g1*g20);
-      g54 = -pow(alpha, g20*g4);
-      g55 = -pow(alpha, g20*g5);
-      g56 = -pow(alpha, g20*g6);
-      g57 = g8*g9/(g3*xF[1]);
-      g58 = g31 + g48;
-      g59 = -g22 - g53;
-      g60 = -g24 - g54;
-      g61 = -g25 - g55;
-      g62 = -g26 - g56;
-      g63 = pow(alpha, g1*g20) + g36;
-      g64 = g31 + g48;
-      g65 = pow(alpha, g20*g4) + g37;
-      g66 = pow(alpha, g20*g5) + g38;
-      g67 = pow(alpha, g20*g6) + g39;
-      g68 = xF[1]/g64;
-      g69 = xF[2]/g65;
-      g70 = xF[1]/g58;
-      g71 = xF[3]/g61;
-      g72 = xF[0]/g59;
-      g73 = xF[2]/g60;
-      g74 = xF[4]/g62;
-      g75 = g12/g59;
-      g76 = 1.0*g73;
-      g77 = 1.0*g70;
-      g78 = g35/g62;
-      g79 = g32/g59;
-      g80 = g34/g61;
-      g81 = g30/g58;
-      g82 = g33/g60;
-      g83 = g32*g72;
-      g84 = g33*g73;
-      g85 = g30*g70;
-      g86 = g47/g58;
-      g87 = g50/g60;
-      g88 = g51/g61;
-      g89 = g49/g59;
-      g90 = g52/g62;
-      g91 = g47*g70;
-      g92 = g49*g72;
-      g93 = g50*g73;
-      g94 = log(g57*g64/g31);
-      g95 = log(g57*g58/g30);
-      g96 = log(g13*g29*g64/g48);
-      g97 = 1.0*g94;
-      g98 = log(g13*g29*g58/g47);
-      g99 = 1.0*g96;
-      g100 = g42 + g43 + g44 + g45 + g46;
-      g101 = g78*g95;
-      g102 = g79*g95;
-      g103 = g82*g95;
-      g104 = g81*g95;
-      g105 = g80*g95;
-      g106 = g87*g98;
-      g107 = g88*g98;
-      g108 = g90*g98;
-      g109 = g86*g98;
-      g110 = g89*g98;
-      LpF = xF[0]*(g14 + 1.0)*(g102 + g110 + g27)/(g23*(g14 - 1.0)) + xF[1]*(g15 + 1.0)*(g104 + g109 + g27)/(g23*(g15 - 1.0)) + xF[2]*(g16 + 1.0)*(g103 + g106 + g27)/(g23*(g16 - 1.0)) + xF[3]*(g17 + 1.0)*(g105 + g107 + g27)/(g23*(g17 - 1.0)) + xF[4]*(g18 + 1.0)*(g101 + g108 + g27)/(g23*(g18 - 1.0));
-      PpF = g29;
-      TpF = -g8/g3;
-      SWUpF = -g10*g94*(g39 + 1)/g67 - g10*g96*(pow(alpha, g20*g6) - 1)/g67 - g100 - g11*g94*(g38 + 1)/g66 - g11*g96*(pow(alpha, g20*g5) - 1)/g66 - g12*g94*(g36 + 1)/g63 - g12*g96*(pow(alpha, g1*g20) - 1)/g63 - g31*g68*g97 - g48*g68*g99 - g69*g97*(g37 + 1) - g69*g99*(pow(alpha, g20*g4) - 1);
-      SWUpP = -g28*(g10*g101 + g10*g108 + g100 + g105*g11 + g107*g11 + g30*g77*g95 + g32*g75*g95 + g33*g76*g95 + g47*g77*g98 + g49*g75*g98 + g50*g76*g98);
-      xP[0] = g28*g92;
-      xP[1] = g28*g91;
-      xP[2] = g28*g93;
-      xP[3] = g28*g51*g71;
-      xP[4] = g28*g52*g74;
-      xT[0] = g41*g83;
-      xT[1] = g41*g85;
-      xT[2] = g41*g84;
-      xT[3] = g34*g41*g71;
-      xT[4] = g35*g41*g74;
-      break;
-    case 6:
-      n0 = MW[0] - Mstar;
-      n1 = log(alpha);
-      n2 = xPj - xTj;
-      n3 = xF[0] - xPj;
-      n4 = MW[1] - Mstar;
-      n5 = MW[2] - Mstar;
-      n6 = MW[3] - Mstar;
-      n7 = MW[4] - Mstar;
-      n8 = MW[5] - Mstar;
-      n9 = log(xTj);
-      n10 = xF[0]*xPj;
-      n11 = -Mstar;
-      n12 = -xF[0];
-      n13 = -xTj;
-      n14 = -xPj;
-      n15 = 2*NP0;
-      n16 = 0.5*xF[0];
-      n17 = pow(n0, 2);
-      n18 = pow(n1, 2);
-      n19 = pow(n4, 2);
-      n20 = pow(n5, 2);
-      n21 = pow(n6, 2);
-      n22 = pow(n7, 2);
-      n23 = pow(n8, 2);
-      n24 = Mstar*n1;
-      n25 = 2*n1;
-      n26 = -1.0*xF[0];
-      n27 = pow(alpha, NP0*n0);
-      n28 = n10 + n12*xTj;
-      n29 = n10 + n13*xPj;
-      n30 = pow(alpha, NP0*n4);
-      n31 = pow(alpha, NP0*n5);
-      n32 = pow(alpha, NP0*n6);
-      n33 = pow(alpha, NP0*n7);
-      n34 = pow(alpha, NP0*n8);
-      n35 = -MW[0]*n1;
-      n36 = n2/n3;
-      n37 = -n27 + 1;
-      n38 = -n30 + 1;
-      n39 = pow(alpha, n0*n15);
-      n40 = pow(n28, 2);
-      n41 = pow(n29, 2);
-      n42 = -n31 + 1;
-      n43 = -n32 + 1;
-      n44 = -n33 + 1;
-      n45 = -n34 + 1;
-      n46 = -n27;
-      n47 = 1/(n0*n1);
-      n48 = n0*n18;
-      n49 = n45*xF[5];
-      n50 = n32*n6;
-      n51 = n30*n4;
-      n52 = n33*n7;
-      n53 = n0*n27;
-      n54 = n34*n8;
-      n55 = n42*xF[2];
-      n56 = n31*n5;
-      n57 = n17*n18;
-      n58 = log((-1.0 + xPj/xF[0])/n2);
-      n59 = n56*xF[2];
-      n60 = -n44*xF[4];
-      n61 = -n38*xF[1];
-      n62 = n29/n28;
-      n63 = n18*n20*n31;
-      n64 = n18*n22*n33;
-      n65 = n27*n57;
-      n66 = n18*n21*n32;
-      n67 = n18*n19*n30;
-      n68 = -n36*n49;
-      n69 = n46*n62 + 1;
-      n70 = pow(n69, 2);
-      n71 = n24 + n35 + n58 + n9;
-      n72 = n27*n62/n69;
-      n73 = n18*n39*n41/(n40*n70);
-      n74 = n47*(n71 - log(n69)) + 1;
-      n75 = pow(alpha, n0*n74);
-      n76 = pow(alpha, n4*n74);
-      n77 = pow(alpha, n5*n74);
-      n78 = pow(alpha, n6*n74);
-      n79 = pow(alpha, n7*n74);
-      n80 = pow(alpha, n74*n8);
-      n81 = n4/n76;
-      n82 = n7/n79;
-      n83 = n6/n78;
-      n84 = n8/n80;
-      n85 = n5/n77;
-      n86 = n37 - 1 + 1.0/n75;
-      n87 = n38 - 1 + 1.0/n76;
-      n88 = n42 - 1 + 1.0/n77;
-      n89 = n43 - 1 + 1.0/n78;
-      n90 = n44 - 1 + 1.0/n79;
-      n91 = n45 - 1 + 1.0/n80;
-      n92 = pow(n86, 2);
-      n93 = pow(n87, 2);
-      n94 = pow(n88, 2);
-      n95 = pow(n89, 2);
-      n96 = pow(n90, 2);
-      n97 = pow(n91, 2);
-      n98 = pow(n86, 3);
-      n99 = pow(n87, 3);
-      n100 = pow(n88, 3);
-      n101 = pow(n89, 3);
-      n102 = pow(n90, 3);
-      n103 = pow(n91, 3);
-      n104 = xF[1]/n87;
-      n105 = xF[4]/n90;
-      n106 = xF[2]/n88;
-      n107 = xF[3]/n89;
-      n108 = n1/n88;
-      n109 = n1/n86;
-      n110 = n1*n107;
-      n111 = n37/n98;
-      n112 = -n43*xF[3]/n95;
-      n113 = n1*n54*xF[5]/n91;
-      n114 = n65/n86;
-      n115 = n18*n23*n34*xF[5]/n91;
-      n116 = n109*n12*n36*n53;
-      n117 = n114*n36*xF[0];
-      n118 = n104*n36*n67;
-      n119 = n106*n36*n63;
-      n120 = n107*n36*n66;
-      n121 = n105*n36*n64;
-      n122 = n115*n36;
-      n123 = n114*n16*n36;
-      n124 = n62/(n69*n75) + 1;
-      n125 = n1*n53*n62/(n69*n75) + n1*n53;
-      n126 = n1*n51 + n1*n72*n81;
-      n127 = n1*n56 + n1*n72*n85;
-      n128 = n1*n50 + n1*n72*n83;
-      n129 = n1*n52 + n1*n72*n82;
-      n130 = n1*n54 + n1*n72*n84;
-      n131 = pow(n125, 2);
-      n132 = pow(n126, 2);
-      n133 = pow(n127, 2);
-      n134 = pow(n128, 2);
-      n135 = pow(n129, 2);
-      n136 = pow(n130, 2);
-      n137 = n128*xF[3];
-      n138 = n25*n53*n62/(n69*n75) + n25*n53;
-      n139 = 2*n131;
-      n140 = n62*n65/(n69*n75) + n65;
-      n141 = n129*n60;
-      n142 = n124*n37*xF[0]/n92;
-      n143 = n130/n97;
-      n144 = n127/n94;
-      n145 = n126/n93;
-      n146 = n129*xF[4]/n96;
-      n147 = n125*xF[0]/n92;
-      n148 = 2*n136/n103;
-      n149 = 2*n135/n102;
-      n150 = 2*n132/n99;
-      n151 = -2*n133/n100;
-      n152 = -2*n134*n43*xF[3]/n101;
-      n153 = n140*n37/n92;
-      n154 = n147*n36*n37;
-      n155 = n25*n36*n53*xF[0]*(pow(alpha, NP0*n0 - n0*n74)*n0*n1*n62/n69 + n1*n53)/n92;
-      n156 = n25*n36*n51*xF[1]*(pow(alpha, NP0*n0 - n4*n74)*n1*n4*n62/n69 + n1*n51)/n93;
-      n157 = n25*n36*n59*(pow(alpha, NP0*n0 - n5*n74)*n1*n5*n62/n69 + n1*n56)/n94;
-      n158 = n25*n36*n50*xF[3]*(pow(alpha, NP0*n0 - n6*n74)*n1*n6*n62/n69 + n1*n50)/n95;
-      n159 = n25*n36*n52*xF[4]*(pow(alpha, NP0*n0 - n7*n74)*n1*n62*n7/n69 + n1*n52)/n96;
-      n160 = n25*n36*n54*xF[5]*(pow(alpha, NP0*n0 - n74*n8)*n1*n62*n8/n69 + n1*n54)/n97;
-      n161 = 1.0*n1*n147*n36*n53;
-      n162 = n12*n36*n37*(pow(alpha, NP0*n0 - n0*n74)*n57*n62/n69 + n65)/n92;
-      n163 = -0.5*n153*n36*xF[0];
-      n164 = n125*n138;
-      n165 = -n19*n73/n76 + n39*n41*n48*n81/(n40*n70) + n48*n72*n81 + n67;
-      n166 = -n20*n73/n77 + n39*n41*n48*n85/(n40*n70) + n48*n72*n85 + n63;
-      n167 = -n22*n73/n79 + n39*n41*n48*n82/(n40*n70) + n48*n72*n82 + n64;
-      n168 = n18*n23*n34 - n23*n73/n80 + n39*n41*n48*n84/(n40*n70) + n48*n72*n84;
-      n169 = n36*n61*(-pow(alpha, n0*n15 - n4*n74)*n18*n19*n41/(n40*n70) + pow(alpha, n0*n15 - n4*n74)*n4*n41*n48/(n40*n70) + n48*n72*n81 + n67)/n93;
-      n170 = -n36*n55*(-pow(alpha, n0*n15 - n5*n74)*n18*n20*n41/(n40*n70) + pow(alpha, n0*n15 - n5*n74)*n41*n48*n5/(n40*n70) + n48*n72*n85 + n63)/n94;
-      n171 = n112*n36*(-pow(alpha, n0*n15 - n6*n74)*n18*n21*n41/(n40*n70) + pow(alpha, n0*n15 - n6*n74)*n41*n48*n6/(n40*n70) + n48*n72*n83 + n66);
-      n172 = n36*n60*(-pow(alpha, n0*n15 - n7*n74)*n18*n22*n41/(n40*n70) + pow(alpha, n0*n15 - n7*n74)*n41*n48*n7/(n40*n70) + n48*n72*n82 + n64)/n96;
-      n173 = n68*(-pow(alpha, n0*n15 - n74*n8)*n18*n23*n41/(n40*n70) + pow(alpha, n0*n15 - n74*n8)*n41*n48*n8/(n40*n70) + n18*n23*n34 + n48*n72*n84)/n97;
-      n174 = n123 + n161 + n163;
-      n175 = xTj*(n1*n104*n36*n51 + n1*n105*n36*n52 + n108*n36*n59 + n109*n36*n53*xF[0] + n110*n36*n50 + n112*n128*n36 + n113*n36 + n12*n36*n37*(pow(alpha, NP0*n0 - n0*n74)*n0*n1*n62/n69 + n1*n53)/n92 + n141*n36/n96 + n143*n68 - n144*n36*n55 + n145*n36*n61);
-      n176 = n116 + n154 + n175;
-      n177 = n117 + n118 + n119 + n120 + n121 + n122 + n155 + n156 + n157 + n158 + n159 + n160 + n162 + n169 + n170 + n171 + n172 + n173;
-      n178 = n111*n12*n36*(pow(alpha, NP0*n0 - n0*n74)*n0*n1*n62/n69 + n1*n53)*(pow(alpha, NP0*n0 - n0*n74)*n0*n25*n62/n69 + n25*n53) + n126*n36*n61*(n25*n51 + n25*n72*n81)/n99 + n177 + n130*n68*(n25*n54 + n25*n72*n84)/n103 + n141*n36*(n25*n52 + n25*n72*n82)/n102 - n137*n36*n43*(n25*n50 + n25*n72*n83)/n101 - n127*n36*n55*(n25*n56 + n25*n72*n85)/n100;
-      NP_b = -n1*n142*n36*n53 - n116 - n15*(1.0*n1*n36*n53*xF[0]*(pow(alpha, NP0*n0 - n0*n74)*n0*n1*n62/n69 + n1*n53)/n92 + n111*n131*n26*n36 + n123 - 0.5*n36*n37*xF[0]*(pow(alpha, NP0*n0 - n0*n74)*n57*n62/n69 + n65)/n92 - 0.5*xTj*(-n111*n139*n36*xF[0] + n112*n36*(pow(alpha, NP0*n0 - n6*n74)*n48*n6*n62/n69 - pow(alpha, n0*n15 - n6*n74)*n18*n21*n41/(n40*n70) + pow(alpha, n0*n15 - n6*n74)*n41*n48*n6/(n40*n70) + n66) + n117 + n118 + n119 + n120 + n121 + n122 - n148*n36*n49 - n149*n36*n44*xF[4] - n150*n36*n38*xF[1] + n151*n36*n55 + n152*n36 + n155 + n156 + n157 + n158 + n159 + n160 + n162 - n36*n55*(pow(alpha, NP0*n0 - n5*n74)*n48*n5*n62/n69 - pow(alpha, n0*n15 - n5*n74)*n18*n20*n41/(n40*n70) + pow(alpha, n0*n15 - n5*n74)*n41*n48*n5/(n40*n70) + n63)/n94 + n36*n60*(pow(alpha, NP0*n0 - n7*n74)*n48*n62*n7/n69 - pow(alpha, n0*n15 - n7*n74)*n18*n22*n41/(n40*n70) + pow(alpha, n0*n15 - n7*n74)*n41*n48*n7/(n40*n70) + n64)/n96 + n36*n61*(pow(alpha, NP0*n0 - n4*n74)*n4*n48*n62/n69 - pow(alpha, n0*n15 - n4*n74)*n18*n19*n41/(n40*n70) + pow(alpha, n0*n15 - n4*n74)*n4*n41*n48/(n40*n70) + n67)/n93 + n68*(pow(alpha, NP0*n0 - n74*n8)*n48*n62*n8/n69 - pow(alpha, n0*n15 - n74*n8)*n18*n23*n41/(n40*n70) + pow(alpha, n0*n15 - n74*n8)*n41*n48*n8/(n40*n70) + n18*n23*n34)/n97)) - n36*xTj*(n1*n104*n51 + n1*n105*n52 + n108*n59 + n109*n53*xF[0] + n110*n50 + n112*n128 + n113 + n12*n37*(pow(alpha, NP0*n0 - n0*n74)*n0*n1*n62/n69 + n1*n53)/n92 + n141/n96 - n143*n49 - n144*n55 + n145*n61);
-      NP_2a = -n36*(2*n111*pow(n124, 2)*n39*n57*xF[0] + n114*n26 - 2.0*n124*n39*n57*xF[0]/n92 + n142*n65 + 1.0*xTj*(n104*n67 + n105*n64 + n106*n63 + n107*n66 - n111*n139*xF[0] + n112*(-pow(alpha, n0*n15 - n6*n74)*n18*n21*n41/(n40*n70) + pow(alpha, n0*n15 - n6*n74)*n41*n48*n6/(n40*n70) + n48*n72*n83 + n66) + n114*xF[0] + n115 + n12*n37*(pow(alpha, NP0*n0 - n0*n74)*n57*n62/n69 + n65)/n92 - n148*n49 - n149*n44*xF[4] - n150*n38*xF[1] + n151*n55 + n152 + n25*n50*xF[3]*(pow(alpha, NP0*n0 - n6*n74)*n1*n6*n62/n69 + n1*n50)/n95 + n25*n51*xF[1]*(pow(alpha, NP0*n0 - n4*n74)*n1*n4*n62/n69 + n1*n51)/n93 + n25*n52*xF[4]*(pow(alpha, NP0*n0 - n7*n74)*n1*n62*n7/n69 + n1*n52)/n96 + n25*n53*xF[0]*(pow(alpha, NP0*n0 - n0*n74)*n0*n1*n62/n69 + n1*n53)/n92 + n25*n54*xF[5]*(pow(alpha, NP0*n0 - n74*n8)*n1*n62*n8/n69 + n1*n54)/n97 + n25*n59*(pow(alpha, NP0*n0 - n5*n74)*n1*n5*n62/n69 + n1*n56)/n94 - n49*(-pow(alpha, n0*n15 - n74*n8)*n18*n23*n41/(n40*n70) + pow(alpha, n0*n15 - n74*n8)*n41*n48*n8/(n40*n70) + n18*n23*n34 + n48*n72*n84)/n97 - n55*(-pow(alpha, n0*n15 - n5*n74)*n18*n20*n41/(n40*n70) + pow(alpha, n0*n15 - n5*n74)*n41*n48*n5/(n40*n70) + n48*n72*n85 + n63)/n94 + n60*(-pow(alpha, n0*n15 - n7*n74)*n18*n22*n41/(n40*n70) + pow(alpha, n0*n15 - n7*n74)*n41*n48*n7/(n40*n70) + n48*n72*n82 + n64)/n96 + n61*(-pow(alpha, n0*n15 - n4*n74)*n18*n19*n41/(n40*n70) + pow(alpha, n0*n15 - n4*n74)*n4*n41*n48/(n40*n70) + n48*n72*n81 + n67)/n93));
-      NP_sqrt_base = pow(-n15*(1.0*n1*n36*n53*xF[0]*(pow(alpha, NP0*n0 - n0*n74)*n0*n1*n62/n69 + n1*n53)/n92 - 0.5*n111*n36*xF[0]*(pow(alpha, NP0*n0 - n0*n74)*n0*n1*n62/n69 + n1*n53)*(pow(alpha, NP0*n0 - n0*n74)*n0*n25*n62/n69 + n25*n53) + n123 - 0.5*n36*n37*xF[0]*(pow(alpha, NP0*n0 - n0*n74)*n57*n62/n69 + n65)/n92 - 0.5*xTj*(n111*n12*n36*(pow(alpha, NP0*n0 - n0*n74)*n0*n1*n62/n69 + n1*n53)*(pow(alpha, NP0*n0 - n0*n74)*n0*n25*n62/n69 + n25*n53) + n112*n36*(pow(alpha, NP0*n0 - n6*n74)*n48*n6*n62/n69 - pow(alpha, n0*n15 - n6*n74)*n18*n21*n41/(n40*n70) + pow(alpha, n0*n15 - n6*n74)*n41*n48*n6/(n40*n70) + n66) + n117 + n118 + n119 + n120 + n121 + n122 + n155 + n156 + n157 + n158 + n159 + n160 + n162 - n36*n55*(pow(alpha, NP0*n0 - n5*n74)*n48*n5*n62/n69 - pow(alpha, n0*n15 - n5*n74)*n18*n20*n41/(n40*n70) + pow(alpha, n0*n15 - n5*n74)*n41*n48*n5/(n40*n70) + n63)/n94 + n36*n60*(pow(alpha, NP0*n0 - n7*n74)*n48*n62*n7/n69 - pow(alpha, n0*n15 - n7*n74)*n18*n22*n41/(n40*n70) + pow(alpha, n0*n15 - n7*n74)*n41*n48*n7/(n40*n70) + n64)/n96 + n36*n61*(pow(alpha, NP0*n0 - n4*n74)*n1*n4*n62/n69 + n1*n51)*(pow(alpha, NP0*n0 - n4*n74)*n25*n4*n62/n69 + n25*n51)/n99 + n36*n61*(pow(alpha, NP0*n0 - n4*n74)*n4*n48*n62/n69 - pow(alpha, n0*n15 - n4*n74)*n18*n19*n41/(n40*n70) + pow(alpha, n0*n15 - n4*n74)*n4*n41*n48/(n40*n70) + n67)/n93 + n68*(pow(alpha, NP0*n0 - n74*n8)*n48*n62*n8/n69 - pow(alpha, n0*n15 - n74*n8)*n18*n23*n41/(n40*n70) + pow(alpha, n0*n15 - n74*n8)*n41*n48*n8/(n40*n70) + n18*n23*n34)/n97 + n68*(pow(alpha, NP0*n0 - n74*n8)*n1*n62*n8/n69 + n1*n54)*(pow(alpha, NP0*n0 - n74*n8)*n25*n62*n8/n69 + n25*n54)/n103 + n36*n60*(pow(alpha, NP0*n0 - n7*n74)*n1*n62*n7/n69 + n1*n52)*(pow(alpha, NP0*n0 - n7*n74)*n25*n62*n7/n69 + n25*n52)/n102 - n36*n43*xF[3]*(pow(alpha, NP0*n0 - n6*n74)*n1*n6*n62/n69 + n1*n50)*(pow(alpha, NP0*n0 - n6*n74)*n25*n6*n62/n69 + n25*n50)/n101 - n36*n55*(pow(alpha, NP0*n0 - n5*n74)*n1*n5*n62/n69 + n1*n56)*(pow(alpha, NP0*n0 - n5*n74)*n25*n5*n62/n69 + n25*n56)/n100)) - n176, 2) + (-pow(NP0, 2)*(-n1*n26*n36*n53*(pow(alpha, NP0*n0 - n0*n74)*n0*n1*n62/n69 + n1*n53)/n92 - n111*n16*n36*(pow(alpha, NP0*n0 - n0*n74)*n0*n1*n62/n69 + n1*n53)*(pow(alpha, NP0*n0 - n0*n74)*n0*n25*n62/n69 + n25*n53) + 0.5*n117 - n16*n36*n37*(pow(alpha, NP0*n0 - n0*n74)*n57*n62/n69 + n65)/n92 - 0.5*n178*xTj) - NP0*n176 - n12*n36*n37/(n37 - 1 + pow(alpha, -n0*(n47*(n71 - log(n29*n46/(n10 + n13*xF[0]) + 1)) + 1))) - n13*(-n36*n37*xF[0]/(n37 - 1 + pow(alpha, -n0*(n47*(n71 - log(1 + n46*(n10 + n14*xTj)/n28)) + 1))) - n36*n38*xF[1]/(n38 - 1 + pow(alpha, -n4*(n47*(n71 - log(1 + n46*(n10 + n14*xTj)/n28)) + 1))) - n36*n43*xF[3]/(n43 - 1 + pow(alpha, -n6*(n47*(n71 - log(1 + n46*(n10 + n14*xTj)/n28)) + 1))) - n36*n44*xF[4]/(n44 - 1 + pow(alpha, -n7*(n47*(n71 - log(1 + n46*(n10 + n14*xTj)/n28)) + 1))) - n36*n49/(n45 - 1 + pow(alpha, -n8*(n47*(n71 - log(1 + n46*(n10 + n14*xTj)/n28)) + 1))) - n36*n55/(n42 - 1 + pow(alpha, -n5*(n47*(n71 - log(1 + n46*(n10 + n14*xTj)/n28)) + 1)))))*(4.0*n1*n147*n36*n53 - 4.0*n111*n131*n36*xF[0] + 2.0*n117 - 2.0*n153*n36*xF[0] - 2.0*n178*xTj);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n47*(n71 - log(-pow(alpha, NP1*n0)*n62 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[2] - Mstar;
-      g5 = MW[3] - Mstar;
-      g6 = MW[4] - Mstar;
-      g7 = MW[5] - Mstar;
-      g8 = xF[0] - xTj;
-      g9 = xF[0] - xPj;
-      g10 = -xTj;
-      g11 = xPj/xF[1];
-      g12 = pow(alpha, -g1);
-      g13 = pow(alpha, -g0);
-      g14 = pow(alpha, -g4);
-      g15 = pow(alpha, -g5);
-      g16 = pow(alpha, -g6);
-      g17 = pow(alpha, -g7);
-      g18 = log(xF[0]/xF[1]);
-      g19 = -g2;
-      g20 = pow(alpha, NP1*g0);
-      g21 = pow(alpha, NP1*g1);
-      g22 = log(g12);
-      g23 = pow(alpha, NP1*g4);
-      g24 = pow(alpha, NP1*g5);
-      g25 = pow(alpha, NP1*g6);
-      g26 = pow(alpha, NP1*g7);
-      g27 = -g18;
-      g28 = g3/g8;
-      g29 = g8/g3;
-      g30 = -g20 + 1;
-      g31 = -g20 + 1;
-      g32 = -g21 + 1;
-      g33 = -g23 + 1;
-      g34 = -g24 + 1;
-      g35 = -g25 + 1;
-      g36 = -g26 + 1;
-      g37 = -g21;
-      g38 = -g23;
-      g39 = -g24;
-      g40 = -g25;
-      g41 = -g26;
-      g42 = -1.0*g18;
-      g43 = -g3/g9;
-      g44 = pow(alpha, g0*g19) - 1;
-      g45 = pow(alpha, g0*g19) - 1;
-      g46 = pow(alpha, g1*g19) - 1;
-      g47 = pow(alpha, g19*g4) - 1;
-      g48 = pow(alpha, g19*g5) - 1;
-      g49 = pow(alpha, g19*g6) - 1;
-      g50 = pow(alpha, g19*g7) - 1;
-      g51 = -pow(alpha, g1*g19);
-      g52 = -pow(alpha, g19*g4);
-      g53 = -pow(alpha, g19*g5);
-      g54 = -pow(alpha, g19*g6);
-      g55 = -pow(alpha, g19*g7);
-      g56 = g10*g9/(g3*xF[1]);
-      g57 = g31 + g45;
-      g58 = -g21 - g51;
-      g59 = -g23 - g52;
-      g60 = -g24 - g53;
-      g61 = -g25 - g54;
-      g62 = -g26 - g55;
-      g63 = pow(alpha, g1*g19) + g37;
-      g64 = g31 + g45;
-      g65 = pow(alpha, g19*g4) + g38;
-      g66 = pow(alpha, g19*g5) + g39;
-      g67 = pow(alpha, g19*g6) + g40;
-      g68 = pow(alpha, g19*g7) + g41;
-      g69 = xF[5]/g68;
-      g70 = xF[4]/g67;
-      g71 = xF[3]/g66;
-      g72 = xF[1]/g64;
-      g73 = xF[2]/g65;
-      g74 = xF[0]/g63;
-      g75 = xF[1]/g57;
-      g76 = xF[3]/g60;
-      g77 = xF[0]/g58;
-      g78 = xF[4]/g61;
-      g79 = xF[5]/g62;
-      g80 = xF[2]/g59;
-      g81 = g35/g61;
-      g82 = g32/g58;
-      g83 = g34/g60;
-      g84 = g36/g62;
-      g85 = g30/g57;
-      g86 = g33/g59;
-      g87 = g44/g57;
-      g88 = g47/g59;
-      g89 = g48/g60;
-      g90 = g50/g62;
-      g91 = g46/g58;
-      g92 = g49/g61;
-      g93 = log(g56*g64/g31);
-      g94 = log(g56*g57/g30);
-      g95 = log(g11*g29*g64/g45);
-      g96 = 1.0*g93;
-      g97 = log(g11*g29*g57/g44);
-      g98 = 1.0*g95;
-      g99 = -g31*g72*g96 - g42*xF[0] - g42*xF[1] - g42*xF[2] - g42*xF[3] - g42*xF[4] - g42*xF[5] - g45*g72*g98 - g69*g96*(g41 + 1) - g69*g98*(pow(alpha, g19*g7) - 1) - g70*g96*(g40 + 1) - g70*g98*(pow(alpha, g19*g6) - 1) - g71*g96*(g39 + 1) - g71*g98*(pow(alpha, g19*g5) - 1) - g73*g96*(g38 + 1) - g73*g98*(pow(alpha, g19*g4) - 1) - g74*g96*(g37 + 1) - g74*g98*(pow(alpha, g1*g19) - 1);
-      LpF = xF[0]*(g12 + 1.0)*(g27 + g82*g94 + g91*g97)/(g22*(g12 - 1.0)) + xF[1]*(g13 + 1.0)*(g27 + g85*g94 + g87*g97)/(g22*(g13 - 1.0)) + xF[2]*(g14 + 1.0)*(g27 + g86*g94 + g88*g97)/(g22*(g14 - 1.0)) + xF[3]*(g15 + 1.0)*(g27 + g83*g94 + g89*g97)/(g22*(g15 - 1.0)) + xF[4]*(g16 + 1.0)*(g27 + g81*g94 + g92*g97)/(g22*(g16 - 1.0)) + xF[5]*(g17 + 1.0)*(g27 + g84*g94 + g90*g97)/(g22*(g17 - 1.0));
-      PpF = g29;
-      TpF = -g9/g3;
-      SWUpF = g99;
-      SWUpP = g28*g99;
-      xP[0] = g28*g46*g77;
-      xP[1] = g28*g44*g75;
-      xP[2] = g28*g47*g80;
-      xP[3] = g28*g48*g76;
-      xP[4] = g28*g49*g78;
-      xP[5] = g28*g50*g79;
-      xT[0] = g32*g43*g77;
-      xT[1] = g30*g43*g75;
-      xT[2] = g33*g43*g80;
-      xT[3] = g34*g43*g76;
-      xT[4] = g35*g43*g78;
-      xT[5] = g36*g43*g79;
-      break;
-    case 7:
-      n0 = MW[0] - Mstar;
-      n1 = log(alpha);
-      n2 = xPj - xTj;
-      n3 = xF[0] - xPj;
-      n4 = MW[1] - Mstar;
-      n5 = MW[2] - Mstar;
-      n6 = MW[3] - Mstar;
-      n7 = MW[4] - Mstar;
-      n8 = MW[5] - Mstar;
-      n9 = MW[6] - Mstar;
-      n10 = log(xTj);
-      n11 = -2;
-      n12 = xF[0]*xPj;
-      n13 = -Mstar;
-      n14 = -NP0*n11;
-      n15 = -xPj;
-      n16 = -xF[0];
-      n17 = pow(n0, -n11);
-      n18 = pow(n1, -n11);
-      n19 = pow(n4, -n11);
-      n20 = pow(n5, -n11);
-      n21 = pow(n6, -n11);
-      n22 = pow(n7, -n11);
-      n23 = pow(n8, -n11);
-      n24 = pow(n9, -n11);
-      n25 = Mstar*n1;
-      n26 = -n1*n11;
-      n27 = -0.5*xTj;
-      n28 = pow(alpha, NP0*n0);
-      n29 = n12 + n16*xTj;
-      n30 = n12 + n15*xTj;
-      n31 = pow(alpha, NP0*n4);
-      n32 = pow(alpha, NP0*n5);
-      n33 = pow(alpha, NP0*n6);
-      n34 = pow(alpha, NP0*n7);
-      n35 = pow(alpha, NP0*n8);
-      n36 = pow(alpha, NP0*n9);
-      n37 = -MW[0]*n1;
-      n38 = n2/n3;
-      n39 = -n28 + 1;
-      n40 = -n31 + 1;
-      n41 = pow(alpha, n0*n14);
-      n42 = pow(n29, -n11);
-      n43 = pow(n30, -n11);
-      n44 = -n32 + 1;
-      n45 = -n33 + 1;
-      n46 = -n34 + 1;
-      n47 = -n35 + 1;
-      n48 = -n36 + 1;
-      n49 = -n48;
-      n50 = -n44;
-      n51 = -n28;
-      n52 = 1/(n0*n1);
-      n53 = n0*n18;
-      n54 = n32*n5;
-      n55 = n35*n8;
-      n56 = n36*n9;
-      n57 = n33*n6;
-      n58 = n34*n7;
-      n59 = n31*n4;
-      n60 = n0*n28;
-      n61 = n17*n18;
-      n62 = log((-1.0 + xPj/xF[0])/n2);
-      n63 = -n47*xF[5];
-      n64 = -n40*xF[1];
-      n65 = -n46*xF[4];
-      n66 = n30/n29;
-      n67 = n18*n20*n32;
-      n68 = n18*n22*n34;
-      n69 = n28*n61;
-      n70 = n18*n21*n33;
-      n71 = n18*n24*n36;
-      n72 = n38*n63;
-      n73 = n51*n66 + 1;
-      n74 = pow(n73, -n11);
-      n75 = n10 + n25 + n37 + n62;
-      n76 = n28*n66/n73;
-      n77 = n18*n41*n43/(n42*n74);
-      n78 = n52*(n75 - log(n73)) + 1;
-      n79 = pow(alpha, n0*n78);
-      n80 = pow(alpha, n4*n78);
-      n81 = pow(alpha, n5*n78);
-      n82 = pow(alpha, n6*n78);
-      n83 = pow(alpha, n7*n78);
-      n84 = pow(alpha, n78*n8);
-      n85 = pow(alpha, n78*n9);
-      n86 = n4/n80;
-      n87 = n7/n83;
-      n88 = n6/n82;
-      n89 = n9/n85;
-      n90 = n8/n84;
-      n91 = n5/n81;
-      n92 = n39 - 1 + 1.0/n79;
-      n93 = n40 - 1 + 1.0/n80;
-      n94 = n44 - 1 + 1.0/n81;
-      n95 = n45 - 1 + 1.0/n82;
-      n96 = n46 - 1 + 1.0/n83;
-      n97 = n47 - 1 + 1.0/n84;
-      n98 = n48 - 1 + 1.0/n85;
-      n99 = pow(n92, -n11);
-      n100 = pow(n93, -n11);
-      n101 = pow(n94, -n11);
-      n102 = pow(n95, -n11);
-      n103 = pow(n96, -n11);
-      n104 = pow(n97, -n11);
-      n105 = pow(n98, -n11);
-      n106 = pow(n92, 3);
-      n107 = pow(n93, 3);
-      n108 = pow(n94, 3);
-      n109 = pow(n95, 3);
-      n110 = pow(n96, 3);
-      n111 = pow(n97, 3);
-      n112 = pow(n98, 3);
-      n113 = xF[6]/n98;
-      n114 = xF[2]/n94;
-      n115 = xF[4]/n96;
-      n116 = xF[3]/n95;
-      n117 = n1/n92;
-      n118 = xF[6]/n112;
-      n119 = n1*xF[5]/n97;
-      n120 = n1*xF[1]/n93;
-      n121 = n1*n116;
-      n122 = n39/n92;
-      n123 = n39*xF[0]/n106;
-      n124 = n45*xF[3]/n109;
-      n125 = -n45*xF[3]/n102;
-      n126 = n69*xF[0]/n92;
-      n127 = n18*n19*n31*xF[1]/n93;
-      n128 = n18*n23*n35*xF[5]/n97;
-      n129 = n117*n38*n60*xF[0];
-      n130 = n117*n16*n38*n60;
-      n131 = n126*n38;
-      n132 = n127*n38;
-      n133 = n114*n38*n67;
-      n134 = n116*n38*n70;
-      n135 = n115*n38*n68;
-      n136 = n128*n38;
-      n137 = n113*n38*n71;
-      n138 = 0.5*n131;
-      n139 = n66/(n73*n79) + 1;
-      n140 = n1*n60*n66/(n73*n79) + n1*n60;
-      n141 = n1*n59 + n1*n76*n86;
-      n142 = n1*n54 + n1*n76*n91;
-      n143 = n1*n57 + n1*n76*n88;
-      n144 = n1*n58 + n1*n76*n87;
-      n145 = n1*n55 + n1*n76*n90;
-      n146 = n1*n56 + n1*n76*n89;
-      n147 = pow(n140, -n11);
-      n148 = pow(n141, -n11);
-      n149 = pow(n142, -n11);
-      n150 = pow(n143, -n11);
-      n151 = pow(n144, -n11);
-      n152 = pow(n145, -n11);
-      n153 = pow(n146, -n11);
-      n154 = n142*xF[2];
-      n155 = n26*n60*n66/(n73*n79) + n26*n60;
-      n156 = n66*n69/(n73*n79) + n69;
-      n157 = n153*n48;
-      n158 = n144*n65;
-      n159 = n139*n39*xF[0]/n99;
-      n160 = n145/n104;
-      n161 = n141/n100;
-      n162 = n140/n99;
-      n163 = n146*xF[6]/n105;
-      n164 = n162*xF[0];
-      n165 = n149*n44*xF[2]/n108;
-      n166 = n156*n39/n99;
-      n167 = n16*n38*n39*(pow(alpha, NP0*n0 - n0*n78)*n0*n1*n66/n73 + n1*n60)/n99;
-      n168 = n1*n11*n16*n38*n60*(pow(alpha, NP0*n0 - n0*n78)*n0*n1*n66/n73 + n1*n60)/n99;
-      n169 = n26*n38*n59*xF[1]*(pow(alpha, NP0*n0 - n4*n78)*n1*n4*n66/n73 + n1*n59)/n100;
-      n170 = n26*n38*n54*xF[2]*(pow(alpha, NP0*n0 - n5*n78)*n1*n5*n66/n73 + n1*n54)/n101;
-      n171 = n26*n38*n57*xF[3]*(pow(alpha, NP0*n0 - n6*n78)*n1*n6*n66/n73 + n1*n57)/n102;
-      n172 = n26*n38*n58*xF[4]*(pow(alpha, NP0*n0 - n7*n78)*n1*n66*n7/n73 + n1*n58)/n103;
-      n173 = n26*n38*n55*xF[5]*(pow(alpha, NP0*n0 - n78*n8)*n1*n66*n8/n73 + n1*n55)/n104;
-      n174 = n26*n38*n56*xF[6]*(pow(alpha, NP0*n0 - n78*n9)*n1*n66*n9/n73 + n1*n56)/n105;
-      n175 = 1.0*n1*n164*n38*n60;
-      n176 = n16*n38*n39*(pow(alpha, NP0*n0 - n0*n78)*n61*n66/n73 + n69)/n99;
-      n177 = -0.5*n166*n38*xF[0];
-      n178 = n129 + n167;
-      n179 = n18*n19*n31 - n19*n77/n80 + n41*n43*n53*n86/(n42*n74) + n53*n76*n86;
-      n180 = -n20*n77/n81 + n41*n43*n53*n91/(n42*n74) + n53*n76*n91 + n67;
-      n181 = -n22*n77/n83 + n41*n43*n53*n87/(n42*n74) + n53*n76*n87 + n68;
-      n182 = n18*n23*n35 - n23*n77/n84 + n41*n43*n53*n90/(n42*n74) + n53*n76*n90;
-      n183 = -n24*n77/n85 + n41*n43*n53*n89/(n42*n74) + n53*n76*n89 + n71;
-      n184 = n38*n64*(-pow(alpha, n0*n14 - n4*n78)*n18*n19*n43/(n42*n74) + pow(alpha, n0*n14 - n4*n78)*n4*n43*n53/(n42*n74) + n18*n19*n31 + n53*n76*n86)/n100;
-      n185 = n38*n50*xF[2]*(-pow(alpha, n0*n14 - n5*n78)*n18*n20*n43/(n42*n74) + pow(alpha, n0*n14 - n5*n78)*n43*n5*n53/(n42*n74) + n53*n76*n91 + n67)/n101;
-      n186 = n125*n38*(-pow(alpha, n0*n14 - n6*n78)*n18*n21*n43/(n42*n74) + pow(alpha, n0*n14 - n6*n78)*n43*n53*n6/(n42*n74) + n53*n76*n88 + n70);
-      n187 = n38*n65*(-pow(alpha, n0*n14 - n7*n78)*n18*n22*n43/(n42*n74) + pow(alpha, n0*n14 - n7*n78)*n43*n53*n7/(n42*n74) + n53*n76*n87 + n68)/n103;
-      n188 = n72*(-pow(alpha, n0*n14 - n78*n8)*n18*n23*n43/(n42*n74) + pow(alpha, n0*n14 - n78*n8)*n43*n53*n8/(n42*n74) + n18*n23*n35 + n53*n76*n90)/n104;
-      n189 = n38*n49*xF[6]*(-pow(alpha, n0*n14 - n78*n9)*n18*n24*n43/(n42*n74) + pow(alpha, n0*n14 - n78*n9)*n43*n53*n9/(n42*n74) + n53*n76*n89 + n71)/n105;
-      n190 = n138 + n175 + n177;
-      n191 = n1*n113*n38*n56 + n1*n114*n38*n54 + n1*n115*n38*n58 + n119*n38*n55 + n120*n38*n59 + n121*n38*n57 + n125*n143*n38 + n160*n72 + n161*n38*n64 + n163*n38*n49 + n178 + n158*n38/n103 + n154*n38*n50/n101;
-      n192 = n191*xTj;
-      n193 = n131 + n132 + n133 + n134 + n135 + n136 + n137 + n168 + n169 + n170 + n171 + n172 + n173 + n174 + n176 + n184 + n185 + n186 + n187 + n188 + n189;
-      n194 = n118*n146*n38*n49*(n26*n56 + n26*n76*n89) - n124*n143*n38*(n26*n57 + n26*n76*n88) + n193 + n145*n72*(n26*n55 + n26*n76*n90)/n111 + n158*n38*(n26*n58 + n26*n76*n87)/n110 + n154*n38*n50*(n26*n54 + n26*n76*n91)/n108 + n141*n38*n64*(n26*n59 + n26*n76*n86)/n107 + n16*n38*n39*(pow(alpha, NP0*n0 - n0*n78)*n0*n1*n66/n73 + n1*n60)*(pow(alpha, NP0*n0 - n0*n78)*n0*n26*n66/n73 + n26*n60)/n106;
-      NP_b = -n1*n159*n38*n60 - n130 - n14*(1.0*n1*n38*n60*xF[0]*(pow(alpha, NP0*n0 - n0*n78)*n0*n1*n66/n73 + n1*n60)/n99 - 1.0*n123*n147*n38 + n138 + n27*(n11*n118*n157*n38 + n11*n123*n147*n38 + n11*n124*n150*n38 + n11*n165*n38 + n11*n152*n38*n47*xF[5]/n111 + n11*n151*n38*n46*xF[4]/n110 + n125*n38*(pow(alpha, NP0*n0 - n6*n78)*n53*n6*n66/n73 - pow(alpha, n0*n14 - n6*n78)*n18*n21*n43/(n42*n74) + pow(alpha, n0*n14 - n6*n78)*n43*n53*n6/(n42*n74) + n70) + n131 + n132 + n133 + n134 + n135 + n136 + n137 + n168 + n169 + n170 + n171 + n172 + n173 + n174 + n176 + n11*n148*n38*n40*xF[1]/n107 + n38*n49*xF[6]*(pow(alpha, NP0*n0 - n78*n9)*n53*n66*n9/n73 - pow(alpha, n0*n14 - n78*n9)*n18*n24*n43/(n42*n74) + pow(alpha, n0*n14 - n78*n9)*n43*n53*n9/(n42*n74) + n71)/n105 + n72*(pow(alpha, NP0*n0 - n78*n8)*n53*n66*n8/n73 - pow(alpha, n0*n14 - n78*n8)*n18*n23*n43/(n42*n74) + pow(alpha, n0*n14 - n78*n8)*n43*n53*n8/(n42*n74) + n18*n23*n35)/n104 + n38*n65*(pow(alpha, NP0*n0 - n7*n78)*n53*n66*n7/n73 - pow(alpha, n0*n14 - n7*n78)*n18*n22*n43/(n42*n74) + pow(alpha, n0*n14 - n7*n78)*n43*n53*n7/(n42*n74) + n68)/n103 + n38*n50*xF[2]*(pow(alpha, NP0*n0 - n5*n78)*n5*n53*n66/n73 - pow(alpha, n0*n14 - n5*n78)*n18*n20*n43/(n42*n74) + pow(alpha, n0*n14 - n5*n78)*n43*n5*n53/(n42*n74) + n67)/n101 + n38*n64*(pow(alpha, NP0*n0 - n4*n78)*n4*n53*n66/n73 - pow(alpha, n0*n14 - n4*n78)*n18*n19*n43/(n42*n74) + pow(alpha, n0*n14 - n4*n78)*n4*n43*n53/(n42*n74) + n18*n19*n31)/n100) - 0.5*n38*n39*xF[0]*(pow(alpha, NP0*n0 - n0*n78)*n61*n66/n73 + n69)/n99) - n38*xTj*(n1*n113*n56 + n1*n114*n54 + n1*n115*n58 + n117*n60*xF[0] + n119*n55 + n120*n59 + n121*n57 + n125*n143 + n16*n39*(pow(alpha, NP0*n0 - n0*n78)*n0*n1*n66/n73 + n1*n60)/n99 + n160*n63 + n161*n64 + n163*n49 + n158/n103 + n154*n50/n101);
-      NP_2a = -n38*(-1.0*n126 - 2.0*n139*n41*n61*xF[0]/n99 + n159*n69 + 1.0*xTj*(n1*n11*n16*n60*(pow(alpha, NP0*n0 - n0*n78)*n0*n1*n66/n73 + n1*n60)/n99 + n11*n118*n157 + n11*n123*n147 + n11*n124*n150 + n11*n165 + n11*n152*n47*xF[5]/n111 + n11*n151*n46*xF[4]/n110 + n113*n71 + n114*n67 + n115*n68 + n116*n70 + n125*(-pow(alpha, n0*n14 - n6*n78)*n18*n21*n43/(n42*n74) + pow(alpha, n0*n14 - n6*n78)*n43*n53*n6/(n42*n74) + n53*n76*n88 + n70) + n126 + n127 + n128 + n16*n39*(pow(alpha, NP0*n0 - n0*n78)*n61*n66/n73 + n69)/n99 + n11*n148*n40*xF[1]/n107 + n26*n56*xF[6]*(pow(alpha, NP0*n0 - n78*n9)*n1*n66*n9/n73 + n1*n56)/n105 + n49*xF[6]*(-pow(alpha, n0*n14 - n78*n9)*n18*n24*n43/(n42*n74) + pow(alpha, n0*n14 - n78*n9)*n43*n53*n9/(n42*n74) + n53*n76*n89 + n71)/n105 + n26*n55*xF[5]*(pow(alpha, NP0*n0 - n78*n8)*n1*n66*n8/n73 + n1*n55)/n104 + n63*(-pow(alpha, n0*n14 - n78*n8)*n18*n23*n43/(n42*n74) + pow(alpha, n0*n14 - n78*n8)*n43*n53*n8/(n42*n74) + n18*n23*n35 + n53*n76*n90)/n104 + n26*n58*xF[4]*(pow(alpha, NP0*n0 - n7*n78)*n1*n66*n7/n73 + n1*n58)/n103 + n65*(-pow(alpha, n0*n14 - n7*n78)*n18*n22*n43/(n42*n74) + pow(alpha, n0*n14 - n7*n78)*n43*n53*n7/(n42*n74) + n53*n76*n87 + n68)/n103 + n26*n57*xF[3]*(pow(alpha, NP0*n0 - n6*n78)*n1*n6*n66/n73 + n1*n57)/n102 + n26*n54*xF[2]*(pow(alpha, NP0*n0 - n5*n78)*n1*n5*n66/n73 + n1*n54)/n101 + n50*xF[2]*(-pow(alpha, n0*n14 - n5*n78)*n18*n20*n43/(n42*n74) + pow(alpha, n0*n14 - n5*n78)*n43*n5*n53/(n42*n74) + n53*n76*n91 + n67)/n101 + n26*n59*xF[1]*(pow(alpha, NP0*n0 - n4*n78)*n1*n4*n66/n73 + n1*n59)/n100 + n64*(-pow(alpha, n0*n14 - n4*n78)*n18*n19*n43/(n42*n74) + pow(alpha, n0*n14 - n4*n78)*n4*n43*n53/(n42*n74) + n18*n19*n31 + n53*n76*n86)/n100) + n11*pow(n139, -n11)*n16*n39*n41*n61/n106);
-      NP_sqrt_base = (NP0*(n178 - n192) + n122*n38*xF[0] + xTj*(n113*n38*n49 + n114*n38*n50 - n116*n38*n45 + n122*n16*n38 + n38*n64/n93 + n38*n65/n96 + n72/n97) + pow(NP0, -n11)*(-1.0*n1*n164*n38*n60 + 0.5*n123*n140*n155*n38 - 0.5*n131 + 0.5*n166*n38*xF[0] + 0.5*n194*xTj))*(4.0*n1*n164*n38*n60 - n11*n176 + n11*n194*xTj - 4.0*n123*n147*n38 + 2.0*n131) + pow(-n130 - n14*(1.0*n1*n38*n60*xF[0]*(pow(alpha, NP0*n0 - n0*n78)*n0*n1*n66/n73 + n1*n60)/n99 - 0.5*n123*n38*(pow(alpha, NP0*n0 - n0*n78)*n0*n1*n66/n73 + n1*n60)*(pow(alpha, NP0*n0 - n0*n78)*n0*n26*n66/n73 + n26*n60) + n138 + n27*(n118*n38*n49*(pow(alpha, NP0*n0 - n78*n9)*n1*n66*n9/n73 + n1*n56)*(pow(alpha, NP0*n0 - n78*n9)*n26*n66*n9/n73 + n26*n56) - n124*n38*(pow(alpha, NP0*n0 - n6*n78)*n1*n6*n66/n73 + n1*n57)*(pow(alpha, NP0*n0 - n6*n78)*n26*n6*n66/n73 + n26*n57) + n125*n38*(pow(alpha, NP0*n0 - n6*n78)*n53*n6*n66/n73 - pow(alpha, n0*n14 - n6*n78)*n18*n21*n43/(n42*n74) + pow(alpha, n0*n14 - n6*n78)*n43*n53*n6/(n42*n74) + n70) + n131 + n132 + n133 + n134 + n135 + n136 + n137 + n168 + n169 + n170 + n171 + n172 + n173 + n174 + n176 + n72*(pow(alpha, NP0*n0 - n78*n8)*n1*n66*n8/n73 + n1*n55)*(pow(alpha, NP0*n0 - n78*n8)*n26*n66*n8/n73 + n26*n55)/n111 + n38*n65*(pow(alpha, NP0*n0 - n7*n78)*n1*n66*n7/n73 + n1*n58)*(pow(alpha, NP0*n0 - n7*n78)*n26*n66*n7/n73 + n26*n58)/n110 + n38*n50*xF[2]*(pow(alpha, NP0*n0 - n5*n78)*n1*n5*n66/n73 + n1*n54)*(pow(alpha, NP0*n0 - n5*n78)*n26*n5*n66/n73 + n26*n54)/n108 + n38*n64*(pow(alpha, NP0*n0 - n4*n78)*n1*n4*n66/n73 + n1*n59)*(pow(alpha, NP0*n0 - n4*n78)*n26*n4*n66/n73 + n26*n59)/n107 + n16*n38*n39*(pow(alpha, NP0*n0 - n0*n78)*n0*n1*n66/n73 + n1*n60)*(pow(alpha, NP0*n0 - n0*n78)*n0*n26*n66/n73 + n26*n60)/n106 + n38*n49*xF[6]*(pow(alpha, NP0*n0 - n78*n9)*n53*n66*n9/n73 - pow(alpha, n0*n14 - n78*n9)*n18*n24*n43/(n42*n74) + pow(alpha, n0*n14 - n78*n9)*n43*n53*n9/(n42*n74) + n71)/n105 + n72*(pow(alpha, NP0*n0 - n78*n8)*n53*n66*n8/n73 - pow(alpha, n0*n14 - n78*n8)*n18*n23*n43/(n42*n74) + pow(alpha, n0*n14 - n78*n8)*n43*n53*n8/(n42*n74) + n18*n23*n35)/n104 + n38*n65*(pow(alpha, NP0*n0 - n7*n78)*n53*n66*n7/n73 - pow(alpha, n0*n14 - n7*n78)*n18*n22*n43/(n42*n74) + pow(alpha, n0*n14 - n7*n78)*n43*n53*n7/(n42*n74) + n68)/n103 + n38*n50*xF[2]*(pow(alpha, NP0*n0 - n5*n78)*n5*n53*n66/n73 - pow(alpha, n0*n14 - n5*n78)*n18*n20*n43/(n42*n74) + pow(alpha, n0*n14 - n5*n78)*n43*n5*n53/(n42*n74) + n67)/n101 + n38*n64*(pow(alpha, NP0*n0 - n4*n78)*n4*n53*n66/n73 - pow(alpha, n0*n14 - n4*n78)*n18*n19*n43/(n42*n74) + pow(alpha, n0*n14 - n4*n78)*n4*n43*n53/(n42*n74) + n18*n19*n31)/n100) - 0.5*n38*n39*xF[0]*(pow(alpha, NP0*n0 - n0*n78)*n61*n66/n73 + n69)/n99) - n164*n38*n39 - n192, -n11);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n52*(n75 - log(-pow(alpha, NP1*n0)*n66 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[2] - Mstar;
-      g5 = MW[3] - Mstar;
-      g6 = MW[4] - Mstar;
-      g7 = MW[5] - Mstar;
-      g8 = MW[6] - Mstar;
-      g9 = xF[0] - xTj;
-      g10 = xF[0] - xPj;
-      g11 = -xTj;
-      g12 = xPj/xF[1];
-      g13 = pow(alpha, -g1);
-      g14 = pow(alpha, -g0);
-      g15 = pow(alpha, -g4);
-      g16 = pow(alpha, -g5);
-      g17 = pow(alpha, -g6);
-      g18 = pow(alpha, -g7);
-      g19 = pow(alpha, -g8);
-      g20 = log(xF[0]/xF[1]);
-      g21 = -g2;
-      g22 = pow(alpha, NP1*g0);
-      g23 = pow(alpha, NP1*g1);
-      g24 = log(g13);
-      g25 = pow(alpha, NP1*g4);
-      g26 = pow(alpha, NP1*g5);
-      g27 = pow(alpha, NP1*g6);
-      g28 = pow(alpha, NP1*g7);
-      g29 = pow(alpha, NP1*g8);
-      g30 = -g20;
-      g31 = g9/g3;
-      g32 = g3/g9;
-      g33 = -g22 + 1;
-      g34 = -g22 + 1;
-      g35 = -g23 + 1;
-      g36 = -g25 + 1;
-      g37 = -g26 + 1;
-      g38 = -g27 + 1;
-      g39 = -g28 + 1;
-      g40 = -g29 + 1;
-      g41 = -g23;
-      g42 = -g25;
-      g43 = -g26;
-      g44 = -g27;
-      g45 = -g28;
-      g46 = -g29;
-      g47 = -1.0*g20;
-      g48 = -g3/g10;
-      g49 = g10/(g3*xF[1]);
-      g50 = pow(alpha, g0*g21) - 1;
-      g51 = pow(alpha, g0*g21) - 1;
-      g52 = pow(alpha, g1*g21) - 1;
-      g53 = pow(alpha, g21*g4) - 1;
-      g54 = pow(alpha, g21*g5) - 1;
-      g55 = pow(alpha, g21*g6) - 1;
-      g56 = pow(alpha, g21*g7) - 1;
-      g57 = pow(alpha, g21*g8) - 1;
-      g58 = -pow(alpha, g1*g21);
-      g59 = -pow(alpha, g21*g4);
-      g60 = -pow(alpha, g21*g5);
-      g61 = -pow(alpha, g21*g6);
-      g62 = -pow(alpha, g21*g7);
-      g63 = -pow(alpha, g21*g8);
-      g64 = g34 + g51;
-      g65 = -g23 - g58;
-      g66 = -g25 - g59;
-      g67 = -g26 - g60;
-      g68 = -g27 - g61;
-      g69 = -g28 - g62;
-      g70 = -g29 - g63;
-      g71 = pow(alpha, g1*g21) + g41;
-      g72 = g34 + g51;
-      g73 = pow(alpha, g21*g4) + g42;
-      g74 = pow(alpha, g21*g5) + g43;
-      g75 = pow(alpha, g21*g6) + g44;
-      g76 = pow(alpha, g21*g7) + g45;
-      g77 = pow(alpha, g21*g8) + g46;
-      g78 = xF[0]/g71;
-      g79 = xF[1]/g72;
-      g80 = xF[2]/g73;
-      g81 = xF[3]/g74;
-      g82 = xF[6]/g77;
-      g83 = xF[4]/g75;
-      g84 = xF[5]/g76;
-      g85 = xF[1]/g64;
-      g86 = xF[0]/g65;
-      g87 = xF[4]/g68;
-      g88 = xF[5]/g69;
-      g89 = xF[2]/g66;
-      g90 = xF[6]/g70;
-      g91 = xF[3]/g67;
-      g92 = g40/g70;
-      g93 = g38/g68;
-      g94 = g35/g65;
-      g95 = g39/g69;
-      g96 = g37/g67;
-      g97 = g33/g64;
-      g98 = g36/g66;
-      g99 = g50/g64;
-      g100 = g52/g65;
-      g101 = g56/g69;
-      g102 = g53/g66;
-      g103 = g54/g67;
-      g104 = g55/g68;
-      g105 = g57/g70;
-      g106 = log(g11*g49*g72/g34);
-      g107 = log(g11*g49*g64/g33);
-      g108 = log(g12*g31*g72/g51);
-      g109 = 1.0*g106;
-      g110 = log(g12*g31*g64/g50);
-      g111 = 1.0*g108;
-      g112 = -g109*g34*g79 - g109*g78*(g41 + 1) - g109*g80*(g42 + 1) - g109*g81*(g43 + 1) - g109*g82*(g46 + 1) - g109*g83*(g44 + 1) - g109*g84*(g45 + 1) - g111*g51*g79 - g111*g78*(pow(alpha, g1*g21) - 1) - g111*g80*(pow(alpha, g21*g4) - 1) - g111*g81*(pow(alpha, g21*g5) - 1) - g111*g82*(pow(alpha, g21*g8) - 1) - g111*g83*(pow(alpha, g21*g6) - 1) - g111*g84*(pow(alpha, g21*g7) - 1) - g47*xF[0] - g47*xF[1] - g47*xF[2] - g47*xF[3] - g47*xF[4] - g47*xF[5] - g47*xF[6];
-      LpF = xF[0]*(g13 + 1.0)*(g100*g110 + g107*g94 + g30)/(g24*(g13 - 1.0)) + xF[1]*(g14 + 1.0)*(g107*g97 + g110*g99 + g30)/(g24*(g14 - 1.0)) + xF[2]*(g15 + 1.0)*(g102*g110 + g107*g98 + g30)/(g24*(g15 - 1.0)) + xF[3]*(g16 + 1.0)*(g103*g110 + g107*g96 + g30)/(g24*(g16 - 1.0)) + xF[4]*(g17 + 1.0)*(g104*g110 + g107*g93 + g30)/(g24*(g17 - 1.0)) + xF[5]*(g18 + 1.0)*(g101*g110 + g107*g95 + g30)/(g24*(g18 - 1.0)) + xF[6]*(g19 + 1.0)*(g105*g110 + g107*g92 + g30)/(g24*(g19 - 1.0));
-      PpF = g31;
-      TpF = -g10/g3;
-      SWUpF = g112;
-      SWUpP = g112*g32;
-      xP[0] = g32*g52*g86;
-      xP[1] = g32*g50*g85;
-      xP[2] = g32*g53*g89;
-      xP[3] = g32*g54*g91;
-      xP[4] = g32*g55*g87;
-      xP[5] = g32*g56*g88;
-      xP[6] = g32*g57*g90;
-      xT[0] = g35*g48*g86;
-      xT[1] = g33*g48*g85;
-      xT[2] = g36*g48*g89;
-      xT[3] = g37*g48*g91;
-      xT[4] = g38*g48*g87;
-      xT[5] = g39*g48*g88;
-      xT[6] = g40*g48*g90;
-      break;
-    case 8:
-      n0 = -0.500000000000000;
-      n1 = -2.00000000000000;
-      n2 = MW[0] - Mstar;
-      n3 = log(alpha);
-      n4 = xPj - xTj;
-      n5 = xF[0] - xPj;
-      n6 = MW[1] - Mstar;
-      n7 = MW[2] - Mstar;
-      n8 = MW[3] - Mstar;
-      n9 = MW[4] - Mstar;
-      n10 = MW[5] - Mstar;
-      n11 = MW[6] - Mstar;
-      n12 = MW[7] - Mstar;
-      n13 = log(xTj);
-      n14 = -2;
-      n15 = xF[0]*xPj;
-      n16 = -Mstar;
-      n17 = -xPj;
-      n18 = -NP0*n1;
-      n19 = -xTj;
-      n20 = pow(n2, -n1);
-      n21 = pow(n3, -n1);
-      n22 = pow(n6, -n1);
-      n23 = pow(n7, -n1);
-      n24 = pow(n8, -n1);
-      n25 = pow(n9, -n1);
-      n26 = pow(n10, -n1);
-      n27 = pow(n11, -n1);
-      n28 = pow(n12, -n1);
-      n29 = Mstar*n3;
-      n30 = -n1*n3;
-      n31 = pow(alpha, NP0*n2);
-      n32 = n15 + n19*xF[0];
-      n33 = n15 + n17*xTj;
-      n34 = pow(alpha, NP0*n6);
-      n35 = pow(alpha, NP0*n7);
-      n36 = pow(alpha, NP0*n8);
-      n37 = pow(alpha, NP0*n9);
-      n38 = pow(alpha, NP0*n10);
-      n39 = pow(alpha, NP0*n11);
-      n40 = pow(alpha, NP0*n12);
-      n41 = -MW[0]*n3;
-      n42 = n4/n5;
-      n43 = -n31 + 1;
-      n44 = -n34 + 1;
-      n45 = pow(alpha, n18*n2);
-      n46 = pow(n33, -n1);
-      n47 = -n35 + 1;
-      n48 = -n36 + 1;
-      n49 = -n37 + 1;
-      n50 = -n38 + 1;
-      n51 = -n39 + 1;
-      n52 = -n40 + 1;
-      n53 = -n31;
-      n54 = -n34;
-      n55 = -n35;
-      n56 = -n36;
-      n57 = -n37;
-      n58 = -n38;
-      n59 = -n39;
-      n60 = -n40;
-      n61 = n2*n21;
-      n62 = 1/(n2*n3);
-      n63 = n47*xF[2];
-      n64 = n35*n7;
-      n65 = n10*n38;
-      n66 = n44*xF[1];
-      n67 = n49*xF[4];
-      n68 = n51*xF[6];
-      n69 = n11*n39;
-      n70 = n36*n8;
-      n71 = n34*n6;
-      n72 = n37*n9;
-      n73 = n12*n40;
-      n74 = n20*n21;
-      n75 = log((-1.0 + xPj/xF[0])/n4);
-      n76 = -n50*xF[5];
-      n77 = n2*n3*n31;
-      n78 = n3*n73;
-      n79 = n33/n32;
-      n80 = n21*n23*n35;
-      n81 = n21*n25*n37;
-      n82 = n21*n26*n38;
-      n83 = n31*n74;
-      n84 = n21*n28*n40;
-      n85 = n21*n24*n36;
-      n86 = n21*n27*n39;
-      n87 = n21*n22*n34;
-      n88 = n53*n79 + 1;
-      n89 = n13 + n29 + n41 + n75;
-      n90 = n31*n79/n88;
-      n91 = n21*pow(n32, n14)*n45*n46*pow(n88, n14);
-      n92 = n62*(n89 - log(n88)) + 1;
-      n93 = pow(alpha, n2*n92);
-      n94 = pow(alpha, n6*n92);
-      n95 = pow(alpha, n7*n92);
-      n96 = pow(alpha, n8*n92);
-      n97 = pow(alpha, n9*n92);
-      n98 = pow(alpha, n10*n92);
-      n99 = pow(alpha, n11*n92);
-      n100 = pow(alpha, n12*n92);
-      n101 = n6/n94;
-      n102 = n9/n97;
-      n103 = n8/n96;
-      n104 = n12/n100;
-      n105 = n11/n99;
-      n106 = n10/n98;
-      n107 = n2/n93;
-      n108 = n7/n95;
-      n109 = n43 - 1 + 1.0/n93;
-      n110 = n44 - 1 + 1.0/n94;
-      n111 = n47 - 1 + 1.0/n95;
-      n112 = n48 - 1 + 1.0/n96;
-      n113 = n49 - 1 + 1.0/n97;
-      n114 = n50 - 1 + 1.0/n98;
-      n115 = n51 - 1 + 1.0/n99;
-      n116 = n52 - 1 + 1.0/n100;
-      n117 = pow(n109, 3);
-      n118 = pow(n110, 3);
-      n119 = pow(n111, 3);
-      n120 = pow(n112, 3);
-      n121 = pow(n113, 3);
-      n122 = pow(n114, 3);
-      n123 = pow(n115, 3);
-      n124 = pow(n116, 3);
-      n125 = xF[6]/n115;
-      n126 = xF[7]/n116;
-      n127 = xF[1]/n110;
-      n128 = xF[2]/n111;
-      n129 = xF[0]/n109;
-      n130 = xF[5]/n114;
-      n131 = xF[4]/n113;
-      n132 = xF[3]/n112;
-      n133 = pow(n109, n14)*xF[0];
-      n134 = n130*n3;
-      n135 = -pow(n110, n14);
-      n136 = n132*n3;
-      n137 = n43*xF[0]/n117;
-      n138 = n52*xF[7]/n124;
-      n139 = pow(n116, n14)*n52*xF[7];
-      n140 = -pow(n112, n14)*n48*xF[3];
-      n141 = n129*n83;
-      n142 = n129*n2*n3*n42*n53;
-      n143 = n141*n42;
-      n144 = n127*n42*n87;
-      n145 = n128*n42*n80;
-      n146 = n132*n42*n85;
-      n147 = n131*n42*n81;
-      n148 = n130*n42*n82;
-      n149 = n125*n42*n86;
-      n150 = n126*n42*n84;
-      n151 = n0*n129*n42*n53*n74;
-      n152 = n79/(n88*n93) + 1;
-      n153 = n152*n43;
-      n154 = n77*n79/(n88*n93) + n77;
-      n155 = n101*n3*n90 + n3*n71;
-      n156 = n108*n3*n90 + n3*n64;
-      n157 = n103*n3*n90 + n3*n70;
-      n158 = n102*n3*n90 + n3*n72;
-      n159 = n106*n3*n90 + n3*n65;
-      n160 = n105*n3*n90 + n3*n69;
-      n161 = n104*n3*n90 + n78;
-      n162 = pow(n154, -n1);
-      n163 = pow(n155, -n1);
-      n164 = pow(n156, -n1);
-      n165 = pow(n157, -n1);
-      n166 = pow(n158, -n1);
-      n167 = pow(n159, -n1);
-      n168 = pow(n160, -n1);
-      n169 = pow(n161, -n1);
-      n170 = n157*xF[3];
-      n171 = n107*n30*n90 + n2*n30*n31;
-      n172 = n79*n83/(n88*n93) + n83;
-      n173 = -n158*n67;
-      n174 = n172*n43;
-      n175 = pow(n114, n14)*n159;
-      n176 = pow(n111, n14)*n156;
-      n177 = pow(n115, n14)*n160;
-      n178 = n166/n121;
-      n179 = n168/n123;
-      n180 = pow(n113, n14)*n158*xF[4];
-      n181 = n164/n119;
-      n182 = pow(n110, n14)*n155*xF[1];
-      n183 = n163/n118;
-      n184 = pow(n116, n14)*n161*xF[7];
-      n185 = n165*n48*xF[3]/n120;
-      n186 = n133*n154*n42*n43;
-      n187 = n133*n2*n30*n31*n42*(pow(alpha, NP0*n2 - n2*n92)*n2*n3*n79/n88 + n77);
-      n188 = pow(n110, n14)*n30*n42*n71*xF[1]*(pow(alpha, NP0*n2 - n6*n92)*n3*n6*n79/n88 + n3*n71);
-      n189 = pow(n111, n14)*n30*n42*n64*xF[2]*(pow(alpha, NP0*n2 - n7*n92)*n3*n7*n79/n88 + n3*n64);
-      n190 = pow(n112, n14)*n30*n42*n70*xF[3]*(pow(alpha, NP0*n2 - n8*n92)*n3*n79*n8/n88 + n3*n70);
-      n191 = pow(n113, n14)*n30*n42*n72*xF[4]*(pow(alpha, NP0*n2 - n9*n92)*n3*n79*n9/n88 + n3*n72);
-      n192 = pow(n114, n14)*n30*n42*n65*xF[5]*(pow(alpha, NP0*n2 - n10*n92)*n10*n3*n79/n88 + n3*n65);
-      n193 = pow(n115, n14)*n30*n42*n69*xF[6]*(pow(alpha, NP0*n2 - n11*n92)*n11*n3*n79/n88 + n3*n69);
-      n194 = pow(n116, n14)*n30*n42*n73*xF[7]*(pow(alpha, NP0*n2 - n12*n92)*n12*n3*n79/n88 + n78);
-      n195 = 1.0*n133*n154*n42*n77;
-      n196 = -n133*n174*n42;
-      n197 = n0*n133*n174*n42;
-      n198 = n154*n171;
-      n199 = n108*pow(n32, n14)*n45*n46*n61*pow(n88, n14) + n108*n61*n90 - n23*n91/n95 + n80;
-      n200 = n102*pow(n32, n14)*n45*n46*n61*pow(n88, n14) + n102*n61*n90 - n25*n91/n97 + n81;
-      n201 = n106*pow(n32, n14)*n45*n46*n61*pow(n88, n14) + n106*n61*n90 - n26*n91/n98 + n82;
-      n202 = n105*pow(n32, n14)*n45*n46*n61*pow(n88, n14) + n105*n61*n90 - n27*n91/n99 + n86;
-      n203 = n135*n42*n66*(-pow(alpha, n18*n2 - n6*n92)*n21*n22*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n6*n92)*pow(n32, n14)*n46*n6*n61*pow(n88, n14) + n101*n61*n90 + n87);
-      n204 = -pow(n111, n14)*n42*n63*(-pow(alpha, n18*n2 - n7*n92)*n21*n23*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n7*n92)*pow(n32, n14)*n46*n61*n7*pow(n88, n14) + n108*n61*n90 + n80);
-      n205 = n140*n42*(-pow(alpha, n18*n2 - n8*n92)*n21*n24*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n8*n92)*pow(n32, n14)*n46*n61*n8*pow(n88, n14) + n103*n61*n90 + n85);
-      n206 = -pow(n113, n14)*n42*n67*(-pow(alpha, n18*n2 - n9*n92)*n21*n25*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n9*n92)*pow(n32, n14)*n46*n61*pow(n88, n14)*n9 + n102*n61*n90 + n81);
-      n207 = pow(n114, n14)*n42*n76*(pow(alpha, -n10*n92 + n18*n2)*n10*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n10*n92 + n18*n2)*n21*n26*pow(n32, n14)*n46*pow(n88, n14) + n106*n61*n90 + n82);
-      n208 = -pow(n115, n14)*n42*n68*(pow(alpha, -n11*n92 + n18*n2)*n11*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n11*n92 + n18*n2)*n21*n27*pow(n32, n14)*n46*pow(n88, n14) + n105*n61*n90 + n86);
-      n209 = -n139*n42*(pow(alpha, -n12*n92 + n18*n2)*n12*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n12*n92 + n18*n2)*n21*n28*pow(n32, n14)*n46*pow(n88, n14) + n104*n61*n90 + n84);
-      n210 = n151 + n195 + n197;
-      n211 = xTj*(pow(n113, n14)*n173*n42 + n125*n3*n42*n69 + n126*n42*n78 + n127*n3*n42*n71 + n128*n3*n42*n64 + n129*n42*n77 + n131*n3*n42*n72 + n134*n42*n65 + n135*n155*n42*n66 + n136*n42*n70 - n139*n161*n42 + n140*n157*n42 + n175*n42*n76 - n176*n42*n63 - n177*n42*n68 - n186);
-      n212 = n142 + n186 + n211;
-      n213 = n143 + n144 + n145 + n146 + n147 + n148 + n149 + n150 + n187 + n188 + n189 + n190 + n191 + n192 + n193 + n194 + n196 + n203 + n204 + n205 + n206 + n207 + n208 + n209;
-      NP_b = -n133*n153*n42*n77 - n142 - n18*(n0*n133*n42*n43*(pow(alpha, NP0*n2 - n2*n92)*n74*n79/n88 + n83) + n0*xTj*(-pow(n111, n14)*n42*n63*(pow(alpha, NP0*n2 - n7*n92)*n61*n7*n79/n88 - pow(alpha, n18*n2 - n7*n92)*n21*n23*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n7*n92)*pow(n32, n14)*n46*n61*n7*pow(n88, n14) + n80) - pow(n113, n14)*n42*n67*(pow(alpha, NP0*n2 - n9*n92)*n61*n79*n9/n88 - pow(alpha, n18*n2 - n9*n92)*n21*n25*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n9*n92)*pow(n32, n14)*n46*n61*pow(n88, n14)*n9 + n81) + pow(n114, n14)*n42*n76*(pow(alpha, NP0*n2 - n10*n92)*n10*n61*n79/n88 + pow(alpha, -n10*n92 + n18*n2)*n10*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n10*n92 + n18*n2)*n21*n26*pow(n32, n14)*n46*pow(n88, n14) + n82) - pow(n115, n14)*n42*n68*(pow(alpha, NP0*n2 - n11*n92)*n11*n61*n79/n88 + pow(alpha, -n11*n92 + n18*n2)*n11*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n11*n92 + n18*n2)*n21*n27*pow(n32, n14)*n46*pow(n88, n14) + n86) - n133*n42*n43*(pow(alpha, NP0*n2 - n2*n92)*n74*n79/n88 + n83) + n135*n42*n66*(pow(alpha, NP0*n2 - n6*n92)*n6*n61*n79/n88 - pow(alpha, n18*n2 - n6*n92)*n21*n22*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n6*n92)*pow(n32, n14)*n46*n6*n61*pow(n88, n14) + n87) + n137*n14*n162*n42 + n138*n14*n169*n42 - n139*n42*(pow(alpha, NP0*n2 - n12*n92)*n12*n61*n79/n88 + pow(alpha, -n12*n92 + n18*n2)*n12*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n12*n92 + n18*n2)*n21*n28*pow(n32, n14)*n46*pow(n88, n14) + n84) + n14*n178*n42*n67 + n14*n179*n42*n68 + n14*n181*n42*n63 + n14*n183*n42*n66 + n14*n185*n42 + n140*n42*(pow(alpha, NP0*n2 - n8*n92)*n61*n79*n8/n88 - pow(alpha, n18*n2 - n8*n92)*n21*n24*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n8*n92)*pow(n32, n14)*n46*n61*n8*pow(n88, n14) + n85) + n143 + n144 + n145 + n146 + n147 + n148 + n149 + n150 + n187 + n188 + n189 + n190 + n191 + n192 + n193 + n194 + n14*n167*n42*n50*xF[5]/n122) + 1.0*n133*n42*n77*(pow(alpha, NP0*n2 - n2*n92)*n2*n3*n79/n88 + n77) - 1.0*n137*n162*n42 + n151) - n42*xTj*(pow(n113, n14)*n173 + n125*n3*n69 + n126*n78 + n127*n3*n71 + n128*n3*n64 + n129*n77 + n131*n3*n72 - n133*n154*n43 + n134*n65 + n135*n155*n66 + n136*n70 - n139*n161 + n140*n157 + n175*n76 - n176*n63 - n177*n68);
-      NP_2a = -n42*(n1*n133*n152*n45*n74 - n1*n137*pow(n152, -n1)*n45*n74 + n133*n153*n83 - 1.0*n141 + 1.0*xTj*(pow(n110, n14)*n30*n71*xF[1]*(pow(alpha, NP0*n2 - n6*n92)*n3*n6*n79/n88 + n3*n71) + pow(n111, n14)*n30*n64*xF[2]*(pow(alpha, NP0*n2 - n7*n92)*n3*n7*n79/n88 + n3*n64) - pow(n111, n14)*n63*(-pow(alpha, n18*n2 - n7*n92)*n21*n23*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n7*n92)*pow(n32, n14)*n46*n61*n7*pow(n88, n14) + n108*n61*n90 + n80) + pow(n112, n14)*n30*n70*xF[3]*(pow(alpha, NP0*n2 - n8*n92)*n3*n79*n8/n88 + n3*n70) + pow(n113, n14)*n30*n72*xF[4]*(pow(alpha, NP0*n2 - n9*n92)*n3*n79*n9/n88 + n3*n72) - pow(n113, n14)*n67*(-pow(alpha, n18*n2 - n9*n92)*n21*n25*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n9*n92)*pow(n32, n14)*n46*n61*pow(n88, n14)*n9 + n102*n61*n90 + n81) + pow(n114, n14)*n30*n65*xF[5]*(pow(alpha, NP0*n2 - n10*n92)*n10*n3*n79/n88 + n3*n65) + pow(n114, n14)*n76*(pow(alpha, -n10*n92 + n18*n2)*n10*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n10*n92 + n18*n2)*n21*n26*pow(n32, n14)*n46*pow(n88, n14) + n106*n61*n90 + n82) + pow(n115, n14)*n30*n69*xF[6]*(pow(alpha, NP0*n2 - n11*n92)*n11*n3*n79/n88 + n3*n69) - pow(n115, n14)*n68*(pow(alpha, -n11*n92 + n18*n2)*n11*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n11*n92 + n18*n2)*n21*n27*pow(n32, n14)*n46*pow(n88, n14) + n105*n61*n90 + n86) + pow(n116, n14)*n30*n73*xF[7]*(pow(alpha, NP0*n2 - n12*n92)*n12*n3*n79/n88 + n78) + n125*n86 + n126*n84 + n127*n87 + n128*n80 + n130*n82 + n131*n81 + n132*n85 - n133*n174 + n133*n2*n30*n31*(pow(alpha, NP0*n2 - n2*n92)*n2*n3*n79/n88 + n77) + n135*n66*(-pow(alpha, n18*n2 - n6*n92)*n21*n22*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n6*n92)*pow(n32, n14)*n46*n6*n61*pow(n88, n14) + n101*n61*n90 + n87) + n137*n14*n162 + n138*n14*n169 - n139*(pow(alpha, -n12*n92 + n18*n2)*n12*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n12*n92 + n18*n2)*n21*n28*pow(n32, n14)*n46*pow(n88, n14) + n104*n61*n90 + n84) + n14*n178*n67 + n14*n179*n68 + n14*n181*n63 + n14*n183*n66 + n14*n185 + n140*(-pow(alpha, n18*n2 - n8*n92)*n21*n24*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n8*n92)*pow(n32, n14)*n46*n61*n8*pow(n88, n14) + n103*n61*n90 + n85) + n141 + n14*n167*n50*xF[5]/n122));
-      NP_sqrt_base = (-NP0*n212 - n19*(-n42*n43*xF[0]/(n43 - 1 + pow(alpha, -n2*(n62*(n89 - log(n33*n53/(n15 - xF[0]*xTj) + 1)) + 1))) - n42*n48*xF[3]/(n48 - 1 + pow(alpha, -n8*(n62*(n89 - log(n33*n53/(n15 - xF[0]*xTj) + 1)) + 1))) - n42*n50*xF[5]/(n50 - 1 + pow(alpha, -n10*(n62*(n89 - log(n33*n53/(n15 - xF[0]*xTj) + 1)) + 1))) - n42*n52*xF[7]/(n52 - 1 + pow(alpha, -n12*(n62*(n89 - log(n33*n53/(n15 - xF[0]*xTj) + 1)) + 1))) - n42*n63/(n47 - 1 + pow(alpha, -n7*(n62*(n89 - log(n33*n53/(n15 - xF[0]*xTj) + 1)) + 1))) - n42*n66/(n44 - 1 + pow(alpha, -n6*(n62*(n89 - log(n33*n53/(n15 - xF[0]*xTj) + 1)) + 1))) - n42*n67/(n49 - 1 + pow(alpha, -n9*(n62*(n89 - log(n33*n53/(n15 - xF[0]*xTj) + 1)) + 1))) - n42*n68/(n51 - 1 + pow(alpha, -n11*(n62*(n89 - log(n33*n53/(n15 - xF[0]*xTj) + 1)) + 1)))) + n42*n43*xF[0]/n109 - pow(NP0, -n1)*(n0*n137*n198*n42 - n0*n143 - n0*n19*(-pow(n111, n14)*n42*n63*(pow(alpha, NP0*n2 - n7*n92)*n61*n7*n79/n88 - pow(alpha, n18*n2 - n7*n92)*n21*n23*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n7*n92)*pow(n32, n14)*n46*n61*n7*pow(n88, n14) + n80) - pow(n113, n14)*n42*n67*(pow(alpha, NP0*n2 - n9*n92)*n61*n79*n9/n88 - pow(alpha, n18*n2 - n9*n92)*n21*n25*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n9*n92)*pow(n32, n14)*n46*n61*pow(n88, n14)*n9 + n81) + pow(n114, n14)*n42*n76*(pow(alpha, NP0*n2 - n10*n92)*n10*n61*n79/n88 + pow(alpha, -n10*n92 + n18*n2)*n10*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n10*n92 + n18*n2)*n21*n26*pow(n32, n14)*n46*pow(n88, n14) + n82) - pow(n115, n14)*n42*n68*(pow(alpha, NP0*n2 - n11*n92)*n11*n61*n79/n88 + pow(alpha, -n11*n92 + n18*n2)*n11*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n11*n92 + n18*n2)*n21*n27*pow(n32, n14)*n46*pow(n88, n14) + n86) - n133*n42*n43*(pow(alpha, NP0*n2 - n2*n92)*n74*n79/n88 + n83) + n135*n42*n66*(pow(alpha, NP0*n2 - n6*n92)*n6*n61*n79/n88 - pow(alpha, n18*n2 - n6*n92)*n21*n22*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n6*n92)*pow(n32, n14)*n46*n6*n61*pow(n88, n14) + n87) - n137*n42*(pow(alpha, NP0*n2 - n2*n92)*n2*n3*n79/n88 + n77)*(pow(alpha, NP0*n2 - n2*n92)*n2*n30*n79/n88 + n2*n30*n31) - n138*n42*(pow(alpha, NP0*n2 - n12*n92)*n12*n3*n79/n88 + n78)*(pow(alpha, NP0*n2 - n12*n92)*n12*n30*n79/n88 + n30*n73) - n139*n42*(pow(alpha, NP0*n2 - n12*n92)*n12*n61*n79/n88 + pow(alpha, -n12*n92 + n18*n2)*n12*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n12*n92 + n18*n2)*n21*n28*pow(n32, n14)*n46*pow(n88, n14) + n84) + n140*n42*(pow(alpha, NP0*n2 - n8*n92)*n61*n79*n8/n88 - pow(alpha, n18*n2 - n8*n92)*n21*n24*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n8*n92)*pow(n32, n14)*n46*n61*n8*pow(n88, n14) + n85) + n143 + n144 + n145 + n146 + n147 + n148 + n149 + n150 + n187 + n188 + n189 + n190 + n191 + n192 + n193 + n194 - n42*n68*(pow(alpha, NP0*n2 - n11*n92)*n11*n3*n79/n88 + n3*n69)*(pow(alpha, NP0*n2 - n11*n92)*n11*n30*n79/n88 + n30*n69)/n123 + n42*n76*(pow(alpha, NP0*n2 - n10*n92)*n10*n3*n79/n88 + n3*n65)*(pow(alpha, NP0*n2 - n10*n92)*n10*n30*n79/n88 + n30*n65)/n122 - n42*n67*(pow(alpha, NP0*n2 - n9*n92)*n3*n79*n9/n88 + n3*n72)*(pow(alpha, NP0*n2 - n9*n92)*n30*n79*n9/n88 + n30*n72)/n121 - n42*n48*xF[3]*(pow(alpha, NP0*n2 - n8*n92)*n3*n79*n8/n88 + n3*n70)*(pow(alpha, NP0*n2 - n8*n92)*n30*n79*n8/n88 + n30*n70)/n120 - n42*n63*(pow(alpha, NP0*n2 - n7*n92)*n3*n7*n79/n88 + n3*n64)*(pow(alpha, NP0*n2 - n7*n92)*n30*n7*n79/n88 + n30*n64)/n119 - n42*n66*(pow(alpha, NP0*n2 - n6*n92)*n3*n6*n79/n88 + n3*n71)*(pow(alpha, NP0*n2 - n6*n92)*n30*n6*n79/n88 + n30*n71)/n118) - n0*n196 + 1.0*n133*n154*n42*n77))*(-n1*n143 - n1*n19*(-pow(n111, n14)*n42*n63*(pow(alpha, NP0*n2 - n7*n92)*n61*n7*n79/n88 - pow(alpha, n18*n2 - n7*n92)*n21*n23*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n7*n92)*pow(n32, n14)*n46*n61*n7*pow(n88, n14) + n80) - pow(n113, n14)*n42*n67*(pow(alpha, NP0*n2 - n9*n92)*n61*n79*n9/n88 - pow(alpha, n18*n2 - n9*n92)*n21*n25*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n9*n92)*pow(n32, n14)*n46*n61*pow(n88, n14)*n9 + n81) + pow(n114, n14)*n42*n76*(pow(alpha, NP0*n2 - n10*n92)*n10*n61*n79/n88 + pow(alpha, -n10*n92 + n18*n2)*n10*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n10*n92 + n18*n2)*n21*n26*pow(n32, n14)*n46*pow(n88, n14) + n82) - pow(n115, n14)*n42*n68*(pow(alpha, NP0*n2 - n11*n92)*n11*n61*n79/n88 + pow(alpha, -n11*n92 + n18*n2)*n11*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n11*n92 + n18*n2)*n21*n27*pow(n32, n14)*n46*pow(n88, n14) + n86) - n133*n42*n43*(pow(alpha, NP0*n2 - n2*n92)*n74*n79/n88 + n83) + n135*n42*n66*(pow(alpha, NP0*n2 - n6*n92)*n6*n61*n79/n88 - pow(alpha, n18*n2 - n6*n92)*n21*n22*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n6*n92)*pow(n32, n14)*n46*n6*n61*pow(n88, n14) + n87) - n137*n42*(pow(alpha, NP0*n2 - n2*n92)*n2*n3*n79/n88 + n77)*(pow(alpha, NP0*n2 - n2*n92)*n2*n30*n79/n88 + n2*n30*n31) - n138*n42*(pow(alpha, NP0*n2 - n12*n92)*n12*n3*n79/n88 + n78)*(pow(alpha, NP0*n2 - n12*n92)*n12*n30*n79/n88 + n30*n73) - n139*n42*(pow(alpha, NP0*n2 - n12*n92)*n12*n61*n79/n88 + pow(alpha, -n12*n92 + n18*n2)*n12*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n12*n92 + n18*n2)*n21*n28*pow(n32, n14)*n46*pow(n88, n14) + n84) + n140*n42*(pow(alpha, NP0*n2 - n8*n92)*n61*n79*n8/n88 - pow(alpha, n18*n2 - n8*n92)*n21*n24*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n8*n92)*pow(n32, n14)*n46*n61*n8*pow(n88, n14) + n85) + n143 + n144 + n145 + n146 + n147 + n148 + n149 + n150 + n187 + n188 + n189 + n190 + n191 + n192 + n193 + n194 - n42*n68*(pow(alpha, NP0*n2 - n11*n92)*n11*n3*n79/n88 + n3*n69)*(pow(alpha, NP0*n2 - n11*n92)*n11*n30*n79/n88 + n30*n69)/n123 + n42*n76*(pow(alpha, NP0*n2 - n10*n92)*n10*n3*n79/n88 + n3*n65)*(pow(alpha, NP0*n2 - n10*n92)*n10*n30*n79/n88 + n30*n65)/n122 - n42*n67*(pow(alpha, NP0*n2 - n9*n92)*n3*n79*n9/n88 + n3*n72)*(pow(alpha, NP0*n2 - n9*n92)*n30*n79*n9/n88 + n30*n72)/n121 - n42*n48*xF[3]*(pow(alpha, NP0*n2 - n8*n92)*n3*n79*n8/n88 + n3*n70)*(pow(alpha, NP0*n2 - n8*n92)*n30*n79*n8/n88 + n30*n70)/n120 - n42*n63*(pow(alpha, NP0*n2 - n7*n92)*n3*n7*n79/n88 + n3*n64)*(pow(alpha, NP0*n2 - n7*n92)*n30*n7*n79/n88 + n30*n64)/n119 - n42*n66*(pow(alpha, NP0*n2 - n6*n92)*n3*n6*n79/n88 + n3*n71)*(pow(alpha, NP0*n2 - n6*n92)*n30*n6*n79/n88 + n30*n71)/n118) - n1*n196 + 4.0*n133*n154*n42*n77 - 4.0*n137*n162*n42) + pow(-n18*(n0*n133*n42*n43*(pow(alpha, NP0*n2 - n2*n92)*n74*n79/n88 + n83) + n0*n137*n42*(pow(alpha, NP0*n2 - n2*n92)*n2*n3*n79/n88 + n77)*(pow(alpha, NP0*n2 - n2*n92)*n2*n30*n79/n88 + n2*n30*n31) + n0*xTj*(-pow(n111, n14)*n42*n63*(pow(alpha, NP0*n2 - n7*n92)*n61*n7*n79/n88 - pow(alpha, n18*n2 - n7*n92)*n21*n23*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n7*n92)*pow(n32, n14)*n46*n61*n7*pow(n88, n14) + n80) - pow(n113, n14)*n42*n67*(pow(alpha, NP0*n2 - n9*n92)*n61*n79*n9/n88 - pow(alpha, n18*n2 - n9*n92)*n21*n25*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n9*n92)*pow(n32, n14)*n46*n61*pow(n88, n14)*n9 + n81) + pow(n114, n14)*n42*n76*(pow(alpha, NP0*n2 - n10*n92)*n10*n61*n79/n88 + pow(alpha, -n10*n92 + n18*n2)*n10*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n10*n92 + n18*n2)*n21*n26*pow(n32, n14)*n46*pow(n88, n14) + n82) - pow(n115, n14)*n42*n68*(pow(alpha, NP0*n2 - n11*n92)*n11*n61*n79/n88 + pow(alpha, -n11*n92 + n18*n2)*n11*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n11*n92 + n18*n2)*n21*n27*pow(n32, n14)*n46*pow(n88, n14) + n86) - n133*n42*n43*(pow(alpha, NP0*n2 - n2*n92)*n74*n79/n88 + n83) + n135*n42*n66*(pow(alpha, NP0*n2 - n6*n92)*n6*n61*n79/n88 - pow(alpha, n18*n2 - n6*n92)*n21*n22*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n6*n92)*pow(n32, n14)*n46*n6*n61*pow(n88, n14) + n87) - n137*n42*(pow(alpha, NP0*n2 - n2*n92)*n2*n3*n79/n88 + n77)*(pow(alpha, NP0*n2 - n2*n92)*n2*n30*n79/n88 + n2*n30*n31) - n138*n42*(pow(alpha, NP0*n2 - n12*n92)*n12*n3*n79/n88 + n78)*(pow(alpha, NP0*n2 - n12*n92)*n12*n30*n79/n88 + n30*n73) - n139*n42*(pow(alpha, NP0*n2 - n12*n92)*n12*n61*n79/n88 + pow(alpha, -n12*n92 + n18*n2)*n12*pow(n32, n14)*n46*n61*pow(n88, n14) - pow(alpha, -n12*n92 + n18*n2)*n21*n28*pow(n32, n14)*n46*pow(n88, n14) + n84) + n140*n42*(pow(alpha, NP0*n2 - n8*n92)*n61*n79*n8/n88 - pow(alpha, n18*n2 - n8*n92)*n21*n24*pow(n32, n14)*n46*pow(n88, n14) + pow(alpha, n18*n2 - n8*n92)*pow(n32, n14)*n46*n61*n8*pow(n88, n14) + n85) + n143 + n144 + n145 + n146 + n147 + n148 + n149 + n150 + n187 + n188 + n189 + n190 + n191 + n192 + n193 + n194 - n42*n68*(pow(alpha, NP0*n2 - n11*n92)*n11*n3*n79/n88 + n3*n69)*(pow(alpha, NP0*n2 - n11*n92)*n11*n30*n79/n88 + n30*n69)/n123 + n42*n76*(pow(alpha, NP0*n2 - n10*n92)*n10*n3*n79/n88 + n3*n65)*(pow(alpha, NP0*n2 - n10*n92)*n10*n30*n79/n88 + n30*n65)/n122 - n42*n67*(pow(alpha, NP0*n2 - n9*n92)*n3*n79*n9/n88 + n3*n72)*(pow(alpha, NP0*n2 - n9*n92)*n30*n79*n9/n88 + n30*n72)/n121 - n42*n48*xF[3]*(pow(alpha, NP0*n2 - n8*n92)*n3*n79*n8/n88 + n3*n70)*(pow(alpha, NP0*n2 - n8*n92)*n30*n79*n8/n88 + n30*n70)/n120 - n42*n63*(pow(alpha, NP0*n2 - n7*n92)*n3*n7*n79/n88 + n3*n64)*(pow(alpha, NP0*n2 - n7*n92)*n30*n7*n79/n88 + n30*n64)/n119 - n42*n66*(pow(alpha, NP0*n2 - n6*n92)*n3*n6*n79/n88 + n3*n71)*(pow(alpha, NP0*n2 - n6*n92)*n30*n6*n79/n88 + n30*n71)/n118) + 1.0*n133*n42*n77*(pow(alpha, NP0*n2 - n2*n92)*n2*n3*n79/n88 + n77) + n151) - n212, -n1);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - pow(NP_sqrt_base, -n0))/NP_2a;
-      NT1 = n62*(n89 - log(-pow(alpha, NP1*n2)*n79 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[2] - Mstar;
-      g5 = MW[3] - Mstar;
-      g6 = MW[4] - Mstar;
-      g7 = MW[5] - Mstar;
-      g8 = MW[6] - Mstar;
-      g9 = MW[7] - Mstar;
-      g10 = xF[0] - xTj;
-      g11 = xF[0] - xPj;
-      g12 = -xTj;
-      g13 = xPj/xF[1];
-      g14 = pow(alpha, -g1);
-      g15 = pow(alpha, -g0);
-      g16 = pow(alpha, -g4);
-      g17 = pow(alpha, -g5);
-      g18 = pow(alpha, -g6);
-      g19 = pow(alpha, -g7);
-      g20 = pow(alpha, -g8);
-      g21 = pow(alpha, -g9);
-      g22 = log(xF[0]/xF[1]);
-      g23 = -g2;
-      g24 = pow(alpha, NP1*g0);
-      g25 = pow(alpha, NP1*g1);
-      g26 = log(g14);
-      g27 = pow(alpha, NP1*g4);
-      g28 = pow(alpha, NP1*g5);
-      g29 = pow(alpha, NP1*g6);
-      g30 = pow(alpha, NP1*g7);
-      g31 = pow(alpha, NP1*g8);
-      g32 = pow(alpha, NP1*g9);
-      g33 = -g22;
-      g34 = g10/g3;
-      g35 = g3/g10;
-      g36 = -g24 + 1;
-      g37 = -g24 + 1;
-      g38 = -g25 + 1;
-      g39 = -g27 + 1;
-      g40 = -g28 + 1;
-      g41 = -g29 + 1;
-      g42 = -g30 + 1;
-      g43 = -g31 + 1;
-      g44 = -g32 + 1;
-      g45 = -g25;
-      g46 = -g27;
-      g47 = -g28;
-      g48 = -g29;
-      g49 = -g30;
-      g50 = -g31;
-      g51 = -g32;
-      g52 = -1.0*g22;
-      g53 = -g3/g11;
-      g54 = g11/(g3*xF[1]);
-      g55 = pow(alpha, g0*g23) - 1;
-      g56 = pow(alpha, g0*g23) - 1;
-      g57 = pow(alpha, g1*g23) - 1;
-      g58 = pow(alpha, g23*g4) - 1;
-      g59 = pow(alpha, g23*g5) - 1;
-      g60 = pow(alpha, g23*g6) - 1;
-      g61 = pow(alpha, g23*g7) - 1;
-      g62 = pow(alpha, g23*g8) - 1;
-      g63 = pow(alpha, g23*g9) - 1;
-      g64 = -pow(alpha, g1*g23);
-      g65 = -pow(alpha, g23*g4);
-      g66 = -pow(alpha, g23*g5);
-      g67 = -pow(alpha, g23*g6);
-      g68 = -pow(alpha, g23*g7);
-      g69 = -pow(alpha, g23*g8);
-      g70 = -pow(alpha, g23*g9);
-      g71 = g37 + g56;
-      g72 = -g25 - g64;
-      g73 = -g27 - g65;
-      g74 = -g28 - g66;
-      g75 = -g29 - g67;
-      g76 = -g30 - g68;
-      g77 = -g31 - g69;
-      g78 = -g32 - g70;
-      g79 = pow(alpha, g1*g23) + g45;
-      g80 = g37 + g56;
-      g81 = pow(alpha, g23*g4) + g46;
-      g82 = pow(alpha, g23*g5) + g47;
-      g83 = pow(alpha, g23*g6) + g48;
-      g84 = pow(alpha, g23*g7) + g49;
-      g85 = pow(alpha, g23*g8) + g50;
-      g86 = pow(alpha, g23*g9) + g51;
-      g87 = xF[0]/g79;
-      g88 = xF[1]/g80;
-      g89 = xF[2]/g81;
-      g90 = xF[3]/g82;
-      g91 = xF[6]/g85;
-      g92 = xF[7]/g86;
-      g93 = xF[4]/g83;
-      g94 = xF[5]/g84;
-      g95 = xF[1]/g71;
-      g96 = xF[0]/g72;
-      g97 = xF[4]/g75;
-      g98 = xF[5]/g76;
-      g99 = xF[7]/g78;
-      g100 = xF[2]/g73;
-      g101 = xF[6]/g77;
-      g102 = xF[3]/g74;
-      g103 = g43/g77;
-      g104 = g41/g75;
-      g105 = g44/g78;
-      g106 = g38/g72;
-      g107 = g42/g76;
-      g108 = g40/g74;
-      g109 = g36/g71;
-      g110 = g39/g73;
-      g111 = g55/g71;
-      g112 = g57/g72;
-      g113 = g61/g76;
-      g114 = g58/g73;
-      g115 = g59/g74;
-      g116 = g60/g75;
-      g117 = g62/g77;
-      g118 = g63/g78;
-      g119 = log(g12*g54*g80/g37);
-      g120 = log(g12*g54*g71/g36);
-      g121 = log(g13*g34*g80/g56);
-      g122 = 1.0*g119;
-      g123 = log(g13*g34*g71/g55);
-      g124 = 1.0*g121;
-      g125 = -g122*g37*g88 - g122*g87*(g45 + 1) - g122*g89*(g46 + 1) - g122*g90*(g47 + 1) - g122*g91*(g50 + 1) - g122*g92*(g51 + 1) - g122*g93*(g48 + 1) - g122*g94*(g49 + 1) - g124*g56*g88 - g124*g87*(pow(alpha, g1*g23) - 1) - g124*g89*(pow(alpha, g23*g4) - 1) - g124*g90*(pow(alpha, g23*g5) - 1) - g124*g91*(pow(alpha, g23*g8) - 1) - g124*g92*(pow(alpha, g23*g9) - 1) - g124*g93*(pow(alpha, g23*g6) - 1) - g124*g94*(pow(alpha, g23*g7) - 1) - g52*xF[0] - g52*xF[1] - g52*xF[2] - g52*xF[3] - g52*xF[4] - g52*xF[5] - g52*xF[6] - g52*xF[7];
-      LpF = xF[0]*(g14 + 1.0)*(g106*g120 + g112*g123 + g33)/(g26*(g14 - 1.0)) + xF[1]*(g15 + 1.0)*(g109*g120 + g111*g123 + g33)/(g26*(g15 - 1.0)) + xF[2]*(g16 + 1.0)*(g110*g120 + g114*g123 + g33)/(g26*(g16 - 1.0)) + xF[3]*(g17 + 1.0)*(g108*g120 + g115*g123 + g33)/(g26*(g17 - 1.0)) + xF[4]*(g18 + 1.0)*(g104*g120 + g116*g123 + g33)/(g26*(g18 - 1.0)) + xF[5]*(g19 + 1.0)*(g107*g120 + g113*g123 + g33)/(g26*(g19 - 1.0)) + xF[6]*(g20 + 1.0)*(g103*g120 + g117*g123 + g33)/(g26*(g20 - 1.0)) + xF[7]*(g21 + 1.0)*(g105*g120 + g118*g123 + g33)/(g26*(g21 - 1.0));
-      PpF = g34;
-      TpF = -g11/g3;
-      SWUpF = g125;
-      SWUpP = g125*g35;
-      xP[0] = g35*g57*g96;
-      xP[1] = g35*g55*g95;
-      xP[2] = g100*g35*g58;
-      xP[3] = g102*g35*g59;
-      xP[4] = g35*g60*g97;
-      xP[5] = g35*g61*g98;
-      xP[6] = g101*g35*g62;
-      xP[7] = g35*g63*g99;
-      xT[0] = g38*g53*g96;
-      xT[1] = g36*g53*g95;
-      xT[2] = g100*g39*g53;
-      xT[3] = g102*g40*g53;
-      xT[4] = g41*g53*g97;
-      xT[5] = g42*g53*g98;
-      xT[6] = g101*g43*g53;
-      xT[7] = g44*g53*g99;
-      break;
-    case 9:
-      n0 = MW[0] - Mstar;
-      n1 = log(alpha);
-      n2 = xPj - xTj;
-      n3 = xF[0] - xPj;
-      n4 = MW[1] - Mstar;
-      n5 = MW[2] - Mstar;
-      n6 = MW[3] - Mstar;
-      n7 = MW[4] - Mstar;
-      n8 = MW[5] - Mstar;
-      n9 = MW[6] - Mstar;
-      n10 = MW[7] - Mstar;
-      n11 = MW[8] - Mstar;
-      n12 = log(xTj);
-      n13 = -2;
-      n14 = xF[0]*xPj;
-      n15 = -Mstar;
-      n16 = -xPj;
-      n17 = -NP0*n13;
-      n18 = -xF[0];
-      n19 = -xTj;
-      n20 = pow(n0, -n13);
-      n21 = pow(n1, -n13);
-      n22 = pow(n4, -n13);
-      n23 = pow(n5, -n13);
-      n24 = pow(n6, -n13);
-      n25 = pow(n7, -n13);
-      n26 = pow(n8, -n13);
-      n27 = pow(n9, -n13);
-      n28 = pow(n10, -n13);
-      n29 = pow(n11, -n13);
-      n30 = Mstar*n1;
-      n31 = -n1*n13;
-      n32 = pow(alpha, NP0*n0);
-      n33 = n14 + n18*xTj;
-      n34 = n14 + n16*xTj;
-      n35 = pow(alpha, NP0*n4);
-      n36 = pow(alpha, NP0*n5);
-      n37 = pow(alpha, NP0*n6);
-      n38 = pow(alpha, NP0*n7);
-      n39 = pow(alpha, NP0*n8);
-      n40 = pow(alpha, NP0*n9);
-      n41 = pow(alpha, NP0*n10);
-      n42 = pow(alpha, NP0*n11);
-      n43 = -MW[0]*n1;
-      n44 = n2/n3;
-      n45 = n0*n1;
-      n46 = -n32 + 1;
-      n47 = -n35 + 1;
-      n48 = pow(alpha, n0*n17);
-      n49 = pow(n33, -n13);
-      n50 = pow(n34, -n13);
-      n51 = -n36 + 1;
-      n52 = -n37 + 1;
-      n53 = -n38 + 1;
-      n54 = -n39 + 1;
-      n55 = -n40 + 1;
-      n56 = -n41 + 1;
-      n57 = -n42 + 1;
-      n58 = -n55;
-      n59 = -n51;
-      n60 = -n53;
-      n61 = -n52;
-      n62 = -n32;
-      n63 = -n41;
-      n64 = 1.0/n45;
-      n65 = n0*n21;
-      n66 = n20*n21;
-      n67 = n36*n5;
-      n68 = n39*n8;
-      n69 = n57*xF[8];
-      n70 = n40*n9;
-      n71 = n37*n6;
-      n72 = n35*n4;
-      n73 = n38*n7;
-      n74 = n11*n42;
-      n75 = n10*n41;
-      n76 = log((-1.0 + xPj/xF[0])/n2);
-      n77 = -n54*xF[5];
-      n78 = -n47*xF[1];
-      n79 = n1*n74;
-      n80 = n1*n75;
-      n81 = n34/n33;
-      n82 = n21*n23*n36;
-      n83 = n21*n25*n38;
-      n84 = n21*n29*n42;
-      n85 = n21*n28*n41;
-      n86 = n21*n24*n37;
-      n87 = n21*n27*n40;
-      n88 = n21*n22*n35;
-      n89 = n44*n77;
-      n90 = n62*n81 + 1;
-      n91 = pow(n90, -n13);
-      n92 = n12 + n30 + n43 + n76;
-      n93 = n32*n81/n90;
-      n94 = n21*n48*n50/(n49*n91);
-      n95 = n64*(n92 - log(n90)) + 1;
-      n96 = pow(alpha, n0*n95);
-      n97 = pow(alpha, n4*n95);
-      n98 = pow(alpha, n5*n95);
-      n99 = pow(alpha, n6*n95);
-      n100 = pow(alpha, n7*n95);
-      n101 = pow(alpha, n8*n95);
-      n102 = pow(alpha, n9*n95);
-      n103 = pow(alpha, n10*n95);
-      n104 = pow(alpha, n11*n95);
-      n105 = n4/n97;
-      n106 = n11/n104;
-      n107 = n7/n100;
-      n108 = n6/n99;
-      n109 = n10/n103;
-      n110 = n9/n102;
-      n111 = n8/n101;
-      n112 = n5/n98;
-      n113 = n46 - 1 + 1.0/n96;
-      n114 = n47 - 1 + 1.0/n97;
-      n115 = n51 - 1 + 1.0/n98;
-      n116 = n52 - 1 + 1.0/n99;
-      n117 = n53 - 1 + 1.0/n100;
-      n118 = n54 - 1 + 1.0/n101;
-      n119 = n55 - 1 + 1.0/n102;
-      n120 = n56 - 1 + 1.0/n103;
-      n121 = n57 - 1 + 1.0/n104;
-      n122 = pow(n113, -n13);
-      n123 = pow(n114, -n13);
-      n124 = pow(n115, -n13);
-      n125 = pow(n116, -n13);
-      n126 = pow(n117, -n13);
-      n127 = pow(n118, -n13);
-      n128 = pow(n119, -n13);
-      n129 = pow(n120, -n13);
-      n130 = pow(n121, -n13);
-      n131 = pow(n113, 3);
-      n132 = pow(n114, 3);
-      n133 = pow(n115, 3);
-      n134 = pow(n116, 3);
-      n135 = pow(n117, 3);
-      n136 = pow(n118, 3);
-      n137 = pow(n119, 3);
-      n138 = pow(n120, 3);
-      n139 = pow(n121, 3);
-      n140 = xF[8]/n121;
-      n141 = xF[6]/n119;
-      n142 = xF[7]/n120;
-      n143 = xF[1]/n114;
-      n144 = xF[2]/n115;
-      n145 = xF[4]/n117;
-      n146 = xF[3]/n116;
-      n147 = xF[6]/n137;
-      n148 = n1*xF[5]/n118;
-      n149 = -1/n130;
-      n150 = n1*n146;
-      n151 = n32*xF[0]/n113;
-      n152 = n46/n113;
-      n153 = n32*xF[0]/n122;
-      n154 = n56*xF[7]/n138;
-      n155 = n56*xF[7]/n129;
-      n156 = n61*xF[3]/n125;
-      n157 = n21*n26*n39*xF[5]/n118;
-      n158 = n151*n44/n64;
-      n159 = n18*n32*n44/(n113*n64);
-      n160 = n151*n44*n66;
-      n161 = n143*n44*n88;
-      n162 = n144*n44*n82;
-      n163 = n146*n44*n86;
-      n164 = n145*n44*n83;
-      n165 = n157*n44;
-      n166 = n141*n44*n87;
-      n167 = n142*n44*n85;
-      n168 = n140*n44*n84;
-      n169 = 0.5*n160;
-      n170 = n81/(n90*n96) + 1;
-      n171 = n170*n46;
-      n172 = n32/n64 + n93/(n64*n96);
-      n173 = n1*n105*n93 + n1*n72;
-      n174 = n1*n112*n93 + n1*n67;
-      n175 = n1*n108*n93 + n1*n71;
-      n176 = n1*n107*n93 + n1*n73;
-      n177 = n1*n111*n93 + n1*n68;
-      n178 = n1*n110*n93 + n1*n70;
-      n179 = n1*n109*n93 + n80;
-      n180 = n1*n106*n93 + n79;
-      n181 = pow(n172, -n13);
-      n182 = pow(n173, -n13);
-      n183 = pow(n174, -n13);
-      n184 = pow(n175, -n13);
-      n185 = pow(n176, -n13);
-      n186 = pow(n177, -n13);
-      n187 = pow(n178, -n13);
-      n188 = pow(n179, -n13);
-      n189 = pow(n180, -n13);
-      n190 = n174*xF[2];
-      n191 = n175*xF[3];
-      n192 = n0*n31*n32 + n0*n31*n93/n96;
-      n193 = n32*n66 + n66*n93/n96;
-      n194 = n172*n46;
-      n195 = n187*n55;
-      n196 = n176*n60*xF[4];
-      n197 = n177/n127;
-      n198 = n173/n123;
-      n199 = n178*xF[6]/n128;
-      n200 = n189/n139;
-      n201 = n192/n131;
-      n202 = n181*n46*xF[0]/n131;
-      n203 = n184*n52*xF[3]/n134;
-      n204 = n185*n53*xF[4]/n135;
-      n205 = n183*n51*xF[2]/n133;
-      n206 = n182*n47*xF[1]/n132;
-      n207 = n193*n46/n122;
-      n208 = n18*n44*n46*(pow(alpha, NP0*n0 - n0*n95)*n81/(n64*n90) + n32/n64)/n122;
-      n209 = n13*n18*n32*n44*(pow(alpha, NP0*n0 - n0*n95)*n81/(n64*n90) + n32/n64)/(n122*n64);
-      n210 = n31*n44*n72*xF[1]*(pow(alpha, NP0*n0 - n4*n95)*n1*n4*n81/n90 + n1*n72)/n123;
-      n211 = n31*n44*n67*xF[2]*(pow(alpha, NP0*n0 - n5*n95)*n1*n5*n81/n90 + n1*n67)/n124;
-      n212 = n31*n44*n71*xF[3]*(pow(alpha, NP0*n0 - n6*n95)*n1*n6*n81/n90 + n1*n71)/n125;
-      n213 = n31*n44*n73*xF[4]*(pow(alpha, NP0*n0 - n7*n95)*n1*n7*n81/n90 + n1*n73)/n126;
-      n214 = n31*n44*n68*xF[5]*(pow(alpha, NP0*n0 - n8*n95)*n1*n8*n81/n90 + n1*n68)/n127;
-      n215 = n31*n44*n70*xF[6]*(pow(alpha, NP0*n0 - n9*n95)*n1*n81*n9/n90 + n1*n70)/n128;
-      n216 = n31*n44*n75*xF[7]*(pow(alpha, NP0*n0 - n10*n95)*n1*n10*n81/n90 + n80)/n129;
-      n217 = n31*n44*n74*xF[8]*(pow(alpha, NP0*n0 - n11*n95)*n1*n11*n81/n90 + n79)/n130;
-      n218 = 1.0*n153*n172*n44/n64;
-      n219 = n18*n44*n46*(pow(alpha, NP0*n0 - n0*n95)*n66*n81/n90 + n32*n66)/n122;
-      n220 = -0.5*n207*n44*xF[0];
-      n221 = n158 + n208;
-      n222 = n105*n48*n50*n65/(n49*n91) + n105*n65*n93 - n22*n94/n97 + n88;
-      n223 = n112*n48*n50*n65/(n49*n91) + n112*n65*n93 - n23*n94/n98 + n82;
-      n224 = n107*n48*n50*n65/(n49*n91) + n107*n65*n93 + n83 - n25*n94/n100;
-      n225 = n111*n48*n50*n65/(n49*n91) + n111*n65*n93 + n21*n26*n39 - n26*n94/n101;
-      n226 = n110*n48*n50*n65/(n49*n91) + n110*n65*n93 + n87 - n27*n94/n102;
-      n227 = n44*n78*(-pow(alpha, n0*n17 - n4*n95)*n21*n22*n50/(n49*n91) + pow(alpha, n0*n17 - n4*n95)*n4*n50*n65/(n49*n91) + n105*n65*n93 + n88)/n123;
-      n228 = n44*n59*xF[2]*(-pow(alpha, n0*n17 - n5*n95)*n21*n23*n50/(n49*n91) + pow(alpha, n0*n17 - n5*n95)*n5*n50*n65/(n49*n91) + n112*n65*n93 + n82)/n124;
-      n229 = n156*n44*(-pow(alpha, n0*n17 - n6*n95)*n21*n24*n50/(n49*n91) + pow(alpha, n0*n17 - n6*n95)*n50*n6*n65/(n49*n91) + n108*n65*n93 + n86);
-      n230 = n44*n60*xF[4]*(-pow(alpha, n0*n17 - n7*n95)*n21*n25*n50/(n49*n91) + pow(alpha, n0*n17 - n7*n95)*n50*n65*n7/(n49*n91) + n107*n65*n93 + n83)/n126;
-      n231 = n89*(-pow(alpha, n0*n17 - n8*n95)*n21*n26*n50/(n49*n91) + pow(alpha, n0*n17 - n8*n95)*n50*n65*n8/(n49*n91) + n111*n65*n93 + n21*n26*n39)/n127;
-      n232 = n44*n58*xF[6]*(-pow(alpha, n0*n17 - n9*n95)*n21*n27*n50/(n49*n91) + pow(alpha, n0*n17 - n9*n95)*n50*n65*n9/(n49*n91) + n110*n65*n93 + n87)/n128;
-      n233 = -n155*n44*(pow(alpha, n0*n17 - n10*n95)*n10*n50*n65/(n49*n91) - pow(alpha, n0*n17 - n10*n95)*n21*n28*n50/(n49*n91) + n109*n65*n93 + n85);
-      n234 = n149*n44*n69*(pow(alpha, n0*n17 - n11*n95)*n11*n50*n65/(n49*n91) - pow(alpha, n0*n17 - n11*n95)*n21*n29*n50/(n49*n91) + n106*n65*n93 + n84);
-      n235 = n169 + n218 + n220;
-      n236 = n1*n141*n44*n70 + n1*n143*n44*n72 + n1*n144*n44*n67 + n1*n145*n44*n73 + n140*n44*n79 + n142*n44*n80 + n148*n44*n68 + n149*n180*n44*n69 + n150*n44*n71 - n155*n179*n44 + n156*n175*n44 + n197*n89 + n198*n44*n78 + n199*n44*n58 + n221 + n196*n44/n126 + n190*n44*n59/n124;
-      n237 = n236*xTj;
-      n238 = n160 + n161 + n162 + n163 + n164 + n165 + n166 + n167 + n168 + n209 + n210 + n211 + n212 + n213 + n214 + n215 + n216 + n217 + n219 + n227 + n228 + n229 + n230 + n231 + n232 + n233 + n234;
-      n239 = n147*n178*n44*n58*(n110*n31*n93 + n31*n70) - n154*n179*n44*(n109*n31*n93 + n31*n75) + n238 - n180*n44*n69*(n106*n31*n93 + n31*n74)/n139 + n177*n89*(n111*n31*n93 + n31*n68)/n136 + n196*n44*(n107*n31*n93 + n31*n73)/n135 + n191*n44*n61*(n108*n31*n93 + n31*n71)/n134 + n190*n44*n59*(n112*n31*n93 + n31*n67)/n133 + n173*n44*n78*(n105*n31*n93 + n31*n72)/n132 + n18*n44*n46*(pow(alpha, NP0*n0 - n0*n95)*n81/(n64*n90) + n32/n64)*(pow(alpha, NP0*n0 - n0*n95)*n0*n31*n81/n90 + n0*n31*n32)/n131;
-      NP_b = -n153*n171*n44/n64 - n159 - n17*(1.0*n153*n44*(pow(alpha, NP0*n0 - n0*n95)*n81/(n64*n90) + n32/n64)/n64 + n169 - 1.0*n202*n44 - 0.5*xTj*(n13*n147*n195*n44 + n13*n154*n188*n44 + n13*n200*n44*n69 + n13*n202*n44 + n13*n203*n44 + n13*n204*n44 + n13*n205*n44 + n13*n206*n44 + n13*n186*n44*n54*xF[5]/n136 + n149*n44*n69*(pow(alpha, NP0*n0 - n11*n95)*n11*n65*n81/n90 + pow(alpha, n0*n17 - n11*n95)*n11*n50*n65/(n49*n91) - pow(alpha, n0*n17 - n11*n95)*n21*n29*n50/(n49*n91) + n84) - n155*n44*(pow(alpha, NP0*n0 - n10*n95)*n10*n65*n81/n90 + pow(alpha, n0*n17 - n10*n95)*n10*n50*n65/(n49*n91) - pow(alpha, n0*n17 - n10*n95)*n21*n28*n50/(n49*n91) + n85) + n156*n44*(pow(alpha, NP0*n0 - n6*n95)*n6*n65*n81/n90 - pow(alpha, n0*n17 - n6*n95)*n21*n24*n50/(n49*n91) + pow(alpha, n0*n17 - n6*n95)*n50*n6*n65/(n49*n91) + n86) + n160 + n161 + n162 + n163 + n164 + n165 + n166 + n167 + n168 + n209 + n210 + n211 + n212 + n213 + n214 + n215 + n216 + n217 + n219 + n44*n58*xF[6]*(pow(alpha, NP0*n0 - n9*n95)*n65*n81*n9/n90 - pow(alpha, n0*n17 - n9*n95)*n21*n27*n50/(n49*n91) + pow(alpha, n0*n17 - n9*n95)*n50*n65*n9/(n49*n91) + n87)/n128 + n89*(pow(alpha, NP0*n0 - n8*n95)*n65*n8*n81/n90 - pow(alpha, n0*n17 - n8*n95)*n21*n26*n50/(n49*n91) + pow(alpha, n0*n17 - n8*n95)*n50*n65*n8/(n49*n91) + n21*n26*n39)/n127 + n44*n60*xF[4]*(pow(alpha, NP0*n0 - n7*n95)*n65*n7*n81/n90 - pow(alpha, n0*n17 - n7*n95)*n21*n25*n50/(n49*n91) + pow(alpha, n0*n17 - n7*n95)*n50*n65*n7/(n49*n91) + n83)/n126 + n44*n59*xF[2]*(pow(alpha, NP0*n0 - n5*n95)*n5*n65*n81/n90 - pow(alpha, n0*n17 - n5*n95)*n21*n23*n50/(n49*n91) + pow(alpha, n0*n17 - n5*n95)*n5*n50*n65/(n49*n91) + n82)/n124 + n44*n78*(pow(alpha, NP0*n0 - n4*n95)*n4*n65*n81/n90 - pow(alpha, n0*n17 - n4*n95)*n21*n22*n50/(n49*n91) + pow(alpha, n0*n17 - n4*n95)*n4*n50*n65/(n49*n91) + n88)/n123) - 0.5*n44*n46*xF[0]*(pow(alpha, NP0*n0 - n0*n95)*n66*n81/n90 + n32*n66)/n122) - n44*xTj*(n1*n141*n70 + n1*n143*n72 + n1*n144*n67 + n1*n145*n73 + n140*n79 + n142*n80 + n148*n68 + n149*n180*n69 + n150*n71 + n151/n64 - n155*n179 + n156*n175 + n197*n77 + n198*n78 + n199*n58 + n196/n126 + n190*n59/n124 + n18*n46*(pow(alpha, NP0*n0 - n0*n95)*n81/(n64*n90) + n32/n64)/n122);
-      NP_2a = -n44*(n13*pow(n170, -n13)*n18*n46*n48*n66/n131 - 1.0*n151*n66 + n153*n171*n66 + 1.0*xTj*(n13*n147*n195 + n13*n154*n188 + n13*n200*n69 + n13*n202 + n13*n203 + n13*n204 + n13*n205 + n13*n206 + n13*n186*n54*xF[5]/n136 + n140*n84 + n141*n87 + n142*n85 + n143*n88 + n144*n82 + n145*n83 + n146*n86 + n149*n69*(pow(alpha, n0*n17 - n11*n95)*n11*n50*n65/(n49*n91) - pow(alpha, n0*n17 - n11*n95)*n21*n29*n50/(n49*n91) + n106*n65*n93 + n84) + n151*n66 - n155*(pow(alpha, n0*n17 - n10*n95)*n10*n50*n65/(n49*n91) - pow(alpha, n0*n17 - n10*n95)*n21*n28*n50/(n49*n91) + n109*n65*n93 + n85) + n156*(-pow(alpha, n0*n17 - n6*n95)*n21*n24*n50/(n49*n91) + pow(alpha, n0*n17 - n6*n95)*n50*n6*n65/(n49*n91) + n108*n65*n93 + n86) + n157 + n31*n74*xF[8]*(pow(alpha, NP0*n0 - n11*n95)*n1*n11*n81/n90 + n79)/n130 + n31*n75*xF[7]*(pow(alpha, NP0*n0 - n10*n95)*n1*n10*n81/n90 + n80)/n129 + n31*n70*xF[6]*(pow(alpha, NP0*n0 - n9*n95)*n1*n81*n9/n90 + n1*n70)/n128 + n58*xF[6]*(-pow(alpha, n0*n17 - n9*n95)*n21*n27*n50/(n49*n91) + pow(alpha, n0*n17 - n9*n95)*n50*n65*n9/(n49*n91) + n110*n65*n93 + n87)/n128 + n31*n68*xF[5]*(pow(alpha, NP0*n0 - n8*n95)*n1*n8*n81/n90 + n1*n68)/n127 + n77*(-pow(alpha, n0*n17 - n8*n95)*n21*n26*n50/(n49*n91) + pow(alpha, n0*n17 - n8*n95)*n50*n65*n8/(n49*n91) + n111*n65*n93 + n21*n26*n39)/n127 + n31*n73*xF[4]*(pow(alpha, NP0*n0 - n7*n95)*n1*n7*n81/n90 + n1*n73)/n126 + n60*xF[4]*(-pow(alpha, n0*n17 - n7*n95)*n21*n25*n50/(n49*n91) + pow(alpha, n0*n17 - n7*n95)*n50*n65*n7/(n49*n91) + n107*n65*n93 + n83)/n126 + n31*n71*xF[3]*(pow(alpha, NP0*n0 - n6*n95)*n1*n6*n81/n90 + n1*n71)/n125 + n31*n67*xF[2]*(pow(alpha, NP0*n0 - n5*n95)*n1*n5*n81/n90 + n1*n67)/n124 + n59*xF[2]*(-pow(alpha, n0*n17 - n5*n95)*n21*n23*n50/(n49*n91) + pow(alpha, n0*n17 - n5*n95)*n5*n50*n65/(n49*n91) + n112*n65*n93 + n82)/n124 + n31*n72*xF[1]*(pow(alpha, NP0*n0 - n4*n95)*n1*n4*n81/n90 + n1*n72)/n123 + n78*(-pow(alpha, n0*n17 - n4*n95)*n21*n22*n50/(n49*n91) + pow(alpha, n0*n17 - n4*n95)*n4*n50*n65/(n49*n91) + n105*n65*n93 + n88)/n123 + n13*n18*n32*(pow(alpha, NP0*n0 - n0*n95)*n81/(n64*n90) + n32/n64)/(n122*n64) + n18*n46*(pow(alpha, NP0*n0 - n0*n95)*n66*n81/n90 + n32*n66)/n122) - 2.0*n170*n48*n66*xF[0]/n122);
-      NP_sqrt_base = (NP0*(n19*(n1*n141*n44*n70 + n1*n143*n44*n72 + n1*n144*n44*n67 + n1*n145*n44*n73 + n140*n44*n79 + n142*n44*n80 + n148*n44*n68 + n149*n44*n69*(pow(alpha, NP0*n0 - n11*n95)*n1*n11*n81/n90 + n79) + n150*n44*n71 - n155*n44*(pow(alpha, NP0*n0 - n10*n95)*n1*n10*n81/n90 + n80) + n156*n44*(pow(alpha, NP0*n0 - n6*n95)*n1*n6*n81/n90 + n1*n71) + n221 + n44*n58*xF[6]*(pow(alpha, NP0*n0 - n9*n95)*n1*n81*n9/n90 + n1*n70)/n128 + n89*(pow(alpha, NP0*n0 - n8*n95)*n1*n8*n81/n90 + n1*n68)/n127 + n44*n60*xF[4]*(pow(alpha, NP0*n0 - n7*n95)*n1*n7*n81/n90 + n1*n73)/n126 + n44*n59*xF[2]*(pow(alpha, NP0*n0 - n5*n95)*n1*n5*n81/n90 + n1*n67)/n124 + n44*n78*(pow(alpha, NP0*n0 - n4*n95)*n1*n4*n81/n90 + n1*n72)/n123) + n221) + n152*n44*xF[0] + xTj*(n141*n44*n58 - n142*n44*n56 + n144*n44*n59 + n145*n44*n60 + n146*n44*n61 + n152*n18*n44 - n44*n69/n121 + n89/n118 + n44*n78/n114) + pow(NP0, -n13)*(-1.0*n153*n172*n44/n64 - 0.5*n160 + 0.5*n194*n201*n44*xF[0] + 0.5*n207*n44*xF[0] + 0.5*n239*xTj))*(-n13*n19*(n147*n44*n58*(pow(alpha, NP0*n0 - n9*n95)*n1*n81*n9/n90 + n1*n70)*(pow(alpha, NP0*n0 - n9*n95)*n31*n81*n9/n90 + n31*n70) + n149*n44*n69*(pow(alpha, NP0*n0 - n11*n95)*n11*n65*n81/n90 + pow(alpha, n0*n17 - n11*n95)*n11*n50*n65/(n49*n91) - pow(alpha, n0*n17 - n11*n95)*n21*n29*n50/(n49*n91) + n84) - n154*n44*(pow(alpha, NP0*n0 - n10*n95)*n1*n10*n81/n90 + n80)*(pow(alpha, NP0*n0 - n10*n95)*n10*n31*n81/n90 + n31*n75) - n155*n44*(pow(alpha, NP0*n0 - n10*n95)*n10*n65*n81/n90 + pow(alpha, n0*n17 - n10*n95)*n10*n50*n65/(n49*n91) - pow(alpha, n0*n17 - n10*n95)*n21*n28*n50/(n49*n91) + n85) + n156*n44*(pow(alpha, NP0*n0 - n6*n95)*n6*n65*n81/n90 - pow(alpha, n0*n17 - n6*n95)*n21*n24*n50/(n49*n91) + pow(alpha, n0*n17 - n6*n95)*n50*n6*n65/(n49*n91) + n86) + n160 + n161 + n162 + n163 + n164 + n165 + n166 + n167 + n168 + n209 + n210 + n211 + n212 + n213 + n214 + n215 + n216 + n217 + n219 - n44*n69*(pow(alpha, NP0*n0 - n11*n95)*n1*n11*n81/n90 + n79)*(pow(alpha, NP0*n0 - n11*n95)*n11*n31*n81/n90 + n31*n74)/n139 + n89*(pow(alpha, NP0*n0 - n8*n95)*n1*n8*n81/n90 + n1*n68)*(pow(alpha, NP0*n0 - n8*n95)*n31*n8*n81/n90 + n31*n68)/n136 + n44*n60*xF[4]*(pow(alpha, NP0*n0 - n7*n95)*n1*n7*n81/n90 + n1*n73)*(pow(alpha, NP0*n0 - n7*n95)*n31*n7*n81/n90 + n31*n73)/n135 + n44*n61*xF[3]*(pow(alpha, NP0*n0 - n6*n95)*n1*n6*n81/n90 + n1*n71)*(pow(alpha, NP0*n0 - n6*n95)*n31*n6*n81/n90 + n31*n71)/n134 + n44*n59*xF[2]*(pow(alpha, NP0*n0 - n5*n95)*n1*n5*n81/n90 + n1*n67)*(pow(alpha, NP0*n0 - n5*n95)*n31*n5*n81/n90 + n31*n67)/n133 + n44*n78*(pow(alpha, NP0*n0 - n4*n95)*n1*n4*n81/n90 + n1*n72)*(pow(alpha, NP0*n0 - n4*n95)*n31*n4*n81/n90 + n31*n72)/n132 + n18*n44*n46*(pow(alpha, NP0*n0 - n0*n95)*n81/(n64*n90) + n32/n64)*(pow(alpha, NP0*n0 - n0*n95)*n0*n31*n81/n90 + n0*n31*n32)/n131 + n44*n58*xF[6]*(pow(alpha, NP0*n0 - n9*n95)*n65*n81*n9/n90 - pow(alpha, n0*n17 - n9*n95)*n21*n27*n50/(n49*n91) + pow(alpha, n0*n17 - n9*n95)*n50*n65*n9/(n49*n91) + n87)/n128 + n89*(pow(alpha, NP0*n0 - n8*n95)*n65*n8*n81/n90 - pow(alpha, n0*n17 - n8*n95)*n21*n26*n50/(n49*n91) + pow(alpha, n0*n17 - n8*n95)*n50*n65*n8/(n49*n91) + n21*n26*n39)/n127 + n44*n60*xF[4]*(pow(alpha, NP0*n0 - n7*n95)*n65*n7*n81/n90 - pow(alpha, n0*n17 - n7*n95)*n21*n25*n50/(n49*n91) + pow(alpha, n0*n17 - n7*n95)*n50*n65*n7/(n49*n91) + n83)/n126 + n44*n59*xF[2]*(pow(alpha, NP0*n0 - n5*n95)*n5*n65*n81/n90 - pow(alpha, n0*n17 - n5*n95)*n21*n23*n50/(n49*n91) + pow(alpha, n0*n17 - n5*n95)*n5*n50*n65/(n49*n91) + n82)/n124 + n44*n78*(pow(alpha, NP0*n0 - n4*n95)*n4*n65*n81/n90 - pow(alpha, n0*n17 - n4*n95)*n21*n22*n50/(n49*n91) + pow(alpha, n0*n17 - n4*n95)*n4*n50*n65/(n49*n91) + n88)/n123) - n13*n219 + 4.0*n153*n172*n44/n64 + 2.0*n160 - 4.0*n202*n44) + pow(-n159 - n17*(1.0*n153*n44*(pow(alpha, NP0*n0 - n0*n95)*n81/(n64*n90) + n32/n64)/n64 + n169 - 0.5*xTj*(n147*n44*n58*(pow(alpha, NP0*n0 - n9*n95)*n1*n81*n9/n90 + n1*n70)*(pow(alpha, NP0*n0 - n9*n95)*n31*n81*n9/n90 + n31*n70) + n149*n44*n69*(pow(alpha, NP0*n0 - n11*n95)*n11*n65*n81/n90 + pow(alpha, n0*n17 - n11*n95)*n11*n50*n65/(n49*n91) - pow(alpha, n0*n17 - n11*n95)*n21*n29*n50/(n49*n91) + n84) - n154*n44*(pow(alpha, NP0*n0 - n10*n95)*n1*n10*n81/n90 + n80)*(pow(alpha, NP0*n0 - n10*n95)*n10*n31*n81/n90 + n31*n75) - n155*n44*(pow(alpha, NP0*n0 - n10*n95)*n10*n65*n81/n90 + pow(alpha, n0*n17 - n10*n95)*n10*n50*n65/(n49*n91) - pow(alpha, n0*n17 - n10*n95)*n21*n28*n50/(n49*n91) + n85) + n156*n44*(pow(alpha, NP0*n0 - n6*n95)*n6*n65*n81/n90 - pow(alpha, n0*n17 - n6*n95)*n21*n24*n50/(n49*n91) + pow(alpha, n0*n17 - n6*n95)*n50*n6*n65/(n49*n91) + n86) + n160 + n161 + n162 + n163 + n164 + n165 + n166 + n167 + n168 + n209 + n210 + n211 + n212 + n213 + n214 + n215 + n216 + n217 + n219 - n44*n69*(pow(alpha, NP0*n0 - n11*n95)*n1*n11*n81/n90 + n79)*(pow(alpha, NP0*n0 - n11*n95)*n11*n31*n81/n90 + n31*n74)/n139 + n89*(pow(alpha, NP0*n0 - n8*n95)*n1*n8*n81/n90 + n1*n68)*(pow(alpha, NP0*n0 - n8*n95)*n31*n8*n81/n90 + n31*n68)/n136 + n44*n60*xF[4]*(pow(alpha, NP0*n0 - n7*n95)*n1*n7*n81/n90 + n1*n73)*(pow(alpha, NP0*n0 - n7*n95)*n31*n7*n81/n90 + n31*n73)/n135 + n44*n61*xF[3]*(pow(alpha, NP0*n0 - n6*n95)*n1*n6*n81/n90 + n1*n71)*(pow(alpha, NP0*n0 - n6*n95)*n31*n6*n81/n90 + n31*n71)/n134 + n44*n59*xF[2]*(pow(alpha, NP0*n0 - n5*n95)*n1*n5*n81/n90 + n1*n67)*(pow(alpha, NP0*n0 - n5*n95)*n31*n5*n81/n90 + n31*n67)/n133 + n44*n78*(pow(alpha, NP0*n0 - n4*n95)*n1*n4*n81/n90 + n1*n72)*(pow(alpha, NP0*n0 - n4*n95)*n31*n4*n81/n90 + n31*n72)/n132 + n18*n44*n46*(pow(alpha, NP0*n0 - n0*n95)*n81/(n64*n90) + n32/n64)*(pow(alpha, NP0*n0 - n0*n95)*n0*n31*n81/n90 + n0*n31*n32)/n131 + n44*n58*xF[6]*(pow(alpha, NP0*n0 - n9*n95)*n65*n81*n9/n90 - pow(alpha, n0*n17 - n9*n95)*n21*n27*n50/(n49*n91) + pow(alpha, n0*n17 - n9*n95)*n50*n65*n9/(n49*n91) + n87)/n128 + n89*(pow(alpha, NP0*n0 - n8*n95)*n65*n8*n81/n90 - pow(alpha, n0*n17 - n8*n95)*n21*n26*n50/(n49*n91) + pow(alpha, n0*n17 - n8*n95)*n50*n65*n8/(n49*n91) + n21*n26*n39)/n127 + n44*n60*xF[4]*(pow(alpha, NP0*n0 - n7*n95)*n65*n7*n81/n90 - pow(alpha, n0*n17 - n7*n95)*n21*n25*n50/(n49*n91) + pow(alpha, n0*n17 - n7*n95)*n50*n65*n7/(n49*n91) + n83)/n126 + n44*n59*xF[2]*(pow(alpha, NP0*n0 - n5*n95)*n5*n65*n81/n90 - pow(alpha, n0*n17 - n5*n95)*n21*n23*n50/(n49*n91) + pow(alpha, n0*n17 - n5*n95)*n5*n50*n65/(n49*n91) + n82)/n124 + n44*n78*(pow(alpha, NP0*n0 - n4*n95)*n4*n65*n81/n90 - pow(alpha, n0*n17 - n4*n95)*n21*n22*n50/(n49*n91) + pow(alpha, n0*n17 - n4*n95)*n4*n50*n65/(n49*n91) + n88)/n123) - 0.5*n44*n46*xF[0]*(pow(alpha, NP0*n0 - n0*n95)*n81/(n64*n90) + n32/n64)*(pow(alpha, NP0*n0 - n0*n95)*n0*n31*n81/n90 + n0*n31*n32)/n131 - 0.5*n44*n46*xF[0]*(pow(alpha, NP0*n0 - n0*n95)*n66*n81/n90 + n32*n66)/n122) - n237 - n194*n44*xF[0]/n122, -n13);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n64*(n92 - log(-pow(alpha, NP1*n0)*n81 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[2] - Mstar;
-      g5 = MW[3] - Mstar;
-      g6 = MW[4] - Mstar;
-      g7 = MW[5] - Mstar;
-      g8 = MW[6] - Mstar;
-      g9 = MW[7] - Mstar;
-      g10 = MW[8] - Mstar;
-      g11 = xF[0] - xTj;
-      g12 = xF[0] - xPj;
-      g13 = -xTj;
-      g14 = xPj/xF[1];
-      g15 = pow(alpha, -g1);
-      g16 = pow(alpha, -g0);
-      g17 = pow(alpha, -g4);
-      g18 = pow(alpha, -g5);
-      g19 = pow(alpha, -g6);
-      g20 = pow(alpha, -g7);
-      g21 = pow(alpha, -g8);
-      g22 = pow(alpha, -g9);
-      g23 = pow(alpha, -g10);
-      g24 = log(xF[0]/xF[1]);
-      g25 = -g2;
-      g26 = pow(alpha, NP1*g0);
-      g27 = pow(alpha, NP1*g1);
-      g28 = log(g15);
-      g29 = pow(alpha, NP1*g4);
-      g30 = pow(alpha, NP1*g5);
-      g31 = pow(alpha, NP1*g6);
-      g32 = pow(alpha, NP1*g7);
-      g33 = pow(alpha, NP1*g8);
-      g34 = pow(alpha, NP1*g9);
-      g35 = pow(alpha, NP1*g10);
-      g36 = -g24;
-      g37 = g11/g3;
-      g38 = g3/g11;
-      g39 = -g26 + 1;
-      g40 = -g26 + 1;
-      g41 = -g27 + 1;
-      g42 = -g29 + 1;
-      g43 = -g30 + 1;
-      g44 = -g31 + 1;
-      g45 = -g32 + 1;
-      g46 = -g33 + 1;
-      g47 = -g34 + 1;
-      g48 = -g35 + 1;
-      g49 = -g27;
-      g50 = -g29;
-      g51 = -g30;
-      g52 = -g31;
-      g53 = -g32;
-      g54 = -g33;
-      g55 = -g34;
-      g56 = -g35;
-      g57 = -1.0*g24;
-      g58 = -g3/g12;
-      g59 = g12/(g3*xF[1]);
-      g60 = pow(alpha, g0*g25) - 1;
-      g61 = pow(alpha, g0*g25) - 1;
-      g62 = pow(alpha, g1*g25) - 1;
-      g63 = pow(alpha, g25*g4) - 1;
-      g64 = pow(alpha, g25*g5) - 1;
-      g65 = pow(alpha, g25*g6) - 1;
-      g66 = pow(alpha, g25*g7) - 1;
-      g67 = pow(alpha, g25*g8) - 1;
-      g68 = pow(alpha, g25*g9) - 1;
-      g69 = pow(alpha, g10*g25) - 1;
-      g70 = -pow(alpha, g1*g25);
-      g71 = -pow(alpha, g25*g4);
-      g72 = -pow(alpha, g25*g5);
-      g73 = -pow(alpha, g25*g6);
-      g74 = -pow(alpha, g25*g7);
-      g75 = -pow(alpha, g25*g8);
-      g76 = -pow(alpha, g25*g9);
-      g77 = -pow(alpha, g10*g25);
-      g78 = g40 + g61;
-      g79 = -g27 - g70;
-      g80 = -g29 - g71;
-      g81 = -g30 - g72;
-      g82 = -g31 - g73;
-      g83 = -g32 - g74;
-      g84 = -g33 - g75;
-      g85 = -g34 - g76;
-      g86 = -g35 - g77;
-      g87 = pow(alpha, g1*g25) + g49;
-      g88 = g40 + g61;
-      g89 = pow(alpha, g25*g4) + g50;
-      g90 = pow(alpha, g25*g5) + g51;
-      g91 = pow(alpha, g25*g6) + g52;
-      g92 = pow(alpha, g25*g7) + g53;
-      g93 = pow(alpha, g25*g8) + g54;
-      g94 = pow(alpha, g25*g9) + g55;
-      g95 = pow(alpha, g10*g25) + g56;
-      g96 = xF[8]/g95;
-      g97 = xF[0]/g87;
-      g98 = xF[1]/g88;
-      g99 = xF[2]/g89;
-      g100 = xF[3]/g90;
-      g101 = xF[6]/g93;
-      g102 = xF[7]/g94;
-      g103 = xF[4]/g91;
-      g104 = xF[5]/g92;
-      g105 = xF[1]/g78;
-      g106 = xF[0]/g79;
-      g107 = xF[4]/g82;
-      g108 = xF[5]/g83;
-      g109 = xF[7]/g85;
-      g110 = xF[2]/g80;
-      g111 = xF[3]/g81;
-      g112 = xF[6]/g84;
-      g113 = xF[8]/g86;
-      g114 = g46/g84;
-      g115 = g44/g82;
-      g116 = g47/g85;
-      g117 = g41/g79;
-      g118 = g45/g83;
-      g119 = g43/g81;
-      g120 = g39/g78;
-      g121 = g42/g80;
-      g122 = g48/g86;
-      g123 = g60/g78;
-      g124 = g62/g79;
-      g125 = g66/g83;
-      g126 = g63/g80;
-      g127 = g64/g81;
-      g128 = g65/g82;
-      g129 = g69/g86;
-      g130 = g67/g84;
-      g131 = g68/g85;
-      g132 = log(g13*g59*g88/g40);
-      g133 = log(g13*g59*g78/g39);
-      g134 = log(g14*g37*g88/g61);
-      g135 = 1.0*g132;
-      g136 = log(g14*g37*g78/g60);
-      g137 = 1.0*g134;
-      g138 = -g100*g135*(g51 + 1) - g100*g137*(pow(alpha, g25*g5) - 1) - g101*g135*(g54 + 1) - g101*g137*(pow(alpha, g25*g8) - 1) - g102*g135*(g55 + 1) - g102*g137*(pow(alpha, g25*g9) - 1) - g103*g135*(g52 + 1) - g103*g137*(pow(alpha, g25*g6) - 1) - g104*g135*(g53 + 1) - g104*g137*(pow(alpha, g25*g7) - 1) - g135*g40*g98 - g135*g96*(g56 + 1) - g135*g97*(g49 + 1) - g135*g99*(g50 + 1) - g137*g61*g98 - g137*g96*(pow(alpha, g10*g25) - 1) - g137*g97*(pow(alpha, g1*g25) - 1) - g137*g99*(pow(alpha, g25*g4) - 1) - g57*xF[0] - g57*xF[1] - g57*xF[2] - g57*xF[3] - g57*xF[4] - g57*xF[5] - g57*xF[6] - g57*xF[7] - g57*xF[8];
-      LpF = xF[0]*(g15 + 1.0)*(g117*g133 + g124*g136 + g36)/(g28*(g15 - 1.0)) + xF[1]*(g16 + 1.0)*(g120*g133 + g123*g136 + g36)/(g28*(g16 - 1.0)) + xF[2]*(g17 + 1.0)*(g121*g133 + g126*g136 + g36)/(g28*(g17 - 1.0)) + xF[3]*(g18 + 1.0)*(g119*g133 + g127*g136 + g36)/(g28*(g18 - 1.0)) + xF[4]*(g19 + 1.0)*(g115*g133 + g128*g136 + g36)/(g28*(g19 - 1.0)) + xF[5]*(g20 + 1.0)*(g118*g133 + g125*g136 + g36)/(g28*(g20 - 1.0)) + xF[6]*(g21 + 1.0)*(g114*g133 + g130*g136 + g36)/(g28*(g21 - 1.0)) + xF[7]*(g22 + 1.0)*(g116*g133 + g131*g136 + g36)/(g28*(g22 - 1.0)) + xF[8]*(g23 + 1.0)*(g122*g133 + g129*g136 + g36)/(g28*(g23 - 1.0));
-      PpF = g37;
-      TpF = -g12/g3;
-      SWUpF = g138;
-      SWUpP = g138*g38;
-      xP[0] = g106*g38*g62;
-      xP[1] = g105*g38*g60;
-      xP[2] = g110*g38*g63;
-      xP[3] = g111*g38*g64;
-      xP[4] = g107*g38*g65;
-      xP[5] = g108*g38*g66;
-      xP[6] = g112*g38*g67;
-      xP[7] = g109*g38*g68;
-      xP[8] = g113*g38*g69;
-      xT[0] = g106*g41*g58;
-      xT[1] = g105*g39*g58;
-      xT[2] = g110*g42*g58;
-      xT[3] = g111*g43*g58;
-      xT[4] = g107*g44*g58;
-      xT[5] = g108*g45*g58;
-      xT[6] = g112*g46*g58;
-      xT[7] = g109*g47*g58;
-      xT[8] = g113*g48*g58;
-      break;
-    case 10:
-      n0 = MW[0] - Mstar;
-      n1 = log(alpha);
-      n2 = xPj - xTj;
-      n3 = xF[0] - xPj;
-      n4 = MW[1] - Mstar;
-      n5 = MW[2] - Mstar;
-      n6 = MW[3] - Mstar;
-      n7 = MW[4] - Mstar;
-      n8 = MW[5] - Mstar;
-      n9 = MW[6] - Mstar;
-      n10 = MW[7] - Mstar;
-      n11 = MW[8] - Mstar;
-      n12 = MW[9] - Mstar;
-      n13 = log(xTj);
-      n14 = -2;
-      n15 = xF[0]*xPj;
-      n16 = -Mstar;
-      n17 = -xPj;
-      n18 = -NP0*n14;
-      n19 = -xTj;
-      n20 = -n14*xF[9];
-      n21 = pow(n0, -n14);
-      n22 = pow(n1, -n14);
-      n23 = pow(n4, -n14);
-      n24 = pow(n5, -n14);
-      n25 = pow(n6, -n14);
-      n26 = pow(n7, -n14);
-      n27 = pow(n8, -n14);
-      n28 = pow(n9, -n14);
-      n29 = pow(n10, -n14);
-      n30 = pow(n11, -n14);
-      n31 = pow(n12, -n14);
-      n32 = Mstar*n1;
-      n33 = -n1*n14;
-      n34 = pow(alpha, NP0*n0);
-      n35 = n15 + n19*xF[0];
-      n36 = n15 + n17*xTj;
-      n37 = pow(alpha, NP0*n4);
-      n38 = pow(alpha, NP0*n5);
-      n39 = pow(alpha, NP0*n6);
-      n40 = pow(alpha, NP0*n7);
-      n41 = pow(alpha, NP0*n8);
-      n42 = pow(alpha, NP0*n9);
-      n43 = pow(alpha, NP0*n10);
-      n44 = pow(alpha, NP0*n11);
-      n45 = pow(alpha, NP0*n12);
-      n46 = -MW[0]*n1;
-      n47 = n2/n3;
-      n48 = -n22;
-      n49 = -n34 + 1;
-      n50 = -n37 + 1;
-      n51 = pow(alpha, n0*n18);
-      n52 = pow(n35, -n14);
-      n53 = pow(n36, -n14);
-      n54 = -n38 + 1;
-      n55 = -n39 + 1;
-      n56 = -n40 + 1;
-      n57 = -n41 + 1;
-      n58 = -n42 + 1;
-      n59 = -n43 + 1;
-      n60 = -n44 + 1;
-      n61 = -n45 + 1;
-      n62 = -n34;
-      n63 = -n47;
-      n64 = 1/(n0*n1);
-      n65 = n0*n22;
-      n66 = n57*xF[5];
-      n67 = n61*xF[9];
-      n68 = n55*xF[3];
-      n69 = n38*n5;
-      n70 = n41*n8;
-      n71 = n59*xF[7];
-      n72 = n50*xF[1];
-      n73 = n60*xF[8];
-      n74 = n42*n9;
-      n75 = n39*n6;
-      n76 = n37*n4;
-      n77 = n40*n7;
-      n78 = n58*xF[6];
-      n79 = n10*n43;
-      n80 = n11*n44;
-      n81 = log((-1.0 + xPj/xF[0])/n2);
-      n82 = n1*n12*n45;
-      n83 = n1*n80;
-      n84 = n0*n1*n34;
-      n85 = n1*n79;
-      n86 = n36/n35;
-      n87 = n21*n51;
-      n88 = n22*n24*n38;
-      n89 = n22*n26*n40;
-      n90 = n21*n22*n34;
-      n91 = n22*n30*n44;
-      n92 = n22*n31*n45;
-      n93 = n22*n29*n43;
-      n94 = n22*n25*n39;
-      n95 = n22*n28*n42;
-      n96 = n22*n23*n37;
-      n97 = n62*n86 + 1;
-      n98 = pow(n97, -n14);
-      n99 = n13 + n32 + n46 + n81;
-      n100 = n34*n86/n97;
-      n101 = n64*(n99 - log(n97)) + 1;
-      n102 = pow(alpha, n0*n101);
-      n103 = pow(alpha, n101*n4);
-      n104 = pow(alpha, n101*n5);
-      n105 = pow(alpha, n101*n6);
-      n106 = pow(alpha, n101*n7);
-      n107 = pow(alpha, n101*n8);
-      n108 = pow(alpha, n101*n9);
-      n109 = pow(alpha, n10*n101);
-      n110 = pow(alpha, n101*n11);
-      n111 = pow(alpha, n101*n12);
-      n112 = n4/n103;
-      n113 = n12/n111;
-      n114 = n11/n110;
-      n115 = n7/n106;
-      n116 = n6/n105;
-      n117 = n10/n109;
-      n118 = n9/n108;
-      n119 = n8/n107;
-      n120 = n0/n102;
-      n121 = n5/n104;
-      n122 = n28/n108;
-      n123 = n21/n102;
-      n124 = n24/n104;
-      n125 = n0*n121;
-      n126 = n49 - 1 + 1.0/n102;
-      n127 = n50 - 1 + 1.0/n103;
-      n128 = n54 - 1 + 1.0/n104;
-      n129 = n55 - 1 + 1.0/n105;
-      n130 = n56 - 1 + 1.0/n106;
-      n131 = n57 - 1 + 1.0/n107;
-      n132 = n58 - 1 + 1.0/n108;
-      n133 = n59 - 1 + 1.0/n109;
-      n134 = n60 - 1 + 1.0/n110;
-      n135 = n61 - 1 + 1.0/n111;
-      n136 = pow(n126, -n14);
-      n137 = pow(n127, -n14);
-      n138 = pow(n128, -n14);
-      n139 = pow(n129, -n14);
-      n140 = pow(n130, -n14);
-      n141 = pow(n131, -n14);
-      n142 = pow(n132, -n14);
-      n143 = pow(n133, -n14);
-      n144 = pow(n134, -n14);
-      n145 = pow(n135, -n14);
-      n146 = pow(n126, 3);
-      n147 = pow(n127, 3);
-      n148 = pow(n128, 3);
-      n149 = pow(n129, 3);
-      n150 = pow(n130, 3);
-      n151 = pow(n131, 3);
-      n152 = pow(n132, 3);
-      n153 = pow(n133, 3);
-      n154 = pow(n134, 3);
-      n155 = pow(n135, 3);
-      n156 = xF[2]/n128;
-      n157 = xF[9]/n135;
-      n158 = xF[0]/n126;
-      n159 = xF[8]/n134;
-      n160 = xF[6]/n132;
-      n161 = xF[7]/n133;
-      n162 = xF[1]/n127;
-      n163 = xF[4]/n130;
-      n164 = xF[3]/n129;
-      n165 = xF[0]/n136;
-      n166 = -1/n140;
-      n167 = n1*xF[5]/n131;
-      n168 = n1*n164;
-      n169 = n54/n148;
-      n170 = n54/n138;
-      n171 = n49*xF[0]/n146;
-      n172 = n22*n27*n41*xF[5]/n131;
-      n173 = n0*n1*n158*n47*n62;
-      n174 = n158*n47*n90;
-      n175 = n162*n47*n96;
-      n176 = n156*n47*n88;
-      n177 = n164*n47*n94;
-      n178 = n163*n47*n89;
-      n179 = n172*n47;
-      n180 = n160*n47*n95;
-      n181 = n161*n47*n93;
-      n182 = n159*n47*n91;
-      n183 = n157*n47*n92;
-      n184 = 0.5*n174;
-      n185 = 1 + n86/(n102*n97);
-      n186 = n185*n49;
-      n187 = n84 + n84*n86/(n102*n97);
-      n188 = n1*n100*n112 + n1*n76;
-      n189 = n1*n100*n121 + n1*n69;
-      n190 = n1*n100*n116 + n1*n75;
-      n191 = n1*n100*n115 + n1*n77;
-      n192 = n1*n100*n119 + n1*n70;
-      n193 = n1*n100*n118 + n1*n74;
-      n194 = n1*n100*n117 + n85;
-      n195 = n1*n100*n114 + n83;
-      n196 = n1*n100*n113 + n82;
-      n197 = pow(n187, -n14);
-      n198 = pow(n188, -n14);
-      n199 = pow(n189, -n14);
-      n200 = pow(n190, -n14);
-      n201 = pow(n191, -n14);
-      n202 = pow(n192, -n14);
-      n203 = pow(n193, -n14);
-      n204 = pow(n194, -n14);
-      n205 = pow(n195, -n14);
-      n206 = pow(n196, -n14);
-      n207 = n189*xF[2];
-      n208 = n0*n33*n34 + n100*n120*n33;
-      n209 = n199*xF[2];
-      n210 = n90 + n86*n90/(n102*n97);
-      n211 = n100*n123*n48 + n21*n34*n48;
-      n212 = n187*n49;
-      n213 = n191*n56*xF[4];
-      n214 = n210*n49;
-      n215 = n211*n49;
-      n216 = n192/n141;
-      n217 = n188/n137;
-      n218 = n190/n139;
-      n219 = n194/n143;
-      n220 = n195/n144;
-      n221 = n196/n145;
-      n222 = n204/n153;
-      n223 = n200/n149;
-      n224 = n205/n154;
-      n225 = n193*xF[6]/n142;
-      n226 = n206/n155;
-      n227 = n191*xF[4]/n140;
-      n228 = n198/n147;
-      n229 = n203/n152;
-      n230 = n201*n56*xF[4]/n150;
-      n231 = n165*n212*n47;
-      n232 = n0*n165*n33*n34*n47*(pow(alpha, NP0*n0 - n0*n101)*n0*n1*n86/n97 + n84);
-      n233 = n33*n47*n76*xF[1]*(pow(alpha, NP0*n0 - n101*n4)*n1*n4*n86/n97 + n1*n76)/n137;
-      n234 = n33*n47*n69*xF[2]*(pow(alpha, NP0*n0 - n101*n5)*n1*n5*n86/n97 + n1*n69)/n138;
-      n235 = n33*n47*n75*xF[3]*(pow(alpha, NP0*n0 - n101*n6)*n1*n6*n86/n97 + n1*n75)/n139;
-      n236 = n33*n47*n77*xF[4]*(pow(alpha, NP0*n0 - n101*n7)*n1*n7*n86/n97 + n1*n77)/n140;
-      n237 = n33*n47*n70*xF[5]*(pow(alpha, NP0*n0 - n101*n8)*n1*n8*n86/n97 + n1*n70)/n141;
-      n238 = n33*n47*n74*xF[6]*(pow(alpha, NP0*n0 - n101*n9)*n1*n86*n9/n97 + n1*n74)/n142;
-      n239 = n33*n47*n79*xF[7]*(pow(alpha, NP0*n0 - n10*n101)*n1*n10*n86/n97 + n85)/n143;
-      n240 = n33*n47*n80*xF[8]*(pow(alpha, NP0*n0 - n101*n11)*n1*n11*n86/n97 + n83)/n144;
-      n241 = n20*n47*n82*(pow(alpha, NP0*n0 - n101*n12)*n1*n12*n86/n97 + n82)/n145;
-      n242 = 1.0*n165*n187*n47*n84;
-      n243 = 0.5*n187*n208;
-      n244 = n184 + n242;
-      n245 = n100*n112*n65 + n112*n51*n53*n65/(n52*n98) + n96 + n23*n48*n51*n53/(n103*n52*n98);
-      n246 = n100*n121*n65 + n121*n51*n53*n65/(n52*n98) + n124*n48*n51*n53/(n52*n98) + n88;
-      n247 = n100*n116*n65 + n116*n51*n53*n65/(n52*n98) + n94 + n25*n48*n51*n53/(n105*n52*n98);
-      n248 = n100*n115*n65 + n115*n51*n53*n65/(n52*n98) + n89 + n26*n48*n51*n53/(n106*n52*n98);
-      n249 = n100*n119*n65 + n119*n51*n53*n65/(n52*n98) + n22*n27*n41 + n27*n48*n51*n53/(n107*n52*n98);
-      n250 = n100*n118*n65 + n118*n51*n53*n65/(n52*n98) + n122*n48*n51*n53/(n52*n98) + n95;
-      n251 = n100*n117*n65 + n117*n51*n53*n65/(n52*n98) + n93 + n29*n48*n51*n53/(n109*n52*n98);
-      n252 = n100*n114*n65 + n114*n51*n53*n65/(n52*n98) + n91 + n30*n48*n51*n53/(n110*n52*n98);
-      n253 = n100*n113*n65 + n113*n51*n53*n65/(n52*n98) + n92 + n31*n48*n51*n53/(n111*n52*n98);
-      n254 = n63*n72*(pow(alpha, n0*n18 - n101*n4)*n23*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n4)*n4*n53*n65/(n52*n98) + n100*n112*n65 + n96)/n137;
-      n255 = n63*n68*(pow(alpha, n0*n18 - n101*n6)*n25*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n6)*n53*n6*n65/(n52*n98) + n100*n116*n65 + n94)/n139;
-      n256 = n56*n63*xF[4]*(pow(alpha, n0*n18 - n101*n7)*n26*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n7)*n53*n65*n7/(n52*n98) + n100*n115*n65 + n89)/n140;
-      n257 = n63*n66*(pow(alpha, n0*n18 - n101*n8)*n27*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n8)*n53*n65*n8/(n52*n98) + n100*n119*n65 + n22*n27*n41)/n141;
-      n258 = n63*n71*(pow(alpha, n0*n18 - n10*n101)*n10*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n10*n101)*n29*n48*n53/(n52*n98) + n100*n117*n65 + n93)/n143;
-      n259 = n63*n73*(pow(alpha, n0*n18 - n101*n11)*n11*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n101*n11)*n30*n48*n53/(n52*n98) + n100*n114*n65 + n91)/n144;
-      n260 = n63*n67*(pow(alpha, n0*n18 - n101*n12)*n12*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n101*n12)*n31*n48*n53/(n52*n98) + n100*n113*n65 + n92)/n145;
-      n261 = xTj*(n1*n156*n47*n69 + n1*n160*n47*n74 + n1*n162*n47*n76 + n1*n163*n47*n77 + n157*n47*n82 + n158*n47*n84 + n159*n47*n83 + n161*n47*n85 + n165*n212*n63 + n167*n47*n70 + n168*n47*n75 + n170*n207*n63 + n216*n63*n66 + n217*n63*n72 + n218*n63*n68 + n219*n63*n71 + n220*n63*n73 + n221*n63*n67 + n193*n63*n78/n142 + n213*n63/n140);
-      n262 = n173 + n231 + n261;
-      n263 = n174 + n175 + n176 + n177 + n178 + n179 + n180 + n181 + n182 + n183 + n232 + n233 + n234 + n235 + n236 + n237 + n238 + n239 + n240 + n241 + n254 + n255 + n256 + n257 + n258 + n259 + n260;
-      n264 = n165*n215*n47 + n169*n207*n63*(n100*n121*n33 + n33*n69) + n170*n47*xF[2]*(pow(alpha, n0*n18 - n101*n5)*n0*n48*n5*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n5)*n22*n24*n53/(n52*n98) + n100*n125*n48 + n24*n38*n48) + n171*n187*n208*n63 + n263 + n196*n63*n67*(n100*n113*n33 + n12*n33*n45)/n155 + n195*n63*n73*(n100*n114*n33 + n33*n80)/n154 + n194*n63*n71*(n100*n117*n33 + n33*n79)/n153 + n193*n63*n78*(n100*n118*n33 + n33*n74)/n152 + n192*n63*n66*(n100*n119*n33 + n33*n70)/n151 + n213*n63*(n100*n115*n33 + n33*n77)/n150 + n190*n63*n68*(n100*n116*n33 + n33*n75)/n149 + n188*n63*n72*(n100*n112*n33 + n33*n76)/n147 + n47*n78*(pow(alpha, n0*n18 - n101*n9)*n0*n48*n53*n9/(n52*n98) + pow(alpha, n0*n18 - n101*n9)*n22*n28*n53/(n52*n98) + n0*n100*n118*n48 + n28*n42*n48)/n142;
-      NP_b = -n165*n186*n47*n84 - n173 - n18*(-0.5*n165*n47*n49*(pow(alpha, NP0*n0 - n0*n101)*n21*n22*n86/n97 + n90) + 1.0*n165*n47*n84*(pow(alpha, NP0*n0 - n0*n101)*n0*n1*n86/n97 + n84) - 1.0*n171*n197*n47 + n184 - 0.5*xTj*(n14*n169*n209*n47 + n14*n171*n197*n47 + n14*n222*n47*n71 + n14*n223*n47*n68 + n14*n224*n47*n73 + n14*n226*n47*n67 + n14*n228*n47*n72 + n14*n229*n47*n78 + n14*n230*n47 + n14*n202*n47*n66/n151 + n165*n49*n63*(pow(alpha, NP0*n0 - n0*n101)*n21*n22*n86/n97 + n90) + n170*n63*xF[2]*(pow(alpha, NP0*n0 - n101*n5)*n5*n65*n86/n97 + pow(alpha, n0*n18 - n101*n5)*n24*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n5)*n5*n53*n65/(n52*n98) + n88) + n174 + n175 + n176 + n177 + n178 + n179 + n180 + n181 + n182 + n183 + n232 + n233 + n234 + n235 + n236 + n237 + n238 + n239 + n240 + n241 + n63*n67*(pow(alpha, NP0*n0 - n101*n12)*n12*n65*n86/n97 + pow(alpha, n0*n18 - n101*n12)*n12*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n101*n12)*n31*n48*n53/(n52*n98) + n92)/n145 + n63*n73*(pow(alpha, NP0*n0 - n101*n11)*n11*n65*n86/n97 + pow(alpha, n0*n18 - n101*n11)*n11*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n101*n11)*n30*n48*n53/(n52*n98) + n91)/n144 + n63*n71*(pow(alpha, NP0*n0 - n10*n101)*n10*n65*n86/n97 + pow(alpha, n0*n18 - n10*n101)*n10*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n10*n101)*n29*n48*n53/(n52*n98) + n93)/n143 + n63*n78*(pow(alpha, NP0*n0 - n101*n9)*n65*n86*n9/n97 + pow(alpha, n0*n18 - n101*n9)*n28*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n9)*n53*n65*n9/(n52*n98) + n95)/n142 + n63*n66*(pow(alpha, NP0*n0 - n101*n8)*n65*n8*n86/n97 + pow(alpha, n0*n18 - n101*n8)*n27*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n8)*n53*n65*n8/(n52*n98) + n22*n27*n41)/n141 + n56*n63*xF[4]*(pow(alpha, NP0*n0 - n101*n7)*n65*n7*n86/n97 + pow(alpha, n0*n18 - n101*n7)*n26*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n7)*n53*n65*n7/(n52*n98) + n89)/n140 + n63*n68*(pow(alpha, NP0*n0 - n101*n6)*n6*n65*n86/n97 + pow(alpha, n0*n18 - n101*n6)*n25*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n6)*n53*n6*n65/(n52*n98) + n94)/n139 + n63*n72*(pow(alpha, NP0*n0 - n101*n4)*n4*n65*n86/n97 + pow(alpha, n0*n18 - n101*n4)*n23*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n4)*n4*n53*n65/(n52*n98) + n96)/n137)) - n47*xTj*(n1*n156*n69 + n1*n160*n74 + n1*n162*n76 + n1*n163*n77 + n157*n82 + n158*n84 + n159*n83 + n161*n85 - n165*n212 + n166*n213 + n167*n70 + n168*n75 - n170*n207 - n216*n66 - n217*n72 - n218*n68 - n219*n71 - n220*n73 - n221*n67 - n193*n78/n142);
-      NP_2a = -n47*(n14*n171*pow(n185, -n14)*n48*n87 - 1.0*n158*n90 - 2.0*n165*n185*n22*n87 + n165*n186*n90 + 1.0*xTj*(n0*n165*n33*n34*(pow(alpha, NP0*n0 - n0*n101)*n0*n1*n86/n97 + n84) + n14*n169*n209 + n14*n171*n197 + n14*n222*n71 + n14*n223*n68 + n14*n224*n73 + n14*n226*n67 + n14*n228*n72 + n14*n229*n78 + n14*n230 + n14*n202*n66/n151 + n156*n88 + n157*n92 + n158*n90 + n159*n91 + n160*n95 + n161*n93 + n162*n96 + n163*n89 + n164*n94 - n165*n214 + n166*n56*xF[4]*(pow(alpha, n0*n18 - n101*n7)*n26*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n7)*n53*n65*n7/(n52*n98) + n100*n115*n65 + n89) - n170*xF[2]*(pow(alpha, n0*n18 - n101*n5)*n24*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n5)*n5*n53*n65/(n52*n98) + n100*n121*n65 + n88) + n172 + n20*n82*(pow(alpha, NP0*n0 - n101*n12)*n1*n12*n86/n97 + n82)/n145 - n67*(pow(alpha, n0*n18 - n101*n12)*n12*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n101*n12)*n31*n48*n53/(n52*n98) + n100*n113*n65 + n92)/n145 + n33*n80*xF[8]*(pow(alpha, NP0*n0 - n101*n11)*n1*n11*n86/n97 + n83)/n144 - n73*(pow(alpha, n0*n18 - n101*n11)*n11*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n101*n11)*n30*n48*n53/(n52*n98) + n100*n114*n65 + n91)/n144 + n33*n79*xF[7]*(pow(alpha, NP0*n0 - n10*n101)*n1*n10*n86/n97 + n85)/n143 - n71*(pow(alpha, n0*n18 - n10*n101)*n10*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n10*n101)*n29*n48*n53/(n52*n98) + n100*n117*n65 + n93)/n143 + n33*n74*xF[6]*(pow(alpha, NP0*n0 - n101*n9)*n1*n86*n9/n97 + n1*n74)/n142 - n78*(pow(alpha, n0*n18 - n101*n9)*n28*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n9)*n53*n65*n9/(n52*n98) + n100*n118*n65 + n95)/n142 + n33*n70*xF[5]*(pow(alpha, NP0*n0 - n101*n8)*n1*n8*n86/n97 + n1*n70)/n141 - n66*(pow(alpha, n0*n18 - n101*n8)*n27*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n8)*n53*n65*n8/(n52*n98) + n100*n119*n65 + n22*n27*n41)/n141 + n33*n77*xF[4]*(pow(alpha, NP0*n0 - n101*n7)*n1*n7*n86/n97 + n1*n77)/n140 + n33*n75*xF[3]*(pow(alpha, NP0*n0 - n101*n6)*n1*n6*n86/n97 + n1*n75)/n139 - n68*(pow(alpha, n0*n18 - n101*n6)*n25*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n6)*n53*n6*n65/(n52*n98) + n100*n116*n65 + n94)/n139 + n33*n69*xF[2]*(pow(alpha, NP0*n0 - n101*n5)*n1*n5*n86/n97 + n1*n69)/n138 + n33*n76*xF[1]*(pow(alpha, NP0*n0 - n101*n4)*n1*n4*n86/n97 + n1*n76)/n137 - n72*(pow(alpha, n0*n18 - n101*n4)*n23*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n4)*n4*n53*n65/(n52*n98) + n100*n112*n65 + n96)/n137));
-      NP_sqrt_base = (-NP0*n262 - n19*(-n47*n49*xF[0]/(n49 - 1 + pow(alpha, -n0*(n64*(n99 - log(n36*n62/(n15 - xF[0]*xTj) + 1)) + 1))) - n47*n54*xF[2]/(n54 - 1 + pow(alpha, -n5*(n64*(n99 - log(n36*n62/(n15 - xF[0]*xTj) + 1)) + 1))) - n47*n56*xF[4]/(n56 - 1 + pow(alpha, -n7*(n64*(n99 - log(n36*n62/(n15 - xF[0]*xTj) + 1)) + 1))) - n47*n66/(n57 - 1 + pow(alpha, -n8*(n64*(n99 - log(n36*n62/(n15 - xF[0]*xTj) + 1)) + 1))) - n47*n67/(n61 - 1 + pow(alpha, -n12*(n64*(n99 - log(n36*n62/(n15 - xF[0]*xTj) + 1)) + 1))) - n47*n68/(n55 - 1 + pow(alpha, -n6*(n64*(n99 - log(n36*n62/(n15 - xF[0]*xTj) + 1)) + 1))) - n47*n71/(n59 - 1 + pow(alpha, -n10*(n64*(n99 - log(n36*n62/(n15 - xF[0]*xTj) + 1)) + 1))) - n47*n72/(n50 - 1 + pow(alpha, -n4*(n64*(n99 - log(n36*n62/(n15 - xF[0]*xTj) + 1)) + 1))) - n47*n73/(n60 - 1 + pow(alpha, -n11*(n64*(n99 - log(n36*n62/(n15 - xF[0]*xTj) + 1)) + 1))) - n47*n78/(n58 - 1 + pow(alpha, -n9*(n64*(n99 - log(n36*n62/(n15 - xF[0]*xTj) + 1)) + 1)))) - n49*n63*xF[0]/n126 - pow(NP0, -n14)*(1.0*n165*n187*n47*n84 + 0.5*n165*n215*n47 - n171*n243*n47 + 0.5*n174 - 0.5*n264*xTj))*(-n14*n19*(n165*n47*n49*(pow(alpha, NP0*n0 - n0*n101)*n21*n22*(-n15 + n17*n19)/(n35*n97) + n21*n34*n48) + n169*n63*xF[2]*(pow(alpha, NP0*n0 - n101*n5)*n1*n5*n86/n97 + n1*n69)*(pow(alpha, NP0*n0 - n101*n5)*n33*n5*n86/n97 + n33*n69) + n170*n47*xF[2]*(pow(alpha, NP0*n0 - n101*n5)*n0*n48*n5*n86/n97 + pow(alpha, n0*n18 - n101*n5)*n0*n48*n5*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n5)*n22*n24*n53/(n52*n98) + n24*n38*n48) + n171*n63*(pow(alpha, NP0*n0 - n0*n101)*n0*n1*n86/n97 + n84)*(pow(alpha, NP0*n0 - n0*n101)*n0*n33*n86/n97 + n0*n33*n34) + n174 + n175 + n176 + n177 + n178 + n179 + n180 + n181 + n182 + n183 + n232 + n233 + n234 + n235 + n236 + n237 + n238 + n239 + n240 + n241 + n63*n67*(pow(alpha, NP0*n0 - n101*n12)*n1*n12*n86/n97 + n82)*(pow(alpha, NP0*n0 - n101*n12)*n12*n33*n86/n97 + n12*n33*n45)/n155 + n63*n73*(pow(alpha, NP0*n0 - n101*n11)*n1*n11*n86/n97 + n83)*(pow(alpha, NP0*n0 - n101*n11)*n11*n33*n86/n97 + n33*n80)/n154 + n63*n71*(pow(alpha, NP0*n0 - n10*n101)*n1*n10*n86/n97 + n85)*(pow(alpha, NP0*n0 - n10*n101)*n10*n33*n86/n97 + n33*n79)/n153 + n63*n78*(pow(alpha, NP0*n0 - n101*n9)*n1*n86*n9/n97 + n1*n74)*(pow(alpha, NP0*n0 - n101*n9)*n33*n86*n9/n97 + n33*n74)/n152 + n63*n66*(pow(alpha, NP0*n0 - n101*n8)*n1*n8*n86/n97 + n1*n70)*(pow(alpha, NP0*n0 - n101*n8)*n33*n8*n86/n97 + n33*n70)/n151 + n56*n63*xF[4]*(pow(alpha, NP0*n0 - n101*n7)*n1*n7*n86/n97 + n1*n77)*(pow(alpha, NP0*n0 - n101*n7)*n33*n7*n86/n97 + n33*n77)/n150 + n63*n68*(pow(alpha, NP0*n0 - n101*n6)*n1*n6*n86/n97 + n1*n75)*(pow(alpha, NP0*n0 - n101*n6)*n33*n6*n86/n97 + n33*n75)/n149 + n63*n72*(pow(alpha, NP0*n0 - n101*n4)*n1*n4*n86/n97 + n1*n76)*(pow(alpha, NP0*n0 - n101*n4)*n33*n4*n86/n97 + n33*n76)/n147 + n63*n67*(pow(alpha, NP0*n0 - n101*n12)*n12*n65*n86/n97 + pow(alpha, n0*n18 - n101*n12)*n12*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n101*n12)*n31*n48*n53/(n52*n98) + n92)/n145 + n63*n73*(pow(alpha, NP0*n0 - n101*n11)*n11*n65*n86/n97 + pow(alpha, n0*n18 - n101*n11)*n11*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n101*n11)*n30*n48*n53/(n52*n98) + n91)/n144 + n63*n71*(pow(alpha, NP0*n0 - n10*n101)*n10*n65*n86/n97 + pow(alpha, n0*n18 - n10*n101)*n10*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n10*n101)*n29*n48*n53/(n52*n98) + n93)/n143 + n47*n78*(pow(alpha, NP0*n0 - n101*n9)*n0*n48*n86*n9/n97 + pow(alpha, n0*n18 - n101*n9)*n0*n48*n53*n9/(n52*n98) + pow(alpha, n0*n18 - n101*n9)*n22*n28*n53/(n52*n98) + n28*n42*n48)/n142 + n63*n66*(pow(alpha, NP0*n0 - n101*n8)*n65*n8*n86/n97 + pow(alpha, n0*n18 - n101*n8)*n27*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n8)*n53*n65*n8/(n52*n98) + n22*n27*n41)/n141 + n56*n63*xF[4]*(pow(alpha, NP0*n0 - n101*n7)*n65*n7*n86/n97 + pow(alpha, n0*n18 - n101*n7)*n26*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n7)*n53*n65*n7/(n52*n98) + n89)/n140 + n63*n68*(pow(alpha, NP0*n0 - n101*n6)*n6*n65*n86/n97 + pow(alpha, n0*n18 - n101*n6)*n25*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n6)*n53*n6*n65/(n52*n98) + n94)/n139 + n63*n72*(pow(alpha, NP0*n0 - n101*n4)*n4*n65*n86/n97 + pow(alpha, n0*n18 - n101*n4)*n23*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n4)*n4*n53*n65/(n52*n98) + n96)/n137) + 4.0*n165*n187*n47*n84 + 2.0*n165*n215*n47 - 4.0*n171*n197*n47 + 2.0*n174) + pow(-n18*(0.5*n165*n47*n49*(pow(alpha, NP0*n0 - n0*n101)*n21*n22*(-n15 + n17*n19)/(n35*n97) + n21*n34*n48) + 1.0*n165*n47*n84*(pow(alpha, NP0*n0 - n0*n101)*n0*n1*n86/n97 + n84) - 0.5*n171*n47*(pow(alpha, NP0*n0 - n0*n101)*n0*n1*n86/n97 + n84)*(pow(alpha, NP0*n0 - n0*n101)*n0*n33*n86/n97 + n0*n33*n34) + n184 - 0.5*xTj*(n165*n47*n49*(pow(alpha, NP0*n0 - n0*n101)*n21*n22*(-n15 + n17*n19)/(n35*n97) + n21*n34*n48) + n169*n63*xF[2]*(pow(alpha, NP0*n0 - n101*n5)*n1*n5*n86/n97 + n1*n69)*(pow(alpha, NP0*n0 - n101*n5)*n33*n5*n86/n97 + n33*n69) + n170*n47*xF[2]*(pow(alpha, NP0*n0 - n101*n5)*n0*n48*n5*n86/n97 + pow(alpha, n0*n18 - n101*n5)*n0*n48*n5*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n5)*n22*n24*n53/(n52*n98) + n24*n38*n48) + n171*n63*(pow(alpha, NP0*n0 - n0*n101)*n0*n1*n86/n97 + n84)*(pow(alpha, NP0*n0 - n0*n101)*n0*n33*n86/n97 + n0*n33*n34) + n174 + n175 + n176 + n177 + n178 + n179 + n180 + n181 + n182 + n183 + n232 + n233 + n234 + n235 + n236 + n237 + n238 + n239 + n240 + n241 + n63*n67*(pow(alpha, NP0*n0 - n101*n12)*n1*n12*n86/n97 + n82)*(pow(alpha, NP0*n0 - n101*n12)*n12*n33*n86/n97 + n12*n33*n45)/n155 + n63*n73*(pow(alpha, NP0*n0 - n101*n11)*n1*n11*n86/n97 + n83)*(pow(alpha, NP0*n0 - n101*n11)*n11*n33*n86/n97 + n33*n80)/n154 + n63*n71*(pow(alpha, NP0*n0 - n10*n101)*n1*n10*n86/n97 + n85)*(pow(alpha, NP0*n0 - n10*n101)*n10*n33*n86/n97 + n33*n79)/n153 + n63*n78*(pow(alpha, NP0*n0 - n101*n9)*n1*n86*n9/n97 + n1*n74)*(pow(alpha, NP0*n0 - n101*n9)*n33*n86*n9/n97 + n33*n74)/n152 + n63*n66*(pow(alpha, NP0*n0 - n101*n8)*n1*n8*n86/n97 + n1*n70)*(pow(alpha, NP0*n0 - n101*n8)*n33*n8*n86/n97 + n33*n70)/n151 + n56*n63*xF[4]*(pow(alpha, NP0*n0 - n101*n7)*n1*n7*n86/n97 + n1*n77)*(pow(alpha, NP0*n0 - n101*n7)*n33*n7*n86/n97 + n33*n77)/n150 + n63*n68*(pow(alpha, NP0*n0 - n101*n6)*n1*n6*n86/n97 + n1*n75)*(pow(alpha, NP0*n0 - n101*n6)*n33*n6*n86/n97 + n33*n75)/n149 + n63*n72*(pow(alpha, NP0*n0 - n101*n4)*n1*n4*n86/n97 + n1*n76)*(pow(alpha, NP0*n0 - n101*n4)*n33*n4*n86/n97 + n33*n76)/n147 + n63*n67*(pow(alpha, NP0*n0 - n101*n12)*n12*n65*n86/n97 + pow(alpha, n0*n18 - n101*n12)*n12*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n101*n12)*n31*n48*n53/(n52*n98) + n92)/n145 + n63*n73*(pow(alpha, NP0*n0 - n101*n11)*n11*n65*n86/n97 + pow(alpha, n0*n18 - n101*n11)*n11*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n101*n11)*n30*n48*n53/(n52*n98) + n91)/n144 + n63*n71*(pow(alpha, NP0*n0 - n10*n101)*n10*n65*n86/n97 + pow(alpha, n0*n18 - n10*n101)*n10*n53*n65/(n52*n98) + pow(alpha, n0*n18 - n10*n101)*n29*n48*n53/(n52*n98) + n93)/n143 + n47*n78*(pow(alpha, NP0*n0 - n101*n9)*n0*n48*n86*n9/n97 + pow(alpha, n0*n18 - n101*n9)*n0*n48*n53*n9/(n52*n98) + pow(alpha, n0*n18 - n101*n9)*n22*n28*n53/(n52*n98) + n28*n42*n48)/n142 + n63*n66*(pow(alpha, NP0*n0 - n101*n8)*n65*n8*n86/n97 + pow(alpha, n0*n18 - n101*n8)*n27*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n8)*n53*n65*n8/(n52*n98) + n22*n27*n41)/n141 + n56*n63*xF[4]*(pow(alpha, NP0*n0 - n101*n7)*n65*n7*n86/n97 + pow(alpha, n0*n18 - n101*n7)*n26*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n7)*n53*n65*n7/(n52*n98) + n89)/n140 + n63*n68*(pow(alpha, NP0*n0 - n101*n6)*n6*n65*n86/n97 + pow(alpha, n0*n18 - n101*n6)*n25*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n6)*n53*n6*n65/(n52*n98) + n94)/n139 + n63*n72*(pow(alpha, NP0*n0 - n101*n4)*n4*n65*n86/n97 + pow(alpha, n0*n18 - n101*n4)*n23*n48*n53/(n52*n98) + pow(alpha, n0*n18 - n101*n4)*n4*n53*n65/(n52*n98) + n96)/n137)) - n262, -n14);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n64*(n99 - log(-pow(alpha, NP1*n0)*n86 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[2] - Mstar;
-      g5 = MW[3] - Mstar;
-      g6 = MW[4] - Mstar;
-      g7 = MW[5] - Mstar;
-      g8 = MW[6] - Mstar;
-      g9 = MW[7] - Mstar;
-      g10 = MW[8] - Mstar;
-      g11 = MW[9] - Mstar;
-      g12 = xF[0] - xTj;
-      g13 = xF[0] - xPj;
-      g14 = -xTj;
-      g15 = xPj/xF[1];
-      g16 = pow(alpha, -g1);
-      g17 = pow(alpha, -g0);
-      g18 = pow(alpha, -g4);
-      g19 = pow(alpha, -g5);
-      g20 = pow(alpha, -g6);
-      g21 = pow(alpha, -g7);
-      g22 = pow(alpha, -g8);
-      g23 = pow(alpha, -g9);
-      g24 = pow(alpha, -g10);
-      g25 = pow(alpha, -g11);
-      g26 = log(xF[0]/xF[1]);
-      g27 = -g2;
-      g28 = pow(alpha, NP1*g0);
-      g29 = pow(alpha, NP1*g1);
-      g30 = log(g16);
-      g31 = pow(alpha, NP1*g4);
-      g32 = pow(alpha, NP1*g5);
-      g33 = pow(alpha, NP1*g6);
-      g34 = pow(alpha, NP1*g7);
-      g35 = pow(alpha, NP1*g8);
-      g36 = pow(alpha, NP1*g9);
-      g37 = pow(alpha, NP1*g10);
-      g38 = pow(alpha, NP1*g11);
-      g39 = -g26;
-      g40 = g12/g3;
-      g41 = g3/g12;
-      g42 = -g28 + 1;
-      g43 = -g28 + 1;
-      g44 = -g29 + 1;
-      g45 = -g31 + 1;
-      g46 = -g32 + 1;
-      g47 = -g33 + 1;
-      g48 = -g34 + 1;
-      g49 = -g35 + 1;
-      g50 = -g36 + 1;
-      g51 = -g37 + 1;
-      g52 = -g38 + 1;
-      g53 = -g29;
-      g54 = -g31;
-      g55 = -g32;
-      g56 = -g33;
-      g57 = -g34;
-      g58 = -g35;
-      g59 = -g36;
-      g60 = -g37;
-      g61 = -g38;
-      g62 = -1.0*g26;
-      g63 = -g3/g13;
-      g64 = g13/(g3*xF[1]);
-      g65 = pow(alpha, g0*g27) - 1;
-      g66 = pow(alpha, g0*g27) - 1;
-      g67 = pow(alpha, g1*g27) - 1;
-      g68 = pow(alpha, g27*g4) - 1;
-      g69 = pow(alpha, g27*g5) - 1;
-      g70 = pow(alpha, g27*g6) - 1;
-      g71 = pow(alpha, g27*g7) - 1;
-      g72 = pow(alpha, g27*g8) - 1;
-      g73 = pow(alpha, g27*g9) - 1;
-      g74 = pow(alpha, g10*g27) - 1;
-      g75 = pow(alpha, g11*g27) - 1;
-      g76 = -pow(alpha, g1*g27);
-      g77 = -pow(alpha, g27*g4);
-      g78 = -pow(alpha, g27*g5);
-      g79 = -pow(alpha, g27*g6);
-      g80 = -pow(alpha, g27*g7);
-      g81 = -pow(alpha, g27*g8);
-      g82 = -pow(alpha, g27*g9);
-      g83 = -pow(alpha, g10*g27);
-      g84 = -pow(alpha, g11*g27);
-      g85 = g43 + g66;
-      g86 = -g29 - g76;
-      g87 = -g31 - g77;
-      g88 = -g32 - g78;
-      g89 = -g33 - g79;
-      g90 = -g34 - g80;
-      g91 = -g35 - g81;
-      g92 = -g36 - g82;
-      g93 = -g37 - g83;
-      g94 = -g38 - g84;
-      g95 = pow(alpha, g1*g27) + g53;
-      g96 = g43 + g66;
-      g97 = pow(alpha, g27*g4) + g54;
-      g98 = pow(alpha, g27*g5) + g55;
-      g99 = pow(alpha, g27*g6) + g56;
-      g100 = pow(alpha, g27*g7) + g57;
-      g101 = pow(alpha, g27*g8) + g58;
-      g102 = pow(alpha, g27*g9) + g59;
-      g103 = pow(alpha, g10*g27) + g60;
-      g104 = pow(alpha, g11*g27) + g61;
-      g105 = xF[9]/g104;
-      g106 = xF[8]/g103;
-      g107 = xF[1]/g96;
-      g108 = xF[2]/g97;
-      g109 = xF[3]/g98;
-      g110 = xF[6]/g101;
-      g111 = xF[7]/g102;
-      g112 = xF[4]/g99;
-      g113 = xF[5]/g100;
-      g114 = xF[0]/g95;
-      g115 = xF[1]/g85;
-      g116 = xF[0]/g86;
-      g117 = xF[9]/g94;
-      g118 = xF[4]/g89;
-      g119 = xF[5]/g90;
-      g120 = xF[7]/g92;
-      g121 = xF[2]/g87;
-      g122 = xF[3]/g88;
-      g123 = xF[6]/g91;
-      g124 = xF[8]/g93;
-      g125 = g49/g91;
-      g126 = g52/g94;
-      g127 = g47/g89;
-      g128 = g50/g92;
-      g129 = g44/g86;
-      g130 = g48/g90;
-      g131 = g46/g88;
-      g132 = g42/g85;
-      g133 = g45/g87;
-      g134 = g51/g93;
-      g135 = g65/g85;
-      g136 = g67/g86;
-      g137 = g71/g90;
-      g138 = g68/g87;
-      g139 = g69/g88;
-      g140 = g70/g89;
-      g141 = g74/g93;
-      g142 = g75/g94;
-      g143 = g72/g91;
-      g144 = g73/g92;
-      g145 = log(g14*g64*g96/g43);
-      g146 = log(g14*g64*g85/g42);
-      g147 = log(g15*g40*g96/g66);
-      g148 = 1.0*g145;
-      g149 = log(g15*g40*g85/g65);
-      g150 = 1.0*g147;
-      g151 = -g105*g148*(g61 + 1) - g105*g150*(pow(alpha, g11*g27) - 1) - g106*g148*(g60 + 1) - g106*g150*(pow(alpha, g10*g27) - 1) - g107*g148*g43 - g107*g150*g66 - g108*g148*(g54 + 1) - g108*g150*(pow(alpha, g27*g4) - 1) - g109*g148*(g55 + 1) - g109*g150*(pow(alpha, g27*g5) - 1) - g110*g148*(g58 + 1) - g110*g150*(pow(alpha, g27*g8) - 1) - g111*g148*(g59 + 1) - g111*g150*(pow(alpha, g27*g9) - 1) - g112*g148*(g56 + 1) - g112*g150*(pow(alpha, g27*g6) - 1) - g113*g148*(g57 + 1) - g113*g150*(pow(alpha, g27*g7) - 1) - g114*g148*(g53 + 1) - g114*g150*(pow(alpha, g1*g27) - 1) - g62*xF[0] - g62*xF[1] - g62*xF[2] - g62*xF[3] - g62*xF[4] - g62*xF[5] - g62*xF[6] - g62*xF[7] - g62*xF[8] - g62*xF[9];
-      LpF = xF[0]*(g16 + 1.0)*(g129*g146 + g136*g149 + g39)/(g30*(g16 - 1.0)) + xF[1]*(g17 + 1.0)*(g132*g146 + g135*g149 + g39)/(g30*(g17 - 1.0)) + xF[2]*(g18 + 1.0)*(g133*g146 + g138*g149 + g39)/(g30*(g18 - 1.0)) + xF[3]*(g19 + 1.0)*(g131*g146 + g139*g149 + g39)/(g30*(g19 - 1.0)) + xF[4]*(g20 + 1.0)*(g127*g146 + g140*g149 + g39)/(g30*(g20 - 1.0)) + xF[5]*(g21 + 1.0)*(g130*g146 + g137*g149 + g39)/(g30*(g21 - 1.0)) + xF[6]*(g22 + 1.0)*(g125*g146 + g143*g149 + g39)/(g30*(g22 - 1.0)) + xF[7]*(g23 + 1.0)*(g128*g146 + g144*g149 + g39)/(g30*(g23 - 1.0)) + xF[8]*(g24 + 1.0)*(g134*g146 + g141*g149 + g39)/(g30*(g24 - 1.0)) + xF[9]*(g25 + 1.0)*(g126*g146 + g142*g149 + g39)/(g30*(g25 - 1.0));
-      PpF = g40;
-      TpF = -g13/g3;
-      SWUpF = g151;
-      SWUpP = g151*g41;
-      xP[0] = g116*g41*g67;
-      xP[1] = g115*g41*g65;
-      xP[2] = g121*g41*g68;
-      xP[3] = g122*g41*g69;
-      xP[4] = g118*g41*g70;
-      xP[5] = g119*g41*g71;
-      xP[6] = g123*g41*g72;
-      xP[7] = g120*g41*g73;
-      xP[8] = g124*g41*g74;
-      xP[9] = g117*g41*g75;
-      xT[0] = g116*g44*g63;
-      xT[1] = g115*g42*g63;
-      xT[2] = g121*g45*g63;
-      xT[3] = g122*g46*g63;
-      xT[4] = g118*g47*g63;
-      xT[5] = g119*g48*g63;
-      xT[6] = g123*g49*g63;
-      xT[7] = g120*g50*g63;
-      xT[8] = g124*g51*g63;
-      xT[9] = g117*g52*g63;
-      break;
-    case 11:
-      n0 = MW[0] - Mstar;
-      n1 = log(alpha);
-      n2 = xPj - xTj;
-      n3 = xF[0] - xPj;
-      n4 = MW[10] - Mstar;
-      n5 = MW[1] - Mstar;
-      n6 = MW[2] - Mstar;
-      n7 = MW[3] - Mstar;
-      n8 = MW[4] - Mstar;
-      n9 = MW[5] - Mstar;
-      n10 = MW[6] - Mstar;
-      n11 = MW[7] - Mstar;
-      n12 = MW[8] - Mstar;
-      n13 = MW[9] - Mstar;
-      n14 = log(xTj);
-      n15 = -2;
-      n16 = xF[0]*xPj;
-      n17 = -Mstar;
-      n18 = -xPj;
-      n19 = -NP0*n15;
-      n20 = -xTj;
-      n21 = pow(n0, -n15);
-      n22 = pow(n1, -n15);
-      n23 = pow(n4, -n15);
-      n24 = pow(n5, -n15);
-      n25 = pow(n6, -n15);
-      n26 = pow(n7, -n15);
-      n27 = pow(n8, -n15);
-      n28 = pow(n9, -n15);
-      n29 = pow(n10, -n15);
-      n30 = pow(n11, -n15);
-      n31 = pow(n12, -n15);
-      n32 = pow(n13, -n15);
-      n33 = Mstar*n1;
-      n34 = -n1*n15;
-      n35 = n1*xF[0];
-      n36 = pow(alpha, NP0*n0);
-      n37 = n16 + n20*xF[0];
-      n38 = n16 + n18*xTj;
-      n39 = pow(alpha, NP0*n4);
-      n40 = pow(alpha, NP0*n5);
-      n41 = pow(alpha, NP0*n6);
-      n42 = pow(alpha, NP0*n7);
-      n43 = pow(alpha, NP0*n8);
-      n44 = pow(alpha, NP0*n9);
-      n45 = pow(alpha, NP0*n10);
-      n46 = pow(alpha, NP0*n11);
-      n47 = pow(alpha, NP0*n12);
-      n48 = pow(alpha, NP0*n13);
-      n49 = -MW[0]*n1;
-      n50 = n2/n3;
-      n51 = -n22;
-      n52 = n1*n11;
-      n53 = n1*n9;
-      n54 = n1*n8;
-      n55 = -n36 + 1;
-      n56 = -n39 + 1;
-      n57 = pow(alpha, n0*n19);
-      n58 = pow(n37, -n15);
-      n59 = pow(n38, -n15);
-      n60 = -n40 + 1;
-      n61 = -n41 + 1;
-      n62 = -n42 + 1;
-      n63 = -n43 + 1;
-      n64 = -n44 + 1;
-      n65 = -n45 + 1;
-      n66 = -n46 + 1;
-      n67 = -n47 + 1;
-      n68 = -n48 + 1;
-      n69 = -n56;
-      n70 = -n36;
-      n71 = -n50;
-      n72 = n0*n22;
-      n73 = 1/(n0*n1);
-      n74 = n64*xF[5];
-      n75 = n55*xF[0];
-      n76 = n41*n6;
-      n77 = n65*xF[6];
-      n78 = n12*n47;
-      n79 = n67*xF[8];
-      n80 = n39*n4;
-      n81 = n10*n45;
-      n82 = n42*n7;
-      n83 = n61*xF[2];
-      n84 = n40*n5;
-      n85 = n0*n36;
-      n86 = n11*n46;
-      n87 = n60*xF[1];
-      n88 = n22*n30;
-      n89 = n56*xF[10];
-      n90 = n44*n9;
-      n91 = log((-1.0 + xPj/xF[0])/n2);
-      n92 = n23*n39;
-      n93 = n1*n13*n48;
-      n94 = n38/n37;
-      n95 = n21*n57;
-      n96 = n22*n27*n43;
-      n97 = n21*n22*n36;
-      n98 = n22*n25*n41;
-      n99 = n22*n32*n48;
-      n100 = n22*n26*n42;
-      n101 = n22*n29*n45;
-      n102 = n22*n24*n40;
-      n103 = n50*n78*xF[8];
-      n104 = n70*n94 + 1;
-      n105 = pow(n104, -n15);
-      n106 = n14 + n33 + n49 + n91;
-      n107 = n36*n94/n104;
-      n108 = n57*n59/(n105*n58);
-      n109 = n108*n22;
-      n110 = n73*(n106 - log(n104)) + 1;
-      n111 = pow(alpha, n0*n110);
-      n112 = pow(alpha, n110*n4);
-      n113 = pow(alpha, n110*n5);
-      n114 = pow(alpha, n110*n6);
-      n115 = pow(alpha, n110*n7);
-      n116 = pow(alpha, n110*n8);
-      n117 = pow(alpha, n110*n9);
-      n118 = pow(alpha, n10*n110);
-      n119 = pow(alpha, n11*n110);
-      n120 = pow(alpha, n110*n12);
-      n121 = pow(alpha, n110*n13);
-      n122 = n5/n113;
-      n123 = n13/n121;
-      n124 = n12/n120;
-      n125 = n7/n115;
-      n126 = n4/n112;
-      n127 = n11/n119;
-      n128 = n10/n118;
-      n129 = n8/n116;
-      n130 = n9/n117;
-      n131 = n6/n114;
-      n132 = n23/n112;
-      n133 = n32/n121;
-      n134 = n0*n131;
-      n135 = n55 - 1 + 1.0/n111;
-      n136 = n56 - 1 + 1.0/n112;
-      n137 = n60 - 1 + 1.0/n113;
-      n138 = n61 - 1 + 1.0/n114;
-      n139 = n62 - 1 + 1.0/n115;
-      n140 = n63 - 1 + 1.0/n116;
-      n141 = n64 - 1 + 1.0/n117;
-      n142 = n65 - 1 + 1.0/n118;
-      n143 = n66 - 1 + 1.0/n119;
-      n144 = n67 - 1 + 1.0/n120;
-      n145 = n68 - 1 + 1.0/n121;
-      n146 = pow(n135, -n15);
-      n147 = pow(n136, -n15);
-      n148 = pow(n137, -n15);
-      n149 = pow(n138, -n15);
-      n150 = pow(n139, -n15);
-      n151 = pow(n140, -n15);
-      n152 = pow(n141, -n15);
-      n153 = pow(n142, -n15);
-      n154 = pow(n143, -n15);
-      n155 = pow(n144, -n15);
-      n156 = pow(n145, -n15);
-      n157 = pow(n135, 3);
-      n158 = pow(n136, 3);
-      n159 = pow(n137, 3);
-      n160 = pow(n138, 3);
-      n161 = pow(n139, 3);
-      n162 = pow(n140, 3);
-      n163 = pow(n141, 3);
-      n164 = pow(n142, 3);
-      n165 = pow(n143, 3);
-      n166 = pow(n144, 3);
-      n167 = pow(n145, 3);
-      n168 = xF[9]/n145;
-      n169 = xF[0]/n135;
-      n170 = xF[2]/n138;
-      n171 = xF[6]/n142;
-      n172 = xF[1]/n137;
-      n173 = xF[4]/n140;
-      n174 = xF[10]/n136;
-      n175 = xF[3]/n139;
-      n176 = n1/n144;
-      n177 = -1/n151;
-      n178 = n1*n175;
-      n179 = n46*xF[7]/n143;
-      n180 = n68*xF[9]/n167;
-      n181 = n62*xF[3]/n150;
-      n182 = n66*xF[7]/n165;
-      n183 = n66*xF[7]/n154;
-      n184 = n68*xF[9]/n156;
-      n185 = n44*n53*xF[5]/n141;
-      n186 = 1/(n104*n111);
-      n187 = n22*n31*n47*xF[8]/n144;
-      n188 = n22*n28*n44*xF[5]/n141;
-      n189 = n35*n50*n85/n135;
-      n190 = n0*n35*n50*n70/n135;
-      n191 = n169*n50*n97;
-      n192 = n174*n22*n50*n92;
-      n193 = n102*n172*n50;
-      n194 = n170*n50*n98;
-      n195 = n100*n175*n50;
-      n196 = n173*n50*n96;
-      n197 = n188*n50;
-      n198 = n101*n171*n50;
-      n199 = n179*n50*n88;
-      n200 = n187*n50;
-      n201 = n168*n50*n99;
-      n202 = 0.5*n191;
-      n203 = n186*n94 + 1;
-      n204 = n1*n186*n85*n94 + n1*n85;
-      n205 = n1*n107*n126 + n1*n80;
-      n206 = n1*n107*n122 + n1*n84;
-      n207 = n1*n107*n131 + n1*n76;
-      n208 = n1*n107*n125 + n1*n82;
-      n209 = n107*n54/n116 + n43*n54;
-      n210 = n107*n53/n117 + n44*n53;
-      n211 = n1*n107*n128 + n1*n81;
-      n212 = n107*n52/n119 + n46*n52;
-      n213 = n1*n107*n124 + n1*n78;
-      n214 = n1*n107*n123 + n93;
-      n215 = pow(n204, -n15);
-      n216 = pow(n205, -n15);
-      n217 = pow(n206, -n15);
-      n218 = pow(n207, -n15);
-      n219 = pow(n208, -n15);
-      n220 = pow(n209, -n15);
-      n221 = pow(n210, -n15);
-      n222 = pow(n211, -n15);
-      n223 = pow(n212, -n15);
-      n224 = pow(n213, -n15);
-      n225 = pow(n214, -n15);
-      n226 = n186*n34*n85*n94 + n34*n85;
-      n227 = n107*n21*n51/n111 + n21*n36*n51;
-      n228 = n209*n63*xF[4];
-      n229 = n203/n146;
-      n230 = n210/n152;
-      n231 = n213/n155;
-      n232 = n204/n146;
-      n233 = n211/n153;
-      n234 = n206/n148;
-      n235 = n207/n149;
-      n236 = n215/n157;
-      n237 = n205*xF[10]/n147;
-      n238 = n224/n166;
-      n239 = n218/n160;
-      n240 = n217/n159;
-      n241 = n227/n146;
-      n242 = n219*n62*xF[3]/n161;
-      n243 = n220*n63*xF[4]/n162;
-      n244 = n232*n71*n75;
-      n245 = n34*n50*n85*xF[0]*(pow(alpha, NP0*n0 - n0*n110)*n0*n1*n94/n104 + n1*n85)/n146;
-      n246 = n34*n50*n80*xF[10]*(pow(alpha, NP0*n0 - n110*n4)*n1*n4*n94/n104 + n1*n80)/n147;
-      n247 = n34*n50*n84*xF[1]*(pow(alpha, NP0*n0 - n110*n5)*n1*n5*n94/n104 + n1*n84)/n148;
-      n248 = n34*n50*n76*xF[2]*(pow(alpha, NP0*n0 - n110*n6)*n1*n6*n94/n104 + n1*n76)/n149;
-      n249 = n34*n50*n82*xF[3]*(pow(alpha, NP0*n0 - n110*n7)*n1*n7*n94/n104 + n1*n82)/n150;
-      n250 = n34*n43*n50*n8*xF[4]*(pow(alpha, NP0*n0 - n110*n8)*n54*n94/n104 + n43*n54)/n151;
-      n251 = n34*n50*n90*xF[5]*(pow(alpha, NP0*n0 - n110*n9)*n53*n94/n104 + n44*n53)/n152;
-      n252 = n34*n50*n81*xF[6]*(pow(alpha, NP0*n0 - n10*n110)*n1*n10*n94/n104 + n1*n81)/n153;
-      n253 = n34*n50*n86*xF[7]*(pow(alpha, NP0*n0 - n11*n110)*n52*n94/n104 + n46*n52)/n154;
-      n254 = n103*n34*(pow(alpha, NP0*n0 - n110*n12)*n1*n12*n94/n104 + n1*n78)/n155;
-      n255 = n13*n34*n48*n50*xF[9]*(pow(alpha, NP0*n0 - n110*n13)*n1*n13*n94/n104 + n93)/n156;
-      n256 = 1.0*n35*n50*n85*(pow(alpha, NP0*n0 - n0*n110)*n0*n1*n94/n104 + n1*n85)/n146;
-      n257 = n241*n50*n75;
-      n258 = 0.5*n257;
-      n259 = n189 + n244;
-      n260 = n204*n226/n157;
-      n261 = n107*n126*n72 + n108*n126*n72 + n108*n132*n51 + n22*n92;
-      n262 = n102 + n107*n122*n72 + n108*n122*n72 + n108*n24*n51/n113;
-      n263 = n108*n134*n51 + n109*n25/n114 + n25*n41*n51 + n131*n51*n85*n94/n104;
-      n264 = n107*n129*n72 + n108*n129*n72 + n108*n27*n51/n116 + n96;
-      n265 = n107*n130*n72 + n108*n130*n72 + n108*n28*n51/n117 + n22*n28*n44;
-      n266 = n0*n108*n128*n51 + n109*n29/n118 + n29*n45*n51 + n128*n51*n85*n94/n104;
-      n267 = n107*n124*n72 + n108*n124*n72 + n108*n31*n51/n120 + n22*n31*n47;
-      n268 = n50*n83*(pow(alpha, n0*n19 - n110*n6)*n0*n51*n59*n6/(n105*n58) + pow(alpha, n0*n19 - n110*n6)*n22*n25*n59/(n105*n58) + n25*n41*n51 + n131*n51*n85*n94/n104)/n149;
-      n269 = n50*n77*(pow(alpha, n0*n19 - n10*n110)*n0*n10*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n10*n110)*n22*n29*n59/(n105*n58) + n29*n45*n51 + n128*n51*n85*n94/n104)/n153;
-      n270 = n71*n87*(pow(alpha, n0*n19 - n110*n5)*n24*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n5)*n5*n59*n72/(n105*n58) + n102 + n107*n122*n72)/n148;
-      n271 = n181*n71*(pow(alpha, n0*n19 - n110*n7)*n26*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n7)*n59*n7*n72/(n105*n58) + n100 + n107*n125*n72);
-      n272 = n63*n71*xF[4]*(pow(alpha, n0*n19 - n110*n8)*n27*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n8)*n59*n72*n8/(n105*n58) + n107*n129*n72 + n96)/n151;
-      n273 = n71*n74*(pow(alpha, n0*n19 - n110*n9)*n28*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n9)*n59*n72*n9/(n105*n58) + n107*n130*n72 + n22*n28*n44)/n152;
-      n274 = n183*n71*(pow(alpha, n0*n19 - n11*n110)*n11*n59*n72/(n105*n58) + pow(alpha, n0*n19 - n11*n110)*n30*n51*n59/(n105*n58) + n107*n127*n72 + n46*n88);
-      n275 = n71*n79*(pow(alpha, n0*n19 - n110*n12)*n12*n59*n72/(n105*n58) + pow(alpha, n0*n19 - n110*n12)*n31*n51*n59/(n105*n58) + n107*n124*n72 + n22*n31*n47)/n155;
-      n276 = n202 + n256 + n258;
-      n277 = n1*n170*n50*n76 + n1*n171*n50*n81 + n1*n172*n50*n84 + n1*n174*n50*n80 + n103*n176 + n168*n50*n93 + n173*n43*n50*n54 + n178*n50*n82 + n179*n50*n52 + n181*n208*n71 + n183*n212*n71 + n184*n214*n71 + n185*n50 + n230*n71*n74 + n231*n71*n79 + n233*n71*n77 + n234*n71*n87 + n235*n71*n83 + n237*n50*n69 + n259 + n228*n71/n151;
-      n278 = n191 + n192 + n193 + n194 + n195 + n196 + n197 + n198 + n199 + n200 + n201 + n245 + n246 + n247 + n248 + n249 + n250 + n251 + n252 + n253 + n254 + n255 + n257 + n268 + n269 + n270 + n271 + n272 + n273 + n274 + n275;
-      n279 = n180*n214*n71*(n107*n123*n34 + n13*n34*n48) + n182*n212*n71*(n107*n127*n34 + n34*n86) + n184*n50*(pow(alpha, n0*n19 - n110*n13)*n0*n13*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n13)*n22*n32*n59/(n105*n58) + n32*n48*n51 + n123*n51*n85*n94/n104) + n260*n71*n75 + n278 + n213*n71*n79*(n107*n124*n34 + n34*n78)/n166 + n211*n71*n77*(n107*n128*n34 + n34*n81)/n164 + n210*n71*n74*(n107*n130*n34 + n34*n90)/n163 + n228*n71*(n107*n129*n34 + n34*n43*n8)/n162 + n208*n62*n71*xF[3]*(n107*n125*n34 + n34*n82)/n161 + n207*n71*n83*(n107*n131*n34 + n34*n76)/n160 + n206*n71*n87*(n107*n122*n34 + n34*n84)/n159 + n205*n50*n69*xF[10]*(n107*n126*n34 + n34*n80)/n158 + n50*n89*(pow(alpha, n0*n19 - n110*n4)*n0*n4*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n4)*n22*n23*n59/(n105*n58) + n51*n92 + n126*n51*n85*n94/n104)/n147;
-      NP_b = -n19*(n202 - 1.0*n236*n50*n75 + n256 - 0.5*xTj*(n15*n180*n225*n50 + n15*n182*n223*n50 + n15*n236*n50*n75 + n15*n238*n50*n79 + n15*n239*n50*n83 + n15*n240*n50*n87 + n15*n242*n50 + n15*n243*n50 + n15*n222*n50*n77/n164 + n15*n221*n50*n74/n163 + n15*n216*n50*n89/n158 + n181*n71*(pow(alpha, NP0*n0 - n110*n7)*n7*n72*n94/n104 + pow(alpha, n0*n19 - n110*n7)*n26*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n7)*n59*n7*n72/(n105*n58) + n100) + n183*n71*(pow(alpha, NP0*n0 - n11*n110)*n11*n72*n94/n104 + pow(alpha, n0*n19 - n11*n110)*n11*n59*n72/(n105*n58) + pow(alpha, n0*n19 - n11*n110)*n30*n51*n59/(n105*n58) + n46*n88) + n184*n71*(pow(alpha, NP0*n0 - n110*n13)*n13*n72*n94/n104 + pow(alpha, n0*n19 - n110*n13)*n13*n59*n72/(n105*n58) + pow(alpha, n0*n19 - n110*n13)*n32*n51*n59/(n105*n58) + n99) + n191 + n192 + n193 + n194 + n195 + n196 + n197 + n198 + n199 + n200 + n201 + n245 + n246 + n247 + n248 + n249 + n250 + n251 + n252 + n253 + n254 + n255 + n71*n79*(pow(alpha, NP0*n0 - n110*n12)*n12*n72*n94/n104 + pow(alpha, n0*n19 - n110*n12)*n12*n59*n72/(n105*n58) + pow(alpha, n0*n19 - n110*n12)*n31*n51*n59/(n105*n58) + n22*n31*n47)/n155 + n50*n77*(pow(alpha, NP0*n0 - n10*n110)*n0*n10*n51*n94/n104 + pow(alpha, n0*n19 - n10*n110)*n0*n10*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n10*n110)*n22*n29*n59/(n105*n58) + n29*n45*n51)/n153 + n71*n74*(pow(alpha, NP0*n0 - n110*n9)*n72*n9*n94/n104 + pow(alpha, n0*n19 - n110*n9)*n28*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n9)*n59*n72*n9/(n105*n58) + n22*n28*n44)/n152 + n63*n71*xF[4]*(pow(alpha, NP0*n0 - n110*n8)*n72*n8*n94/n104 + pow(alpha, n0*n19 - n110*n8)*n27*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n8)*n59*n72*n8/(n105*n58) + n96)/n151 + n50*n83*(pow(alpha, NP0*n0 - n110*n6)*n0*n51*n6*n94/n104 + pow(alpha, n0*n19 - n110*n6)*n0*n51*n59*n6/(n105*n58) + pow(alpha, n0*n19 - n110*n6)*n22*n25*n59/(n105*n58) + n25*n41*n51)/n149 + n71*n87*(pow(alpha, NP0*n0 - n110*n5)*n5*n72*n94/n104 + pow(alpha, n0*n19 - n110*n5)*n24*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n5)*n5*n59*n72/(n105*n58) + n102)/n148 + n50*n69*xF[10]*(pow(alpha, NP0*n0 - n110*n4)*n4*n72*n94/n104 + pow(alpha, n0*n19 - n110*n4)*n23*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n4)*n4*n59*n72/(n105*n58) + n22*n92)/n147 + n50*n75*(pow(alpha, NP0*n0 - n0*n110)*n21*n22*(-n16 + n18*n20)/(n104*n37) + n21*n36*n51)/n146) + 0.5*n50*n75*(pow(alpha, NP0*n0 - n0*n110)*n21*n22*(-n16 + n18*n20)/(n104*n37) + n21*n36*n51)/n146) - n190 - n229*n35*n50*n55*n85 - n50*xTj*(n1*n170*n76 + n1*n171*n81 + n1*n172*n84 + n1*n174*n80 + n168*n93 + n173*n43*n54 + n176*n78*xF[8] + n177*n228 + n178*n82 + n179*n52 - n181*n208 - n183*n212 - n184*n214 + n185 - n230*n74 - n231*n79 - n232*n75 - n233*n77 - n234*n87 - n235*n83 + n237*n69 + n35*n85/n135);
-      NP_2a = -n50*(n15*pow(n203, -n15)*n51*n75*n95/n157 - 1.0*n169*n97 - 2.0*n22*n229*n95*xF[0] + 1.0*xTj*(n100*n175 + n101*n171 + n102*n172 + n13*n34*n48*xF[9]*(pow(alpha, NP0*n0 - n110*n13)*n1*n13*n94/n104 + n93)/n156 + n15*n180*n225 + n15*n182*n223 + n15*n236*n75 + n15*n238*n79 + n15*n239*n83 + n15*n240*n87 + n15*n242 + n15*n243 + n15*n222*n77/n164 + n15*n221*n74/n163 + n15*n216*n89/n158 + n168*n99 + n169*n97 + n170*n98 + n173*n96 + n174*n22*n92 + n177*n63*xF[4]*(pow(alpha, n0*n19 - n110*n8)*n27*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n8)*n59*n72*n8/(n105*n58) + n107*n129*n72 + n96) + n179*n88 - n181*(pow(alpha, n0*n19 - n110*n7)*n26*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n7)*n59*n7*n72/(n105*n58) + n100 + n107*n125*n72) - n183*(pow(alpha, n0*n19 - n11*n110)*n11*n59*n72/(n105*n58) + pow(alpha, n0*n19 - n11*n110)*n30*n51*n59/(n105*n58) + n107*n127*n72 + n46*n88) - n184*(pow(alpha, n0*n19 - n110*n13)*n13*n59*n72/(n105*n58) + pow(alpha, n0*n19 - n110*n13)*n32*n51*n59/(n105*n58) + n107*n123*n72 + n99) + n187 + n188 + n241*n75 + n34*n78*xF[8]*(pow(alpha, NP0*n0 - n110*n12)*n1*n12*n94/n104 + n1*n78)/n155 - n79*(pow(alpha, n0*n19 - n110*n12)*n12*n59*n72/(n105*n58) + pow(alpha, n0*n19 - n110*n12)*n31*n51*n59/(n105*n58) + n107*n124*n72 + n22*n31*n47)/n155 + n34*n86*xF[7]*(pow(alpha, NP0*n0 - n11*n110)*n52*n94/n104 + n46*n52)/n154 + n34*n81*xF[6]*(pow(alpha, NP0*n0 - n10*n110)*n1*n10*n94/n104 + n1*n81)/n153 + n77*(pow(alpha, n0*n19 - n10*n110)*n0*n10*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n10*n110)*n22*n29*n59/(n105*n58) + n29*n45*n51 + n128*n51*n85*n94/n104)/n153 + n34*n90*xF[5]*(pow(alpha, NP0*n0 - n110*n9)*n53*n94/n104 + n44*n53)/n152 - n74*(pow(alpha, n0*n19 - n110*n9)*n28*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n9)*n59*n72*n9/(n105*n58) + n107*n130*n72 + n22*n28*n44)/n152 + n34*n43*n8*xF[4]*(pow(alpha, NP0*n0 - n110*n8)*n54*n94/n104 + n43*n54)/n151 + n34*n82*xF[3]*(pow(alpha, NP0*n0 - n110*n7)*n1*n7*n94/n104 + n1*n82)/n150 + n34*n76*xF[2]*(pow(alpha, NP0*n0 - n110*n6)*n1*n6*n94/n104 + n1*n76)/n149 + n83*(pow(alpha, n0*n19 - n110*n6)*n0*n51*n59*n6/(n105*n58) + pow(alpha, n0*n19 - n110*n6)*n22*n25*n59/(n105*n58) + n25*n41*n51 + n131*n51*n85*n94/n104)/n149 + n34*n84*xF[1]*(pow(alpha, NP0*n0 - n110*n5)*n1*n5*n94/n104 + n1*n84)/n148 - n87*(pow(alpha, n0*n19 - n110*n5)*n24*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n5)*n5*n59*n72/(n105*n58) + n102 + n107*n122*n72)/n148 + n34*n80*xF[10]*(pow(alpha, NP0*n0 - n110*n4)*n1*n4*n94/n104 + n1*n80)/n147 + n69*xF[10]*(pow(alpha, n0*n19 - n110*n4)*n23*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n4)*n4*n59*n72/(n105*n58) + n107*n126*n72 + n22*n92)/n147 + n34*n85*xF[0]*(pow(alpha, NP0*n0 - n0*n110)*n0*n1*n94/n104 + n1*n85)/n146) + n21*n36*n51*n75*(n186*(-n16 + xPj*xTj)/n37 - 1)/n146);
-      NP_sqrt_base = (NP0*(n20*(n1*n170*n50*n76 + n1*n171*n50*n81 + n1*n172*n50*n84 + n1*n174*n50*n80 + n103*n176 + n168*n50*n93 + n173*n43*n50*n54 + n178*n50*n82 + n179*n50*n52 + n181*n71*(pow(alpha, NP0*n0 - n110*n7)*n1*n7*n94/n104 + n1*n82) + n183*n71*(pow(alpha, NP0*n0 - n11*n110)*n52*n94/n104 + n46*n52) + n184*n71*(pow(alpha, NP0*n0 - n110*n13)*n1*n13*n94/n104 + n93) + n185*n50 + n189 + n71*n79*(pow(alpha, NP0*n0 - n110*n12)*n1*n12*n94/n104 + n1*n78)/n155 + n71*n77*(pow(alpha, NP0*n0 - n10*n110)*n1*n10*n94/n104 + n1*n81)/n153 + n71*n74*(pow(alpha, NP0*n0 - n110*n9)*n53*n94/n104 + n44*n53)/n152 + n63*n71*xF[4]*(pow(alpha, NP0*n0 - n110*n8)*n54*n94/n104 + n43*n54)/n151 + n71*n83*(pow(alpha, NP0*n0 - n110*n6)*n1*n6*n94/n104 + n1*n76)/n149 + n71*n87*(pow(alpha, NP0*n0 - n110*n5)*n1*n5*n94/n104 + n1*n84)/n148 + n50*n69*xF[10]*(pow(alpha, NP0*n0 - n110*n4)*n1*n4*n94/n104 + n1*n80)/n147 + n71*n75*(pow(alpha, NP0*n0 - n0*n110)*n0*n1*n94/n104 + n1*n85)/n146) + n259) + xTj*(n168*n68*n71 + n173*n63*n71 + n174*n50*n69 + n175*n62*n71 + n71*n79/n144 + n66*n71*xF[7]/n143 + n71*n77/n142 + n71*n74/n141 + n71*n83/n138 + n71*n87/n137 + n71*n75/n135) + n50*n75/n135 + pow(NP0, -n15)*(-0.5*n191 - 0.5*n257 + 0.5*n260*n50*n75 + 0.5*n279*xTj - 1.0*n35*n50*n85*(pow(alpha, NP0*n0 - n0*n110)*n0*n1*n94/n104 + n1*n85)/n146))*(-n15*n20*(n180*n71*(pow(alpha, NP0*n0 - n110*n13)*n1*n13*n94/n104 + n93)*(pow(alpha, NP0*n0 - n110*n13)*n13*n34*n94/n104 + n13*n34*n48) + n181*n71*(pow(alpha, NP0*n0 - n110*n7)*n7*n72*n94/n104 + pow(alpha, n0*n19 - n110*n7)*n26*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n7)*n59*n7*n72/(n105*n58) + n100) + n182*n71*(pow(alpha, NP0*n0 - n11*n110)*n52*n94/n104 + n46*n52)*(pow(alpha, NP0*n0 - n11*n110)*n11*n34*n94/n104 + n34*n86) + n183*n71*(pow(alpha, NP0*n0 - n11*n110)*n11*n72*n94/n104 + pow(alpha, n0*n19 - n11*n110)*n11*n59*n72/(n105*n58) + pow(alpha, n0*n19 - n11*n110)*n30*n51*n59/(n105*n58) + n46*n88) + n184*n50*(pow(alpha, NP0*n0 - n110*n13)*n0*n13*n51*n94/n104 + pow(alpha, n0*n19 - n110*n13)*n0*n13*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n13)*n22*n32*n59/(n105*n58) + n32*n48*n51) + n191 + n192 + n193 + n194 + n195 + n196 + n197 + n198 + n199 + n200 + n201 + n245 + n246 + n247 + n248 + n249 + n250 + n251 + n252 + n253 + n254 + n255 + n71*n79*(pow(alpha, NP0*n0 - n110*n12)*n1*n12*n94/n104 + n1*n78)*(pow(alpha, NP0*n0 - n110*n12)*n12*n34*n94/n104 + n34*n78)/n166 + n71*n77*(pow(alpha, NP0*n0 - n10*n110)*n1*n10*n94/n104 + n1*n81)*(pow(alpha, NP0*n0 - n10*n110)*n10*n34*n94/n104 + n34*n81)/n164 + n71*n74*(pow(alpha, NP0*n0 - n110*n9)*n53*n94/n104 + n44*n53)*(pow(alpha, NP0*n0 - n110*n9)*n34*n9*n94/n104 + n34*n90)/n163 + n63*n71*xF[4]*(pow(alpha, NP0*n0 - n110*n8)*n54*n94/n104 + n43*n54)*(pow(alpha, NP0*n0 - n110*n8)*n34*n8*n94/n104 + n34*n43*n8)/n162 + n62*n71*xF[3]*(pow(alpha, NP0*n0 - n110*n7)*n1*n7*n94/n104 + n1*n82)*(pow(alpha, NP0*n0 - n110*n7)*n34*n7*n94/n104 + n34*n82)/n161 + n71*n83*(pow(alpha, NP0*n0 - n110*n6)*n1*n6*n94/n104 + n1*n76)*(pow(alpha, NP0*n0 - n110*n6)*n34*n6*n94/n104 + n34*n76)/n160 + n71*n87*(pow(alpha, NP0*n0 - n110*n5)*n1*n5*n94/n104 + n1*n84)*(pow(alpha, NP0*n0 - n110*n5)*n34*n5*n94/n104 + n34*n84)/n159 + n50*n69*xF[10]*(pow(alpha, NP0*n0 - n110*n4)*n1*n4*n94/n104 + n1*n80)*(pow(alpha, NP0*n0 - n110*n4)*n34*n4*n94/n104 + n34*n80)/n158 + n71*n75*(pow(alpha, NP0*n0 - n0*n110)*n0*n1*n94/n104 + n1*n85)*(pow(alpha, NP0*n0 - n0*n110)*n0*n34*n94/n104 + n34*n85)/n157 + n71*n79*(pow(alpha, NP0*n0 - n110*n12)*n12*n72*n94/n104 + pow(alpha, n0*n19 - n110*n12)*n12*n59*n72/(n105*n58) + pow(alpha, n0*n19 - n110*n12)*n31*n51*n59/(n105*n58) + n22*n31*n47)/n155 + n50*n77*(pow(alpha, NP0*n0 - n10*n110)*n0*n10*n51*n94/n104 + pow(alpha, n0*n19 - n10*n110)*n0*n10*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n10*n110)*n22*n29*n59/(n105*n58) + n29*n45*n51)/n153 + n71*n74*(pow(alpha, NP0*n0 - n110*n9)*n72*n9*n94/n104 + pow(alpha, n0*n19 - n110*n9)*n28*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n9)*n59*n72*n9/(n105*n58) + n22*n28*n44)/n152 + n63*n71*xF[4]*(pow(alpha, NP0*n0 - n110*n8)*n72*n8*n94/n104 + pow(alpha, n0*n19 - n110*n8)*n27*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n8)*n59*n72*n8/(n105*n58) + n96)/n151 + n50*n83*(pow(alpha, NP0*n0 - n110*n6)*n0*n51*n6*n94/n104 + pow(alpha, n0*n19 - n110*n6)*n0*n51*n59*n6/(n105*n58) + pow(alpha, n0*n19 - n110*n6)*n22*n25*n59/(n105*n58) + n25*n41*n51)/n149 + n71*n87*(pow(alpha, NP0*n0 - n110*n5)*n5*n72*n94/n104 + pow(alpha, n0*n19 - n110*n5)*n24*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n5)*n5*n59*n72/(n105*n58) + n102)/n148 + n50*n89*(pow(alpha, NP0*n0 - n110*n4)*n0*n4*n51*n94/n104 + pow(alpha, n0*n19 - n110*n4)*n0*n4*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n4)*n22*n23*n59/(n105*n58) + n51*n92)/n147 + n50*n75*(pow(alpha, NP0*n0 - n0*n110)*n21*n22*(-n16 + n18*n20)/(n104*n37) + n21*n36*n51)/n146) + 2.0*n191 - 4.0*n236*n50*n75 + 2.0*n257 + 4.0*n35*n50*n85*(pow(alpha, NP0*n0 - n0*n110)*n0*n1*n94/n104 + n1*n85)/n146) + pow(-n19*(n202 + n256 - 0.5*xTj*(n180*n71*(pow(alpha, NP0*n0 - n110*n13)*n1*n13*n94/n104 + n93)*(pow(alpha, NP0*n0 - n110*n13)*n13*n34*n94/n104 + n13*n34*n48) + n181*n71*(pow(alpha, NP0*n0 - n110*n7)*n7*n72*n94/n104 + pow(alpha, n0*n19 - n110*n7)*n26*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n7)*n59*n7*n72/(n105*n58) + n100) + n182*n71*(pow(alpha, NP0*n0 - n11*n110)*n52*n94/n104 + n46*n52)*(pow(alpha, NP0*n0 - n11*n110)*n11*n34*n94/n104 + n34*n86) + n183*n71*(pow(alpha, NP0*n0 - n11*n110)*n11*n72*n94/n104 + pow(alpha, n0*n19 - n11*n110)*n11*n59*n72/(n105*n58) + pow(alpha, n0*n19 - n11*n110)*n30*n51*n59/(n105*n58) + n46*n88) + n184*n50*(pow(alpha, NP0*n0 - n110*n13)*n0*n13*n51*n94/n104 + pow(alpha, n0*n19 - n110*n13)*n0*n13*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n13)*n22*n32*n59/(n105*n58) + n32*n48*n51) + n191 + n192 + n193 + n194 + n195 + n196 + n197 + n198 + n199 + n200 + n201 + n245 + n246 + n247 + n248 + n249 + n250 + n251 + n252 + n253 + n254 + n255 + n71*n79*(pow(alpha, NP0*n0 - n110*n12)*n1*n12*n94/n104 + n1*n78)*(pow(alpha, NP0*n0 - n110*n12)*n12*n34*n94/n104 + n34*n78)/n166 + n71*n77*(pow(alpha, NP0*n0 - n10*n110)*n1*n10*n94/n104 + n1*n81)*(pow(alpha, NP0*n0 - n10*n110)*n10*n34*n94/n104 + n34*n81)/n164 + n71*n74*(pow(alpha, NP0*n0 - n110*n9)*n53*n94/n104 + n44*n53)*(pow(alpha, NP0*n0 - n110*n9)*n34*n9*n94/n104 + n34*n90)/n163 + n63*n71*xF[4]*(pow(alpha, NP0*n0 - n110*n8)*n54*n94/n104 + n43*n54)*(pow(alpha, NP0*n0 - n110*n8)*n34*n8*n94/n104 + n34*n43*n8)/n162 + n62*n71*xF[3]*(pow(alpha, NP0*n0 - n110*n7)*n1*n7*n94/n104 + n1*n82)*(pow(alpha, NP0*n0 - n110*n7)*n34*n7*n94/n104 + n34*n82)/n161 + n71*n83*(pow(alpha, NP0*n0 - n110*n6)*n1*n6*n94/n104 + n1*n76)*(pow(alpha, NP0*n0 - n110*n6)*n34*n6*n94/n104 + n34*n76)/n160 + n71*n87*(pow(alpha, NP0*n0 - n110*n5)*n1*n5*n94/n104 + n1*n84)*(pow(alpha, NP0*n0 - n110*n5)*n34*n5*n94/n104 + n34*n84)/n159 + n50*n69*xF[10]*(pow(alpha, NP0*n0 - n110*n4)*n1*n4*n94/n104 + n1*n80)*(pow(alpha, NP0*n0 - n110*n4)*n34*n4*n94/n104 + n34*n80)/n158 + n71*n75*(pow(alpha, NP0*n0 - n0*n110)*n0*n1*n94/n104 + n1*n85)*(pow(alpha, NP0*n0 - n0*n110)*n0*n34*n94/n104 + n34*n85)/n157 + n71*n79*(pow(alpha, NP0*n0 - n110*n12)*n12*n72*n94/n104 + pow(alpha, n0*n19 - n110*n12)*n12*n59*n72/(n105*n58) + pow(alpha, n0*n19 - n110*n12)*n31*n51*n59/(n105*n58) + n22*n31*n47)/n155 + n50*n77*(pow(alpha, NP0*n0 - n10*n110)*n0*n10*n51*n94/n104 + pow(alpha, n0*n19 - n10*n110)*n0*n10*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n10*n110)*n22*n29*n59/(n105*n58) + n29*n45*n51)/n153 + n71*n74*(pow(alpha, NP0*n0 - n110*n9)*n72*n9*n94/n104 + pow(alpha, n0*n19 - n110*n9)*n28*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n9)*n59*n72*n9/(n105*n58) + n22*n28*n44)/n152 + n63*n71*xF[4]*(pow(alpha, NP0*n0 - n110*n8)*n72*n8*n94/n104 + pow(alpha, n0*n19 - n110*n8)*n27*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n8)*n59*n72*n8/(n105*n58) + n96)/n151 + n50*n83*(pow(alpha, NP0*n0 - n110*n6)*n0*n51*n6*n94/n104 + pow(alpha, n0*n19 - n110*n6)*n0*n51*n59*n6/(n105*n58) + pow(alpha, n0*n19 - n110*n6)*n22*n25*n59/(n105*n58) + n25*n41*n51)/n149 + n71*n87*(pow(alpha, NP0*n0 - n110*n5)*n5*n72*n94/n104 + pow(alpha, n0*n19 - n110*n5)*n24*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n5)*n5*n59*n72/(n105*n58) + n102)/n148 + n50*n89*(pow(alpha, NP0*n0 - n110*n4)*n0*n4*n51*n94/n104 + pow(alpha, n0*n19 - n110*n4)*n0*n4*n51*n59/(n105*n58) + pow(alpha, n0*n19 - n110*n4)*n22*n23*n59/(n105*n58) + n51*n92)/n147 + n50*n75*(pow(alpha, NP0*n0 - n0*n110)*n21*n22*(-n16 + n18*n20)/(n104*n37) + n21*n36*n51)/n146) - 0.5*n50*n75*(pow(alpha, NP0*n0 - n0*n110)*n0*n1*n94/n104 + n1*n85)*(pow(alpha, NP0*n0 - n0*n110)*n0*n34*n94/n104 + n34*n85)/n157 + 0.5*n50*n75*(pow(alpha, NP0*n0 - n0*n110)*n21*n22*(-n16 + n18*n20)/(n104*n37) + n21*n36*n51)/n146) - n190 - n232*n50*n75 - n277*xTj, -n15);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n73*(n106 - log(-pow(alpha, NP1*n0)*n94 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[10] - Mstar;
-      g5 = MW[2] - Mstar;
-      g6 = MW[3] - Mstar;
-      g7 = MW[4] - Mstar;
-      g8 = MW[5] - Mstar;
-      g9 = MW[6] - Mstar;
-      g10 = MW[7] - Mstar;
-      g11 = MW[8] - Mstar;
-      g12 = MW[9] - Mstar;
-      g13 = xF[0] - xTj;
-      g14 = xF[0] - xPj;
-      g15 = -xTj;
-      g16 = xPj/xF[1];
-      g17 = pow(alpha, -g1);
-      g18 = pow(alpha, -g4);
-      g19 = pow(alpha, -g0);
-      g20 = pow(alpha, -g5);
-      g21 = pow(alpha, -g6);
-      g22 = pow(alpha, -g7);
-      g23 = pow(alpha, -g8);
-      g24 = pow(alpha, -g9);
-      g25 = pow(alpha, -g10);
-      g26 = pow(alpha, -g11);
-      g27 = pow(alpha, -g12);
-      g28 = log(xF[0]/xF[1]);
-      g29 = -g2;
-      g30 = pow(alpha, NP1*g0);
-      g31 = pow(alpha, NP1*g1);
-      g32 = pow(alpha, NP1*g4);
-      g33 = log(g17);
-      g34 = pow(alpha, NP1*g5);
-      g35 = pow(alpha, NP1*g6);
-      g36 = pow(alpha, NP1*g7);
-      g37 = pow(alpha, NP1*g8);
-      g38 = pow(alpha, NP1*g9);
-      g39 = pow(alpha, NP1*g10);
-      g40 = pow(alpha, NP1*g11);
-      g41 = pow(alpha, NP1*g12);
-      g42 = -g28;
-      g43 = g13/g3;
-      g44 = g3/g13;
-      g45 = -g30 + 1;
-      g46 = -g30 + 1;
-      g47 = -g31 + 1;
-      g48 = -g34 + 1;
-      g49 = -g35 + 1;
-      g50 = -g36 + 1;
-      g51 = -g37 + 1;
-      g52 = -g38 + 1;
-      g53 = -g39 + 1;
-      g54 = -g40 + 1;
-      g55 = -g41 + 1;
-      g56 = -g32 + 1;
-      g57 = -g31;
-      g58 = -g32;
-      g59 = -g34;
-      g60 = -g35;
-      g61 = -g36;
-      g62 = -g37;
-      g63 = -g38;
-      g64 = -g39;
-      g65 = -g40;
-      g66 = -g41;
-      g67 = -1.0*g28;
-      g68 = -g3/g14;
-      g69 = g14/(g3*xF[1]);
-      g70 = pow(alpha, g0*g29) - 1;
-      g71 = pow(alpha, g0*g29) - 1;
-      g72 = pow(alpha, g1*g29) - 1;
-      g73 = pow(alpha, g29*g5) - 1;
-      g74 = pow(alpha, g29*g6) - 1;
-      g75 = pow(alpha, g29*g7) - 1;
-      g76 = pow(alpha, g29*g8) - 1;
-      g77 = pow(alpha, g29*g9) - 1;
-      g78 = pow(alpha, g10*g29) - 1;
-      g79 = pow(alpha, g11*g29) - 1;
-      g80 = pow(alpha, g12*g29) - 1;
-      g81 = pow(alpha, g29*g4) - 1;
-      g82 = -pow(alpha, g1*g29);
-      g83 = -pow(alpha, g29*g4);
-      g84 = -pow(alpha, g29*g5);
-      g85 = -pow(alpha, g29*g6);
-      g86 = -pow(alpha, g29*g7);
-      g87 = -pow(alpha, g29*g8);
-      g88 = -pow(alpha, g29*g9);
-      g89 = -pow(alpha, g10*g29);
-      g90 = -pow(alpha, g11*g29);
-      g91 = -pow(alpha, g12*g29);
-      g92 = g46 + g71;
-      g93 = -g31 - g82;
-      g94 = -g32 - g83;
-      g95 = -g34 - g84;
-      g96 = -g35 - g85;
-      g97 = -g36 - g86;
-      g98 = -g37 - g87;
-      g99 = -g38 - g88;
-      g100 = -g39 - g89;
-      g101 = -g40 - g90;
-      g102 = -g41 - g91;
-      g103 = pow(alpha, g1*g29) + g57;
-      g104 = g46 + g71;
-      g105 = pow(alpha, g29*g4) + g58;
-      g106 = pow(alpha, g29*g5) + g59;
-      g107 = pow(alpha, g29*g6) + g60;
-      g108 = pow(alpha, g29*g7) + g61;
-      g109 = pow(alpha, g29*g8) + g62;
-      g110 = pow(alpha, g29*g9) + g63;
-      g111 = pow(alpha, g10*g29) + g64;
-      g112 = pow(alpha, g11*g29) + g65;
-      g113 = pow(alpha, g12*g29) + g66;
-      g114 = xF[9]/g113;
-      g115 = xF[8]/g112;
-      g116 = xF[1]/g104;
-      g117 = xF[10]/g105;
-      g118 = xF[3]/g107;
-      g119 = xF[6]/g110;
-      g120 = xF[7]/g111;
-      g121 = xF[4]/g108;
-      g122 = xF[5]/g109;
-      g123 = xF[2]/g106;
-      g124 = xF[0]/g103;
-      g125 = xF[1]/g92;
-      g126 = xF[0]/g93;
-      g127 = xF[9]/g102;
-      g128 = xF[4]/g97;
-      g129 = xF[5]/g98;
-      g130 = xF[7]/g100;
-      g131 = xF[2]/g95;
-      g132 = xF[3]/g96;
-      g133 = xF[6]/g99;
-      g134 = xF[8]/g101;
-      g135 = xF[10]/g94;
-      g136 = g52/g99;
-      g137 = g55/g102;
-      g138 = g50/g97;
-      g139 = g53/g100;
-      g140 = g47/g93;
-      g141 = g51/g98;
-      g142 = g49/g96;
-      g143 = g45/g92;
-      g144 = g48/g95;
-      g145 = g56/g94;
-      g146 = g54/g101;
-      g147 = g70/g92;
-      g148 = g72/g93;
-      g149 = g76/g98;
-      g150 = g73/g95;
-      g151 = g74/g96;
-      g152 = g75/g97;
-      g153 = g79/g101;
-      g154 = g80/g102;
-      g155 = g77/g99;
-      g156 = g78/g100;
-      g157 = g81/g94;
-      g158 = log(g104*g15*g69/g46);
-      g159 = log(g15*g69*g92/g45);
-      g160 = log(g104*g16*g43/g71);
-      g161 = 1.0*g158;
-      g162 = log(g16*g43*g92/g70);
-      g163 = 1.0*g160;
-      g164 = -g114*g161*(g66 + 1) - g114*g163*(pow(alpha, g12*g29) - 1) - g115*g161*(g65 + 1) - g115*g163*(pow(alpha, g11*g29) - 1) - g116*g161*g46 - g116*g163*g71 - g117*g161*(g58 + 1) - g117*g163*(pow(alpha, g29*g4) - 1) - g118*g161*(g60 + 1) - g118*g163*(pow(alpha, g29*g6) - 1) - g119*g161*(g63 + 1) - g119*g163*(pow(alpha, g29*g9) - 1) - g120*g161*(g64 + 1) - g120*g163*(pow(alpha, g10*g29) - 1) - g121*g161*(g61 + 1) - g121*g163*(pow(alpha, g29*g7) - 1) - g122*g161*(g62 + 1) - g122*g163*(pow(alpha, g29*g8) - 1) - g123*g161*(g59 + 1) - g123*g163*(pow(alpha, g29*g5) - 1) - g124*g161*(g57 + 1) - g124*g163*(pow(alpha, g1*g29) - 1) - g67*xF[0] - g67*xF[10] - g67*xF[1] - g67*xF[2] - g67*xF[3] - g67*xF[4] - g67*xF[5] - g67*xF[6] - g67*xF[7] - g67*xF[8] - g67*xF[9];
-      LpF = xF[0]*(g17 + 1.0)*(g140*g159 + g148*g162 + g42)/(g33*(g17 - 1.0)) + xF[10]*(g18 + 1.0)*(g145*g159 + g157*g162 + g42)/(g33*(g18 - 1.0)) + xF[1]*(g19 + 1.0)*(g143*g159 + g147*g162 + g42)/(g33*(g19 - 1.0)) + xF[2]*(g20 + 1.0)*(g144*g159 + g150*g162 + g42)/(g33*(g20 - 1.0)) + xF[3]*(g21 + 1.0)*(g142*g159 + g151*g162 + g42)/(g33*(g21 - 1.0)) + xF[4]*(g22 + 1.0)*(g138*g159 + g152*g162 + g42)/(g33*(g22 - 1.0)) + xF[5]*(g23 + 1.0)*(g141*g159 + g149*g162 + g42)/(g33*(g23 - 1.0)) + xF[6]*(g24 + 1.0)*(g136*g159 + g155*g162 + g42)/(g33*(g24 - 1.0)) + xF[7]*(g25 + 1.0)*(g139*g159 + g156*g162 + g42)/(g33*(g25 - 1.0)) + xF[8]*(g26 + 1.0)*(g146*g159 + g153*g162 + g42)/(g33*(g26 - 1.0)) + xF[9]*(g27 + 1.0)*(g137*g159 + g154*g162 + g42)/(g33*(g27 - 1.0));
-      PpF = g43;
-      TpF = -g14/g3;
-      SWUpF = g164;
-      SWUpP = g164*g44;
-      xP[0] = g126*g44*g72;
-      xP[1] = g125*g44*g70;
-      xP[2] = g131*g44*g73;
-      xP[3] = g132*g44*g74;
-      xP[4] = g128*g44*g75;
-      xP[5] = g129*g44*g76;
-      xP[6] = g133*g44*g77;
-      xP[7] = g130*g44*g78;
-      xP[8] = g134*g44*g79;
-      xP[9] = g127*g44*g80;
-      xP[10] = g135*g44*g81;
-      xT[0] = g126*g47*g68;
-      xT[1] = g125*g45*g68;
-      xT[2] = g131*g48*g68;
-      xT[3] = g132*g49*g68;
-      xT[4] = g128*g50*g68;
-      xT[5] = g129*g51*g68;
-      xT[6] = g133*g52*g68;
-      xT[7] = g130*g53*g68;
-      xT[8] = g134*g54*g68;
-      xT[9] = g127*g55*g68;
-      xT[10] = g135*g56*g68;
-      break;
-    case 12:
-      n0 = -2.00000000000000;
-      n1 = MW[0] - Mstar;
-      n2 = log(alpha);
-      n3 = xPj - xTj;
-      n4 = xF[0] - xPj;
-      n5 = MW[10] - Mstar;
-      n6 = MW[11] - Mstar;
-      n7 = MW[1] - Mstar;
-      n8 = MW[2] - Mstar;
-      n9 = MW[3] - Mstar;
-      n10 = MW[4] - Mstar;
-      n11 = MW[5] - Mstar;
-      n12 = MW[6] - Mstar;
-      n13 = MW[7] - Mstar;
-      n14 = MW[8] - Mstar;
-      n15 = MW[9] - Mstar;
-      n16 = log(xTj);
-      n17 = -n1;
-      n18 = -2;
-      n19 = xF[0]*xPj;
-      n20 = -Mstar;
-      n21 = -xTj;
-      n22 = -n0*xF[11];
-      n23 = -xPj;
-      n24 = -NP0*n0;
-      n25 = -xF[0];
-      n26 = pow(n1, -n0);
-      n27 = pow(n2, -n0);
-      n28 = pow(n5, -n0);
-      n29 = pow(n6, -n0);
-      n30 = pow(n7, -n0);
-      n31 = pow(n8, -n0);
-      n32 = pow(n9, -n0);
-      n33 = pow(n10, -n0);
-      n34 = pow(n11, -n0);
-      n35 = pow(n12, -n0);
-      n36 = pow(n13, -n0);
-      n37 = pow(n14, -n0);
-      n38 = pow(n15, -n0);
-      n39 = Mstar*n2;
-      n40 = -n0*n2;
-      n41 = -n2;
-      n42 = pow(alpha, NP0*n1);
-      n43 = n19 + n21*xF[0];
-      n44 = n19 + n21*xPj;
-      n45 = pow(alpha, NP0*n5);
-      n46 = pow(alpha, NP0*n6);
-      n47 = pow(alpha, NP0*n7);
-      n48 = pow(alpha, NP0*n8);
-      n49 = pow(alpha, NP0*n9);
-      n50 = pow(alpha, NP0*n10);
-      n51 = pow(alpha, NP0*n11);
-      n52 = pow(alpha, NP0*n12);
-      n53 = pow(alpha, NP0*n13);
-      n54 = pow(alpha, NP0*n14);
-      n55 = pow(alpha, NP0*n15);
-      n56 = MW[0]*n41;
-      n57 = n3/n4;
-      n58 = n11*n2;
-      n59 = n2*n7;
-      n60 = n13*n2;
-      n61 = -n42 + 1;
-      n62 = -n45 + 1;
-      n63 = pow(alpha, NP0*n0*n17);
-      n64 = pow(n44, -n0);
-      n65 = -n46 + 1;
-      n66 = -n47 + 1;
-      n67 = -n48 + 1;
-      n68 = -n49 + 1;
-      n69 = -n50 + 1;
-      n70 = -n51 + 1;
-      n71 = -n52 + 1;
-      n72 = -n53 + 1;
-      n73 = -n54 + 1;
-      n74 = -n55 + 1;
-      n75 = -n71;
-      n76 = -n62;
-      n77 = -n69;
-      n78 = -n42;
-      n79 = -n46;
-      n80 = -n48;
-      n81 = -n51;
-      n82 = -n52;
-      n83 = -n55;
-      n84 = n1*n27;
-      n85 = 1/(n1*n2);
-      n86 = n65*xF[11];
-      n87 = n15*n55;
-      n88 = n12*n52;
-      n89 = n1*n42;
-      n90 = n14*n54;
-      n91 = n27*n34;
-      n92 = n10*n50;
-      n93 = n45*n5;
-      n94 = n71*xF[6];
-      n95 = n27*n36;
-      n96 = n67*xF[2];
-      n97 = n48*n8;
-      n98 = n70*xF[5];
-      n99 = n27*n30;
-      n100 = n47*n7;
-      n101 = n26*n27;
-      n102 = n13*n53;
-      n103 = n27*n38;
-      n104 = n49*n9;
-      n105 = log((-1.0 + xPj/xF[0])/n3);
-      n106 = -n68*xF[3];
-      n107 = -n74*xF[9];
-      n108 = n104*xF[3];
-      n109 = -n73*xF[8];
-      n110 = n2*n46*n6;
-      n111 = n44/n43;
-      n112 = n101*n42;
-      n113 = n27*n29*n46;
-      n114 = n27*n31*n48;
-      n115 = n27*n37*n54;
-      n116 = n27*n28*n45;
-      n117 = n27*n32*n49;
-      n118 = n111*n78 + 1;
-      n119 = n105 + n16 + n39 + n56;
-      n120 = n111*n42/n118;
-      n121 = n85*(n119 - log(n118)) + 1;
-      n122 = pow(alpha, n1*n121);
-      n123 = pow(alpha, n121*n5);
-      n124 = pow(alpha, n121*n6);
-      n125 = pow(alpha, n121*n7);
-      n126 = pow(alpha, n121*n8);
-      n127 = pow(alpha, n121*n9);
-      n128 = pow(alpha, n10*n121);
-      n129 = pow(alpha, n11*n121);
-      n130 = pow(alpha, n12*n121);
-      n131 = pow(alpha, n121*n13);
-      n132 = pow(alpha, n121*n14);
-      n133 = pow(alpha, n121*n15);
-      n134 = n10/n128;
-      n135 = n13/n131;
-      n136 = n15/n133;
-      n137 = n9/n127;
-      n138 = n12/n130;
-      n139 = n14/n132;
-      n140 = n6/n124;
-      n141 = n7/n125;
-      n142 = n8/n126;
-      n143 = -1/n122;
-      n144 = n5/n123;
-      n145 = n11/n129;
-      n146 = n29/n124;
-      n147 = pow(alpha, n121*n17) + n61 - 1;
-      n148 = n62 - 1 + 1.0/n123;
-      n149 = n65 - 1 + 1.0/n124;
-      n150 = n66 - 1 + 1.0/n125;
-      n151 = n67 - 1 + 1.0/n126;
-      n152 = n68 - 1 + 1.0/n127;
-      n153 = n69 - 1 + 1.0/n128;
-      n154 = n70 - 1 + 1.0/n129;
-      n155 = n71 - 1 + 1.0/n130;
-      n156 = n72 - 1 + 1.0/n131;
-      n157 = n73 - 1 + 1.0/n132;
-      n158 = n74 - 1 + 1.0/n133;
-      n159 = pow(n147, 3);
-      n160 = pow(n148, 3);
-      n161 = pow(n149, 3);
-      n162 = pow(n150, 3);
-      n163 = pow(n151, 3);
-      n164 = pow(n152, 3);
-      n165 = pow(n153, 3);
-      n166 = pow(n154, 3);
-      n167 = pow(n155, 3);
-      n168 = pow(n156, 3);
-      n169 = pow(n157, 3);
-      n170 = pow(n158, 3);
-      n171 = xF[0]/n147;
-      n172 = xF[10]/n148;
-      n173 = xF[9]/n158;
-      n174 = xF[11]/n149;
-      n175 = xF[2]/n151;
-      n176 = xF[8]/n157;
-      n177 = xF[3]/n152;
-      n178 = xF[6]/n167;
-      n179 = pow(n148, n18)*xF[10];
-      n180 = n2/n152;
-      n181 = n2*xF[4]/n153;
-      n182 = -1/n161;
-      n183 = pow(n147, n18)*n2;
-      n184 = n2*xF[6]/n155;
-      n185 = n51*xF[5]/n154;
-      n186 = n47*xF[1]/n150;
-      n187 = n53*xF[7]/n156;
-      n188 = pow(n147, n18)*n61;
-      n189 = -n66/n162;
-      n190 = n61*xF[0]/n159;
-      n191 = -pow(n154, n18)*n98;
-      n192 = -n72*xF[7]/n168;
-      n193 = -pow(n150, n18)*n66*xF[1];
-      n194 = -pow(n156, n18)*n72*xF[7];
-      n195 = n175*n2*n97;
-      n196 = n103*n173*n55;
-      n197 = n27*n33*n50*xF[4]/n153;
-      n198 = n27*n35*n52*xF[6]/n155;
-      n199 = n17*n171*n2*n42*n57;
-      n200 = n112*n171*n57;
-      n201 = n116*n172*n57;
-      n202 = n113*n174*n57;
-      n203 = n186*n57*n99;
-      n204 = n114*n175*n57;
-      n205 = n117*n177*n57;
-      n206 = n197*n57;
-      n207 = n185*n57*n91;
-      n208 = n198*n57;
-      n209 = n187*n57*n95;
-      n210 = n115*n176*n57;
-      n211 = n196*n57;
-      n212 = 0.5*n200;
-      n213 = n111/(n118*n122);
-      n214 = n213 + 1;
-      n215 = n214*xF[0];
-      n216 = n2*n213*n89 + n2*n89;
-      n217 = n120*n144*n2 + n2*n93;
-      n218 = n110 + n120*n140*n2;
-      n219 = n120*n59/n125 + n47*n59;
-      n220 = n120*n142*n2 + n2*n97;
-      n221 = n104*n2 + n120*n137*n2;
-      n222 = n120*n134*n2 + n2*n92;
-      n223 = n120*n58/n129 + n51*n58;
-      n224 = n120*n138*n2 + n2*n88;
-      n225 = n120*n60/n131 + n53*n60;
-      n226 = n120*n139*n2 + n2*n90;
-      n227 = n120*n136*n2 + n2*n87;
-      n228 = pow(n216, -n0);
-      n229 = pow(n217, -n0);
-      n230 = pow(n218, -n0);
-      n231 = pow(n219, -n0);
-      n232 = pow(n220, -n0);
-      n233 = pow(n221, -n0);
-      n234 = pow(n222, -n0);
-      n235 = pow(n223, -n0);
-      n236 = pow(n224, -n0);
-      n237 = pow(n225, -n0);
-      n238 = pow(n226, -n0);
-      n239 = pow(n227, -n0);
-      n240 = n216*xF[0];
-      n241 = n219*xF[1];
-      n242 = n222*xF[4];
-      n243 = n0*n120*n17*n2/n122 + n0*n17*n2*n42;
-      n244 = n101*n213*n78 + n101*n78;
-      n245 = n244*xF[0];
-      n246 = pow(n152, n18)*n221;
-      n247 = pow(n149, n18)*n218;
-      n248 = pow(n158, n18)*n227;
-      n249 = pow(n157, n18)*n226;
-      n250 = pow(n155, n18)*n224*xF[6];
-      n251 = n232/n163;
-      n252 = n235/n166;
-      n253 = pow(n156, n18)*n225*xF[7];
-      n254 = pow(n151, n18)*n220*xF[2];
-      n255 = pow(n153, n18)*n242*n77;
-      n256 = n234*n69*xF[4]/n165;
-      n257 = n188*n240*n57;
-      n258 = n0*n17*n183*n42*n57*xF[0]*(pow(alpha, NP0*n1 + n121*n17)*n1*n111*n2/n118 + n2*n89);
-      n259 = n179*n40*n57*n93*(pow(alpha, NP0*n1 - n121*n5)*n111*n2*n5/n118 + n2*n93);
-      n260 = n110*pow(n149, n18)*n22*n57*(pow(alpha, NP0*n1 - n121*n6)*n111*n2*n6/n118 + n110);
-      n261 = n100*pow(n150, n18)*n40*n57*xF[1]*(pow(alpha, NP0*n1 - n121*n7)*n111*n59/n118 + n47*n59);
-      n262 = pow(n151, n18)*n40*n57*n97*xF[2]*(pow(alpha, NP0*n1 - n121*n8)*n111*n2*n8/n118 + n2*n97);
-      n263 = n108*pow(n152, n18)*n40*n57*(pow(alpha, NP0*n1 - n121*n9)*n111*n2*n9/n118 + n104*n2);
-      n264 = pow(n153, n18)*n40*n57*n92*xF[4]*(pow(alpha, NP0*n1 - n10*n121)*n10*n111*n2/n118 + n2*n92);
-      n265 = n11*pow(n154, n18)*n40*n51*n57*xF[5]*(pow(alpha, NP0*n1 - n11*n121)*n111*n58/n118 + n51*n58);
-      n266 = pow(n155, n18)*n40*n57*n88*xF[6]*(pow(alpha, NP0*n1 - n12*n121)*n111*n12*n2/n118 + n2*n88);
-      n267 = n102*pow(n156, n18)*n40*n57*xF[7]*(pow(alpha, NP0*n1 - n121*n13)*n111*n60/n118 + n53*n60);
-      n268 = pow(n157, n18)*n40*n57*n90*xF[8]*(pow(alpha, NP0*n1 - n121*n14)*n111*n14*n2/n118 + n2*n90);
-      n269 = pow(n158, n18)*n40*n57*n87*xF[9]*(pow(alpha, NP0*n1 - n121*n15)*n111*n15*n2/n118 + n2*n87);
-      n270 = 1.0*n183*n240*n57*n89;
-      n271 = n188*n245*n57;
-      n272 = 0.5*n271;
-      n273 = pow(alpha, n1*n24)*pow(n118, n18)*n142*n17*n27*pow(n43, n18)*n64 + pow(alpha, n1*n24)*pow(n118, n18)*n27*n31*pow(n43, n18)*n64/n126 + n120*n142*n17*n27 + n27*n31*n80;
-      n274 = pow(alpha, n1*n24)*pow(n118, n18)*n137*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24)*pow(n118, n18)*n27*n32*pow(n43, n18)*n64/n127 + n117 + n120*n137*n84;
-      n275 = pow(alpha, n1*n24)*pow(n118, n18)*n134*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24)*pow(n118, n18)*n27*n33*pow(n43, n18)*n64/n128 + n120*n134*n84 + n27*n33*n50;
-      n276 = pow(alpha, n1*n24)*pow(n118, n18)*n138*n17*n27*pow(n43, n18)*n64 + pow(alpha, n1*n24)*pow(n118, n18)*n27*n35*pow(n43, n18)*n64/n130 + n120*n138*n17*n27 + n27*n35*n82;
-      n277 = pow(alpha, n1*n24)*pow(n118, n18)*n139*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24)*pow(n118, n18)*n27*n37*pow(n43, n18)*n64/n132 + n115 + n120*n139*n84;
-      n278 = -pow(alpha, n1*n24)*n103*pow(n118, n18)*pow(n43, n18)*n64/n133 + pow(alpha, n1*n24)*pow(n118, n18)*n136*pow(n43, n18)*n64*n84 + n103*n55 + n120*n136*n84;
-      n279 = pow(n151, n18)*n57*n96*(pow(alpha, n1*n24 - n121*n8)*pow(n118, n18)*n17*n27*pow(n43, n18)*n64*n8 + pow(alpha, n1*n24 - n121*n8)*pow(n118, n18)*n27*n31*pow(n43, n18)*n64 + n120*n142*n17*n27 + n27*n31*n80);
-      n280 = pow(n155, n18)*n57*n94*(pow(alpha, n1*n24 - n12*n121)*pow(n118, n18)*n12*n17*n27*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n12*n121)*pow(n118, n18)*n27*n35*pow(n43, n18)*n64 + n120*n138*n17*n27 + n27*n35*n82);
-      n281 = n179*n57*n76*(-pow(alpha, n1*n24 - n121*n5)*pow(n118, n18)*n27*n28*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n5)*pow(n118, n18)*pow(n43, n18)*n5*n64*n84 + n116 + n120*n144*n84);
-      n282 = n193*n57*(pow(alpha, n1*n24 - n121*n7)*pow(n118, n18)*pow(n43, n18)*n64*n7*n84 - pow(alpha, n1*n24 - n121*n7)*pow(n118, n18)*pow(n43, n18)*n64*n99 + n120*n141*n84 + n47*n99);
-      n283 = n106*pow(n152, n18)*n57*(-pow(alpha, n1*n24 - n121*n9)*pow(n118, n18)*n27*n32*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n9)*pow(n118, n18)*pow(n43, n18)*n64*n84*n9 + n117 + n120*n137*n84);
-      n284 = pow(n153, n18)*n57*n77*xF[4]*(pow(alpha, n1*n24 - n10*n121)*n10*pow(n118, n18)*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n10*n121)*pow(n118, n18)*n27*n33*pow(n43, n18)*n64 + n120*n134*n84 + n27*n33*n50);
-      n285 = n191*n57*(pow(alpha, n1*n24 - n11*n121)*n11*pow(n118, n18)*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n11*n121)*pow(n118, n18)*pow(n43, n18)*n64*n91 + n120*n145*n84 + n51*n91);
-      n286 = n194*n57*(pow(alpha, n1*n24 - n121*n13)*pow(n118, n18)*n13*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n121*n13)*pow(n118, n18)*pow(n43, n18)*n64*n95 + n120*n135*n84 + n53*n95);
-      n287 = n109*pow(n157, n18)*n57*(pow(alpha, n1*n24 - n121*n14)*pow(n118, n18)*n14*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n121*n14)*pow(n118, n18)*n27*n37*pow(n43, n18)*n64 + n115 + n120*n139*n84);
-      n288 = n212 + n270 + n272;
-      n289 = xTj*(n106*n246*n57 + n107*n248*n57 + n108*n180*n57 + n109*n249*n57 + n110*n174*n57 - pow(n151, n18)*n220*n57*n96 + n171*n2*n57*n89 + n172*n2*n57*n93 + n173*n2*n57*n87 + n176*n2*n57*n90 + n179*n217*n57*n76 + n181*n57*n92 + n184*n57*n88 + n185*n57*n58 + n186*n57*n59 + n187*n57*n60 + n188*n25*n57*(pow(alpha, NP0*n1 - n1*n121)*n1*n111*n2/n118 + n2*n89) + n191*n223*n57 + n193*n219*n57 + n194*n225*n57 + n195*n57 - n247*n57*n86 + n250*n57*n75 + n255*n57);
-      n290 = n199 + n257 + n289;
-      n291 = n200 + n201 + n202 + n203 + n204 + n205 + n206 + n207 + n208 + n209 + n210 + n211 + n258 + n259 + n260 + n261 + n262 + n263 + n264 + n265 + n266 + n267 + n268 + n269 + n271 + n279 + n280 + n281 + n282 + n283 + n284 + n285 + n286 + n287;
-      n292 = n106*n221*n57*(n104*n40 + n120*n137*n40)/n164 + n107*pow(n158, n18)*n57*(-pow(alpha, n1*n24 - n121*n15)*n103*pow(n118, n18)*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n15)*pow(n118, n18)*n15*pow(n43, n18)*n64*n84 + n103*n55 + n120*n136*n84) + n107*n227*n57*(n120*n136*n40 + n40*n87)/n170 + n109*n226*n57*(n120*n139*n40 + n40*n90)/n169 - pow(n149, n18)*n57*n86*(-pow(alpha, n1*n24 - n121*n6)*pow(n118, n18)*n27*n29*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n6)*pow(n118, n18)*pow(n43, n18)*n6*n64*n84 + n113 + n120*n140*n84) + n178*n224*n57*n75*(n120*n138*n40 + n40*n88) + n182*n218*n57*n86*(n120*n140*n40 + n40*n46*n6) + n189*n241*n57*(n100*n40 + n120*n141*n40) + n192*n225*n57*(n102*n40 + n120*n135*n40) + n291 - n223*n57*n98*(n11*n40*n51 + n120*n145*n40)/n166 + n242*n57*n77*(n120*n134*n40 + n40*n92)/n165 - n220*n57*n96*(n120*n142*n40 + n40*n97)/n163 + n217*n57*n76*xF[10]*(n120*n144*n40 + n40*n93)/n160 + n25*n57*n61*(pow(alpha, NP0*n1 - n1*n121)*n1*n111*n2/n118 + n2*n89)*(pow(alpha, NP0*n1 - n1*n121)*n0*n111*n17*n2/n118 + n0*n17*n2*n42)/n159;
-      NP_b = -n183*n215*n57*n61*n89 - n199 - n24*(1.0*n183*n57*n89*xF[0]*(pow(alpha, NP0*n1 - n1*n121)*n1*n111*n2/n118 + n2*n89) + 0.5*n188*n57*xF[0]*(-pow(alpha, NP0*n1 - n1*n121)*n101*n111/n118 + n101*n78) - 1.0*n190*n228*n57 + n212 - 0.5*xTj*(n106*pow(n152, n18)*n57*(pow(alpha, NP0*n1 - n121*n9)*n111*n84*n9/n118 - pow(alpha, n1*n24 - n121*n9)*pow(n118, n18)*n27*n32*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n9)*pow(n118, n18)*pow(n43, n18)*n64*n84*n9 + n117) + n109*pow(n157, n18)*n57*(pow(alpha, NP0*n1 - n121*n14)*n111*n14*n84/n118 + pow(alpha, n1*n24 - n121*n14)*pow(n118, n18)*n14*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n121*n14)*pow(n118, n18)*n27*n37*pow(n43, n18)*n64 + n115) + pow(n149, n18)*n57*n86*(pow(alpha, NP0*n1 - n121*n6)*n111*n17*n27*n6/n118 + pow(alpha, n1*n24 - n121*n6)*pow(n118, n18)*n17*n27*pow(n43, n18)*n6*n64 + pow(alpha, n1*n24 - n121*n6)*pow(n118, n18)*n27*n29*pow(n43, n18)*n64 + n27*n29*n79) + pow(n151, n18)*n57*n96*(pow(alpha, NP0*n1 - n121*n8)*n111*n17*n27*n8/n118 + pow(alpha, n1*n24 - n121*n8)*pow(n118, n18)*n17*n27*pow(n43, n18)*n64*n8 + pow(alpha, n1*n24 - n121*n8)*pow(n118, n18)*n27*n31*pow(n43, n18)*n64 + n27*n31*n80) + pow(n153, n18)*n57*n77*xF[4]*(pow(alpha, NP0*n1 - n10*n121)*n10*n111*n84/n118 + pow(alpha, n1*n24 - n10*n121)*n10*pow(n118, n18)*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n10*n121)*pow(n118, n18)*n27*n33*pow(n43, n18)*n64 + n27*n33*n50) + pow(n155, n18)*n57*n94*(pow(alpha, NP0*n1 - n12*n121)*n111*n12*n17*n27/n118 + pow(alpha, n1*n24 - n12*n121)*pow(n118, n18)*n12*n17*n27*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n12*n121)*pow(n118, n18)*n27*n35*pow(n43, n18)*n64 + n27*n35*n82) + pow(n158, n18)*n57*n74*xF[9]*(pow(alpha, NP0*n1 - n121*n15)*n111*n15*n17*n27/n118 + pow(alpha, n1*n24 - n121*n15)*n103*pow(n118, n18)*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n15)*pow(n118, n18)*n15*n17*n27*pow(n43, n18)*n64 + n103*n83) + n179*n57*n76*(pow(alpha, NP0*n1 - n121*n5)*n111*n5*n84/n118 - pow(alpha, n1*n24 - n121*n5)*pow(n118, n18)*n27*n28*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n5)*pow(n118, n18)*pow(n43, n18)*n5*n64*n84 + n116) + n18*n190*n228*n57 + n18*n251*n57*n96 + n18*n252*n57*n98 + n18*n256*n57 + n188*n57*xF[0]*(-pow(alpha, NP0*n1 - n1*n121)*n101*n111/n118 + n101*n78) + n191*n57*(pow(alpha, NP0*n1 - n11*n121)*n11*n111*n84/n118 + pow(alpha, n1*n24 - n11*n121)*n11*pow(n118, n18)*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n11*n121)*pow(n118, n18)*pow(n43, n18)*n64*n91 + n51*n91) + n193*n57*(pow(alpha, NP0*n1 - n121*n7)*n111*n7*n84/n118 + pow(alpha, n1*n24 - n121*n7)*pow(n118, n18)*pow(n43, n18)*n64*n7*n84 - pow(alpha, n1*n24 - n121*n7)*pow(n118, n18)*pow(n43, n18)*n64*n99 + n47*n99) + n194*n57*(pow(alpha, NP0*n1 - n121*n13)*n111*n13*n84/n118 + pow(alpha, n1*n24 - n121*n13)*pow(n118, n18)*n13*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n121*n13)*pow(n118, n18)*pow(n43, n18)*n64*n95 + n53*n95) + n200 + n201 + n202 + n203 + n204 + n205 + n206 + n207 + n208 + n209 + n210 + n211 + n258 + n259 + n260 + n261 + n262 + n263 + n264 + n265 + n266 + n267 + n268 + n269 + n18*n239*n57*n74*xF[9]/n170 + n18*n238*n57*n73*xF[8]/n169 + n18*n237*n57*n72*xF[7]/n168 + n18*n236*n57*n94/n167 + n18*n233*n57*n68*xF[3]/n164 + n18*n231*n57*n66*xF[1]/n162 + n18*n230*n57*n86/n161 + n18*n229*n57*n62*xF[10]/n160)) - n57*xTj*(n106*n246 + n107*n248 + n108*n180 + n109*n249 + n110*n174 - pow(n151, n18)*n220*n96 + n171*n2*n89 + n172*n2*n93 + n173*n2*n87 + n176*n2*n90 + n179*n217*n76 + n181*n92 + n184*n88 + n185*n58 + n186*n59 + n187*n60 + n188*n25*(pow(alpha, NP0*n1 - n1*n121)*n1*n111*n2/n118 + n2*n89) + n191*n223 + n193*n219 + n194*n225 + n195 - n247*n86 + n250*n75 + n255);
-      NP_2a = -n57*(pow(alpha, n1*n24)*n0*n101*pow(n147, n18)*n215 + pow(alpha, n1*n24)*n0*n101*pow(n214, -n0)*n25*n61/n159 - 1.0*n112*n171 + n112*n188*n25*(-1 + (-n19 + xPj*xTj)/(n118*n122*n43)) + 1.0*xTj*(n0*n17*n183*n42*xF[0]*(pow(alpha, NP0*n1 + n121*n17)*n1*n111*n2/n118 + n2*n89) + n100*pow(n150, n18)*n40*xF[1]*(pow(alpha, NP0*n1 - n121*n7)*n111*n59/n118 + n47*n59) + n102*pow(n156, n18)*n40*xF[7]*(pow(alpha, NP0*n1 - n121*n13)*n111*n60/n118 + n53*n60) + n106*pow(n152, n18)*(-pow(alpha, n1*n24 - n121*n9)*pow(n118, n18)*n27*n32*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n9)*pow(n118, n18)*pow(n43, n18)*n64*n84*n9 + n117 + n120*n137*n84) + n107*pow(n158, n18)*(-pow(alpha, n1*n24 - n121*n15)*n103*pow(n118, n18)*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n15)*pow(n118, n18)*n15*pow(n43, n18)*n64*n84 + n103*n55 + n120*n136*n84) + n108*pow(n152, n18)*n40*(pow(alpha, NP0*n1 - n121*n9)*n111*n2*n9/n118 + n104*n2) + n109*pow(n157, n18)*(pow(alpha, n1*n24 - n121*n14)*pow(n118, n18)*n14*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n121*n14)*pow(n118, n18)*n27*n37*pow(n43, n18)*n64 + n115 + n120*n139*n84) + n11*pow(n154, n18)*n40*n51*xF[5]*(pow(alpha, NP0*n1 - n11*n121)*n111*n58/n118 + n51*n58) + n110*pow(n149, n18)*n22*(pow(alpha, NP0*n1 - n121*n6)*n111*n2*n6/n118 + n110) + n112*n171 + n113*n174 + n114*n175 + n115*n176 + n116*n172 + n117*n177 - pow(n149, n18)*n86*(-pow(alpha, n1*n24 - n121*n6)*pow(n118, n18)*n27*n29*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n6)*pow(n118, n18)*pow(n43, n18)*n6*n64*n84 + n113 + n120*n140*n84) + pow(n151, n18)*n40*n97*xF[2]*(pow(alpha, NP0*n1 - n121*n8)*n111*n2*n8/n118 + n2*n97) + pow(n151, n18)*n96*(pow(alpha, n1*n24 - n121*n8)*pow(n118, n18)*n17*n27*pow(n43, n18)*n64*n8 + pow(alpha, n1*n24 - n121*n8)*pow(n118, n18)*n27*n31*pow(n43, n18)*n64 + n120*n142*n17*n27 + n27*n31*n80) + pow(n153, n18)*n40*n92*xF[4]*(pow(alpha, NP0*n1 - n10*n121)*n10*n111*n2/n118 + n2*n92) + pow(n153, n18)*n77*xF[4]*(pow(alpha, n1*n24 - n10*n121)*n10*pow(n118, n18)*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n10*n121)*pow(n118, n18)*n27*n33*pow(n43, n18)*n64 + n120*n134*n84 + n27*n33*n50) + pow(n155, n18)*n40*n88*xF[6]*(pow(alpha, NP0*n1 - n12*n121)*n111*n12*n2/n118 + n2*n88) + pow(n155, n18)*n94*(pow(alpha, n1*n24 - n12*n121)*pow(n118, n18)*n12*n17*n27*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n12*n121)*pow(n118, n18)*n27*n35*pow(n43, n18)*n64 + n120*n138*n17*n27 + n27*n35*n82) + pow(n157, n18)*n40*n90*xF[8]*(pow(alpha, NP0*n1 - n121*n14)*n111*n14*n2/n118 + n2*n90) + pow(n158, n18)*n40*n87*xF[9]*(pow(alpha, NP0*n1 - n121*n15)*n111*n15*n2/n118 + n2*n87) + n179*n40*n93*(pow(alpha, NP0*n1 - n121*n5)*n111*n2*n5/n118 + n2*n93) + n179*n76*(-pow(alpha, n1*n24 - n121*n5)*pow(n118, n18)*n27*n28*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n5)*pow(n118, n18)*pow(n43, n18)*n5*n64*n84 + n116 + n120*n144*n84) + n18*n190*n228 + n18*n251*n96 + n18*n252*n98 + n18*n256 + n185*n91 + n186*n99 + n187*n95 + n188*n245 + n191*(pow(alpha, n1*n24 - n11*n121)*n11*pow(n118, n18)*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n11*n121)*pow(n118, n18)*pow(n43, n18)*n64*n91 + n120*n145*n84 + n51*n91) + n193*(pow(alpha, n1*n24 - n121*n7)*pow(n118, n18)*pow(n43, n18)*n64*n7*n84 - pow(alpha, n1*n24 - n121*n7)*pow(n118, n18)*pow(n43, n18)*n64*n99 + n120*n141*n84 + n47*n99) + n194*(pow(alpha, n1*n24 - n121*n13)*pow(n118, n18)*n13*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n121*n13)*pow(n118, n18)*pow(n43, n18)*n64*n95 + n120*n135*n84 + n53*n95) + n196 + n197 + n198 + n18*n239*n74*xF[9]/n170 + n18*n238*n73*xF[8]/n169 + n18*n237*n72*xF[7]/n168 + n18*n236*n94/n167 + n18*n233*n68*xF[3]/n164 + n18*n231*n66*xF[1]/n162 + n18*n230*n86/n161 + n18*n229*n62*xF[10]/n160));
-      NP_sqrt_base = (-NP0*n290 - n21*(-n57*n61*xF[0]/(pow(alpha, n17*(n85*(n119 - log(n78*(n19 + n23*xTj)/(n19 + n25*xTj) + 1)) + 1)) + n61 - 1) - n57*n62*xF[10]/(n62 - 1 + pow(alpha, -n5*(n85*(n119 - log(n78*(n19 + n23*xTj)/(n19 + n25*xTj) + 1)) + 1))) - n57*n66*xF[1]/(n66 - 1 + pow(alpha, -n7*(n85*(n119 - log(n78*(n19 + n23*xTj)/(n19 + n25*xTj) + 1)) + 1))) - n57*n68*xF[3]/(n68 - 1 + pow(alpha, -n9*(n85*(n119 - log(n78*(n19 + n23*xTj)/(n19 + n25*xTj) + 1)) + 1))) - n57*n69*xF[4]/(n69 - 1 + pow(alpha, -n10*(n85*(n119 - log(n78*(n19 + n23*xTj)/(n19 + n25*xTj) + 1)) + 1))) - n57*n72*xF[7]/(n72 - 1 + pow(alpha, -n13*(n85*(n119 - log(n78*(n19 + n23*xTj)/(n19 + n25*xTj) + 1)) + 1))) - n57*n73*xF[8]/(n73 - 1 + pow(alpha, -n14*(n85*(n119 - log(n78*(n19 + n23*xTj)/(n19 + n25*xTj) + 1)) + 1))) - n57*n74*xF[9]/(n74 - 1 + pow(alpha, -n15*(n85*(n119 - log(n78*(n19 + n23*xTj)/(n19 + n25*xTj) + 1)) + 1))) - n57*n86/(n65 - 1 + pow(alpha, -n6*(n85*(n119 - log(n78*(n19 + n23*xTj)/(n19 + n25*xTj) + 1)) + 1))) - n57*n94/(n71 - 1 + pow(alpha, -n12*(n85*(n119 - log(n78*(n19 + n23*xTj)/(n19 + n25*xTj) + 1)) + 1))) - n57*n96/(n67 - 1 + pow(alpha, -n8*(n85*(n119 - log(n78*(n19 + n23*xTj)/(n19 + n25*xTj) + 1)) + 1))) - n57*n98/(n70 - 1 + pow(alpha, -n11*(n85*(n119 - log(n78*(n19 + n23*xTj)/(n19 + n25*xTj) + 1)) + 1)))) - n25*n57*n61/(-n143 + n61 - 1) - pow(NP0, -n0)*(1.0*n183*n240*n57*n89 - 0.5*n190*n216*n243*n57 + 0.5*n200 + 0.5*n271 - 0.5*n292*xTj))*(-n0*n200 - n0*n21*(n106*pow(n152, n18)*n57*(pow(alpha, NP0*n1 - n121*n9)*n111*n84*n9/n118 - pow(alpha, n1*n24 - n121*n9)*pow(n118, n18)*n27*n32*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n9)*pow(n118, n18)*pow(n43, n18)*n64*n84*n9 + n117) + n106*n57*(pow(alpha, NP0*n1 - n121*n9)*n111*n2*n9/n118 + n104*n2)*(pow(alpha, NP0*n1 - n121*n9)*n111*n40*n9/n118 + n104*n40)/n164 + n107*pow(n158, n18)*n57*(pow(alpha, NP0*n1 - n121*n15)*n111*n15*n84/n118 - pow(alpha, n1*n24 - n121*n15)*n103*pow(n118, n18)*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n15)*pow(n118, n18)*n15*pow(n43, n18)*n64*n84 + n103*n55) + n107*n57*(pow(alpha, NP0*n1 - n121*n15)*n111*n15*n2/n118 + n2*n87)*(pow(alpha, NP0*n1 - n121*n15)*n111*n15*n40/n118 + n40*n87)/n170 + n109*pow(n157, n18)*n57*(pow(alpha, NP0*n1 - n121*n14)*n111*n14*n84/n118 + pow(alpha, n1*n24 - n121*n14)*pow(n118, n18)*n14*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n121*n14)*pow(n118, n18)*n27*n37*pow(n43, n18)*n64 + n115) + n109*n57*(pow(alpha, NP0*n1 - n121*n14)*n111*n14*n2/n118 + n2*n90)*(pow(alpha, NP0*n1 - n121*n14)*n111*n14*n40/n118 + n40*n90)/n169 - pow(n149, n18)*n57*n86*(pow(alpha, NP0*n1 - n121*n6)*n111*n6*n84/n118 - pow(alpha, n1*n24 - n121*n6)*pow(n118, n18)*n27*n29*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n6)*pow(n118, n18)*pow(n43, n18)*n6*n64*n84 + n113) + pow(n151, n18)*n57*n96*(pow(alpha, NP0*n1 - n121*n8)*n111*n17*n27*n8/n118 + pow(alpha, n1*n24 - n121*n8)*pow(n118, n18)*n17*n27*pow(n43, n18)*n64*n8 + pow(alpha, n1*n24 - n121*n8)*pow(n118, n18)*n27*n31*pow(n43, n18)*n64 + n27*n31*n80) + pow(n153, n18)*n57*n77*xF[4]*(pow(alpha, NP0*n1 - n10*n121)*n10*n111*n84/n118 + pow(alpha, n1*n24 - n10*n121)*n10*pow(n118, n18)*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n10*n121)*pow(n118, n18)*n27*n33*pow(n43, n18)*n64 + n27*n33*n50) + pow(n155, n18)*n57*n94*(pow(alpha, NP0*n1 - n12*n121)*n111*n12*n17*n27/n118 + pow(alpha, n1*n24 - n12*n121)*pow(n118, n18)*n12*n17*n27*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n12*n121)*pow(n118, n18)*n27*n35*pow(n43, n18)*n64 + n27*n35*n82) + n178*n57*n75*(pow(alpha, NP0*n1 - n12*n121)*n111*n12*n2/n118 + n2*n88)*(pow(alpha, NP0*n1 - n12*n121)*n111*n12*n40/n118 + n40*n88) + n179*n57*n76*(pow(alpha, NP0*n1 - n121*n5)*n111*n5*n84/n118 - pow(alpha, n1*n24 - n121*n5)*pow(n118, n18)*n27*n28*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n5)*pow(n118, n18)*pow(n43, n18)*n5*n64*n84 + n116) + n182*n57*n86*(pow(alpha, NP0*n1 - n121*n6)*n111*n2*n6/n118 + n110)*(pow(alpha, NP0*n1 - n121*n6)*n111*n40*n6/n118 + n40*n46*n6) + n188*n57*xF[0]*(pow(alpha, NP0*n1 - n1*n121)*n101*(-n19 + xPj*xTj)/(n118*n43) + n101*n78) + n189*n57*xF[1]*(pow(alpha, NP0*n1 - n121*n7)*n111*n59/n118 + n47*n59)*(pow(alpha, NP0*n1 - n121*n7)*n111*n40*n7/n118 + n100*n40) + n191*n57*(pow(alpha, NP0*n1 - n11*n121)*n11*n111*n84/n118 + pow(alpha, n1*n24 - n11*n121)*n11*pow(n118, n18)*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n11*n121)*pow(n118, n18)*pow(n43, n18)*n64*n91 + n51*n91) + n192*n57*(pow(alpha, NP0*n1 - n121*n13)*n111*n60/n118 + n53*n60)*(pow(alpha, NP0*n1 - n121*n13)*n111*n13*n40/n118 + n102*n40) + n193*n57*(pow(alpha, NP0*n1 - n121*n7)*n111*n7*n84/n118 + pow(alpha, n1*n24 - n121*n7)*pow(n118, n18)*pow(n43, n18)*n64*n7*n84 - pow(alpha, n1*n24 - n121*n7)*pow(n118, n18)*pow(n43, n18)*n64*n99 + n47*n99) + n194*n57*(pow(alpha, NP0*n1 - n121*n13)*n111*n13*n84/n118 + pow(alpha, n1*n24 - n121*n13)*pow(n118, n18)*n13*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n121*n13)*pow(n118, n18)*pow(n43, n18)*n64*n95 + n53*n95) + n200 + n201 + n202 + n203 + n204 + n205 + n206 + n207 + n208 + n209 + n210 + n211 + n258 + n259 + n260 + n261 + n262 + n263 + n264 + n265 + n266 + n267 + n268 + n269 - n57*n98*(pow(alpha, NP0*n1 - n11*n121)*n111*n58/n118 + n51*n58)*(pow(alpha, NP0*n1 - n11*n121)*n11*n111*n40/n118 + n11*n40*n51)/n166 + n57*n77*xF[4]*(pow(alpha, NP0*n1 - n10*n121)*n10*n111*n2/n118 + n2*n92)*(pow(alpha, NP0*n1 - n10*n121)*n10*n111*n40/n118 + n40*n92)/n165 - n57*n96*(pow(alpha, NP0*n1 - n121*n8)*n111*n2*n8/n118 + n2*n97)*(pow(alpha, NP0*n1 - n121*n8)*n111*n40*n8/n118 + n40*n97)/n163 + n57*n76*xF[10]*(pow(alpha, NP0*n1 - n121*n5)*n111*n2*n5/n118 + n2*n93)*(pow(alpha, NP0*n1 - n121*n5)*n111*n40*n5/n118 + n40*n93)/n160 + n25*n57*n61*(pow(alpha, NP0*n1 - n1*n121)*n1*n111*n2/n118 + n2*n89)*(pow(alpha, NP0*n1 - n1*n121)*n0*n111*n17*n2/n118 + n0*n17*n2*n42)/n159) - n0*n271 + 4.0*n183*n240*n57*n89 - 4.0*n190*n228*n57) + pow(-n24*(1.0*n183*n57*n89*xF[0]*(pow(alpha, NP0*n1 - n1*n121)*n1*n111*n2/n118 + n2*n89) + 0.5*n188*n57*xF[0]*(-pow(alpha, NP0*n1 - n1*n121)*n101*n111/n118 + n101*n78) - 0.5*n190*n57*(pow(alpha, NP0*n1 - n1*n121)*n1*n111*n2/n118 + n2*n89)*(pow(alpha, NP0*n1 - n1*n121)*n0*n111*n17*n2/n118 + n0*n17*n2*n42) + n212 - 0.5*xTj*(n106*pow(n152, n18)*n57*(pow(alpha, NP0*n1 - n121*n9)*n111*n84*n9/n118 - pow(alpha, n1*n24 - n121*n9)*pow(n118, n18)*n27*n32*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n9)*pow(n118, n18)*pow(n43, n18)*n64*n84*n9 + n117) + n106*n57*(pow(alpha, NP0*n1 - n121*n9)*n111*n2*n9/n118 + n104*n2)*(pow(alpha, NP0*n1 - n121*n9)*n111*n40*n9/n118 + n104*n40)/n164 + n107*pow(n158, n18)*n57*(pow(alpha, NP0*n1 - n121*n15)*n111*n15*n84/n118 - pow(alpha, n1*n24 - n121*n15)*n103*pow(n118, n18)*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n15)*pow(n118, n18)*n15*pow(n43, n18)*n64*n84 + n103*n55) + n107*n57*(pow(alpha, NP0*n1 - n121*n15)*n111*n15*n2/n118 + n2*n87)*(pow(alpha, NP0*n1 - n121*n15)*n111*n15*n40/n118 + n40*n87)/n170 + n109*pow(n157, n18)*n57*(pow(alpha, NP0*n1 - n121*n14)*n111*n14*n84/n118 + pow(alpha, n1*n24 - n121*n14)*pow(n118, n18)*n14*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n121*n14)*pow(n118, n18)*n27*n37*pow(n43, n18)*n64 + n115) + n109*n57*(pow(alpha, NP0*n1 - n121*n14)*n111*n14*n2/n118 + n2*n90)*(pow(alpha, NP0*n1 - n121*n14)*n111*n14*n40/n118 + n40*n90)/n169 - pow(n149, n18)*n57*n86*(pow(alpha, NP0*n1 - n121*n6)*n111*n6*n84/n118 - pow(alpha, n1*n24 - n121*n6)*pow(n118, n18)*n27*n29*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n6)*pow(n118, n18)*pow(n43, n18)*n6*n64*n84 + n113) + pow(n151, n18)*n57*n96*(pow(alpha, NP0*n1 - n121*n8)*n111*n17*n27*n8/n118 + pow(alpha, n1*n24 - n121*n8)*pow(n118, n18)*n17*n27*pow(n43, n18)*n64*n8 + pow(alpha, n1*n24 - n121*n8)*pow(n118, n18)*n27*n31*pow(n43, n18)*n64 + n27*n31*n80) + pow(n153, n18)*n57*n77*xF[4]*(pow(alpha, NP0*n1 - n10*n121)*n10*n111*n84/n118 + pow(alpha, n1*n24 - n10*n121)*n10*pow(n118, n18)*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n10*n121)*pow(n118, n18)*n27*n33*pow(n43, n18)*n64 + n27*n33*n50) + pow(n155, n18)*n57*n94*(pow(alpha, NP0*n1 - n12*n121)*n111*n12*n17*n27/n118 + pow(alpha, n1*n24 - n12*n121)*pow(n118, n18)*n12*n17*n27*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n12*n121)*pow(n118, n18)*n27*n35*pow(n43, n18)*n64 + n27*n35*n82) + n178*n57*n75*(pow(alpha, NP0*n1 - n12*n121)*n111*n12*n2/n118 + n2*n88)*(pow(alpha, NP0*n1 - n12*n121)*n111*n12*n40/n118 + n40*n88) + n179*n57*n76*(pow(alpha, NP0*n1 - n121*n5)*n111*n5*n84/n118 - pow(alpha, n1*n24 - n121*n5)*pow(n118, n18)*n27*n28*pow(n43, n18)*n64 + pow(alpha, n1*n24 - n121*n5)*pow(n118, n18)*pow(n43, n18)*n5*n64*n84 + n116) + n182*n57*n86*(pow(alpha, NP0*n1 - n121*n6)*n111*n2*n6/n118 + n110)*(pow(alpha, NP0*n1 - n121*n6)*n111*n40*n6/n118 + n40*n46*n6) + n188*n57*xF[0]*(-pow(alpha, NP0*n1 - n1*n121)*n101*n111/n118 + n101*n78) + n189*n57*xF[1]*(pow(alpha, NP0*n1 - n121*n7)*n111*n59/n118 + n47*n59)*(pow(alpha, NP0*n1 - n121*n7)*n111*n40*n7/n118 + n100*n40) + n191*n57*(pow(alpha, NP0*n1 - n11*n121)*n11*n111*n84/n118 + pow(alpha, n1*n24 - n11*n121)*n11*pow(n118, n18)*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n11*n121)*pow(n118, n18)*pow(n43, n18)*n64*n91 + n51*n91) + n192*n57*(pow(alpha, NP0*n1 - n121*n13)*n111*n60/n118 + n53*n60)*(pow(alpha, NP0*n1 - n121*n13)*n111*n13*n40/n118 + n102*n40) + n193*n57*(pow(alpha, NP0*n1 - n121*n7)*n111*n7*n84/n118 + pow(alpha, n1*n24 - n121*n7)*pow(n118, n18)*pow(n43, n18)*n64*n7*n84 - pow(alpha, n1*n24 - n121*n7)*pow(n118, n18)*pow(n43, n18)*n64*n99 + n47*n99) + n194*n57*(pow(alpha, NP0*n1 - n121*n13)*n111*n13*n84/n118 + pow(alpha, n1*n24 - n121*n13)*pow(n118, n18)*n13*pow(n43, n18)*n64*n84 - pow(alpha, n1*n24 - n121*n13)*pow(n118, n18)*pow(n43, n18)*n64*n95 + n53*n95) + n200 + n201 + n202 + n203 + n204 + n205 + n206 + n207 + n208 + n209 + n210 + n211 + n258 + n259 + n260 + n261 + n262 + n263 + n264 + n265 + n266 + n267 + n268 + n269 - n57*n98*(pow(alpha, NP0*n1 - n11*n121)*n111*n58/n118 + n51*n58)*(pow(alpha, NP0*n1 - n11*n121)*n11*n111*n40/n118 + n11*n40*n51)/n166 + n57*n77*xF[4]*(pow(alpha, NP0*n1 - n10*n121)*n10*n111*n2/n118 + n2*n92)*(pow(alpha, NP0*n1 - n10*n121)*n10*n111*n40/n118 + n40*n92)/n165 - n57*n96*(pow(alpha, NP0*n1 - n121*n8)*n111*n2*n8/n118 + n2*n97)*(pow(alpha, NP0*n1 - n121*n8)*n111*n40*n8/n118 + n40*n97)/n163 + n57*n76*xF[10]*(pow(alpha, NP0*n1 - n121*n5)*n111*n2*n5/n118 + n2*n93)*(pow(alpha, NP0*n1 - n121*n5)*n111*n40*n5/n118 + n40*n93)/n160 + n25*n57*n61*(pow(alpha, NP0*n1 - n1*n121)*n1*n111*n2/n118 + n2*n89)*(pow(alpha, NP0*n1 - n1*n121)*n0*n111*n17*n2/n118 + n0*n17*n2*n42)/n159)) - n290, -n0);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n85*(n119 - log(-pow(alpha, NP1*n1)*n111 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[10] - Mstar;
-      g5 = MW[11] - Mstar;
-      g6 = MW[2] - Mstar;
-      g7 = MW[3] - Mstar;
-      g8 = MW[4] - Mstar;
-      g9 = MW[5] - Mstar;
-      g10 = MW[6] - Mstar;
-      g11 = MW[7] - Mstar;
-      g12 = MW[8] - Mstar;
-      g13 = MW[9] - Mstar;
-      g14 = xF[0] - xTj;
-      g15 = xF[0] - xPj;
-      g16 = -xTj;
-      g17 = 1.0*xF[4];
-      g18 = xPj/xF[1];
-      g19 = pow(alpha, -g1);
-      g20 = pow(alpha, -g4);
-      g21 = pow(alpha, -g5);
-      g22 = pow(alpha, -g0);
-      g23 = pow(alpha, -g6);
-      g24 = pow(alpha, -g7);
-      g25 = pow(alpha, -g8);
-      g26 = pow(alpha, -g9);
-      g27 = pow(alpha, -g10);
-      g28 = pow(alpha, -g11);
-      g29 = pow(alpha, -g12);
-      g30 = pow(alpha, -g13);
-      g31 = log(xF[0]/xF[1]);
-      g32 = -g2;
-      g33 = pow(alpha, NP1*g0);
-      g34 = pow(alpha, NP1*g1);
-      g35 = pow(alpha, NP1*g4);
-      g36 = log(g19);
-      g37 = pow(alpha, NP1*g5);
-      g38 = pow(alpha, NP1*g6);
-      g39 = pow(alpha, NP1*g7);
-      g40 = pow(alpha, NP1*g8);
-      g41 = pow(alpha, NP1*g9);
-      g42 = pow(alpha, NP1*g10);
-      g43 = pow(alpha, NP1*g11);
-      g44 = pow(alpha, NP1*g12);
-      g45 = pow(alpha, NP1*g13);
-      g46 = -g31;
-      g47 = g14/g3;
-      g48 = g3/g14;
-      g49 = -g33 + 1;
-      g50 = -g33 + 1;
-      g51 = -g34 + 1;
-      g52 = -g35 + 1;
-      g53 = -g37 + 1;
-      g54 = -g38 + 1;
-      g55 = -g39 + 1;
-      g56 = -g40 + 1;
-      g57 = -g41 + 1;
-      g58 = -g42 + 1;
-      g59 = -g43 + 1;
-      g60 = -g44 + 1;
-      g61 = -g45 + 1;
-      g62 = -g34;
-      g63 = -g35;
-      g64 = -g37;
-      g65 = -g38;
-      g66 = -g39;
-      g67 = -g40;
-      g68 = -g41;
-      g69 = -g42;
-      g70 = -g43;
-      g71 = -g44;
-      g72 = -g45;
-      g73 = -1.0*g31;
-      g74 = -g3/g15;
-      g75 = g15/(g3*xF[1]);
-      g76 = g73*xF[0];
-      g77 = g73*xF[10];
-      g78 = g73*xF[11];
-      g79 = g73*xF[1];
-      g80 = g73*xF[2];
-      g81 = g73*xF[3];
-      g82 = g73*xF[4];
-      g83 = g73*xF[5];
-      g84 = g73*xF[6];
-      g85 = g73*xF[7];
-      g86 = g73*xF[8];
-      g87 = g73*xF[9];
-      g88 = pow(alpha, g0*g32) - 1;
-      g89 = pow(alpha, g0*g32) - 1;
-      g90 = pow(alpha, g1*g32) - 1;
-      g91 = pow(alpha, g32*g4) - 1;
-      g92 = pow(alpha, g32*g5) - 1;
-      g93 = pow(alpha, g32*g6) - 1;
-      g94 = pow(alpha, g32*g7) - 1;
-      g95 = pow(alpha, g32*g8) - 1;
-      g96 = pow(alpha, g32*g9) - 1;
-      g97 = pow(alpha, g10*g32) - 1;
-      g98 = pow(alpha, g11*g32) - 1;
-      g99 = pow(alpha, g12*g32) - 1;
-      g100 = pow(alpha, g13*g32) - 1;
-      g101 = -pow(alpha, g1*g32);
-      g102 = -pow(alpha, g32*g4);
-      g103 = -pow(alpha, g32*g5);
-      g104 = -pow(alpha, g32*g6);
-      g105 = -pow(alpha, g32*g7);
-      g106 = -pow(alpha, g32*g8);
-      g107 = -pow(alpha, g32*g9);
-      g108 = -pow(alpha, g10*g32);
-      g109 = -pow(alpha, g11*g32);
-      g110 = -pow(alpha, g12*g32);
-      g111 = -pow(alpha, g13*g32);
-      g112 = g50 + g89;
-      g113 = -g101 - g34;
-      g114 = -g102 - g35;
-      g115 = -g103 - g37;
-      g116 = -g104 - g38;
-      g117 = -g105 - g39;
-      g118 = -g106 - g40;
-      g119 = -g107 - g41;
-      g120 = -g108 - g42;
-      g121 = -g109 - g43;
-      g122 = -g110 - g44;
-      g123 = -g111 - g45;
-      g124 = pow(alpha, g1*g32) + g62;
-      g125 = g50 + g89;
-      g126 = pow(alpha, g32*g4) + g63;
-      g127 = pow(alpha, g32*g5) + g64;
-      g128 = pow(alpha, g32*g6) + g65;
-      g129 = pow(alpha, g32*g7) + g66;
-      g130 = pow(alpha, g32*g8) + g67;
-      g131 = pow(alpha, g32*g9) + g68;
-      g132 = pow(alpha, g10*g32) + g69;
-      g133 = pow(alpha, g11*g32) + g70;
-      g134 = pow(alpha, g12*g32) + g71;
-      g135 = pow(alpha, g13*g32) + g72;
-      g136 = xF[11]/g127;
-      g137 = xF[9]/g135;
-      g138 = xF[8]/g134;
-      g139 = xF[1]/g125;
-      g140 = xF[3]/g129;
-      g141 = xF[10]/g126;
-      g142 = xF[6]/g132;
-      g143 = xF[7]/g133;
-      g144 = xF[5]/g131;
-      g145 = xF[2]/g128;
-      g146 = xF[0]/g124;
-      g147 = xF[4]/g118;
-      g148 = xF[1]/g112;
-      g149 = xF[0]/g113;
-      g150 = xF[9]/g123;
-      g151 = xF[6]/g120;
-      g152 = xF[7]/g121;
-      g153 = xF[2]/g116;
-      g154 = xF[11]/g115;
-      g155 = xF[5]/g119;
-      g156 = xF[3]/g117;
-      g157 = xF[8]/g122;
-      g158 = xF[10]/g114;
-      g159 = 1.0*g149;
-      g160 = 1.0*g151;
-      g161 = 1.0*g153;
-      g162 = 1.0*g154;
-      g163 = 1.0*g155;
-      g164 = 1.0*g150;
-      g165 = 1.0*g157;
-      g166 = 1.0*g158;
-      g167 = 1.0*g156;
-      g168 = 1.0*g148;
-      g169 = 1.0*g152;
-      g170 = g58/g120;
-      g171 = g61/g123;
-      g172 = g56/g118;
-      g173 = g59/g121;
-      g174 = g51/g113;
-      g175 = g57/g119;
-      g176 = g55/g117;
-      g177 = g49/g112;
-      g178 = g53/g115;
-      g179 = g54/g116;
-      g180 = g52/g114;
-      g181 = g60/g122;
-      g182 = g147*g56;
-      g183 = g150*g61;
-      g184 = g149*g51;
-      g185 = g152*g59;
-      g186 = g153*g54;
-      g187 = g157*g60;
-      g188 = g156*g55;
-      g189 = g148*g49;
-      g190 = g155*g57;
-      g191 = g154*g53;
-      g192 = g151*g58;
-      g193 = g158*g52;
-      g194 = g88/g112;
-      g195 = g90/g113;
-      g196 = g92/g115;
-      g197 = g93/g116;
-      g198 = g94/g117;
-      g199 = g95/g118;
-      g200 = g99/g122;
-      g201 = g100/g123;
-      g202 = g97/g120;
-      g203 = g98/g121;
-      g204 = g91/g114;
-      g205 = g96/g119;
-      g206 = g148*g88;
-      g207 = g149*g90;
-      g208 = g151*g97;
-      g209 = g153*g93;
-      g210 = g154*g92;
-      g211 = g155*g96;
-      g212 = g100*g150;
-      g213 = g156*g94;
-      g214 = g157*g99;
-      g215 = g158*g91;
-      g216 = g152*g98;
-      g217 = log(g125*g16*g75/g50);
-      g218 = log(g112*g16*g75/g49);
-      g219 = log(g125*g18*g47/g89);
-      g220 = 1.0*g217;
-      g221 = log(g112*g18*g47/g88);
-      g222 = 1.0*g219;
-      g223 = g172*g218;
-      g224 = g170*g218;
-      g225 = g171*g218;
-      g226 = g174*g218;
-      g227 = g175*g218;
-      g228 = g179*g218;
-      g229 = g181*g218;
-      g230 = g178*g218;
-      g231 = g176*g218;
-      g232 = g180*g218;
-      g233 = g177*g218;
-      g234 = g173*g218;
-      g235 = g202*g221;
-      g236 = g196*g221;
-      g237 = g198*g221;
-      g238 = g195*g221;
-      g239 = g197*g221;
-      g240 = g205*g221;
-      g241 = g200*g221;
-      g242 = g201*g221;
-      g243 = g204*g221;
-      g244 = g194*g221;
-      g245 = g203*g221;
-      g246 = g199*g221;
-      g247 = g76 + g77 + g78 + g79 + g80 + g81 + g82 + g83 + g84 + g85 + g86 + g87;
-      LpF = xF[0]*(g19 + 1.0)*(g226 + g238 + g46)/(g36*(g19 - 1.0)) + xF[10]*(g20 + 1.0)*(g232 + g243 + g46)/(g36*(g20 - 1.0)) + xF[11]*(g21 + 1.0)*(g230 + g236 + g46)/(g36*(g21 - 1.0)) + xF[1]*(g22 + 1.0)*(g233 + g244 + g46)/(g36*(g22 - 1.0)) + xF[2]*(g23 + 1.0)*(g228 + g239 + g46)/(g36*(g23 - 1.0)) + xF[3]*(g24 + 1.0)*(g231 + g237 + g46)/(g36*(g24 - 1.0)) + xF[4]*(g25 + 1.0)*(g223 + g246 + g46)/(g36*(g25 - 1.0)) + xF[5]*(g26 + 1.0)*(g227 + g240 + g46)/(g36*(g26 - 1.0)) + xF[6]*(g27 + 1.0)*(g224 + g235 + g46)/(g36*(g27 - 1.0)) + xF[7]*(g28 + 1.0)*(g234 + g245 + g46)/(g36*(g28 - 1.0)) + xF[8]*(g29 + 1.0)*(g229 + g241 + g46)/(g36*(g29 - 1.0)) + xF[9]*(g30 + 1.0)*(g225 + g242 + g46)/(g36*(g30 - 1.0));
-      PpF = g47;
-      TpF = -g15/g3;
-      SWUpF = -g136*g220*(g64 + 1) - g136*g222*(pow(alpha, g32*g5) - 1) - g137*g220*(g72 + 1) - g137*g222*(pow(alpha, g13*g32) - 1) - g138*g220*(g71 + 1) - g138*g222*(pow(alpha, g12*g32) - 1) - g139*g220*g50 - g139*g222*g89 - g140*g220*(g66 + 1) - g140*g222*(pow(alpha, g32*g7) - 1) - g141*g220*(g63 + 1) - g141*g222*(pow(alpha, g32*g4) - 1) - g142*g220*(g69 + 1) - g142*g222*(pow(alpha, g10*g32) - 1) - g143*g220*(g70 + 1) - g143*g222*(pow(alpha, g11*g32) - 1) - g144*g220*(g68 + 1) - g144*g222*(pow(alpha, g32*g9) - 1) - g145*g220*(g65 + 1) - g145*g222*(pow(alpha, g32*g6) - 1) - g146*g220*(g62 + 1) - g146*g222*(pow(alpha, g1*g32) - 1) - g247 - g17*g217*(g67 + 1)/g130 - g17*g219*(pow(alpha, g32*g8) - 1)/g130;
-      SWUpP = -g48*(g100*g164*g221 + g159*g218*g51 + g159*g221*g90 + g160*g218*g58 + g160*g221*g97 + g161*g218*g54 + g161*g221*g93 + g162*g218*g53 + g162*g221*g92 + g163*g218*g57 + g163*g221*g96 + g164*g218*g61 + g165*g218*g60 + g165*g221*g99 + g166*g218*g52 + g166*g221*g91 + g167*g218*g55 + g167*g221*g94 + g168*g218*g49 + g168*g221*g88 + g169*g218*g59 + g169*g221*g98 + g17*g223 + g17*g246 + g247);
-      xP[0] = g207*g48;
-      xP[1] = g206*g48;
-      xP[2] = g209*g48;
-      xP[3] = g213*g48;
-      xP[4] = g147*g48*g95;
-      xP[5] = g211*g48;
-      xP[6] = g208*g48;
-      xP[7] = g216*g48;
-      xP[8] = g214*g48;
-      xP[9] = g212*g48;
-      xP[10] = g215*g48;
-      xP[11] = g210*g48;
-      xT[0] = g184*g74;
-      xT[1] = g189*g74;
-      xT[2] = g186*g74;
-      xT[3] = g188*g74;
-      xT[4] = g182*g74;
-      xT[5] = g190*g74;
-      xT[6] = g192*g74;
-      xT[7] = g185*g74;
-      xT[8] = g187*g74;
-      xT[9] = g183*g74;
-      xT[10] = g193*g74;
-      xT[11] = g191*g74;
-      break;
-    case 13:
-      n0 = -0.500000000000000;
-      n1 = -2.00000000000000;
-      n2 = MW[0] - Mstar;
-      n3 = log(alpha);
-      n4 = xPj - xTj;
-      n5 = xF[0] - xPj;
-      n6 = MW[10] - Mstar;
-      n7 = MW[11] - Mstar;
-      n8 = MW[12] - Mstar;
-      n9 = MW[1] - Mstar;
-      n10 = MW[2] - Mstar;
-      n11 = MW[3] - Mstar;
-      n12 = MW[4] - Mstar;
-      n13 = MW[5] - Mstar;
-      n14 = MW[6] - Mstar;
-      n15 = MW[7] - Mstar;
-      n16 = MW[8] - Mstar;
-      n17 = MW[9] - Mstar;
-      n18 = log(xTj);
-      n19 = -n2;
-      n20 = -2;
-      n21 = xF[0]*xPj;
-      n22 = -Mstar;
-      n23 = -n1*xF[11];
-      n24 = -xTj;
-      n25 = -NP0*n1;
-      n26 = pow(n2, -n1);
-      n27 = pow(n3, -n1);
-      n28 = pow(n6, -n1);
-      n29 = pow(n7, -n1);
-      n30 = pow(n8, -n1);
-      n31 = pow(n9, -n1);
-      n32 = pow(n10, -n1);
-      n33 = pow(n11, -n1);
-      n34 = pow(n12, -n1);
-      n35 = pow(n13, -n1);
-      n36 = pow(n14, -n1);
-      n37 = pow(n15, -n1);
-      n38 = pow(n16, -n1);
-      n39 = pow(n17, -n1);
-      n40 = Mstar*n3;
-      n41 = -n1*n3;
-      n42 = pow(alpha, NP0*n2);
-      n43 = n21 + n24*xF[0];
-      n44 = n21 + n24*xPj;
-      n45 = pow(alpha, NP0*n6);
-      n46 = pow(alpha, NP0*n7);
-      n47 = pow(alpha, NP0*n8);
-      n48 = pow(alpha, NP0*n9);
-      n49 = pow(alpha, NP0*n10);
-      n50 = pow(alpha, NP0*n11);
-      n51 = pow(alpha, NP0*n12);
-      n52 = pow(alpha, NP0*n13);
-      n53 = pow(alpha, NP0*n14);
-      n54 = pow(alpha, NP0*n15);
-      n55 = pow(alpha, NP0*n16);
-      n56 = pow(alpha, NP0*n17);
-      n57 = -MW[0]*n3;
-      n58 = n4/n5;
-      n59 = n13*n3;
-      n60 = n3*n9;
-      n61 = -n33;
-      n62 = n2*n3;
-      n63 = n15*n3;
-      n64 = -n42 + 1;
-      n65 = -n45 + 1;
-      n66 = pow(alpha, NP0*n1*n19);
-      n67 = pow(n44, -n1);
-      n68 = -n46 + 1;
-      n69 = -n47 + 1;
-      n70 = -n48 + 1;
-      n71 = -n49 + 1;
-      n72 = -n50 + 1;
-      n73 = -n51 + 1;
-      n74 = -n52 + 1;
-      n75 = -n53 + 1;
-      n76 = -n54 + 1;
-      n77 = -n55 + 1;
-      n78 = -n56 + 1;
-      n79 = -n72;
-      n80 = -n75;
-      n81 = -n73;
-      n82 = -n42;
-      n83 = -n46;
-      n84 = -n47;
-      n85 = -n49;
-      n86 = -n52;
-      n87 = -n53;
-      n88 = -n56;
-      n89 = n42*xF[0];
-      n90 = 1.0/n62;
-      n91 = n68*xF[11];
-      n92 = n11*n50;
-      n93 = n14*n53;
-      n94 = n16*n55;
-      n95 = n27*n35;
-      n96 = n3*n51;
-      n97 = n26*n27;
-      n98 = n2*n42;
-      n99 = n27*n37;
-      n100 = n10*n49;
-      n101 = n71*xF[2];
-      n102 = n64*xF[0];
-      n103 = n17*n56;
-      n104 = n27*n30;
-      n105 = n27*n31;
-      n106 = n45*n6;
-      n107 = n48*n9;
-      n108 = n74*xF[5];
-      n109 = n47*n8;
-      n110 = n15*n54;
-      n111 = n27*n39;
-      n112 = log((-1.0 + xPj/xF[0])/n4);
-      n113 = -n69*xF[12];
-      n114 = -n78*xF[9];
-      n115 = n106*xF[10];
-      n116 = -n65*xF[10];
-      n117 = -n77*xF[8];
-      n118 = -n76*xF[7];
-      n119 = n3*n46*n7;
-      n120 = n44/n43;
-      n121 = n109*n3*xF[12];
-      n122 = n27*n29*n46;
-      n123 = n27*n32*n49;
-      n124 = n27*n38*n55;
-      n125 = n27*n34*n51;
-      n126 = n27*n28*n45;
-      n127 = n27*n36*n53;
-      n128 = n27*n33*n50;
-      n129 = n120*n82 + 1;
-      n130 = n112 + n18 + n40 + n57;
-      n131 = n120/n129;
-      n132 = n131*n27;
-      n133 = n131*n3*n42;
-      n134 = n90*(n130 - log(n129)) + 1;
-      n135 = pow(alpha, n134*n2);
-      n136 = pow(alpha, n134*n6);
-      n137 = pow(alpha, n134*n7);
-      n138 = pow(alpha, n134*n8);
-      n139 = pow(alpha, n134*n9);
-      n140 = pow(alpha, n10*n134);
-      n141 = pow(alpha, n11*n134);
-      n142 = pow(alpha, n12*n134);
-      n143 = pow(alpha, n13*n134);
-      n144 = pow(alpha, n134*n14);
-      n145 = pow(alpha, n134*n15);
-      n146 = pow(alpha, n134*n16);
-      n147 = pow(alpha, n134*n17);
-      n148 = n8/n138;
-      n149 = n15/n145;
-      n150 = n17/n147;
-      n151 = n11/n141;
-      n152 = n14/n144;
-      n153 = n16/n146;
-      n154 = n7/n137;
-      n155 = n9/n139;
-      n156 = n10/n140;
-      n157 = n6/n136;
-      n158 = n12/n142;
-      n159 = n13/n143;
-      n160 = n29/n137;
-      n161 = n42/n143;
-      n162 = pow(alpha, n134*n19) + n64 - 1;
-      n163 = n65 - 1 + 1.0/n136;
-      n164 = n68 - 1 + 1.0/n137;
-      n165 = n69 - 1 + 1.0/n138;
-      n166 = n70 - 1 + 1.0/n139;
-      n167 = n71 - 1 + 1.0/n140;
-      n168 = n72 - 1 + 1.0/n141;
-      n169 = n73 - 1 + 1.0/n142;
-      n170 = n74 - 1 + 1.0/n143;
-      n171 = n75 - 1 + 1.0/n144;
-      n172 = n76 - 1 + 1.0/n145;
-      n173 = n77 - 1 + 1.0/n146;
-      n174 = n78 - 1 + 1.0/n147;
-      n175 = pow(n162, 3);
-      n176 = pow(n163, 3);
-      n177 = pow(n164, 3);
-      n178 = pow(n165, 3);
-      n179 = pow(n166, 3);
-      n180 = pow(n167, 3);
-      n181 = pow(n168, 3);
-      n182 = pow(n169, 3);
-      n183 = pow(n170, 3);
-      n184 = pow(n171, 3);
-      n185 = pow(n172, 3);
-      n186 = pow(n173, 3);
-      n187 = pow(n174, 3);
-      n188 = xF[2]/n167;
-      n189 = xF[11]/n164;
-      n190 = xF[4]/n169;
-      n191 = xF[3]/n168;
-      n192 = xF[8]/n173;
-      n193 = xF[6]/n171;
-      n194 = xF[10]/n163;
-      n195 = pow(n168, n20)*xF[3];
-      n196 = xF[6]/n184;
-      n197 = n3/n163;
-      n198 = -1/n162;
-      n199 = xF[4]/n182;
-      n200 = n3*xF[9]/n174;
-      n201 = n52*xF[5]/n170;
-      n202 = n48*xF[1]/n166;
-      n203 = n54*xF[7]/n172;
-      n204 = n47*xF[12]/n165;
-      n205 = n70/n179;
-      n206 = pow(n162, n20)*n64;
-      n207 = -n108*pow(n170, n20);
-      n208 = n118/n185;
-      n209 = -pow(n166, n20)*n70*xF[1];
-      n210 = n111*n56*xF[9]/n174;
-      n211 = n58*n89/(n162*n90);
-      n212 = n19*n3*n58*n89/n162;
-      n213 = n58*n89*n97/n162;
-      n214 = n126*n194*n58;
-      n215 = n122*n189*n58;
-      n216 = n104*n204*n58;
-      n217 = n105*n202*n58;
-      n218 = n123*n188*n58;
-      n219 = n128*n191*n58;
-      n220 = n125*n190*n58;
-      n221 = n201*n58*n95;
-      n222 = n127*n193*n58;
-      n223 = n203*n58*n99;
-      n224 = n124*n192*n58;
-      n225 = n210*n58;
-      n226 = n0*n58*n82*n97*xF[0]/n162;
-      n227 = n131/n135 + 1;
-      n228 = n131*n42/(n135*n90) + n42/n90;
-      n229 = n106*n3 + n133*n157;
-      n230 = n119 + n133*n154;
-      n231 = n109*n3 + n133*n148;
-      n232 = n131*n42*n60/n139 + n48*n60;
-      n233 = n100*n3 + n133*n156;
-      n234 = n133*n151 + n3*n92;
-      n235 = n12*n96 + n133*n158;
-      n236 = n131*n161*n59 + n52*n59;
-      n237 = n133*n152 + n3*n93;
-      n238 = n131*n42*n63/n145 + n54*n63;
-      n239 = n133*n153 + n3*n94;
-      n240 = n103*n3 + n133*n150;
-      n241 = pow(n228, -n1);
-      n242 = pow(n229, -n1);
-      n243 = pow(n230, -n1);
-      n244 = pow(n231, -n1);
-      n245 = pow(n232, -n1);
-      n246 = pow(n233, -n1);
-      n247 = pow(n234, -n1);
-      n248 = pow(n235, -n1);
-      n249 = pow(n236, -n1);
-      n250 = pow(n237, -n1);
-      n251 = pow(n238, -n1);
-      n252 = pow(n239, -n1);
-      n253 = pow(n240, -n1);
-      n254 = n232*xF[1];
-      n255 = n1*n133*n19/n135 + n1*n19*n3*n42;
-      n256 = n245*xF[1];
-      n257 = n131*n82*n97/n135 + n82*n97;
-      n258 = pow(n165, n20)*n231;
-      n259 = pow(n162, n20)*n228;
-      n260 = pow(n164, n20)*n230;
-      n261 = pow(n174, n20)*n240;
-      n262 = pow(n163, n20)*n229;
-      n263 = pow(n172, n20)*n238;
-      n264 = pow(n173, n20)*n239;
-      n265 = pow(n171, n20)*n237*xF[6];
-      n266 = n241/n175;
-      n267 = n246/n180;
-      n268 = pow(n169, n20)*n235*xF[4];
-      n269 = n249/n183;
-      n270 = n243/n177;
-      n271 = pow(n162, n20)*n257;
-      n272 = -n102*n259*n58;
-      n273 = n1*pow(n162, n20)*n19*n3*n58*n89*(pow(alpha, NP0*n2 + n134*n19)*n131/n90 + n42/n90);
-      n274 = n115*pow(n163, n20)*n41*n58*(pow(alpha, NP0*n2 - n134*n6)*n131*n3*n6 + n106*n3);
-      n275 = n119*pow(n164, n20)*n23*n58*(pow(alpha, NP0*n2 - n134*n7)*n131*n3*n7 + n119);
-      n276 = n109*pow(n165, n20)*n41*n58*xF[12]*(pow(alpha, NP0*n2 - n134*n8)*n131*n3*n8 + n109*n3);
-      n277 = n107*pow(n166, n20)*n41*n58*xF[1]*(pow(alpha, NP0*n2 - n134*n9)*n131*n60 + n48*n60);
-      n278 = n100*pow(n167, n20)*n41*n58*xF[2]*(pow(alpha, NP0*n2 - n10*n134)*n10*n131*n3 + n100*n3);
-      n279 = n195*n41*n58*n92*(pow(alpha, NP0*n2 - n11*n134)*n11*n131*n3 + n3*n92);
-      n280 = n12*pow(n169, n20)*n41*n51*n58*xF[4]*(pow(alpha, NP0*n2 - n12*n134)*n12*n131*n3 + n12*n96);
-      n281 = n13*pow(n170, n20)*n41*n52*n58*xF[5]*(pow(alpha, NP0*n2 - n13*n134)*n131*n59 + n52*n59);
-      n282 = pow(n171, n20)*n41*n58*n93*xF[6]*(pow(alpha, NP0*n2 - n134*n14)*n131*n14*n3 + n3*n93);
-      n283 = n110*pow(n172, n20)*n41*n58*xF[7]*(pow(alpha, NP0*n2 - n134*n15)*n131*n63 + n54*n63);
-      n284 = pow(n173, n20)*n41*n58*n94*xF[8]*(pow(alpha, NP0*n2 - n134*n16)*n131*n16*n3 + n3*n94);
-      n285 = n103*pow(n174, n20)*n41*n58*xF[9]*(pow(alpha, NP0*n2 - n134*n17)*n131*n17*n3 + n103*n3);
-      n286 = 1.0*n259*n58*n89/n90;
-      n287 = n102*n271*n58;
-      n288 = -n0*n287;
-      n289 = n211 + n272;
-      n290 = n228*n255/n175;
-      n291 = pow(alpha, n2*n25)*pow(n129, n20)*n157*n2*n27*pow(n43, n20)*n67 - pow(alpha, n2*n25)*pow(n129, n20)*n27*n28*pow(n43, n20)*n67/n136 + n126 + n132*n157*n98;
-      n292 = pow(alpha, n2*n25)*pow(n129, n20)*n154*n19*n27*pow(n43, n20)*n67 + pow(alpha, n2*n25)*pow(n129, n20)*n160*n27*pow(n43, n20)*n67 + n132*n154*n19*n42 + n27*n29*n83;
-      n293 = pow(alpha, n2*n25)*n104*pow(n129, n20)*pow(n43, n20)*n67/n138 + pow(alpha, n2*n25)*pow(n129, n20)*n148*n19*n27*pow(n43, n20)*n67 + n104*n84 + n132*n148*n19*n42;
-      n294 = pow(alpha, n2*n25)*pow(n129, n20)*n156*n19*n27*pow(n43, n20)*n67 + pow(alpha, n2*n25)*pow(n129, n20)*n27*n32*pow(n43, n20)*n67/n140 + n132*n156*n19*n42 + n27*n32*n85;
-      n295 = pow(alpha, n2*n25)*pow(n129, n20)*n158*n2*n27*pow(n43, n20)*n67 - pow(alpha, n2*n25)*pow(n129, n20)*n27*n34*pow(n43, n20)*n67/n142 + n125 + n132*n158*n98;
-      n296 = pow(alpha, n2*n25)*pow(n129, n20)*n152*n19*n27*pow(n43, n20)*n67 + pow(alpha, n2*n25)*pow(n129, n20)*n27*n36*pow(n43, n20)*n67/n144 + n132*n152*n19*n42 + n27*n36*n87;
-      n297 = pow(alpha, n2*n25)*pow(n129, n20)*n149*n2*n27*pow(n43, n20)*n67 - pow(alpha, n2*n25)*pow(n129, n20)*pow(n43, n20)*n67*n99/n145 + n132*n149*n98 + n54*n99;
-      n298 = pow(alpha, n2*n25)*pow(n129, n20)*n153*n2*n27*pow(n43, n20)*n67 - pow(alpha, n2*n25)*pow(n129, n20)*n27*n38*pow(n43, n20)*n67/n146 + n124 + n132*n153*n98;
-      n299 = pow(n165, n20)*n58*n69*xF[12]*(pow(alpha, -n134*n8 + n2*n25)*n104*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n8 + n2*n25)*pow(n129, n20)*n19*n27*pow(n43, n20)*n67*n8 + n104*n84 + n132*n148*n19*n42);
-      n300 = n101*pow(n167, n20)*n58*(pow(alpha, -n10*n134 + n2*n25)*n10*pow(n129, n20)*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n10*n134 + n2*n25)*pow(n129, n20)*n27*n32*pow(n43, n20)*n67 + n132*n156*n19*n42 + n27*n32*n85);
-      n301 = pow(n171, n20)*n58*n75*xF[6]*(pow(alpha, -n134*n14 + n2*n25)*pow(n129, n20)*n14*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n134*n14 + n2*n25)*pow(n129, n20)*n27*n36*pow(n43, n20)*n67 + n132*n152*n19*n42 + n27*n36*n87);
-      n302 = n116*pow(n163, n20)*n58*(pow(alpha, -n134*n6 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n6*n67 - pow(alpha, -n134*n6 + n2*n25)*pow(n129, n20)*n27*n28*pow(n43, n20)*n67 + n126 + n132*n157*n98);
-      n303 = n209*n58*(-pow(alpha, -n134*n9 + n2*n25)*n105*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n9 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n67*n9 + n105*n48 + n132*n155*n98);
-      n304 = pow(n169, n20)*n58*n81*xF[4]*(pow(alpha, -n12*n134 + n2*n25)*n12*pow(n129, n20)*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n12*n134 + n2*n25)*pow(n129, n20)*n27*n34*pow(n43, n20)*n67 + n125 + n132*n158*n98);
-      n305 = n207*n58*(pow(alpha, -n13*n134 + n2*n25)*pow(n129, n20)*n13*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n13*n134 + n2*n25)*pow(n129, n20)*pow(n43, n20)*n67*n95 + n132*n159*n98 + n52*n95);
-      n306 = n118*pow(n172, n20)*n58*(pow(alpha, -n134*n15 + n2*n25)*pow(n129, n20)*n15*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n134*n15 + n2*n25)*pow(n129, n20)*pow(n43, n20)*n67*n99 + n132*n149*n98 + n54*n99);
-      n307 = n117*pow(n173, n20)*n58*(pow(alpha, -n134*n16 + n2*n25)*pow(n129, n20)*n16*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n134*n16 + n2*n25)*pow(n129, n20)*n27*n38*pow(n43, n20)*n67 + n124 + n132*n153*n98);
-      n308 = n114*pow(n174, n20)*n58*(-pow(alpha, -n134*n17 + n2*n25)*n111*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n17 + n2*n25)*pow(n129, n20)*n17*n2*n27*pow(n43, n20)*n67 + n111*n56 + n132*n150*n98);
-      n309 = n226 + n286 + n288;
-      n310 = n100*n188*n3*n58 - n101*pow(n167, n20)*n233*n58 + n103*n200*n58 + n113*n258*n58 + n114*n261*n58 + n115*n197*n58 + n116*n262*n58 + n117*n264*n58 + n118*n263*n58 + n119*n189*n58 + n12*n190*n58*n96 + n121*n58/n165 + n191*n3*n58*n92 + n192*n3*n58*n94 + n193*n3*n58*n93 + n195*n234*n58*n79 + n201*n58*n59 + n202*n58*n60 + n203*n58*n63 + n207*n236*n58 + n209*n232*n58 - n260*n58*n91 + n265*n58*n80 + n268*n58*n81 + n289;
-      n311 = n310*xTj;
-      n312 = n213 + n214 + n215 + n216 + n217 + n218 + n219 + n220 + n221 + n222 + n223 + n224 + n225 + n273 + n274 + n275 + n276 + n277 + n278 + n279 + n280 + n281 + n282 + n283 + n284 + n285 + n287 + n299 + n300 + n301 + n302 + n303 + n304 + n305 + n306 + n307 + n308;
-      n313 = -n101*n233*n58*(n100*n41 + n131*n156*n41*n42)/n180 - n102*n290*n58 - n108*n236*n58*(n13*n41*n52 + n131*n159*n41*n42)/n183 + n113*n231*n58*(n109*n41 + n131*n148*n41*n42)/n178 + n114*n240*n58*(n103*n41 + n131*n150*n41*n42)/n187 + n116*n229*n58*(n106*n41 + n131*n157*n41*n42)/n176 + n117*n239*n58*(n131*n153*n41*n42 + n41*n94)/n186 - pow(n164, n20)*n58*n91*(pow(alpha, -n134*n7 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n67*n7 - pow(alpha, -n134*n7 + n2*n25)*pow(n129, n20)*n27*n29*pow(n43, n20)*n67 + n122 + n132*n154*n98) + n195*n58*n72*(pow(alpha, -n11*n134 + n2*n25)*n11*pow(n129, n20)*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n11*n134 + n2*n25)*pow(n129, n20)*n27*n33*pow(n43, n20)*n67 + n132*n151*n19*n42 + n27*n50*n61) + n196*n237*n58*n80*(n131*n152*n41*n42 + n41*n93) + n199*n235*n58*n81*(n12*n41*n51 + n131*n158*n41*n42) - n205*n254*n58*(n107*n41 + n131*n155*n41*n42) + n208*n238*n58*(n110*n41 + n131*n149*n41*n42) + n312 + n234*n58*n79*xF[3]*(n131*n151*n41*n42 + n41*n92)/n181 - n230*n58*n91*(n131*n154*n41*n42 + n41*n46*n7)/n177;
-      n314 = n313*xTj;
-      NP_b = -n206*n227*n58*n89/n90 - n212 - n25*(-n0*n102*pow(n162, n20)*n58*(-pow(alpha, NP0*n2 - n134*n2)*n131*n97 + n82*n97) + n0*xTj*(n101*pow(n167, n20)*n58*(pow(alpha, NP0*n2 - n10*n134)*n10*n132*n19 + pow(alpha, -n10*n134 + n2*n25)*n10*pow(n129, n20)*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n10*n134 + n2*n25)*pow(n129, n20)*n27*n32*pow(n43, n20)*n67 + n27*n32*n85) + n101*n20*n267*n58 + n102*pow(n162, n20)*n58*(-pow(alpha, NP0*n2 - n134*n2)*n131*n97 + n82*n97) + n102*n20*n266*n58 + n108*n20*n269*n58 + n114*pow(n174, n20)*n58*(pow(alpha, NP0*n2 - n134*n17)*n132*n17*n2 - pow(alpha, -n134*n17 + n2*n25)*n111*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n17 + n2*n25)*pow(n129, n20)*n17*n2*n27*pow(n43, n20)*n67 + n111*n56) + n116*pow(n163, n20)*n58*(pow(alpha, NP0*n2 - n134*n6)*n132*n2*n6 + pow(alpha, -n134*n6 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n6*n67 - pow(alpha, -n134*n6 + n2*n25)*pow(n129, n20)*n27*n28*pow(n43, n20)*n67 + n126) + n117*pow(n173, n20)*n58*(pow(alpha, NP0*n2 - n134*n16)*n132*n16*n2 + pow(alpha, -n134*n16 + n2*n25)*pow(n129, n20)*n16*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n134*n16 + n2*n25)*pow(n129, n20)*n27*n38*pow(n43, n20)*n67 + n124) + n118*pow(n172, n20)*n58*(pow(alpha, NP0*n2 - n134*n15)*n132*n15*n2 + pow(alpha, -n134*n15 + n2*n25)*pow(n129, n20)*n15*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n134*n15 + n2*n25)*pow(n129, n20)*pow(n43, n20)*n67*n99 + n54*n99) + pow(n164, n20)*n58*n91*(pow(alpha, NP0*n2 - n134*n7)*n132*n19*n7 + pow(alpha, -n134*n7 + n2*n25)*pow(n129, n20)*n19*n27*pow(n43, n20)*n67*n7 + pow(alpha, -n134*n7 + n2*n25)*pow(n129, n20)*n27*n29*pow(n43, n20)*n67 + n27*n29*n83) + pow(n165, n20)*n58*n69*xF[12]*(pow(alpha, NP0*n2 - n134*n8)*n132*n19*n8 + pow(alpha, -n134*n8 + n2*n25)*n104*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n8 + n2*n25)*pow(n129, n20)*n19*n27*pow(n43, n20)*n67*n8 + n104*n84) + pow(n169, n20)*n58*n81*xF[4]*(pow(alpha, NP0*n2 - n12*n134)*n12*n132*n2 + pow(alpha, -n12*n134 + n2*n25)*n12*pow(n129, n20)*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n12*n134 + n2*n25)*pow(n129, n20)*n27*n34*pow(n43, n20)*n67 + n125) + pow(n171, n20)*n58*n75*xF[6]*(pow(alpha, NP0*n2 - n134*n14)*n132*n14*n19 + pow(alpha, -n134*n14 + n2*n25)*pow(n129, n20)*n14*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n134*n14 + n2*n25)*pow(n129, n20)*n27*n36*pow(n43, n20)*n67 + n27*n36*n87) + n195*n58*n79*(pow(alpha, NP0*n2 - n11*n134)*n11*n132*n2 + pow(alpha, -n11*n134 + n2*n25)*n11*pow(n129, n20)*n2*n27*pow(n43, n20)*n67 + pow(alpha, -n11*n134 + n2*n25)*pow(n129, n20)*n27*pow(n43, n20)*n61*n67 + n128) + n196*n20*n250*n58*n75 + n199*n20*n248*n58*n73 + n20*n205*n256*n58 + n20*n270*n58*n91 + n207*n58*(pow(alpha, NP0*n2 - n13*n134)*n13*n132*n2 + pow(alpha, -n13*n134 + n2*n25)*pow(n129, n20)*n13*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n13*n134 + n2*n25)*pow(n129, n20)*pow(n43, n20)*n67*n95 + n52*n95) + n209*n58*(pow(alpha, NP0*n2 - n134*n9)*n132*n2*n9 - pow(alpha, -n134*n9 + n2*n25)*n105*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n9 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n67*n9 + n105*n48) + n213 + n214 + n215 + n216 + n217 + n218 + n219 + n220 + n221 + n222 + n223 + n224 + n225 + n273 + n274 + n275 + n276 + n277 + n278 + n279 + n280 + n281 + n282 + n283 + n284 + n285 + n20*n253*n58*n78*xF[9]/n187 + n20*n252*n58*n77*xF[8]/n186 + n20*n251*n58*n76*xF[7]/n185 + n20*n247*n58*n72*xF[3]/n181 + n20*n244*n58*n69*xF[12]/n178 + n20*n242*n58*n65*xF[10]/n176) - 1.0*n102*n266*n58 + 1.0*pow(n162, n20)*n58*n89*(pow(alpha, NP0*n2 - n134*n2)*n131/n90 + n42/n90)/n90 + n226) - n58*xTj*(n100*n188*n3 - n101*pow(n167, n20)*n233 - n102*n259 + n103*n200 + n113*n258 + n114*n261 + n115*n197 + n116*n262 + n117*n264 + n118*n263 + n119*n189 + n12*n190*n96 + n121/n165 + n191*n3*n92 + n192*n3*n94 + n193*n3*n93 + n195*n234*n79 + n201*n59 + n202*n60 + n203*n63 + n207*n236 + n209*n232 - n260*n91 + n265*n80 + n268*n81 + n89/(n162*n90));
-      NP_2a = -n58*(-pow(alpha, n2*n25)*n1*n102*pow(n227, -n1)*n97/n175 + pow(alpha, n2*n25)*n1*pow(n162, n20)*n227*n97*xF[0] + n102*pow(n162, n20)*n82*n97*(-1 + (-n21 + xPj*xTj)/(n129*n135*n43)) + 1.0*xTj*(n1*pow(n162, n20)*n19*n3*n89*(pow(alpha, NP0*n2 + n134*n19)*n131/n90 + n42/n90) + n100*pow(n167, n20)*n41*xF[2]*(pow(alpha, NP0*n2 - n10*n134)*n10*n131*n3 + n100*n3) + n101*pow(n167, n20)*(pow(alpha, -n10*n134 + n2*n25)*n10*pow(n129, n20)*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n10*n134 + n2*n25)*pow(n129, n20)*n27*n32*pow(n43, n20)*n67 + n132*n156*n19*n42 + n27*n32*n85) + n101*n20*n267 + n102*n20*n266 + n102*n271 + n103*pow(n174, n20)*n41*xF[9]*(pow(alpha, NP0*n2 - n134*n17)*n131*n17*n3 + n103*n3) + n104*n204 + n105*n202 + n107*pow(n166, n20)*n41*xF[1]*(pow(alpha, NP0*n2 - n134*n9)*n131*n60 + n48*n60) + n108*n20*n269 + n109*pow(n165, n20)*n41*xF[12]*(pow(alpha, NP0*n2 - n134*n8)*n131*n3*n8 + n109*n3) + n110*pow(n172, n20)*n41*xF[7]*(pow(alpha, NP0*n2 - n134*n15)*n131*n63 + n54*n63) + n115*pow(n163, n20)*n41*(pow(alpha, NP0*n2 - n134*n6)*n131*n3*n6 + n106*n3) + n116*pow(n163, n20)*(pow(alpha, -n134*n6 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n6*n67 - pow(alpha, -n134*n6 + n2*n25)*pow(n129, n20)*n27*n28*pow(n43, n20)*n67 + n126 + n132*n157*n98) + n117*pow(n173, n20)*(pow(alpha, -n134*n16 + n2*n25)*pow(n129, n20)*n16*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n134*n16 + n2*n25)*pow(n129, n20)*n27*n38*pow(n43, n20)*n67 + n124 + n132*n153*n98) + n118*pow(n172, n20)*(pow(alpha, -n134*n15 + n2*n25)*pow(n129, n20)*n15*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n134*n15 + n2*n25)*pow(n129, n20)*pow(n43, n20)*n67*n99 + n132*n149*n98 + n54*n99) + n119*pow(n164, n20)*n23*(pow(alpha, NP0*n2 - n134*n7)*n131*n3*n7 + n119) + n12*pow(n169, n20)*n41*n51*xF[4]*(pow(alpha, NP0*n2 - n12*n134)*n12*n131*n3 + n12*n96) + n122*n189 + n123*n188 + n124*n192 + n125*n190 + n126*n194 + n127*n193 + n128*n191 + n13*pow(n170, n20)*n41*n52*xF[5]*(pow(alpha, NP0*n2 - n13*n134)*n131*n59 + n52*n59) + pow(n164, n20)*n91*(pow(alpha, -n134*n7 + n2*n25)*pow(n129, n20)*n19*n27*pow(n43, n20)*n67*n7 + pow(alpha, -n134*n7 + n2*n25)*pow(n129, n20)*n27*n29*pow(n43, n20)*n67 + n132*n154*n19*n42 + n27*n29*n83) + pow(n165, n20)*n69*xF[12]*(pow(alpha, -n134*n8 + n2*n25)*n104*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n8 + n2*n25)*pow(n129, n20)*n19*n27*pow(n43, n20)*n67*n8 + n104*n84 + n132*n148*n19*n42) + pow(n169, n20)*n81*xF[4]*(pow(alpha, -n12*n134 + n2*n25)*n12*pow(n129, n20)*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n12*n134 + n2*n25)*pow(n129, n20)*n27*n34*pow(n43, n20)*n67 + n125 + n132*n158*n98) + pow(n171, n20)*n41*n93*xF[6]*(pow(alpha, NP0*n2 - n134*n14)*n131*n14*n3 + n3*n93) + pow(n171, n20)*n75*xF[6]*(pow(alpha, -n134*n14 + n2*n25)*pow(n129, n20)*n14*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n134*n14 + n2*n25)*pow(n129, n20)*n27*n36*pow(n43, n20)*n67 + n132*n152*n19*n42 + n27*n36*n87) + pow(n173, n20)*n41*n94*xF[8]*(pow(alpha, NP0*n2 - n134*n16)*n131*n16*n3 + n3*n94) + pow(n174, n20)*n78*xF[9]*(pow(alpha, -n134*n17 + n2*n25)*n111*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n17 + n2*n25)*pow(n129, n20)*n17*n19*n27*pow(n43, n20)*n67 + n111*n88 + n132*n150*n19*n42) + n195*n41*n92*(pow(alpha, NP0*n2 - n11*n134)*n11*n131*n3 + n3*n92) + n195*n79*(pow(alpha, -n11*n134 + n2*n25)*n11*pow(n129, n20)*n2*n27*pow(n43, n20)*n67 + pow(alpha, -n11*n134 + n2*n25)*pow(n129, n20)*n27*pow(n43, n20)*n61*n67 + n128 + n132*n151*n98) + n196*n20*n250*n75 + n199*n20*n248*n73 + n20*n205*n256 + n20*n270*n91 + n201*n95 + n203*n99 + n207*(pow(alpha, -n13*n134 + n2*n25)*pow(n129, n20)*n13*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n13*n134 + n2*n25)*pow(n129, n20)*pow(n43, n20)*n67*n95 + n132*n159*n98 + n52*n95) + n209*(-pow(alpha, -n134*n9 + n2*n25)*n105*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n9 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n67*n9 + n105*n48 + n132*n155*n98) + n210 + n20*n253*n78*xF[9]/n187 + n20*n252*n77*xF[8]/n186 + n20*n251*n76*xF[7]/n185 + n20*n247*n72*xF[3]/n181 + n20*n244*n69*xF[12]/n178 + n20*n242*n65*xF[10]/n176 + n89*n97/n162) - 1.0*n89*n97/n162);
-      NP_sqrt_base = (NP0*(n24*(n100*n188*n3*n58 - n101*pow(n167, n20)*n58*(pow(alpha, NP0*n2 - n10*n134)*n10*n131*n3 + n100*n3) - n102*pow(n162, n20)*n58*(pow(alpha, NP0*n2 - n134*n2)*n131/n90 + n42/n90) + n103*n200*n58 + n113*pow(n165, n20)*n58*(pow(alpha, NP0*n2 - n134*n8)*n131*n3*n8 + n109*n3) + n114*pow(n174, n20)*n58*(pow(alpha, NP0*n2 - n134*n17)*n131*n17*n3 + n103*n3) + n115*n197*n58 + n116*pow(n163, n20)*n58*(pow(alpha, NP0*n2 - n134*n6)*n131*n3*n6 + n106*n3) + n117*pow(n173, n20)*n58*(pow(alpha, NP0*n2 - n134*n16)*n131*n16*n3 + n3*n94) + n118*pow(n172, n20)*n58*(pow(alpha, NP0*n2 - n134*n15)*n131*n63 + n54*n63) + n119*n189*n58 + n12*n190*n58*n96 + n121*n58/n165 - pow(n164, n20)*n58*n91*(pow(alpha, NP0*n2 - n134*n7)*n131*n3*n7 + n119) + pow(n169, n20)*n58*n81*xF[4]*(pow(alpha, NP0*n2 - n12*n134)*n12*n131*n3 + n12*n96) + pow(n171, n20)*n58*n80*xF[6]*(pow(alpha, NP0*n2 - n134*n14)*n131*n14*n3 + n3*n93) + n191*n3*n58*n92 + n192*n3*n58*n94 + n193*n3*n58*n93 + n195*n58*n79*(pow(alpha, NP0*n2 - n11*n134)*n11*n131*n3 + n3*n92) + n201*n58*n59 + n202*n58*n60 + n203*n58*n63 + n207*n58*(pow(alpha, NP0*n2 - n13*n134)*n131*n59 + n52*n59) + n209*n58*(pow(alpha, NP0*n2 - n134*n9)*n131*n60 + n48*n60) + n211) + n289) + n102*n58/n162 + xTj*(-n101*n58/n167 + n102*n198*n58 - n108*n58/n170 + n113*n58/n165 + n114*n58/n174 + n116*n58/n163 + n117*n58/n173 + n118*n58/n172 + n190*n58*n81 + n191*n58*n79 + n193*n58*n80 - n58*n70*xF[1]/n166 - n58*n91/n164) + pow(NP0, -n1)*(-n0*n102*n290*n58 + n0*n213 + n0*n24*(n101*pow(n167, n20)*n58*(pow(alpha, NP0*n2 - n10*n134)*n10*n132*n19 + pow(alpha, -n10*n134 + n2*n25)*n10*pow(n129, n20)*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n10*n134 + n2*n25)*pow(n129, n20)*n27*n32*pow(n43, n20)*n67 + n27*n32*n85) - n101*n58*(pow(alpha, NP0*n2 - n10*n134)*n10*n131*n3 + n100*n3)*(pow(alpha, NP0*n2 - n10*n134)*n10*n131*n41 + n100*n41)/n180 + n102*pow(n162, n20)*n58*(pow(alpha, NP0*n2 - n134*n2)*n97*(-n21 + xPj*xTj)/(n129*n43) + n82*n97) - n102*n58*(pow(alpha, NP0*n2 - n134*n2)*n131/n90 + n42/n90)*(pow(alpha, NP0*n2 - n134*n2)*n1*n131*n19*n3 + n1*n19*n3*n42)/n175 - n108*n58*(pow(alpha, NP0*n2 - n13*n134)*n131*n59 + n52*n59)*(pow(alpha, NP0*n2 - n13*n134)*n13*n131*n41 + n13*n41*n52)/n183 + n113*n58*(pow(alpha, NP0*n2 - n134*n8)*n131*n3*n8 + n109*n3)*(pow(alpha, NP0*n2 - n134*n8)*n131*n41*n8 + n109*n41)/n178 + n114*pow(n174, n20)*n58*(pow(alpha, NP0*n2 - n134*n17)*n132*n17*n2 - pow(alpha, -n134*n17 + n2*n25)*n111*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n17 + n2*n25)*pow(n129, n20)*n17*n2*n27*pow(n43, n20)*n67 + n111*n56) + n114*n58*(pow(alpha, NP0*n2 - n134*n17)*n131*n17*n3 + n103*n3)*(pow(alpha, NP0*n2 - n134*n17)*n131*n17*n41 + n103*n41)/n187 + n116*pow(n163, n20)*n58*(pow(alpha, NP0*n2 - n134*n6)*n132*n2*n6 + pow(alpha, -n134*n6 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n6*n67 - pow(alpha, -n134*n6 + n2*n25)*pow(n129, n20)*n27*n28*pow(n43, n20)*n67 + n126) + n116*n58*(pow(alpha, NP0*n2 - n134*n6)*n131*n3*n6 + n106*n3)*(pow(alpha, NP0*n2 - n134*n6)*n131*n41*n6 + n106*n41)/n176 + n117*pow(n173, n20)*n58*(pow(alpha, NP0*n2 - n134*n16)*n132*n16*n2 + pow(alpha, -n134*n16 + n2*n25)*pow(n129, n20)*n16*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n134*n16 + n2*n25)*pow(n129, n20)*n27*n38*pow(n43, n20)*n67 + n124) + n117*n58*(pow(alpha, NP0*n2 - n134*n16)*n131*n16*n3 + n3*n94)*(pow(alpha, NP0*n2 - n134*n16)*n131*n16*n41 + n41*n94)/n186 + n118*pow(n172, n20)*n58*(pow(alpha, NP0*n2 - n134*n15)*n132*n15*n2 + pow(alpha, -n134*n15 + n2*n25)*pow(n129, n20)*n15*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n134*n15 + n2*n25)*pow(n129, n20)*pow(n43, n20)*n67*n99 + n54*n99) - pow(n164, n20)*n58*n91*(pow(alpha, NP0*n2 - n134*n7)*n132*n2*n7 + pow(alpha, -n134*n7 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n67*n7 - pow(alpha, -n134*n7 + n2*n25)*pow(n129, n20)*n27*n29*pow(n43, n20)*n67 + n122) + pow(n165, n20)*n58*n69*xF[12]*(pow(alpha, NP0*n2 - n134*n8)*n132*n19*n8 + pow(alpha, -n134*n8 + n2*n25)*n104*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n8 + n2*n25)*pow(n129, n20)*n19*n27*pow(n43, n20)*n67*n8 + n104*n84) + pow(n169, n20)*n58*n81*xF[4]*(pow(alpha, NP0*n2 - n12*n134)*n12*n132*n2 + pow(alpha, -n12*n134 + n2*n25)*n12*pow(n129, n20)*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n12*n134 + n2*n25)*pow(n129, n20)*n27*n34*pow(n43, n20)*n67 + n125) + pow(n171, n20)*n58*n75*xF[6]*(pow(alpha, NP0*n2 - n134*n14)*n132*n14*n19 + pow(alpha, -n134*n14 + n2*n25)*pow(n129, n20)*n14*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n134*n14 + n2*n25)*pow(n129, n20)*n27*n36*pow(n43, n20)*n67 + n27*n36*n87) + n195*n58*n72*(pow(alpha, NP0*n2 - n11*n134)*n11*n132*n19 + pow(alpha, -n11*n134 + n2*n25)*n11*pow(n129, n20)*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n11*n134 + n2*n25)*pow(n129, n20)*n27*n33*pow(n43, n20)*n67 + n27*n50*n61) + n196*n58*n80*(pow(alpha, NP0*n2 - n134*n14)*n131*n14*n3 + n3*n93)*(pow(alpha, NP0*n2 - n134*n14)*n131*n14*n41 + n41*n93) + n199*n58*n81*(pow(alpha, NP0*n2 - n12*n134)*n12*n131*n3 + n12*n96)*(pow(alpha, NP0*n2 - n12*n134)*n12*n131*n41 + n12*n41*n51) - n205*n58*xF[1]*(pow(alpha, NP0*n2 - n134*n9)*n131*n60 + n48*n60)*(pow(alpha, NP0*n2 - n134*n9)*n131*n41*n9 + n107*n41) + n207*n58*(pow(alpha, NP0*n2 - n13*n134)*n13*n132*n2 + pow(alpha, -n13*n134 + n2*n25)*pow(n129, n20)*n13*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n13*n134 + n2*n25)*pow(n129, n20)*pow(n43, n20)*n67*n95 + n52*n95) + n208*n58*(pow(alpha, NP0*n2 - n134*n15)*n131*n63 + n54*n63)*(pow(alpha, NP0*n2 - n134*n15)*n131*n15*n41 + n110*n41) + n209*n58*(pow(alpha, NP0*n2 - n134*n9)*n132*n2*n9 - pow(alpha, -n134*n9 + n2*n25)*n105*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n9 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n67*n9 + n105*n48) + n213 + n214 + n215 + n216 + n217 + n218 + n219 + n220 + n221 + n222 + n223 + n224 + n225 + n273 + n274 + n275 + n276 + n277 + n278 + n279 + n280 + n281 + n282 + n283 + n284 + n285 + n58*n79*xF[3]*(pow(alpha, NP0*n2 - n11*n134)*n11*n131*n3 + n3*n92)*(pow(alpha, NP0*n2 - n11*n134)*n11*n131*n41 + n41*n92)/n181 - n58*n91*(pow(alpha, NP0*n2 - n134*n7)*n131*n3*n7 + n119)*(pow(alpha, NP0*n2 - n134*n7)*n131*n41*n7 + n41*n46*n7)/n177) + n0*n287 - 1.0*n259*n58*n89/n90))*(-n1*n213 - n1*n24*(n101*pow(n167, n20)*n58*(pow(alpha, NP0*n2 - n10*n134)*n10*n132*n19 + pow(alpha, -n10*n134 + n2*n25)*n10*pow(n129, n20)*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n10*n134 + n2*n25)*pow(n129, n20)*n27*n32*pow(n43, n20)*n67 + n27*n32*n85) - n101*n58*(pow(alpha, NP0*n2 - n10*n134)*n10*n131*n3 + n100*n3)*(pow(alpha, NP0*n2 - n10*n134)*n10*n131*n41 + n100*n41)/n180 + n102*pow(n162, n20)*n58*(pow(alpha, NP0*n2 - n134*n2)*n97*(-n21 + xPj*xTj)/(n129*n43) + n82*n97) - n102*n58*(pow(alpha, NP0*n2 - n134*n2)*n131/n90 + n42/n90)*(pow(alpha, NP0*n2 - n134*n2)*n1*n131*n19*n3 + n1*n19*n3*n42)/n175 - n108*n58*(pow(alpha, NP0*n2 - n13*n134)*n131*n59 + n52*n59)*(pow(alpha, NP0*n2 - n13*n134)*n13*n131*n41 + n13*n41*n52)/n183 + n113*n58*(pow(alpha, NP0*n2 - n134*n8)*n131*n3*n8 + n109*n3)*(pow(alpha, NP0*n2 - n134*n8)*n131*n41*n8 + n109*n41)/n178 + n114*pow(n174, n20)*n58*(pow(alpha, NP0*n2 - n134*n17)*n132*n17*n2 - pow(alpha, -n134*n17 + n2*n25)*n111*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n17 + n2*n25)*pow(n129, n20)*n17*n2*n27*pow(n43, n20)*n67 + n111*n56) + n114*n58*(pow(alpha, NP0*n2 - n134*n17)*n131*n17*n3 + n103*n3)*(pow(alpha, NP0*n2 - n134*n17)*n131*n17*n41 + n103*n41)/n187 + n116*pow(n163, n20)*n58*(pow(alpha, NP0*n2 - n134*n6)*n132*n2*n6 + pow(alpha, -n134*n6 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n6*n67 - pow(alpha, -n134*n6 + n2*n25)*pow(n129, n20)*n27*n28*pow(n43, n20)*n67 + n126) + n116*n58*(pow(alpha, NP0*n2 - n134*n6)*n131*n3*n6 + n106*n3)*(pow(alpha, NP0*n2 - n134*n6)*n131*n41*n6 + n106*n41)/n176 + n117*pow(n173, n20)*n58*(pow(alpha, NP0*n2 - n134*n16)*n132*n16*n2 + pow(alpha, -n134*n16 + n2*n25)*pow(n129, n20)*n16*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n134*n16 + n2*n25)*pow(n129, n20)*n27*n38*pow(n43, n20)*n67 + n124) + n117*n58*(pow(alpha, NP0*n2 - n134*n16)*n131*n16*n3 + n3*n94)*(pow(alpha, NP0*n2 - n134*n16)*n131*n16*n41 + n41*n94)/n186 + n118*pow(n172, n20)*n58*(pow(alpha, NP0*n2 - n134*n15)*n132*n15*n2 + pow(alpha, -n134*n15 + n2*n25)*pow(n129, n20)*n15*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n134*n15 + n2*n25)*pow(n129, n20)*pow(n43, n20)*n67*n99 + n54*n99) - pow(n164, n20)*n58*n91*(pow(alpha, NP0*n2 - n134*n7)*n132*n2*n7 + pow(alpha, -n134*n7 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n67*n7 - pow(alpha, -n134*n7 + n2*n25)*pow(n129, n20)*n27*n29*pow(n43, n20)*n67 + n122) + pow(n165, n20)*n58*n69*xF[12]*(pow(alpha, NP0*n2 - n134*n8)*n132*n19*n8 + pow(alpha, -n134*n8 + n2*n25)*n104*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n8 + n2*n25)*pow(n129, n20)*n19*n27*pow(n43, n20)*n67*n8 + n104*n84) + pow(n169, n20)*n58*n81*xF[4]*(pow(alpha, NP0*n2 - n12*n134)*n12*n132*n2 + pow(alpha, -n12*n134 + n2*n25)*n12*pow(n129, n20)*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n12*n134 + n2*n25)*pow(n129, n20)*n27*n34*pow(n43, n20)*n67 + n125) + pow(n171, n20)*n58*n75*xF[6]*(pow(alpha, NP0*n2 - n134*n14)*n132*n14*n19 + pow(alpha, -n134*n14 + n2*n25)*pow(n129, n20)*n14*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n134*n14 + n2*n25)*pow(n129, n20)*n27*n36*pow(n43, n20)*n67 + n27*n36*n87) + n195*n58*n72*(pow(alpha, NP0*n2 - n11*n134)*n11*n132*n19 + pow(alpha, -n11*n134 + n2*n25)*n11*pow(n129, n20)*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n11*n134 + n2*n25)*pow(n129, n20)*n27*n33*pow(n43, n20)*n67 + n27*n50*n61) + n196*n58*n80*(pow(alpha, NP0*n2 - n134*n14)*n131*n14*n3 + n3*n93)*(pow(alpha, NP0*n2 - n134*n14)*n131*n14*n41 + n41*n93) + n199*n58*n81*(pow(alpha, NP0*n2 - n12*n134)*n12*n131*n3 + n12*n96)*(pow(alpha, NP0*n2 - n12*n134)*n12*n131*n41 + n12*n41*n51) - n205*n58*xF[1]*(pow(alpha, NP0*n2 - n134*n9)*n131*n60 + n48*n60)*(pow(alpha, NP0*n2 - n134*n9)*n131*n41*n9 + n107*n41) + n207*n58*(pow(alpha, NP0*n2 - n13*n134)*n13*n132*n2 + pow(alpha, -n13*n134 + n2*n25)*pow(n129, n20)*n13*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n13*n134 + n2*n25)*pow(n129, n20)*pow(n43, n20)*n67*n95 + n52*n95) + n208*n58*(pow(alpha, NP0*n2 - n134*n15)*n131*n63 + n54*n63)*(pow(alpha, NP0*n2 - n134*n15)*n131*n15*n41 + n110*n41) + n209*n58*(pow(alpha, NP0*n2 - n134*n9)*n132*n2*n9 - pow(alpha, -n134*n9 + n2*n25)*n105*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n9 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n67*n9 + n105*n48) + n213 + n214 + n215 + n216 + n217 + n218 + n219 + n220 + n221 + n222 + n223 + n224 + n225 + n273 + n274 + n275 + n276 + n277 + n278 + n279 + n280 + n281 + n282 + n283 + n284 + n285 + n58*n79*xF[3]*(pow(alpha, NP0*n2 - n11*n134)*n11*n131*n3 + n3*n92)*(pow(alpha, NP0*n2 - n11*n134)*n11*n131*n41 + n41*n92)/n181 - n58*n91*(pow(alpha, NP0*n2 - n134*n7)*n131*n3*n7 + n119)*(pow(alpha, NP0*n2 - n134*n7)*n131*n41*n7 + n41*n46*n7)/n177) - n1*n287 - 4.0*n102*n266*n58 + 4.0*n259*n58*n89/n90) + pow(-n102*n259*n58 - n212 - n25*(-n0*n102*pow(n162, n20)*n58*(-pow(alpha, NP0*n2 - n134*n2)*n131*n97 + n82*n97) + n0*n102*n58*(pow(alpha, NP0*n2 - n134*n2)*n131/n90 + n42/n90)*(pow(alpha, NP0*n2 - n134*n2)*n1*n131*n19*n3 + n1*n19*n3*n42)/n175 + n0*xTj*(n101*pow(n167, n20)*n58*(pow(alpha, NP0*n2 - n10*n134)*n10*n132*n19 + pow(alpha, -n10*n134 + n2*n25)*n10*pow(n129, n20)*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n10*n134 + n2*n25)*pow(n129, n20)*n27*n32*pow(n43, n20)*n67 + n27*n32*n85) - n101*n58*(pow(alpha, NP0*n2 - n10*n134)*n10*n131*n3 + n100*n3)*(pow(alpha, NP0*n2 - n10*n134)*n10*n131*n41 + n100*n41)/n180 + n102*pow(n162, n20)*n58*(-pow(alpha, NP0*n2 - n134*n2)*n131*n97 + n82*n97) - n102*n58*(pow(alpha, NP0*n2 - n134*n2)*n131/n90 + n42/n90)*(pow(alpha, NP0*n2 - n134*n2)*n1*n131*n19*n3 + n1*n19*n3*n42)/n175 - n108*n58*(pow(alpha, NP0*n2 - n13*n134)*n131*n59 + n52*n59)*(pow(alpha, NP0*n2 - n13*n134)*n13*n131*n41 + n13*n41*n52)/n183 + n113*n58*(pow(alpha, NP0*n2 - n134*n8)*n131*n3*n8 + n109*n3)*(pow(alpha, NP0*n2 - n134*n8)*n131*n41*n8 + n109*n41)/n178 + n114*pow(n174, n20)*n58*(pow(alpha, NP0*n2 - n134*n17)*n132*n17*n2 - pow(alpha, -n134*n17 + n2*n25)*n111*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n17 + n2*n25)*pow(n129, n20)*n17*n2*n27*pow(n43, n20)*n67 + n111*n56) + n114*n58*(pow(alpha, NP0*n2 - n134*n17)*n131*n17*n3 + n103*n3)*(pow(alpha, NP0*n2 - n134*n17)*n131*n17*n41 + n103*n41)/n187 + n116*pow(n163, n20)*n58*(pow(alpha, NP0*n2 - n134*n6)*n132*n2*n6 + pow(alpha, -n134*n6 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n6*n67 - pow(alpha, -n134*n6 + n2*n25)*pow(n129, n20)*n27*n28*pow(n43, n20)*n67 + n126) + n116*n58*(pow(alpha, NP0*n2 - n134*n6)*n131*n3*n6 + n106*n3)*(pow(alpha, NP0*n2 - n134*n6)*n131*n41*n6 + n106*n41)/n176 + n117*pow(n173, n20)*n58*(pow(alpha, NP0*n2 - n134*n16)*n132*n16*n2 + pow(alpha, -n134*n16 + n2*n25)*pow(n129, n20)*n16*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n134*n16 + n2*n25)*pow(n129, n20)*n27*n38*pow(n43, n20)*n67 + n124) + n117*n58*(pow(alpha, NP0*n2 - n134*n16)*n131*n16*n3 + n3*n94)*(pow(alpha, NP0*n2 - n134*n16)*n131*n16*n41 + n41*n94)/n186 + n118*pow(n172, n20)*n58*(pow(alpha, NP0*n2 - n134*n15)*n132*n15*n2 + pow(alpha, -n134*n15 + n2*n25)*pow(n129, n20)*n15*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n134*n15 + n2*n25)*pow(n129, n20)*pow(n43, n20)*n67*n99 + n54*n99) - pow(n164, n20)*n58*n91*(pow(alpha, NP0*n2 - n134*n7)*n132*n2*n7 + pow(alpha, -n134*n7 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n67*n7 - pow(alpha, -n134*n7 + n2*n25)*pow(n129, n20)*n27*n29*pow(n43, n20)*n67 + n122) + pow(n165, n20)*n58*n69*xF[12]*(pow(alpha, NP0*n2 - n134*n8)*n132*n19*n8 + pow(alpha, -n134*n8 + n2*n25)*n104*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n8 + n2*n25)*pow(n129, n20)*n19*n27*pow(n43, n20)*n67*n8 + n104*n84) + pow(n169, n20)*n58*n81*xF[4]*(pow(alpha, NP0*n2 - n12*n134)*n12*n132*n2 + pow(alpha, -n12*n134 + n2*n25)*n12*pow(n129, n20)*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n12*n134 + n2*n25)*pow(n129, n20)*n27*n34*pow(n43, n20)*n67 + n125) + pow(n171, n20)*n58*n75*xF[6]*(pow(alpha, NP0*n2 - n134*n14)*n132*n14*n19 + pow(alpha, -n134*n14 + n2*n25)*pow(n129, n20)*n14*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n134*n14 + n2*n25)*pow(n129, n20)*n27*n36*pow(n43, n20)*n67 + n27*n36*n87) + n195*n58*n72*(pow(alpha, NP0*n2 - n11*n134)*n11*n132*n19 + pow(alpha, -n11*n134 + n2*n25)*n11*pow(n129, n20)*n19*n27*pow(n43, n20)*n67 + pow(alpha, -n11*n134 + n2*n25)*pow(n129, n20)*n27*n33*pow(n43, n20)*n67 + n27*n50*n61) + n196*n58*n80*(pow(alpha, NP0*n2 - n134*n14)*n131*n14*n3 + n3*n93)*(pow(alpha, NP0*n2 - n134*n14)*n131*n14*n41 + n41*n93) + n199*n58*n81*(pow(alpha, NP0*n2 - n12*n134)*n12*n131*n3 + n12*n96)*(pow(alpha, NP0*n2 - n12*n134)*n12*n131*n41 + n12*n41*n51) - n205*n58*xF[1]*(pow(alpha, NP0*n2 - n134*n9)*n131*n60 + n48*n60)*(pow(alpha, NP0*n2 - n134*n9)*n131*n41*n9 + n107*n41) + n207*n58*(pow(alpha, NP0*n2 - n13*n134)*n13*n132*n2 + pow(alpha, -n13*n134 + n2*n25)*pow(n129, n20)*n13*n2*n27*pow(n43, n20)*n67 - pow(alpha, -n13*n134 + n2*n25)*pow(n129, n20)*pow(n43, n20)*n67*n95 + n52*n95) + n208*n58*(pow(alpha, NP0*n2 - n134*n15)*n131*n63 + n54*n63)*(pow(alpha, NP0*n2 - n134*n15)*n131*n15*n41 + n110*n41) + n209*n58*(pow(alpha, NP0*n2 - n134*n9)*n132*n2*n9 - pow(alpha, -n134*n9 + n2*n25)*n105*pow(n129, n20)*pow(n43, n20)*n67 + pow(alpha, -n134*n9 + n2*n25)*pow(n129, n20)*n2*n27*pow(n43, n20)*n67*n9 + n105*n48) + n213 + n214 + n215 + n216 + n217 + n218 + n219 + n220 + n221 + n222 + n223 + n224 + n225 + n273 + n274 + n275 + n276 + n277 + n278 + n279 + n280 + n281 + n282 + n283 + n284 + n285 + n58*n79*xF[3]*(pow(alpha, NP0*n2 - n11*n134)*n11*n131*n3 + n3*n92)*(pow(alpha, NP0*n2 - n11*n134)*n11*n131*n41 + n41*n92)/n181 - n58*n91*(pow(alpha, NP0*n2 - n134*n7)*n131*n3*n7 + n119)*(pow(alpha, NP0*n2 - n134*n7)*n131*n41*n7 + n41*n46*n7)/n177) + 1.0*pow(n162, n20)*n58*n89*(pow(alpha, NP0*n2 - n134*n2)*n131/n90 + n42/n90)/n90 + n226) - n311, -n1);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - pow(NP_sqrt_base, -n0))/NP_2a;
-      NT1 = n90*(n130 - log(-pow(alpha, NP1*n2)*n120 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[10] - Mstar;
-      g5 = MW[11] - Mstar;
-      g6 = MW[12] - Mstar;
-      g7 = MW[2] - Mstar;
-      g8 = MW[3] - Mstar;
-      g9 = MW[4] - Mstar;
-      g10 = MW[5] - Mstar;
-      g11 = MW[6] - Mstar;
-      g12 = MW[7] - Mstar;
-      g13 = MW[8] - Mstar;
-      g14 = MW[9] - Mstar;
-      g15 = xF[0] - xTj;
-      g16 = xF[0] - xPj;
-      g17 = -xTj;
-      g18 = xPj/xF[1];
-      g19 = pow(alpha, -g1);
-      g20 = pow(alpha, -g4);
-      g21 = pow(alpha, -g5);
-      g22 = pow(alpha, -g6);
-      g23 = pow(alpha, -g0);
-      g24 = pow(alpha, -g7);
-      g25 = pow(alpha, -g8);
-      g26 = pow(alpha, -g9);
-      g27 = pow(alpha, -g10);
-      g28 = pow(alpha, -g11);
-      g29 = pow(alpha, -g12);
-      g30 = pow(alpha, -g13);
-      g31 = pow(alpha, -g14);
-      g32 = log(xF[0]/xF[1]);
-      g33 = -g2;
-      g34 = pow(alpha, NP1*g0);
-      g35 = pow(alpha, NP1*g1);
-      g36 = pow(alpha, NP1*g4);
-      g37 = log(g19);
-      g38 = pow(alpha, NP1*g5);
-      g39 = pow(alpha, NP1*g6);
-      g40 = pow(alpha, NP1*g7);
-      g41 = pow(alpha, NP1*g8);
-      g42 = pow(alpha, NP1*g9);
-      g43 = pow(alpha, NP1*g10);
-      g44 = pow(alpha, NP1*g11);
-      g45 = pow(alpha, NP1*g12);
-      g46 = pow(alpha, NP1*g13);
-      g47 = pow(alpha, NP1*g14);
-      g48 = -g32;
-      g49 = g15/g3;
-      g50 = g3/g15;
-      g51 = -g34 + 1;
-      g52 = -g34 + 1;
-      g53 = -g35 + 1;
-      g54 = -g40 + 1;
-      g55 = -g41 + 1;
-      g56 = -g42 + 1;
-      g57 = -g43 + 1;
-      g58 = -g44 + 1;
-      g59 = -g45 + 1;
-      g60 = -g46 + 1;
-      g61 = -g47 + 1;
-      g62 = -g36 + 1;
-      g63 = -g38 + 1;
-      g64 = -g39 + 1;
-      g65 = -g35;
-      g66 = -g36;
-      g67 = -g38;
-      g68 = -g39;
-      g69 = -g40;
-      g70 = -g41;
-      g71 = -g42;
-      g72 = -g43;
-      g73 = -g44;
-      g74 = -g45;
-      g75 = -g46;
-      g76 = -g47;
-      g77 = -1.0*g32;
-      g78 = -g3/g16;
-      g79 = g16/(g3*xF[1]);
-      g80 = pow(alpha, g0*g33) - 1;
-      g81 = pow(alpha, g0*g33) - 1;
-      g82 = pow(alpha, g1*g33) - 1;
-      g83 = pow(alpha, g33*g7) - 1;
-      g84 = pow(alpha, g33*g8) - 1;
-      g85 = pow(alpha, g33*g9) - 1;
-      g86 = pow(alpha, g10*g33) - 1;
-      g87 = pow(alpha, g11*g33) - 1;
-      g88 = pow(alpha, g12*g33) - 1;
-      g89 = pow(alpha, g13*g33) - 1;
-      g90 = pow(alpha, g14*g33) - 1;
-      g91 = pow(alpha, g33*g4) - 1;
-      g92 = pow(alpha, g33*g5) - 1;
-      g93 = pow(alpha, g33*g6) - 1;
-      g94 = -pow(alpha, g1*g33);
-      g95 = -pow(alpha, g33*g4);
-      g96 = -pow(alpha, g33*g5);
-      g97 = -pow(alpha, g33*g6);
-      g98 = -pow(alpha, g33*g7);
-      g99 = -pow(alpha, g33*g8);
-      g100 = -pow(alpha, g33*g9);
-      g101 = -pow(alpha, g10*g33);
-      g102 = -pow(alpha, g11*g33);
-      g103 = -pow(alpha, g12*g33);
-      g104 = -pow(alpha, g13*g33);
-      g105 = -pow(alpha, g14*g33);
-      g106 = g52 + g81;
-      g107 = -g35 - g94;
-      g108 = -g36 - g95;
-      g109 = -g38 - g96;
-      g110 = -g39 - g97;
-      g111 = -g40 - g98;
-      g112 = -g41 - g99;
-      g113 = -g100 - g42;
-      g114 = -g101 - g43;
-      g115 = -g102 - g44;
-      g116 = -g103 - g45;
-      g117 = -g104 - g46;
-      g118 = -g105 - g47;
-      g119 = pow(alpha, g1*g33) + g65;
-      g120 = g52 + g81;
-      g121 = pow(alpha, g33*g4) + g66;
-      g122 = pow(alpha, g33*g5) + g67;
-      g123 = pow(alpha, g33*g6) + g68;
-      g124 = pow(alpha, g33*g7) + g69;
-      g125 = pow(alpha, g33*g8) + g70;
-      g126 = pow(alpha, g33*g9) + g71;
-      g127 = pow(alpha, g10*g33) + g72;
-      g128 = pow(alpha, g11*g33) + g73;
-      g129 = pow(alpha, g12*g33) + g74;
-      g130 = pow(alpha, g13*g33) + g75;
-      g131 = pow(alpha, g14*g33) + g76;
-      g132 = xF[11]/g122;
-      g133 = xF[9]/g131;
-      g134 = xF[8]/g130;
-      g135 = xF[1]/g120;
-      g136 = xF[10]/g121;
-      g137 = xF[3]/g125;
-      g138 = xF[7]/g129;
-      g139 = xF[4]/g126;
-      g140 = xF[12]/g123;
-      g141 = xF[6]/g128;
-      g142 = xF[5]/g127;
-      g143 = xF[2]/g124;
-      g144 = xF[0]/g119;
-      g145 = xF[1]/g106;
-      g146 = xF[0]/g107;
-      g147 = xF[4]/g113;
-      g148 = xF[7]/g116;
-      g149 = xF[2]/g111;
-      g150 = xF[11]/g109;
-      g151 = xF[3]/g112;
-      g152 = xF[6]/g115;
-      g153 = xF[8]/g117;
-      g154 = xF[12]/g110;
-      g155 = xF[10]/g108;
-      g156 = xF[9]/g118;
-      g157 = xF[5]/g114;
-      g158 = g58/g115;
-      g159 = g61/g118;
-      g160 = g56/g113;
-      g161 = g59/g116;
-      g162 = g53/g107;
-      g163 = g57/g114;
-      g164 = g64/g110;
-      g165 = g55/g112;
-      g166 = g51/g106;
-      g167 = g63/g109;
-      g168 = g54/g111;
-      g169 = g62/g108;
-      g170 = g60/g117;
-      g171 = g80/g106;
-      g172 = g82/g107;
-      g173 = g92/g109;
-      g174 = g83/g111;
-      g175 = g84/g112;
-      g176 = g85/g113;
-      g177 = g89/g117;
-      g178 = g90/g118;
-      g179 = g87/g115;
-      g180 = g93/g110;
-      g181 = g88/g116;
-      g182 = g91/g108;
-      g183 = g86/g114;
-      g184 = log(g120*g17*g79/g52);
-      g185 = log(g106*g17*g79/g51);
-      g186 = log(g120*g18*g49/g81);
-      g187 = 1.0*g184;
-      g188 = log(g106*g18*g49/g80);
-      g189 = 1.0*g186;
-      g190 = -g132*g187*(g67 + 1) - g132*g189*(pow(alpha, g33*g5) - 1) - g133*g187*(g76 + 1) - g133*g189*(pow(alpha, g14*g33) - 1) - g134*g187*(g75 + 1) - g134*g189*(pow(alpha, g13*g33) - 1) - g135*g187*g52 - g135*g189*g81 - g136*g187*(g66 + 1) - g136*g189*(pow(alpha, g33*g4) - 1) - g137*g187*(g70 + 1) - g137*g189*(pow(alpha, g33*g8) - 1) - g138*g187*(g74 + 1) - g138*g189*(pow(alpha, g12*g33) - 1) - g139*g187*(g71 + 1) - g139*g189*(pow(alpha, g33*g9) - 1) - g140*g187*(g68 + 1) - g140*g189*(pow(alpha, g33*g6) - 1) - g141*g187*(g73 + 1) - g141*g189*(pow(alpha, g11*g33) - 1) - g142*g187*(g72 + 1) - g142*g189*(pow(alpha, g10*g33) - 1) - g143*g187*(g69 + 1) - g143*g189*(pow(alpha, g33*g7) - 1) - g144*g187*(g65 + 1) - g144*g189*(pow(alpha, g1*g33) - 1) - g77*xF[0] - g77*xF[10] - g77*xF[11] - g77*xF[12] - g77*xF[1] - g77*xF[2] - g77*xF[3] - g77*xF[4] - g77*xF[5] - g77*xF[6] - g77*xF[7] - g77*xF[8] - g77*xF[9];
-      LpF = xF[0]*(g19 + 1.0)*(g162*g185 + g172*g188 + g48)/(g37*(g19 - 1.0)) + xF[10]*(g20 + 1.0)*(g169*g185 + g182*g188 + g48)/(g37*(g20 - 1.0)) + xF[11]*(g21 + 1.0)*(g167*g185 + g173*g188 + g48)/(g37*(g21 - 1.0)) + xF[12]*(g22 + 1.0)*(g164*g185 + g180*g188 + g48)/(g37*(g22 - 1.0)) + xF[1]*(g23 + 1.0)*(g166*g185 + g171*g188 + g48)/(g37*(g23 - 1.0)) + xF[2]*(g24 + 1.0)*(g168*g185 + g174*g188 + g48)/(g37*(g24 - 1.0)) + xF[3]*(g25 + 1.0)*(g165*g185 + g175*g188 + g48)/(g37*(g25 - 1.0)) + xF[4]*(g26 + 1.0)*(g160*g185 + g176*g188 + g48)/(g37*(g26 - 1.0)) + xF[5]*(g27 + 1.0)*(g163*g185 + g183*g188 + g48)/(g37*(g27 - 1.0)) + xF[6]*(g28 + 1.0)*(g158*g185 + g179*g188 + g48)/(g37*(g28 - 1.0)) + xF[7]*(g29 + 1.0)*(g161*g185 + g181*g188 + g48)/(g37*(g29 - 1.0)) + xF[8]*(g30 + 1.0)*(g170*g185 + g177*g188 + g48)/(g37*(g30 - 1.0)) + xF[9]*(g31 + 1.0)*(g159*g185 + g178*g188 + g48)/(g37*(g31 - 1.0));
-      PpF = g49;
-      TpF = -g16/g3;
-      SWUpF = g190;
-      SWUpP = g190*g50;
-      xP[0] = g146*g50*g82;
-      xP[1] = g145*g50*g80;
-      xP[2] = g149*g50*g83;
-      xP[3] = g151*g50*g84;
-      xP[4] = g147*g50*g85;
-      xP[5] = g157*g50*g86;
-      xP[6] = g152*g50*g87;
-      xP[7] = g148*g50*g88;
-      xP[8] = g153*g50*g89;
-      xP[9] = g156*g50*g90;
-      xP[10] = g155*g50*g91;
-      xP[11] = g150*g50*g92;
-      xP[12] = g154*g50*g93;
-      xT[0] = g146*g53*g78;
-      xT[1] = g145*g51*g78;
-      xT[2] = g149*g54*g78;
-      xT[3] = g151*g55*g78;
-      xT[4] = g147*g56*g78;
-      xT[5] = g157*g57*g78;
-      xT[6] = g152*g58*g78;
-      xT[7] = g148*g59*g78;
-      xT[8] = g153*g60*g78;
-      xT[9] = g156*g61*g78;
-      xT[10] = g155*g62*g78;
-      xT[11] = g150*g63*g78;
-      xT[12] = g154*g64*g78;
-      break;
-    case 14:
-      n0 = -0.500000000000000;
-      n1 = MW[0] - Mstar;
-      n2 = log(alpha);
-      n3 = xPj - xTj;
-      n4 = xF[0] - xPj;
-      n5 = MW[10] - Mstar;
-      n6 = MW[11] - Mstar;
-      n7 = MW[12] - Mstar;
-      n8 = MW[13] - Mstar;
-      n9 = MW[1] - Mstar;
-      n10 = MW[2] - Mstar;
-      n11 = MW[3] - Mstar;
-      n12 = MW[4] - Mstar;
-      n13 = MW[5] - Mstar;
-      n14 = MW[6] - Mstar;
-      n15 = MW[7] - Mstar;
-      n16 = MW[8] - Mstar;
-      n17 = MW[9] - Mstar;
-      n18 = log(xTj);
-      n19 = -n1;
-      n20 = -2;
-      n21 = xF[0]*xPj;
-      n22 = -Mstar;
-      n23 = -xTj;
-      n24 = -NP0*n20;
-      n25 = -xPj;
-      n26 = -n20*xF[12];
-      n27 = pow(n1, -n20);
-      n28 = pow(n2, -n20);
-      n29 = pow(n5, -n20);
-      n30 = pow(n6, -n20);
-      n31 = pow(n7, -n20);
-      n32 = pow(n8, -n20);
-      n33 = pow(n9, -n20);
-      n34 = pow(n10, -n20);
-      n35 = pow(n11, -n20);
-      n36 = pow(n12, -n20);
-      n37 = pow(n13, -n20);
-      n38 = pow(n14, -n20);
-      n39 = pow(n15, -n20);
-      n40 = pow(n16, -n20);
-      n41 = pow(n17, -n20);
-      n42 = Mstar*n2;
-      n43 = -n2*n20;
-      n44 = pow(alpha, NP0*n1);
-      n45 = n21 + n23*xF[0];
-      n46 = n21 + n23*xPj;
-      n47 = pow(alpha, NP0*n5);
-      n48 = pow(alpha, NP0*n6);
-      n49 = pow(alpha, NP0*n7);
-      n50 = pow(alpha, NP0*n8);
-      n51 = pow(alpha, NP0*n9);
-      n52 = pow(alpha, NP0*n10);
-      n53 = pow(alpha, NP0*n11);
-      n54 = pow(alpha, NP0*n12);
-      n55 = pow(alpha, NP0*n13);
-      n56 = pow(alpha, NP0*n14);
-      n57 = pow(alpha, NP0*n15);
-      n58 = pow(alpha, NP0*n16);
-      n59 = pow(alpha, NP0*n17);
-      n60 = -MW[0]*n2;
-      n61 = n3/n4;
-      n62 = n13*n2;
-      n63 = n2*n9;
-      n64 = n0*n1*n19;
-      n65 = n10*n2;
-      n66 = n1*n19;
-      n67 = -n35;
-      n68 = n15*n2;
-      n69 = -n44 + 1;
-      n70 = -n47 + 1;
-      n71 = pow(alpha, n1*n24);
-      n72 = pow(n45, -n20);
-      n73 = pow(n46, -n20);
-      n74 = -n48 + 1;
-      n75 = -n49 + 1;
-      n76 = -n50 + 1;
-      n77 = -n51 + 1;
-      n78 = -n52 + 1;
-      n79 = -n53 + 1;
-      n80 = -n54 + 1;
-      n81 = -n55 + 1;
-      n82 = -n56 + 1;
-      n83 = -n57 + 1;
-      n84 = -n58 + 1;
-      n85 = -n59 + 1;
-      n86 = -n79;
-      n87 = -n82;
-      n88 = -n70;
-      n89 = -n74;
-      n90 = -n44;
-      n91 = -n49;
-      n92 = -n50;
-      n93 = -n52;
-      n94 = -n54;
-      n95 = -n55;
-      n96 = -n56;
-      n97 = 1/(n1*n2);
-      n98 = n14*n56;
-      n99 = n11*n53;
-      n100 = n1*n44;
-      n101 = n16*n58;
-      n102 = n28*n37;
-      n103 = n12*n54;
-      n104 = n47*n5;
-      n105 = n82*xF[6];
-      n106 = n28*n39;
-      n107 = n50*n8;
-      n108 = n78*xF[2];
-      n109 = n17*n59;
-      n110 = n28*n34;
-      n111 = n28*n31;
-      n112 = n81*xF[5];
-      n113 = n28*n33;
-      n114 = n51*n9;
-      n115 = n15*n57;
-      n116 = log((-1.0 + xPj/xF[0])/n3);
-      n117 = -n75*xF[12];
-      n118 = n28*n44;
-      n119 = -n85*xF[9];
-      n120 = -n76*xF[13];
-      n121 = n2*n48*n6;
-      n122 = n2*n49*n7;
-      n123 = n46/n45;
-      n124 = n28*n71*xF[0];
-      n125 = n28*n32*n50;
-      n126 = n28*n40*n58;
-      n127 = n28*n30*n48;
-      n128 = n28*n29*n47;
-      n129 = n28*n35*n53;
-      n130 = n123*n90 + 1;
-      n131 = pow(n130, -n20);
-      n132 = n116 + n18 + n42 + n60;
-      n133 = n123/n130;
-      n134 = n133*n2*n44;
-      n135 = n28*n71*n73/(n131*n72);
-      n136 = n97*(n132 - log(n130)) + 1;
-      n137 = pow(alpha, n1*n136);
-      n138 = pow(alpha, n136*n5);
-      n139 = pow(alpha, n136*n6);
-      n140 = pow(alpha, n136*n7);
-      n141 = pow(alpha, n136*n8);
-      n142 = pow(alpha, n136*n9);
-      n143 = pow(alpha, n10*n136);
-      n144 = pow(alpha, n11*n136);
-      n145 = pow(alpha, n12*n136);
-      n146 = pow(alpha, n13*n136);
-      n147 = pow(alpha, n136*n14);
-      n148 = pow(alpha, n136*n15);
-      n149 = pow(alpha, n136*n16);
-      n150 = pow(alpha, n136*n17);
-      n151 = n7/n140;
-      n152 = n12/n145;
-      n153 = n15/n148;
-      n154 = n17/n150;
-      n155 = n8/n141;
-      n156 = n11/n144;
-      n157 = n14/n147;
-      n158 = n16/n149;
-      n159 = n6/n139;
-      n160 = n9/n142;
-      n161 = n10/n143;
-      n162 = -1/n137;
-      n163 = n5/n138;
-      n164 = n13/n146;
-      n165 = n44/n146;
-      n166 = pow(alpha, n136*n19) + n69 - 1;
-      n167 = n70 - 1 + 1.0/n138;
-      n168 = n74 - 1 + 1.0/n139;
-      n169 = n75 - 1 + 1.0/n140;
-      n170 = n76 - 1 + 1.0/n141;
-      n171 = n77 - 1 + 1.0/n142;
-      n172 = n78 - 1 + 1.0/n143;
-      n173 = n79 - 1 + 1.0/n144;
-      n174 = n80 - 1 + 1.0/n145;
-      n175 = n81 - 1 + 1.0/n146;
-      n176 = n82 - 1 + 1.0/n147;
-      n177 = n83 - 1 + 1.0/n148;
-      n178 = n84 - 1 + 1.0/n149;
-      n179 = n85 - 1 + 1.0/n150;
-      n180 = pow(n166, -n20);
-      n181 = pow(n167, -n20);
-      n182 = pow(n168, -n20);
-      n183 = pow(n169, -n20);
-      n184 = pow(n170, -n20);
-      n185 = pow(n171, -n20);
-      n186 = pow(n172, -n20);
-      n187 = pow(n173, -n20);
-      n188 = pow(n174, -n20);
-      n189 = pow(n175, -n20);
-      n190 = pow(n176, -n20);
-      n191 = pow(n177, -n20);
-      n192 = pow(n178, -n20);
-      n193 = pow(n179, -n20);
-      n194 = pow(n166, 3);
-      n195 = pow(n167, 3);
-      n196 = pow(n168, 3);
-      n197 = pow(n169, 3);
-      n198 = pow(n170, 3);
-      n199 = pow(n171, 3);
-      n200 = pow(n172, 3);
-      n201 = pow(n173, 3);
-      n202 = pow(n174, 3);
-      n203 = pow(n175, 3);
-      n204 = pow(n176, 3);
-      n205 = pow(n177, 3);
-      n206 = pow(n178, 3);
-      n207 = pow(n179, 3);
-      n208 = xF[11]/n168;
-      n209 = xF[12]/n169;
-      n210 = xF[0]/n166;
-      n211 = xF[10]/n167;
-      n212 = xF[13]/n170;
-      n213 = xF[9]/n179;
-      n214 = xF[8]/n178;
-      n215 = xF[3]/n173;
-      n216 = xF[3]/n187;
-      n217 = xF[6]/n204;
-      n218 = xF[10]/n181;
-      n219 = n2*xF[4]/n174;
-      n220 = n2*n215;
-      n221 = n2/n180;
-      n222 = n2*xF[6]/n176;
-      n223 = n55*xF[5]/n175;
-      n224 = n51*xF[1]/n171;
-      n225 = n57*xF[7]/n177;
-      n226 = n52*xF[2]/n172;
-      n227 = n69/n194;
-      n228 = n69/n180;
-      n229 = n77/n199;
-      n230 = n80*xF[4]/n188;
-      n231 = n80*xF[4]/n202;
-      n232 = -n112/n189;
-      n233 = -n83*xF[7]/n205;
-      n234 = -n77*xF[1]/n185;
-      n235 = -n83*xF[7]/n191;
-      n236 = -n84*xF[8]/n192;
-      n237 = n213*n28*n41*n59;
-      n238 = n28*n36*n54*xF[4]/n174;
-      n239 = n28*n38*n56*xF[6]/n176;
-      n240 = n19*n2*n210*n44*n61;
-      n241 = n118*n210*n27*n61;
-      n242 = n128*n211*n61;
-      n243 = n127*n208*n61;
-      n244 = n111*n209*n49*n61;
-      n245 = n125*n212*n61;
-      n246 = n113*n224*n61;
-      n247 = n110*n226*n61;
-      n248 = n129*n215*n61;
-      n249 = n238*n61;
-      n250 = n102*n223*n61;
-      n251 = n239*n61;
-      n252 = n106*n225*n61;
-      n253 = n126*n214*n61;
-      n254 = n237*n61;
-      n255 = n118*n210*n61*n64;
-      n256 = n133/n137 + 1;
-      n257 = n100*n133*n2/n137 + n100*n2;
-      n258 = n104*n2 + n134*n163;
-      n259 = n121 + n134*n159;
-      n260 = n122 + n134*n151;
-      n261 = n107*n2 + n134*n155;
-      n262 = n133*n44*n63/n142 + n51*n63;
-      n263 = n133*n44*n65/n143 + n52*n65;
-      n264 = n134*n156 + n2*n99;
-      n265 = n103*n2 + n134*n152;
-      n266 = n133*n165*n62 + n55*n62;
-      n267 = n134*n157 + n2*n98;
-      n268 = n133*n44*n68/n148 + n57*n68;
-      n269 = n101*n2 + n134*n158;
-      n270 = n109*n2 + n134*n154;
-      n271 = pow(n257, -n20);
-      n272 = pow(n258, -n20);
-      n273 = pow(n259, -n20);
-      n274 = pow(n260, -n20);
-      n275 = pow(n261, -n20);
-      n276 = pow(n262, -n20);
-      n277 = pow(n263, -n20);
-      n278 = pow(n264, -n20);
-      n279 = pow(n265, -n20);
-      n280 = pow(n266, -n20);
-      n281 = pow(n267, -n20);
-      n282 = pow(n268, -n20);
-      n283 = pow(n269, -n20);
-      n284 = pow(n270, -n20);
-      n285 = n257*xF[0];
-      n286 = n259*xF[11];
-      n287 = n262*xF[1];
-      n288 = n269*xF[8];
-      n289 = n100*n133*n43/n137 + n100*n43;
-      n290 = n271*xF[0];
-      n291 = n276*xF[1];
-      n292 = n118*n133*n66/n137 + n118*n66;
-      n293 = n292*xF[0];
-      n294 = n260/n183;
-      n295 = n270/n193;
-      n296 = n261/n184;
-      n297 = n267*xF[6]/n190;
-      n298 = n277/n200;
-      n299 = n280/n203;
-      n300 = n283*n84*xF[8]/n206;
-      n301 = n273*n74*xF[11]/n196;
-      n302 = n228*n285*n61;
-      n303 = n100*n43*n61*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n1*n133*n2 + n100*n2)/n180;
-      n304 = n104*n218*n43*n61*(pow(alpha, NP0*n1 - n136*n5)*n133*n2*n5 + n104*n2);
-      n305 = n43*n48*n6*n61*xF[11]*(pow(alpha, NP0*n1 - n136*n6)*n133*n2*n6 + n121)/n182;
-      n306 = n122*n26*n61*(pow(alpha, NP0*n1 - n136*n7)*n133*n2*n7 + n122)/n183;
-      n307 = n107*n43*n61*xF[13]*(pow(alpha, NP0*n1 - n136*n8)*n133*n2*n8 + n107*n2)/n184;
-      n308 = n114*n43*n61*xF[1]*(pow(alpha, NP0*n1 - n136*n9)*n133*n63 + n51*n63)/n185;
-      n309 = n10*n43*n52*n61*xF[2]*(pow(alpha, NP0*n1 - n10*n136)*n133*n65 + n52*n65)/n186;
-      n310 = n216*n43*n61*n99*(pow(alpha, NP0*n1 - n11*n136)*n11*n133*n2 + n2*n99);
-      n311 = n103*n43*n61*xF[4]*(pow(alpha, NP0*n1 - n12*n136)*n12*n133*n2 + n103*n2)/n188;
-      n312 = n13*n43*n55*n61*xF[5]*(pow(alpha, NP0*n1 - n13*n136)*n133*n62 + n55*n62)/n189;
-      n313 = n43*n61*n98*xF[6]*(pow(alpha, NP0*n1 - n136*n14)*n133*n14*n2 + n2*n98)/n190;
-      n314 = n115*n43*n61*xF[7]*(pow(alpha, NP0*n1 - n136*n15)*n133*n68 + n57*n68)/n191;
-      n315 = n101*n43*n61*xF[8]*(pow(alpha, NP0*n1 - n136*n16)*n133*n16*n2 + n101*n2)/n192;
-      n316 = n109*n43*n61*xF[9]*(pow(alpha, NP0*n1 - n136*n17)*n133*n17*n2 + n109*n2)/n193;
-      n317 = 1.0*n100*n221*n285*n61;
-      n318 = n228*n293*n61;
-      n319 = -n0*n318;
-      n320 = n1*n135*n159 + n100*n133*n159*n28 + n127 - n135*n30/n139;
-      n321 = n111*n91 + n111*n71*n73/(n131*n140*n72) + n118*n133*n151*n19 + n135*n151*n19;
-      n322 = n118*n133*n155*n19 + n135*n155*n19 + n135*n32/n141 + n28*n32*n92;
-      n323 = n110*n93 + n110*n71*n73/(n131*n143*n72) + n118*n133*n161*n19 + n135*n161*n19;
-      n324 = n118*n133*n157*n19 + n135*n157*n19 + n135*n38/n147 + n28*n38*n96;
-      n325 = n1*n135*n154 + n100*n133*n154*n28 - n135*n41/n150 + n28*n41*n59;
-      n326 = n61*n75*xF[12]*(pow(alpha, n1*n24 - n136*n7)*n111*n73/(n131*n72) + pow(alpha, n1*n24 - n136*n7)*n19*n28*n7*n73/(n131*n72) + n111*n91 + n118*n133*n151*n19)/n183;
-      n327 = n61*n76*xF[13]*(pow(alpha, n1*n24 - n136*n8)*n19*n28*n73*n8/(n131*n72) + pow(alpha, n1*n24 - n136*n8)*n28*n32*n73/(n131*n72) + n118*n133*n155*n19 + n28*n32*n92)/n184;
-      n328 = n108*n61*(pow(alpha, n1*n24 - n10*n136)*n10*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n10*n136)*n110*n73/(n131*n72) + n110*n93 + n118*n133*n161*n19)/n186;
-      n329 = n230*n61*(pow(alpha, n1*n24 - n12*n136)*n12*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n12*n136)*n28*n36*n73/(n131*n72) + n118*n133*n152*n19 + n28*n36*n94);
-      n330 = n105*n61*(pow(alpha, n1*n24 - n136*n14)*n14*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n136*n14)*n28*n38*n73/(n131*n72) + n118*n133*n157*n19 + n28*n38*n96)/n190;
-      n331 = n218*n61*n88*(pow(alpha, n1*n24 - n136*n5)*n1*n28*n5*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n5)*n28*n29*n73/(n131*n72) + n100*n133*n163*n28 + n128);
-      n332 = n61*n89*xF[11]*(pow(alpha, n1*n24 - n136*n6)*n1*n28*n6*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n6)*n28*n30*n73/(n131*n72) + n100*n133*n159*n28 + n127)/n182;
-      n333 = n234*n61*(pow(alpha, n1*n24 - n136*n9)*n1*n28*n73*n9/(n131*n72) - pow(alpha, n1*n24 - n136*n9)*n113*n73/(n131*n72) + n100*n133*n160*n28 + n113*n51);
-      n334 = n232*n61*(pow(alpha, n1*n24 - n13*n136)*n1*n13*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n13*n136)*n102*n73/(n131*n72) + n100*n133*n164*n28 + n102*n55);
-      n335 = n235*n61*(pow(alpha, n1*n24 - n136*n15)*n1*n15*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n15)*n106*n73/(n131*n72) + n100*n133*n153*n28 + n106*n57);
-      n336 = n236*n61*(pow(alpha, n1*n24 - n136*n16)*n1*n16*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n16)*n28*n40*n73/(n131*n72) + n100*n133*n158*n28 + n126);
-      n337 = n119*n61*(pow(alpha, n1*n24 - n136*n17)*n1*n17*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n17)*n28*n41*n73/(n131*n72) + n100*n133*n154*n28 + n28*n41*n59)/n193;
-      n338 = xTj*(n100*n2*n210*n61 + n101*n2*n214*n61 + n103*n219*n61 + n104*n2*n211*n61 + n107*n2*n212*n61 - n108*n263*n61/n186 + n109*n2*n213*n61 + n117*n294*n61 + n119*n295*n61 + n120*n296*n61 + n121*n208*n61 + n122*n209*n61 + n216*n264*n61*n86 + n218*n258*n61*n88 + n220*n61*n99 + n222*n61*n98 + n223*n61*n62 + n224*n61*n63 + n225*n61*n68 + n226*n61*n65 - n230*n265*n61 + n232*n266*n61 + n234*n262*n61 + n235*n268*n61 + n236*n269*n61 + n297*n61*n87 - n302 + n286*n61*n89/n182);
-      n339 = n240 + n302 + n338;
-      n340 = n241 + n242 + n243 + n244 + n245 + n246 + n247 + n248 + n249 + n250 + n251 + n252 + n253 + n254 + n303 + n304 + n305 + n306 + n307 + n308 + n309 + n310 + n311 + n312 + n313 + n314 + n315 + n316 + n318 + n326 + n327 + n328 + n329 + n330 + n331 + n332 + n333 + n334 + n335 + n336 + n337;
-      n341 = -n108*n263*n61*(n10*n43*n52 + n133*n161*n43*n44)/n200 - n112*n266*n61*(n13*n43*n55 + n133*n164*n43*n44)/n203 + n117*n260*n61*(n133*n151*n43*n44 + n43*n49*n7)/n197 + n119*n270*n61*(n109*n43 + n133*n154*n43*n44)/n207 + n120*n261*n61*(n107*n43 + n133*n155*n43*n44)/n198 + n216*n61*n86*(pow(alpha, n1*n24 - n11*n136)*n1*n11*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n11*n136)*n28*n67*n73/(n131*n72) + n100*n133*n156*n28 + n129) + n217*n267*n61*n87*(n133*n157*n43*n44 + n43*n98) - n227*n285*n289*n61 - n229*n287*n61*(n114*n43 + n133*n160*n43*n44) - n231*n265*n61*(n103*n43 + n133*n152*n43*n44) + n233*n268*n61*(n115*n43 + n133*n153*n43*n44) + n340 - n288*n61*n84*(n101*n43 + n133*n158*n43*n44)/n206 + n264*n61*n86*xF[3]*(n133*n156*n43*n44 + n43*n99)/n201 + n286*n61*n89*(n133*n159*n43*n44 + n43*n48*n6)/n196 + n258*n61*n88*xF[10]*(n104*n43 + n133*n163*n43*n44)/n195;
-      NP_b = -n100*n221*n256*n61*n69*xF[0] - n24*(-n0*n228*n61*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n133*n28*n66 + n118*n66) + n0*xTj*(n105*n20*n281*n61/n204 + n105*n61*(pow(alpha, NP0*n1 - n136*n14)*n133*n14*n19*n28 + pow(alpha, n1*n24 - n136*n14)*n14*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n136*n14)*n28*n38*n73/(n131*n72) + n28*n38*n96)/n190 + n108*n20*n298*n61 + n108*n61*(pow(alpha, NP0*n1 - n10*n136)*n10*n133*n19*n28 + pow(alpha, n1*n24 - n10*n136)*n10*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n10*n136)*n110*n73/(n131*n72) + n110*n93)/n186 + n112*n20*n299*n61 + n119*n61*(pow(alpha, NP0*n1 - n136*n17)*n1*n133*n17*n28 + pow(alpha, n1*n24 - n136*n17)*n1*n17*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n17)*n28*n41*n73/(n131*n72) + n28*n41*n59)/n193 + n20*n227*n290*n61 + n20*n229*n291*n61 + n20*n231*n279*n61 + n20*n300*n61 + n20*n301*n61 + n20*n284*n61*n85*xF[9]/n207 + n20*n282*n61*n83*xF[7]/n205 + n20*n278*n61*n79*xF[3]/n201 + n216*n61*n79*(pow(alpha, NP0*n1 - n11*n136)*n11*n133*n19*n28 + pow(alpha, n1*n24 - n11*n136)*n11*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n11*n136)*n28*n35*n73/(n131*n72) + n28*n53*n67) + n218*n61*n88*(pow(alpha, NP0*n1 - n136*n5)*n1*n133*n28*n5 + pow(alpha, n1*n24 - n136*n5)*n1*n28*n5*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n5)*n28*n29*n73/(n131*n72) + n128) + n228*n61*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n133*n28*n66 + n118*n66) + n230*n61*(pow(alpha, NP0*n1 - n12*n136)*n12*n133*n19*n28 + pow(alpha, n1*n24 - n12*n136)*n12*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n12*n136)*n28*n36*n73/(n131*n72) + n28*n36*n94) + n232*n61*(pow(alpha, NP0*n1 - n13*n136)*n1*n13*n133*n28 + pow(alpha, n1*n24 - n13*n136)*n1*n13*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n13*n136)*n102*n73/(n131*n72) + n102*n55) + n234*n61*(pow(alpha, NP0*n1 - n136*n9)*n1*n133*n28*n9 + pow(alpha, n1*n24 - n136*n9)*n1*n28*n73*n9/(n131*n72) - pow(alpha, n1*n24 - n136*n9)*n113*n73/(n131*n72) + n113*n51) + n235*n61*(pow(alpha, NP0*n1 - n136*n15)*n1*n133*n15*n28 + pow(alpha, n1*n24 - n136*n15)*n1*n15*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n15)*n106*n73/(n131*n72) + n106*n57) + n236*n61*(pow(alpha, NP0*n1 - n136*n16)*n1*n133*n16*n28 + pow(alpha, n1*n24 - n136*n16)*n1*n16*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n16)*n28*n40*n73/(n131*n72) + n126) + n241 + n242 + n243 + n244 + n245 + n246 + n247 + n248 + n249 + n250 + n251 + n252 + n253 + n254 + n303 + n304 + n305 + n306 + n307 + n308 + n309 + n310 + n311 + n312 + n313 + n314 + n315 + n316 + n20*n275*n61*n76*xF[13]/n198 + n20*n274*n61*n75*xF[12]/n197 + n20*n272*n61*n70*xF[10]/n195 + n61*n76*xF[13]*(pow(alpha, NP0*n1 - n136*n8)*n133*n19*n28*n8 + pow(alpha, n1*n24 - n136*n8)*n19*n28*n73*n8/(n131*n72) + pow(alpha, n1*n24 - n136*n8)*n28*n32*n73/(n131*n72) + n28*n32*n92)/n184 + n61*n75*xF[12]*(pow(alpha, NP0*n1 - n136*n7)*n133*n19*n28*n7 + pow(alpha, n1*n24 - n136*n7)*n111*n73/(n131*n72) + pow(alpha, n1*n24 - n136*n7)*n19*n28*n7*n73/(n131*n72) + n111*n91)/n183 + n61*n89*xF[11]*(pow(alpha, NP0*n1 - n136*n6)*n1*n133*n28*n6 + pow(alpha, n1*n24 - n136*n6)*n1*n28*n6*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n6)*n28*n30*n73/(n131*n72) + n127)/n182) + 1.0*n100*n221*n61*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n1*n133*n2 + n100*n2) - 1.0*n227*n290*n61 + n255) - n240 - n61*xTj*(n100*n2*n210 + n101*n2*n214 + n103*n219 + n104*n2*n211 + n107*n2*n212 - n108*n263/n186 + n109*n2*n213 + n117*n294 + n119*n295 + n120*n296 + n121*n208 + n122*n209 + n216*n264*n86 + n218*n258*n88 + n220*n99 + n222*n98 + n223*n62 + n224*n63 + n225*n68 + n226*n65 - n228*n285 - n230*n265 + n232*n266 + n234*n262 + n235*n268 + n236*n269 + n297*n87 + n286*n89/n182);
-      NP_2a = -n61*(-1.0*n118*n210*n27 + n118*n228*n66*xF[0]*(-1 + (-n21 + xPj*xTj)/(n130*n137*n45)) - n124*n20*n227*pow(n256, -n20)*n27 - 2.0*n124*n256*n27/n180 + 1.0*xTj*(n10*n43*n52*xF[2]*(pow(alpha, NP0*n1 - n10*n136)*n133*n65 + n52*n65)/n186 + n100*n43*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n1*n133*n2 + n100*n2)/n180 + n101*n43*xF[8]*(pow(alpha, NP0*n1 - n136*n16)*n133*n16*n2 + n101*n2)/n192 + n102*n223 + n103*n43*xF[4]*(pow(alpha, NP0*n1 - n12*n136)*n12*n133*n2 + n103*n2)/n188 + n104*n218*n43*(pow(alpha, NP0*n1 - n136*n5)*n133*n2*n5 + n104*n2) + n105*n20*n281/n204 + n105*(pow(alpha, n1*n24 - n136*n14)*n14*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n136*n14)*n28*n38*n73/(n131*n72) + n118*n133*n157*n19 + n28*n38*n96)/n190 + n106*n225 + n107*n43*xF[13]*(pow(alpha, NP0*n1 - n136*n8)*n133*n2*n8 + n107*n2)/n184 + n108*n20*n298 + n108*(pow(alpha, n1*n24 - n10*n136)*n10*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n10*n136)*n110*n73/(n131*n72) + n110*n93 + n118*n133*n161*n19)/n186 + n109*n43*xF[9]*(pow(alpha, NP0*n1 - n136*n17)*n133*n17*n2 + n109*n2)/n193 + n110*n226 + n111*n209*n49 + n112*n20*n299 + n113*n224 + n114*n43*xF[1]*(pow(alpha, NP0*n1 - n136*n9)*n133*n63 + n51*n63)/n185 + n115*n43*xF[7]*(pow(alpha, NP0*n1 - n136*n15)*n133*n68 + n57*n68)/n191 + n118*n210*n27 + n119*(pow(alpha, n1*n24 - n136*n17)*n1*n17*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n17)*n28*n41*n73/(n131*n72) + n100*n133*n154*n28 + n28*n41*n59)/n193 + n122*n26*(pow(alpha, NP0*n1 - n136*n7)*n133*n2*n7 + n122)/n183 + n125*n212 + n126*n214 + n127*n208 + n128*n211 + n129*n215 + n13*n43*n55*xF[5]*(pow(alpha, NP0*n1 - n13*n136)*n133*n62 + n55*n62)/n189 + n20*n227*n290 + n20*n229*n291 + n20*n231*n279 + n20*n300 + n20*n301 + n20*n284*n85*xF[9]/n207 + n20*n282*n83*xF[7]/n205 + n20*n278*n79*xF[3]/n201 + n216*n43*n99*(pow(alpha, NP0*n1 - n11*n136)*n11*n133*n2 + n2*n99) + n216*n86*(pow(alpha, n1*n24 - n11*n136)*n1*n11*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n11*n136)*n28*n67*n73/(n131*n72) + n100*n133*n156*n28 + n129) + n218*n88*(pow(alpha, n1*n24 - n136*n5)*n1*n28*n5*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n5)*n28*n29*n73/(n131*n72) + n100*n133*n163*n28 + n128) + n228*n293 + n230*(pow(alpha, n1*n24 - n12*n136)*n12*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n12*n136)*n28*n36*n73/(n131*n72) + n118*n133*n152*n19 + n28*n36*n94) + n232*(pow(alpha, n1*n24 - n13*n136)*n1*n13*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n13*n136)*n102*n73/(n131*n72) + n100*n133*n164*n28 + n102*n55) + n234*(pow(alpha, n1*n24 - n136*n9)*n1*n28*n73*n9/(n131*n72) - pow(alpha, n1*n24 - n136*n9)*n113*n73/(n131*n72) + n100*n133*n160*n28 + n113*n51) + n235*(pow(alpha, n1*n24 - n136*n15)*n1*n15*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n15)*n106*n73/(n131*n72) + n100*n133*n153*n28 + n106*n57) + n236*(pow(alpha, n1*n24 - n136*n16)*n1*n16*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n16)*n28*n40*n73/(n131*n72) + n100*n133*n158*n28 + n126) + n237 + n238 + n239 + n20*n275*n76*xF[13]/n198 + n20*n274*n75*xF[12]/n197 + n20*n272*n70*xF[10]/n195 + n43*n98*xF[6]*(pow(alpha, NP0*n1 - n136*n14)*n133*n14*n2 + n2*n98)/n190 + n76*xF[13]*(pow(alpha, n1*n24 - n136*n8)*n19*n28*n73*n8/(n131*n72) + pow(alpha, n1*n24 - n136*n8)*n28*n32*n73/(n131*n72) + n118*n133*n155*n19 + n28*n32*n92)/n184 + n75*xF[12]*(pow(alpha, n1*n24 - n136*n7)*n111*n73/(n131*n72) + pow(alpha, n1*n24 - n136*n7)*n19*n28*n7*n73/(n131*n72) + n111*n91 + n118*n133*n151*n19)/n183 + n43*n48*n6*xF[11]*(pow(alpha, NP0*n1 - n136*n6)*n133*n2*n6 + n121)/n182 + n89*xF[11]*(pow(alpha, n1*n24 - n136*n6)*n1*n28*n6*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n6)*n28*n30*n73/(n131*n72) + n100*n133*n159*n28 + n127)/n182));
-      NP_sqrt_base = (-NP0*n339 - n23*(-n105*n61/(n82 - 1 + pow(alpha, -n14*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1))) - n108*n61/(n78 - 1 + pow(alpha, -n10*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1))) - n112*n61/(n81 - 1 + pow(alpha, -n13*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1))) - n61*n69*xF[0]/(pow(alpha, n19*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1)) + n69 - 1) - n61*n70*xF[10]/(n70 - 1 + pow(alpha, -n5*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1))) - n61*n74*xF[11]/(n74 - 1 + pow(alpha, -n6*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1))) - n61*n75*xF[12]/(n75 - 1 + pow(alpha, -n7*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1))) - n61*n76*xF[13]/(n76 - 1 + pow(alpha, -n8*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1))) - n61*n77*xF[1]/(n77 - 1 + pow(alpha, -n9*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1))) - n61*n79*xF[3]/(n79 - 1 + pow(alpha, -n11*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1))) - n61*n80*xF[4]/(n80 - 1 + pow(alpha, -n12*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1))) - n61*n83*xF[7]/(n83 - 1 + pow(alpha, -n15*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1))) - n61*n84*xF[8]/(n84 - 1 + pow(alpha, -n16*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1))) - n61*n85*xF[9]/(n85 - 1 + pow(alpha, -n17*(n97*(n132 - log(n90*(n21 + n25*xTj)/(n21 - xF[0]*xTj) + 1)) + 1)))) + n61*n69*xF[0]/(-n162 + n69 - 1) - pow(NP0, -n20)*(n0*n227*n285*n289*n61 - n0*n23*(n105*n61*(pow(alpha, NP0*n1 - n136*n14)*n133*n14*n19*n28 + pow(alpha, n1*n24 - n136*n14)*n14*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n136*n14)*n28*n38*n73/(n131*n72) + n28*n38*n96)/n190 - n108*n61*(pow(alpha, NP0*n1 - n10*n136)*n133*n65 + n52*n65)*(pow(alpha, NP0*n1 - n10*n136)*n10*n133*n43 + n10*n43*n52)/n200 + n108*n61*(pow(alpha, NP0*n1 - n10*n136)*n10*n133*n19*n28 + pow(alpha, n1*n24 - n10*n136)*n10*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n10*n136)*n110*n73/(n131*n72) + n110*n93)/n186 - n112*n61*(pow(alpha, NP0*n1 - n13*n136)*n133*n62 + n55*n62)*(pow(alpha, NP0*n1 - n13*n136)*n13*n133*n43 + n13*n43*n55)/n203 + n117*n61*(pow(alpha, NP0*n1 - n136*n7)*n133*n2*n7 + n122)*(pow(alpha, NP0*n1 - n136*n7)*n133*n43*n7 + n43*n49*n7)/n197 + n119*n61*(pow(alpha, NP0*n1 - n136*n17)*n133*n17*n2 + n109*n2)*(pow(alpha, NP0*n1 - n136*n17)*n133*n17*n43 + n109*n43)/n207 + n119*n61*(pow(alpha, NP0*n1 - n136*n17)*n1*n133*n17*n28 + pow(alpha, n1*n24 - n136*n17)*n1*n17*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n17)*n28*n41*n73/(n131*n72) + n28*n41*n59)/n193 + n120*n61*(pow(alpha, NP0*n1 - n136*n8)*n133*n2*n8 + n107*n2)*(pow(alpha, NP0*n1 - n136*n8)*n133*n43*n8 + n107*n43)/n198 + n216*n61*n86*(pow(alpha, NP0*n1 - n11*n136)*n1*n11*n133*n28 + pow(alpha, n1*n24 - n11*n136)*n1*n11*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n11*n136)*n28*n67*n73/(n131*n72) + n129) + n217*n61*n87*(pow(alpha, NP0*n1 - n136*n14)*n133*n14*n2 + n2*n98)*(pow(alpha, NP0*n1 - n136*n14)*n133*n14*n43 + n43*n98) + n218*n61*n88*(pow(alpha, NP0*n1 - n136*n5)*n1*n133*n28*n5 + pow(alpha, n1*n24 - n136*n5)*n1*n28*n5*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n5)*n28*n29*n73/(n131*n72) + n128) - n227*n61*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n1*n133*n2 + n100*n2)*(pow(alpha, NP0*n1 - n1*n136)*n1*n133*n43 + n100*n43) + n228*n61*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n133*n28*n66 + n118*n66) - n229*n61*xF[1]*(pow(alpha, NP0*n1 - n136*n9)*n133*n63 + n51*n63)*(pow(alpha, NP0*n1 - n136*n9)*n133*n43*n9 + n114*n43) + n230*n61*(pow(alpha, NP0*n1 - n12*n136)*n12*n133*n19*n28 + pow(alpha, n1*n24 - n12*n136)*n12*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n12*n136)*n28*n36*n73/(n131*n72) + n28*n36*n94) - n231*n61*(pow(alpha, NP0*n1 - n12*n136)*n12*n133*n2 + n103*n2)*(pow(alpha, NP0*n1 - n12*n136)*n12*n133*n43 + n103*n43) + n232*n61*(pow(alpha, NP0*n1 - n13*n136)*n1*n13*n133*n28 + pow(alpha, n1*n24 - n13*n136)*n1*n13*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n13*n136)*n102*n73/(n131*n72) + n102*n55) + n233*n61*(pow(alpha, NP0*n1 - n136*n15)*n133*n68 + n57*n68)*(pow(alpha, NP0*n1 - n136*n15)*n133*n15*n43 + n115*n43) + n234*n61*(pow(alpha, NP0*n1 - n136*n9)*n1*n133*n28*n9 + pow(alpha, n1*n24 - n136*n9)*n1*n28*n73*n9/(n131*n72) - pow(alpha, n1*n24 - n136*n9)*n113*n73/(n131*n72) + n113*n51) + n235*n61*(pow(alpha, NP0*n1 - n136*n15)*n1*n133*n15*n28 + pow(alpha, n1*n24 - n136*n15)*n1*n15*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n15)*n106*n73/(n131*n72) + n106*n57) + n236*n61*(pow(alpha, NP0*n1 - n136*n16)*n1*n133*n16*n28 + pow(alpha, n1*n24 - n136*n16)*n1*n16*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n16)*n28*n40*n73/(n131*n72) + n126) + n241 + n242 + n243 + n244 + n245 + n246 + n247 + n248 + n249 + n250 + n251 + n252 + n253 + n254 + n303 + n304 + n305 + n306 + n307 + n308 + n309 + n310 + n311 + n312 + n313 + n314 + n315 + n316 - n61*n84*xF[8]*(pow(alpha, NP0*n1 - n136*n16)*n133*n16*n2 + n101*n2)*(pow(alpha, NP0*n1 - n136*n16)*n133*n16*n43 + n101*n43)/n206 + n61*n86*xF[3]*(pow(alpha, NP0*n1 - n11*n136)*n11*n133*n2 + n2*n99)*(pow(alpha, NP0*n1 - n11*n136)*n11*n133*n43 + n43*n99)/n201 + n61*n89*xF[11]*(pow(alpha, NP0*n1 - n136*n6)*n133*n2*n6 + n121)*(pow(alpha, NP0*n1 - n136*n6)*n133*n43*n6 + n43*n48*n6)/n196 + n61*n88*xF[10]*(pow(alpha, NP0*n1 - n136*n5)*n133*n2*n5 + n104*n2)*(pow(alpha, NP0*n1 - n136*n5)*n133*n43*n5 + n104*n43)/n195 + n61*n76*xF[13]*(pow(alpha, NP0*n1 - n136*n8)*n133*n19*n28*n8 + pow(alpha, n1*n24 - n136*n8)*n19*n28*n73*n8/(n131*n72) + pow(alpha, n1*n24 - n136*n8)*n28*n32*n73/(n131*n72) + n28*n32*n92)/n184 + n61*n75*xF[12]*(pow(alpha, NP0*n1 - n136*n7)*n133*n19*n28*n7 + pow(alpha, n1*n24 - n136*n7)*n111*n73/(n131*n72) + pow(alpha, n1*n24 - n136*n7)*n19*n28*n7*n73/(n131*n72) + n111*n91)/n183 + n61*n89*xF[11]*(pow(alpha, NP0*n1 - n136*n6)*n1*n133*n28*n6 + pow(alpha, n1*n24 - n136*n6)*n1*n28*n6*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n6)*n28*n30*n73/(n131*n72) + n127)/n182) - n0*n241 - n0*n318 + 1.0*n100*n221*n285*n61))*(4.0*n100*n221*n285*n61 - n20*n23*(n105*n61*(pow(alpha, NP0*n1 - n136*n14)*n133*n14*n19*n28 + pow(alpha, n1*n24 - n136*n14)*n14*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n136*n14)*n28*n38*n73/(n131*n72) + n28*n38*n96)/n190 - n108*n61*(pow(alpha, NP0*n1 - n10*n136)*n133*n65 + n52*n65)*(pow(alpha, NP0*n1 - n10*n136)*n10*n133*n43 + n10*n43*n52)/n200 + n108*n61*(pow(alpha, NP0*n1 - n10*n136)*n10*n133*n19*n28 + pow(alpha, n1*n24 - n10*n136)*n10*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n10*n136)*n110*n73/(n131*n72) + n110*n93)/n186 - n112*n61*(pow(alpha, NP0*n1 - n13*n136)*n133*n62 + n55*n62)*(pow(alpha, NP0*n1 - n13*n136)*n13*n133*n43 + n13*n43*n55)/n203 + n117*n61*(pow(alpha, NP0*n1 - n136*n7)*n133*n2*n7 + n122)*(pow(alpha, NP0*n1 - n136*n7)*n133*n43*n7 + n43*n49*n7)/n197 + n119*n61*(pow(alpha, NP0*n1 - n136*n17)*n133*n17*n2 + n109*n2)*(pow(alpha, NP0*n1 - n136*n17)*n133*n17*n43 + n109*n43)/n207 + n119*n61*(pow(alpha, NP0*n1 - n136*n17)*n1*n133*n17*n28 + pow(alpha, n1*n24 - n136*n17)*n1*n17*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n17)*n28*n41*n73/(n131*n72) + n28*n41*n59)/n193 + n120*n61*(pow(alpha, NP0*n1 - n136*n8)*n133*n2*n8 + n107*n2)*(pow(alpha, NP0*n1 - n136*n8)*n133*n43*n8 + n107*n43)/n198 + n216*n61*n86*(pow(alpha, NP0*n1 - n11*n136)*n1*n11*n133*n28 + pow(alpha, n1*n24 - n11*n136)*n1*n11*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n11*n136)*n28*n67*n73/(n131*n72) + n129) + n217*n61*n87*(pow(alpha, NP0*n1 - n136*n14)*n133*n14*n2 + n2*n98)*(pow(alpha, NP0*n1 - n136*n14)*n133*n14*n43 + n43*n98) + n218*n61*n88*(pow(alpha, NP0*n1 - n136*n5)*n1*n133*n28*n5 + pow(alpha, n1*n24 - n136*n5)*n1*n28*n5*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n5)*n28*n29*n73/(n131*n72) + n128) - n227*n61*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n1*n133*n2 + n100*n2)*(pow(alpha, NP0*n1 - n1*n136)*n1*n133*n43 + n100*n43) + n228*n61*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n133*n28*n66 + n118*n66) - n229*n61*xF[1]*(pow(alpha, NP0*n1 - n136*n9)*n133*n63 + n51*n63)*(pow(alpha, NP0*n1 - n136*n9)*n133*n43*n9 + n114*n43) + n230*n61*(pow(alpha, NP0*n1 - n12*n136)*n12*n133*n19*n28 + pow(alpha, n1*n24 - n12*n136)*n12*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n12*n136)*n28*n36*n73/(n131*n72) + n28*n36*n94) - n231*n61*(pow(alpha, NP0*n1 - n12*n136)*n12*n133*n2 + n103*n2)*(pow(alpha, NP0*n1 - n12*n136)*n12*n133*n43 + n103*n43) + n232*n61*(pow(alpha, NP0*n1 - n13*n136)*n1*n13*n133*n28 + pow(alpha, n1*n24 - n13*n136)*n1*n13*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n13*n136)*n102*n73/(n131*n72) + n102*n55) + n233*n61*(pow(alpha, NP0*n1 - n136*n15)*n133*n68 + n57*n68)*(pow(alpha, NP0*n1 - n136*n15)*n133*n15*n43 + n115*n43) + n234*n61*(pow(alpha, NP0*n1 - n136*n9)*n1*n133*n28*n9 + pow(alpha, n1*n24 - n136*n9)*n1*n28*n73*n9/(n131*n72) - pow(alpha, n1*n24 - n136*n9)*n113*n73/(n131*n72) + n113*n51) + n235*n61*(pow(alpha, NP0*n1 - n136*n15)*n1*n133*n15*n28 + pow(alpha, n1*n24 - n136*n15)*n1*n15*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n15)*n106*n73/(n131*n72) + n106*n57) + n236*n61*(pow(alpha, NP0*n1 - n136*n16)*n1*n133*n16*n28 + pow(alpha, n1*n24 - n136*n16)*n1*n16*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n16)*n28*n40*n73/(n131*n72) + n126) + n241 + n242 + n243 + n244 + n245 + n246 + n247 + n248 + n249 + n250 + n251 + n252 + n253 + n254 + n303 + n304 + n305 + n306 + n307 + n308 + n309 + n310 + n311 + n312 + n313 + n314 + n315 + n316 - n61*n84*xF[8]*(pow(alpha, NP0*n1 - n136*n16)*n133*n16*n2 + n101*n2)*(pow(alpha, NP0*n1 - n136*n16)*n133*n16*n43 + n101*n43)/n206 + n61*n86*xF[3]*(pow(alpha, NP0*n1 - n11*n136)*n11*n133*n2 + n2*n99)*(pow(alpha, NP0*n1 - n11*n136)*n11*n133*n43 + n43*n99)/n201 + n61*n89*xF[11]*(pow(alpha, NP0*n1 - n136*n6)*n133*n2*n6 + n121)*(pow(alpha, NP0*n1 - n136*n6)*n133*n43*n6 + n43*n48*n6)/n196 + n61*n88*xF[10]*(pow(alpha, NP0*n1 - n136*n5)*n133*n2*n5 + n104*n2)*(pow(alpha, NP0*n1 - n136*n5)*n133*n43*n5 + n104*n43)/n195 + n61*n76*xF[13]*(pow(alpha, NP0*n1 - n136*n8)*n133*n19*n28*n8 + pow(alpha, n1*n24 - n136*n8)*n19*n28*n73*n8/(n131*n72) + pow(alpha, n1*n24 - n136*n8)*n28*n32*n73/(n131*n72) + n28*n32*n92)/n184 + n61*n75*xF[12]*(pow(alpha, NP0*n1 - n136*n7)*n133*n19*n28*n7 + pow(alpha, n1*n24 - n136*n7)*n111*n73/(n131*n72) + pow(alpha, n1*n24 - n136*n7)*n19*n28*n7*n73/(n131*n72) + n111*n91)/n183 + n61*n89*xF[11]*(pow(alpha, NP0*n1 - n136*n6)*n1*n133*n28*n6 + pow(alpha, n1*n24 - n136*n6)*n1*n28*n6*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n6)*n28*n30*n73/(n131*n72) + n127)/n182) - 4.0*n227*n290*n61 + 2.0*n241 + 2.0*n318) + pow(-n24*(n0*n227*n61*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n1*n133*n2 + n100*n2)*(pow(alpha, NP0*n1 - n1*n136)*n1*n133*n43 + n100*n43) - n0*n228*n61*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n133*n28*n66 + n118*n66) + n0*xTj*(n105*n61*(pow(alpha, NP0*n1 - n136*n14)*n133*n14*n19*n28 + pow(alpha, n1*n24 - n136*n14)*n14*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n136*n14)*n28*n38*n73/(n131*n72) + n28*n38*n96)/n190 - n108*n61*(pow(alpha, NP0*n1 - n10*n136)*n133*n65 + n52*n65)*(pow(alpha, NP0*n1 - n10*n136)*n10*n133*n43 + n10*n43*n52)/n200 + n108*n61*(pow(alpha, NP0*n1 - n10*n136)*n10*n133*n19*n28 + pow(alpha, n1*n24 - n10*n136)*n10*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n10*n136)*n110*n73/(n131*n72) + n110*n93)/n186 - n112*n61*(pow(alpha, NP0*n1 - n13*n136)*n133*n62 + n55*n62)*(pow(alpha, NP0*n1 - n13*n136)*n13*n133*n43 + n13*n43*n55)/n203 + n117*n61*(pow(alpha, NP0*n1 - n136*n7)*n133*n2*n7 + n122)*(pow(alpha, NP0*n1 - n136*n7)*n133*n43*n7 + n43*n49*n7)/n197 + n119*n61*(pow(alpha, NP0*n1 - n136*n17)*n133*n17*n2 + n109*n2)*(pow(alpha, NP0*n1 - n136*n17)*n133*n17*n43 + n109*n43)/n207 + n119*n61*(pow(alpha, NP0*n1 - n136*n17)*n1*n133*n17*n28 + pow(alpha, n1*n24 - n136*n17)*n1*n17*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n17)*n28*n41*n73/(n131*n72) + n28*n41*n59)/n193 + n120*n61*(pow(alpha, NP0*n1 - n136*n8)*n133*n2*n8 + n107*n2)*(pow(alpha, NP0*n1 - n136*n8)*n133*n43*n8 + n107*n43)/n198 + n216*n61*n86*(pow(alpha, NP0*n1 - n11*n136)*n1*n11*n133*n28 + pow(alpha, n1*n24 - n11*n136)*n1*n11*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n11*n136)*n28*n67*n73/(n131*n72) + n129) + n217*n61*n87*(pow(alpha, NP0*n1 - n136*n14)*n133*n14*n2 + n2*n98)*(pow(alpha, NP0*n1 - n136*n14)*n133*n14*n43 + n43*n98) + n218*n61*n88*(pow(alpha, NP0*n1 - n136*n5)*n1*n133*n28*n5 + pow(alpha, n1*n24 - n136*n5)*n1*n28*n5*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n5)*n28*n29*n73/(n131*n72) + n128) - n227*n61*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n1*n133*n2 + n100*n2)*(pow(alpha, NP0*n1 - n1*n136)*n1*n133*n43 + n100*n43) + n228*n61*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n133*n28*n66 + n118*n66) - n229*n61*xF[1]*(pow(alpha, NP0*n1 - n136*n9)*n133*n63 + n51*n63)*(pow(alpha, NP0*n1 - n136*n9)*n133*n43*n9 + n114*n43) + n230*n61*(pow(alpha, NP0*n1 - n12*n136)*n12*n133*n19*n28 + pow(alpha, n1*n24 - n12*n136)*n12*n19*n28*n73/(n131*n72) + pow(alpha, n1*n24 - n12*n136)*n28*n36*n73/(n131*n72) + n28*n36*n94) - n231*n61*(pow(alpha, NP0*n1 - n12*n136)*n12*n133*n2 + n103*n2)*(pow(alpha, NP0*n1 - n12*n136)*n12*n133*n43 + n103*n43) + n232*n61*(pow(alpha, NP0*n1 - n13*n136)*n1*n13*n133*n28 + pow(alpha, n1*n24 - n13*n136)*n1*n13*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n13*n136)*n102*n73/(n131*n72) + n102*n55) + n233*n61*(pow(alpha, NP0*n1 - n136*n15)*n133*n68 + n57*n68)*(pow(alpha, NP0*n1 - n136*n15)*n133*n15*n43 + n115*n43) + n234*n61*(pow(alpha, NP0*n1 - n136*n9)*n1*n133*n28*n9 + pow(alpha, n1*n24 - n136*n9)*n1*n28*n73*n9/(n131*n72) - pow(alpha, n1*n24 - n136*n9)*n113*n73/(n131*n72) + n113*n51) + n235*n61*(pow(alpha, NP0*n1 - n136*n15)*n1*n133*n15*n28 + pow(alpha, n1*n24 - n136*n15)*n1*n15*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n15)*n106*n73/(n131*n72) + n106*n57) + n236*n61*(pow(alpha, NP0*n1 - n136*n16)*n1*n133*n16*n28 + pow(alpha, n1*n24 - n136*n16)*n1*n16*n28*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n16)*n28*n40*n73/(n131*n72) + n126) + n241 + n242 + n243 + n244 + n245 + n246 + n247 + n248 + n249 + n250 + n251 + n252 + n253 + n254 + n303 + n304 + n305 + n306 + n307 + n308 + n309 + n310 + n311 + n312 + n313 + n314 + n315 + n316 - n61*n84*xF[8]*(pow(alpha, NP0*n1 - n136*n16)*n133*n16*n2 + n101*n2)*(pow(alpha, NP0*n1 - n136*n16)*n133*n16*n43 + n101*n43)/n206 + n61*n86*xF[3]*(pow(alpha, NP0*n1 - n11*n136)*n11*n133*n2 + n2*n99)*(pow(alpha, NP0*n1 - n11*n136)*n11*n133*n43 + n43*n99)/n201 + n61*n89*xF[11]*(pow(alpha, NP0*n1 - n136*n6)*n133*n2*n6 + n121)*(pow(alpha, NP0*n1 - n136*n6)*n133*n43*n6 + n43*n48*n6)/n196 + n61*n88*xF[10]*(pow(alpha, NP0*n1 - n136*n5)*n133*n2*n5 + n104*n2)*(pow(alpha, NP0*n1 - n136*n5)*n133*n43*n5 + n104*n43)/n195 + n61*n76*xF[13]*(pow(alpha, NP0*n1 - n136*n8)*n133*n19*n28*n8 + pow(alpha, n1*n24 - n136*n8)*n19*n28*n73*n8/(n131*n72) + pow(alpha, n1*n24 - n136*n8)*n28*n32*n73/(n131*n72) + n28*n32*n92)/n184 + n61*n75*xF[12]*(pow(alpha, NP0*n1 - n136*n7)*n133*n19*n28*n7 + pow(alpha, n1*n24 - n136*n7)*n111*n73/(n131*n72) + pow(alpha, n1*n24 - n136*n7)*n19*n28*n7*n73/(n131*n72) + n111*n91)/n183 + n61*n89*xF[11]*(pow(alpha, NP0*n1 - n136*n6)*n1*n133*n28*n6 + pow(alpha, n1*n24 - n136*n6)*n1*n28*n6*n73/(n131*n72) - pow(alpha, n1*n24 - n136*n6)*n28*n30*n73/(n131*n72) + n127)/n182) + 1.0*n100*n221*n61*xF[0]*(pow(alpha, NP0*n1 - n1*n136)*n1*n133*n2 + n100*n2) + n255) - n339, -n20);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - pow(NP_sqrt_base, -n0))/NP_2a;
-      NT1 = n97*(n132 - log(-pow(alpha, NP1*n1)*n123 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[10] - Mstar;
-      g5 = MW[11] - Mstar;
-      g6 = MW[12] - Mstar;
-      g7 = MW[13] - Mstar;
-      g8 = MW[2] - Mstar;
-      g9 = MW[3] - Mstar;
-      g10 = MW[4] - Mstar;
-      g11 = MW[5] - Mstar;
-      g12 = MW[6] - Mstar;
-      g13 = MW[7] - Mstar;
-      g14 = MW[8] - Mstar;
-      g15 = MW[9] - Mstar;
-      g16 = xF[0] - xTj;
-      g17 = xF[0] - xPj;
-      g18 = -xTj;
-      g19 = xPj/xF[1];
-      g20 = pow(alpha, -g1);
-      g21 = pow(alpha, -g4);
-      g22 = pow(alpha, -g5);
-      g23 = pow(alpha, -g6);
-      g24 = pow(alpha, -g7);
-      g25 = pow(alpha, -g0);
-      g26 = pow(alpha, -g8);
-      g27 = pow(alpha, -g9);
-      g28 = pow(alpha, -g10);
-      g29 = pow(alpha, -g11);
-      g30 = pow(alpha, -g12);
-      g31 = pow(alpha, -g13);
-      g32 = pow(alpha, -g14);
-      g33 = pow(alpha, -g15);
-      g34 = log(xF[0]/xF[1]);
-      g35 = -g2;
-      g36 = pow(alpha, NP1*g0);
-      g37 = pow(alpha, NP1*g1);
-      g38 = pow(alpha, NP1*g4);
-      g39 = log(g20);
-      g40 = pow(alpha, NP1*g5);
-      g41 = pow(alpha, NP1*g6);
-      g42 = pow(alpha, NP1*g7);
-      g43 = pow(alpha, NP1*g8);
-      g44 = pow(alpha, NP1*g9);
-      g45 = pow(alpha, NP1*g10);
-      g46 = pow(alpha, NP1*g11);
-      g47 = pow(alpha, NP1*g12);
-      g48 = pow(alpha, NP1*g13);
-      g49 = pow(alpha, NP1*g14);
-      g50 = pow(alpha, NP1*g15);
-      g51 = -g34;
-      g52 = g16/g3;
-      g53 = g3/g16;
-      g54 = -g36 + 1;
-      g55 = -g36 + 1;
-      g56 = -g37 + 1;
-      g57 = -g43 + 1;
-      g58 = -g44 + 1;
-      g59 = -g45 + 1;
-      g60 = -g46 + 1;
-      g61 = -g47 + 1;
-      g62 = -g48 + 1;
-      g63 = -g49 + 1;
-      g64 = -g50 + 1;
-      g65 = -g38 + 1;
-      g66 = -g40 + 1;
-      g67 = -g41 + 1;
-      g68 = -g42 + 1;
-      g69 = -g37;
-      g70 = -g38;
-      g71 = -g40;
-      g72 = -g41;
-      g73 = -g42;
-      g74 = -g43;
-      g75 = -g44;
-      g76 = -g45;
-      g77 = -g46;
-      g78 = -g47;
-      g79 = -g48;
-      g80 = -g49;
-      g81 = -g50;
-      g82 = -1.0*g34;
-      g83 = -g3/g17;
-      g84 = g17/(g3*xF[1]);
-      g85 = pow(alpha, g0*g35) - 1;
-      g86 = pow(alpha, g0*g35) - 1;
-      g87 = pow(alpha, g1*g35) - 1;
-      g88 = pow(alpha, g35*g8) - 1;
-      g89 = pow(alpha, g35*g9) - 1;
-      g90 = pow(alpha, g10*g35) - 1;
-      g91 = pow(alpha, g11*g35) - 1;
-      g92 = pow(alpha, g12*g35) - 1;
-      g93 = pow(alpha, g13*g35) - 1;
-      g94 = pow(alpha, g14*g35) - 1;
-      g95 = pow(alpha, g15*g35) - 1;
-      g96 = pow(alpha, g35*g4) - 1;
-      g97 = pow(alpha, g35*g5) - 1;
-      g98 = pow(alpha, g35*g6) - 1;
-      g99 = pow(alpha, g35*g7) - 1;
-      g100 = -pow(alpha, g1*g35);
-      g101 = -pow(alpha, g35*g4);
-      g102 = -pow(alpha, g35*g5);
-      g103 = -pow(alpha, g35*g6);
-      g104 = -pow(alpha, g35*g7);
-      g105 = -pow(alpha, g35*g8);
-      g106 = -pow(alpha, g35*g9);
-      g107 = -pow(alpha, g10*g35);
-      g108 = -pow(alpha, g11*g35);
-      g109 = -pow(alpha, g12*g35);
-      g110 = -pow(alpha, g13*g35);
-      g111 = -pow(alpha, g14*g35);
-      g112 = -pow(alpha, g15*g35);
-      g113 = g55 + g86;
-      g114 = -g100 - g37;
-      g115 = -g101 - g38;
-      g116 = -g102 - g40;
-      g117 = -g103 - g41;
-      g118 = -g104 - g42;
-      g119 = -g105 - g43;
-      g120 = -g106 - g44;
-      g121 = -g107 - g45;
-      g122 = -g108 - g46;
-      g123 = -g109 - g47;
-      g124 = -g110 - g48;
-      g125 = -g111 - g49;
-      g126 = -g112 - g50;
-      g127 = pow(alpha, g1*g35) + g69;
-      g128 = g55 + g86;
-      g129 = pow(alpha, g35*g4) + g70;
-      g130 = pow(alpha, g35*g5) + g71;
-      g131 = pow(alpha, g35*g6) + g72;
-      g132 = pow(alpha, g35*g7) + g73;
-      g133 = pow(alpha, g35*g8) + g74;
-      g134 = pow(alpha, g35*g9) + g75;
-      g135 = pow(alpha, g10*g35) + g76;
-      g136 = pow(alpha, g11*g35) + g77;
-      g137 = pow(alpha, g12*g35) + g78;
-      g138 = pow(alpha, g13*g35) + g79;
-      g139 = pow(alpha, g14*g35) + g80;
-      g140 = pow(alpha, g15*g35) + g81;
-      g141 = xF[11]/g130;
-      g142 = xF[9]/g140;
-      g143 = xF[8]/g139;
-      g144 = xF[1]/g128;
-      g145 = xF[10]/g129;
-      g146 = xF[3]/g134;
-      g147 = xF[7]/g138;
-      g148 = xF[4]/g135;
-      g149 = xF[12]/g131;
-      g150 = xF[13]/g132;
-      g151 = xF[6]/g137;
-      g152 = xF[5]/g136;
-      g153 = xF[2]/g133;
-      g154 = xF[0]/g127;
-      g155 = xF[1]/g113;
-      g156 = xF[0]/g114;
-      g157 = xF[4]/g121;
-      g158 = xF[7]/g124;
-      g159 = xF[2]/g119;
-      g160 = xF[11]/g116;
-      g161 = xF[13]/g118;
-      g162 = xF[3]/g120;
-      g163 = xF[6]/g123;
-      g164 = xF[8]/g125;
-      g165 = xF[12]/g117;
-      g166 = xF[10]/g115;
-      g167 = xF[9]/g126;
-      g168 = xF[5]/g122;
-      g169 = g61/g123;
-      g170 = g64/g126;
-      g171 = g59/g121;
-      g172 = g62/g124;
-      g173 = g56/g114;
-      g174 = g60/g122;
-      g175 = g67/g117;
-      g176 = g68/g118;
-      g177 = g58/g120;
-      g178 = g54/g113;
-      g179 = g66/g116;
-      g180 = g57/g119;
-      g181 = g65/g115;
-      g182 = g63/g125;
-      g183 = g85/g113;
-      g184 = g87/g114;
-      g185 = g97/g116;
-      g186 = g88/g119;
-      g187 = g89/g120;
-      g188 = g90/g121;
-      g189 = g94/g125;
-      g190 = g95/g126;
-      g191 = g92/g123;
-      g192 = g98/g117;
-      g193 = g99/g118;
-      g194 = g93/g124;
-      g195 = g96/g115;
-      g196 = g91/g122;
-      g197 = log(g128*g18*g84/g55);
-      g198 = log(g113*g18*g84/g54);
-      g199 = log(g128*g19*g52/g86);
-      g200 = 1.0*g197;
-      g201 = log(g113*g19*g52/g85);
-      g202 = 1.0*g199;
-      g203 = -g141*g200*(g71 + 1) - g141*g202*(pow(alpha, g35*g5) - 1) - g142*g200*(g81 + 1) - g142*g202*(pow(alpha, g15*g35) - 1) - g143*g200*(g80 + 1) - g143*g202*(pow(alpha, g14*g35) - 1) - g144*g200*g55 - g144*g202*g86 - g145*g200*(g70 + 1) - g145*g202*(pow(alpha, g35*g4) - 1) - g146*g200*(g75 + 1) - g146*g202*(pow(alpha, g35*g9) - 1) - g147*g200*(g79 + 1) - g147*g202*(pow(alpha, g13*g35) - 1) - g148*g200*(g76 + 1) - g148*g202*(pow(alpha, g10*g35) - 1) - g149*g200*(g72 + 1) - g149*g202*(pow(alpha, g35*g6) - 1) - g150*g200*(g73 + 1) - g150*g202*(pow(alpha, g35*g7) - 1) - g151*g200*(g78 + 1) - g151*g202*(pow(alpha, g12*g35) - 1) - g152*g200*(g77 + 1) - g152*g202*(pow(alpha, g11*g35) - 1) - g153*g200*(g74 + 1) - g153*g202*(pow(alpha, g35*g8) - 1) - g154*g200*(g69 + 1) - g154*g202*(pow(alpha, g1*g35) - 1) - g82*xF[0] - g82*xF[10] - g82*xF[11] - g82*xF[12] - g82*xF[13] - g82*xF[1] - g82*xF[2] - g82*xF[3] - g82*xF[4] - g82*xF[5] - g82*xF[6] - g82*xF[7] - g82*xF[8] - g82*xF[9];
-      LpF = xF[0]*(g20 + 1.0)*(g173*g198 + g184*g201 + g51)/(g39*(g20 - 1.0)) + xF[10]*(g21 + 1.0)*(g181*g198 + g195*g201 + g51)/(g39*(g21 - 1.0)) + xF[11]*(g22 + 1.0)*(g179*g198 + g185*g201 + g51)/(g39*(g22 - 1.0)) + xF[12]*(g23 + 1.0)*(g175*g198 + g192*g201 + g51)/(g39*(g23 - 1.0)) + xF[13]*(g24 + 1.0)*(g176*g198 + g193*g201 + g51)/(g39*(g24 - 1.0)) + xF[1]*(g25 + 1.0)*(g178*g198 + g183*g201 + g51)/(g39*(g25 - 1.0)) + xF[2]*(g26 + 1.0)*(g180*g198 + g186*g201 + g51)/(g39*(g26 - 1.0)) + xF[3]*(g27 + 1.0)*(g177*g198 + g187*g201 + g51)/(g39*(g27 - 1.0)) + xF[4]*(g28 + 1.0)*(g171*g198 + g188*g201 + g51)/(g39*(g28 - 1.0)) + xF[5]*(g29 + 1.0)*(g174*g198 + g196*g201 + g51)/(g39*(g29 - 1.0)) + xF[6]*(g30 + 1.0)*(g169*g198 + g191*g201 + g51)/(g39*(g30 - 1.0)) + xF[7]*(g31 + 1.0)*(g172*g198 + g194*g201 + g51)/(g39*(g31 - 1.0)) + xF[8]*(g32 + 1.0)*(g182*g198 + g189*g201 + g51)/(g39*(g32 - 1.0)) + xF[9]*(g33 + 1.0)*(g170*g198 + g190*g201 + g51)/(g39*(g33 - 1.0));
-      PpF = g52;
-      TpF = -g17/g3;
-      SWUpF = g203;
-      SWUpP = g203*g53;
-      xP[0] = g156*g53*g87;
-      xP[1] = g155*g53*g85;
-      xP[2] = g159*g53*g88;
-      xP[3] = g162*g53*g89;
-      xP[4] = g157*g53*g90;
-      xP[5] = g168*g53*g91;
-      xP[6] = g163*g53*g92;
-      xP[7] = g158*g53*g93;
-      xP[8] = g164*g53*g94;
-      xP[9] = g167*g53*g95;
-      xP[10] = g166*g53*g96;
-      xP[11] = g160*g53*g97;
-      xP[12] = g165*g53*g98;
-      xP[13] = g161*g53*g99;
-      xT[0] = g156*g56*g83;
-      xT[1] = g155*g54*g83;
-      xT[2] = g159*g57*g83;
-      xT[3] = g162*g58*g83;
-      xT[4] = g157*g59*g83;
-      xT[5] = g168*g60*g83;
-      xT[6] = g163*g61*g83;
-      xT[7] = g158*g62*g83;
-      xT[8] = g164*g63*g83;
-      xT[9] = g167*g64*g83;
-      xT[10] = g166*g65*g83;
-      xT[11] = g160*g66*g83;
-      xT[12] = g165*g67*g83;
-      xT[13] = g161*g68*g83;
-      break;
-    case 15:
-      n0 = -2.00000000000000;
-      n1 = MW[0] - Mstar;
-      n2 = log(alpha);
-      n3 = xPj - xTj;
-      n4 = xF[0] - xPj;
-      n5 = MW[10] - Mstar;
-      n6 = MW[11] - Mstar;
-      n7 = MW[12] - Mstar;
-      n8 = MW[13] - Mstar;
-      n9 = MW[14] - Mstar;
-      n10 = MW[1] - Mstar;
-      n11 = MW[2] - Mstar;
-      n12 = MW[3] - Mstar;
-      n13 = MW[4] - Mstar;
-      n14 = MW[5] - Mstar;
-      n15 = MW[6] - Mstar;
-      n16 = MW[7] - Mstar;
-      n17 = MW[8] - Mstar;
-      n18 = MW[9] - Mstar;
-      n19 = log(xTj);
-      n20 = -n1;
-      n21 = -2;
-      n22 = xF[0]*xPj;
-      n23 = -Mstar;
-      n24 = -NP0*n0;
-      n25 = -xTj;
-      n26 = pow(n1, -n0);
-      n27 = pow(n2, -n0);
-      n28 = pow(n5, -n0);
-      n29 = pow(n6, -n0);
-      n30 = pow(n7, -n0);
-      n31 = pow(n8, -n0);
-      n32 = pow(n9, -n0);
-      n33 = pow(n10, -n0);
-      n34 = pow(n11, -n0);
-      n35 = pow(n12, -n0);
-      n36 = pow(n13, -n0);
-      n37 = pow(n14, -n0);
-      n38 = pow(n15, -n0);
-      n39 = pow(n16, -n0);
-      n40 = pow(n17, -n0);
-      n41 = pow(n18, -n0);
-      n42 = Mstar*n2;
-      n43 = -n0*n2;
-      n44 = pow(alpha, NP0*n1);
-      n45 = n22 + n25*xF[0];
-      n46 = n22 + n25*xPj;
-      n47 = pow(alpha, NP0*n5);
-      n48 = pow(alpha, NP0*n6);
-      n49 = pow(alpha, NP0*n7);
-      n50 = pow(alpha, NP0*n8);
-      n51 = pow(alpha, NP0*n9);
-      n52 = pow(alpha, NP0*n10);
-      n53 = pow(alpha, NP0*n11);
-      n54 = pow(alpha, NP0*n12);
-      n55 = pow(alpha, NP0*n13);
-      n56 = pow(alpha, NP0*n14);
-      n57 = pow(alpha, NP0*n15);
-      n58 = pow(alpha, NP0*n16);
-      n59 = pow(alpha, NP0*n17);
-      n60 = pow(alpha, NP0*n18);
-      n61 = -MW[0]*n2;
-      n62 = n3/n4;
-      n63 = n14*n2;
-      n64 = n10*n2;
-      n65 = n11*n2;
-      n66 = n18*n2;
-      n67 = n1*n2;
-      n68 = n16*n2;
-      n69 = -n44 + 1;
-      n70 = -n47 + 1;
-      n71 = pow(alpha, NP0*n0*n20);
-      n72 = pow(n46, -n0);
-      n73 = -n48 + 1;
-      n74 = -n49 + 1;
-      n75 = -n50 + 1;
-      n76 = -n51 + 1;
-      n77 = -n52 + 1;
-      n78 = -n53 + 1;
-      n79 = -n54 + 1;
-      n80 = -n55 + 1;
-      n81 = -n56 + 1;
-      n82 = -n57 + 1;
-      n83 = -n58 + 1;
-      n84 = -n59 + 1;
-      n85 = -n60 + 1;
-      n86 = -n79;
-      n87 = -n73;
-      n88 = -n82;
-      n89 = -n80;
-      n90 = -n44;
-      n91 = -n49;
-      n92 = -n50;
-      n93 = -n51;
-      n94 = -n53;
-      n95 = -n55;
-      n96 = -n56;
-      n97 = -n57;
-      n98 = n44*xF[0];
-      n99 = n60*xF[9];
-      n100 = 1.0/n67;
-      n101 = n15*n57;
-      n102 = n12*n54;
-      n103 = n27*n37;
-      n104 = n13*n55;
-      n105 = n76*xF[14];
-      n106 = n26*n27;
-      n107 = n1*n44;
-      n108 = n27*n39;
-      n109 = n50*n8;
-      n110 = n78*xF[2];
-      n111 = n69*xF[0];
-      n112 = n51*n9;
-      n113 = n27*n34;
-      n114 = n27*n30;
-      n115 = n27*n33;
-      n116 = n47*n5;
-      n117 = n17*n59;
-      n118 = n10*n52;
-      n119 = n81*xF[5];
-      n120 = n49*n7;
-      n121 = n16*n58;
-      n122 = n27*n32;
-      n123 = log((-1.0 + xPj/xF[0])/n3);
-      n124 = -n74*xF[12];
-      n125 = -n85*xF[9];
-      n126 = n116*xF[10];
-      n127 = -n70*xF[10];
-      n128 = -n75*xF[13];
-      n129 = -n84*xF[8];
-      n130 = -n83*xF[7];
-      n131 = n2*n48*n6;
-      n132 = n117*n2;
-      n133 = n46/n45;
-      n134 = n120*n2*xF[12];
-      n135 = n27*n31*n50;
-      n136 = n27*n29*n48;
-      n137 = n27*n40*n59;
-      n138 = n27*n36*n55;
-      n139 = n27*n28*n47;
-      n140 = n27*n38*n57;
-      n141 = n27*n35*n54;
-      n142 = n133*n90 + 1;
-      n143 = n123 + n19 + n42 + n61;
-      n144 = n133/n142;
-      n145 = n144*n27;
-      n146 = n144*n2*n44;
-      n147 = n100*(n143 - log(n142)) + 1;
-      n148 = pow(alpha, n1*n147);
-      n149 = pow(alpha, n147*n5);
-      n150 = pow(alpha, n147*n6);
-      n151 = pow(alpha, n147*n7);
-      n152 = pow(alpha, n147*n8);
-      n153 = pow(alpha, n147*n9);
-      n154 = pow(alpha, n10*n147);
-      n155 = pow(alpha, n11*n147);
-      n156 = pow(alpha, n12*n147);
-      n157 = pow(alpha, n13*n147);
-      n158 = pow(alpha, n14*n147);
-      n159 = pow(alpha, n147*n15);
-      n160 = pow(alpha, n147*n16);
-      n161 = pow(alpha, n147*n17);
-      n162 = pow(alpha, n147*n18);
-      n163 = n7/n151;
-      n164 = n13/n157;
-      n165 = n16/n160;
-      n166 = n9/n153;
-      n167 = n18/n162;
-      n168 = n8/n152;
-      n169 = n12/n156;
-      n170 = n15/n159;
-      n171 = n17/n161;
-      n172 = n6/n150;
-      n173 = n10/n154;
-      n174 = n11/n155;
-      n175 = n5/n149;
-      n176 = n14/n158;
-      n177 = n44/n158;
-      n178 = pow(alpha, n147*n20) + n69 - 1;
-      n179 = n70 - 1 + 1.0/n149;
-      n180 = n73 - 1 + 1.0/n150;
-      n181 = n74 - 1 + 1.0/n151;
-      n182 = n75 - 1 + 1.0/n152;
-      n183 = n76 - 1 + 1.0/n153;
-      n184 = n77 - 1 + 1.0/n154;
-      n185 = n78 - 1 + 1.0/n155;
-      n186 = n79 - 1 + 1.0/n156;
-      n187 = n80 - 1 + 1.0/n157;
-      n188 = n81 - 1 + 1.0/n158;
-      n189 = n82 - 1 + 1.0/n159;
-      n190 = n83 - 1 + 1.0/n160;
-      n191 = n84 - 1 + 1.0/n161;
-      n192 = n85 - 1 + 1.0/n162;
-      n193 = pow(n178, 3);
-      n194 = pow(n179, 3);
-      n195 = pow(n180, 3);
-      n196 = pow(n181, 3);
-      n197 = pow(n182, 3);
-      n198 = pow(n183, 3);
-      n199 = pow(n184, 3);
-      n200 = pow(n185, 3);
-      n201 = pow(n186, 3);
-      n202 = pow(n187, 3);
-      n203 = pow(n188, 3);
-      n204 = pow(n189, 3);
-      n205 = pow(n190, 3);
-      n206 = pow(n191, 3);
-      n207 = pow(n192, 3);
-      n208 = xF[11]/n180;
-      n209 = xF[13]/n182;
-      n210 = xF[4]/n187;
-      n211 = xF[3]/n186;
-      n212 = xF[8]/n191;
-      n213 = xF[6]/n189;
-      n214 = xF[10]/n179;
-      n215 = pow(n186, n21)*xF[3];
-      n216 = xF[6]/n204;
-      n217 = n2/n179;
-      n218 = pow(n187, n21)*xF[4];
-      n219 = -1/n178;
-      n220 = xF[4]/n202;
-      n221 = n2*xF[14]/n183;
-      n222 = n56*xF[5]/n188;
-      n223 = n52*xF[1]/n184;
-      n224 = n58*xF[7]/n190;
-      n225 = n53*xF[2]/n185;
-      n226 = n49*xF[12]/n181;
-      n227 = n51*xF[14]/n183;
-      n228 = n27*n41/n192;
-      n229 = n77/n199;
-      n230 = pow(n178, n21)*n69;
-      n231 = -n119*pow(n188, n21);
-      n232 = n130/n205;
-      n233 = -pow(n184, n21)*n77*xF[1];
-      n234 = n62*n98/(n100*n178);
-      n235 = n2*n20*n62*n98/n178;
-      n236 = n106*n62*n98/n178;
-      n237 = n139*n214*n62;
-      n238 = n136*n208*n62;
-      n239 = n114*n226*n62;
-      n240 = n135*n209*n62;
-      n241 = n122*n227*n62;
-      n242 = n115*n223*n62;
-      n243 = n113*n225*n62;
-      n244 = n141*n211*n62;
-      n245 = n138*n210*n62;
-      n246 = n103*n222*n62;
-      n247 = n140*n213*n62;
-      n248 = n108*n224*n62;
-      n249 = n137*n212*n62;
-      n250 = n228*n62*n99;
-      n251 = 0.5*n236;
-      n252 = n144/n148 + 1;
-      n253 = n144*n44/(n100*n148) + n44/n100;
-      n254 = n116*n2 + n146*n175;
-      n255 = n131 + n146*n172;
-      n256 = n120*n2 + n146*n163;
-      n257 = n109*n2 + n146*n168;
-      n258 = n112*n2 + n146*n166;
-      n259 = n144*n44*n64/n154 + n52*n64;
-      n260 = n144*n44*n65/n155 + n53*n65;
-      n261 = n102*n2 + n146*n169;
-      n262 = n104*n2 + n146*n164;
-      n263 = n144*n177*n63 + n56*n63;
-      n264 = n101*n2 + n146*n170;
-      n265 = n144*n44*n68/n160 + n58*n68;
-      n266 = n132 + n146*n171;
-      n267 = n144*n44*n66/n162 + n60*n66;
-      n268 = pow(n253, -n0);
-      n269 = pow(n254, -n0);
-      n270 = pow(n255, -n0);
-      n271 = pow(n256, -n0);
-      n272 = pow(n257, -n0);
-      n273 = pow(n258, -n0);
-      n274 = pow(n259, -n0);
-      n275 = pow(n260, -n0);
-      n276 = pow(n261, -n0);
-      n277 = pow(n262, -n0);
-      n278 = pow(n263, -n0);
-      n279 = pow(n264, -n0);
-      n280 = pow(n265, -n0);
-      n281 = pow(n266, -n0);
-      n282 = pow(n267, -n0);
-      n283 = n255*xF[11];
-      n284 = n259*xF[1];
-      n285 = n0*n146*n20/n148 + n0*n2*n20*n44;
-      n286 = n274*xF[1];
-      n287 = n106*n144*n90/n148 + n106*n90;
-      n288 = pow(n181, n21)*n256;
-      n289 = pow(n178, n21)*n253;
-      n290 = pow(n192, n21)*n267;
-      n291 = pow(n179, n21)*n254;
-      n292 = pow(n182, n21)*n257;
-      n293 = pow(n183, n21)*n258;
-      n294 = pow(n190, n21)*n265;
-      n295 = pow(n191, n21)*n266;
-      n296 = pow(n189, n21)*n264*xF[6];
-      n297 = n273/n198;
-      n298 = n268/n193;
-      n299 = n275/n200;
-      n300 = n278/n203;
-      n301 = pow(n178, n21)*n287;
-      n302 = -n111*n289*n62;
-      n303 = n0*pow(n178, n21)*n2*n20*n62*n98*(pow(alpha, NP0*n1 + n147*n20)*n144/n100 + n44/n100);
-      n304 = n126*pow(n179, n21)*n43*n62*(pow(alpha, NP0*n1 - n147*n5)*n144*n2*n5 + n116*n2);
-      n305 = pow(n180, n21)*n43*n48*n6*n62*xF[11]*(pow(alpha, NP0*n1 - n147*n6)*n144*n2*n6 + n131);
-      n306 = n120*pow(n181, n21)*n43*n62*xF[12]*(pow(alpha, NP0*n1 - n147*n7)*n144*n2*n7 + n120*n2);
-      n307 = n109*pow(n182, n21)*n43*n62*xF[13]*(pow(alpha, NP0*n1 - n147*n8)*n144*n2*n8 + n109*n2);
-      n308 = n112*pow(n183, n21)*n43*n62*xF[14]*(pow(alpha, NP0*n1 - n147*n9)*n144*n2*n9 + n112*n2);
-      n309 = n118*pow(n184, n21)*n43*n62*xF[1]*(pow(alpha, NP0*n1 - n10*n147)*n144*n64 + n52*n64);
-      n310 = n11*pow(n185, n21)*n43*n53*n62*xF[2]*(pow(alpha, NP0*n1 - n11*n147)*n144*n65 + n53*n65);
-      n311 = n102*n215*n43*n62*(pow(alpha, NP0*n1 - n12*n147)*n12*n144*n2 + n102*n2);
-      n312 = n104*n218*n43*n62*(pow(alpha, NP0*n1 - n13*n147)*n13*n144*n2 + n104*n2);
-      n313 = n14*pow(n188, n21)*n43*n56*n62*xF[5]*(pow(alpha, NP0*n1 - n14*n147)*n144*n63 + n56*n63);
-      n314 = n101*pow(n189, n21)*n43*n62*xF[6]*(pow(alpha, NP0*n1 - n147*n15)*n144*n15*n2 + n101*n2);
-      n315 = n121*pow(n190, n21)*n43*n62*xF[7]*(pow(alpha, NP0*n1 - n147*n16)*n144*n68 + n58*n68);
-      n316 = n117*pow(n191, n21)*n43*n62*xF[8]*(pow(alpha, NP0*n1 - n147*n17)*n144*n17*n2 + n132);
-      n317 = n18*pow(n192, n21)*n43*n62*n99*(pow(alpha, NP0*n1 - n147*n18)*n144*n66 + n60*n66);
-      n318 = 1.0*n289*n62*n98/n100;
-      n319 = n111*n301*n62;
-      n320 = 0.5*n319;
-      n321 = n234 + n302;
-      n322 = -n253*n285/n193;
-      n323 = pow(alpha, n1*n24)*n1*pow(n142, n21)*n175*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24)*pow(n142, n21)*n27*n28*pow(n45, n21)*n72/n149 + n107*n145*n175 + n139;
-      n324 = pow(alpha, n1*n24)*n1*pow(n142, n21)*n172*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24)*pow(n142, n21)*n27*n29*pow(n45, n21)*n72/n150 + n107*n145*n172 + n136;
-      n325 = pow(alpha, n1*n24)*n114*pow(n142, n21)*pow(n45, n21)*n72/n151 + pow(alpha, n1*n24)*pow(n142, n21)*n163*n20*n27*pow(n45, n21)*n72 + n114*n91 + n145*n163*n20*n44;
-      n326 = pow(alpha, n1*n24)*pow(n142, n21)*n168*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24)*pow(n142, n21)*n27*n31*pow(n45, n21)*n72/n152 + n145*n168*n20*n44 + n27*n31*n92;
-      n327 = pow(alpha, n1*n24)*n122*pow(n142, n21)*pow(n45, n21)*n72/n153 + pow(alpha, n1*n24)*pow(n142, n21)*n166*n20*n27*pow(n45, n21)*n72 + n122*n93 + n145*n166*n20*n44;
-      n328 = pow(alpha, n1*n24)*n113*pow(n142, n21)*pow(n45, n21)*n72/n155 + pow(alpha, n1*n24)*pow(n142, n21)*n174*n20*n27*pow(n45, n21)*n72 + n113*n94 + n145*n174*n20*n44;
-      n329 = pow(alpha, n1*n24)*pow(n142, n21)*n164*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24)*pow(n142, n21)*n27*n36*pow(n45, n21)*n72/n157 + n145*n164*n20*n44 + n27*n36*n95;
-      n330 = pow(alpha, n1*n24)*pow(n142, n21)*n170*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24)*pow(n142, n21)*n27*n38*pow(n45, n21)*n72/n159 + n145*n170*n20*n44 + n27*n38*n97;
-      n331 = pow(alpha, n1*n24)*n1*pow(n142, n21)*n165*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24)*n108*pow(n142, n21)*pow(n45, n21)*n72/n160 + n107*n145*n165 + n108*n58;
-      n332 = pow(alpha, n1*n24)*n1*pow(n142, n21)*n171*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24)*pow(n142, n21)*n27*n40*pow(n45, n21)*n72/n161 + n107*n145*n171 + n137;
-      n333 = pow(alpha, n1*n24)*n1*pow(n142, n21)*n167*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24)*pow(n142, n21)*n27*n41*pow(n45, n21)*n72/n162 + n107*n145*n167 + n27*n41*n60;
-      n334 = pow(n181, n21)*n62*n74*xF[12]*(pow(alpha, n1*n24 - n147*n7)*n114*pow(n142, n21)*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n7)*pow(n142, n21)*n20*n27*pow(n45, n21)*n7*n72 + n114*n91 + n145*n163*n20*n44);
-      n335 = pow(n182, n21)*n62*n75*xF[13]*(pow(alpha, n1*n24 - n147*n8)*pow(n142, n21)*n20*n27*pow(n45, n21)*n72*n8 + pow(alpha, n1*n24 - n147*n8)*pow(n142, n21)*n27*n31*pow(n45, n21)*n72 + n145*n168*n20*n44 + n27*n31*n92);
-      n336 = n105*pow(n183, n21)*n62*(pow(alpha, n1*n24 - n147*n9)*n122*pow(n142, n21)*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n9)*pow(n142, n21)*n20*n27*pow(n45, n21)*n72*n9 + n122*n93 + n145*n166*n20*n44);
-      n337 = n110*pow(n185, n21)*n62*(pow(alpha, n1*n24 - n11*n147)*n11*pow(n142, n21)*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n11*n147)*n113*pow(n142, n21)*pow(n45, n21)*n72 + n113*n94 + n145*n174*n20*n44);
-      n338 = n218*n62*n80*(pow(alpha, n1*n24 - n13*n147)*n13*pow(n142, n21)*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n13*n147)*pow(n142, n21)*n27*n36*pow(n45, n21)*n72 + n145*n164*n20*n44 + n27*n36*n95);
-      n339 = pow(n189, n21)*n62*n82*xF[6]*(pow(alpha, n1*n24 - n147*n15)*pow(n142, n21)*n15*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n15)*pow(n142, n21)*n27*n38*pow(n45, n21)*n72 + n145*n170*n20*n44 + n27*n38*n97);
-      n340 = n127*pow(n179, n21)*n62*(pow(alpha, n1*n24 - n147*n5)*n1*pow(n142, n21)*n27*pow(n45, n21)*n5*n72 - pow(alpha, n1*n24 - n147*n5)*pow(n142, n21)*n27*n28*pow(n45, n21)*n72 + n107*n145*n175 + n139);
-      n341 = pow(n180, n21)*n62*n87*xF[11]*(pow(alpha, n1*n24 - n147*n6)*n1*pow(n142, n21)*n27*pow(n45, n21)*n6*n72 - pow(alpha, n1*n24 - n147*n6)*pow(n142, n21)*n27*n29*pow(n45, n21)*n72 + n107*n145*n172 + n136);
-      n342 = n233*n62*(pow(alpha, n1*n24 - n10*n147)*n1*n10*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n10*n147)*n115*pow(n142, n21)*pow(n45, n21)*n72 + n107*n145*n173 + n115*n52);
-      n343 = n215*n62*n86*(pow(alpha, n1*n24 - n12*n147)*n1*n12*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n12*n147)*pow(n142, n21)*n27*n35*pow(n45, n21)*n72 + n107*n145*n169 + n141);
-      n344 = n231*n62*(pow(alpha, n1*n24 - n14*n147)*n1*n14*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n14*n147)*n103*pow(n142, n21)*pow(n45, n21)*n72 + n103*n56 + n107*n145*n176);
-      n345 = n130*pow(n190, n21)*n62*(pow(alpha, n1*n24 - n147*n16)*n1*pow(n142, n21)*n16*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n16)*n108*pow(n142, n21)*pow(n45, n21)*n72 + n107*n145*n165 + n108*n58);
-      n346 = n129*pow(n191, n21)*n62*(pow(alpha, n1*n24 - n147*n17)*n1*pow(n142, n21)*n17*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n17)*pow(n142, n21)*n27*n40*pow(n45, n21)*n72 + n107*n145*n171 + n137);
-      n347 = n125*pow(n192, n21)*n62*(pow(alpha, n1*n24 - n147*n18)*n1*pow(n142, n21)*n18*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n18)*pow(n142, n21)*n27*n41*pow(n45, n21)*n72 + n107*n145*n167 + n27*n41*n60);
-      n348 = n251 + n318 + n320;
-      n349 = n101*n2*n213*n62 + n102*n2*n211*n62 + n104*n2*n210*n62 - n105*n293*n62 + n109*n2*n209*n62 - n110*pow(n185, n21)*n260*n62 + n112*n221*n62 + n124*n288*n62 + n125*n290*n62 + n126*n217*n62 + n127*n291*n62 + n128*n292*n62 + n129*n295*n62 + n130*n294*n62 + n131*n208*n62 + n132*n212*n62 + n134*n62/n181 + pow(n180, n21)*n283*n62*n87 + n215*n261*n62*n86 + n218*n262*n62*n89 + n222*n62*n63 + n223*n62*n64 + n224*n62*n68 + n225*n62*n65 + n231*n263*n62 + n233*n259*n62 + n296*n62*n88 + n321 + n62*n66*n99/n192;
-      n350 = n349*xTj;
-      n351 = n236 + n237 + n238 + n239 + n240 + n241 + n242 + n243 + n244 + n245 + n246 + n247 + n248 + n249 + n250 + n303 + n304 + n305 + n306 + n307 + n308 + n309 + n310 + n311 + n312 + n313 + n314 + n315 + n316 + n317 + n319 + n334 + n335 + n336 + n337 + n338 + n339 + n340 + n341 + n342 + n343 + n344 + n345 + n346 + n347;
-      n352 = -n105*n258*n62*(n112*n43 + n144*n166*n43*n44)/n198 - n110*n260*n62*(n11*n43*n53 + n144*n174*n43*n44)/n200 + n111*n322*n62 - n119*n263*n62*(n14*n43*n56 + n144*n176*n43*n44)/n203 + n124*n256*n62*(n120*n43 + n144*n163*n43*n44)/n196 + n125*n267*n62*(n144*n167*n43*n44 + n18*n43*n60)/n207 + n127*n254*n62*(n116*n43 + n144*n175*n43*n44)/n194 + n128*n257*n62*(n109*n43 + n144*n168*n43*n44)/n197 + n129*n266*n62*(n117*n43 + n144*n171*n43*n44)/n206 + n216*n264*n62*n88*(n101*n43 + n144*n170*n43*n44) + n220*n262*n62*n89*(n104*n43 + n144*n164*n43*n44) - n229*n284*n62*(n118*n43 + n144*n173*n43*n44) + n232*n265*n62*(n121*n43 + n144*n165*n43*n44) + n351 + n261*n62*n86*xF[3]*(n102*n43 + n144*n169*n43*n44)/n201 + n283*n62*n87*(n144*n172*n43*n44 + n43*n48*n6)/n195;
-      NP_b = -n235 - n24*(0.5*n111*pow(n178, n21)*n62*(pow(alpha, NP0*n1 - n1*n147)*n106*(-n22 + xPj*xTj)/(n142*n45) + n106*n90) - 1.0*n111*n298*n62 + n251 - 0.5*xTj*(n105*pow(n183, n21)*n62*(pow(alpha, NP0*n1 - n147*n9)*n145*n20*n9 + pow(alpha, n1*n24 - n147*n9)*n122*pow(n142, n21)*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n9)*pow(n142, n21)*n20*n27*pow(n45, n21)*n72*n9 + n122*n93) + n105*n21*n297*n62 + n110*pow(n185, n21)*n62*(pow(alpha, NP0*n1 - n11*n147)*n11*n145*n20 + pow(alpha, n1*n24 - n11*n147)*n11*pow(n142, n21)*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n11*n147)*n113*pow(n142, n21)*pow(n45, n21)*n72 + n113*n94) + n110*n21*n299*n62 + n111*pow(n178, n21)*n62*(pow(alpha, NP0*n1 - n1*n147)*n106*(-n22 + xPj*xTj)/(n142*n45) + n106*n90) + n111*n21*n298*n62 + n119*n21*n300*n62 + n125*pow(n192, n21)*n62*(pow(alpha, NP0*n1 - n147*n18)*n1*n145*n18 + pow(alpha, n1*n24 - n147*n18)*n1*pow(n142, n21)*n18*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n18)*pow(n142, n21)*n27*n41*pow(n45, n21)*n72 + n27*n41*n60) + n127*pow(n179, n21)*n62*(pow(alpha, NP0*n1 - n147*n5)*n1*n145*n5 + pow(alpha, n1*n24 - n147*n5)*n1*pow(n142, n21)*n27*pow(n45, n21)*n5*n72 - pow(alpha, n1*n24 - n147*n5)*pow(n142, n21)*n27*n28*pow(n45, n21)*n72 + n139) + n129*pow(n191, n21)*n62*(pow(alpha, NP0*n1 - n147*n17)*n1*n145*n17 + pow(alpha, n1*n24 - n147*n17)*n1*pow(n142, n21)*n17*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n17)*pow(n142, n21)*n27*n40*pow(n45, n21)*n72 + n137) + n130*pow(n190, n21)*n62*(pow(alpha, NP0*n1 - n147*n16)*n1*n145*n16 + pow(alpha, n1*n24 - n147*n16)*n1*pow(n142, n21)*n16*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n16)*n108*pow(n142, n21)*pow(n45, n21)*n72 + n108*n58) + pow(n180, n21)*n62*n87*xF[11]*(pow(alpha, NP0*n1 - n147*n6)*n1*n145*n6 + pow(alpha, n1*n24 - n147*n6)*n1*pow(n142, n21)*n27*pow(n45, n21)*n6*n72 - pow(alpha, n1*n24 - n147*n6)*pow(n142, n21)*n27*n29*pow(n45, n21)*n72 + n136) + pow(n181, n21)*n62*n74*xF[12]*(pow(alpha, NP0*n1 - n147*n7)*n145*n20*n7 + pow(alpha, n1*n24 - n147*n7)*n114*pow(n142, n21)*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n7)*pow(n142, n21)*n20*n27*pow(n45, n21)*n7*n72 + n114*n91) + pow(n182, n21)*n62*n75*xF[13]*(pow(alpha, NP0*n1 - n147*n8)*n145*n20*n8 + pow(alpha, n1*n24 - n147*n8)*pow(n142, n21)*n20*n27*pow(n45, n21)*n72*n8 + pow(alpha, n1*n24 - n147*n8)*pow(n142, n21)*n27*n31*pow(n45, n21)*n72 + n27*n31*n92) + pow(n189, n21)*n62*n82*xF[6]*(pow(alpha, NP0*n1 - n147*n15)*n145*n15*n20 + pow(alpha, n1*n24 - n147*n15)*pow(n142, n21)*n15*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n15)*pow(n142, n21)*n27*n38*pow(n45, n21)*n72 + n27*n38*n97) + n21*n216*n279*n62*n82 + n21*n220*n277*n62*n80 + n21*n229*n286*n62 + n215*n62*n86*(pow(alpha, NP0*n1 - n12*n147)*n1*n12*n145 + pow(alpha, n1*n24 - n12*n147)*n1*n12*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n12*n147)*pow(n142, n21)*n27*n35*pow(n45, n21)*n72 + n141) + n218*n62*n80*(pow(alpha, NP0*n1 - n13*n147)*n13*n145*n20 + pow(alpha, n1*n24 - n13*n147)*n13*pow(n142, n21)*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n13*n147)*pow(n142, n21)*n27*n36*pow(n45, n21)*n72 + n27*n36*n95) + n231*n62*(pow(alpha, NP0*n1 - n14*n147)*n1*n14*n145 + pow(alpha, n1*n24 - n14*n147)*n1*n14*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n14*n147)*n103*pow(n142, n21)*pow(n45, n21)*n72 + n103*n56) + n233*n62*(pow(alpha, NP0*n1 - n10*n147)*n1*n10*n145 + pow(alpha, n1*n24 - n10*n147)*n1*n10*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n10*n147)*n115*pow(n142, n21)*pow(n45, n21)*n72 + n115*n52) + n236 + n237 + n238 + n239 + n240 + n241 + n242 + n243 + n244 + n245 + n246 + n247 + n248 + n249 + n250 + n303 + n304 + n305 + n306 + n307 + n308 + n309 + n310 + n311 + n312 + n313 + n314 + n315 + n316 + n317 + n21*n282*n62*n85*xF[9]/n207 + n21*n281*n62*n84*xF[8]/n206 + n21*n280*n62*n83*xF[7]/n205 + n21*n276*n62*n79*xF[3]/n201 + n21*n272*n62*n75*xF[13]/n197 + n21*n271*n62*n74*xF[12]/n196 + n21*n270*n62*n73*xF[11]/n195 + n21*n269*n62*n70*xF[10]/n194) + 1.0*pow(n178, n21)*n62*n98*(pow(alpha, NP0*n1 - n1*n147)*n144/n100 + n44/n100)/n100) - n62*xTj*(n101*n2*n213 + n102*n2*n211 + n104*n2*n210 - n105*n293 + n109*n2*n209 - n110*pow(n185, n21)*n260 - n111*n289 + n112*n221 + n124*n288 + n125*n290 + n126*n217 + n127*n291 + n128*n292 + n129*n295 + n130*n294 + n131*n208 + n132*n212 + n134/n181 + pow(n180, n21)*n283*n87 + n215*n261*n86 + n218*n262*n89 + n222*n63 + n223*n64 + n224*n68 + n225*n65 + n231*n263 + n233*n259 + n296*n88 + n66*n99/n192 + n98/(n100*n178)) - n230*n252*n62*n98/n100;
-      NP_2a = -n62*(-pow(alpha, n1*n24)*n0*n106*n111*pow(n252, -n0)/n193 + pow(alpha, n1*n24)*n0*n106*pow(n178, n21)*n252*xF[0] + n106*n111*pow(n178, n21)*n90*(-1 + (-n22 + xPj*xTj)/(n142*n148*n45)) - 1.0*n106*n98/n178 + 1.0*xTj*(n0*pow(n178, n21)*n2*n20*n98*(pow(alpha, NP0*n1 + n147*n20)*n144/n100 + n44/n100) + n101*pow(n189, n21)*n43*xF[6]*(pow(alpha, NP0*n1 - n147*n15)*n144*n15*n2 + n101*n2) + n102*n215*n43*(pow(alpha, NP0*n1 - n12*n147)*n12*n144*n2 + n102*n2) + n103*n222 + n104*n218*n43*(pow(alpha, NP0*n1 - n13*n147)*n13*n144*n2 + n104*n2) + n105*pow(n183, n21)*(pow(alpha, n1*n24 - n147*n9)*n122*pow(n142, n21)*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n9)*pow(n142, n21)*n20*n27*pow(n45, n21)*n72*n9 + n122*n93 + n145*n166*n20*n44) + n105*n21*n297 + n106*n98/n178 + n108*n224 + n109*pow(n182, n21)*n43*xF[13]*(pow(alpha, NP0*n1 - n147*n8)*n144*n2*n8 + n109*n2) + n11*pow(n185, n21)*n43*n53*xF[2]*(pow(alpha, NP0*n1 - n11*n147)*n144*n65 + n53*n65) + n110*pow(n185, n21)*(pow(alpha, n1*n24 - n11*n147)*n11*pow(n142, n21)*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n11*n147)*n113*pow(n142, n21)*pow(n45, n21)*n72 + n113*n94 + n145*n174*n20*n44) + n110*n21*n299 + n111*n21*n298 + n111*n301 + n112*pow(n183, n21)*n43*xF[14]*(pow(alpha, NP0*n1 - n147*n9)*n144*n2*n9 + n112*n2) + n113*n225 + n114*n226 + n115*n223 + n117*pow(n191, n21)*n43*xF[8]*(pow(alpha, NP0*n1 - n147*n17)*n144*n17*n2 + n132) + n118*pow(n184, n21)*n43*xF[1]*(pow(alpha, NP0*n1 - n10*n147)*n144*n64 + n52*n64) + n119*n21*n300 + n120*pow(n181, n21)*n43*xF[12]*(pow(alpha, NP0*n1 - n147*n7)*n144*n2*n7 + n120*n2) + n121*pow(n190, n21)*n43*xF[7]*(pow(alpha, NP0*n1 - n147*n16)*n144*n68 + n58*n68) + n122*n227 + n125*pow(n192, n21)*(pow(alpha, n1*n24 - n147*n18)*n1*pow(n142, n21)*n18*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n18)*pow(n142, n21)*n27*n41*pow(n45, n21)*n72 + n107*n145*n167 + n27*n41*n60) + n126*pow(n179, n21)*n43*(pow(alpha, NP0*n1 - n147*n5)*n144*n2*n5 + n116*n2) + n127*pow(n179, n21)*(pow(alpha, n1*n24 - n147*n5)*n1*pow(n142, n21)*n27*pow(n45, n21)*n5*n72 - pow(alpha, n1*n24 - n147*n5)*pow(n142, n21)*n27*n28*pow(n45, n21)*n72 + n107*n145*n175 + n139) + n129*pow(n191, n21)*(pow(alpha, n1*n24 - n147*n17)*n1*pow(n142, n21)*n17*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n17)*pow(n142, n21)*n27*n40*pow(n45, n21)*n72 + n107*n145*n171 + n137) + n130*pow(n190, n21)*(pow(alpha, n1*n24 - n147*n16)*n1*pow(n142, n21)*n16*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n16)*n108*pow(n142, n21)*pow(n45, n21)*n72 + n107*n145*n165 + n108*n58) + n135*n209 + n136*n208 + n137*n212 + n138*n210 + n139*n214 + n14*pow(n188, n21)*n43*n56*xF[5]*(pow(alpha, NP0*n1 - n14*n147)*n144*n63 + n56*n63) + n140*n213 + n141*n211 + n18*pow(n192, n21)*n43*n99*(pow(alpha, NP0*n1 - n147*n18)*n144*n66 + n60*n66) + pow(n180, n21)*n43*n48*n6*xF[11]*(pow(alpha, NP0*n1 - n147*n6)*n144*n2*n6 + n131) + pow(n180, n21)*n87*xF[11]*(pow(alpha, n1*n24 - n147*n6)*n1*pow(n142, n21)*n27*pow(n45, n21)*n6*n72 - pow(alpha, n1*n24 - n147*n6)*pow(n142, n21)*n27*n29*pow(n45, n21)*n72 + n107*n145*n172 + n136) + pow(n181, n21)*n74*xF[12]*(pow(alpha, n1*n24 - n147*n7)*n114*pow(n142, n21)*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n7)*pow(n142, n21)*n20*n27*pow(n45, n21)*n7*n72 + n114*n91 + n145*n163*n20*n44) + pow(n182, n21)*n75*xF[13]*(pow(alpha, n1*n24 - n147*n8)*pow(n142, n21)*n20*n27*pow(n45, n21)*n72*n8 + pow(alpha, n1*n24 - n147*n8)*pow(n142, n21)*n27*n31*pow(n45, n21)*n72 + n145*n168*n20*n44 + n27*n31*n92) + pow(n189, n21)*n82*xF[6]*(pow(alpha, n1*n24 - n147*n15)*pow(n142, n21)*n15*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n15)*pow(n142, n21)*n27*n38*pow(n45, n21)*n72 + n145*n170*n20*n44 + n27*n38*n97) + n21*n216*n279*n82 + n21*n220*n277*n80 + n21*n229*n286 + n215*n86*(pow(alpha, n1*n24 - n12*n147)*n1*n12*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n12*n147)*pow(n142, n21)*n27*n35*pow(n45, n21)*n72 + n107*n145*n169 + n141) + n218*n80*(pow(alpha, n1*n24 - n13*n147)*n13*pow(n142, n21)*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n13*n147)*pow(n142, n21)*n27*n36*pow(n45, n21)*n72 + n145*n164*n20*n44 + n27*n36*n95) + n228*n99 + n231*(pow(alpha, n1*n24 - n14*n147)*n1*n14*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n14*n147)*n103*pow(n142, n21)*pow(n45, n21)*n72 + n103*n56 + n107*n145*n176) + n233*(pow(alpha, n1*n24 - n10*n147)*n1*n10*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n10*n147)*n115*pow(n142, n21)*pow(n45, n21)*n72 + n107*n145*n173 + n115*n52) + n21*n282*n85*xF[9]/n207 + n21*n281*n84*xF[8]/n206 + n21*n280*n83*xF[7]/n205 + n21*n276*n79*xF[3]/n201 + n21*n272*n75*xF[13]/n197 + n21*n271*n74*xF[12]/n196 + n21*n270*n73*xF[11]/n195 + n21*n269*n70*xF[10]/n194));
-      NP_sqrt_base = (NP0*(n25*(n101*n2*n213*n62 + n102*n2*n211*n62 + n104*n2*n210*n62 - n105*pow(n183, n21)*n62*(pow(alpha, NP0*n1 - n147*n9)*n144*n2*n9 + n112*n2) + n109*n2*n209*n62 - n110*pow(n185, n21)*n62*(pow(alpha, NP0*n1 - n11*n147)*n144*n65 + n53*n65) - n111*pow(n178, n21)*n62*(pow(alpha, NP0*n1 - n1*n147)*n144/n100 + n44/n100) + n112*n221*n62 + n124*pow(n181, n21)*n62*(pow(alpha, NP0*n1 - n147*n7)*n144*n2*n7 + n120*n2) + n125*pow(n192, n21)*n62*(pow(alpha, NP0*n1 - n147*n18)*n144*n66 + n60*n66) + n126*n217*n62 + n127*pow(n179, n21)*n62*(pow(alpha, NP0*n1 - n147*n5)*n144*n2*n5 + n116*n2) + n128*pow(n182, n21)*n62*(pow(alpha, NP0*n1 - n147*n8)*n144*n2*n8 + n109*n2) + n129*pow(n191, n21)*n62*(pow(alpha, NP0*n1 - n147*n17)*n144*n17*n2 + n132) + n130*pow(n190, n21)*n62*(pow(alpha, NP0*n1 - n147*n16)*n144*n68 + n58*n68) + n131*n208*n62 + n132*n212*n62 + n134*n62/n181 + pow(n180, n21)*n62*n87*xF[11]*(pow(alpha, NP0*n1 - n147*n6)*n144*n2*n6 + n131) + pow(n189, n21)*n62*n88*xF[6]*(pow(alpha, NP0*n1 - n147*n15)*n144*n15*n2 + n101*n2) + n215*n62*n86*(pow(alpha, NP0*n1 - n12*n147)*n12*n144*n2 + n102*n2) + n218*n62*n89*(pow(alpha, NP0*n1 - n13*n147)*n13*n144*n2 + n104*n2) + n222*n62*n63 + n223*n62*n64 + n224*n62*n68 + n225*n62*n65 + n231*n62*(pow(alpha, NP0*n1 - n14*n147)*n144*n63 + n56*n63) + n233*n62*(pow(alpha, NP0*n1 - n10*n147)*n144*n64 + n52*n64) + n234 + n62*n66*n99/n192) + n321) + n111*n62/n178 + xTj*(-n105*n62/n183 - n110*n62/n185 + n111*n219*n62 - n119*n62/n188 + n124*n62/n181 + n125*n62/n192 + n127*n62/n179 + n128*n62/n182 + n129*n62/n191 + n130*n62/n190 + n208*n62*n87 + n210*n62*n89 + n211*n62*n86 + n213*n62*n88 - n62*n77*xF[1]/n184) + pow(NP0, -n0)*(0.5*n111*n253*n285*n62/n193 - 0.5*n236 - 0.5*n319 + 0.5*n352*xTj - 1.0*n289*n62*n98/n100))*(-n0*n236 - n0*n25*(n105*pow(n183, n21)*n62*(pow(alpha, NP0*n1 - n147*n9)*n145*n20*n9 + pow(alpha, n1*n24 - n147*n9)*n122*pow(n142, n21)*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n9)*pow(n142, n21)*n20*n27*pow(n45, n21)*n72*n9 + n122*n93) - n105*n62*(pow(alpha, NP0*n1 - n147*n9)*n144*n2*n9 + n112*n2)*(pow(alpha, NP0*n1 - n147*n9)*n144*n43*n9 + n112*n43)/n198 + n110*pow(n185, n21)*n62*(pow(alpha, NP0*n1 - n11*n147)*n11*n145*n20 + pow(alpha, n1*n24 - n11*n147)*n11*pow(n142, n21)*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n11*n147)*n113*pow(n142, n21)*pow(n45, n21)*n72 + n113*n94) - n110*n62*(pow(alpha, NP0*n1 - n11*n147)*n144*n65 + n53*n65)*(pow(alpha, NP0*n1 - n11*n147)*n11*n144*n43 + n11*n43*n53)/n200 + n111*pow(n178, n21)*n62*(pow(alpha, NP0*n1 - n1*n147)*n106*(-n22 + xPj*xTj)/(n142*n45) + n106*n90) - n111*n62*(pow(alpha, NP0*n1 - n1*n147)*n144/n100 + n44/n100)*(pow(alpha, NP0*n1 - n1*n147)*n0*n144*n2*n20 + n0*n2*n20*n44)/n193 - n119*n62*(pow(alpha, NP0*n1 - n14*n147)*n144*n63 + n56*n63)*(pow(alpha, NP0*n1 - n14*n147)*n14*n144*n43 + n14*n43*n56)/n203 + n124*n62*(pow(alpha, NP0*n1 - n147*n7)*n144*n2*n7 + n120*n2)*(pow(alpha, NP0*n1 - n147*n7)*n144*n43*n7 + n120*n43)/n196 + n125*pow(n192, n21)*n62*(pow(alpha, NP0*n1 - n147*n18)*n1*n145*n18 + pow(alpha, n1*n24 - n147*n18)*n1*pow(n142, n21)*n18*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n18)*pow(n142, n21)*n27*n41*pow(n45, n21)*n72 + n27*n41*n60) + n125*n62*(pow(alpha, NP0*n1 - n147*n18)*n144*n66 + n60*n66)*(pow(alpha, NP0*n1 - n147*n18)*n144*n18*n43 + n18*n43*n60)/n207 + n127*pow(n179, n21)*n62*(pow(alpha, NP0*n1 - n147*n5)*n1*n145*n5 + pow(alpha, n1*n24 - n147*n5)*n1*pow(n142, n21)*n27*pow(n45, n21)*n5*n72 - pow(alpha, n1*n24 - n147*n5)*pow(n142, n21)*n27*n28*pow(n45, n21)*n72 + n139) + n127*n62*(pow(alpha, NP0*n1 - n147*n5)*n144*n2*n5 + n116*n2)*(pow(alpha, NP0*n1 - n147*n5)*n144*n43*n5 + n116*n43)/n194 + n128*n62*(pow(alpha, NP0*n1 - n147*n8)*n144*n2*n8 + n109*n2)*(pow(alpha, NP0*n1 - n147*n8)*n144*n43*n8 + n109*n43)/n197 + n129*pow(n191, n21)*n62*(pow(alpha, NP0*n1 - n147*n17)*n1*n145*n17 + pow(alpha, n1*n24 - n147*n17)*n1*pow(n142, n21)*n17*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n17)*pow(n142, n21)*n27*n40*pow(n45, n21)*n72 + n137) + n129*n62*(pow(alpha, NP0*n1 - n147*n17)*n144*n17*n2 + n132)*(pow(alpha, NP0*n1 - n147*n17)*n144*n17*n43 + n117*n43)/n206 + n130*pow(n190, n21)*n62*(pow(alpha, NP0*n1 - n147*n16)*n1*n145*n16 + pow(alpha, n1*n24 - n147*n16)*n1*pow(n142, n21)*n16*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n16)*n108*pow(n142, n21)*pow(n45, n21)*n72 + n108*n58) + pow(n180, n21)*n62*n87*xF[11]*(pow(alpha, NP0*n1 - n147*n6)*n1*n145*n6 + pow(alpha, n1*n24 - n147*n6)*n1*pow(n142, n21)*n27*pow(n45, n21)*n6*n72 - pow(alpha, n1*n24 - n147*n6)*pow(n142, n21)*n27*n29*pow(n45, n21)*n72 + n136) + pow(n181, n21)*n62*n74*xF[12]*(pow(alpha, NP0*n1 - n147*n7)*n145*n20*n7 + pow(alpha, n1*n24 - n147*n7)*n114*pow(n142, n21)*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n7)*pow(n142, n21)*n20*n27*pow(n45, n21)*n7*n72 + n114*n91) + pow(n182, n21)*n62*n75*xF[13]*(pow(alpha, NP0*n1 - n147*n8)*n145*n20*n8 + pow(alpha, n1*n24 - n147*n8)*pow(n142, n21)*n20*n27*pow(n45, n21)*n72*n8 + pow(alpha, n1*n24 - n147*n8)*pow(n142, n21)*n27*n31*pow(n45, n21)*n72 + n27*n31*n92) + pow(n189, n21)*n62*n82*xF[6]*(pow(alpha, NP0*n1 - n147*n15)*n145*n15*n20 + pow(alpha, n1*n24 - n147*n15)*pow(n142, n21)*n15*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n15)*pow(n142, n21)*n27*n38*pow(n45, n21)*n72 + n27*n38*n97) + n215*n62*n86*(pow(alpha, NP0*n1 - n12*n147)*n1*n12*n145 + pow(alpha, n1*n24 - n12*n147)*n1*n12*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n12*n147)*pow(n142, n21)*n27*n35*pow(n45, n21)*n72 + n141) + n216*n62*n88*(pow(alpha, NP0*n1 - n147*n15)*n144*n15*n2 + n101*n2)*(pow(alpha, NP0*n1 - n147*n15)*n144*n15*n43 + n101*n43) + n218*n62*n80*(pow(alpha, NP0*n1 - n13*n147)*n13*n145*n20 + pow(alpha, n1*n24 - n13*n147)*n13*pow(n142, n21)*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n13*n147)*pow(n142, n21)*n27*n36*pow(n45, n21)*n72 + n27*n36*n95) + n220*n62*n89*(pow(alpha, NP0*n1 - n13*n147)*n13*n144*n2 + n104*n2)*(pow(alpha, NP0*n1 - n13*n147)*n13*n144*n43 + n104*n43) - n229*n62*xF[1]*(pow(alpha, NP0*n1 - n10*n147)*n144*n64 + n52*n64)*(pow(alpha, NP0*n1 - n10*n147)*n10*n144*n43 + n118*n43) + n231*n62*(pow(alpha, NP0*n1 - n14*n147)*n1*n14*n145 + pow(alpha, n1*n24 - n14*n147)*n1*n14*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n14*n147)*n103*pow(n142, n21)*pow(n45, n21)*n72 + n103*n56) + n232*n62*(pow(alpha, NP0*n1 - n147*n16)*n144*n68 + n58*n68)*(pow(alpha, NP0*n1 - n147*n16)*n144*n16*n43 + n121*n43) + n233*n62*(pow(alpha, NP0*n1 - n10*n147)*n1*n10*n145 + pow(alpha, n1*n24 - n10*n147)*n1*n10*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n10*n147)*n115*pow(n142, n21)*pow(n45, n21)*n72 + n115*n52) + n236 + n237 + n238 + n239 + n240 + n241 + n242 + n243 + n244 + n245 + n246 + n247 + n248 + n249 + n250 + n303 + n304 + n305 + n306 + n307 + n308 + n309 + n310 + n311 + n312 + n313 + n314 + n315 + n316 + n317 + n62*n86*xF[3]*(pow(alpha, NP0*n1 - n12*n147)*n12*n144*n2 + n102*n2)*(pow(alpha, NP0*n1 - n12*n147)*n12*n144*n43 + n102*n43)/n201 + n62*n87*xF[11]*(pow(alpha, NP0*n1 - n147*n6)*n144*n2*n6 + n131)*(pow(alpha, NP0*n1 - n147*n6)*n144*n43*n6 + n43*n48*n6)/n195) - n0*n319 - 4.0*n111*n298*n62 + 4.0*n289*n62*n98/n100) + pow(-n111*n289*n62 - n235 - n24*(0.5*n111*pow(n178, n21)*n62*(pow(alpha, NP0*n1 - n1*n147)*n106*(-n22 + xPj*xTj)/(n142*n45) + n106*n90) - 0.5*n111*n62*(pow(alpha, NP0*n1 - n1*n147)*n144/n100 + n44/n100)*(pow(alpha, NP0*n1 - n1*n147)*n0*n144*n2*n20 + n0*n2*n20*n44)/n193 + n251 - 0.5*xTj*(n105*pow(n183, n21)*n62*(pow(alpha, NP0*n1 - n147*n9)*n145*n20*n9 + pow(alpha, n1*n24 - n147*n9)*n122*pow(n142, n21)*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n9)*pow(n142, n21)*n20*n27*pow(n45, n21)*n72*n9 + n122*n93) - n105*n62*(pow(alpha, NP0*n1 - n147*n9)*n144*n2*n9 + n112*n2)*(pow(alpha, NP0*n1 - n147*n9)*n144*n43*n9 + n112*n43)/n198 + n110*pow(n185, n21)*n62*(pow(alpha, NP0*n1 - n11*n147)*n11*n145*n20 + pow(alpha, n1*n24 - n11*n147)*n11*pow(n142, n21)*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n11*n147)*n113*pow(n142, n21)*pow(n45, n21)*n72 + n113*n94) - n110*n62*(pow(alpha, NP0*n1 - n11*n147)*n144*n65 + n53*n65)*(pow(alpha, NP0*n1 - n11*n147)*n11*n144*n43 + n11*n43*n53)/n200 + n111*pow(n178, n21)*n62*(pow(alpha, NP0*n1 - n1*n147)*n106*(-n22 + xPj*xTj)/(n142*n45) + n106*n90) - n111*n62*(pow(alpha, NP0*n1 - n1*n147)*n144/n100 + n44/n100)*(pow(alpha, NP0*n1 - n1*n147)*n0*n144*n2*n20 + n0*n2*n20*n44)/n193 - n119*n62*(pow(alpha, NP0*n1 - n14*n147)*n144*n63 + n56*n63)*(pow(alpha, NP0*n1 - n14*n147)*n14*n144*n43 + n14*n43*n56)/n203 + n124*n62*(pow(alpha, NP0*n1 - n147*n7)*n144*n2*n7 + n120*n2)*(pow(alpha, NP0*n1 - n147*n7)*n144*n43*n7 + n120*n43)/n196 + n125*pow(n192, n21)*n62*(pow(alpha, NP0*n1 - n147*n18)*n1*n145*n18 + pow(alpha, n1*n24 - n147*n18)*n1*pow(n142, n21)*n18*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n18)*pow(n142, n21)*n27*n41*pow(n45, n21)*n72 + n27*n41*n60) + n125*n62*(pow(alpha, NP0*n1 - n147*n18)*n144*n66 + n60*n66)*(pow(alpha, NP0*n1 - n147*n18)*n144*n18*n43 + n18*n43*n60)/n207 + n127*pow(n179, n21)*n62*(pow(alpha, NP0*n1 - n147*n5)*n1*n145*n5 + pow(alpha, n1*n24 - n147*n5)*n1*pow(n142, n21)*n27*pow(n45, n21)*n5*n72 - pow(alpha, n1*n24 - n147*n5)*pow(n142, n21)*n27*n28*pow(n45, n21)*n72 + n139) + n127*n62*(pow(alpha, NP0*n1 - n147*n5)*n144*n2*n5 + n116*n2)*(pow(alpha, NP0*n1 - n147*n5)*n144*n43*n5 + n116*n43)/n194 + n128*n62*(pow(alpha, NP0*n1 - n147*n8)*n144*n2*n8 + n109*n2)*(pow(alpha, NP0*n1 - n147*n8)*n144*n43*n8 + n109*n43)/n197 + n129*pow(n191, n21)*n62*(pow(alpha, NP0*n1 - n147*n17)*n1*n145*n17 + pow(alpha, n1*n24 - n147*n17)*n1*pow(n142, n21)*n17*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n17)*pow(n142, n21)*n27*n40*pow(n45, n21)*n72 + n137) + n129*n62*(pow(alpha, NP0*n1 - n147*n17)*n144*n17*n2 + n132)*(pow(alpha, NP0*n1 - n147*n17)*n144*n17*n43 + n117*n43)/n206 + n130*pow(n190, n21)*n62*(pow(alpha, NP0*n1 - n147*n16)*n1*n145*n16 + pow(alpha, n1*n24 - n147*n16)*n1*pow(n142, n21)*n16*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n147*n16)*n108*pow(n142, n21)*pow(n45, n21)*n72 + n108*n58) + pow(n180, n21)*n62*n87*xF[11]*(pow(alpha, NP0*n1 - n147*n6)*n1*n145*n6 + pow(alpha, n1*n24 - n147*n6)*n1*pow(n142, n21)*n27*pow(n45, n21)*n6*n72 - pow(alpha, n1*n24 - n147*n6)*pow(n142, n21)*n27*n29*pow(n45, n21)*n72 + n136) + pow(n181, n21)*n62*n74*xF[12]*(pow(alpha, NP0*n1 - n147*n7)*n145*n20*n7 + pow(alpha, n1*n24 - n147*n7)*n114*pow(n142, n21)*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n7)*pow(n142, n21)*n20*n27*pow(n45, n21)*n7*n72 + n114*n91) + pow(n182, n21)*n62*n75*xF[13]*(pow(alpha, NP0*n1 - n147*n8)*n145*n20*n8 + pow(alpha, n1*n24 - n147*n8)*pow(n142, n21)*n20*n27*pow(n45, n21)*n72*n8 + pow(alpha, n1*n24 - n147*n8)*pow(n142, n21)*n27*n31*pow(n45, n21)*n72 + n27*n31*n92) + pow(n189, n21)*n62*n82*xF[6]*(pow(alpha, NP0*n1 - n147*n15)*n145*n15*n20 + pow(alpha, n1*n24 - n147*n15)*pow(n142, n21)*n15*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n147*n15)*pow(n142, n21)*n27*n38*pow(n45, n21)*n72 + n27*n38*n97) + n215*n62*n86*(pow(alpha, NP0*n1 - n12*n147)*n1*n12*n145 + pow(alpha, n1*n24 - n12*n147)*n1*n12*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n12*n147)*pow(n142, n21)*n27*n35*pow(n45, n21)*n72 + n141) + n216*n62*n88*(pow(alpha, NP0*n1 - n147*n15)*n144*n15*n2 + n101*n2)*(pow(alpha, NP0*n1 - n147*n15)*n144*n15*n43 + n101*n43) + n218*n62*n80*(pow(alpha, NP0*n1 - n13*n147)*n13*n145*n20 + pow(alpha, n1*n24 - n13*n147)*n13*pow(n142, n21)*n20*n27*pow(n45, n21)*n72 + pow(alpha, n1*n24 - n13*n147)*pow(n142, n21)*n27*n36*pow(n45, n21)*n72 + n27*n36*n95) + n220*n62*n89*(pow(alpha, NP0*n1 - n13*n147)*n13*n144*n2 + n104*n2)*(pow(alpha, NP0*n1 - n13*n147)*n13*n144*n43 + n104*n43) - n229*n62*xF[1]*(pow(alpha, NP0*n1 - n10*n147)*n144*n64 + n52*n64)*(pow(alpha, NP0*n1 - n10*n147)*n10*n144*n43 + n118*n43) + n231*n62*(pow(alpha, NP0*n1 - n14*n147)*n1*n14*n145 + pow(alpha, n1*n24 - n14*n147)*n1*n14*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n14*n147)*n103*pow(n142, n21)*pow(n45, n21)*n72 + n103*n56) + n232*n62*(pow(alpha, NP0*n1 - n147*n16)*n144*n68 + n58*n68)*(pow(alpha, NP0*n1 - n147*n16)*n144*n16*n43 + n121*n43) + n233*n62*(pow(alpha, NP0*n1 - n10*n147)*n1*n10*n145 + pow(alpha, n1*n24 - n10*n147)*n1*n10*pow(n142, n21)*n27*pow(n45, n21)*n72 - pow(alpha, n1*n24 - n10*n147)*n115*pow(n142, n21)*pow(n45, n21)*n72 + n115*n52) + n236 + n237 + n238 + n239 + n240 + n241 + n242 + n243 + n244 + n245 + n246 + n247 + n248 + n249 + n250 + n303 + n304 + n305 + n306 + n307 + n308 + n309 + n310 + n311 + n312 + n313 + n314 + n315 + n316 + n317 + n62*n86*xF[3]*(pow(alpha, NP0*n1 - n12*n147)*n12*n144*n2 + n102*n2)*(pow(alpha, NP0*n1 - n12*n147)*n12*n144*n43 + n102*n43)/n201 + n62*n87*xF[11]*(pow(alpha, NP0*n1 - n147*n6)*n144*n2*n6 + n131)*(pow(alpha, NP0*n1 - n147*n6)*n144*n43*n6 + n43*n48*n6)/n195) + 1.0*pow(n178, n21)*n62*n98*(pow(alpha, NP0*n1 - n1*n147)*n144/n100 + n44/n100)/n100) - n350, -n0);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n100*(n143 - log(-pow(alpha, NP1*n1)*n133 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[10] - Mstar;
-      g5 = MW[11] - Mstar;
-      g6 = MW[12] - Mstar;
-      g7 = MW[13] - Mstar;
-      g8 = MW[14] - Mstar;
-      g9 = MW[2] - Mstar;
-      g10 = MW[3] - Mstar;
-      g11 = MW[4] - Mstar;
-      g12 = MW[5] - Mstar;
-      g13 = MW[6] - Mstar;
-      g14 = MW[7] - Mstar;
-      g15 = MW[8] - Mstar;
-      g16 = MW[9] - Mstar;
-      g17 = xF[0] - xTj;
-      g18 = xF[0] - xPj;
-      g19 = -xTj;
-      g20 = xPj/xF[1];
-      g21 = pow(alpha, -g1);
-      g22 = pow(alpha, -g4);
-      g23 = pow(alpha, -g5);
-      g24 = pow(alpha, -g6);
-      g25 = pow(alpha, -g7);
-      g26 = pow(alpha, -g8);
-      g27 = pow(alpha, -g0);
-      g28 = pow(alpha, -g9);
-      g29 = pow(alpha, -g10);
-      g30 = pow(alpha, -g11);
-      g31 = pow(alpha, -g12);
-      g32 = pow(alpha, -g13);
-      g33 = pow(alpha, -g14);
-      g34 = pow(alpha, -g15);
-      g35 = pow(alpha, -g16);
-      g36 = log(xF[0]/xF[1]);
-      g37 = -g2;
-      g38 = pow(alpha, NP1*g0);
-      g39 = pow(alpha, NP1*g1);
-      g40 = pow(alpha, NP1*g4);
-      g41 = log(g21);
-      g42 = pow(alpha, NP1*g5);
-      g43 = pow(alpha, NP1*g6);
-      g44 = pow(alpha, NP1*g7);
-      g45 = pow(alpha, NP1*g8);
-      g46 = pow(alpha, NP1*g9);
-      g47 = pow(alpha, NP1*g10);
-      g48 = pow(alpha, NP1*g11);
-      g49 = pow(alpha, NP1*g12);
-      g50 = pow(alpha, NP1*g13);
-      g51 = pow(alpha, NP1*g14);
-      g52 = pow(alpha, NP1*g15);
-      g53 = pow(alpha, NP1*g16);
-      g54 = -g36;
-      g55 = g17/g3;
-      g56 = g3/g17;
-      g57 = -g38 + 1;
-      g58 = -g38 + 1;
-      g59 = -g39 + 1;
-      g60 = -g46 + 1;
-      g61 = -g47 + 1;
-      g62 = -g48 + 1;
-      g63 = -g49 + 1;
-      g64 = -g50 + 1;
-      g65 = -g51 + 1;
-      g66 = -g52 + 1;
-      g67 = -g53 + 1;
-      g68 = -g40 + 1;
-      g69 = -g42 + 1;
-      g70 = -g43 + 1;
-      g71 = -g44 + 1;
-      g72 = -g45 + 1;
-      g73 = -g39;
-      g74 = -g40;
-      g75 = -g42;
-      g76 = -g43;
-      g77 = -g44;
-      g78 = -g45;
-      g79 = -g46;
-      g80 = -g47;
-      g81 = -g48;
-      g82 = -g49;
-      g83 = -g50;
-      g84 = -g51;
-      g85 = -g52;
-      g86 = -g53;
-      g87 = -1.0*g36;
-      g88 = -g3/g18;
-      g89 = g18/(g3*xF[1]);
-      g90 = pow(alpha, g0*g37) - 1;
-      g91 = pow(alpha, g0*g37) - 1;
-      g92 = pow(alpha, g1*g37) - 1;
-      g93 = pow(alpha, g37*g9) - 1;
-      g94 = pow(alpha, g10*g37) - 1;
-      g95 = pow(alpha, g11*g37) - 1;
-      g96 = pow(alpha, g12*g37) - 1;
-      g97 = pow(alpha, g13*g37) - 1;
-      g98 = pow(alpha, g14*g37) - 1;
-      g99 = pow(alpha, g15*g37) - 1;
-      g100 = pow(alpha, g16*g37) - 1;
-      g101 = pow(alpha, g37*g4) - 1;
-      g102 = pow(alpha, g37*g5) - 1;
-      g103 = pow(alpha, g37*g6) - 1;
-      g104 = pow(alpha, g37*g7) - 1;
-      g105 = pow(alpha, g37*g8) - 1;
-      g106 = -pow(alpha, g1*g37);
-      g107 = -pow(alpha, g37*g4);
-      g108 = -pow(alpha, g37*g5);
-      g109 = -pow(alpha, g37*g6);
-      g110 = -pow(alpha, g37*g7);
-      g111 = -pow(alpha, g37*g8);
-      g112 = -pow(alpha, g37*g9);
-      g113 = -pow(alpha, g10*g37);
-      g114 = -pow(alpha, g11*g37);
-      g115 = -pow(alpha, g12*g37);
-      g116 = -pow(alpha, g13*g37);
-      g117 = -pow(alpha, g14*g37);
-      g118 = -pow(alpha, g15*g37);
-      g119 = -pow(alpha, g16*g37);
-      g120 = g58 + g91;
-      g121 = -g106 - g39;
-      g122 = -g107 - g40;
-      g123 = -g108 - g42;
-      g124 = -g109 - g43;
-      g125 = -g110 - g44;
-      g126 = -g111 - g45;
-      g127 = -g112 - g46;
-      g128 = -g113 - g47;
-      g129 = -g114 - g48;
-      g130 = -g115 - g49;
-      g131 = -g116 - g50;
-      g132 = -g117 - g51;
-      g133 = -g118 - g52;
-      g134 = -g119 - g53;
-      g135 = pow(alpha, g1*g37) + g73;
-      g136 = g58 + g91;
-      g137 = pow(alpha, g37*g4) + g74;
-      g138 = pow(alpha, g37*g5) + g75;
-      g139 = pow(alpha, g37*g6) + g76;
-      g140 = pow(alpha, g37*g7) + g77;
-      g141 = pow(alpha, g37*g8) + g78;
-      g142 = pow(alpha, g37*g9) + g79;
-      g143 = pow(alpha, g10*g37) + g80;
-      g144 = pow(alpha, g11*g37) + g81;
-      g145 = pow(alpha, g12*g37) + g82;
-      g146 = pow(alpha, g13*g37) + g83;
-      g147 = pow(alpha, g14*g37) + g84;
-      g148 = pow(alpha, g15*g37) + g85;
-      g149 = pow(alpha, g16*g37) + g86;
-      g150 = xF[11]/g138;
-      g151 = xF[9]/g149;
-      g152 = xF[8]/g148;
-      g153 = xF[1]/g136;
-      g154 = xF[10]/g137;
-      g155 = xF[3]/g143;
-      g156 = xF[7]/g147;
-      g157 = xF[4]/g144;
-      g158 = xF[12]/g139;
-      g159 = xF[13]/g140;
-      g160 = xF[6]/g146;
-      g161 = xF[14]/g141;
-      g162 = xF[5]/g145;
-      g163 = xF[2]/g142;
-      g164 = xF[0]/g135;
-      g165 = xF[1]/g120;
-      g166 = xF[0]/g121;
-      g167 = xF[4]/g129;
-      g168 = xF[7]/g132;
-      g169 = xF[2]/g127;
-      g170 = xF[11]/g123;
-      g171 = xF[13]/g125;
-      g172 = xF[3]/g128;
-      g173 = xF[6]/g131;
-      g174 = xF[14]/g126;
-      g175 = xF[8]/g133;
-      g176 = xF[12]/g124;
-      g177 = xF[10]/g122;
-      g178 = xF[9]/g134;
-      g179 = xF[5]/g130;
-      g180 = g64/g131;
-      g181 = g67/g134;
-      g182 = g62/g129;
-      g183 = g65/g132;
-      g184 = g59/g121;
-      g185 = g63/g130;
-      g186 = g70/g124;
-      g187 = g71/g125;
-      g188 = g61/g128;
-      g189 = g57/g120;
-      g190 = g69/g123;
-      g191 = g60/g127;
-      g192 = g72/g126;
-      g193 = g68/g122;
-      g194 = g66/g133;
-      g195 = g90/g120;
-      g196 = g92/g121;
-      g197 = g102/g123;
-      g198 = g93/g127;
-      g199 = g94/g128;
-      g200 = g95/g129;
-      g201 = g99/g133;
-      g202 = g100/g134;
-      g203 = g97/g131;
-      g204 = g105/g126;
-      g205 = g103/g124;
-      g206 = g104/g125;
-      g207 = g98/g132;
-      g208 = g101/g122;
-      g209 = g96/g130;
-      g210 = log(g136*g19*g89/g58);
-      g211 = log(g120*g19*g89/g57);
-      g212 = log(g136*g20*g55/g91);
-      g213 = 1.0*g210;
-      g214 = log(g120*g20*g55/g90);
-      g215 = 1.0*g212;
-      g216 = -g150*g213*(g75 + 1) - g150*g215*(pow(alpha, g37*g5) - 1) - g151*g213*(g86 + 1) - g151*g215*(pow(alpha, g16*g37) - 1) - g152*g213*(g85 + 1) - g152*g215*(pow(alpha, g15*g37) - 1) - g153*g213*g58 - g153*g215*g91 - g154*g213*(g74 + 1) - g154*g215*(pow(alpha, g37*g4) - 1) - g155*g213*(g80 + 1) - g155*g215*(pow(alpha, g10*g37) - 1) - g156*g213*(g84 + 1) - g156*g215*(pow(alpha, g14*g37) - 1) - g157*g213*(g81 + 1) - g157*g215*(pow(alpha, g11*g37) - 1) - g158*g213*(g76 + 1) - g158*g215*(pow(alpha, g37*g6) - 1) - g159*g213*(g77 + 1) - g159*g215*(pow(alpha, g37*g7) - 1) - g160*g213*(g83 + 1) - g160*g215*(pow(alpha, g13*g37) - 1) - g161*g213*(g78 + 1) - g161*g215*(pow(alpha, g37*g8) - 1) - g162*g213*(g82 + 1) - g162*g215*(pow(alpha, g12*g37) - 1) - g163*g213*(g79 + 1) - g163*g215*(pow(alpha, g37*g9) - 1) - g164*g213*(g73 + 1) - g164*g215*(pow(alpha, g1*g37) - 1) - g87*xF[0] - g87*xF[10] - g87*xF[11] - g87*xF[12] - g87*xF[13] - g87*xF[14] - g87*xF[1] - g87*xF[2] - g87*xF[3] - g87*xF[4] - g87*xF[5] - g87*xF[6] - g87*xF[7] - g87*xF[8] - g87*xF[9];
-      LpF = xF[0]*(g21 + 1.0)*(g184*g211 + g196*g214 + g54)/(g41*(g21 - 1.0)) + xF[10]*(g22 + 1.0)*(g193*g211 + g208*g214 + g54)/(g41*(g22 - 1.0)) + xF[11]*(g23 + 1.0)*(g190*g211 + g197*g214 + g54)/(g41*(g23 - 1.0)) + xF[12]*(g24 + 1.0)*(g186*g211 + g205*g214 + g54)/(g41*(g24 - 1.0)) + xF[13]*(g25 + 1.0)*(g187*g211 + g206*g214 + g54)/(g41*(g25 - 1.0)) + xF[14]*(g26 + 1.0)*(g192*g211 + g204*g214 + g54)/(g41*(g26 - 1.0)) + xF[1]*(g27 + 1.0)*(g189*g211 + g195*g214 + g54)/(g41*(g27 - 1.0)) + xF[2]*(g28 + 1.0)*(g191*g211 + g198*g214 + g54)/(g41*(g28 - 1.0)) + xF[3]*(g29 + 1.0)*(g188*g211 + g199*g214 + g54)/(g41*(g29 - 1.0)) + xF[4]*(g30 + 1.0)*(g182*g211 + g200*g214 + g54)/(g41*(g30 - 1.0)) + xF[5]*(g31 + 1.0)*(g185*g211 + g209*g214 + g54)/(g41*(g31 - 1.0)) + xF[6]*(g32 + 1.0)*(g180*g211 + g203*g214 + g54)/(g41*(g32 - 1.0)) + xF[7]*(g33 + 1.0)*(g183*g211 + g207*g214 + g54)/(g41*(g33 - 1.0)) + xF[8]*(g34 + 1.0)*(g194*g211 + g201*g214 + g54)/(g41*(g34 - 1.0)) + xF[9]*(g35 + 1.0)*(g181*g211 + g202*g214 + g54)/(g41*(g35 - 1.0));
-      PpF = g55;
-      TpF = -g18/g3;
-      SWUpF = g216;
-      SWUpP = g216*g56;
-      xP[0] = g166*g56*g92;
-      xP[1] = g165*g56*g90;
-      xP[2] = g169*g56*g93;
-      xP[3] = g172*g56*g94;
-      xP[4] = g167*g56*g95;
-      xP[5] = g179*g56*g96;
-      xP[6] = g173*g56*g97;
-      xP[7] = g168*g56*g98;
-      xP[8] = g175*g56*g99;
-      xP[9] = g100*g178*g56;
-      xP[10] = g101*g177*g56;
-      xP[11] = g102*g170*g56;
-      xP[12] = g103*g176*g56;
-      xP[13] = g104*g171*g56;
-      xP[14] = g105*g174*g56;
-      xT[0] = g166*g59*g88;
-      xT[1] = g165*g57*g88;
-      xT[2] = g169*g60*g88;
-      xT[3] = g172*g61*g88;
-      xT[4] = g167*g62*g88;
-      xT[5] = g179*g63*g88;
-      xT[6] = g173*g64*g88;
-      xT[7] = g168*g65*g88;
-      xT[8] = g175*g66*g88;
-      xT[9] = g178*g67*g88;
-      xT[10] = g177*g68*g88;
-      xT[11] = g170*g69*g88;
-      xT[12] = g176*g70*g88;
-      xT[13] = g171*g71*g88;
-      xT[14] = g174*g72*g88;
-      break;
-    case 16:
-      n0 = -2.00000000000000;
-      n1 = MW[0] - Mstar;
-      n2 = log(alpha);
-      n3 = xPj - xTj;
-      n4 = xF[0] - xPj;
-      n5 = MW[10] - Mstar;
-      n6 = MW[11] - Mstar;
-      n7 = MW[12] - Mstar;
-      n8 = MW[13] - Mstar;
-      n9 = MW[14] - Mstar;
-      n10 = MW[15] - Mstar;
-      n11 = MW[1] - Mstar;
-      n12 = MW[2] - Mstar;
-      n13 = MW[3] - Mstar;
-      n14 = MW[4] - Mstar;
-      n15 = MW[5] - Mstar;
-      n16 = MW[6] - Mstar;
-      n17 = MW[7] - Mstar;
-      n18 = MW[8] - Mstar;
-      n19 = MW[9] - Mstar;
-      n20 = log(xTj);
-      n21 = -n1;
-      n22 = -2;
-      n23 = xF[0]*xPj;
-      n24 = -Mstar;
-      n25 = -xTj;
-      n26 = -xPj;
-      n27 = -NP0*n0;
-      n28 = pow(n1, -n0);
-      n29 = pow(n2, -n0);
-      n30 = pow(n5, -n0);
-      n31 = pow(n6, -n0);
-      n32 = pow(n7, -n0);
-      n33 = pow(n8, -n0);
-      n34 = pow(n9, -n0);
-      n35 = pow(n10, -n0);
-      n36 = pow(n11, -n0);
-      n37 = pow(n12, -n0);
-      n38 = pow(n13, -n0);
-      n39 = pow(n14, -n0);
-      n40 = pow(n15, -n0);
-      n41 = pow(n16, -n0);
-      n42 = pow(n17, -n0);
-      n43 = pow(n18, -n0);
-      n44 = pow(n19, -n0);
-      n45 = Mstar*n2;
-      n46 = -n0*n2;
-      n47 = NP0*n1;
-      n48 = -n2;
-      n49 = pow(alpha, n47);
-      n50 = n23 + n25*xF[0];
-      n51 = n23 + n25*xPj;
-      n52 = pow(alpha, NP0*n5);
-      n53 = pow(alpha, NP0*n6);
-      n54 = pow(alpha, NP0*n7);
-      n55 = pow(alpha, NP0*n8);
-      n56 = pow(alpha, NP0*n9);
-      n57 = pow(alpha, NP0*n10);
-      n58 = pow(alpha, NP0*n11);
-      n59 = pow(alpha, NP0*n12);
-      n60 = pow(alpha, NP0*n13);
-      n61 = pow(alpha, NP0*n14);
-      n62 = pow(alpha, NP0*n15);
-      n63 = pow(alpha, NP0*n16);
-      n64 = pow(alpha, NP0*n17);
-      n65 = pow(alpha, NP0*n18);
-      n66 = pow(alpha, NP0*n19);
-      n67 = MW[0]*n48;
-      n68 = n3/n4;
-      n69 = n15*n2;
-      n70 = n2*n7;
-      n71 = n11*n2;
-      n72 = n19*n2;
-      n73 = n12*n2;
-      n74 = n10*n2;
-      n75 = n17*n2;
-      n76 = -n49 + 1;
-      n77 = -n52 + 1;
-      n78 = pow(alpha, NP0*n0*n21);
-      n79 = pow(n51, -n0);
-      n80 = -n53 + 1;
-      n81 = -n54 + 1;
-      n82 = -n55 + 1;
-      n83 = -n56 + 1;
-      n84 = -n57 + 1;
-      n85 = -n58 + 1;
-      n86 = -n59 + 1;
-      n87 = -n60 + 1;
-      n88 = -n61 + 1;
-      n89 = -n62 + 1;
-      n90 = -n63 + 1;
-      n91 = -n64 + 1;
-      n92 = -n65 + 1;
-      n93 = -n66 + 1;
-      n94 = -n87;
-      n95 = -n90;
-      n96 = -n77;
-      n97 = -n80;
-      n98 = -n49;
-      n99 = -n54;
-      n100 = -n55;
-      n101 = -n56;
-      n102 = -n59;
-      n103 = -n61;
-      n104 = -n62;
-      n105 = -n63;
-      n106 = n1*n29;
-      n107 = 1/(n1*n2);
-      n108 = n16*n63;
-      n109 = n13*n60;
-      n110 = n1*n49;
-      n111 = n29*n40;
-      n112 = n14*n61;
-      n113 = n56*n9;
-      n114 = n5*n52;
-      n115 = n29*n42;
-      n116 = n55*n8;
-      n117 = n83*xF[14];
-      n118 = n86*xF[2];
-      n119 = n29*n35;
-      n120 = n29*n37;
-      n121 = n28*n29;
-      n122 = n89*xF[5];
-      n123 = n29*n36;
-      n124 = n11*n58;
-      n125 = n17*n64;
-      n126 = n29*n34;
-      n127 = n10*n57;
-      n128 = n18*n65;
-      n129 = log((-1.0 + xPj/xF[0])/n3);
-      n130 = -n84*xF[15];
-      n131 = -n81*xF[12];
-      n132 = -n93*xF[9];
-      n133 = n19*n66*xF[9];
-      n134 = -n82*xF[13];
-      n135 = n2*n53*n6;
-      n136 = n128*n2;
-      n137 = n51/n50;
-      n138 = n29*n33*n55;
-      n139 = n29*n31*n53;
-      n140 = n29*n43*n65;
-      n141 = n29*n32*n54;
-      n142 = n29*n30*n52;
-      n143 = n29*n38*n60;
-      n144 = n121*n49*xF[0];
-      n145 = n137*n98 + 1;
-      n146 = n129 + n20 + n45 + n67;
-      n147 = n137*n49/n145;
-      n148 = n107*(n146 - log(n145)) + 1;
-      n149 = pow(alpha, n1*n148);
-      n150 = pow(alpha, n148*n5);
-      n151 = pow(alpha, n148*n6);
-      n152 = pow(alpha, n148*n7);
-      n153 = pow(alpha, n148*n8);
-      n154 = pow(alpha, n148*n9);
-      n155 = pow(alpha, n10*n148);
-      n156 = pow(alpha, n11*n148);
-      n157 = pow(alpha, n12*n148);
-      n158 = pow(alpha, n13*n148);
-      n159 = pow(alpha, n14*n148);
-      n160 = pow(alpha, n148*n15);
-      n161 = pow(alpha, n148*n16);
-      n162 = pow(alpha, n148*n17);
-      n163 = pow(alpha, n148*n18);
-      n164 = pow(alpha, n148*n19);
-      n165 = n14/n159;
-      n166 = n17/n162;
-      n167 = n8/n153;
-      n168 = n13/n158;
-      n169 = n16/n161;
-      n170 = n9/n154;
-      n171 = n18/n163;
-      n172 = n6/n151;
-      n173 = n11/n156;
-      n174 = n12/n157;
-      n175 = -1/n149;
-      n176 = n10/n155;
-      n177 = n7/n152;
-      n178 = n19/n164;
-      n179 = n5/n150;
-      n180 = n15/n160;
-      n181 = pow(alpha, n148*n21) + n76 - 1;
-      n182 = n77 - 1 + 1.0/n150;
-      n183 = n80 - 1 + 1.0/n151;
-      n184 = n81 - 1 + 1.0/n152;
-      n185 = n82 - 1 + 1.0/n153;
-      n186 = n83 - 1 + 1.0/n154;
-      n187 = n84 - 1 + 1.0/n155;
-      n188 = n85 - 1 + 1.0/n156;
-      n189 = n86 - 1 + 1.0/n157;
-      n190 = n87 - 1 + 1.0/n158;
-      n191 = n88 - 1 + 1.0/n159;
-      n192 = n89 - 1 + 1.0/n160;
-      n193 = n90 - 1 + 1.0/n161;
-      n194 = n91 - 1 + 1.0/n162;
-      n195 = n92 - 1 + 1.0/n163;
-      n196 = n93 - 1 + 1.0/n164;
-      n197 = pow(n181, 3);
-      n198 = pow(n182, 3);
-      n199 = pow(n183, 3);
-      n200 = pow(n184, 3);
-      n201 = pow(n185, 3);
-      n202 = pow(n186, 3);
-      n203 = pow(n187, 3);
-      n204 = pow(n188, 3);
-      n205 = pow(n189, 3);
-      n206 = pow(n190, 3);
-      n207 = pow(n191, 3);
-      n208 = pow(n192, 3);
-      n209 = pow(n193, 3);
-      n210 = pow(n194, 3);
-      n211 = pow(n195, 3);
-      n212 = pow(n196, 3);
-      n213 = xF[11]/n183;
-      n214 = xF[12]/n184;
-      n215 = 0.5/n181;
-      n216 = xF[10]/n182;
-      n217 = xF[13]/n185;
-      n218 = xF[9]/n196;
-      n219 = xF[8]/n195;
-      n220 = xF[0]/n181;
-      n221 = xF[3]/n190;
-      n222 = pow(n190, n22)*xF[3];
-      n223 = xF[6]/n209;
-      n224 = pow(n182, n22)*xF[10];
-      n225 = xF[10]/n198;
-      n226 = n2*xF[14]/n186;
-      n227 = n2*xF[4]/n191;
-      n228 = n2*n221;
-      n229 = pow(n181, n22)*n2;
-      n230 = n2*xF[6]/n193;
-      n231 = n62*xF[5]/n192;
-      n232 = n58*xF[1]/n188;
-      n233 = n64*xF[7]/n194;
-      n234 = n59*xF[2]/n189;
-      n235 = n57*xF[15]/n187;
-      n236 = n56*xF[14]/n186;
-      n237 = n85/n204;
-      n238 = -pow(n181, n22)*n76;
-      n239 = n76*xF[0]/n197;
-      n240 = pow(n191, n22)*n88*xF[4];
-      n241 = n88*xF[4]/n207;
-      n242 = -n122*pow(n192, n22);
-      n243 = -n91*xF[7]/n210;
-      n244 = -pow(n188, n22)*n85*xF[1];
-      n245 = -pow(n194, n22)*n91*xF[7];
-      n246 = -pow(n195, n22)*n92*xF[8];
-      n247 = n218*n29*n44*n66;
-      n248 = n29*n39*n61*xF[4]/n191;
-      n249 = n29*n41*n63*xF[6]/n193;
-      n250 = n2*n21*n220*n49*n68;
-      n251 = n144*n68/n181;
-      n252 = n142*n216*n68;
-      n253 = n139*n213*n68;
-      n254 = n141*n214*n68;
-      n255 = n138*n217*n68;
-      n256 = n126*n236*n68;
-      n257 = n119*n235*n68;
-      n258 = n123*n232*n68;
-      n259 = n120*n234*n68;
-      n260 = n143*n221*n68;
-      n261 = n248*n68;
-      n262 = n111*n231*n68;
-      n263 = n249*n68;
-      n264 = n115*n233*n68;
-      n265 = n140*n219*n68;
-      n266 = n247*n68;
-      n267 = n144*n215*n68;
-      n268 = n137/(n145*n149);
-      n269 = n268 + 1;
-      n270 = n269*xF[0];
-      n271 = n110*n2*n268 + n110*n2;
-      n272 = n114*n2 + n147*n179*n2;
-      n273 = n135 + n147*n172*n2;
-      n274 = n147*n70/n152 + n54*n70;
-      n275 = n116*n2 + n147*n167*n2;
-      n276 = n113*n2 + n147*n170*n2;
-      n277 = n147*n74/n155 + n57*n74;
-      n278 = n147*n71/n156 + n58*n71;
-      n279 = n147*n73/n157 + n59*n73;
-      n280 = n109*n2 + n147*n168*n2;
-      n281 = n112*n2 + n147*n165*n2;
-      n282 = n147*n69/n160 + n62*n69;
-      n283 = n108*n2 + n147*n169*n2;
-      n284 = n147*n75/n162 + n64*n75;
-      n285 = n136 + n147*n171*n2;
-      n286 = n147*n72/n164 + n66*n72;
-      n287 = pow(n271, -n0);
-      n288 = pow(n272, -n0);
-      n289 = pow(n273, -n0);
-      n290 = pow(n274, -n0);
-      n291 = pow(n275, -n0);
-      n292 = pow(n276, -n0);
-      n293 = pow(n277, -n0);
-      n294 = pow(n278, -n0);
-      n295 = pow(n279, -n0);
-      n296 = pow(n280, -n0);
-      n297 = pow(n281, -n0);
-      n298 = pow(n282, -n0);
-      n299 = pow(n283, -n0);
-      n300 = pow(n284, -n0);
-      n301 = pow(n285, -n0);
-      n302 = pow(n286, -n0);
-      n303 = n271*xF[0];
-      n304 = n273*xF[11];
-      n305 = n278*xF[1];
-      n306 = n285*xF[8];
-      n307 = n0*n147*n2*n21/n149 + n0*n2*n21*n49;
-      n308 = n294*xF[1];
-      n309 = n121*n268*n98 + n121*n98;
-      n310 = pow(n184, n22)*n274;
-      n311 = pow(n196, n22)*n286;
-      n312 = pow(n185, n22)*n275;
-      n313 = pow(n186, n22)*n276;
-      n314 = pow(n187, n22)*n277;
-      n315 = pow(n193, n22)*n283*xF[6];
-      n316 = n292/n202;
-      n317 = n295/n205;
-      n318 = n298/n208;
-      n319 = pow(n181, n22)*n309*xF[0];
-      n320 = n301*n92*xF[8]/n211;
-      n321 = n289*n80*xF[11]/n199;
-      n322 = pow(n181, n22)*n303*n68*n76;
-      n323 = n0*n21*n229*n49*n68*xF[0]*(pow(alpha, n148*n21 + n47)*n1*n137*n2/n145 + n110*n2);
-      n324 = n114*n224*n46*n68*(pow(alpha, -n148*n5 + n47)*n137*n2*n5/n145 + n114*n2);
-      n325 = pow(n183, n22)*n46*n53*n6*n68*xF[11]*(pow(alpha, -n148*n6 + n47)*n137*n2*n6/n145 + n135);
-      n326 = pow(n184, n22)*n46*n54*n68*n7*xF[12]*(pow(alpha, -n148*n7 + n47)*n137*n70/n145 + n54*n70);
-      n327 = n116*pow(n185, n22)*n46*n68*xF[13]*(pow(alpha, -n148*n8 + n47)*n137*n2*n8/n145 + n116*n2);
-      n328 = n113*pow(n186, n22)*n46*n68*xF[14]*(pow(alpha, -n148*n9 + n47)*n137*n2*n9/n145 + n113*n2);
-      n329 = n127*pow(n187, n22)*n46*n68*xF[15]*(pow(alpha, -n10*n148 + n47)*n137*n74/n145 + n57*n74);
-      n330 = n124*pow(n188, n22)*n46*n68*xF[1]*(pow(alpha, -n11*n148 + n47)*n137*n71/n145 + n58*n71);
-      n331 = n12*pow(n189, n22)*n46*n59*n68*xF[2]*(pow(alpha, -n12*n148 + n47)*n137*n73/n145 + n59*n73);
-      n332 = n109*n222*n46*n68*(pow(alpha, -n13*n148 + n47)*n13*n137*n2/n145 + n109*n2);
-      n333 = n112*pow(n191, n22)*n46*n68*xF[4]*(pow(alpha, -n14*n148 + n47)*n137*n14*n2/n145 + n112*n2);
-      n334 = n15*pow(n192, n22)*n46*n62*n68*xF[5]*(pow(alpha, -n148*n15 + n47)*n137*n69/n145 + n62*n69);
-      n335 = n108*pow(n193, n22)*n46*n68*xF[6]*(pow(alpha, -n148*n16 + n47)*n137*n16*n2/n145 + n108*n2);
-      n336 = n125*pow(n194, n22)*n46*n68*xF[7]*(pow(alpha, -n148*n17 + n47)*n137*n75/n145 + n64*n75);
-      n337 = n128*pow(n195, n22)*n46*n68*xF[8]*(pow(alpha, -n148*n18 + n47)*n137*n18*n2/n145 + n136);
-      n338 = n133*pow(n196, n22)*n46*n68*(pow(alpha, -n148*n19 + n47)*n137*n72/n145 + n66*n72);
-      n339 = 1.0*n110*n229*n303*n68;
-      n340 = n319*n68*n76;
-      n341 = 0.5*n340;
-      n342 = pow(alpha, n1*n27)*n106*pow(n145, n22)*n172*pow(n50, n22)*n79 - pow(alpha, n1*n27)*pow(n145, n22)*n29*n31*pow(n50, n22)*n79/n151 + n106*n147*n172 + n139;
-      n343 = pow(alpha, n1*n27)*n106*pow(n145, n22)*n177*pow(n50, n22)*n79 - pow(alpha, n1*n27)*pow(n145, n22)*n29*n32*pow(n50, n22)*n79/n152 + n106*n147*n177 + n141;
-      n344 = pow(alpha, n1*n27)*pow(n145, n22)*n167*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27)*pow(n145, n22)*n29*n33*pow(n50, n22)*n79/n153 + n100*n29*n33 + n147*n167*n21*n29;
-      n345 = pow(alpha, n1*n27)*n126*pow(n145, n22)*pow(n50, n22)*n79/n154 + pow(alpha, n1*n27)*pow(n145, n22)*n170*n21*n29*pow(n50, n22)*n79 + n101*n126 + n147*n170*n21*n29;
-      n346 = pow(alpha, n1*n27)*n106*pow(n145, n22)*n176*pow(n50, n22)*n79 - pow(alpha, n1*n27)*n119*pow(n145, n22)*pow(n50, n22)*n79/n155 + n106*n147*n176 + n119*n57;
-      n347 = pow(alpha, n1*n27)*n120*pow(n145, n22)*pow(n50, n22)*n79/n157 + pow(alpha, n1*n27)*pow(n145, n22)*n174*n21*n29*pow(n50, n22)*n79 + n102*n120 + n147*n174*n21*n29;
-      n348 = pow(alpha, n1*n27)*pow(n145, n22)*n169*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27)*pow(n145, n22)*n29*n41*pow(n50, n22)*n79/n161 + n105*n29*n41 + n147*n169*n21*n29;
-      n349 = pow(alpha, n1*n27)*n106*pow(n145, n22)*n178*pow(n50, n22)*n79 - pow(alpha, n1*n27)*pow(n145, n22)*n29*n44*pow(n50, n22)*n79/n164 + n106*n147*n178 + n29*n44*n66;
-      n350 = pow(n185, n22)*n68*n82*xF[13]*(pow(alpha, n1*n27 - n148*n8)*pow(n145, n22)*n21*n29*pow(n50, n22)*n79*n8 + pow(alpha, n1*n27 - n148*n8)*pow(n145, n22)*n29*n33*pow(n50, n22)*n79 + n100*n29*n33 + n147*n167*n21*n29);
-      n351 = n117*pow(n186, n22)*n68*(pow(alpha, n1*n27 - n148*n9)*n126*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n148*n9)*pow(n145, n22)*n21*n29*pow(n50, n22)*n79*n9 + n101*n126 + n147*n170*n21*n29);
-      n352 = n118*pow(n189, n22)*n68*(pow(alpha, n1*n27 - n12*n148)*n12*pow(n145, n22)*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n12*n148)*n120*pow(n145, n22)*pow(n50, n22)*n79 + n102*n120 + n147*n174*n21*n29);
-      n353 = n240*n68*(pow(alpha, n1*n27 - n14*n148)*n14*pow(n145, n22)*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n14*n148)*pow(n145, n22)*n29*n39*pow(n50, n22)*n79 + n103*n29*n39 + n147*n165*n21*n29);
-      n354 = pow(n193, n22)*n68*n90*xF[6]*(pow(alpha, n1*n27 - n148*n16)*pow(n145, n22)*n16*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n148*n16)*pow(n145, n22)*n29*n41*pow(n50, n22)*n79 + n105*n29*n41 + n147*n169*n21*n29);
-      n355 = n224*n68*n96*(pow(alpha, n1*n27 - n148*n5)*n106*pow(n145, n22)*n5*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n5)*pow(n145, n22)*n29*n30*pow(n50, n22)*n79 + n106*n147*n179 + n142);
-      n356 = pow(n183, n22)*n68*n97*xF[11]*(pow(alpha, n1*n27 - n148*n6)*n106*pow(n145, n22)*pow(n50, n22)*n6*n79 - pow(alpha, n1*n27 - n148*n6)*pow(n145, n22)*n29*n31*pow(n50, n22)*n79 + n106*n147*n172 + n139);
-      n357 = n131*pow(n184, n22)*n68*(pow(alpha, n1*n27 - n148*n7)*n106*pow(n145, n22)*pow(n50, n22)*n7*n79 - pow(alpha, n1*n27 - n148*n7)*pow(n145, n22)*n29*n32*pow(n50, n22)*n79 + n106*n147*n177 + n141);
-      n358 = n130*pow(n187, n22)*n68*(pow(alpha, n1*n27 - n10*n148)*n10*n106*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n10*n148)*n119*pow(n145, n22)*pow(n50, n22)*n79 + n106*n147*n176 + n119*n57);
-      n359 = n244*n68*(pow(alpha, n1*n27 - n11*n148)*n106*n11*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n11*n148)*n123*pow(n145, n22)*pow(n50, n22)*n79 + n106*n147*n173 + n123*n58);
-      n360 = n222*n68*n94*(pow(alpha, n1*n27 - n13*n148)*n106*n13*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n13*n148)*pow(n145, n22)*n29*n38*pow(n50, n22)*n79 + n106*n147*n168 + n143);
-      n361 = n242*n68*(pow(alpha, n1*n27 - n148*n15)*n106*pow(n145, n22)*n15*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n15)*n111*pow(n145, n22)*pow(n50, n22)*n79 + n106*n147*n180 + n111*n62);
-      n362 = n245*n68*(pow(alpha, n1*n27 - n148*n17)*n106*pow(n145, n22)*n17*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n17)*n115*pow(n145, n22)*pow(n50, n22)*n79 + n106*n147*n166 + n115*n64);
-      n363 = n246*n68*(pow(alpha, n1*n27 - n148*n18)*n106*pow(n145, n22)*n18*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n18)*pow(n145, n22)*n29*n43*pow(n50, n22)*n79 + n106*n147*n171 + n140);
-      n364 = n132*pow(n196, n22)*n68*(pow(alpha, n1*n27 - n148*n19)*n106*pow(n145, n22)*n19*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n19)*pow(n145, n22)*n29*n44*pow(n50, n22)*n79 + n106*n147*n178 + n29*n44*n66);
-      n365 = xTj*(n108*n230*n68 + n109*n228*n68 + n110*n2*n220*n68 + n112*n227*n68 + n113*n226*n68 + n114*n2*n216*n68 + n116*n2*n217*n68 - n117*n313*n68 - n118*pow(n189, n22)*n279*n68 + n130*n314*n68 + n131*n310*n68 + n132*n311*n68 + n134*n312*n68 + n135*n213*n68 + n136*n219*n68 + pow(n183, n22)*n304*n68*n97 + n214*n54*n68*n70 + n218*n66*n68*n72 + n222*n280*n68*n94 + n224*n272*n68*n96 + n231*n68*n69 + n232*n68*n71 + n233*n68*n75 + n234*n68*n73 + n235*n68*n74 + n238*n303*n68 - n240*n281*n68 + n242*n282*n68 + n244*n278*n68 + n245*n284*n68 + n246*n285*n68 + n315*n68*n95);
-      n366 = n250 + n322 + n365;
-      n367 = n251 + n252 + n253 + n254 + n255 + n256 + n257 + n258 + n259 + n260 + n261 + n262 + n263 + n264 + n265 + n266 + n323 + n324 + n325 + n326 + n327 + n328 + n329 + n330 + n331 + n332 + n333 + n334 + n335 + n336 + n337 + n338 + n340 + n350 + n351 + n352 + n353 + n354 + n355 + n356 + n357 + n358 + n359 + n360 + n361 + n362 + n363 + n364;
-      n368 = -n117*n276*n68*(n113*n46 + n147*n170*n46)/n202 - n118*n279*n68*(n12*n46*n59 + n147*n174*n46)/n205 - n122*n282*n68*(n147*n180*n46 + n15*n46*n62)/n208 + n130*n277*n68*(n127*n46 + n147*n176*n46)/n203 + n131*n274*n68*(n147*n177*n46 + n46*n54*n7)/n200 + n132*n286*n68*(n147*n178*n46 + n19*n46*n66)/n212 + n134*n275*n68*(n116*n46 + n147*n167*n46)/n201 + n223*n283*n68*n95*(n108*n46 + n147*n169*n46) + n225*n272*n68*n96*(n114*n46 + n147*n179*n46) - n237*n305*n68*(n124*n46 + n147*n173*n46) - n239*n271*n307*n68 - n241*n281*n68*(n112*n46 + n147*n165*n46) + n243*n284*n68*(n125*n46 + n147*n166*n46) + n367 - n306*n68*n92*(n128*n46 + n147*n171*n46)/n211 + n280*n68*n94*xF[3]*(n109*n46 + n147*n168*n46)/n206 + n304*n68*n97*(n147*n172*n46 + n46*n53*n6)/n199;
-      n369 = n368*xTj;
-      NP_b = -n110*n229*n270*n68*n76 - n250 - n27*(1.0*n110*n229*n68*xF[0]*(pow(alpha, -n1*n148 + n47)*n1*n137*n2/n145 + n110*n2) + 0.5*pow(n181, n22)*n68*n76*xF[0]*(-pow(alpha, -n1*n148 + n47)*n121*n137/n145 + n121*n98) - 1.0*n239*n287*n68 + n267 - 0.5*xTj*(n117*pow(n186, n22)*n68*(pow(alpha, n1*n27 - n148*n9)*n126*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n148*n9)*pow(n145, n22)*n21*n29*pow(n50, n22)*n79*n9 + pow(alpha, -n148*n9 + n47)*n137*n21*n29*n9/n145 + n101*n126) + n117*n22*n316*n68 + n118*pow(n189, n22)*n68*(pow(alpha, n1*n27 - n12*n148)*n12*pow(n145, n22)*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n12*n148)*n120*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n12*n148 + n47)*n12*n137*n21*n29/n145 + n102*n120) + n118*n22*n317*n68 + n122*n22*n318*n68 + n130*pow(n187, n22)*n68*(pow(alpha, n1*n27 - n10*n148)*n10*n106*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n10*n148)*n119*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n10*n148 + n47)*n10*n106*n137/n145 + n119*n57) + n131*pow(n184, n22)*n68*(pow(alpha, n1*n27 - n148*n7)*n106*pow(n145, n22)*pow(n50, n22)*n7*n79 - pow(alpha, n1*n27 - n148*n7)*pow(n145, n22)*n29*n32*pow(n50, n22)*n79 + pow(alpha, -n148*n7 + n47)*n106*n137*n7/n145 + n141) + n132*pow(n196, n22)*n68*(pow(alpha, n1*n27 - n148*n19)*n106*pow(n145, n22)*n19*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n19)*pow(n145, n22)*n29*n44*pow(n50, n22)*n79 + pow(alpha, -n148*n19 + n47)*n106*n137*n19/n145 + n29*n44*n66) + pow(n181, n22)*n68*n76*xF[0]*(-pow(alpha, -n1*n148 + n47)*n121*n137/n145 + n121*n98) + pow(n183, n22)*n68*n97*xF[11]*(pow(alpha, n1*n27 - n148*n6)*n106*pow(n145, n22)*pow(n50, n22)*n6*n79 - pow(alpha, n1*n27 - n148*n6)*pow(n145, n22)*n29*n31*pow(n50, n22)*n79 + pow(alpha, -n148*n6 + n47)*n106*n137*n6/n145 + n139) + pow(n185, n22)*n68*n82*xF[13]*(pow(alpha, n1*n27 - n148*n8)*pow(n145, n22)*n21*n29*pow(n50, n22)*n79*n8 + pow(alpha, n1*n27 - n148*n8)*pow(n145, n22)*n29*n33*pow(n50, n22)*n79 + pow(alpha, -n148*n8 + n47)*n137*n21*n29*n8/n145 + n100*n29*n33) + pow(n193, n22)*n68*n90*xF[6]*(pow(alpha, n1*n27 - n148*n16)*pow(n145, n22)*n16*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n148*n16)*pow(n145, n22)*n29*n41*pow(n50, n22)*n79 + pow(alpha, -n148*n16 + n47)*n137*n16*n21*n29/n145 + n105*n29*n41) + n22*n223*n299*n68*n90 + n22*n225*n288*n68*n77 + n22*n237*n308*n68 + n22*n239*n287*n68 + n22*n241*n297*n68 + n22*n320*n68 + n22*n321*n68 + n222*n68*n94*(pow(alpha, n1*n27 - n13*n148)*n106*n13*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n13*n148)*pow(n145, n22)*n29*n38*pow(n50, n22)*n79 + pow(alpha, -n13*n148 + n47)*n106*n13*n137/n145 + n143) + n224*n68*n96*(pow(alpha, n1*n27 - n148*n5)*n106*pow(n145, n22)*n5*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n5)*pow(n145, n22)*n29*n30*pow(n50, n22)*n79 + pow(alpha, -n148*n5 + n47)*n106*n137*n5/n145 + n142) + n240*n68*(pow(alpha, n1*n27 - n14*n148)*n14*pow(n145, n22)*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n14*n148)*pow(n145, n22)*n29*n39*pow(n50, n22)*n79 + pow(alpha, -n14*n148 + n47)*n137*n14*n21*n29/n145 + n103*n29*n39) + n242*n68*(pow(alpha, n1*n27 - n148*n15)*n106*pow(n145, n22)*n15*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n15)*n111*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n148*n15 + n47)*n106*n137*n15/n145 + n111*n62) + n244*n68*(pow(alpha, n1*n27 - n11*n148)*n106*n11*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n11*n148)*n123*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n11*n148 + n47)*n106*n11*n137/n145 + n123*n58) + n245*n68*(pow(alpha, n1*n27 - n148*n17)*n106*pow(n145, n22)*n17*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n17)*n115*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n148*n17 + n47)*n106*n137*n17/n145 + n115*n64) + n246*n68*(pow(alpha, n1*n27 - n148*n18)*n106*pow(n145, n22)*n18*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n18)*pow(n145, n22)*n29*n43*pow(n50, n22)*n79 + pow(alpha, -n148*n18 + n47)*n106*n137*n18/n145 + n140) + n251 + n252 + n253 + n254 + n255 + n256 + n257 + n258 + n259 + n260 + n261 + n262 + n263 + n264 + n265 + n266 + n323 + n324 + n325 + n326 + n327 + n328 + n329 + n330 + n331 + n332 + n333 + n334 + n335 + n336 + n337 + n338 + n22*n302*n68*n93*xF[9]/n212 + n22*n300*n68*n91*xF[7]/n210 + n22*n296*n68*n87*xF[3]/n206 + n22*n293*n68*n84*xF[15]/n203 + n22*n291*n68*n82*xF[13]/n201 + n22*n290*n68*n81*xF[12]/n200)) - n68*xTj*(n108*n230 + n109*n228 + n110*n2*n220 + n112*n227 + n113*n226 + n114*n2*n216 + n116*n2*n217 - n117*n313 - n118*pow(n189, n22)*n279 + n130*n314 + n131*n310 + n132*n311 + n134*n312 + n135*n213 + n136*n219 + pow(n183, n22)*n304*n97 + n214*n54*n70 + n218*n66*n72 + n222*n280*n94 + n224*n272*n96 + n231*n69 + n232*n71 + n233*n75 + n234*n73 + n235*n74 + n238*n303 - n240*n281 + n242*n282 + n244*n278 + n245*n284 + n246*n285 + n315*n95);
-      NP_2a = -n68*(pow(alpha, n1*n27)*n0*n121*pow(n181, n22)*n270 - pow(alpha, n1*n27)*n0*n121*n239*pow(n269, -n0) + n121*pow(n181, n22)*n76*n98*xF[0]*(-1 + (-n23 + xPj*xTj)/(n145*n149*n50)) - 1.0*n144/n181 + 1.0*xTj*(n0*n21*n229*n49*xF[0]*(pow(alpha, n148*n21 + n47)*n1*n137*n2/n145 + n110*n2) + n108*pow(n193, n22)*n46*xF[6]*(pow(alpha, -n148*n16 + n47)*n137*n16*n2/n145 + n108*n2) + n109*n222*n46*(pow(alpha, -n13*n148 + n47)*n13*n137*n2/n145 + n109*n2) + n111*n231 + n112*pow(n191, n22)*n46*xF[4]*(pow(alpha, -n14*n148 + n47)*n137*n14*n2/n145 + n112*n2) + n113*pow(n186, n22)*n46*xF[14]*(pow(alpha, -n148*n9 + n47)*n137*n2*n9/n145 + n113*n2) + n114*n224*n46*(pow(alpha, -n148*n5 + n47)*n137*n2*n5/n145 + n114*n2) + n115*n233 + n116*pow(n185, n22)*n46*xF[13]*(pow(alpha, -n148*n8 + n47)*n137*n2*n8/n145 + n116*n2) + n117*pow(n186, n22)*(pow(alpha, n1*n27 - n148*n9)*n126*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n148*n9)*pow(n145, n22)*n21*n29*pow(n50, n22)*n79*n9 + n101*n126 + n147*n170*n21*n29) + n117*n22*n316 + n118*pow(n189, n22)*(pow(alpha, n1*n27 - n12*n148)*n12*pow(n145, n22)*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n12*n148)*n120*pow(n145, n22)*pow(n50, n22)*n79 + n102*n120 + n147*n174*n21*n29) + n118*n22*n317 + n119*n235 + n12*pow(n189, n22)*n46*n59*xF[2]*(pow(alpha, -n12*n148 + n47)*n137*n73/n145 + n59*n73) + n120*n234 + n122*n22*n318 + n123*n232 + n124*pow(n188, n22)*n46*xF[1]*(pow(alpha, -n11*n148 + n47)*n137*n71/n145 + n58*n71) + n125*pow(n194, n22)*n46*xF[7]*(pow(alpha, -n148*n17 + n47)*n137*n75/n145 + n64*n75) + n126*n236 + n127*pow(n187, n22)*n46*xF[15]*(pow(alpha, -n10*n148 + n47)*n137*n74/n145 + n57*n74) + n128*pow(n195, n22)*n46*xF[8]*(pow(alpha, -n148*n18 + n47)*n137*n18*n2/n145 + n136) + n130*pow(n187, n22)*(pow(alpha, n1*n27 - n10*n148)*n10*n106*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n10*n148)*n119*pow(n145, n22)*pow(n50, n22)*n79 + n106*n147*n176 + n119*n57) + n131*pow(n184, n22)*(pow(alpha, n1*n27 - n148*n7)*n106*pow(n145, n22)*pow(n50, n22)*n7*n79 - pow(alpha, n1*n27 - n148*n7)*pow(n145, n22)*n29*n32*pow(n50, n22)*n79 + n106*n147*n177 + n141) + n132*pow(n196, n22)*(pow(alpha, n1*n27 - n148*n19)*n106*pow(n145, n22)*n19*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n19)*pow(n145, n22)*n29*n44*pow(n50, n22)*n79 + n106*n147*n178 + n29*n44*n66) + n133*pow(n196, n22)*n46*(pow(alpha, -n148*n19 + n47)*n137*n72/n145 + n66*n72) + n138*n217 + n139*n213 + n140*n219 + n141*n214 + n142*n216 + n143*n221 + n144/n181 + n15*pow(n192, n22)*n46*n62*xF[5]*(pow(alpha, -n148*n15 + n47)*n137*n69/n145 + n62*n69) + pow(n183, n22)*n46*n53*n6*xF[11]*(pow(alpha, -n148*n6 + n47)*n137*n2*n6/n145 + n135) + pow(n183, n22)*n97*xF[11]*(pow(alpha, n1*n27 - n148*n6)*n106*pow(n145, n22)*pow(n50, n22)*n6*n79 - pow(alpha, n1*n27 - n148*n6)*pow(n145, n22)*n29*n31*pow(n50, n22)*n79 + n106*n147*n172 + n139) + pow(n184, n22)*n46*n54*n7*xF[12]*(pow(alpha, -n148*n7 + n47)*n137*n70/n145 + n54*n70) + pow(n185, n22)*n82*xF[13]*(pow(alpha, n1*n27 - n148*n8)*pow(n145, n22)*n21*n29*pow(n50, n22)*n79*n8 + pow(alpha, n1*n27 - n148*n8)*pow(n145, n22)*n29*n33*pow(n50, n22)*n79 + n100*n29*n33 + n147*n167*n21*n29) + pow(n193, n22)*n90*xF[6]*(pow(alpha, n1*n27 - n148*n16)*pow(n145, n22)*n16*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n148*n16)*pow(n145, n22)*n29*n41*pow(n50, n22)*n79 + n105*n29*n41 + n147*n169*n21*n29) + n22*n223*n299*n90 + n22*n225*n288*n77 + n22*n237*n308 + n22*n239*n287 + n22*n241*n297 + n22*n320 + n22*n321 + n222*n94*(pow(alpha, n1*n27 - n13*n148)*n106*n13*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n13*n148)*pow(n145, n22)*n29*n38*pow(n50, n22)*n79 + n106*n147*n168 + n143) + n224*n96*(pow(alpha, n1*n27 - n148*n5)*n106*pow(n145, n22)*n5*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n5)*pow(n145, n22)*n29*n30*pow(n50, n22)*n79 + n106*n147*n179 + n142) + n240*(pow(alpha, n1*n27 - n14*n148)*n14*pow(n145, n22)*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n14*n148)*pow(n145, n22)*n29*n39*pow(n50, n22)*n79 + n103*n29*n39 + n147*n165*n21*n29) + n242*(pow(alpha, n1*n27 - n148*n15)*n106*pow(n145, n22)*n15*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n15)*n111*pow(n145, n22)*pow(n50, n22)*n79 + n106*n147*n180 + n111*n62) + n244*(pow(alpha, n1*n27 - n11*n148)*n106*n11*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n11*n148)*n123*pow(n145, n22)*pow(n50, n22)*n79 + n106*n147*n173 + n123*n58) + n245*(pow(alpha, n1*n27 - n148*n17)*n106*pow(n145, n22)*n17*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n17)*n115*pow(n145, n22)*pow(n50, n22)*n79 + n106*n147*n166 + n115*n64) + n246*(pow(alpha, n1*n27 - n148*n18)*n106*pow(n145, n22)*n18*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n18)*pow(n145, n22)*n29*n43*pow(n50, n22)*n79 + n106*n147*n171 + n140) + n247 + n248 + n249 + n319*n76 + n22*n302*n93*xF[9]/n212 + n22*n300*n91*xF[7]/n210 + n22*n296*n87*xF[3]/n206 + n22*n293*n84*xF[15]/n203 + n22*n291*n82*xF[13]/n201 + n22*n290*n81*xF[12]/n200));
-      NP_sqrt_base = (-NP0*n366 - n25*(-n117*n68/(n83 - 1 + pow(alpha, -n9*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n118*n68/(n86 - 1 + pow(alpha, -n12*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n122*n68/(n89 - 1 + pow(alpha, -n15*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n68*n76*xF[0]/(pow(alpha, n21*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1)) + n76 - 1) - n68*n77*xF[10]/(n77 - 1 + pow(alpha, -n5*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n68*n80*xF[11]/(n80 - 1 + pow(alpha, -n6*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n68*n81*xF[12]/(n81 - 1 + pow(alpha, -n7*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n68*n82*xF[13]/(n82 - 1 + pow(alpha, -n8*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n68*n84*xF[15]/(n84 - 1 + pow(alpha, -n10*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n68*n85*xF[1]/(n85 - 1 + pow(alpha, -n11*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n68*n87*xF[3]/(n87 - 1 + pow(alpha, -n13*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n68*n88*xF[4]/(n88 - 1 + pow(alpha, -n14*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n68*n90*xF[6]/(n90 - 1 + pow(alpha, -n16*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n68*n91*xF[7]/(n91 - 1 + pow(alpha, -n17*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n68*n92*xF[8]/(n92 - 1 + pow(alpha, -n18*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n68*n93*xF[9]/(n93 - 1 + pow(alpha, -n19*(n107*(n146 - log(n98*(n23 + n26*xTj)/(n23 - xF[0]*xTj) + 1)) + 1)))) + n68*n76*xF[0]/(-n175 + n76 - 1) - pow(NP0, -n0)*(1.0*n110*n229*n303*n68 - 0.5*n239*n271*n307*n68 + 0.5*n251 + 0.5*n340 - 0.5*n369))*(-n0*n25*(n117*pow(n186, n22)*n68*(pow(alpha, n1*n27 - n148*n9)*n126*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n148*n9)*pow(n145, n22)*n21*n29*pow(n50, n22)*n79*n9 + pow(alpha, -n148*n9 + n47)*n137*n21*n29*n9/n145 + n101*n126) - n117*n68*(pow(alpha, -n148*n9 + n47)*n137*n2*n9/n145 + n113*n2)*(pow(alpha, -n148*n9 + n47)*n137*n46*n9/n145 + n113*n46)/n202 + n118*pow(n189, n22)*n68*(pow(alpha, n1*n27 - n12*n148)*n12*pow(n145, n22)*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n12*n148)*n120*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n12*n148 + n47)*n12*n137*n21*n29/n145 + n102*n120) - n118*n68*(pow(alpha, -n12*n148 + n47)*n137*n73/n145 + n59*n73)*(pow(alpha, -n12*n148 + n47)*n12*n137*n46/n145 + n12*n46*n59)/n205 - n122*n68*(pow(alpha, -n148*n15 + n47)*n137*n69/n145 + n62*n69)*(pow(alpha, -n148*n15 + n47)*n137*n15*n46/n145 + n15*n46*n62)/n208 + n130*pow(n187, n22)*n68*(pow(alpha, n1*n27 - n10*n148)*n10*n106*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n10*n148)*n119*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n10*n148 + n47)*n10*n106*n137/n145 + n119*n57) + n130*n68*(pow(alpha, -n10*n148 + n47)*n137*n74/n145 + n57*n74)*(pow(alpha, -n10*n148 + n47)*n10*n137*n46/n145 + n127*n46)/n203 + n131*pow(n184, n22)*n68*(pow(alpha, n1*n27 - n148*n7)*n106*pow(n145, n22)*pow(n50, n22)*n7*n79 - pow(alpha, n1*n27 - n148*n7)*pow(n145, n22)*n29*n32*pow(n50, n22)*n79 + pow(alpha, -n148*n7 + n47)*n106*n137*n7/n145 + n141) + n131*n68*(pow(alpha, -n148*n7 + n47)*n137*n70/n145 + n54*n70)*(pow(alpha, -n148*n7 + n47)*n137*n46*n7/n145 + n46*n54*n7)/n200 + n132*pow(n196, n22)*n68*(pow(alpha, n1*n27 - n148*n19)*n106*pow(n145, n22)*n19*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n19)*pow(n145, n22)*n29*n44*pow(n50, n22)*n79 + pow(alpha, -n148*n19 + n47)*n106*n137*n19/n145 + n29*n44*n66) + n132*n68*(pow(alpha, -n148*n19 + n47)*n137*n72/n145 + n66*n72)*(pow(alpha, -n148*n19 + n47)*n137*n19*n46/n145 + n19*n46*n66)/n212 + n134*n68*(pow(alpha, -n148*n8 + n47)*n137*n2*n8/n145 + n116*n2)*(pow(alpha, -n148*n8 + n47)*n137*n46*n8/n145 + n116*n46)/n201 + pow(n181, n22)*n68*n76*xF[0]*(pow(alpha, -n1*n148 + n47)*n121*(-n23 + xPj*xTj)/(n145*n50) + n121*n98) + pow(n183, n22)*n68*n97*xF[11]*(pow(alpha, n1*n27 - n148*n6)*n106*pow(n145, n22)*pow(n50, n22)*n6*n79 - pow(alpha, n1*n27 - n148*n6)*pow(n145, n22)*n29*n31*pow(n50, n22)*n79 + pow(alpha, -n148*n6 + n47)*n106*n137*n6/n145 + n139) + pow(n185, n22)*n68*n82*xF[13]*(pow(alpha, n1*n27 - n148*n8)*pow(n145, n22)*n21*n29*pow(n50, n22)*n79*n8 + pow(alpha, n1*n27 - n148*n8)*pow(n145, n22)*n29*n33*pow(n50, n22)*n79 + pow(alpha, -n148*n8 + n47)*n137*n21*n29*n8/n145 + n100*n29*n33) + pow(n193, n22)*n68*n90*xF[6]*(pow(alpha, n1*n27 - n148*n16)*pow(n145, n22)*n16*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n148*n16)*pow(n145, n22)*n29*n41*pow(n50, n22)*n79 + pow(alpha, -n148*n16 + n47)*n137*n16*n21*n29/n145 + n105*n29*n41) + n222*n68*n94*(pow(alpha, n1*n27 - n13*n148)*n106*n13*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n13*n148)*pow(n145, n22)*n29*n38*pow(n50, n22)*n79 + pow(alpha, -n13*n148 + n47)*n106*n13*n137/n145 + n143) + n223*n68*n95*(pow(alpha, -n148*n16 + n47)*n137*n16*n2/n145 + n108*n2)*(pow(alpha, -n148*n16 + n47)*n137*n16*n46/n145 + n108*n46) + n224*n68*n96*(pow(alpha, n1*n27 - n148*n5)*n106*pow(n145, n22)*n5*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n5)*pow(n145, n22)*n29*n30*pow(n50, n22)*n79 + pow(alpha, -n148*n5 + n47)*n106*n137*n5/n145 + n142) + n225*n68*n96*(pow(alpha, -n148*n5 + n47)*n137*n2*n5/n145 + n114*n2)*(pow(alpha, -n148*n5 + n47)*n137*n46*n5/n145 + n114*n46) - n237*n68*xF[1]*(pow(alpha, -n11*n148 + n47)*n137*n71/n145 + n58*n71)*(pow(alpha, -n11*n148 + n47)*n11*n137*n46/n145 + n124*n46) - n239*n68*(pow(alpha, -n1*n148 + n47)*n1*n137*n2/n145 + n110*n2)*(pow(alpha, -n1*n148 + n47)*n0*n137*n2*n21/n145 + n0*n2*n21*n49) + n240*n68*(pow(alpha, n1*n27 - n14*n148)*n14*pow(n145, n22)*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n14*n148)*pow(n145, n22)*n29*n39*pow(n50, n22)*n79 + pow(alpha, -n14*n148 + n47)*n137*n14*n21*n29/n145 + n103*n29*n39) - n241*n68*(pow(alpha, -n14*n148 + n47)*n137*n14*n2/n145 + n112*n2)*(pow(alpha, -n14*n148 + n47)*n137*n14*n46/n145 + n112*n46) + n242*n68*(pow(alpha, n1*n27 - n148*n15)*n106*pow(n145, n22)*n15*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n15)*n111*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n148*n15 + n47)*n106*n137*n15/n145 + n111*n62) + n243*n68*(pow(alpha, -n148*n17 + n47)*n137*n75/n145 + n64*n75)*(pow(alpha, -n148*n17 + n47)*n137*n17*n46/n145 + n125*n46) + n244*n68*(pow(alpha, n1*n27 - n11*n148)*n106*n11*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n11*n148)*n123*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n11*n148 + n47)*n106*n11*n137/n145 + n123*n58) + n245*n68*(pow(alpha, n1*n27 - n148*n17)*n106*pow(n145, n22)*n17*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n17)*n115*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n148*n17 + n47)*n106*n137*n17/n145 + n115*n64) + n246*n68*(pow(alpha, n1*n27 - n148*n18)*n106*pow(n145, n22)*n18*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n18)*pow(n145, n22)*n29*n43*pow(n50, n22)*n79 + pow(alpha, -n148*n18 + n47)*n106*n137*n18/n145 + n140) + n251 + n252 + n253 + n254 + n255 + n256 + n257 + n258 + n259 + n260 + n261 + n262 + n263 + n264 + n265 + n266 + n323 + n324 + n325 + n326 + n327 + n328 + n329 + n330 + n331 + n332 + n333 + n334 + n335 + n336 + n337 + n338 - n68*n92*xF[8]*(pow(alpha, -n148*n18 + n47)*n137*n18*n2/n145 + n136)*(pow(alpha, -n148*n18 + n47)*n137*n18*n46/n145 + n128*n46)/n211 + n68*n94*xF[3]*(pow(alpha, -n13*n148 + n47)*n13*n137*n2/n145 + n109*n2)*(pow(alpha, -n13*n148 + n47)*n13*n137*n46/n145 + n109*n46)/n206 + n68*n97*xF[11]*(pow(alpha, -n148*n6 + n47)*n137*n2*n6/n145 + n135)*(pow(alpha, -n148*n6 + n47)*n137*n46*n6/n145 + n46*n53*n6)/n199) - n0*n251 - n0*n340 + 4.0*n110*n229*n303*n68 - 4.0*n239*n287*n68) + pow(-n27*(1.0*n110*n229*n68*xF[0]*(pow(alpha, -n1*n148 + n47)*n1*n137*n2/n145 + n110*n2) + 0.5*pow(n181, n22)*n68*n76*xF[0]*(-pow(alpha, -n1*n148 + n47)*n121*n137/n145 + n121*n98) - 0.5*n239*n68*(pow(alpha, -n1*n148 + n47)*n1*n137*n2/n145 + n110*n2)*(pow(alpha, -n1*n148 + n47)*n0*n137*n2*n21/n145 + n0*n2*n21*n49) + n267 - 0.5*xTj*(n117*pow(n186, n22)*n68*(pow(alpha, n1*n27 - n148*n9)*n126*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n148*n9)*pow(n145, n22)*n21*n29*pow(n50, n22)*n79*n9 + pow(alpha, -n148*n9 + n47)*n137*n21*n29*n9/n145 + n101*n126) - n117*n68*(pow(alpha, -n148*n9 + n47)*n137*n2*n9/n145 + n113*n2)*(pow(alpha, -n148*n9 + n47)*n137*n46*n9/n145 + n113*n46)/n202 + n118*pow(n189, n22)*n68*(pow(alpha, n1*n27 - n12*n148)*n12*pow(n145, n22)*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n12*n148)*n120*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n12*n148 + n47)*n12*n137*n21*n29/n145 + n102*n120) - n118*n68*(pow(alpha, -n12*n148 + n47)*n137*n73/n145 + n59*n73)*(pow(alpha, -n12*n148 + n47)*n12*n137*n46/n145 + n12*n46*n59)/n205 - n122*n68*(pow(alpha, -n148*n15 + n47)*n137*n69/n145 + n62*n69)*(pow(alpha, -n148*n15 + n47)*n137*n15*n46/n145 + n15*n46*n62)/n208 + n130*pow(n187, n22)*n68*(pow(alpha, n1*n27 - n10*n148)*n10*n106*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n10*n148)*n119*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n10*n148 + n47)*n10*n106*n137/n145 + n119*n57) + n130*n68*(pow(alpha, -n10*n148 + n47)*n137*n74/n145 + n57*n74)*(pow(alpha, -n10*n148 + n47)*n10*n137*n46/n145 + n127*n46)/n203 + n131*pow(n184, n22)*n68*(pow(alpha, n1*n27 - n148*n7)*n106*pow(n145, n22)*pow(n50, n22)*n7*n79 - pow(alpha, n1*n27 - n148*n7)*pow(n145, n22)*n29*n32*pow(n50, n22)*n79 + pow(alpha, -n148*n7 + n47)*n106*n137*n7/n145 + n141) + n131*n68*(pow(alpha, -n148*n7 + n47)*n137*n70/n145 + n54*n70)*(pow(alpha, -n148*n7 + n47)*n137*n46*n7/n145 + n46*n54*n7)/n200 + n132*pow(n196, n22)*n68*(pow(alpha, n1*n27 - n148*n19)*n106*pow(n145, n22)*n19*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n19)*pow(n145, n22)*n29*n44*pow(n50, n22)*n79 + pow(alpha, -n148*n19 + n47)*n106*n137*n19/n145 + n29*n44*n66) + n132*n68*(pow(alpha, -n148*n19 + n47)*n137*n72/n145 + n66*n72)*(pow(alpha, -n148*n19 + n47)*n137*n19*n46/n145 + n19*n46*n66)/n212 + n134*n68*(pow(alpha, -n148*n8 + n47)*n137*n2*n8/n145 + n116*n2)*(pow(alpha, -n148*n8 + n47)*n137*n46*n8/n145 + n116*n46)/n201 + pow(n181, n22)*n68*n76*xF[0]*(-pow(alpha, -n1*n148 + n47)*n121*n137/n145 + n121*n98) + pow(n183, n22)*n68*n97*xF[11]*(pow(alpha, n1*n27 - n148*n6)*n106*pow(n145, n22)*pow(n50, n22)*n6*n79 - pow(alpha, n1*n27 - n148*n6)*pow(n145, n22)*n29*n31*pow(n50, n22)*n79 + pow(alpha, -n148*n6 + n47)*n106*n137*n6/n145 + n139) + pow(n185, n22)*n68*n82*xF[13]*(pow(alpha, n1*n27 - n148*n8)*pow(n145, n22)*n21*n29*pow(n50, n22)*n79*n8 + pow(alpha, n1*n27 - n148*n8)*pow(n145, n22)*n29*n33*pow(n50, n22)*n79 + pow(alpha, -n148*n8 + n47)*n137*n21*n29*n8/n145 + n100*n29*n33) + pow(n193, n22)*n68*n90*xF[6]*(pow(alpha, n1*n27 - n148*n16)*pow(n145, n22)*n16*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n148*n16)*pow(n145, n22)*n29*n41*pow(n50, n22)*n79 + pow(alpha, -n148*n16 + n47)*n137*n16*n21*n29/n145 + n105*n29*n41) + n222*n68*n94*(pow(alpha, n1*n27 - n13*n148)*n106*n13*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n13*n148)*pow(n145, n22)*n29*n38*pow(n50, n22)*n79 + pow(alpha, -n13*n148 + n47)*n106*n13*n137/n145 + n143) + n223*n68*n95*(pow(alpha, -n148*n16 + n47)*n137*n16*n2/n145 + n108*n2)*(pow(alpha, -n148*n16 + n47)*n137*n16*n46/n145 + n108*n46) + n224*n68*n96*(pow(alpha, n1*n27 - n148*n5)*n106*pow(n145, n22)*n5*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n5)*pow(n145, n22)*n29*n30*pow(n50, n22)*n79 + pow(alpha, -n148*n5 + n47)*n106*n137*n5/n145 + n142) + n225*n68*n96*(pow(alpha, -n148*n5 + n47)*n137*n2*n5/n145 + n114*n2)*(pow(alpha, -n148*n5 + n47)*n137*n46*n5/n145 + n114*n46) - n237*n68*xF[1]*(pow(alpha, -n11*n148 + n47)*n137*n71/n145 + n58*n71)*(pow(alpha, -n11*n148 + n47)*n11*n137*n46/n145 + n124*n46) - n239*n68*(pow(alpha, -n1*n148 + n47)*n1*n137*n2/n145 + n110*n2)*(pow(alpha, -n1*n148 + n47)*n0*n137*n2*n21/n145 + n0*n2*n21*n49) + n240*n68*(pow(alpha, n1*n27 - n14*n148)*n14*pow(n145, n22)*n21*n29*pow(n50, n22)*n79 + pow(alpha, n1*n27 - n14*n148)*pow(n145, n22)*n29*n39*pow(n50, n22)*n79 + pow(alpha, -n14*n148 + n47)*n137*n14*n21*n29/n145 + n103*n29*n39) - n241*n68*(pow(alpha, -n14*n148 + n47)*n137*n14*n2/n145 + n112*n2)*(pow(alpha, -n14*n148 + n47)*n137*n14*n46/n145 + n112*n46) + n242*n68*(pow(alpha, n1*n27 - n148*n15)*n106*pow(n145, n22)*n15*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n15)*n111*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n148*n15 + n47)*n106*n137*n15/n145 + n111*n62) + n243*n68*(pow(alpha, -n148*n17 + n47)*n137*n75/n145 + n64*n75)*(pow(alpha, -n148*n17 + n47)*n137*n17*n46/n145 + n125*n46) + n244*n68*(pow(alpha, n1*n27 - n11*n148)*n106*n11*pow(n145, n22)*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n11*n148)*n123*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n11*n148 + n47)*n106*n11*n137/n145 + n123*n58) + n245*n68*(pow(alpha, n1*n27 - n148*n17)*n106*pow(n145, n22)*n17*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n17)*n115*pow(n145, n22)*pow(n50, n22)*n79 + pow(alpha, -n148*n17 + n47)*n106*n137*n17/n145 + n115*n64) + n246*n68*(pow(alpha, n1*n27 - n148*n18)*n106*pow(n145, n22)*n18*pow(n50, n22)*n79 - pow(alpha, n1*n27 - n148*n18)*pow(n145, n22)*n29*n43*pow(n50, n22)*n79 + pow(alpha, -n148*n18 + n47)*n106*n137*n18/n145 + n140) + n251 + n252 + n253 + n254 + n255 + n256 + n257 + n258 + n259 + n260 + n261 + n262 + n263 + n264 + n265 + n266 + n323 + n324 + n325 + n326 + n327 + n328 + n329 + n330 + n331 + n332 + n333 + n334 + n335 + n336 + n337 + n338 - n68*n92*xF[8]*(pow(alpha, -n148*n18 + n47)*n137*n18*n2/n145 + n136)*(pow(alpha, -n148*n18 + n47)*n137*n18*n46/n145 + n128*n46)/n211 + n68*n94*xF[3]*(pow(alpha, -n13*n148 + n47)*n13*n137*n2/n145 + n109*n2)*(pow(alpha, -n13*n148 + n47)*n13*n137*n46/n145 + n109*n46)/n206 + n68*n97*xF[11]*(pow(alpha, -n148*n6 + n47)*n137*n2*n6/n145 + n135)*(pow(alpha, -n148*n6 + n47)*n137*n46*n6/n145 + n46*n53*n6)/n199)) - n366, -n0);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n107*(n146 - log(-pow(alpha, NP1*n1)*n137 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[10] - Mstar;
-      g5 = MW[11] - Mstar;
-      g6 = MW[12] - Mstar;
-      g7 = MW[13] - Mstar;
-      g8 = MW[14] - Mstar;
-      g9 = MW[15] - Mstar;
-      g10 = MW[2] - Mstar;
-      g11 = MW[3] - Mstar;
-      g12 = MW[4] - Mstar;
-      g13 = MW[5] - Mstar;
-      g14 = MW[6] - Mstar;
-      g15 = MW[7] - Mstar;
-      g16 = MW[8] - Mstar;
-      g17 = MW[9] - Mstar;
-      g18 = xF[0] - xTj;
-      g19 = xF[0] - xPj;
-      g20 = -xTj;
-      g21 = xPj/xF[1];
-      g22 = pow(alpha, -g1);
-      g23 = pow(alpha, -g4);
-      g24 = pow(alpha, -g5);
-      g25 = pow(alpha, -g6);
-      g26 = pow(alpha, -g7);
-      g27 = pow(alpha, -g8);
-      g28 = pow(alpha, -g9);
-      g29 = pow(alpha, -g0);
-      g30 = pow(alpha, -g10);
-      g31 = pow(alpha, -g11);
-      g32 = pow(alpha, -g12);
-      g33 = pow(alpha, -g13);
-      g34 = pow(alpha, -g14);
-      g35 = pow(alpha, -g15);
-      g36 = pow(alpha, -g16);
-      g37 = pow(alpha, -g17);
-      g38 = log(xF[0]/xF[1]);
-      g39 = -g2;
-      g40 = pow(alpha, NP1*g0);
-      g41 = pow(alpha, NP1*g1);
-      g42 = pow(alpha, NP1*g4);
-      g43 = log(g22);
-      g44 = pow(alpha, NP1*g5);
-      g45 = pow(alpha, NP1*g6);
-      g46 = pow(alpha, NP1*g7);
-      g47 = pow(alpha, NP1*g8);
-      g48 = pow(alpha, NP1*g9);
-      g49 = pow(alpha, NP1*g10);
-      g50 = pow(alpha, NP1*g11);
-      g51 = pow(alpha, NP1*g12);
-      g52 = pow(alpha, NP1*g13);
-      g53 = pow(alpha, NP1*g14);
-      g54 = pow(alpha, NP1*g15);
-      g55 = pow(alpha, NP1*g16);
-      g56 = pow(alpha, NP1*g17);
-      g57 = -g38;
-      g58 = g18/g3;
-      g59 = g3/g18;
-      g60 = -g40 + 1;
-      g61 = -g40 + 1;
-      g62 = -g41 + 1;
-      g63 = -g49 + 1;
-      g64 = -g50 + 1;
-      g65 = -g51 + 1;
-      g66 = -g52 + 1;
-      g67 = -g53 + 1;
-      g68 = -g54 + 1;
-      g69 = -g55 + 1;
-      g70 = -g56 + 1;
-      g71 = -g42 + 1;
-      g72 = -g44 + 1;
-      g73 = -g45 + 1;
-      g74 = -g46 + 1;
-      g75 = -g47 + 1;
-      g76 = -g48 + 1;
-      g77 = -g41;
-      g78 = -g42;
-      g79 = -g44;
-      g80 = -g45;
-      g81 = -g46;
-      g82 = -g47;
-      g83 = -g48;
-      g84 = -g49;
-      g85 = -g50;
-      g86 = -g51;
-      g87 = -g52;
-      g88 = -g53;
-      g89 = -g54;
-      g90 = -g55;
-      g91 = -g56;
-      g92 = -1.0*g38;
-      g93 = -g3/g19;
-      g94 = g19/(g3*xF[1]);
-      g95 = pow(alpha, g0*g39) - 1;
-      g96 = pow(alpha, g0*g39) - 1;
-      g97 = pow(alpha, g1*g39) - 1;
-      g98 = pow(alpha, g10*g39) - 1;
-      g99 = pow(alpha, g11*g39) - 1;
-      g100 = pow(alpha, g12*g39) - 1;
-      g101 = pow(alpha, g13*g39) - 1;
-      g102 = pow(alpha, g14*g39) - 1;
-      g103 = pow(alpha, g15*g39) - 1;
-      g104 = pow(alpha, g16*g39) - 1;
-      g105 = pow(alpha, g17*g39) - 1;
-      g106 = pow(alpha, g39*g4) - 1;
-      g107 = pow(alpha, g39*g5) - 1;
-      g108 = pow(alpha, g39*g6) - 1;
-      g109 = pow(alpha, g39*g7) - 1;
-      g110 = pow(alpha, g39*g8) - 1;
-      g111 = pow(alpha, g39*g9) - 1;
-      g112 = -pow(alpha, g1*g39);
-      g113 = -pow(alpha, g39*g4);
-      g114 = -pow(alpha, g39*g5);
-      g115 = -pow(alpha, g39*g6);
-      g116 = -pow(alpha, g39*g7);
-      g117 = -pow(alpha, g39*g8);
-      g118 = -pow(alpha, g39*g9);
-      g119 = -pow(alpha, g10*g39);
-      g120 = -pow(alpha, g11*g39);
-      g121 = -pow(alpha, g12*g39);
-      g122 = -pow(alpha, g13*g39);
-      g123 = -pow(alpha, g14*g39);
-      g124 = -pow(alpha, g15*g39);
-      g125 = -pow(alpha, g16*g39);
-      g126 = -pow(alpha, g17*g39);
-      g127 = g61 + g96;
-      g128 = -g112 - g41;
-      g129 = -g113 - g42;
-      g130 = -g114 - g44;
-      g131 = -g115 - g45;
-      g132 = -g116 - g46;
-      g133 = -g117 - g47;
-      g134 = -g118 - g48;
-      g135 = -g119 - g49;
-      g136 = -g120 - g50;
-      g137 = -g121 - g51;
-      g138 = -g122 - g52;
-      g139 = -g123 - g53;
-      g140 = -g124 - g54;
-      g141 = -g125 - g55;
-      g142 = -g126 - g56;
-      g143 = pow(alpha, g1*g39) + g77;
-      g144 = g61 + g96;
-      g145 = pow(alpha, g39*g4) + g78;
-      g146 = pow(alpha, g39*g5) + g79;
-      g147 = pow(alpha, g39*g6) + g80;
-      g148 = pow(alpha, g39*g7) + g81;
-      g149 = pow(alpha, g39*g8) + g82;
-      g150 = pow(alpha, g39*g9) + g83;
-      g151 = pow(alpha, g10*g39) + g84;
-      g152 = pow(alpha, g11*g39) + g85;
-      g153 = pow(alpha, g12*g39) + g86;
-      g154 = pow(alpha, g13*g39) + g87;
-      g155 = pow(alpha, g14*g39) + g88;
-      g156 = pow(alpha, g15*g39) + g89;
-      g157 = pow(alpha, g16*g39) + g90;
-      g158 = pow(alpha, g17*g39) + g91;
-      g159 = xF[11]/g146;
-      g160 = xF[9]/g158;
-      g161 = xF[8]/g157;
-      g162 = xF[1]/g144;
-      g163 = xF[10]/g145;
-      g164 = xF[15]/g150;
-      g165 = xF[3]/g152;
-      g166 = xF[7]/g156;
-      g167 = xF[4]/g153;
-      g168 = xF[12]/g147;
-      g169 = xF[13]/g148;
-      g170 = xF[6]/g155;
-      g171 = xF[14]/g149;
-      g172 = xF[5]/g154;
-      g173 = xF[2]/g151;
-      g174 = xF[0]/g143;
-      g175 = xF[0]/g128;
-      g176 = xF[15]/g134;
-      g177 = xF[4]/g137;
-      g178 = xF[7]/g140;
-      g179 = xF[2]/g135;
-      g180 = xF[11]/g130;
-      g181 = xF[1]/g127;
-      g182 = xF[13]/g132;
-      g183 = xF[3]/g136;
-      g184 = xF[6]/g139;
-      g185 = xF[14]/g133;
-      g186 = xF[8]/g141;
-      g187 = xF[12]/g131;
-      g188 = xF[10]/g129;
-      g189 = xF[9]/g142;
-      g190 = xF[5]/g138;
-      g191 = g73/g131;
-      g192 = g70/g142;
-      g193 = g76/g134;
-      g194 = g65/g137;
-      g195 = g68/g140;
-      g196 = g62/g128;
-      g197 = g66/g138;
-      g198 = g67/g139;
-      g199 = g74/g132;
-      g200 = g64/g136;
-      g201 = g60/g127;
-      g202 = g72/g130;
-      g203 = g63/g135;
-      g204 = g75/g133;
-      g205 = g71/g129;
-      g206 = g69/g141;
-      g207 = g97/g128;
-      g208 = g111/g134;
-      g209 = g107/g130;
-      g210 = g98/g135;
-      g211 = g99/g136;
-      g212 = g100/g137;
-      g213 = g95/g127;
-      g214 = g104/g141;
-      g215 = g105/g142;
-      g216 = g102/g139;
-      g217 = g110/g133;
-      g218 = g108/g131;
-      g219 = g109/g132;
-      g220 = g103/g140;
-      g221 = g106/g129;
-      g222 = g101/g138;
-      g223 = log(g144*g20*g94/g61);
-      g224 = log(g127*g20*g94/g60);
-      g225 = log(g144*g21*g58/g96);
-      g226 = 1.0*g223;
-      g227 = log(g127*g21*g58/g95);
-      g228 = 1.0*g225;
-      g229 = -g159*g226*(g79 + 1) - g159*g228*(pow(alpha, g39*g5) - 1) - g160*g226*(g91 + 1) - g160*g228*(pow(alpha, g17*g39) - 1) - g161*g226*(g90 + 1) - g161*g228*(pow(alpha, g16*g39) - 1) - g162*g226*g61 - g162*g228*g96 - g163*g226*(g78 + 1) - g163*g228*(pow(alpha, g39*g4) - 1) - g164*g226*(g83 + 1) - g164*g228*(pow(alpha, g39*g9) - 1) - g165*g226*(g85 + 1) - g165*g228*(pow(alpha, g11*g39) - 1) - g166*g226*(g89 + 1) - g166*g228*(pow(alpha, g15*g39) - 1) - g167*g226*(g86 + 1) - g167*g228*(pow(alpha, g12*g39) - 1) - g168*g226*(g80 + 1) - g168*g228*(pow(alpha, g39*g6) - 1) - g169*g226*(g81 + 1) - g169*g228*(pow(alpha, g39*g7) - 1) - g170*g226*(g88 + 1) - g170*g228*(pow(alpha, g14*g39) - 1) - g171*g226*(g82 + 1) - g171*g228*(pow(alpha, g39*g8) - 1) - g172*g226*(g87 + 1) - g172*g228*(pow(alpha, g13*g39) - 1) - g173*g226*(g84 + 1) - g173*g228*(pow(alpha, g10*g39) - 1) - g174*g226*(g77 + 1) - g174*g228*(pow(alpha, g1*g39) - 1) - g92*xF[0] - g92*xF[10] - g92*xF[11] - g92*xF[12] - g92*xF[13] - g92*xF[14] - g92*xF[15] - g92*xF[1] - g92*xF[2] - g92*xF[3] - g92*xF[4] - g92*xF[5] - g92*xF[6] - g92*xF[7] - g92*xF[8] - g92*xF[9];
-      LpF = xF[0]*(g22 + 1.0)*(g196*g224 + g207*g227 + g57)/(g43*(g22 - 1.0)) + xF[10]*(g23 + 1.0)*(g205*g224 + g221*g227 + g57)/(g43*(g23 - 1.0)) + xF[11]*(g24 + 1.0)*(g202*g224 + g209*g227 + g57)/(g43*(g24 - 1.0)) + xF[12]*(g25 + 1.0)*(g191*g224 + g218*g227 + g57)/(g43*(g25 - 1.0)) + xF[13]*(g26 + 1.0)*(g199*g224 + g219*g227 + g57)/(g43*(g26 - 1.0)) + xF[14]*(g27 + 1.0)*(g204*g224 + g217*g227 + g57)/(g43*(g27 - 1.0)) + xF[15]*(g28 + 1.0)*(g193*g224 + g208*g227 + g57)/(g43*(g28 - 1.0)) + xF[1]*(g29 + 1.0)*(g201*g224 + g213*g227 + g57)/(g43*(g29 - 1.0)) + xF[2]*(g30 + 1.0)*(g203*g224 + g210*g227 + g57)/(g43*(g30 - 1.0)) + xF[3]*(g31 + 1.0)*(g200*g224 + g211*g227 + g57)/(g43*(g31 - 1.0)) + xF[4]*(g32 + 1.0)*(g194*g224 + g212*g227 + g57)/(g43*(g32 - 1.0)) + xF[5]*(g33 + 1.0)*(g197*g224 + g222*g227 + g57)/(g43*(g33 - 1.0)) + xF[6]*(g34 + 1.0)*(g198*g224 + g216*g227 + g57)/(g43*(g34 - 1.0)) + xF[7]*(g35 + 1.0)*(g195*g224 + g220*g227 + g57)/(g43*(g35 - 1.0)) + xF[8]*(g36 + 1.0)*(g206*g224 + g214*g227 + g57)/(g43*(g36 - 1.0)) + xF[9]*(g37 + 1.0)*(g192*g224 + g215*g227 + g57)/(g43*(g37 - 1.0));
-      PpF = g58;
-      TpF = -g19/g3;
-      SWUpF = g229;
-      SWUpP = g229*g59;
-      xP[0] = g175*g59*g97;
-      xP[1] = g181*g59*g95;
-      xP[2] = g179*g59*g98;
-      xP[3] = g183*g59*g99;
-      xP[4] = g100*g177*g59;
-      xP[5] = g101*g190*g59;
-      xP[6] = g102*g184*g59;
-      xP[7] = g103*g178*g59;
-      xP[8] = g104*g186*g59;
-      xP[9] = g105*g189*g59;
-      xP[10] = g106*g188*g59;
-      xP[11] = g107*g180*g59;
-      xP[12] = g108*g187*g59;
-      xP[13] = g109*g182*g59;
-      xP[14] = g110*g185*g59;
-      xP[15] = g111*g176*g59;
-      xT[0] = g175*g62*g93;
-      xT[1] = g181*g60*g93;
-      xT[2] = g179*g63*g93;
-      xT[3] = g183*g64*g93;
-      xT[4] = g177*g65*g93;
-      xT[5] = g190*g66*g93;
-      xT[6] = g184*g67*g93;
-      xT[7] = g178*g68*g93;
-      xT[8] = g186*g69*g93;
-      xT[9] = g189*g70*g93;
-      xT[10] = g188*g71*g93;
-      xT[11] = g180*g72*g93;
-      xT[12] = g187*g73*g93;
-      xT[13] = g182*g74*g93;
-      xT[14] = g185*g75*g93;
-      xT[15] = g176*g76*g93;
-      break;
-    case 17:
-      n0 = MW[0] - Mstar;
-      n1 = log(alpha);
-      n2 = xPj - xTj;
-      n3 = xF[0] - xPj;
-      n4 = MW[10] - Mstar;
-      n5 = MW[11] - Mstar;
-      n6 = MW[12] - Mstar;
-      n7 = MW[13] - Mstar;
-      n8 = MW[14] - Mstar;
-      n9 = MW[15] - Mstar;
-      n10 = MW[16] - Mstar;
-      n11 = MW[1] - Mstar;
-      n12 = MW[2] - Mstar;
-      n13 = MW[3] - Mstar;
-      n14 = MW[4] - Mstar;
-      n15 = MW[5] - Mstar;
-      n16 = MW[6] - Mstar;
-      n17 = MW[7] - Mstar;
-      n18 = MW[8] - Mstar;
-      n19 = MW[9] - Mstar;
-      n20 = log(xTj);
-      n21 = -2;
-      n22 = -n0;
-      n23 = xF[0]*xPj;
-      n24 = -Mstar;
-      n25 = -NP0*n21;
-      n26 = -xTj;
-      n27 = -xPj;
-      n28 = -MW[0];
-      n29 = pow(n0, -n21);
-      n30 = pow(n1, -n21);
-      n31 = pow(n4, -n21);
-      n32 = pow(n5, -n21);
-      n33 = pow(n6, -n21);
-      n34 = pow(n7, -n21);
-      n35 = pow(n8, -n21);
-      n36 = pow(n9, -n21);
-      n37 = pow(n10, -n21);
-      n38 = pow(n11, -n21);
-      n39 = pow(n12, -n21);
-      n40 = pow(n13, -n21);
-      n41 = pow(n14, -n21);
-      n42 = pow(n15, -n21);
-      n43 = pow(n16, -n21);
-      n44 = pow(n17, -n21);
-      n45 = pow(n18, -n21);
-      n46 = pow(n19, -n21);
-      n47 = Mstar*n1;
-      n48 = -n1*n21;
-      n49 = n1*xF[4];
-      n50 = pow(alpha, NP0*n0);
-      n51 = n23 + n26*xF[0];
-      n52 = n23 + n26*xPj;
-      n53 = pow(alpha, NP0*n4);
-      n54 = pow(alpha, NP0*n5);
-      n55 = pow(alpha, NP0*n6);
-      n56 = pow(alpha, NP0*n7);
-      n57 = pow(alpha, NP0*n8);
-      n58 = pow(alpha, NP0*n9);
-      n59 = pow(alpha, NP0*n10);
-      n60 = pow(alpha, NP0*n11);
-      n61 = pow(alpha, NP0*n12);
-      n62 = pow(alpha, NP0*n13);
-      n63 = pow(alpha, NP0*n14);
-      n64 = pow(alpha, NP0*n15);
-      n65 = pow(alpha, NP0*n16);
-      n66 = pow(alpha, NP0*n17);
-      n67 = pow(alpha, NP0*n18);
-      n68 = pow(alpha, NP0*n19);
-      n69 = n1*n28;
-      n70 = n2/n3;
-      n71 = n1*n6;
-      n72 = n1*n15;
-      n73 = n1*n5;
-      n74 = n1*n19;
-      n75 = n1*n14;
-      n76 = n1*n12;
-      n77 = n1*n16;
-      n78 = n1*n9;
-      n79 = n1*n7;
-      n80 = n1*n17;
-      n81 = -n50 + 1;
-      n82 = -n53 + 1;
-      n83 = pow(alpha, NP0*n21*n22);
-      n84 = pow(n51, -n21);
-      n85 = pow(n52, -n21);
-      n86 = -n54 + 1;
-      n87 = -n55 + 1;
-      n88 = -n56 + 1;
-      n89 = -n57 + 1;
-      n90 = -n58 + 1;
-      n91 = -n59 + 1;
-      n92 = -n60 + 1;
-      n93 = -n61 + 1;
-      n94 = -n62 + 1;
-      n95 = -n63 + 1;
-      n96 = -n64 + 1;
-      n97 = -n65 + 1;
-      n98 = -n66 + 1;
-      n99 = -n67 + 1;
-      n100 = -n68 + 1;
-      n101 = n81;
-      n102 = -n50;
-      n103 = -n54;
-      n104 = -n56;
-      n105 = -n57;
-      n106 = -n59;
-      n107 = -n61;
-      n108 = -n63;
-      n109 = -n64;
-      n110 = -n65;
-      n111 = -n70;
-      n112 = n55*xF[12];
-      n113 = n66*xF[7];
-      n114 = n0*n30;
-      n115 = n68*xF[9];
-      n116 = 1/(n0*n1);
-      n117 = n60*xF[1];
-      n118 = n58*xF[15];
-      n119 = n61*xF[2];
-      n120 = n91*xF[16];
-      n121 = n13*n62;
-      n122 = n90*xF[15];
-      n123 = n87*xF[12];
-      n124 = n0*n50;
-      n125 = n30*n42;
-      n126 = n14*n63;
-      n127 = n100*xF[9];
-      n128 = n57*n8;
-      n129 = n4*n53;
-      n130 = n97*xF[6];
-      n131 = n89*xF[14];
-      n132 = n93*xF[2];
-      n133 = n96*xF[5];
-      n134 = n88*xF[13];
-      n135 = n101*xF[0];
-      n136 = n30*n36;
-      n137 = n30*n39;
-      n138 = n10*n59;
-      n139 = n30*n38;
-      n140 = n92*xF[1];
-      n141 = n11*n60;
-      n142 = n30*n33;
-      n143 = n56*n7;
-      n144 = n29*n30;
-      n145 = n30*n35;
-      n146 = n18*n67;
-      n147 = n81*xF[0];
-      n148 = log((-1.0 + xPj/xF[0])/n2);
-      n149 = n1*n124;
-      n150 = n1*n129;
-      n151 = n54*n73;
-      n152 = n55*n71;
-      n153 = n56*n79;
-      n154 = n1*n128;
-      n155 = n58*n78;
-      n156 = n1*n138;
-      n157 = n1*n141;
-      n158 = n61*n76;
-      n159 = n1*n121;
-      n160 = n63*n75;
-      n161 = n64*n72;
-      n162 = n65*n77;
-      n163 = n66*n80;
-      n164 = n1*n146;
-      n165 = n68*n74;
-      n166 = n52/n51;
-      n167 = n1*n11*n117;
-      n168 = n153*xF[13];
-      n169 = n144*n50;
-      n170 = n30*n34*n56;
-      n171 = n30*n32*n54;
-      n172 = n30*n45*n67;
-      n173 = n30*n37*n59;
-      n174 = n30*n31*n53;
-      n175 = n30*n43*n65;
-      n176 = n30*n40*n62;
-      n177 = n102*n166 + 1;
-      n178 = -n166*n50 + 1;
-      n179 = pow(n177, -n21);
-      n180 = n148 + n20 + n47 + n69;
-      n181 = n1/n178;
-      n182 = n50/n178;
-      n183 = n181*n50;
-      n184 = n166/n178;
-      n185 = n166*n50/n177;
-      n186 = n166*n182;
-      n187 = n116*(n180 - log(n177)) + 1;
-      n188 = n116*(n180 - log(n178)) + 1;
-      n189 = pow(alpha, n0*n187);
-      n190 = pow(alpha, n187*n4);
-      n191 = pow(alpha, n187*n5);
-      n192 = pow(alpha, n187*n6);
-      n193 = pow(alpha, n187*n7);
-      n194 = pow(alpha, n187*n8);
-      n195 = pow(alpha, n187*n9);
-      n196 = pow(alpha, n10*n187);
-      n197 = pow(alpha, n11*n187);
-      n198 = pow(alpha, n12*n187);
-      n199 = pow(alpha, n13*n187);
-      n200 = pow(alpha, n14*n187);
-      n201 = pow(alpha, n15*n187);
-      n202 = pow(alpha, n16*n187);
-      n203 = pow(alpha, n17*n187);
-      n204 = pow(alpha, n18*n187);
-      n205 = pow(alpha, n187*n19);
-      n206 = -1/n193;
-      n207 = n17/n203;
-      n208 = -1/n192;
-      n209 = -1/n202;
-      n210 = -1/n190;
-      n211 = n13/n199;
-      n212 = n8/n194;
-      n213 = -1/n195;
-      n214 = n18/n204;
-      n215 = -1/n196;
-      n216 = -1/n191;
-      n217 = n5/n191;
-      n218 = n14/n200;
-      n219 = -1/n201;
-      n220 = n11/n197;
-      n221 = -1/n205;
-      n222 = n12/n198;
-      n223 = -1/n199;
-      n224 = -1/n189;
-      n225 = n9/n195;
-      n226 = n6/n192;
-      n227 = -1/n204;
-      n228 = n4/n190;
-      n229 = -1/n197;
-      n230 = n15/n201;
-      n231 = n19/n205;
-      n232 = -1/n203;
-      n233 = n10/n196;
-      n234 = pow(alpha, n187*n22) + n81 - 1;
-      n235 = n82 - 1 + 1.0/n190;
-      n236 = n86 - 1 + 1.0/n191;
-      n237 = n87 - 1 + 1.0/n192;
-      n238 = n88 - 1 + 1.0/n193;
-      n239 = n89 - 1 + 1.0/n194;
-      n240 = n90 - 1 + 1.0/n195;
-      n241 = n91 - 1 + 1.0/n196;
-      n242 = n92 - 1 + 1.0/n197;
-      n243 = n93 - 1 + 1.0/n198;
-      n244 = n94 - 1 + 1.0/n199;
-      n245 = n95 - 1 + 1.0/n200;
-      n246 = n96 - 1 + 1.0/n201;
-      n247 = n97 - 1 + 1.0/n202;
-      n248 = n98 - 1 + 1.0/n203;
-      n249 = n99 - 1 + 1.0/n204;
-      n250 = n100 - 1 + 1.0/n205;
-      n251 = -n224 + n81 - 1;
-      n252 = -n210 + n82 - 1;
-      n253 = -n216 + n86 - 1;
-      n254 = -n208 + n87 - 1;
-      n255 = -n206 + n88 - 1;
-      n256 = n239;
-      n257 = -n213 + n90 - 1;
-      n258 = -n215 + n91 - 1;
-      n259 = -n229 + n92 - 1;
-      n260 = n243;
-      n261 = -n223 + n94 - 1;
-      n262 = n245;
-      n263 = -n219 + n96 - 1;
-      n264 = -n209 + n97 - 1;
-      n265 = -n232 + n98 - 1;
-      n266 = -n227 + n99 - 1;
-      n267 = n100 - n221 - 1;
-      n268 = pow(n234, -n21);
-      n269 = pow(n235, -n21);
-      n270 = pow(n236, -n21);
-      n271 = pow(n237, -n21);
-      n272 = pow(n238, -n21);
-      n273 = pow(n239, -n21);
-      n274 = pow(n240, -n21);
-      n275 = pow(n241, -n21);
-      n276 = pow(n242, -n21);
-      n277 = pow(n243, -n21);
-      n278 = pow(n244, -n21);
-      n279 = pow(n245, -n21);
-      n280 = pow(n246, -n21);
-      n281 = pow(n247, -n21);
-      n282 = pow(n248, -n21);
-      n283 = pow(n249, -n21);
-      n284 = pow(n250, -n21);
-      n285 = pow(n234, 3);
-      n286 = pow(n235, 3);
-      n287 = pow(n236, 3);
-      n288 = pow(n237, 3);
-      n289 = pow(n238, 3);
-      n290 = pow(n239, 3);
-      n291 = pow(n240, 3);
-      n292 = pow(n241, 3);
-      n293 = pow(n242, 3);
-      n294 = pow(n243, 3);
-      n295 = pow(n244, 3);
-      n296 = pow(n245, 3);
-      n297 = pow(n246, 3);
-      n298 = pow(n247, 3);
-      n299 = pow(n248, 3);
-      n300 = pow(n249, 3);
-      n301 = pow(n250, 3);
-      n302 = pow(n251, -n21);
-      n303 = xF[11]/n236;
-      n304 = xF[0]/n234;
-      n305 = xF[10]/n235;
-      n306 = xF[13]/n238;
-      n307 = xF[8]/n249;
-      n308 = xF[16]/n241;
-      n309 = xF[6]/n247;
-      n310 = xF[3]/n244;
-      n311 = xF[3]/n278;
-      n312 = xF[10]/n269;
-      n313 = xF[0]/n251;
-      n314 = n1/n268;
-      n315 = n1*n313;
-      n316 = n64*xF[5]/n246;
-      n317 = n119/n243;
-      n318 = n118/n240;
-      n319 = n57*xF[14]/n239;
-      n320 = n30*n44/n248;
-      n321 = n86/n287;
-      n322 = n86/n270;
-      n323 = n95/n296;
-      n324 = n81/n268;
-      n325 = n133/n280;
-      n326 = n98*xF[7]/n299;
-      n327 = n140/n276;
-      n328 = n95*xF[4]/n279;
-      n329 = n98*xF[7]/n282;
-      n330 = n99*xF[8]/n283;
-      n331 = 1/(n177*n189);
-      n332 = n115*n30*n46/n250;
-      n333 = n30*n41*n63*xF[4]/n245;
-      n334 = n1*n22*n304*n50*n70;
-      n335 = n169*n304*n70;
-      n336 = n174*n305*n70;
-      n337 = n171*n303*n70;
-      n338 = n112*n142*n70/n237;
-      n339 = n170*n306*n70;
-      n340 = n145*n319*n70;
-      n341 = n136*n318*n70;
-      n342 = n173*n308*n70;
-      n343 = n117*n139*n70/n242;
-      n344 = n137*n317*n70;
-      n345 = n176*n310*n70;
-      n346 = n333*n70;
-      n347 = n125*n316*n70;
-      n348 = n175*n309*n70;
-      n349 = n113*n320*n70;
-      n350 = n172*n307*n70;
-      n351 = n332*n70;
-      n352 = 0.5*n335;
-      n353 = n166*n331 + 1;
-      n354 = n149*n166*n331 + n149;
-      n355 = n1*n185*n228 + n150;
-      n356 = n151 + n185*n73/n191;
-      n357 = n152 + n185*n71/n192;
-      n358 = n153 + n185*n79/n193;
-      n359 = n1*n185*n212 + n154;
-      n360 = n155 + n185*n78/n195;
-      n361 = n1*n185*n233 + n156;
-      n362 = n1*n185*n220 + n157;
-      n363 = n158 + n185*n76/n198;
-      n364 = n1*n185*n211 + n159;
-      n365 = n160 + n185*n75/n200;
-      n366 = n161 + n185*n72/n201;
-      n367 = n162 + n185*n77/n202;
-      n368 = n163 + n185*n80/n203;
-      n369 = n1*n185*n214 + n164;
-      n370 = n165 + n185*n74/n205;
-      n371 = pow(n354, -n21);
-      n372 = pow(n355, -n21);
-      n373 = pow(n356, -n21);
-      n374 = pow(n357, -n21);
-      n375 = pow(n358, -n21);
-      n376 = pow(n359, -n21);
-      n377 = pow(n360, -n21);
-      n378 = pow(n361, -n21);
-      n379 = pow(n362, -n21);
-      n380 = pow(n363, -n21);
-      n381 = pow(n364, -n21);
-      n382 = pow(n365, -n21);
-      n383 = pow(n366, -n21);
-      n384 = pow(n367, -n21);
-      n385 = pow(n368, -n21);
-      n386 = pow(n369, -n21);
-      n387 = pow(n370, -n21);
-      n388 = pow(alpha, n188*n22)*n149*n184 + n149;
-      n389 = n354*xF[0];
-      n390 = n356*xF[11];
-      n391 = n365*xF[4];
-      n392 = n369*xF[8];
-      n393 = n1*n185*n21*n22/n189 + n1*n21*n22*n50;
-      n394 = n373*xF[11];
-      n395 = n382*xF[4];
-      n396 = n102*n144*n166*n331 + n102*n144;
-      n397 = n364*n94;
-      n398 = n355*n82;
-      n399 = n357/n271;
-      n400 = n363/n277;
-      n401 = n370/n284;
-      n402 = n358/n272;
-      n403 = n359/n273;
-      n404 = n360/n274;
-      n405 = n361/n275;
-      n406 = n387/n301;
-      n407 = n384/n298;
-      n408 = n377/n291;
-      n409 = n375/n289;
-      n410 = n376/n290;
-      n411 = n380/n294;
-      n412 = n374/n288;
-      n413 = n383/n297;
-      n414 = n378/n292;
-      n415 = n379/n293;
-      n416 = n393/n285;
-      n417 = n381*n94*xF[3]/n295;
-      n418 = n386*n99*xF[8]/n300;
-      n419 = n147*n371/n285;
-      n420 = n372*n82*xF[10]/n286;
-      n421 = n135*n388/n302;
-      n422 = n21*n22*n314*n50*n70*xF[0]*(pow(alpha, NP0*n0 + n187*n22)*n0*n1*n166/n177 + n149);
-      n423 = n129*n312*n48*n70*(pow(alpha, NP0*n0 - n187*n4)*n1*n166*n4/n177 + n150);
-      n424 = n48*n5*n54*n70*xF[11]*(pow(alpha, NP0*n0 - n187*n5)*n166*n73/n177 + n151)/n270;
-      n425 = n112*n48*n6*n70*(pow(alpha, NP0*n0 - n187*n6)*n166*n71/n177 + n152)/n271;
-      n426 = n143*n48*n70*xF[13]*(pow(alpha, NP0*n0 - n187*n7)*n166*n79/n177 + n153)/n272;
-      n427 = n128*n48*n70*xF[14]*(pow(alpha, NP0*n0 - n187*n8)*n1*n166*n8/n177 + n154)/n273;
-      n428 = n118*n48*n70*n9*(pow(alpha, NP0*n0 - n187*n9)*n166*n78/n177 + n155)/n274;
-      n429 = n138*n48*n70*xF[16]*(pow(alpha, NP0*n0 - n10*n187)*n1*n10*n166/n177 + n156)/n275;
-      n430 = n11*n117*n48*n70*(pow(alpha, NP0*n0 - n11*n187)*n1*n11*n166/n177 + n157)/n276;
-      n431 = n119*n12*n48*n70*(pow(alpha, NP0*n0 - n12*n187)*n166*n76/n177 + n158)/n277;
-      n432 = n121*n311*n48*n70*(pow(alpha, NP0*n0 - n13*n187)*n1*n13*n166/n177 + n159);
-      n433 = n126*n48*n70*xF[4]*(pow(alpha, NP0*n0 - n14*n187)*n166*n75/n177 + n160)/n279;
-      n434 = n15*n48*n64*n70*xF[5]*(pow(alpha, NP0*n0 - n15*n187)*n166*n72/n177 + n161)/n280;
-      n435 = n16*n48*n65*n70*xF[6]*(pow(alpha, NP0*n0 - n16*n187)*n166*n77/n177 + n162)/n281;
-      n436 = n113*n17*n48*n70*(pow(alpha, NP0*n0 - n17*n187)*n166*n80/n177 + n163)/n282;
-      n437 = n146*n48*n70*xF[8]*(pow(alpha, NP0*n0 - n18*n187)*n1*n166*n18/n177 + n164)/n283;
-      n438 = n115*n19*n48*n70*(pow(alpha, NP0*n0 - n187*n19)*n166*n74/n177 + n165)/n284;
-      n439 = 1.0*n149*n389*n70/n268;
-      n440 = n147*n396*n70/n268;
-      n441 = 0.5*n440;
-      n442 = pow(alpha, n0*n25)*n114*n228*n85/(n179*n84) + pow(alpha, n0*n25)*n210*n30*n31*n85/(n179*n84) + n114*n185*n228 + n174;
-      n443 = pow(alpha, n0*n25)*n114*n217*n85/(n179*n84) + pow(alpha, n0*n25)*n216*n30*n32*n85/(n179*n84) + n114*n185*n217 + n171;
-      n444 = pow(alpha, n0*n25)*n114*n226*n85/(n179*n84) + pow(alpha, n0*n25)*n142*n208*n85/(n179*n84) + n114*n185*n226 + n142*n55;
-      n445 = pow(alpha, n0*n25)*n22*n30*n7*n85/(n179*n193*n84) + pow(alpha, n0*n25)*n30*n34*n85/(n179*n193*n84) + n104*n30*n34 + n185*n22*n30*n7/n193;
-      n446 = pow(alpha, n0*n25)*n145*n85/(n179*n194*n84) + pow(alpha, n0*n25)*n212*n22*n30*n85/(n179*n84) + n105*n145 + n185*n212*n22*n30;
-      n447 = pow(alpha, n0*n25)*n114*n225*n85/(n179*n84) + pow(alpha, n0*n25)*n136*n213*n85/(n179*n84) + n114*n185*n225 + n136*n58;
-      n448 = pow(alpha, n0*n25)*n22*n233*n30*n85/(n179*n84) + pow(alpha, n0*n25)*n30*n37*n85/(n179*n196*n84) + n106*n30*n37 + n185*n22*n233*n30;
-      n449 = pow(alpha, n0*n25)*n137*n85/(n179*n198*n84) + pow(alpha, n0*n25)*n22*n222*n30*n85/(n179*n84) + n107*n137 + n185*n22*n222*n30;
-      n450 = pow(alpha, n0*n25)*n114*n211*n85/(n179*n84) + pow(alpha, n0*n25)*n223*n30*n40*n85/(n179*n84) + n114*n185*n211 + n176;
-      n451 = pow(alpha, n0*n25)*n16*n22*n30*n85/(n179*n202*n84) + pow(alpha, n0*n25)*n30*n43*n85/(n179*n202*n84) + n110*n30*n43 + n16*n185*n22*n30/n202;
-      n452 = pow(alpha, n0*n25)*n114*n231*n85/(n179*n84) + pow(alpha, n0*n25)*n221*n30*n46*n85/(n179*n84) + n114*n185*n231 + n30*n46*n68;
-      n453 = n134*n70*(pow(alpha, n0*n25 - n187*n7)*n22*n30*n7*n85/(n179*n84) + pow(alpha, n0*n25 - n187*n7)*n30*n34*n85/(n179*n84) + n104*n30*n34 + n185*n22*n30*n7/n193)/n272;
-      n454 = n131*n70*(pow(alpha, n0*n25 - n187*n8)*n145*n85/(n179*n84) + pow(alpha, n0*n25 - n187*n8)*n22*n30*n8*n85/(n179*n84) + n105*n145 + n185*n212*n22*n30)/n273;
-      n455 = n120*n70*(pow(alpha, n0*n25 - n10*n187)*n10*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n10*n187)*n30*n37*n85/(n179*n84) + n106*n30*n37 + n185*n22*n233*n30)/n275;
-      n456 = n132*n70*(pow(alpha, n0*n25 - n12*n187)*n12*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n12*n187)*n137*n85/(n179*n84) + n107*n137 + n185*n22*n222*n30)/n277;
-      n457 = n328*n70*(pow(alpha, n0*n25 - n14*n187)*n14*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n14*n187)*n30*n41*n85/(n179*n84) + n108*n30*n41 + n185*n218*n22*n30);
-      n458 = n130*n70*(pow(alpha, n0*n25 - n16*n187)*n16*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n16*n187)*n30*n43*n85/(n179*n84) + n110*n30*n43 + n16*n185*n22*n30/n202)/n281;
-      n459 = n111*n312*n82*(pow(alpha, n0*n25 - n187*n4)*n114*n4*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n4)*n30*n31*n85/(n179*n84) + n114*n185*n228 + n174);
-      n460 = n111*n322*xF[11]*(pow(alpha, n0*n25 - n187*n5)*n114*n5*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n5)*n30*n32*n85/(n179*n84) + n114*n185*n217 + n171);
-      n461 = n111*n123*(pow(alpha, n0*n25 - n187*n6)*n114*n6*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n6)*n142*n85/(n179*n84) + n114*n185*n226 + n142*n55)/n271;
-      n462 = n111*n122*(pow(alpha, n0*n25 - n187*n9)*n114*n85*n9/(n179*n84) - pow(alpha, n0*n25 - n187*n9)*n136*n85/(n179*n84) + n114*n185*n225 + n136*n58)/n274;
-      n463 = n111*n327*(pow(alpha, n0*n25 - n11*n187)*n11*n114*n85/(n179*n84) - pow(alpha, n0*n25 - n11*n187)*n139*n85/(n179*n84) + n114*n185*n220 + n139*n60);
-      n464 = n111*n311*n94*(pow(alpha, n0*n25 - n13*n187)*n114*n13*n85/(n179*n84) - pow(alpha, n0*n25 - n13*n187)*n30*n40*n85/(n179*n84) + n114*n185*n211 + n176);
-      n465 = n111*n325*(pow(alpha, n0*n25 - n15*n187)*n114*n15*n85/(n179*n84) - pow(alpha, n0*n25 - n15*n187)*n125*n85/(n179*n84) + n114*n185*n230 + n125*n64);
-      n466 = n111*n329*(pow(alpha, n0*n25 - n17*n187)*n114*n17*n85/(n179*n84) - pow(alpha, n0*n25 - n17*n187)*n30*n44*n85/(n179*n84) + n114*n185*n207 + n30*n44*n66);
-      n467 = n111*n330*(pow(alpha, n0*n25 - n18*n187)*n114*n18*n85/(n179*n84) - pow(alpha, n0*n25 - n18*n187)*n30*n45*n85/(n179*n84) + n114*n185*n214 + n172);
-      n468 = n111*n127*(pow(alpha, n0*n25 - n187*n19)*n114*n19*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n19)*n30*n46*n85/(n179*n84) + n114*n185*n231 + n30*n46*n68)/n284;
-      n469 = n335 + n336 + n337 + n338 + n339 + n340 + n341 + n342 + n343 + n344 + n345 + n346 + n347 + n348 + n349 + n350 + n351 + n422 + n423 + n424 + n425 + n426 + n427 + n428 + n429 + n430 + n431 + n432 + n433 + n434 + n435 + n436 + n437 + n438 + n440 + n453 + n454 + n455 + n456 + n457 + n458 + n459 + n460 + n461 + n462 + n463 + n464 + n465 + n466 + n467 + n468;
-      n470 = n111*n120*n361*(n138*n48 + n185*n233*n48)/n292 + n111*n122*n360*(n185*n225*n48 + n48*n58*n9)/n291 + n111*n123*n357*(n185*n226*n48 + n48*n55*n6)/n288 + n111*n127*n370*(n185*n231*n48 + n19*n48*n68)/n301 + n111*n130*n367*(n16*n185*n48/n202 + n16*n48*n65)/n298 + n111*n131*n359*(n128*n48 + n185*n212*n48)/n290 + n111*n132*n363*(n12*n48*n61 + n185*n222*n48)/n294 + n111*n133*n366*(n15*n48*n64 + n185*n230*n48)/n297 + n111*n134*n358*(n143*n48 + n185*n48*n7/n193)/n289 + n111*n140*n362*(n141*n48 + n185*n220*n48)/n293 + n111*n147*n354*n416 + n111*n321*n390*(n185*n217*n48 + n48*n5*n54) + n111*n323*n391*(n126*n48 + n185*n218*n48) + n111*n326*n368*(n17*n48*n66 + n185*n207*n48) + n111*n392*n99*(n146*n48 + n185*n214*n48)/n300 + n111*n397*xF[3]*(n121*n48 + n185*n211*n48)/n295 + n111*n398*xF[10]*(n129*n48 + n185*n228*n48)/n286 + n469;
-      n471 = n470*xTj;
-      NP_b = -n147*n149*n353*n70/n268 - n25*(0.5*n147*n70*(pow(alpha, NP0*n0 - n0*n187)*n144*(-n23 + xPj*xTj)/(n177*n51) + n102*n144)/n268 + 1.0*n149*n70*xF[0]*(pow(alpha, NP0*n0 - n0*n187)*n0*n1*n166/n177 + n149)/n268 + n352 - 1.0*n419*n70 - 0.5*xTj*(n111*n122*(pow(alpha, NP0*n0 - n187*n9)*n114*n166*n9/n177 + pow(alpha, n0*n25 - n187*n9)*n114*n85*n9/(n179*n84) - pow(alpha, n0*n25 - n187*n9)*n136*n85/(n179*n84) + n136*n58)/n274 + n111*n123*(pow(alpha, NP0*n0 - n187*n6)*n114*n166*n6/n177 + pow(alpha, n0*n25 - n187*n6)*n114*n6*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n6)*n142*n85/(n179*n84) + n142*n55)/n271 + n111*n127*(pow(alpha, NP0*n0 - n187*n19)*n114*n166*n19/n177 + pow(alpha, n0*n25 - n187*n19)*n114*n19*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n19)*n30*n46*n85/(n179*n84) + n30*n46*n68)/n284 + n111*n311*n94*(pow(alpha, NP0*n0 - n13*n187)*n114*n13*n166/n177 + pow(alpha, n0*n25 - n13*n187)*n114*n13*n85/(n179*n84) - pow(alpha, n0*n25 - n13*n187)*n30*n40*n85/(n179*n84) + n176) + n111*n312*n82*(pow(alpha, NP0*n0 - n187*n4)*n114*n166*n4/n177 + pow(alpha, n0*n25 - n187*n4)*n114*n4*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n4)*n30*n31*n85/(n179*n84) + n174) + n111*n322*xF[11]*(pow(alpha, NP0*n0 - n187*n5)*n114*n166*n5/n177 + pow(alpha, n0*n25 - n187*n5)*n114*n5*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n5)*n30*n32*n85/(n179*n84) + n171) + n111*n325*(pow(alpha, NP0*n0 - n15*n187)*n114*n15*n166/n177 + pow(alpha, n0*n25 - n15*n187)*n114*n15*n85/(n179*n84) - pow(alpha, n0*n25 - n15*n187)*n125*n85/(n179*n84) + n125*n64) + n111*n327*(pow(alpha, NP0*n0 - n11*n187)*n11*n114*n166/n177 + pow(alpha, n0*n25 - n11*n187)*n11*n114*n85/(n179*n84) - pow(alpha, n0*n25 - n11*n187)*n139*n85/(n179*n84) + n139*n60) + n111*n329*(pow(alpha, NP0*n0 - n17*n187)*n114*n166*n17/n177 + pow(alpha, n0*n25 - n17*n187)*n114*n17*n85/(n179*n84) - pow(alpha, n0*n25 - n17*n187)*n30*n44*n85/(n179*n84) + n30*n44*n66) + n111*n330*(pow(alpha, NP0*n0 - n18*n187)*n114*n166*n18/n177 + pow(alpha, n0*n25 - n18*n187)*n114*n18*n85/(n179*n84) - pow(alpha, n0*n25 - n18*n187)*n30*n45*n85/(n179*n84) + n172) + n120*n21*n414*n70 + n120*n70*(pow(alpha, NP0*n0 - n10*n187)*n10*n166*n22*n30/n177 + pow(alpha, n0*n25 - n10*n187)*n10*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n10*n187)*n30*n37*n85/(n179*n84) + n106*n30*n37)/n275 + n122*n21*n408*n70 + n123*n21*n412*n70 + n127*n21*n406*n70 + n130*n21*n407*n70 + n130*n70*(pow(alpha, NP0*n0 - n16*n187)*n16*n166*n22*n30/n177 + pow(alpha, n0*n25 - n16*n187)*n16*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n16*n187)*n30*n43*n85/(n179*n84) + n110*n30*n43)/n281 + n131*n21*n410*n70 + n131*n70*(pow(alpha, NP0*n0 - n187*n8)*n166*n22*n30*n8/n177 + pow(alpha, n0*n25 - n187*n8)*n145*n85/(n179*n84) + pow(alpha, n0*n25 - n187*n8)*n22*n30*n8*n85/(n179*n84) + n105*n145)/n273 + n132*n21*n411*n70 + n132*n70*(pow(alpha, NP0*n0 - n12*n187)*n12*n166*n22*n30/n177 + pow(alpha, n0*n25 - n12*n187)*n12*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n12*n187)*n137*n85/(n179*n84) + n107*n137)/n277 + n133*n21*n413*n70 + n134*n21*n409*n70 + n134*n70*(pow(alpha, NP0*n0 - n187*n7)*n166*n22*n30*n7/n177 + pow(alpha, n0*n25 - n187*n7)*n22*n30*n7*n85/(n179*n84) + pow(alpha, n0*n25 - n187*n7)*n30*n34*n85/(n179*n84) + n104*n30*n34)/n272 + n140*n21*n415*n70 + n147*n70*(pow(alpha, NP0*n0 - n0*n187)*n144*(-n23 + xPj*xTj)/(n177*n51) + n102*n144)/n268 + n21*n321*n394*n70 + n21*n323*n395*n70 + n21*n326*n385*n70 + n21*n417*n70 + n21*n418*n70 + n21*n419*n70 + n21*n420*n70 + n328*n70*(pow(alpha, NP0*n0 - n14*n187)*n14*n166*n22*n30/n177 + pow(alpha, n0*n25 - n14*n187)*n14*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n14*n187)*n30*n41*n85/(n179*n84) + n108*n30*n41) + n335 + n336 + n337 + n338 + n339 + n340 + n341 + n342 + n343 + n344 + n345 + n346 + n347 + n348 + n349 + n350 + n351 + n422 + n423 + n424 + n425 + n426 + n427 + n428 + n429 + n430 + n431 + n432 + n433 + n434 + n435 + n436 + n437 + n438)) - n334 - n70*xTj*(n112*n71/n237 + n113*n80/n248 + n115*n74/n250 - n120*n405 - n122*n404 - n123*n399 + n126*n49/n245 - n127*n401 - n130*n367/n281 - n131*n403 - n132*n400 - n134*n402 - n147*n354/n268 + n149*n304 + n150*n305 + n151*n303 + n154*xF[14]/n239 + n156*n308 + n159*n310 + n161*xF[5]/n246 + n162*n309 + n164*n307 + n167/n242 + n168/n238 - n311*n397 - n312*n398 + n317*n76 + n318*n78 - n322*n390 - n325*n366 - n327*n362 - n328*n365 - n329*n368 - n330*n369);
-      NP_2a = -n70*(-pow(alpha, n0*n25)*n144*n147*n21*pow(n353, -n21)/n285 - 2.0*pow(alpha, n0*n25)*n144*n353*xF[0]/n268 + n102*n144*n147*(n331*(-n23 + xPj*xTj)/n51 - 1)/n268 - 1.0*n169*n304 + 1.0*xTj*(n11*n117*n48*(pow(alpha, NP0*n0 - n11*n187)*n1*n11*n166/n177 + n157)/n276 + n112*n142/n237 + n112*n48*n6*(pow(alpha, NP0*n0 - n187*n6)*n166*n71/n177 + n152)/n271 + n113*n17*n48*(pow(alpha, NP0*n0 - n17*n187)*n166*n80/n177 + n163)/n282 + n113*n320 + n115*n19*n48*(pow(alpha, NP0*n0 - n187*n19)*n166*n74/n177 + n165)/n284 + n117*n139/n242 + n118*n48*n9*(pow(alpha, NP0*n0 - n187*n9)*n166*n78/n177 + n155)/n274 + n119*n12*n48*(pow(alpha, NP0*n0 - n12*n187)*n166*n76/n177 + n158)/n277 + n120*n21*n414 + n120*(pow(alpha, n0*n25 - n10*n187)*n10*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n10*n187)*n30*n37*n85/(n179*n84) + n106*n30*n37 + n185*n22*n233*n30)/n275 + n121*n311*n48*(pow(alpha, NP0*n0 - n13*n187)*n1*n13*n166/n177 + n159) + n122*n21*n408 - n122*(pow(alpha, n0*n25 - n187*n9)*n114*n85*n9/(n179*n84) - pow(alpha, n0*n25 - n187*n9)*n136*n85/(n179*n84) + n114*n185*n225 + n136*n58)/n274 + n123*n21*n412 - n123*(pow(alpha, n0*n25 - n187*n6)*n114*n6*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n6)*n142*n85/(n179*n84) + n114*n185*n226 + n142*n55)/n271 + n125*n316 + n126*n48*xF[4]*(pow(alpha, NP0*n0 - n14*n187)*n166*n75/n177 + n160)/n279 + n127*n21*n406 - n127*(pow(alpha, n0*n25 - n187*n19)*n114*n19*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n19)*n30*n46*n85/(n179*n84) + n114*n185*n231 + n30*n46*n68)/n284 + n128*n48*xF[14]*(pow(alpha, NP0*n0 - n187*n8)*n1*n166*n8/n177 + n154)/n273 + n129*n312*n48*(pow(alpha, NP0*n0 - n187*n4)*n1*n166*n4/n177 + n150) + n130*n21*n407 + n130*(pow(alpha, n0*n25 - n16*n187)*n16*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n16*n187)*n30*n43*n85/(n179*n84) + n110*n30*n43 + n16*n185*n22*n30/n202)/n281 + n131*n21*n410 + n131*(pow(alpha, n0*n25 - n187*n8)*n145*n85/(n179*n84) + pow(alpha, n0*n25 - n187*n8)*n22*n30*n8*n85/(n179*n84) + n105*n145 + n185*n212*n22*n30)/n273 + n132*n21*n411 + n132*(pow(alpha, n0*n25 - n12*n187)*n12*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n12*n187)*n137*n85/(n179*n84) + n107*n137 + n185*n22*n222*n30)/n277 + n133*n21*n413 + n134*n21*n409 + n134*(pow(alpha, n0*n25 - n187*n7)*n22*n30*n7*n85/(n179*n84) + pow(alpha, n0*n25 - n187*n7)*n30*n34*n85/(n179*n84) + n104*n30*n34 + n185*n22*n30*n7/n193)/n272 + n136*n318 + n137*n317 + n138*n48*xF[16]*(pow(alpha, NP0*n0 - n10*n187)*n1*n10*n166/n177 + n156)/n275 + n140*n21*n415 + n143*n48*xF[13]*(pow(alpha, NP0*n0 - n187*n7)*n166*n79/n177 + n153)/n272 + n145*n319 + n146*n48*xF[8]*(pow(alpha, NP0*n0 - n18*n187)*n1*n166*n18/n177 + n164)/n283 + n147*n396/n268 + n15*n48*n64*xF[5]*(pow(alpha, NP0*n0 - n15*n187)*n166*n72/n177 + n161)/n280 + n16*n48*n65*xF[6]*(pow(alpha, NP0*n0 - n16*n187)*n166*n77/n177 + n162)/n281 + n169*n304 + n170*n306 + n171*n303 + n172*n307 + n173*n308 + n174*n305 + n175*n309 + n176*n310 + n21*n22*n314*n50*xF[0]*(pow(alpha, NP0*n0 + n187*n22)*n0*n1*n166/n177 + n149) + n21*n321*n394 + n21*n323*n395 + n21*n326*n385 + n21*n417 + n21*n418 + n21*n419 + n21*n420 - n311*n94*(pow(alpha, n0*n25 - n13*n187)*n114*n13*n85/(n179*n84) - pow(alpha, n0*n25 - n13*n187)*n30*n40*n85/(n179*n84) + n114*n185*n211 + n176) - n312*n82*(pow(alpha, n0*n25 - n187*n4)*n114*n4*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n4)*n30*n31*n85/(n179*n84) + n114*n185*n228 + n174) - n322*xF[11]*(pow(alpha, n0*n25 - n187*n5)*n114*n5*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n5)*n30*n32*n85/(n179*n84) + n114*n185*n217 + n171) - n325*(pow(alpha, n0*n25 - n15*n187)*n114*n15*n85/(n179*n84) - pow(alpha, n0*n25 - n15*n187)*n125*n85/(n179*n84) + n114*n185*n230 + n125*n64) - n327*(pow(alpha, n0*n25 - n11*n187)*n11*n114*n85/(n179*n84) - pow(alpha, n0*n25 - n11*n187)*n139*n85/(n179*n84) + n114*n185*n220 + n139*n60) + n328*(pow(alpha, n0*n25 - n14*n187)*n14*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n14*n187)*n30*n41*n85/(n179*n84) + n108*n30*n41 + n185*n218*n22*n30) - n329*(pow(alpha, n0*n25 - n17*n187)*n114*n17*n85/(n179*n84) - pow(alpha, n0*n25 - n17*n187)*n30*n44*n85/(n179*n84) + n114*n185*n207 + n30*n44*n66) - n330*(pow(alpha, n0*n25 - n18*n187)*n114*n18*n85/(n179*n84) - pow(alpha, n0*n25 - n18*n187)*n30*n45*n85/(n179*n84) + n114*n185*n214 + n172) + n332 + n333 + n48*n5*n54*xF[11]*(pow(alpha, NP0*n0 - n187*n5)*n166*n73/n177 + n151)/n270));
-      NP_sqrt_base = (-NP0*(n22*n315*n50*n70 + n421*n70 + xTj*(n100*n111*pow(n267, n21)*xF[9]*(n165 + pow(alpha, -n188*n19)*n186*n74) + n111*pow(n252, n21)*n82*xF[10]*(n150 + pow(alpha, -n188*n4)*n166*n183*n4) + n111*pow(n253, n21)*n86*xF[11]*(n151 + pow(alpha, -n188*n5)*n186*n73) + n111*pow(n254, n21)*n87*xF[12]*(n152 + pow(alpha, -n188*n6)*n186*n71) + n111*pow(n255, n21)*n88*xF[13]*(n153 + pow(alpha, -n188*n7)*n186*n79) + n111*pow(n256, n21)*n89*xF[14]*(n154 + pow(alpha, -n188*n8)*n166*n183*n8) + n111*pow(n257, n21)*n90*xF[15]*(n155 + pow(alpha, -n188*n9)*n186*n78) + n111*pow(n258, n21)*n91*xF[16]*(n156 + pow(alpha, -n10*n188)*n10*n166*n183) + n111*pow(n259, n21)*n92*xF[1]*(n157 + pow(alpha, -n11*n188)*n11*n166*n183) + n111*pow(n260, n21)*n93*xF[2]*(n158 + pow(alpha, -n12*n188)*n186*n76) + n111*pow(n261, n21)*n94*xF[3]*(n159 + pow(alpha, -n13*n188)*n13*n166*n183) + n111*pow(n262, n21)*n95*xF[4]*(n160 + pow(alpha, -n14*n188)*n186*n75) + n111*pow(n263, n21)*n96*xF[5]*(n161 + pow(alpha, -n15*n188)*n186*n72) + n111*pow(n264, n21)*n97*xF[6]*(n162 + pow(alpha, -n16*n188)*n186*n77) + n111*pow(n265, n21)*n98*xF[7]*(n163 + pow(alpha, -n17*n188)*n186*n80) + n111*pow(n266, n21)*n99*xF[8]*(n164 + pow(alpha, -n18*n188)*n166*n18*n183) + n111*n421 + n112*n70*n71/n254 + n113*n70*n80/n265 + n115*n70*n74/n267 + n118*n70*n78/n257 + n119*n70*n76/n260 + n126*n49*n70/n262 + n149*n313*n70 + n150*n70*xF[10]/n252 + n151*n70*xF[11]/n253 + n154*n70*xF[14]/n256 + n156*n70*xF[16]/n258 + n159*n70*xF[3]/n261 + n161*n70*xF[5]/n263 + n162*n70*xF[6]/n264 + n164*n70*xF[8]/n266 + n167*n70/n259 + n168*n70/n255)) - n111*n135/n251 - n26*(-n120*n70/(n91 - 1 + pow(alpha, -n10*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n122*n70/(n90 - 1 + pow(alpha, -n9*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n123*n70/(n87 - 1 + pow(alpha, -n6*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n127*n70/(n100 - 1 + pow(alpha, -n19*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n130*n70/(n97 - 1 + pow(alpha, -n16*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n131*n70/(n89 - 1 + pow(alpha, -n8*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n132*n70/(n93 - 1 + pow(alpha, -n12*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n133*n70/(n96 - 1 + pow(alpha, -n15*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n134*n70/(n88 - 1 + pow(alpha, -n7*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n140*n70/(n92 - 1 + pow(alpha, -n11*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n147*n70/(pow(alpha, n22*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1)) + n81 - 1) - n70*n82*xF[10]/(n82 - 1 + pow(alpha, -n4*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n70*n86*xF[11]/(n86 - 1 + pow(alpha, -n5*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n70*n94*xF[3]/(n94 - 1 + pow(alpha, -n13*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n70*n95*xF[4]/(n95 - 1 + pow(alpha, -n14*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n70*n98*xF[7]/(n98 - 1 + pow(alpha, -n17*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1))) - n70*n99*xF[8]/(n99 - 1 + pow(alpha, -n18*(n116*(n180 - log(n102*(n23 + n27*xTj)/(n23 - xF[0]*xTj) + 1)) + 1)))) - pow(NP0, -n21)*(-0.5*n147*n354*n416*n70 + 1.0*n149*n389*n70/n268 + 0.5*n335 + 0.5*n440 - 0.5*n471))*(4.0*n149*n389*n70/n268 - n21*n26*(n111*n120*(pow(alpha, NP0*n0 - n10*n187)*n1*n10*n166/n177 + n156)*(pow(alpha, NP0*n0 - n10*n187)*n10*n166*n48/n177 + n138*n48)/n292 + n111*n122*(pow(alpha, NP0*n0 - n187*n9)*n166*n78/n177 + n155)*(pow(alpha, NP0*n0 - n187*n9)*n166*n48*n9/n177 + n48*n58*n9)/n291 + n111*n122*(pow(alpha, NP0*n0 - n187*n9)*n114*n166*n9/n177 + pow(alpha, n0*n25 - n187*n9)*n114*n85*n9/(n179*n84) - pow(alpha, n0*n25 - n187*n9)*n136*n85/(n179*n84) + n136*n58)/n274 + n111*n123*(pow(alpha, NP0*n0 - n187*n6)*n166*n71/n177 + n152)*(pow(alpha, NP0*n0 - n187*n6)*n166*n48*n6/n177 + n48*n55*n6)/n288 + n111*n123*(pow(alpha, NP0*n0 - n187*n6)*n114*n166*n6/n177 + pow(alpha, n0*n25 - n187*n6)*n114*n6*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n6)*n142*n85/(n179*n84) + n142*n55)/n271 + n111*n127*(pow(alpha, NP0*n0 - n187*n19)*n166*n74/n177 + n165)*(pow(alpha, NP0*n0 - n187*n19)*n166*n19*n48/n177 + n19*n48*n68)/n301 + n111*n127*(pow(alpha, NP0*n0 - n187*n19)*n114*n166*n19/n177 + pow(alpha, n0*n25 - n187*n19)*n114*n19*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n19)*n30*n46*n85/(n179*n84) + n30*n46*n68)/n284 + n111*n130*(pow(alpha, NP0*n0 - n16*n187)*n166*n77/n177 + n162)*(pow(alpha, NP0*n0 - n16*n187)*n16*n166*n48/n177 + n16*n48*n65)/n298 + n111*n131*(pow(alpha, NP0*n0 - n187*n8)*n1*n166*n8/n177 + n154)*(pow(alpha, NP0*n0 - n187*n8)*n166*n48*n8/n177 + n128*n48)/n290 + n111*n132*(pow(alpha, NP0*n0 - n12*n187)*n166*n76/n177 + n158)*(pow(alpha, NP0*n0 - n12*n187)*n12*n166*n48/n177 + n12*n48*n61)/n294 + n111*n133*(pow(alpha, NP0*n0 - n15*n187)*n166*n72/n177 + n161)*(pow(alpha, NP0*n0 - n15*n187)*n15*n166*n48/n177 + n15*n48*n64)/n297 + n111*n134*(pow(alpha, NP0*n0 - n187*n7)*n166*n79/n177 + n153)*(pow(alpha, NP0*n0 - n187*n7)*n166*n48*n7/n177 + n143*n48)/n289 + n111*n140*(pow(alpha, NP0*n0 - n11*n187)*n1*n11*n166/n177 + n157)*(pow(alpha, NP0*n0 - n11*n187)*n11*n166*n48/n177 + n141*n48)/n293 + n111*n147*(pow(alpha, NP0*n0 - n0*n187)*n0*n1*n166/n177 + n149)*(pow(alpha, NP0*n0 - n0*n187)*n1*n166*n21*n22/n177 + n1*n21*n22*n50)/n285 + n111*n311*n94*(pow(alpha, NP0*n0 - n13*n187)*n114*n13*n166/n177 + pow(alpha, n0*n25 - n13*n187)*n114*n13*n85/(n179*n84) - pow(alpha, n0*n25 - n13*n187)*n30*n40*n85/(n179*n84) + n176) + n111*n312*n82*(pow(alpha, NP0*n0 - n187*n4)*n114*n166*n4/n177 + pow(alpha, n0*n25 - n187*n4)*n114*n4*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n4)*n30*n31*n85/(n179*n84) + n174) + n111*n321*xF[11]*(pow(alpha, NP0*n0 - n187*n5)*n166*n73/n177 + n151)*(pow(alpha, NP0*n0 - n187*n5)*n166*n48*n5/n177 + n48*n5*n54) + n111*n322*xF[11]*(pow(alpha, NP0*n0 - n187*n5)*n114*n166*n5/n177 + pow(alpha, n0*n25 - n187*n5)*n114*n5*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n5)*n30*n32*n85/(n179*n84) + n171) + n111*n323*xF[4]*(pow(alpha, NP0*n0 - n14*n187)*n166*n75/n177 + n160)*(pow(alpha, NP0*n0 - n14*n187)*n14*n166*n48/n177 + n126*n48) + n111*n325*(pow(alpha, NP0*n0 - n15*n187)*n114*n15*n166/n177 + pow(alpha, n0*n25 - n15*n187)*n114*n15*n85/(n179*n84) - pow(alpha, n0*n25 - n15*n187)*n125*n85/(n179*n84) + n125*n64) + n111*n326*(pow(alpha, NP0*n0 - n17*n187)*n166*n80/n177 + n163)*(pow(alpha, NP0*n0 - n17*n187)*n166*n17*n48/n177 + n17*n48*n66) + n111*n327*(pow(alpha, NP0*n0 - n11*n187)*n11*n114*n166/n177 + pow(alpha, n0*n25 - n11*n187)*n11*n114*n85/(n179*n84) - pow(alpha, n0*n25 - n11*n187)*n139*n85/(n179*n84) + n139*n60) + n111*n329*(pow(alpha, NP0*n0 - n17*n187)*n114*n166*n17/n177 + pow(alpha, n0*n25 - n17*n187)*n114*n17*n85/(n179*n84) - pow(alpha, n0*n25 - n17*n187)*n30*n44*n85/(n179*n84) + n30*n44*n66) + n111*n330*(pow(alpha, NP0*n0 - n18*n187)*n114*n166*n18/n177 + pow(alpha, n0*n25 - n18*n187)*n114*n18*n85/(n179*n84) - pow(alpha, n0*n25 - n18*n187)*n30*n45*n85/(n179*n84) + n172) + n111*n99*xF[8]*(pow(alpha, NP0*n0 - n18*n187)*n1*n166*n18/n177 + n164)*(pow(alpha, NP0*n0 - n18*n187)*n166*n18*n48/n177 + n146*n48)/n300 + n111*n94*xF[3]*(pow(alpha, NP0*n0 - n13*n187)*n1*n13*n166/n177 + n159)*(pow(alpha, NP0*n0 - n13*n187)*n13*n166*n48/n177 + n121*n48)/n295 + n111*n82*xF[10]*(pow(alpha, NP0*n0 - n187*n4)*n1*n166*n4/n177 + n150)*(pow(alpha, NP0*n0 - n187*n4)*n166*n4*n48/n177 + n129*n48)/n286 + n120*n70*(pow(alpha, NP0*n0 - n10*n187)*n10*n166*n22*n30/n177 + pow(alpha, n0*n25 - n10*n187)*n10*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n10*n187)*n30*n37*n85/(n179*n84) + n106*n30*n37)/n275 + n130*n70*(pow(alpha, NP0*n0 - n16*n187)*n16*n166*n22*n30/n177 + pow(alpha, n0*n25 - n16*n187)*n16*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n16*n187)*n30*n43*n85/(n179*n84) + n110*n30*n43)/n281 + n131*n70*(pow(alpha, NP0*n0 - n187*n8)*n166*n22*n30*n8/n177 + pow(alpha, n0*n25 - n187*n8)*n145*n85/(n179*n84) + pow(alpha, n0*n25 - n187*n8)*n22*n30*n8*n85/(n179*n84) + n105*n145)/n273 + n132*n70*(pow(alpha, NP0*n0 - n12*n187)*n12*n166*n22*n30/n177 + pow(alpha, n0*n25 - n12*n187)*n12*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n12*n187)*n137*n85/(n179*n84) + n107*n137)/n277 + n134*n70*(pow(alpha, NP0*n0 - n187*n7)*n166*n22*n30*n7/n177 + pow(alpha, n0*n25 - n187*n7)*n22*n30*n7*n85/(n179*n84) + pow(alpha, n0*n25 - n187*n7)*n30*n34*n85/(n179*n84) + n104*n30*n34)/n272 + n147*n70*(pow(alpha, NP0*n0 - n0*n187)*n144*(-n23 + xPj*xTj)/(n177*n51) + n102*n144)/n268 + n328*n70*(pow(alpha, NP0*n0 - n14*n187)*n14*n166*n22*n30/n177 + pow(alpha, n0*n25 - n14*n187)*n14*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n14*n187)*n30*n41*n85/(n179*n84) + n108*n30*n41) + n335 + n336 + n337 + n338 + n339 + n340 + n341 + n342 + n343 + n344 + n345 + n346 + n347 + n348 + n349 + n350 + n351 + n422 + n423 + n424 + n425 + n426 + n427 + n428 + n429 + n430 + n431 + n432 + n433 + n434 + n435 + n436 + n437 + n438) + 2.0*n335 - 4.0*n419*n70 + 2.0*n440) + pow(-n147*n354*n70/n268 - n25*(-0.5*n147*n70*(pow(alpha, NP0*n0 - n0*n187)*n0*n1*n166/n177 + n149)*(pow(alpha, NP0*n0 - n0*n187)*n1*n166*n21*n22/n177 + n1*n21*n22*n50)/n285 + 0.5*n147*n70*(pow(alpha, NP0*n0 - n0*n187)*n144*(-n23 + xPj*xTj)/(n177*n51) + n102*n144)/n268 + 1.0*n149*n70*xF[0]*(pow(alpha, NP0*n0 - n0*n187)*n0*n1*n166/n177 + n149)/n268 + n352 - 0.5*xTj*(n111*n120*(pow(alpha, NP0*n0 - n10*n187)*n1*n10*n166/n177 + n156)*(pow(alpha, NP0*n0 - n10*n187)*n10*n166*n48/n177 + n138*n48)/n292 + n111*n122*(pow(alpha, NP0*n0 - n187*n9)*n166*n78/n177 + n155)*(pow(alpha, NP0*n0 - n187*n9)*n166*n48*n9/n177 + n48*n58*n9)/n291 + n111*n122*(pow(alpha, NP0*n0 - n187*n9)*n114*n166*n9/n177 + pow(alpha, n0*n25 - n187*n9)*n114*n85*n9/(n179*n84) - pow(alpha, n0*n25 - n187*n9)*n136*n85/(n179*n84) + n136*n58)/n274 + n111*n123*(pow(alpha, NP0*n0 - n187*n6)*n166*n71/n177 + n152)*(pow(alpha, NP0*n0 - n187*n6)*n166*n48*n6/n177 + n48*n55*n6)/n288 + n111*n123*(pow(alpha, NP0*n0 - n187*n6)*n114*n166*n6/n177 + pow(alpha, n0*n25 - n187*n6)*n114*n6*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n6)*n142*n85/(n179*n84) + n142*n55)/n271 + n111*n127*(pow(alpha, NP0*n0 - n187*n19)*n166*n74/n177 + n165)*(pow(alpha, NP0*n0 - n187*n19)*n166*n19*n48/n177 + n19*n48*n68)/n301 + n111*n127*(pow(alpha, NP0*n0 - n187*n19)*n114*n166*n19/n177 + pow(alpha, n0*n25 - n187*n19)*n114*n19*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n19)*n30*n46*n85/(n179*n84) + n30*n46*n68)/n284 + n111*n130*(pow(alpha, NP0*n0 - n16*n187)*n166*n77/n177 + n162)*(pow(alpha, NP0*n0 - n16*n187)*n16*n166*n48/n177 + n16*n48*n65)/n298 + n111*n131*(pow(alpha, NP0*n0 - n187*n8)*n1*n166*n8/n177 + n154)*(pow(alpha, NP0*n0 - n187*n8)*n166*n48*n8/n177 + n128*n48)/n290 + n111*n132*(pow(alpha, NP0*n0 - n12*n187)*n166*n76/n177 + n158)*(pow(alpha, NP0*n0 - n12*n187)*n12*n166*n48/n177 + n12*n48*n61)/n294 + n111*n133*(pow(alpha, NP0*n0 - n15*n187)*n166*n72/n177 + n161)*(pow(alpha, NP0*n0 - n15*n187)*n15*n166*n48/n177 + n15*n48*n64)/n297 + n111*n134*(pow(alpha, NP0*n0 - n187*n7)*n166*n79/n177 + n153)*(pow(alpha, NP0*n0 - n187*n7)*n166*n48*n7/n177 + n143*n48)/n289 + n111*n140*(pow(alpha, NP0*n0 - n11*n187)*n1*n11*n166/n177 + n157)*(pow(alpha, NP0*n0 - n11*n187)*n11*n166*n48/n177 + n141*n48)/n293 + n111*n147*(pow(alpha, NP0*n0 - n0*n187)*n0*n1*n166/n177 + n149)*(pow(alpha, NP0*n0 - n0*n187)*n1*n166*n21*n22/n177 + n1*n21*n22*n50)/n285 + n111*n311*n94*(pow(alpha, NP0*n0 - n13*n187)*n114*n13*n166/n177 + pow(alpha, n0*n25 - n13*n187)*n114*n13*n85/(n179*n84) - pow(alpha, n0*n25 - n13*n187)*n30*n40*n85/(n179*n84) + n176) + n111*n312*n82*(pow(alpha, NP0*n0 - n187*n4)*n114*n166*n4/n177 + pow(alpha, n0*n25 - n187*n4)*n114*n4*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n4)*n30*n31*n85/(n179*n84) + n174) + n111*n321*xF[11]*(pow(alpha, NP0*n0 - n187*n5)*n166*n73/n177 + n151)*(pow(alpha, NP0*n0 - n187*n5)*n166*n48*n5/n177 + n48*n5*n54) + n111*n322*xF[11]*(pow(alpha, NP0*n0 - n187*n5)*n114*n166*n5/n177 + pow(alpha, n0*n25 - n187*n5)*n114*n5*n85/(n179*n84) - pow(alpha, n0*n25 - n187*n5)*n30*n32*n85/(n179*n84) + n171) + n111*n323*xF[4]*(pow(alpha, NP0*n0 - n14*n187)*n166*n75/n177 + n160)*(pow(alpha, NP0*n0 - n14*n187)*n14*n166*n48/n177 + n126*n48) + n111*n325*(pow(alpha, NP0*n0 - n15*n187)*n114*n15*n166/n177 + pow(alpha, n0*n25 - n15*n187)*n114*n15*n85/(n179*n84) - pow(alpha, n0*n25 - n15*n187)*n125*n85/(n179*n84) + n125*n64) + n111*n326*(pow(alpha, NP0*n0 - n17*n187)*n166*n80/n177 + n163)*(pow(alpha, NP0*n0 - n17*n187)*n166*n17*n48/n177 + n17*n48*n66) + n111*n327*(pow(alpha, NP0*n0 - n11*n187)*n11*n114*n166/n177 + pow(alpha, n0*n25 - n11*n187)*n11*n114*n85/(n179*n84) - pow(alpha, n0*n25 - n11*n187)*n139*n85/(n179*n84) + n139*n60) + n111*n329*(pow(alpha, NP0*n0 - n17*n187)*n114*n166*n17/n177 + pow(alpha, n0*n25 - n17*n187)*n114*n17*n85/(n179*n84) - pow(alpha, n0*n25 - n17*n187)*n30*n44*n85/(n179*n84) + n30*n44*n66) + n111*n330*(pow(alpha, NP0*n0 - n18*n187)*n114*n166*n18/n177 + pow(alpha, n0*n25 - n18*n187)*n114*n18*n85/(n179*n84) - pow(alpha, n0*n25 - n18*n187)*n30*n45*n85/(n179*n84) + n172) + n111*n99*xF[8]*(pow(alpha, NP0*n0 - n18*n187)*n1*n166*n18/n177 + n164)*(pow(alpha, NP0*n0 - n18*n187)*n166*n18*n48/n177 + n146*n48)/n300 + n111*n94*xF[3]*(pow(alpha, NP0*n0 - n13*n187)*n1*n13*n166/n177 + n159)*(pow(alpha, NP0*n0 - n13*n187)*n13*n166*n48/n177 + n121*n48)/n295 + n111*n82*xF[10]*(pow(alpha, NP0*n0 - n187*n4)*n1*n166*n4/n177 + n150)*(pow(alpha, NP0*n0 - n187*n4)*n166*n4*n48/n177 + n129*n48)/n286 + n120*n70*(pow(alpha, NP0*n0 - n10*n187)*n10*n166*n22*n30/n177 + pow(alpha, n0*n25 - n10*n187)*n10*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n10*n187)*n30*n37*n85/(n179*n84) + n106*n30*n37)/n275 + n130*n70*(pow(alpha, NP0*n0 - n16*n187)*n16*n166*n22*n30/n177 + pow(alpha, n0*n25 - n16*n187)*n16*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n16*n187)*n30*n43*n85/(n179*n84) + n110*n30*n43)/n281 + n131*n70*(pow(alpha, NP0*n0 - n187*n8)*n166*n22*n30*n8/n177 + pow(alpha, n0*n25 - n187*n8)*n145*n85/(n179*n84) + pow(alpha, n0*n25 - n187*n8)*n22*n30*n8*n85/(n179*n84) + n105*n145)/n273 + n132*n70*(pow(alpha, NP0*n0 - n12*n187)*n12*n166*n22*n30/n177 + pow(alpha, n0*n25 - n12*n187)*n12*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n12*n187)*n137*n85/(n179*n84) + n107*n137)/n277 + n134*n70*(pow(alpha, NP0*n0 - n187*n7)*n166*n22*n30*n7/n177 + pow(alpha, n0*n25 - n187*n7)*n22*n30*n7*n85/(n179*n84) + pow(alpha, n0*n25 - n187*n7)*n30*n34*n85/(n179*n84) + n104*n30*n34)/n272 + n147*n70*(pow(alpha, NP0*n0 - n0*n187)*n144*(-n23 + xPj*xTj)/(n177*n51) + n102*n144)/n268 + n328*n70*(pow(alpha, NP0*n0 - n14*n187)*n14*n166*n22*n30/n177 + pow(alpha, n0*n25 - n14*n187)*n14*n22*n30*n85/(n179*n84) + pow(alpha, n0*n25 - n14*n187)*n30*n41*n85/(n179*n84) + n108*n30*n41) + n335 + n336 + n337 + n338 + n339 + n340 + n341 + n342 + n343 + n344 + n345 + n346 + n347 + n348 + n349 + n350 + n351 + n422 + n423 + n424 + n425 + n426 + n427 + n428 + n429 + n430 + n431 + n432 + n433 + n434 + n435 + n436 + n437 + n438)) - n334 - xTj*(n111*n120*n405 + n111*n122*n404 + n111*n123*n399 + n111*n127*n401 + n111*n130*n367/n281 + n111*n131*n403 + n111*n132*n400 + n111*n134*n402 + n111*n147*n354/n268 + n111*n311*n397 + n111*n312*n398 + n111*n322*n390 + n111*n325*n366 + n111*n327*n362 + n111*n328*n365 + n111*n329*n368 + n111*n330*n369 + n112*n70*n71/n237 + n113*n70*n80/n248 + n115*n70*n74/n250 + n126*n49*n70/n245 + n149*n304*n70 + n150*n305*n70 + n151*n303*n70 + n154*n70*xF[14]/n239 + n156*n308*n70 + n159*n310*n70 + n161*n70*xF[5]/n246 + n162*n309*n70 + n164*n307*n70 + n167*n70/n242 + n168*n70/n238 + n317*n70*n76 + n318*n70*n78), -n21);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n116*(n180 - log(-pow(alpha, NP1*n0)*n166 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[10] - Mstar;
-      g5 = MW[11] - Mstar;
-      g6 = MW[12] - Mstar;
-      g7 = MW[13] - Mstar;
-      g8 = MW[14] - Mstar;
-      g9 = MW[15] - Mstar;
-      g10 = MW[16] - Mstar;
-      g11 = MW[2] - Mstar;
-      g12 = MW[3] - Mstar;
-      g13 = MW[4] - Mstar;
-      g14 = MW[5] - Mstar;
-      g15 = MW[6] - Mstar;
-      g16 = MW[7] - Mstar;
-      g17 = MW[8] - Mstar;
-      g18 = MW[9] - Mstar;
-      g19 = xF[0] - xTj;
-      g20 = xF[0] - xPj;
-      g21 = -xTj;
-      g22 = xPj/xF[1];
-      g23 = pow(alpha, -g1);
-      g24 = pow(alpha, -g4);
-      g25 = pow(alpha, -g5);
-      g26 = pow(alpha, -g6);
-      g27 = pow(alpha, -g7);
-      g28 = pow(alpha, -g8);
-      g29 = pow(alpha, -g9);
-      g30 = pow(alpha, -g10);
-      g31 = pow(alpha, -g0);
-      g32 = pow(alpha, -g11);
-      g33 = pow(alpha, -g12);
-      g34 = pow(alpha, -g13);
-      g35 = pow(alpha, -g14);
-      g36 = pow(alpha, -g15);
-      g37 = pow(alpha, -g16);
-      g38 = pow(alpha, -g17);
-      g39 = pow(alpha, -g18);
-      g40 = log(xF[0]/xF[1]);
-      g41 = -g2;
-      g42 = pow(alpha, NP1*g0);
-      g43 = pow(alpha, NP1*g1);
-      g44 = pow(alpha, NP1*g4);
-      g45 = log(g23);
-      g46 = pow(alpha, NP1*g5);
-      g47 = pow(alpha, NP1*g6);
-      g48 = pow(alpha, NP1*g7);
-      g49 = pow(alpha, NP1*g8);
-      g50 = pow(alpha, NP1*g9);
-      g51 = pow(alpha, NP1*g10);
-      g52 = pow(alpha, NP1*g11);
-      g53 = pow(alpha, NP1*g12);
-      g54 = pow(alpha, NP1*g13);
-      g55 = pow(alpha, NP1*g14);
-      g56 = pow(alpha, NP1*g15);
-      g57 = pow(alpha, NP1*g16);
-      g58 = pow(alpha, NP1*g17);
-      g59 = pow(alpha, NP1*g18);
-      g60 = -g40;
-      g61 = g19/g3;
-      g62 = g3/g19;
-      g63 = -g42 + 1;
-      g64 = -g42 + 1;
-      g65 = -g43 + 1;
-      g66 = -g52 + 1;
-      g67 = -g53 + 1;
-      g68 = -g54 + 1;
-      g69 = -g55 + 1;
-      g70 = -g56 + 1;
-      g71 = -g57 + 1;
-      g72 = -g58 + 1;
-      g73 = -g59 + 1;
-      g74 = -g44 + 1;
-      g75 = -g46 + 1;
-      g76 = -g47 + 1;
-      g77 = -g48 + 1;
-      g78 = -g49 + 1;
-      g79 = -g50 + 1;
-      g80 = -g51 + 1;
-      g81 = -g43;
-      g82 = -g44;
-      g83 = -g46;
-      g84 = -g47;
-      g85 = -g48;
-      g86 = -g49;
-      g87 = -g50;
-      g88 = -g51;
-      g89 = -g52;
-      g90 = -g53;
-      g91 = -g54;
-      g92 = -g55;
-      g93 = -g56;
-      g94 = -g57;
-      g95 = -g58;
-      g96 = -g59;
-      g97 = -1.0*g40;
-      g98 = -g3/g20;
-      g99 = g20/(g3*xF[1]);
-      g100 = pow(alpha, g0*g41) - 1;
-      g101 = pow(alpha, g0*g41) - 1;
-      g102 = pow(alpha, g1*g41) - 1;
-      g103 = pow(alpha, g11*g41) - 1;
-      g104 = pow(alpha, g12*g41) - 1;
-      g105 = pow(alpha, g13*g41) - 1;
-      g106 = pow(alpha, g14*g41) - 1;
-      g107 = pow(alpha, g15*g41) - 1;
-      g108 = pow(alpha, g16*g41) - 1;
-      g109 = pow(alpha, g17*g41) - 1;
-      g110 = pow(alpha, g18*g41) - 1;
-      g111 = pow(alpha, g4*g41) - 1;
-      g112 = pow(alpha, g41*g5) - 1;
-      g113 = pow(alpha, g41*g6) - 1;
-      g114 = pow(alpha, g41*g7) - 1;
-      g115 = pow(alpha, g41*g8) - 1;
-      g116 = pow(alpha, g41*g9) - 1;
-      g117 = pow(alpha, g10*g41) - 1;
-      g118 = -pow(alpha, g1*g41);
-      g119 = -pow(alpha, g4*g41);
-      g120 = -pow(alpha, g41*g5);
-      g121 = -pow(alpha, g41*g6);
-      g122 = -pow(alpha, g41*g7);
-      g123 = -pow(alpha, g41*g8);
-      g124 = -pow(alpha, g41*g9);
-      g125 = -pow(alpha, g10*g41);
-      g126 = -pow(alpha, g11*g41);
-      g127 = -pow(alpha, g12*g41);
-      g128 = -pow(alpha, g13*g41);
-      g129 = -pow(alpha, g14*g41);
-      g130 = -pow(alpha, g15*g41);
-      g131 = -pow(alpha, g16*g41);
-      g132 = -pow(alpha, g17*g41);
-      g133 = -pow(alpha, g18*g41);
-      g134 = g101 + g64;
-      g135 = -g118 - g43;
-      g136 = -g119 - g44;
-      g137 = -g120 - g46;
-      g138 = -g121 - g47;
-      g139 = -g122 - g48;
-      g140 = -g123 - g49;
-      g141 = -g124 - g50;
-      g142 = -g125 - g51;
-      g143 = -g126 - g52;
-      g144 = -g127 - g53;
-      g145 = -g128 - g54;
-      g146 = -g129 - g55;
-      g147 = -g130 - g56;
-      g148 = -g131 - g57;
-      g149 = -g132 - g58;
-      g150 = -g133 - g59;
-      g151 = pow(alpha, g1*g41) + g81;
-      g152 = g101 + g64;
-      g153 = pow(alpha, g4*g41) + g82;
-      g154 = pow(alpha, g41*g5) + g83;
-      g155 = pow(alpha, g41*g6) + g84;
-      g156 = pow(alpha, g41*g7) + g85;
-      g157 = pow(alpha, g41*g8) + g86;
-      g158 = pow(alpha, g41*g9) + g87;
-      g159 = pow(alpha, g10*g41) + g88;
-      g160 = pow(alpha, g11*g41) + g89;
-      g161 = pow(alpha, g12*g41) + g90;
-      g162 = pow(alpha, g13*g41) + g91;
-      g163 = pow(alpha, g14*g41) + g92;
-      g164 = pow(alpha, g15*g41) + g93;
-      g165 = pow(alpha, g16*g41) + g94;
-      g166 = pow(alpha, g17*g41) + g95;
-      g167 = pow(alpha, g18*g41) + g96;
-      g168 = xF[9]/g167;
-      g169 = xF[8]/g166;
-      g170 = xF[1]/g152;
-      g171 = xF[10]/g153;
-      g172 = xF[15]/g158;
-      g173 = xF[3]/g161;
-      g174 = xF[16]/g159;
-      g175 = xF[7]/g165;
-      g176 = xF[4]/g162;
-      g177 = xF[12]/g155;
-      g178 = xF[13]/g156;
-      g179 = xF[11]/g154;
-      g180 = xF[6]/g164;
-      g181 = xF[14]/g157;
-      g182 = xF[5]/g163;
-      g183 = xF[2]/g160;
-      g184 = xF[0]/g151;
-      g185 = xF[0]/g135;
-      g186 = xF[15]/g141;
-      g187 = xF[4]/g145;
-      g188 = xF[7]/g148;
-      g189 = xF[2]/g143;
-      g190 = xF[11]/g137;
-      g191 = xF[1]/g134;
-      g192 = xF[13]/g139;
-      g193 = xF[16]/g142;
-      g194 = xF[3]/g144;
-      g195 = xF[6]/g147;
-      g196 = xF[14]/g140;
-      g197 = xF[8]/g149;
-      g198 = xF[12]/g138;
-      g199 = xF[10]/g136;
-      g200 = xF[9]/g150;
-      g201 = xF[5]/g146;
-      g202 = g76/g138;
-      g203 = g73/g150;
-      g204 = g79/g141;
-      g205 = g68/g145;
-      g206 = g71/g148;
-      g207 = g66/g143;
-      g208 = g65/g135;
-      g209 = g69/g146;
-      g210 = g70/g147;
-      g211 = g77/g139;
-      g212 = g67/g144;
-      g213 = g80/g142;
-      g214 = g75/g137;
-      g215 = g78/g140;
-      g216 = g74/g136;
-      g217 = g72/g149;
-      g218 = g63/g134;
-      g219 = g102/g135;
-      g220 = g116/g141;
-      g221 = g112/g137;
-      g222 = g103/g143;
-      g223 = g104/g144;
-      g224 = g105/g145;
-      g225 = g100/g134;
-      g226 = g109/g149;
-      g227 = g110/g150;
-      g228 = g117/g142;
-      g229 = g107/g147;
-      g230 = g115/g140;
-      g231 = g113/g138;
-      g232 = g114/g139;
-      g233 = g108/g148;
-      g234 = g111/g136;
-      g235 = g106/g146;
-      g236 = log(g152*g21*g99/g64);
-      g237 = log(g134*g21*g99/g63);
-      g238 = log(g152*g22*g61/g101);
-      g239 = 1.0*g236;
-      g240 = log(g134*g22*g61/g100);
-      g241 = 1.0*g238;
-      g242 = -g101*g170*g241 - g168*g239*(g96 + 1) - g168*g241*(pow(alpha, g18*g41) - 1) - g169*g239*(g95 + 1) - g169*g241*(pow(alpha, g17*g41) - 1) - g170*g239*g64 - g171*g239*(g82 + 1) - g171*g241*(pow(alpha, g4*g41) - 1) - g172*g239*(g87 + 1) - g172*g241*(pow(alpha, g41*g9) - 1) - g173*g239*(g90 + 1) - g173*g241*(pow(alpha, g12*g41) - 1) - g174*g239*(g88 + 1) - g174*g241*(pow(alpha, g10*g41) - 1) - g175*g239*(g94 + 1) - g175*g241*(pow(alpha, g16*g41) - 1) - g176*g239*(g91 + 1) - g176*g241*(pow(alpha, g13*g41) - 1) - g177*g239*(g84 + 1) - g177*g241*(pow(alpha, g41*g6) - 1) - g178*g239*(g85 + 1) - g178*g241*(pow(alpha, g41*g7) - 1) - g179*g239*(g83 + 1) - g179*g241*(pow(alpha, g41*g5) - 1) - g180*g239*(g93 + 1) - g180*g241*(pow(alpha, g15*g41) - 1) - g181*g239*(g86 + 1) - g181*g241*(pow(alpha, g41*g8) - 1) - g182*g239*(g92 + 1) - g182*g241*(pow(alpha, g14*g41) - 1) - g183*g239*(g89 + 1) - g183*g241*(pow(alpha, g11*g41) - 1) - g184*g239*(g81 + 1) - g184*g241*(pow(alpha, g1*g41) - 1) - g97*xF[0] - g97*xF[10] - g97*xF[11] - g97*xF[12] - g97*xF[13] - g97*xF[14] - g97*xF[15] - g97*xF[16] - g97*xF[1] - g97*xF[2] - g97*xF[3] - g97*xF[4] - g97*xF[5] - g97*xF[6] - g97*xF[7] - g97*xF[8] - g97*xF[9];
-      LpF = xF[0]*(g23 + 1.0)*(g208*g237 + g219*g240 + g60)/(g45*(g23 - 1.0)) + xF[10]*(g24 + 1.0)*(g216*g237 + g234*g240 + g60)/(g45*(g24 - 1.0)) + xF[11]*(g25 + 1.0)*(g214*g237 + g221*g240 + g60)/(g45*(g25 - 1.0)) + xF[12]*(g26 + 1.0)*(g202*g237 + g231*g240 + g60)/(g45*(g26 - 1.0)) + xF[13]*(g27 + 1.0)*(g211*g237 + g232*g240 + g60)/(g45*(g27 - 1.0)) + xF[14]*(g28 + 1.0)*(g215*g237 + g230*g240 + g60)/(g45*(g28 - 1.0)) + xF[15]*(g29 + 1.0)*(g204*g237 + g220*g240 + g60)/(g45*(g29 - 1.0)) + xF[16]*(g30 + 1.0)*(g213*g237 + g228*g240 + g60)/(g45*(g30 - 1.0)) + xF[1]*(g31 + 1.0)*(g218*g237 + g225*g240 + g60)/(g45*(g31 - 1.0)) + xF[2]*(g32 + 1.0)*(g207*g237 + g222*g240 + g60)/(g45*(g32 - 1.0)) + xF[3]*(g33 + 1.0)*(g212*g237 + g223*g240 + g60)/(g45*(g33 - 1.0)) + xF[4]*(g34 + 1.0)*(g205*g237 + g224*g240 + g60)/(g45*(g34 - 1.0)) + xF[5]*(g35 + 1.0)*(g209*g237 + g235*g240 + g60)/(g45*(g35 - 1.0)) + xF[6]*(g36 + 1.0)*(g210*g237 + g229*g240 + g60)/(g45*(g36 - 1.0)) + xF[7]*(g37 + 1.0)*(g206*g237 + g233*g240 + g60)/(g45*(g37 - 1.0)) + xF[8]*(g38 + 1.0)*(g217*g237 + g226*g240 + g60)/(g45*(g38 - 1.0)) + xF[9]*(g39 + 1.0)*(g203*g237 + g227*g240 + g60)/(g45*(g39 - 1.0));
-      PpF = g61;
-      TpF = -g20/g3;
-      SWUpF = g242;
-      SWUpP = g242*g62;
-      xP[0] = g102*g185*g62;
-      xP[1] = g100*g191*g62;
-      xP[2] = g103*g189*g62;
-      xP[3] = g104*g194*g62;
-      xP[4] = g105*g187*g62;
-      xP[5] = g106*g201*g62;
-      xP[6] = g107*g195*g62;
-      xP[7] = g108*g188*g62;
-      xP[8] = g109*g197*g62;
-      xP[9] = g110*g200*g62;
-      xP[10] = g111*g199*g62;
-      xP[11] = g112*g190*g62;
-      xP[12] = g113*g198*g62;
-      xP[13] = g114*g192*g62;
-      xP[14] = g115*g196*g62;
-      xP[15] = g116*g186*g62;
-      xP[16] = g117*g193*g62;
-      xT[0] = g185*g65*g98;
-      xT[1] = g191*g63*g98;
-      xT[2] = g189*g66*g98;
-      xT[3] = g194*g67*g98;
-      xT[4] = g187*g68*g98;
-      xT[5] = g201*g69*g98;
-      xT[6] = g195*g70*g98;
-      xT[7] = g188*g71*g98;
-      xT[8] = g197*g72*g98;
-      xT[9] = g200*g73*g98;
-      xT[10] = g199*g74*g98;
-      xT[11] = g190*g75*g98;
-      xT[12] = g198*g76*g98;
-      xT[13] = g192*g77*g98;
-      xT[14] = g196*g78*g98;
-      xT[15] = g186*g79*g98;
-      xT[16] = g193*g80*g98;
-      break;
-    case 18:
-      n0 = -2.00000000000000;
-      n1 = MW[0] - Mstar;
-      n2 = log(alpha);
-      n3 = xPj - xTj;
-      n4 = xF[0] - xPj;
-      n5 = MW[10] - Mstar;
-      n6 = MW[11] - Mstar;
-      n7 = MW[12] - Mstar;
-      n8 = MW[13] - Mstar;
-      n9 = MW[14] - Mstar;
-      n10 = MW[15] - Mstar;
-      n11 = MW[16] - Mstar;
-      n12 = MW[17] - Mstar;
-      n13 = MW[1] - Mstar;
-      n14 = MW[2] - Mstar;
-      n15 = MW[3] - Mstar;
-      n16 = MW[4] - Mstar;
-      n17 = MW[5] - Mstar;
-      n18 = MW[6] - Mstar;
-      n19 = MW[7] - Mstar;
-      n20 = MW[8] - Mstar;
-      n21 = MW[9] - Mstar;
-      n22 = log(xTj);
-      n23 = -n1;
-      n24 = -2;
-      n25 = xF[0]*xPj;
-      n26 = -Mstar;
-      n27 = -xTj;
-      n28 = -xPj;
-      n29 = -NP0*n0;
-      n30 = pow(n1, -n0);
-      n31 = pow(n2, -n0);
-      n32 = pow(n5, -n0);
-      n33 = pow(n6, -n0);
-      n34 = pow(n7, -n0);
-      n35 = pow(n8, -n0);
-      n36 = pow(n9, -n0);
-      n37 = pow(n10, -n0);
-      n38 = pow(n11, -n0);
-      n39 = pow(n12, -n0);
-      n40 = pow(n13, -n0);
-      n41 = pow(n14, -n0);
-      n42 = pow(n15, -n0);
-      n43 = pow(n16, -n0);
-      n44 = pow(n17, -n0);
-      n45 = pow(n18, -n0);
-      n46 = pow(n19, -n0);
-      n47 = pow(n20, -n0);
-      n48 = pow(n21, -n0);
-      n49 = Mstar*n2;
-      n50 = -n0*n2;
-      n51 = NP0*n1;
-      n52 = -n2;
-      n53 = pow(alpha, n51);
-      n54 = n25 + n27*xF[0];
-      n55 = n25 + n27*xPj;
-      n56 = pow(alpha, NP0*n5);
-      n57 = pow(alpha, NP0*n6);
-      n58 = pow(alpha, NP0*n7);
-      n59 = pow(alpha, NP0*n8);
-      n60 = pow(alpha, NP0*n9);
-      n61 = pow(alpha, NP0*n10);
-      n62 = pow(alpha, NP0*n11);
-      n63 = pow(alpha, NP0*n12);
-      n64 = pow(alpha, NP0*n13);
-      n65 = pow(alpha, NP0*n14);
-      n66 = pow(alpha, NP0*n15);
-      n67 = pow(alpha, NP0*n16);
-      n68 = pow(alpha, NP0*n17);
-      n69 = pow(alpha, NP0*n18);
-      n70 = pow(alpha, NP0*n19);
-      n71 = pow(alpha, NP0*n20);
-      n72 = pow(alpha, NP0*n21);
-      n73 = MW[0]*n52;
-      n74 = n3/n4;
-      n75 = n17*n2;
-      n76 = n2*n7;
-      n77 = n13*n2;
-      n78 = n2*n21;
-      n79 = n2*n8;
-      n80 = n14*n2;
-      n81 = n10*n2;
-      n82 = n19*n2;
-      n83 = -n53 + 1;
-      n84 = -n56 + 1;
-      n85 = pow(alpha, NP0*n0*n23);
-      n86 = pow(n55, -n0);
-      n87 = -n57 + 1;
-      n88 = -n58 + 1;
-      n89 = -n59 + 1;
-      n90 = -n60 + 1;
-      n91 = -n61 + 1;
-      n92 = -n62 + 1;
-      n93 = -n63 + 1;
-      n94 = -n64 + 1;
-      n95 = -n65 + 1;
-      n96 = -n66 + 1;
-      n97 = -n67 + 1;
-      n98 = -n68 + 1;
-      n99 = -n69 + 1;
-      n100 = -n70 + 1;
-      n101 = -n71 + 1;
-      n102 = -n72 + 1;
-      n103 = -n96;
-      n104 = -n88;
-      n105 = -n99;
-      n106 = -n93;
-      n107 = -n84;
-      n108 = -n83;
-      n109 = -n87;
-      n110 = -n53;
-      n111 = -n58;
-      n112 = -n59;
-      n113 = -n60;
-      n114 = -n62;
-      n115 = -n65;
-      n116 = -n67;
-      n117 = -n68;
-      n118 = -n69;
-      n119 = n1*n31;
-      n120 = 1/(n1*n2);
-      n121 = n92*xF[16];
-      n122 = n31*n40;
-      n123 = n18*n69;
-      n124 = n15*n66;
-      n125 = n1*n53;
-      n126 = n31*n44;
-      n127 = n16*n67;
-      n128 = n12*n63;
-      n129 = n60*n9;
-      n130 = n5*n56;
-      n131 = n31*n46;
-      n132 = n90*xF[14];
-      n133 = n95*xF[2];
-      n134 = n31*n35;
-      n135 = n31*n37;
-      n136 = n31*n41;
-      n137 = n11*n62;
-      n138 = n98*xF[5];
-      n139 = n13*n64;
-      n140 = n59*n8;
-      n141 = n19*n70;
-      n142 = n30*n31;
-      n143 = n31*n36;
-      n144 = n10*n61;
-      n145 = n20*n71;
-      n146 = n83*xF[0];
-      n147 = log((-1.0 + xPj/xF[0])/n3);
-      n148 = -n91*xF[15];
-      n149 = -n102*xF[9];
-      n150 = n21*n72*xF[9];
-      n151 = -n89*xF[13];
-      n152 = n2*n57*n6;
-      n153 = n145*n2;
-      n154 = n55/n54;
-      n155 = n31*n39*n63;
-      n156 = n142*n53;
-      n157 = n31*n33*n57;
-      n158 = n31*n47*n71;
-      n159 = n31*n38*n62;
-      n160 = n31*n34*n58;
-      n161 = n31*n32*n56;
-      n162 = n31*n42*n66;
-      n163 = n110*n154 + 1;
-      n164 = n147 + n22 + n49 + n73;
-      n165 = n154*n53/n163;
-      n166 = n120*(n164 - log(n163)) + 1;
-      n167 = pow(alpha, n1*n166);
-      n168 = pow(alpha, n166*n5);
-      n169 = pow(alpha, n166*n6);
-      n170 = pow(alpha, n166*n7);
-      n171 = pow(alpha, n166*n8);
-      n172 = pow(alpha, n166*n9);
-      n173 = pow(alpha, n10*n166);
-      n174 = pow(alpha, n11*n166);
-      n175 = pow(alpha, n12*n166);
-      n176 = pow(alpha, n13*n166);
-      n177 = pow(alpha, n14*n166);
-      n178 = pow(alpha, n15*n166);
-      n179 = pow(alpha, n16*n166);
-      n180 = pow(alpha, n166*n17);
-      n181 = pow(alpha, n166*n18);
-      n182 = pow(alpha, n166*n19);
-      n183 = pow(alpha, n166*n20);
-      n184 = pow(alpha, n166*n21);
-      n185 = n16/n179;
-      n186 = n19/n182;
-      n187 = n8/n171;
-      n188 = n12/n175;
-      n189 = n15/n178;
-      n190 = n18/n181;
-      n191 = n9/n172;
-      n192 = n20/n183;
-      n193 = n6/n169;
-      n194 = n13/n176;
-      n195 = n14/n177;
-      n196 = -1/n167;
-      n197 = n10/n173;
-      n198 = n7/n170;
-      n199 = n21/n184;
-      n200 = n5/n168;
-      n201 = n11/n174;
-      n202 = n17/n180;
-      n203 = pow(alpha, n166*n23) + n83 - 1;
-      n204 = n84 - 1 + 1.0/n168;
-      n205 = n87 - 1 + 1.0/n169;
-      n206 = n88 - 1 + 1.0/n170;
-      n207 = n89 - 1 + 1.0/n171;
-      n208 = n90 - 1 + 1.0/n172;
-      n209 = n91 - 1 + 1.0/n173;
-      n210 = n92 - 1 + 1.0/n174;
-      n211 = n93 - 1 + 1.0/n175;
-      n212 = n94 - 1 + 1.0/n176;
-      n213 = n95 - 1 + 1.0/n177;
-      n214 = n96 - 1 + 1.0/n178;
-      n215 = n97 - 1 + 1.0/n179;
-      n216 = n98 - 1 + 1.0/n180;
-      n217 = n99 - 1 + 1.0/n181;
-      n218 = n100 - 1 + 1.0/n182;
-      n219 = n101 - 1 + 1.0/n183;
-      n220 = n102 - 1 + 1.0/n184;
-      n221 = pow(n203, 3);
-      n222 = pow(n204, 3);
-      n223 = pow(n205, 3);
-      n224 = pow(n206, 3);
-      n225 = pow(n207, 3);
-      n226 = pow(n208, 3);
-      n227 = pow(n209, 3);
-      n228 = pow(n210, 3);
-      n229 = pow(n211, 3);
-      n230 = pow(n212, 3);
-      n231 = pow(n213, 3);
-      n232 = pow(n214, 3);
-      n233 = pow(n215, 3);
-      n234 = pow(n216, 3);
-      n235 = pow(n217, 3);
-      n236 = pow(n218, 3);
-      n237 = pow(n219, 3);
-      n238 = pow(n220, 3);
-      n239 = xF[11]/n205;
-      n240 = xF[12]/n206;
-      n241 = xF[17]/n211;
-      n242 = xF[0]/n203;
-      n243 = xF[10]/n204;
-      n244 = xF[9]/n220;
-      n245 = xF[8]/n219;
-      n246 = xF[16]/n210;
-      n247 = xF[3]/n214;
-      n248 = pow(n214, n24)*xF[3];
-      n249 = xF[6]/n235;
-      n250 = pow(n211, n24)*xF[17];
-      n251 = pow(n204, n24)*xF[10];
-      n252 = xF[17]/n229;
-      n253 = pow(n203, n24)*xF[0];
-      n254 = xF[12]/n224;
-      n255 = xF[10]/n222;
-      n256 = n2*xF[14]/n208;
-      n257 = n2*xF[4]/n215;
-      n258 = n2*n247;
-      n259 = n2*pow(n203, n24);
-      n260 = n2*xF[6]/n217;
-      n261 = n64*xF[1]/n212;
-      n262 = n68*xF[5]/n216;
-      n263 = n70*xF[7]/n218;
-      n264 = n59*xF[13]/n207;
-      n265 = n65*xF[2]/n213;
-      n266 = n61*xF[15]/n209;
-      n267 = n60*xF[14]/n208;
-      n268 = n94/n230;
-      n269 = pow(n215, n24)*n97*xF[4];
-      n270 = n97*xF[4]/n233;
-      n271 = -n138*pow(n216, n24);
-      n272 = -n100*xF[7]/n236;
-      n273 = -pow(n212, n24)*n94*xF[1];
-      n274 = -n100*pow(n218, n24)*xF[7];
-      n275 = -n101*pow(n219, n24)*xF[8];
-      n276 = n244*n31*n48*n72;
-      n277 = n31*n43*n67*xF[4]/n215;
-      n278 = n31*n45*n69*xF[6]/n217;
-      n279 = n2*n23*n242*n53*n74;
-      n280 = n156*n242*n74;
-      n281 = n161*n243*n74;
-      n282 = n157*n239*n74;
-      n283 = n160*n240*n74;
-      n284 = n134*n264*n74;
-      n285 = n143*n267*n74;
-      n286 = n135*n266*n74;
-      n287 = n159*n246*n74;
-      n288 = n155*n241*n74;
-      n289 = n122*n261*n74;
-      n290 = n136*n265*n74;
-      n291 = n162*n247*n74;
-      n292 = n277*n74;
-      n293 = n126*n262*n74;
-      n294 = n278*n74;
-      n295 = n131*n263*n74;
-      n296 = n158*n245*n74;
-      n297 = n276*n74;
-      n298 = 0.5*n280;
-      n299 = n154/(n163*n167);
-      n300 = n299 + 1;
-      n301 = n125*n2*n299 + n125*n2;
-      n302 = n130*n2 + n165*n2*n200;
-      n303 = n152 + n165*n193*n2;
-      n304 = n165*n76/n170 + n58*n76;
-      n305 = n165*n79/n171 + n59*n79;
-      n306 = n129*n2 + n165*n191*n2;
-      n307 = n165*n81/n173 + n61*n81;
-      n308 = n137*n2 + n165*n2*n201;
-      n309 = n128*n2 + n165*n188*n2;
-      n310 = n165*n77/n176 + n64*n77;
-      n311 = n165*n80/n177 + n65*n80;
-      n312 = n124*n2 + n165*n189*n2;
-      n313 = n127*n2 + n165*n185*n2;
-      n314 = n165*n75/n180 + n68*n75;
-      n315 = n123*n2 + n165*n190*n2;
-      n316 = n165*n82/n182 + n70*n82;
-      n317 = n153 + n165*n192*n2;
-      n318 = n165*n78/n184 + n72*n78;
-      n319 = pow(n301, -n0);
-      n320 = pow(n302, -n0);
-      n321 = pow(n303, -n0);
-      n322 = pow(n304, -n0);
-      n323 = pow(n305, -n0);
-      n324 = pow(n306, -n0);
-      n325 = pow(n307, -n0);
-      n326 = pow(n308, -n0);
-      n327 = pow(n309, -n0);
-      n328 = pow(n310, -n0);
-      n329 = pow(n311, -n0);
-      n330 = pow(n312, -n0);
-      n331 = pow(n313, -n0);
-      n332 = pow(n314, -n0);
-      n333 = pow(n315, -n0);
-      n334 = pow(n316, -n0);
-      n335 = pow(n317, -n0);
-      n336 = pow(n318, -n0);
-      n337 = n301*xF[0];
-      n338 = n303*xF[11];
-      n339 = n310*xF[1];
-      n340 = n317*xF[8];
-      n341 = n0*n165*n2*n23/n167 + n0*n2*n23*n53;
-      n342 = n328*xF[1];
-      n343 = n110*n142*n299 + n110*n142;
-      n344 = pow(n220, n24)*n318;
-      n345 = pow(n207, n24)*n305;
-      n346 = pow(n208, n24)*n306;
-      n347 = pow(n209, n24)*n307;
-      n348 = pow(n206, n24)*n304*xF[12];
-      n349 = pow(n217, n24)*n315*xF[6];
-      n350 = n324/n226;
-      n351 = n329/n231;
-      n352 = n332/n234;
-      n353 = n326/n228;
-      n354 = n341/n221;
-      n355 = n101*n335*xF[8]/n237;
-      n356 = n321*n87*xF[11]/n223;
-      n357 = n146*pow(n203, n24)*n301*n74;
-      n358 = n0*n2*n23*n253*n53*n74*(pow(alpha, n166*n23 + n51)*n1*n154*n2/n163 + n125*n2);
-      n359 = n130*n251*n50*n74*(pow(alpha, -n166*n5 + n51)*n154*n2*n5/n163 + n130*n2);
-      n360 = pow(n205, n24)*n50*n57*n6*n74*xF[11]*(pow(alpha, -n166*n6 + n51)*n154*n2*n6/n163 + n152);
-      n361 = pow(n206, n24)*n50*n58*n7*n74*xF[12]*(pow(alpha, -n166*n7 + n51)*n154*n76/n163 + n58*n76);
-      n362 = n140*pow(n207, n24)*n50*n74*xF[13]*(pow(alpha, -n166*n8 + n51)*n154*n79/n163 + n59*n79);
-      n363 = n129*pow(n208, n24)*n50*n74*xF[14]*(pow(alpha, -n166*n9 + n51)*n154*n2*n9/n163 + n129*n2);
-      n364 = n144*pow(n209, n24)*n50*n74*xF[15]*(pow(alpha, -n10*n166 + n51)*n154*n81/n163 + n61*n81);
-      n365 = n137*pow(n210, n24)*n50*n74*xF[16]*(pow(alpha, -n11*n166 + n51)*n11*n154*n2/n163 + n137*n2);
-      n366 = n128*n250*n50*n74*(pow(alpha, -n12*n166 + n51)*n12*n154*n2/n163 + n128*n2);
-      n367 = n139*pow(n212, n24)*n50*n74*xF[1]*(pow(alpha, -n13*n166 + n51)*n154*n77/n163 + n64*n77);
-      n368 = n14*pow(n213, n24)*n50*n65*n74*xF[2]*(pow(alpha, -n14*n166 + n51)*n154*n80/n163 + n65*n80);
-      n369 = n124*n248*n50*n74*(pow(alpha, -n15*n166 + n51)*n15*n154*n2/n163 + n124*n2);
-      n370 = n127*pow(n215, n24)*n50*n74*xF[4]*(pow(alpha, -n16*n166 + n51)*n154*n16*n2/n163 + n127*n2);
-      n371 = n17*pow(n216, n24)*n50*n68*n74*xF[5]*(pow(alpha, -n166*n17 + n51)*n154*n75/n163 + n68*n75);
-      n372 = n123*pow(n217, n24)*n50*n74*xF[6]*(pow(alpha, -n166*n18 + n51)*n154*n18*n2/n163 + n123*n2);
-      n373 = n141*pow(n218, n24)*n50*n74*xF[7]*(pow(alpha, -n166*n19 + n51)*n154*n82/n163 + n70*n82);
-      n374 = n145*pow(n219, n24)*n50*n74*xF[8]*(pow(alpha, -n166*n20 + n51)*n154*n2*n20/n163 + n153);
-      n375 = n150*pow(n220, n24)*n50*n74*(pow(alpha, -n166*n21 + n51)*n154*n78/n163 + n72*n78);
-      n376 = 1.0*n125*n2*n253*n301*n74;
-      n377 = n146*pow(n203, n24)*n343*n74;
-      n378 = 0.5*n377;
-      n379 = pow(alpha, n1*n29)*n119*pow(n163, n24)*n193*pow(n54, n24)*n86 - pow(alpha, n1*n29)*pow(n163, n24)*n31*n33*pow(n54, n24)*n86/n169 + n119*n165*n193 + n157;
-      n380 = pow(alpha, n1*n29)*n119*pow(n163, n24)*n198*pow(n54, n24)*n86 - pow(alpha, n1*n29)*pow(n163, n24)*n31*n34*pow(n54, n24)*n86/n170 + n119*n165*n198 + n160;
-      n381 = pow(alpha, n1*n29)*n134*pow(n163, n24)*pow(n54, n24)*n86/n171 + pow(alpha, n1*n29)*pow(n163, n24)*n187*n23*n31*pow(n54, n24)*n86 + n112*n134 + n165*n187*n23*n31;
-      n382 = pow(alpha, n1*n29)*n143*pow(n163, n24)*pow(n54, n24)*n86/n172 + pow(alpha, n1*n29)*pow(n163, n24)*n191*n23*n31*pow(n54, n24)*n86 + n113*n143 + n165*n191*n23*n31;
-      n383 = pow(alpha, n1*n29)*n119*pow(n163, n24)*n197*pow(n54, n24)*n86 - pow(alpha, n1*n29)*n135*pow(n163, n24)*pow(n54, n24)*n86/n173 + n119*n165*n197 + n135*n61;
-      n384 = pow(alpha, n1*n29)*pow(n163, n24)*n201*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29)*pow(n163, n24)*n31*n38*pow(n54, n24)*n86/n174 + n114*n31*n38 + n165*n201*n23*n31;
-      n385 = pow(alpha, n1*n29)*n136*pow(n163, n24)*pow(n54, n24)*n86/n177 + pow(alpha, n1*n29)*pow(n163, n24)*n195*n23*n31*pow(n54, n24)*n86 + n115*n136 + n165*n195*n23*n31;
-      n386 = pow(alpha, n1*n29)*pow(n163, n24)*n190*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29)*pow(n163, n24)*n31*n45*pow(n54, n24)*n86/n181 + n118*n31*n45 + n165*n190*n23*n31;
-      n387 = pow(alpha, n1*n29)*n119*pow(n163, n24)*n199*pow(n54, n24)*n86 - pow(alpha, n1*n29)*pow(n163, n24)*n31*n48*pow(n54, n24)*n86/n184 + n119*n165*n199 + n31*n48*n72;
-      n388 = pow(n207, n24)*n74*n89*xF[13]*(pow(alpha, n1*n29 - n166*n8)*n134*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n8)*pow(n163, n24)*n23*n31*pow(n54, n24)*n8*n86 + n112*n134 + n165*n187*n23*n31);
-      n389 = n132*pow(n208, n24)*n74*(pow(alpha, n1*n29 - n166*n9)*n143*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n9)*pow(n163, n24)*n23*n31*pow(n54, n24)*n86*n9 + n113*n143 + n165*n191*n23*n31);
-      n390 = n121*pow(n210, n24)*n74*(pow(alpha, n1*n29 - n11*n166)*n11*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n11*n166)*pow(n163, n24)*n31*n38*pow(n54, n24)*n86 + n114*n31*n38 + n165*n201*n23*n31);
-      n391 = n133*pow(n213, n24)*n74*(pow(alpha, n1*n29 - n14*n166)*n136*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n14*n166)*n14*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + n115*n136 + n165*n195*n23*n31);
-      n392 = n269*n74*(pow(alpha, n1*n29 - n16*n166)*n16*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n16*n166)*pow(n163, n24)*n31*n43*pow(n54, n24)*n86 + n116*n31*n43 + n165*n185*n23*n31);
-      n393 = pow(n217, n24)*n74*n99*xF[6]*(pow(alpha, n1*n29 - n166*n18)*pow(n163, n24)*n18*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n18)*pow(n163, n24)*n31*n45*pow(n54, n24)*n86 + n118*n31*n45 + n165*n190*n23*n31);
-      n394 = n107*n251*n74*(pow(alpha, n1*n29 - n166*n5)*n119*pow(n163, n24)*n5*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n5)*pow(n163, n24)*n31*n32*pow(n54, n24)*n86 + n119*n165*n200 + n161);
-      n395 = n109*pow(n205, n24)*n74*xF[11]*(pow(alpha, n1*n29 - n166*n6)*n119*pow(n163, n24)*pow(n54, n24)*n6*n86 - pow(alpha, n1*n29 - n166*n6)*pow(n163, n24)*n31*n33*pow(n54, n24)*n86 + n119*n165*n193 + n157);
-      n396 = n104*pow(n206, n24)*n74*xF[12]*(pow(alpha, n1*n29 - n166*n7)*n119*pow(n163, n24)*pow(n54, n24)*n7*n86 - pow(alpha, n1*n29 - n166*n7)*pow(n163, n24)*n31*n34*pow(n54, n24)*n86 + n119*n165*n198 + n160);
-      n397 = n148*pow(n209, n24)*n74*(pow(alpha, n1*n29 - n10*n166)*n10*n119*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n10*n166)*n135*pow(n163, n24)*pow(n54, n24)*n86 + n119*n165*n197 + n135*n61);
-      n398 = n106*n250*n74*(pow(alpha, n1*n29 - n12*n166)*n119*n12*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n12*n166)*pow(n163, n24)*n31*n39*pow(n54, n24)*n86 + n119*n165*n188 + n155);
-      n399 = n273*n74*(pow(alpha, n1*n29 - n13*n166)*n119*n13*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n13*n166)*n122*pow(n163, n24)*pow(n54, n24)*n86 + n119*n165*n194 + n122*n64);
-      n400 = n103*n248*n74*(pow(alpha, n1*n29 - n15*n166)*n119*n15*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n15*n166)*pow(n163, n24)*n31*n42*pow(n54, n24)*n86 + n119*n165*n189 + n162);
-      n401 = n271*n74*(pow(alpha, n1*n29 - n166*n17)*n119*pow(n163, n24)*n17*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n17)*n126*pow(n163, n24)*pow(n54, n24)*n86 + n119*n165*n202 + n126*n68);
-      n402 = n274*n74*(pow(alpha, n1*n29 - n166*n19)*n119*pow(n163, n24)*n19*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n19)*n131*pow(n163, n24)*pow(n54, n24)*n86 + n119*n165*n186 + n131*n70);
-      n403 = n275*n74*(pow(alpha, n1*n29 - n166*n20)*n119*pow(n163, n24)*n20*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n20)*pow(n163, n24)*n31*n47*pow(n54, n24)*n86 + n119*n165*n192 + n158);
-      n404 = n149*pow(n220, n24)*n74*(pow(alpha, n1*n29 - n166*n21)*n119*pow(n163, n24)*n21*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n21)*pow(n163, n24)*n31*n48*pow(n54, n24)*n86 + n119*n165*n199 + n31*n48*n72);
-      n405 = xTj*(n103*n248*n312*n74 + n104*n348*n74 + n105*n349*n74 + n106*n250*n309*n74 + n107*n251*n302*n74 + n108*n253*n301*n74 + n109*pow(n205, n24)*n338*n74 - n121*pow(n210, n24)*n308*n74 + n123*n260*n74 + n124*n258*n74 + n125*n2*n242*n74 + n127*n257*n74 + n128*n2*n241*n74 + n129*n256*n74 + n130*n2*n243*n74 - n132*n346*n74 - n133*pow(n213, n24)*n311*n74 + n137*n2*n246*n74 + n148*n347*n74 + n149*n344*n74 + n151*n345*n74 + n152*n239*n74 + n153*n245*n74 + n240*n58*n74*n76 + n244*n72*n74*n78 + n261*n74*n77 + n262*n74*n75 + n263*n74*n82 + n264*n74*n79 + n265*n74*n80 + n266*n74*n81 - n269*n313*n74 + n271*n314*n74 + n273*n310*n74 + n274*n316*n74 + n275*n317*n74);
-      n406 = n279 + n357 + n405;
-      n407 = n280 + n281 + n282 + n283 + n284 + n285 + n286 + n287 + n288 + n289 + n290 + n291 + n292 + n293 + n294 + n295 + n296 + n297 + n358 + n359 + n360 + n361 + n362 + n363 + n364 + n365 + n366 + n367 + n368 + n369 + n370 + n371 + n372 + n373 + n374 + n375 + n377 + n388 + n389 + n390 + n391 + n392 + n393 + n394 + n395 + n396 + n397 + n398 + n399 + n400 + n401 + n402 + n403 + n404;
-      n408 = -n101*n340*n74*(n145*n50 + n165*n192*n50)/n237 + n103*n312*n74*xF[3]*(n124*n50 + n165*n189*n50)/n232 + n104*n254*n304*n74*(n165*n198*n50 + n50*n58*n7) + n105*n249*n315*n74*(n123*n50 + n165*n190*n50) + n106*n252*n309*n74*(n128*n50 + n165*n188*n50) + n107*n255*n302*n74*(n130*n50 + n165*n200*n50) + n108*n337*n354*n74 + n109*n338*n74*(n165*n193*n50 + n50*n57*n6)/n223 - n121*n308*n74*(n137*n50 + n165*n201*n50)/n228 - n132*n306*n74*(n129*n50 + n165*n191*n50)/n226 - n133*n311*n74*(n14*n50*n65 + n165*n195*n50)/n231 - n138*n314*n74*(n165*n202*n50 + n17*n50*n68)/n234 + n148*n307*n74*(n144*n50 + n165*n197*n50)/n227 + n149*n318*n74*(n165*n199*n50 + n21*n50*n72)/n238 + n151*n305*n74*(n140*n50 + n165*n187*n50)/n225 - n268*n339*n74*(n139*n50 + n165*n194*n50) - n270*n313*n74*(n127*n50 + n165*n185*n50) + n272*n316*n74*(n141*n50 + n165*n186*n50) + n407;
-      n409 = n408*xTj;
-      NP_b = -n125*n146*n259*n300*n74 - n279 - n29*(1.0*n125*n2*n253*n74*(pow(alpha, -n1*n166 + n51)*n1*n154*n2/n163 + n125*n2) + 0.5*n146*pow(n203, n24)*n74*(-pow(alpha, -n1*n166 + n51)*n142*n154/n163 + n110*n142) - 1.0*n146*n319*n74/n221 + n298 - 0.5*xTj*(n100*n24*n334*n74*xF[7]/n236 + n102*n24*n336*n74*xF[9]/n238 + n103*n248*n74*(pow(alpha, n1*n29 - n15*n166)*n119*n15*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n15*n166)*pow(n163, n24)*n31*n42*pow(n54, n24)*n86 + pow(alpha, -n15*n166 + n51)*n119*n15*n154/n163 + n162) + n104*pow(n206, n24)*n74*xF[12]*(pow(alpha, n1*n29 - n166*n7)*n119*pow(n163, n24)*pow(n54, n24)*n7*n86 - pow(alpha, n1*n29 - n166*n7)*pow(n163, n24)*n31*n34*pow(n54, n24)*n86 + pow(alpha, -n166*n7 + n51)*n119*n154*n7/n163 + n160) + n106*n250*n74*(pow(alpha, n1*n29 - n12*n166)*n119*n12*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n12*n166)*pow(n163, n24)*n31*n39*pow(n54, n24)*n86 + pow(alpha, -n12*n166 + n51)*n119*n12*n154/n163 + n155) + n107*n251*n74*(pow(alpha, n1*n29 - n166*n5)*n119*pow(n163, n24)*n5*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n5)*pow(n163, n24)*n31*n32*pow(n54, n24)*n86 + pow(alpha, -n166*n5 + n51)*n119*n154*n5/n163 + n161) + n109*pow(n205, n24)*n74*xF[11]*(pow(alpha, n1*n29 - n166*n6)*n119*pow(n163, n24)*pow(n54, n24)*n6*n86 - pow(alpha, n1*n29 - n166*n6)*pow(n163, n24)*n31*n33*pow(n54, n24)*n86 + pow(alpha, -n166*n6 + n51)*n119*n154*n6/n163 + n157) + n121*pow(n210, n24)*n74*(pow(alpha, n1*n29 - n11*n166)*n11*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n11*n166)*pow(n163, n24)*n31*n38*pow(n54, n24)*n86 + pow(alpha, -n11*n166 + n51)*n11*n154*n23*n31/n163 + n114*n31*n38) + n121*n24*n353*n74 + n132*pow(n208, n24)*n74*(pow(alpha, n1*n29 - n166*n9)*n143*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n9)*pow(n163, n24)*n23*n31*pow(n54, n24)*n86*n9 + pow(alpha, -n166*n9 + n51)*n154*n23*n31*n9/n163 + n113*n143) + n132*n24*n350*n74 + n133*pow(n213, n24)*n74*(pow(alpha, n1*n29 - n14*n166)*n136*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n14*n166)*n14*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + pow(alpha, -n14*n166 + n51)*n14*n154*n23*n31/n163 + n115*n136) + n133*n24*n351*n74 + n138*n24*n352*n74 + n146*pow(n203, n24)*n74*(-pow(alpha, -n1*n166 + n51)*n142*n154/n163 + n110*n142) + n146*n24*n319*n74/n221 + n148*pow(n209, n24)*n74*(pow(alpha, n1*n29 - n10*n166)*n10*n119*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n10*n166)*n135*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, -n10*n166 + n51)*n10*n119*n154/n163 + n135*n61) + n149*pow(n220, n24)*n74*(pow(alpha, n1*n29 - n166*n21)*n119*pow(n163, n24)*n21*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n21)*pow(n163, n24)*n31*n48*pow(n54, n24)*n86 + pow(alpha, -n166*n21 + n51)*n119*n154*n21/n163 + n31*n48*n72) + pow(n207, n24)*n74*n89*xF[13]*(pow(alpha, n1*n29 - n166*n8)*n134*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n8)*pow(n163, n24)*n23*n31*pow(n54, n24)*n8*n86 + pow(alpha, -n166*n8 + n51)*n154*n23*n31*n8/n163 + n112*n134) + pow(n217, n24)*n74*n99*xF[6]*(pow(alpha, n1*n29 - n166*n18)*pow(n163, n24)*n18*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n18)*pow(n163, n24)*n31*n45*pow(n54, n24)*n86 + pow(alpha, -n166*n18 + n51)*n154*n18*n23*n31/n163 + n118*n31*n45) + n24*n249*n333*n74*n99 + n24*n252*n327*n74*n93 + n24*n254*n322*n74*n88 + n24*n255*n320*n74*n84 + n24*n268*n342*n74 + n24*n270*n331*n74 + n24*n355*n74 + n24*n356*n74 + n269*n74*(pow(alpha, n1*n29 - n16*n166)*n16*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n16*n166)*pow(n163, n24)*n31*n43*pow(n54, n24)*n86 + pow(alpha, -n16*n166 + n51)*n154*n16*n23*n31/n163 + n116*n31*n43) + n271*n74*(pow(alpha, n1*n29 - n166*n17)*n119*pow(n163, n24)*n17*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n17)*n126*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, -n166*n17 + n51)*n119*n154*n17/n163 + n126*n68) + n273*n74*(pow(alpha, n1*n29 - n13*n166)*n119*n13*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n13*n166)*n122*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, -n13*n166 + n51)*n119*n13*n154/n163 + n122*n64) + n274*n74*(pow(alpha, n1*n29 - n166*n19)*n119*pow(n163, n24)*n19*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n19)*n131*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, -n166*n19 + n51)*n119*n154*n19/n163 + n131*n70) + n275*n74*(pow(alpha, n1*n29 - n166*n20)*n119*pow(n163, n24)*n20*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n20)*pow(n163, n24)*n31*n47*pow(n54, n24)*n86 + pow(alpha, -n166*n20 + n51)*n119*n154*n20/n163 + n158) + n280 + n281 + n282 + n283 + n284 + n285 + n286 + n287 + n288 + n289 + n290 + n291 + n292 + n293 + n294 + n295 + n296 + n297 + n358 + n359 + n360 + n361 + n362 + n363 + n364 + n365 + n366 + n367 + n368 + n369 + n370 + n371 + n372 + n373 + n374 + n375 + n24*n330*n74*n96*xF[3]/n232 + n24*n325*n74*n91*xF[15]/n227 + n24*n323*n74*n89*xF[13]/n225)) - n74*xTj*(n103*n248*n312 + n104*n348 + n105*n349 + n106*n250*n309 + n107*n251*n302 + n108*n253*n301 + n109*pow(n205, n24)*n338 - n121*pow(n210, n24)*n308 + n123*n260 + n124*n258 + n125*n2*n242 + n127*n257 + n128*n2*n241 + n129*n256 + n130*n2*n243 - n132*n346 - n133*pow(n213, n24)*n311 + n137*n2*n246 + n148*n347 + n149*n344 + n151*n345 + n152*n239 + n153*n245 + n240*n58*n76 + n244*n72*n78 + n261*n77 + n262*n75 + n263*n82 + n264*n79 + n265*n80 + n266*n81 - n269*n313 + n271*n314 + n273*n310 + n274*n316 + n275*n317);
-      NP_2a = -n74*(pow(alpha, n1*n29)*n0*n108*n142*pow(n300, -n0)*xF[0]/n221 + pow(alpha, n1*n29)*n0*n142*n253*n300 + n108*n156*n253*(-1 + (-n25 + xPj*xTj)/(n163*n167*n54)) - 1.0*n156*n242 + 1.0*xTj*(n0*n2*n23*n253*n53*(pow(alpha, n166*n23 + n51)*n1*n154*n2/n163 + n125*n2) + n100*n24*n334*xF[7]/n236 + n102*n24*n336*xF[9]/n238 + n103*n248*(pow(alpha, n1*n29 - n15*n166)*n119*n15*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n15*n166)*pow(n163, n24)*n31*n42*pow(n54, n24)*n86 + n119*n165*n189 + n162) + n104*pow(n206, n24)*xF[12]*(pow(alpha, n1*n29 - n166*n7)*n119*pow(n163, n24)*pow(n54, n24)*n7*n86 - pow(alpha, n1*n29 - n166*n7)*pow(n163, n24)*n31*n34*pow(n54, n24)*n86 + n119*n165*n198 + n160) + n106*n250*(pow(alpha, n1*n29 - n12*n166)*n119*n12*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n12*n166)*pow(n163, n24)*n31*n39*pow(n54, n24)*n86 + n119*n165*n188 + n155) + n107*n251*(pow(alpha, n1*n29 - n166*n5)*n119*pow(n163, n24)*n5*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n5)*pow(n163, n24)*n31*n32*pow(n54, n24)*n86 + n119*n165*n200 + n161) + n109*pow(n205, n24)*xF[11]*(pow(alpha, n1*n29 - n166*n6)*n119*pow(n163, n24)*pow(n54, n24)*n6*n86 - pow(alpha, n1*n29 - n166*n6)*pow(n163, n24)*n31*n33*pow(n54, n24)*n86 + n119*n165*n193 + n157) + n121*pow(n210, n24)*(pow(alpha, n1*n29 - n11*n166)*n11*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n11*n166)*pow(n163, n24)*n31*n38*pow(n54, n24)*n86 + n114*n31*n38 + n165*n201*n23*n31) + n121*n24*n353 + n122*n261 + n123*pow(n217, n24)*n50*xF[6]*(pow(alpha, -n166*n18 + n51)*n154*n18*n2/n163 + n123*n2) + n124*n248*n50*(pow(alpha, -n15*n166 + n51)*n15*n154*n2/n163 + n124*n2) + n126*n262 + n127*pow(n215, n24)*n50*xF[4]*(pow(alpha, -n16*n166 + n51)*n154*n16*n2/n163 + n127*n2) + n128*n250*n50*(pow(alpha, -n12*n166 + n51)*n12*n154*n2/n163 + n128*n2) + n129*pow(n208, n24)*n50*xF[14]*(pow(alpha, -n166*n9 + n51)*n154*n2*n9/n163 + n129*n2) + n130*n251*n50*(pow(alpha, -n166*n5 + n51)*n154*n2*n5/n163 + n130*n2) + n131*n263 + n132*pow(n208, n24)*(pow(alpha, n1*n29 - n166*n9)*n143*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n9)*pow(n163, n24)*n23*n31*pow(n54, n24)*n86*n9 + n113*n143 + n165*n191*n23*n31) + n132*n24*n350 + n133*pow(n213, n24)*(pow(alpha, n1*n29 - n14*n166)*n136*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n14*n166)*n14*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + n115*n136 + n165*n195*n23*n31) + n133*n24*n351 + n134*n264 + n135*n266 + n136*n265 + n137*pow(n210, n24)*n50*xF[16]*(pow(alpha, -n11*n166 + n51)*n11*n154*n2/n163 + n137*n2) + n138*n24*n352 + n139*pow(n212, n24)*n50*xF[1]*(pow(alpha, -n13*n166 + n51)*n154*n77/n163 + n64*n77) + n14*pow(n213, n24)*n50*n65*xF[2]*(pow(alpha, -n14*n166 + n51)*n154*n80/n163 + n65*n80) + n140*pow(n207, n24)*n50*xF[13]*(pow(alpha, -n166*n8 + n51)*n154*n79/n163 + n59*n79) + n141*pow(n218, n24)*n50*xF[7]*(pow(alpha, -n166*n19 + n51)*n154*n82/n163 + n70*n82) + n143*n267 + n144*pow(n209, n24)*n50*xF[15]*(pow(alpha, -n10*n166 + n51)*n154*n81/n163 + n61*n81) + n145*pow(n219, n24)*n50*xF[8]*(pow(alpha, -n166*n20 + n51)*n154*n2*n20/n163 + n153) + n146*pow(n203, n24)*n343 + n146*n24*n319/n221 + n148*pow(n209, n24)*(pow(alpha, n1*n29 - n10*n166)*n10*n119*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n10*n166)*n135*pow(n163, n24)*pow(n54, n24)*n86 + n119*n165*n197 + n135*n61) + n149*pow(n220, n24)*(pow(alpha, n1*n29 - n166*n21)*n119*pow(n163, n24)*n21*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n21)*pow(n163, n24)*n31*n48*pow(n54, n24)*n86 + n119*n165*n199 + n31*n48*n72) + n150*pow(n220, n24)*n50*(pow(alpha, -n166*n21 + n51)*n154*n78/n163 + n72*n78) + n155*n241 + n156*n242 + n157*n239 + n158*n245 + n159*n246 + n160*n240 + n161*n243 + n162*n247 + n17*pow(n216, n24)*n50*n68*xF[5]*(pow(alpha, -n166*n17 + n51)*n154*n75/n163 + n68*n75) + pow(n205, n24)*n50*n57*n6*xF[11]*(pow(alpha, -n166*n6 + n51)*n154*n2*n6/n163 + n152) + pow(n206, n24)*n50*n58*n7*xF[12]*(pow(alpha, -n166*n7 + n51)*n154*n76/n163 + n58*n76) + pow(n207, n24)*n89*xF[13]*(pow(alpha, n1*n29 - n166*n8)*n134*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n8)*pow(n163, n24)*n23*n31*pow(n54, n24)*n8*n86 + n112*n134 + n165*n187*n23*n31) + pow(n217, n24)*n99*xF[6]*(pow(alpha, n1*n29 - n166*n18)*pow(n163, n24)*n18*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n18)*pow(n163, n24)*n31*n45*pow(n54, n24)*n86 + n118*n31*n45 + n165*n190*n23*n31) + n24*n249*n333*n99 + n24*n252*n327*n93 + n24*n254*n322*n88 + n24*n255*n320*n84 + n24*n268*n342 + n24*n270*n331 + n24*n355 + n24*n356 + n269*(pow(alpha, n1*n29 - n16*n166)*n16*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n16*n166)*pow(n163, n24)*n31*n43*pow(n54, n24)*n86 + n116*n31*n43 + n165*n185*n23*n31) + n271*(pow(alpha, n1*n29 - n166*n17)*n119*pow(n163, n24)*n17*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n17)*n126*pow(n163, n24)*pow(n54, n24)*n86 + n119*n165*n202 + n126*n68) + n273*(pow(alpha, n1*n29 - n13*n166)*n119*n13*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n13*n166)*n122*pow(n163, n24)*pow(n54, n24)*n86 + n119*n165*n194 + n122*n64) + n274*(pow(alpha, n1*n29 - n166*n19)*n119*pow(n163, n24)*n19*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n19)*n131*pow(n163, n24)*pow(n54, n24)*n86 + n119*n165*n186 + n131*n70) + n275*(pow(alpha, n1*n29 - n166*n20)*n119*pow(n163, n24)*n20*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n20)*pow(n163, n24)*n31*n47*pow(n54, n24)*n86 + n119*n165*n192 + n158) + n276 + n277 + n278 + n24*n330*n96*xF[3]/n232 + n24*n325*n91*xF[15]/n227 + n24*n323*n89*xF[13]/n225));
-      NP_sqrt_base = (-NP0*n406 - n108*n74*xF[0]/(-n108 - n196 - 1) - n27*(-n100*n74*xF[7]/(n100 - 1 + pow(alpha, -n19*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n101*n74*xF[8]/(n101 - 1 + pow(alpha, -n20*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n102*n74*xF[9]/(n102 - 1 + pow(alpha, -n21*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n121*n74/(n92 - 1 + pow(alpha, -n11*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n132*n74/(n90 - 1 + pow(alpha, -n9*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n133*n74/(n95 - 1 + pow(alpha, -n14*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n138*n74/(n98 - 1 + pow(alpha, -n17*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n146*n74/(pow(alpha, n23*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1)) + n83 - 1) - n74*n84*xF[10]/(n84 - 1 + pow(alpha, -n5*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n74*n87*xF[11]/(n87 - 1 + pow(alpha, -n6*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n74*n88*xF[12]/(n88 - 1 + pow(alpha, -n7*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n74*n89*xF[13]/(n89 - 1 + pow(alpha, -n8*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n74*n91*xF[15]/(n91 - 1 + pow(alpha, -n10*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n74*n93*xF[17]/(n93 - 1 + pow(alpha, -n12*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n74*n94*xF[1]/(n94 - 1 + pow(alpha, -n13*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n74*n96*xF[3]/(n96 - 1 + pow(alpha, -n15*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n74*n97*xF[4]/(n97 - 1 + pow(alpha, -n16*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1))) - n74*n99*xF[6]/(n99 - 1 + pow(alpha, -n18*(n120*(n164 - log(n110*(n25 + n28*xTj)/(n25 - xF[0]*xTj) + 1)) + 1)))) - pow(NP0, -n0)*(1.0*n125*n2*n253*n301*n74 - 0.5*n146*n301*n354*n74 + 0.5*n280 + 0.5*n377 - 0.5*n409))*(-n0*n27*(-n101*n74*xF[8]*(pow(alpha, -n166*n20 + n51)*n154*n2*n20/n163 + n153)*(pow(alpha, -n166*n20 + n51)*n154*n20*n50/n163 + n145*n50)/n237 + n103*n248*n74*(pow(alpha, n1*n29 - n15*n166)*n119*n15*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n15*n166)*pow(n163, n24)*n31*n42*pow(n54, n24)*n86 + pow(alpha, -n15*n166 + n51)*n119*n15*n154/n163 + n162) + n103*n74*xF[3]*(pow(alpha, -n15*n166 + n51)*n15*n154*n2/n163 + n124*n2)*(pow(alpha, -n15*n166 + n51)*n15*n154*n50/n163 + n124*n50)/n232 + n104*pow(n206, n24)*n74*xF[12]*(pow(alpha, n1*n29 - n166*n7)*n119*pow(n163, n24)*pow(n54, n24)*n7*n86 - pow(alpha, n1*n29 - n166*n7)*pow(n163, n24)*n31*n34*pow(n54, n24)*n86 + pow(alpha, -n166*n7 + n51)*n119*n154*n7/n163 + n160) + n104*n254*n74*(pow(alpha, -n166*n7 + n51)*n154*n76/n163 + n58*n76)*(pow(alpha, -n166*n7 + n51)*n154*n50*n7/n163 + n50*n58*n7) + n105*n249*n74*(pow(alpha, -n166*n18 + n51)*n154*n18*n2/n163 + n123*n2)*(pow(alpha, -n166*n18 + n51)*n154*n18*n50/n163 + n123*n50) + n106*n250*n74*(pow(alpha, n1*n29 - n12*n166)*n119*n12*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n12*n166)*pow(n163, n24)*n31*n39*pow(n54, n24)*n86 + pow(alpha, -n12*n166 + n51)*n119*n12*n154/n163 + n155) + n106*n252*n74*(pow(alpha, -n12*n166 + n51)*n12*n154*n2/n163 + n128*n2)*(pow(alpha, -n12*n166 + n51)*n12*n154*n50/n163 + n128*n50) + n107*n251*n74*(pow(alpha, n1*n29 - n166*n5)*n119*pow(n163, n24)*n5*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n5)*pow(n163, n24)*n31*n32*pow(n54, n24)*n86 + pow(alpha, -n166*n5 + n51)*n119*n154*n5/n163 + n161) + n107*n255*n74*(pow(alpha, -n166*n5 + n51)*n154*n2*n5/n163 + n130*n2)*(pow(alpha, -n166*n5 + n51)*n154*n5*n50/n163 + n130*n50) + n108*n74*xF[0]*(pow(alpha, -n1*n166 + n51)*n1*n154*n2/n163 + n125*n2)*(pow(alpha, -n1*n166 + n51)*n0*n154*n2*n23/n163 + n0*n2*n23*n53)/n221 + n109*pow(n205, n24)*n74*xF[11]*(pow(alpha, n1*n29 - n166*n6)*n119*pow(n163, n24)*pow(n54, n24)*n6*n86 - pow(alpha, n1*n29 - n166*n6)*pow(n163, n24)*n31*n33*pow(n54, n24)*n86 + pow(alpha, -n166*n6 + n51)*n119*n154*n6/n163 + n157) + n109*n74*xF[11]*(pow(alpha, -n166*n6 + n51)*n154*n2*n6/n163 + n152)*(pow(alpha, -n166*n6 + n51)*n154*n50*n6/n163 + n50*n57*n6)/n223 + n121*pow(n210, n24)*n74*(pow(alpha, n1*n29 - n11*n166)*n11*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n11*n166)*pow(n163, n24)*n31*n38*pow(n54, n24)*n86 + pow(alpha, -n11*n166 + n51)*n11*n154*n23*n31/n163 + n114*n31*n38) - n121*n74*(pow(alpha, -n11*n166 + n51)*n11*n154*n2/n163 + n137*n2)*(pow(alpha, -n11*n166 + n51)*n11*n154*n50/n163 + n137*n50)/n228 + n132*pow(n208, n24)*n74*(pow(alpha, n1*n29 - n166*n9)*n143*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n9)*pow(n163, n24)*n23*n31*pow(n54, n24)*n86*n9 + pow(alpha, -n166*n9 + n51)*n154*n23*n31*n9/n163 + n113*n143) - n132*n74*(pow(alpha, -n166*n9 + n51)*n154*n2*n9/n163 + n129*n2)*(pow(alpha, -n166*n9 + n51)*n154*n50*n9/n163 + n129*n50)/n226 + n133*pow(n213, n24)*n74*(pow(alpha, n1*n29 - n14*n166)*n136*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n14*n166)*n14*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + pow(alpha, -n14*n166 + n51)*n14*n154*n23*n31/n163 + n115*n136) - n133*n74*(pow(alpha, -n14*n166 + n51)*n154*n80/n163 + n65*n80)*(pow(alpha, -n14*n166 + n51)*n14*n154*n50/n163 + n14*n50*n65)/n231 - n138*n74*(pow(alpha, -n166*n17 + n51)*n154*n75/n163 + n68*n75)*(pow(alpha, -n166*n17 + n51)*n154*n17*n50/n163 + n17*n50*n68)/n234 + n146*pow(n203, n24)*n74*(pow(alpha, -n1*n166 + n51)*n142*(-n25 + xPj*xTj)/(n163*n54) + n110*n142) + n148*pow(n209, n24)*n74*(pow(alpha, n1*n29 - n10*n166)*n10*n119*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n10*n166)*n135*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, -n10*n166 + n51)*n10*n119*n154/n163 + n135*n61) + n148*n74*(pow(alpha, -n10*n166 + n51)*n154*n81/n163 + n61*n81)*(pow(alpha, -n10*n166 + n51)*n10*n154*n50/n163 + n144*n50)/n227 + n149*pow(n220, n24)*n74*(pow(alpha, n1*n29 - n166*n21)*n119*pow(n163, n24)*n21*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n21)*pow(n163, n24)*n31*n48*pow(n54, n24)*n86 + pow(alpha, -n166*n21 + n51)*n119*n154*n21/n163 + n31*n48*n72) + n149*n74*(pow(alpha, -n166*n21 + n51)*n154*n78/n163 + n72*n78)*(pow(alpha, -n166*n21 + n51)*n154*n21*n50/n163 + n21*n50*n72)/n238 + n151*n74*(pow(alpha, -n166*n8 + n51)*n154*n79/n163 + n59*n79)*(pow(alpha, -n166*n8 + n51)*n154*n50*n8/n163 + n140*n50)/n225 + pow(n207, n24)*n74*n89*xF[13]*(pow(alpha, n1*n29 - n166*n8)*n134*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n8)*pow(n163, n24)*n23*n31*pow(n54, n24)*n8*n86 + pow(alpha, -n166*n8 + n51)*n154*n23*n31*n8/n163 + n112*n134) + pow(n217, n24)*n74*n99*xF[6]*(pow(alpha, n1*n29 - n166*n18)*pow(n163, n24)*n18*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n18)*pow(n163, n24)*n31*n45*pow(n54, n24)*n86 + pow(alpha, -n166*n18 + n51)*n154*n18*n23*n31/n163 + n118*n31*n45) - n268*n74*xF[1]*(pow(alpha, -n13*n166 + n51)*n154*n77/n163 + n64*n77)*(pow(alpha, -n13*n166 + n51)*n13*n154*n50/n163 + n139*n50) + n269*n74*(pow(alpha, n1*n29 - n16*n166)*n16*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n16*n166)*pow(n163, n24)*n31*n43*pow(n54, n24)*n86 + pow(alpha, -n16*n166 + n51)*n154*n16*n23*n31/n163 + n116*n31*n43) - n270*n74*(pow(alpha, -n16*n166 + n51)*n154*n16*n2/n163 + n127*n2)*(pow(alpha, -n16*n166 + n51)*n154*n16*n50/n163 + n127*n50) + n271*n74*(pow(alpha, n1*n29 - n166*n17)*n119*pow(n163, n24)*n17*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n17)*n126*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, -n166*n17 + n51)*n119*n154*n17/n163 + n126*n68) + n272*n74*(pow(alpha, -n166*n19 + n51)*n154*n82/n163 + n70*n82)*(pow(alpha, -n166*n19 + n51)*n154*n19*n50/n163 + n141*n50) + n273*n74*(pow(alpha, n1*n29 - n13*n166)*n119*n13*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n13*n166)*n122*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, -n13*n166 + n51)*n119*n13*n154/n163 + n122*n64) + n274*n74*(pow(alpha, n1*n29 - n166*n19)*n119*pow(n163, n24)*n19*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n19)*n131*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, -n166*n19 + n51)*n119*n154*n19/n163 + n131*n70) + n275*n74*(pow(alpha, n1*n29 - n166*n20)*n119*pow(n163, n24)*n20*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n20)*pow(n163, n24)*n31*n47*pow(n54, n24)*n86 + pow(alpha, -n166*n20 + n51)*n119*n154*n20/n163 + n158) + n280 + n281 + n282 + n283 + n284 + n285 + n286 + n287 + n288 + n289 + n290 + n291 + n292 + n293 + n294 + n295 + n296 + n297 + n358 + n359 + n360 + n361 + n362 + n363 + n364 + n365 + n366 + n367 + n368 + n369 + n370 + n371 + n372 + n373 + n374 + n375) - n0*n280 - n0*n377 + 4.0*n125*n2*n253*n301*n74 - 4.0*n146*n319*n74/n221) + pow(-n29*(1.0*n125*n2*n253*n74*(pow(alpha, -n1*n166 + n51)*n1*n154*n2/n163 + n125*n2) + 0.5*n146*pow(n203, n24)*n74*(-pow(alpha, -n1*n166 + n51)*n142*n154/n163 + n110*n142) - 0.5*n146*n74*(pow(alpha, -n1*n166 + n51)*n1*n154*n2/n163 + n125*n2)*(pow(alpha, -n1*n166 + n51)*n0*n154*n2*n23/n163 + n0*n2*n23*n53)/n221 + n298 - 0.5*xTj*(-n101*n74*xF[8]*(pow(alpha, -n166*n20 + n51)*n154*n2*n20/n163 + n153)*(pow(alpha, -n166*n20 + n51)*n154*n20*n50/n163 + n145*n50)/n237 + n103*n248*n74*(pow(alpha, n1*n29 - n15*n166)*n119*n15*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n15*n166)*pow(n163, n24)*n31*n42*pow(n54, n24)*n86 + pow(alpha, -n15*n166 + n51)*n119*n15*n154/n163 + n162) + n103*n74*xF[3]*(pow(alpha, -n15*n166 + n51)*n15*n154*n2/n163 + n124*n2)*(pow(alpha, -n15*n166 + n51)*n15*n154*n50/n163 + n124*n50)/n232 + n104*pow(n206, n24)*n74*xF[12]*(pow(alpha, n1*n29 - n166*n7)*n119*pow(n163, n24)*pow(n54, n24)*n7*n86 - pow(alpha, n1*n29 - n166*n7)*pow(n163, n24)*n31*n34*pow(n54, n24)*n86 + pow(alpha, -n166*n7 + n51)*n119*n154*n7/n163 + n160) + n104*n254*n74*(pow(alpha, -n166*n7 + n51)*n154*n76/n163 + n58*n76)*(pow(alpha, -n166*n7 + n51)*n154*n50*n7/n163 + n50*n58*n7) + n105*n249*n74*(pow(alpha, -n166*n18 + n51)*n154*n18*n2/n163 + n123*n2)*(pow(alpha, -n166*n18 + n51)*n154*n18*n50/n163 + n123*n50) + n106*n250*n74*(pow(alpha, n1*n29 - n12*n166)*n119*n12*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n12*n166)*pow(n163, n24)*n31*n39*pow(n54, n24)*n86 + pow(alpha, -n12*n166 + n51)*n119*n12*n154/n163 + n155) + n106*n252*n74*(pow(alpha, -n12*n166 + n51)*n12*n154*n2/n163 + n128*n2)*(pow(alpha, -n12*n166 + n51)*n12*n154*n50/n163 + n128*n50) + n107*n251*n74*(pow(alpha, n1*n29 - n166*n5)*n119*pow(n163, n24)*n5*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n5)*pow(n163, n24)*n31*n32*pow(n54, n24)*n86 + pow(alpha, -n166*n5 + n51)*n119*n154*n5/n163 + n161) + n107*n255*n74*(pow(alpha, -n166*n5 + n51)*n154*n2*n5/n163 + n130*n2)*(pow(alpha, -n166*n5 + n51)*n154*n5*n50/n163 + n130*n50) + n108*n74*xF[0]*(pow(alpha, -n1*n166 + n51)*n1*n154*n2/n163 + n125*n2)*(pow(alpha, -n1*n166 + n51)*n0*n154*n2*n23/n163 + n0*n2*n23*n53)/n221 + n109*pow(n205, n24)*n74*xF[11]*(pow(alpha, n1*n29 - n166*n6)*n119*pow(n163, n24)*pow(n54, n24)*n6*n86 - pow(alpha, n1*n29 - n166*n6)*pow(n163, n24)*n31*n33*pow(n54, n24)*n86 + pow(alpha, -n166*n6 + n51)*n119*n154*n6/n163 + n157) + n109*n74*xF[11]*(pow(alpha, -n166*n6 + n51)*n154*n2*n6/n163 + n152)*(pow(alpha, -n166*n6 + n51)*n154*n50*n6/n163 + n50*n57*n6)/n223 + n121*pow(n210, n24)*n74*(pow(alpha, n1*n29 - n11*n166)*n11*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n11*n166)*pow(n163, n24)*n31*n38*pow(n54, n24)*n86 + pow(alpha, -n11*n166 + n51)*n11*n154*n23*n31/n163 + n114*n31*n38) - n121*n74*(pow(alpha, -n11*n166 + n51)*n11*n154*n2/n163 + n137*n2)*(pow(alpha, -n11*n166 + n51)*n11*n154*n50/n163 + n137*n50)/n228 + n132*pow(n208, n24)*n74*(pow(alpha, n1*n29 - n166*n9)*n143*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n9)*pow(n163, n24)*n23*n31*pow(n54, n24)*n86*n9 + pow(alpha, -n166*n9 + n51)*n154*n23*n31*n9/n163 + n113*n143) - n132*n74*(pow(alpha, -n166*n9 + n51)*n154*n2*n9/n163 + n129*n2)*(pow(alpha, -n166*n9 + n51)*n154*n50*n9/n163 + n129*n50)/n226 + n133*pow(n213, n24)*n74*(pow(alpha, n1*n29 - n14*n166)*n136*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n14*n166)*n14*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + pow(alpha, -n14*n166 + n51)*n14*n154*n23*n31/n163 + n115*n136) - n133*n74*(pow(alpha, -n14*n166 + n51)*n154*n80/n163 + n65*n80)*(pow(alpha, -n14*n166 + n51)*n14*n154*n50/n163 + n14*n50*n65)/n231 - n138*n74*(pow(alpha, -n166*n17 + n51)*n154*n75/n163 + n68*n75)*(pow(alpha, -n166*n17 + n51)*n154*n17*n50/n163 + n17*n50*n68)/n234 + n146*pow(n203, n24)*n74*(-pow(alpha, -n1*n166 + n51)*n142*n154/n163 + n110*n142) + n148*pow(n209, n24)*n74*(pow(alpha, n1*n29 - n10*n166)*n10*n119*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n10*n166)*n135*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, -n10*n166 + n51)*n10*n119*n154/n163 + n135*n61) + n148*n74*(pow(alpha, -n10*n166 + n51)*n154*n81/n163 + n61*n81)*(pow(alpha, -n10*n166 + n51)*n10*n154*n50/n163 + n144*n50)/n227 + n149*pow(n220, n24)*n74*(pow(alpha, n1*n29 - n166*n21)*n119*pow(n163, n24)*n21*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n21)*pow(n163, n24)*n31*n48*pow(n54, n24)*n86 + pow(alpha, -n166*n21 + n51)*n119*n154*n21/n163 + n31*n48*n72) + n149*n74*(pow(alpha, -n166*n21 + n51)*n154*n78/n163 + n72*n78)*(pow(alpha, -n166*n21 + n51)*n154*n21*n50/n163 + n21*n50*n72)/n238 + n151*n74*(pow(alpha, -n166*n8 + n51)*n154*n79/n163 + n59*n79)*(pow(alpha, -n166*n8 + n51)*n154*n50*n8/n163 + n140*n50)/n225 + pow(n207, n24)*n74*n89*xF[13]*(pow(alpha, n1*n29 - n166*n8)*n134*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n8)*pow(n163, n24)*n23*n31*pow(n54, n24)*n8*n86 + pow(alpha, -n166*n8 + n51)*n154*n23*n31*n8/n163 + n112*n134) + pow(n217, n24)*n74*n99*xF[6]*(pow(alpha, n1*n29 - n166*n18)*pow(n163, n24)*n18*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n166*n18)*pow(n163, n24)*n31*n45*pow(n54, n24)*n86 + pow(alpha, -n166*n18 + n51)*n154*n18*n23*n31/n163 + n118*n31*n45) - n268*n74*xF[1]*(pow(alpha, -n13*n166 + n51)*n154*n77/n163 + n64*n77)*(pow(alpha, -n13*n166 + n51)*n13*n154*n50/n163 + n139*n50) + n269*n74*(pow(alpha, n1*n29 - n16*n166)*n16*pow(n163, n24)*n23*n31*pow(n54, n24)*n86 + pow(alpha, n1*n29 - n16*n166)*pow(n163, n24)*n31*n43*pow(n54, n24)*n86 + pow(alpha, -n16*n166 + n51)*n154*n16*n23*n31/n163 + n116*n31*n43) - n270*n74*(pow(alpha, -n16*n166 + n51)*n154*n16*n2/n163 + n127*n2)*(pow(alpha, -n16*n166 + n51)*n154*n16*n50/n163 + n127*n50) + n271*n74*(pow(alpha, n1*n29 - n166*n17)*n119*pow(n163, n24)*n17*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n17)*n126*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, -n166*n17 + n51)*n119*n154*n17/n163 + n126*n68) + n272*n74*(pow(alpha, -n166*n19 + n51)*n154*n82/n163 + n70*n82)*(pow(alpha, -n166*n19 + n51)*n154*n19*n50/n163 + n141*n50) + n273*n74*(pow(alpha, n1*n29 - n13*n166)*n119*n13*pow(n163, n24)*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n13*n166)*n122*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, -n13*n166 + n51)*n119*n13*n154/n163 + n122*n64) + n274*n74*(pow(alpha, n1*n29 - n166*n19)*n119*pow(n163, n24)*n19*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n19)*n131*pow(n163, n24)*pow(n54, n24)*n86 + pow(alpha, -n166*n19 + n51)*n119*n154*n19/n163 + n131*n70) + n275*n74*(pow(alpha, n1*n29 - n166*n20)*n119*pow(n163, n24)*n20*pow(n54, n24)*n86 - pow(alpha, n1*n29 - n166*n20)*pow(n163, n24)*n31*n47*pow(n54, n24)*n86 + pow(alpha, -n166*n20 + n51)*n119*n154*n20/n163 + n158) + n280 + n281 + n282 + n283 + n284 + n285 + n286 + n287 + n288 + n289 + n290 + n291 + n292 + n293 + n294 + n295 + n296 + n297 + n358 + n359 + n360 + n361 + n362 + n363 + n364 + n365 + n366 + n367 + n368 + n369 + n370 + n371 + n372 + n373 + n374 + n375)) - n406, -n0);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n120*(n164 - log(-pow(alpha, NP1*n1)*n154 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[10] - Mstar;
-      g5 = MW[11] - Mstar;
-      g6 = MW[12] - Mstar;
-      g7 = MW[13] - Mstar;
-      g8 = MW[14] - Mstar;
-      g9 = MW[15] - Mstar;
-      g10 = MW[16] - Mstar;
-      g11 = MW[17] - Mstar;
-      g12 = MW[2] - Mstar;
-      g13 = MW[3] - Mstar;
-      g14 = MW[4] - Mstar;
-      g15 = MW[5] - Mstar;
-      g16 = MW[6] - Mstar;
-      g17 = MW[7] - Mstar;
-      g18 = MW[8] - Mstar;
-      g19 = MW[9] - Mstar;
-      g20 = xF[0] - xTj;
-      g21 = xF[0] - xPj;
-      g22 = -xTj;
-      g23 = 1.0*xF[4];
-      g24 = 1.0*xF[16];
-      g25 = xPj/xF[1];
-      g26 = pow(alpha, -g1);
-      g27 = pow(alpha, -g4);
-      g28 = pow(alpha, -g5);
-      g29 = pow(alpha, -g6);
-      g30 = pow(alpha, -g7);
-      g31 = pow(alpha, -g8);
-      g32 = pow(alpha, -g9);
-      g33 = pow(alpha, -g10);
-      g34 = pow(alpha, -g11);
-      g35 = pow(alpha, -g0);
-      g36 = pow(alpha, -g12);
-      g37 = pow(alpha, -g13);
-      g38 = pow(alpha, -g14);
-      g39 = pow(alpha, -g15);
-      g40 = pow(alpha, -g16);
-      g41 = pow(alpha, -g17);
-      g42 = pow(alpha, -g18);
-      g43 = pow(alpha, -g19);
-      g44 = log(xF[0]/xF[1]);
-      g45 = -g2;
-      g46 = pow(alpha, NP1*g0);
-      g47 = pow(alpha, NP1*g1);
-      g48 = pow(alpha, NP1*g4);
-      g49 = log(g26);
-      g50 = pow(alpha, NP1*g5);
-      g51 = pow(alpha, NP1*g6);
-      g52 = pow(alpha, NP1*g7);
-      g53 = pow(alpha, NP1*g8);
-      g54 = pow(alpha, NP1*g9);
-      g55 = pow(alpha, NP1*g10);
-      g56 = pow(alpha, NP1*g11);
-      g57 = pow(alpha, NP1*g12);
-      g58 = pow(alpha, NP1*g13);
-      g59 = pow(alpha, NP1*g14);
-      g60 = pow(alpha, NP1*g15);
-      g61 = pow(alpha, NP1*g16);
-      g62 = pow(alpha, NP1*g17);
-      g63 = pow(alpha, NP1*g18);
-      g64 = pow(alpha, NP1*g19);
-      g65 = -g44;
-      g66 = g20/g3;
-      g67 = g3/g20;
-      g68 = -g46 + 1;
-      g69 = -g46 + 1;
-      g70 = -g47 + 1;
-      g71 = -g48 + 1;
-      g72 = -g50 + 1;
-      g73 = -g51 + 1;
-      g74 = -g52 + 1;
-      g75 = -g53 + 1;
-      g76 = -g54 + 1;
-      g77 = -g55 + 1;
-      g78 = -g56 + 1;
-      g79 = -g57 + 1;
-      g80 = -g58 + 1;
-      g81 = -g59 + 1;
-      g82 = -g60 + 1;
-      g83 = -g61 + 1;
-      g84 = -g62 + 1;
-      g85 = -g63 + 1;
-      g86 = -g64 + 1;
-      g87 = -g47;
-      g88 = -g48;
-      g89 = -g50;
-      g90 = -g51;
-      g91 = -g52;
-      g92 = -g53;
-      g93 = -g54;
-      g94 = -g55;
-      g95 = -g56;
-      g96 = -g57;
-      g97 = -g58;
-      g98 = -g59;
-      g99 = -g60;
-      g100 = -g61;
-      g101 = -g62;
-      g102 = -g63;
-      g103 = -g64;
-      g104 = -1.0*g44;
-      g105 = -g3/g21;
-      g106 = g21/(g3*xF[1]);
-      g107 = g104*xF[0];
-      g108 = g104*xF[10];
-      g109 = g104*xF[11];
-      g110 = g104*xF[12];
-      g111 = g104*xF[13];
-      g112 = g104*xF[14];
-      g113 = g104*xF[15];
-      g114 = g104*xF[16];
-      g115 = g104*xF[17];
-      g116 = g104*xF[1];
-      g117 = g104*xF[2];
-      g118 = g104*xF[3];
-      g119 = g104*xF[4];
-      g120 = g104*xF[5];
-      g121 = g104*xF[6];
-      g122 = g104*xF[7];
-      g123 = g104*xF[8];
-      g124 = g104*xF[9];
-      g125 = pow(alpha, g0*g45) - 1;
-      g126 = pow(alpha, g0*g45) - 1;
-      g127 = pow(alpha, g1*g45) - 1;
-      g128 = pow(alpha, g4*g45) - 1;
-      g129 = pow(alpha, g45*g5) - 1;
-      g130 = pow(alpha, g45*g6) - 1;
-      g131 = pow(alpha, g45*g7) - 1;
-      g132 = pow(alpha, g45*g8) - 1;
-      g133 = pow(alpha, g45*g9) - 1;
-      g134 = pow(alpha, g10*g45) - 1;
-      g135 = pow(alpha, g11*g45) - 1;
-      g136 = pow(alpha, g12*g45) - 1;
-      g137 = pow(alpha, g13*g45) - 1;
-      g138 = pow(alpha, g14*g45) - 1;
-      g139 = pow(alpha, g15*g45) - 1;
-      g140 = pow(alpha, g16*g45) - 1;
-      g141 = pow(alpha, g17*g45) - 1;
-      g142 = pow(alpha, g18*g45) - 1;
-      g143 = pow(alpha, g19*g45) - 1;
-      g144 = -pow(alpha, g1*g45);
-      g145 = -pow(alpha, g4*g45);
-      g146 = -pow(alpha, g45*g5);
-      g147 = -pow(alpha, g45*g6);
-      g148 = -pow(alpha, g45*g7);
-      g149 = -pow(alpha, g45*g8);
-      g150 = -pow(alpha, g45*g9);
-      g151 = -pow(alpha, g10*g45);
-      g152 = -pow(alpha, g11*g45);
-      g153 = -pow(alpha, g12*g45);
-      g154 = -pow(alpha, g13*g45);
-      g155 = -pow(alpha, g14*g45);
-      g156 = -pow(alpha, g15*g45);
-      g157 = -pow(alpha, g16*g45);
-      g158 = -pow(alpha, g17*g45);
-      g159 = -pow(alpha, g18*g45);
-      g160 = -pow(alpha, g19*g45);
-      g161 = g126 + g69;
-      g162 = -g144 - g47;
-      g163 = -g145 - g48;
-      g164 = -g146 - g50;
-      g165 = -g147 - g51;
-      g166 = -g148 - g52;
-      g167 = -g149 - g53;
-      g168 = -g150 - g54;
-      g169 = -g151 - g55;
-      g170 = -g152 - g56;
-      g171 = -g153 - g57;
-      g172 = -g154 - g58;
-      g173 = -g155 - g59;
-      g174 = -g156 - g60;
-      g175 = -g157 - g61;
-      g176 = -g158 - g62;
-      g177 = -g159 - g63;
-      g178 = -g160 - g64;
-      g179 = pow(alpha, g1*g45) + g87;
-      g180 = g126 + g69;
-      g181 = pow(alpha, g4*g45) + g88;
-      g182 = pow(alpha, g45*g5) + g89;
-      g183 = pow(alpha, g45*g6) + g90;
-      g184 = pow(alpha, g45*g7) + g91;
-      g185 = pow(alpha, g45*g8) + g92;
-      g186 = pow(alpha, g45*g9) + g93;
-      g187 = pow(alpha, g10*g45) + g94;
-      g188 = pow(alpha, g11*g45) + g95;
-      g189 = pow(alpha, g12*g45) + g96;
-      g190 = pow(alpha, g13*g45) + g97;
-      g191 = pow(alpha, g14*g45) + g98;
-      g192 = pow(alpha, g15*g45) + g99;
-      g193 = pow(alpha, g16*g45) + g100;
-      g194 = pow(alpha, g17*g45) + g101;
-      g195 = pow(alpha, g18*g45) + g102;
-      g196 = pow(alpha, g19*g45) + g103;
-      g197 = xF[9]/g196;
-      g198 = xF[8]/g195;
-      g199 = xF[11]/g182;
-      g200 = xF[1]/g180;
-      g201 = xF[10]/g181;
-      g202 = xF[17]/g188;
-      g203 = xF[15]/g186;
-      g204 = xF[3]/g190;
-      g205 = xF[7]/g194;
-      g206 = xF[12]/g183;
-      g207 = xF[13]/g184;
-      g208 = xF[6]/g193;
-      g209 = xF[14]/g185;
-      g210 = xF[5]/g192;
-      g211 = xF[2]/g189;
-      g212 = xF[0]/g179;
-      g213 = xF[4]/g173;
-      g214 = xF[17]/g170;
-      g215 = xF[0]/g162;
-      g216 = xF[16]/g169;
-      g217 = xF[9]/g178;
-      g218 = xF[12]/g165;
-      g219 = xF[15]/g168;
-      g220 = xF[6]/g175;
-      g221 = xF[2]/g171;
-      g222 = xF[13]/g166;
-      g223 = xF[11]/g164;
-      g224 = xF[3]/g172;
-      g225 = xF[5]/g174;
-      g226 = xF[1]/g161;
-      g227 = xF[14]/g167;
-      g228 = xF[8]/g177;
-      g229 = xF[10]/g163;
-      g230 = xF[7]/g176;
-      g231 = g24/g169;
-      g232 = 1.0*g215;
-      g233 = 1.0*g218;
-      g234 = 1.0*g219;
-      g235 = 1.0*g220;
-      g236 = 1.0*g222;
-      g237 = 1.0*g221;
-      g238 = 1.0*g225;
-      g239 = 1.0*g227;
-      g240 = 1.0*g223;
-      g241 = 1.0*g228;
-      g242 = 1.0*g214;
-      g243 = 1.0*g229;
-      g244 = 1.0*g217;
-      g245 = 1.0*g224;
-      g246 = 1.0*g226;
-      g247 = 1.0*g230;
-      g248 = g81/g173;
-      g249 = g73/g165;
-      g250 = g86/g178;
-      g251 = g78/g170;
-      g252 = g76/g168;
-      g253 = g79/g171;
-      g254 = g82/g174;
-      g255 = g83/g175;
-      g256 = g80/g172;
-      g257 = g77/g169;
-      g258 = g72/g164;
-      g259 = g75/g167;
-      g260 = g71/g163;
-      g261 = g70/g162;
-      g262 = g74/g166;
-      g263 = g85/g177;
-      g264 = g68/g161;
-      g265 = g84/g176;
-      g266 = g214*g78;
-      g267 = g217*g86;
-      g268 = g215*g70;
-      g269 = g219*g76;
-      g270 = g221*g79;
-      g271 = g220*g83;
-      g272 = g218*g73;
-      g273 = g228*g85;
-      g274 = g222*g74;
-      g275 = g224*g80;
-      g276 = g216*g77;
-      g277 = g225*g82;
-      g278 = g223*g72;
-      g279 = g229*g71;
-      g280 = g227*g75;
-      g281 = g230*g84;
-      g282 = g226*g68;
-      g283 = g127/g162;
-      g284 = g133/g168;
-      g285 = g129/g164;
-      g286 = g136/g171;
-      g287 = g137/g172;
-      g288 = g138/g173;
-      g289 = g135/g170;
-      g290 = g125/g161;
-      g291 = g142/g177;
-      g292 = g143/g178;
-      g293 = g134/g169;
-      g294 = g140/g175;
-      g295 = g132/g167;
-      g296 = g130/g165;
-      g297 = g131/g166;
-      g298 = g141/g176;
-      g299 = g128/g163;
-      g300 = g139/g174;
-      g301 = g127*g215;
-      g302 = g134*g216;
-      g303 = g130*g218;
-      g304 = g133*g219;
-      g305 = g140*g220;
-      g306 = g136*g221;
-      g307 = g131*g222;
-      g308 = g129*g223;
-      g309 = g137*g224;
-      g310 = g139*g225;
-      g311 = g125*g226;
-      g312 = g132*g227;
-      g313 = g135*g214;
-      g314 = g142*g228;
-      g315 = g128*g229;
-      g316 = g141*g230;
-      g317 = g143*g217;
-      g318 = log(g106*g180*g22/g69);
-      g319 = log(g106*g161*g22/g68);
-      g320 = log(g180*g25*g66/g126);
-      g321 = 1.0*g318;
-      g322 = log(g161*g25*g66/g125);
-      g323 = 1.0*g320;
-      g324 = g248*g319;
-      g325 = g249*g319;
-      g326 = g250*g319;
-      g327 = g261*g319;
-      g328 = g254*g319;
-      g329 = g255*g319;
-      g330 = g252*g319;
-      g331 = g253*g319;
-      g332 = g263*g319;
-      g333 = g262*g319;
-      g334 = g257*g319;
-      g335 = g258*g319;
-      g336 = g259*g319;
-      g337 = g260*g319;
-      g338 = g256*g319;
-      g339 = g251*g319;
-      g340 = g264*g319;
-      g341 = g265*g319;
-      g342 = g293*g322;
-      g343 = g296*g322;
-      g344 = g284*g322;
-      g345 = g294*g322;
-      g346 = g285*g322;
-      g347 = g297*g322;
-      g348 = g287*g322;
-      g349 = g283*g322;
-      g350 = g286*g322;
-      g351 = g289*g322;
-      g352 = g300*g322;
-      g353 = g295*g322;
-      g354 = g291*g322;
-      g355 = g292*g322;
-      g356 = g290*g322;
-      g357 = g299*g322;
-      g358 = g298*g322;
-      g359 = g288*g322;
-      g360 = g107 + g108 + g109 + g110 + g111 + g112 + g113 + g114 + g115 + g116 + g117 + g118 + g119 + g120 + g121 + g122 + g123 + g124;
-      LpF = xF[0]*(g26 + 1.0)*(g327 + g349 + g65)/(g49*(g26 - 1.0)) + xF[10]*(g27 + 1.0)*(g337 + g357 + g65)/(g49*(g27 - 1.0)) + xF[11]*(g28 + 1.0)*(g335 + g346 + g65)/(g49*(g28 - 1.0)) + xF[12]*(g29 + 1.0)*(g325 + g343 + g65)/(g49*(g29 - 1.0)) + xF[13]*(g30 + 1.0)*(g333 + g347 + g65)/(g49*(g30 - 1.0)) + xF[14]*(g31 + 1.0)*(g336 + g353 + g65)/(g49*(g31 - 1.0)) + xF[15]*(g32 + 1.0)*(g330 + g344 + g65)/(g49*(g32 - 1.0)) + xF[16]*(g33 + 1.0)*(g334 + g342 + g65)/(g49*(g33 - 1.0)) + xF[17]*(g34 + 1.0)*(g339 + g351 + g65)/(g49*(g34 - 1.0)) + xF[1]*(g35 + 1.0)*(g340 + g356 + g65)/(g49*(g35 - 1.0)) + xF[2]*(g36 + 1.0)*(g331 + g350 + g65)/(g49*(g36 - 1.0)) + xF[3]*(g37 + 1.0)*(g338 + g348 + g65)/(g49*(g37 - 1.0)) + xF[4]*(g38 + 1.0)*(g324 + g359 + g65)/(g49*(g38 - 1.0)) + xF[5]*(g39 + 1.0)*(g328 + g352 + g65)/(g49*(g39 - 1.0)) + xF[6]*(g40 + 1.0)*(g329 + g345 + g65)/(g49*(g40 - 1.0)) + xF[7]*(g41 + 1.0)*(g341 + g358 + g65)/(g49*(g41 - 1.0)) + xF[8]*(g42 + 1.0)*(g332 + g354 + g65)/(g49*(g42 - 1.0)) + xF[9]*(g43 + 1.0)*(g326 + g355 + g65)/(g49*(g43 - 1.0));
-      PpF = g66;
-      TpF = -g21/g3;
-      SWUpF = -g126*g200*g323 - g197*g321*(g103 + 1) - g197*g323*(pow(alpha, g19*g45) - 1) - g198*g321*(g102 + 1) - g198*g323*(pow(alpha, g18*g45) - 1) - g199*g321*(g89 + 1) - g199*g323*(pow(alpha, g45*g5) - 1) - g200*g321*g69 - g201*g321*(g88 + 1) - g201*g323*(pow(alpha, g4*g45) - 1) - g202*g321*(g95 + 1) - g202*g323*(pow(alpha, g11*g45) - 1) - g203*g321*(g93 + 1) - g203*g323*(pow(alpha, g45*g9) - 1) - g204*g321*(g97 + 1) - g204*g323*(pow(alpha, g13*g45) - 1) - g205*g321*(g101 + 1) - g205*g323*(pow(alpha, g17*g45) - 1) - g206*g321*(g90 + 1) - g206*g323*(pow(alpha, g45*g6) - 1) - g207*g321*(g91 + 1) - g207*g323*(pow(alpha, g45*g7) - 1) - g208*g321*(g100 + 1) - g208*g323*(pow(alpha, g16*g45) - 1) - g209*g321*(g92 + 1) - g209*g323*(pow(alpha, g45*g8) - 1) - g210*g321*(g99 + 1) - g210*g323*(pow(alpha, g15*g45) - 1) - g211*g321*(g96 + 1) - g211*g323*(pow(alpha, g12*g45) - 1) - g212*g321*(g87 + 1) - g212*g323*(pow(alpha, g1*g45) - 1) - g360 - g23*g318*(g98 + 1)/g191 - g23*g320*(pow(alpha, g14*g45) - 1)/g191 - g24*g318*(g94 + 1)/g187 - g24*g320*(pow(alpha, g10*g45) - 1)/g187;
-      SWUpP = -g67*(g125*g246*g322 + g127*g232*g322 + g128*g243*g322 + g129*g240*g322 + g130*g233*g322 + g131*g236*g322 + g132*g239*g322 + g133*g234*g322 + g134*g231*g322 + g135*g242*g322 + g136*g237*g322 + g137*g245*g322 + g139*g238*g322 + g140*g235*g322 + g141*g247*g322 + g142*g241*g322 + g143*g244*g322 + g23*g324 + g23*g359 + g231*g319*g77 + g232*g319*g70 + g233*g319*g73 + g234*g319*g76 + g235*g319*g83 + g236*g319*g74 + g237*g319*g79 + g238*g319*g82 + g239*g319*g75 + g240*g319*g72 + g241*g319*g85 + g242*g319*g78 + g243*g319*g71 + g244*g319*g86 + g245*g319*g80 + g246*g319*g68 + g247*g319*g84 + g360);
-      xP[0] = g301*g67;
-      xP[1] = g311*g67;
-      xP[2] = g306*g67;
-      xP[3] = g309*g67;
-      xP[4] = g138*g213*g67;
-      xP[5] = g310*g67;
-      xP[6] = g305*g67;
-      xP[7] = g316*g67;
-      xP[8] = g314*g67;
-      xP[9] = g317*g67;
-      xP[10] = g315*g67;
-      xP[11] = g308*g67;
-      xP[12] = g303*g67;
-      xP[13] = g307*g67;
-      xP[14] = g312*g67;
-      xP[15] = g304*g67;
-      xP[16] = g302*g67;
-      xP[17] = g313*g67;
-      xT[0] = g105*g268;
-      xT[1] = g105*g282;
-      xT[2] = g105*g270;
-      xT[3] = g105*g275;
-      xT[4] = g105*g213*g81;
-      xT[5] = g105*g277;
-      xT[6] = g105*g271;
-      xT[7] = g105*g281;
-      xT[8] = g105*g273;
-      xT[9] = g105*g267;
-      xT[10] = g105*g279;
-      xT[11] = g105*g278;
-      xT[12] = g105*g272;
-      xT[13] = g105*g274;
-      xT[14] = g105*g280;
-      xT[15] = g105*g269;
-      xT[16] = g105*g276;
-      xT[17] = g105*g266;
-      break;
-    case 19:
-      n0 = MW[0] - Mstar;
-      n1 = log(alpha);
-      n2 = xPj - xTj;
-      n3 = xF[0] - xPj;
-      n4 = MW[10] - Mstar;
-      n5 = MW[11] - Mstar;
-      n6 = MW[12] - Mstar;
-      n7 = MW[13] - Mstar;
-      n8 = MW[14] - Mstar;
-      n9 = MW[15] - Mstar;
-      n10 = MW[16] - Mstar;
-      n11 = MW[17] - Mstar;
-      n12 = MW[18] - Mstar;
-      n13 = MW[1] - Mstar;
-      n14 = MW[2] - Mstar;
-      n15 = MW[3] - Mstar;
-      n16 = MW[4] - Mstar;
-      n17 = MW[5] - Mstar;
-      n18 = MW[6] - Mstar;
-      n19 = MW[7] - Mstar;
-      n20 = MW[8] - Mstar;
-      n21 = MW[9] - Mstar;
-      n22 = log(xTj);
-      n23 = -2;
-      n24 = -n0;
-      n25 = xF[0]*xPj;
-      n26 = -Mstar;
-      n27 = -NP0*n23;
-      n28 = -xTj;
-      n29 = pow(n0, -n23);
-      n30 = pow(n1, -n23);
-      n31 = pow(n4, -n23);
-      n32 = pow(n5, -n23);
-      n33 = pow(n6, -n23);
-      n34 = pow(n7, -n23);
-      n35 = pow(n8, -n23);
-      n36 = pow(n9, -n23);
-      n37 = pow(n10, -n23);
-      n38 = pow(n11, -n23);
-      n39 = pow(n12, -n23);
-      n40 = pow(n13, -n23);
-      n41 = pow(n14, -n23);
-      n42 = pow(n15, -n23);
-      n43 = pow(n16, -n23);
-      n44 = pow(n17, -n23);
-      n45 = pow(n18, -n23);
-      n46 = pow(n19, -n23);
-      n47 = pow(n20, -n23);
-      n48 = pow(n21, -n23);
-      n49 = Mstar*n1;
-      n50 = -n1*n23;
-      n51 = pow(alpha, NP0*n0);
-      n52 = n25 + n28*xF[0];
-      n53 = n25 + n28*xPj;
-      n54 = pow(alpha, NP0*n4);
-      n55 = pow(alpha, NP0*n5);
-      n56 = pow(alpha, NP0*n6);
-      n57 = pow(alpha, NP0*n7);
-      n58 = pow(alpha, NP0*n8);
-      n59 = pow(alpha, NP0*n9);
-      n60 = pow(alpha, NP0*n10);
-      n61 = pow(alpha, NP0*n11);
-      n62 = pow(alpha, NP0*n12);
-      n63 = pow(alpha, NP0*n13);
-      n64 = pow(alpha, NP0*n14);
-      n65 = pow(alpha, NP0*n15);
-      n66 = pow(alpha, NP0*n16);
-      n67 = pow(alpha, NP0*n17);
-      n68 = pow(alpha, NP0*n18);
-      n69 = pow(alpha, NP0*n19);
-      n70 = pow(alpha, NP0*n20);
-      n71 = pow(alpha, NP0*n21);
-      n72 = -MW[0]*n1;
-      n73 = n2/n3;
-      n74 = n1*n12;
-      n75 = n1*n7;
-      n76 = n1*n14;
-      n77 = n1*n9;
-      n78 = -n51 + 1;
-      n79 = -n54 + 1;
-      n80 = pow(alpha, NP0*n23*n24);
-      n81 = pow(n52, -n23);
-      n82 = pow(n53, -n23);
-      n83 = -n55 + 1;
-      n84 = -n56 + 1;
-      n85 = -n57 + 1;
-      n86 = -n58 + 1;
-      n87 = -n59 + 1;
-      n88 = -n60 + 1;
-      n89 = -n61 + 1;
-      n90 = -n62 + 1;
-      n91 = -n63 + 1;
-      n92 = -n64 + 1;
-      n93 = -n65 + 1;
-      n94 = -n66 + 1;
-      n95 = -n67 + 1;
-      n96 = -n68 + 1;
-      n97 = -n69 + 1;
-      n98 = -n70 + 1;
-      n99 = -n71 + 1;
-      n100 = -n51;
-      n101 = -n55;
-      n102 = -n57;
-      n103 = -n58;
-      n104 = -n60;
-      n105 = -n62;
-      n106 = -n64;
-      n107 = -n66;
-      n108 = -n68;
-      n109 = -n73;
-      n110 = n51*xF[0];
-      n111 = 1/(n0*n1);
-      n112 = n88*xF[16];
-      n113 = n1*n73;
-      n114 = n15*n65;
-      n115 = n93*xF[3];
-      n116 = n87*xF[15];
-      n117 = n30*n44;
-      n118 = n1*n66;
-      n119 = n29*n30;
-      n120 = n99*xF[9];
-      n121 = n96*xF[6];
-      n122 = n58*n8;
-      n123 = n97*xF[7];
-      n124 = n1*n51;
-      n125 = n30*n46;
-      n126 = n86*xF[14];
-      n127 = n92*xF[2];
-      n128 = n30*n34;
-      n129 = n11*n61;
-      n130 = n21*n71;
-      n131 = n79*xF[10];
-      n132 = n85*xF[13];
-      n133 = n78*xF[0];
-      n134 = n30*n36;
-      n135 = n30*n41;
-      n136 = n20*n70;
-      n137 = n30*n40;
-      n138 = n10*n60;
-      n139 = n13*n63;
-      n140 = n30*n39;
-      n141 = n4*n54;
-      n142 = n56*n6;
-      n143 = n84*xF[12];
-      n144 = n95*xF[5];
-      n145 = n17*n67;
-      n146 = n18*n68;
-      n147 = n19*n69;
-      n148 = n5*n55;
-      n149 = n30*n35;
-      n150 = n59*n9;
-      n151 = log((-1.0 + xPj/xF[0])/n2);
-      n152 = -n143;
-      n153 = n1*n148;
-      n154 = n1*n129;
-      n155 = n1*n146;
-      n156 = n53/n52;
-      n157 = n1*n142*xF[12];
-      n158 = n146*n50;
-      n159 = n1*n141*xF[10];
-      n160 = n30*n38*n61;
-      n161 = n30*n32*n55;
-      n162 = n30*n47*n70;
-      n163 = n30*n37*n60;
-      n164 = n30*n42*n65;
-      n165 = n30*n33*n56;
-      n166 = n30*n43*n66;
-      n167 = n30*n31*n54;
-      n168 = n30*n45*n68;
-      n169 = n100*n156 + 1;
-      n170 = pow(n169, -n23);
-      n171 = n151 + n22 + n49 + n72;
-      n172 = n124*n156/n169;
-      n173 = n0*n156*n30*n51/n169;
-      n174 = n111*(n171 - log(n169)) + 1;
-      n175 = pow(alpha, n0*n174);
-      n176 = pow(alpha, n174*n4);
-      n177 = pow(alpha, n174*n5);
-      n178 = pow(alpha, n174*n6);
-      n179 = pow(alpha, n174*n7);
-      n180 = pow(alpha, n174*n8);
-      n181 = pow(alpha, n174*n9);
-      n182 = pow(alpha, n10*n174);
-      n183 = pow(alpha, n11*n174);
-      n184 = pow(alpha, n12*n174);
-      n185 = pow(alpha, n13*n174);
-      n186 = pow(alpha, n14*n174);
-      n187 = pow(alpha, n15*n174);
-      n188 = pow(alpha, n16*n174);
-      n189 = pow(alpha, n17*n174);
-      n190 = pow(alpha, n174*n18);
-      n191 = pow(alpha, n174*n19);
-      n192 = pow(alpha, n174*n20);
-      n193 = pow(alpha, n174*n21);
-      n194 = n6/n178;
-      n195 = n12/n184;
-      n196 = n19/n191;
-      n197 = n21/n193;
-      n198 = n11/n183;
-      n199 = n15/n187;
-      n200 = n18/n190;
-      n201 = n8/n180;
-      n202 = n20/n192;
-      n203 = n5/n177;
-      n204 = n13/n185;
-      n205 = n14/n186;
-      n206 = n16/n188;
-      n207 = n9/n181;
-      n208 = n17/n189;
-      n209 = n4/n176;
-      n210 = n10/n182;
-      n211 = n7/n179;
-      n212 = pow(alpha, n174*n24) + n78 - 1;
-      n213 = n79 - 1 + 1.0/n176;
-      n214 = n83 - 1 + 1.0/n177;
-      n215 = n84 - 1 + 1.0/n178;
-      n216 = n85 - 1 + 1.0/n179;
-      n217 = n86 - 1 + 1.0/n180;
-      n218 = n87 - 1 + 1.0/n181;
-      n219 = n88 - 1 + 1.0/n182;
-      n220 = n89 - 1 + 1.0/n183;
-      n221 = n90 - 1 + 1.0/n184;
-      n222 = n91 - 1 + 1.0/n185;
-      n223 = n92 - 1 + 1.0/n186;
-      n224 = n93 - 1 + 1.0/n187;
-      n225 = n94 - 1 + 1.0/n188;
-      n226 = n95 - 1 + 1.0/n189;
-      n227 = n96 - 1 + 1.0/n190;
-      n228 = n97 - 1 + 1.0/n191;
-      n229 = n98 - 1 + 1.0/n192;
-      n230 = n99 - 1 + 1.0/n193;
-      n231 = pow(n212, -n23);
-      n232 = pow(n213, -n23);
-      n233 = pow(n214, -n23);
-      n234 = pow(n215, -n23);
-      n235 = pow(n216, -n23);
-      n236 = pow(n217, -n23);
-      n237 = pow(n218, -n23);
-      n238 = pow(n219, -n23);
-      n239 = pow(n220, -n23);
-      n240 = pow(n221, -n23);
-      n241 = pow(n222, -n23);
-      n242 = pow(n223, -n23);
-      n243 = pow(n224, -n23);
-      n244 = pow(n225, -n23);
-      n245 = pow(n226, -n23);
-      n246 = pow(n227, -n23);
-      n247 = pow(n228, -n23);
-      n248 = pow(n229, -n23);
-      n249 = pow(n230, -n23);
-      n250 = pow(n212, 3);
-      n251 = pow(n213, 3);
-      n252 = pow(n214, 3);
-      n253 = pow(n215, 3);
-      n254 = pow(n216, 3);
-      n255 = pow(n217, 3);
-      n256 = pow(n218, 3);
-      n257 = pow(n219, 3);
-      n258 = pow(n220, 3);
-      n259 = pow(n221, 3);
-      n260 = pow(n222, 3);
-      n261 = pow(n223, 3);
-      n262 = pow(n224, 3);
-      n263 = pow(n225, 3);
-      n264 = pow(n226, 3);
-      n265 = pow(n227, 3);
-      n266 = pow(n228, 3);
-      n267 = pow(n229, 3);
-      n268 = pow(n230, 3);
-      n269 = xF[11]/n214;
-      n270 = xF[17]/n220;
-      n271 = xF[14]/n217;
-      n272 = xF[4]/n225;
-      n273 = xF[8]/n229;
-      n274 = xF[3]/n224;
-      n275 = xF[16]/n219;
-      n276 = xF[9]/n230;
-      n277 = xF[12]/n215;
-      n278 = xF[10]/n213;
-      n279 = xF[6]/n227;
-      n280 = xF[3]/n243;
-      n281 = xF[17]/n239;
-      n282 = -1/n247;
-      n283 = n0*n1/n212;
-      n284 = n67*xF[5]/n226;
-      n285 = n63*xF[1]/n222;
-      n286 = n62*xF[18]/n221;
-      n287 = n69*xF[7]/n228;
-      n288 = n57*xF[13]/n216;
-      n289 = n64*xF[2]/n223;
-      n290 = n59*xF[15]/n218;
-      n291 = n83/n252;
-      n292 = n91/n260;
-      n293 = n78/n231;
-      n294 = n83/n233;
-      n295 = n94/n263;
-      n296 = n144/n245;
-      n297 = n90*xF[18]/n240;
-      n298 = n91*xF[1]/n241;
-      n299 = n94*xF[4]/n244;
-      n300 = n89*xF[17]/n258;
-      n301 = n90*xF[18]/n259;
-      n302 = n98*xF[8]/n248;
-      n303 = n276*n30*n48*n71;
-      n304 = n0*n110*n113/n212;
-      n305 = n110*n113*n24/n212;
-      n306 = n110*n119*n73/n212;
-      n307 = n167*n278*n73;
-      n308 = n161*n269*n73;
-      n309 = n165*n277*n73;
-      n310 = n128*n288*n73;
-      n311 = n149*n271*n58*n73;
-      n312 = n134*n290*n73;
-      n313 = n163*n275*n73;
-      n314 = n160*n270*n73;
-      n315 = n140*n286*n73;
-      n316 = n137*n285*n73;
-      n317 = n135*n289*n73;
-      n318 = n164*n274*n73;
-      n319 = n166*n272*n73;
-      n320 = n117*n284*n73;
-      n321 = n168*n279*n73;
-      n322 = n125*n287*n73;
-      n323 = n162*n273*n73;
-      n324 = n303*n73;
-      n325 = 0.5*n306;
-      n326 = n156/(n169*n175);
-      n327 = n326 + 1;
-      n328 = n0*n124 + n0*n172/n175;
-      n329 = n1*n141 + n172*n209;
-      n330 = n153 + n172*n203;
-      n331 = n1*n142 + n172*n194;
-      n332 = n156*n51*n75/(n169*n179) + n57*n75;
-      n333 = n1*n122 + n172*n201;
-      n334 = n156*n51*n77/(n169*n181) + n59*n77;
-      n335 = n1*n138 + n172*n210;
-      n336 = n154 + n172*n198;
-      n337 = n156*n51*n74/(n169*n184) + n62*n74;
-      n338 = n1*n139 + n172*n204;
-      n339 = n156*n51*n76/(n169*n186) + n64*n76;
-      n340 = n1*n114 + n172*n199;
-      n341 = n118*n16 + n172*n206;
-      n342 = n1*n145 + n172*n208;
-      n343 = n155 + n172*n200;
-      n344 = n1*n147 + n172*n196;
-      n345 = n1*n136 + n172*n202;
-      n346 = n1*n130 + n172*n197;
-      n347 = pow(n328, -n23);
-      n348 = pow(n329, -n23);
-      n349 = pow(n330, -n23);
-      n350 = pow(n331, -n23);
-      n351 = pow(n332, -n23);
-      n352 = pow(n333, -n23);
-      n353 = pow(n334, -n23);
-      n354 = pow(n335, -n23);
-      n355 = pow(n336, -n23);
-      n356 = pow(n337, -n23);
-      n357 = pow(n338, -n23);
-      n358 = pow(n339, -n23);
-      n359 = pow(n340, -n23);
-      n360 = pow(n341, -n23);
-      n361 = pow(n342, -n23);
-      n362 = pow(n343, -n23);
-      n363 = pow(n344, -n23);
-      n364 = pow(n345, -n23);
-      n365 = pow(n346, -n23);
-      n366 = n330*xF[11];
-      n367 = n338*xF[1];
-      n368 = n341*xF[4];
-      n369 = n345*xF[8];
-      n370 = n124*n23*n24 + n172*n23*n24/n175;
-      n371 = n114*n50 + n156*n199*n50*n51/n169;
-      n372 = n129*n50 + n156*n198*n50*n51/n169;
-      n373 = n349*xF[11];
-      n374 = n357*xF[1];
-      n375 = n360*xF[4];
-      n376 = n100*n119*n326 + n100*n119;
-      n377 = n336*n89;
-      n378 = n331/n234;
-      n379 = n328/n231;
-      n380 = n339/n242;
-      n381 = n346/n249;
-      n382 = n329/n232;
-      n383 = n332/n235;
-      n384 = n333/n236;
-      n385 = n334/n237;
-      n386 = n335/n238;
-      n387 = n344/n247;
-      n388 = n359/n262;
-      n389 = n365/n268;
-      n390 = n362/n265;
-      n391 = n353/n256;
-      n392 = n351/n254;
-      n393 = n352/n255;
-      n394 = n363/n266;
-      n395 = n347/n250;
-      n396 = n358/n261;
-      n397 = n350/n253;
-      n398 = n361/n264;
-      n399 = n348/n251;
-      n400 = n354/n257;
-      n401 = n364*n98*xF[8]/n267;
-      n402 = n109*n133*n379;
-      n403 = n133*n376/n231;
-      n404 = n110*n113*n23*n24*(pow(alpha, NP0*n0 + n174*n24)*n0*n1*n156/n169 + n0*n124)/n231;
-      n405 = n141*n50*n73*xF[10]*(pow(alpha, NP0*n0 - n174*n4)*n1*n156*n4/n169 + n1*n141)/n232;
-      n406 = n148*n50*n73*xF[11]*(pow(alpha, NP0*n0 - n174*n5)*n1*n156*n5/n169 + n153)/n233;
-      n407 = n142*n50*n73*xF[12]*(pow(alpha, NP0*n0 - n174*n6)*n1*n156*n6/n169 + n1*n142)/n234;
-      n408 = n50*n57*n7*n73*xF[13]*(pow(alpha, NP0*n0 - n174*n7)*n156*n75/n169 + n57*n75)/n235;
-      n409 = n122*n50*n73*xF[14]*(pow(alpha, NP0*n0 - n174*n8)*n1*n156*n8/n169 + n1*n122)/n236;
-      n410 = n150*n50*n73*xF[15]*(pow(alpha, NP0*n0 - n174*n9)*n156*n77/n169 + n59*n77)/n237;
-      n411 = n138*n50*n73*xF[16]*(pow(alpha, NP0*n0 - n10*n174)*n1*n10*n156/n169 + n1*n138)/n238;
-      n412 = n129*n281*n50*n73*(pow(alpha, NP0*n0 - n11*n174)*n1*n11*n156/n169 + n154);
-      n413 = n12*n50*n62*n73*xF[18]*(pow(alpha, NP0*n0 - n12*n174)*n156*n74/n169 + n62*n74)/n240;
-      n414 = n139*n50*n73*xF[1]*(pow(alpha, NP0*n0 - n13*n174)*n1*n13*n156/n169 + n1*n139)/n241;
-      n415 = n14*n50*n64*n73*xF[2]*(pow(alpha, NP0*n0 - n14*n174)*n156*n76/n169 + n64*n76)/n242;
-      n416 = n114*n280*n50*n73*(pow(alpha, NP0*n0 - n15*n174)*n1*n15*n156/n169 + n1*n114);
-      n417 = n16*n50*n66*n73*xF[4]*(pow(alpha, NP0*n0 - n16*n174)*n1*n156*n16/n169 + n118*n16)/n244;
-      n418 = n145*n50*n73*xF[5]*(pow(alpha, NP0*n0 - n17*n174)*n1*n156*n17/n169 + n1*n145)/n245;
-      n419 = n158*n73*xF[6]*(pow(alpha, NP0*n0 - n174*n18)*n1*n156*n18/n169 + n155)/n246;
-      n420 = n147*n50*n73*xF[7]*(pow(alpha, NP0*n0 - n174*n19)*n1*n156*n19/n169 + n1*n147)/n247;
-      n421 = n136*n50*n73*xF[8]*(pow(alpha, NP0*n0 - n174*n20)*n1*n156*n20/n169 + n1*n136)/n248;
-      n422 = n130*n50*n73*xF[9]*(pow(alpha, NP0*n0 - n174*n21)*n1*n156*n21/n169 + n1*n130)/n249;
-      n423 = 1.0*n0*n110*n113*n379;
-      n424 = n403*n73;
-      n425 = 0.5*n424;
-      n426 = n304 + n402;
-      n427 = n328*n370/n250;
-      n428 = pow(alpha, n0*n27)*n0*n209*n30*n82/(n170*n81) - pow(alpha, n0*n27)*n30*n31*n82/(n170*n176*n81) + n167 + n173*n209;
-      n429 = pow(alpha, n0*n27)*n0*n194*n30*n82/(n170*n81) - pow(alpha, n0*n27)*n30*n33*n82/(n170*n178*n81) + n165 + n173*n194;
-      n430 = pow(alpha, n0*n27)*n128*n82/(n170*n179*n81) + pow(alpha, n0*n27)*n211*n24*n30*n82/(n170*n81) + n102*n128 + n156*n211*n24*n30*n51/n169;
-      n431 = pow(alpha, n0*n27)*n149*n82/(n170*n180*n81) + pow(alpha, n0*n27)*n201*n24*n30*n82/(n170*n81) + n103*n149 + n156*n201*n24*n30*n51/n169;
-      n432 = pow(alpha, n0*n27)*n0*n207*n30*n82/(n170*n81) - pow(alpha, n0*n27)*n134*n82/(n170*n181*n81) + n134*n59 + n173*n207;
-      n433 = pow(alpha, n0*n27)*n210*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27)*n30*n37*n82/(n170*n182*n81) + n104*n30*n37 + n156*n210*n24*n30*n51/n169;
-      n434 = pow(alpha, n0*n27)*n0*n198*n30*n82/(n170*n81) - pow(alpha, n0*n27)*n30*n38*n82/(n170*n183*n81) + n160 + n173*n198;
-      n435 = pow(alpha, n0*n27)*n135*n82/(n170*n186*n81) + pow(alpha, n0*n27)*n205*n24*n30*n82/(n170*n81) + n106*n135 + n156*n205*n24*n30*n51/n169;
-      n436 = pow(alpha, n0*n27)*n0*n199*n30*n82/(n170*n81) - pow(alpha, n0*n27)*n30*n42*n82/(n170*n187*n81) + n164 + n173*n199;
-      n437 = pow(alpha, n0*n27)*n200*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27)*n30*n45*n82/(n170*n190*n81) + n108*n30*n45 + n156*n200*n24*n30*n51/n169;
-      n438 = pow(alpha, n0*n27)*n0*n197*n30*n82/(n170*n81) - pow(alpha, n0*n27)*n30*n48*n82/(n170*n193*n81) + n173*n197 + n30*n48*n71;
-      n439 = n132*n73*(pow(alpha, n0*n27 - n174*n7)*n128*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n7)*n24*n30*n7*n82/(n170*n81) + n102*n128 + n156*n211*n24*n30*n51/n169)/n235;
-      n440 = n126*n73*(pow(alpha, n0*n27 - n174*n8)*n149*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n8)*n24*n30*n8*n82/(n170*n81) + n103*n149 + n156*n201*n24*n30*n51/n169)/n236;
-      n441 = n112*n73*(pow(alpha, n0*n27 - n10*n174)*n10*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n10*n174)*n30*n37*n82/(n170*n81) + n104*n30*n37 + n156*n210*n24*n30*n51/n169)/n238;
-      n442 = n297*n73*(pow(alpha, n0*n27 - n12*n174)*n12*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n12*n174)*n140*n82/(n170*n81) + n105*n140 + n156*n195*n24*n30*n51/n169);
-      n443 = n127*n73*(pow(alpha, n0*n27 - n14*n174)*n135*n82/(n170*n81) + pow(alpha, n0*n27 - n14*n174)*n14*n24*n30*n82/(n170*n81) + n106*n135 + n156*n205*n24*n30*n51/n169)/n242;
-      n444 = n299*n73*(pow(alpha, n0*n27 - n16*n174)*n16*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n16*n174)*n30*n43*n82/(n170*n81) + n107*n30*n43 + n156*n206*n24*n30*n51/n169);
-      n445 = n121*n73*(pow(alpha, n0*n27 - n174*n18)*n18*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n18)*n30*n45*n82/(n170*n81) + n108*n30*n45 + n156*n200*n24*n30*n51/n169)/n246;
-      n446 = n109*n131*(pow(alpha, n0*n27 - n174*n4)*n0*n30*n4*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n4)*n30*n31*n82/(n170*n81) + n167 + n173*n209)/n232;
-      n447 = n109*n294*xF[11]*(pow(alpha, n0*n27 - n174*n5)*n0*n30*n5*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n5)*n30*n32*n82/(n170*n81) + n161 + n173*n203);
-      n448 = n109*n143*(pow(alpha, n0*n27 - n174*n6)*n0*n30*n6*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n6)*n30*n33*n82/(n170*n81) + n165 + n173*n194)/n234;
-      n449 = n109*n116*(pow(alpha, n0*n27 - n174*n9)*n0*n30*n82*n9/(n170*n81) - pow(alpha, n0*n27 - n174*n9)*n134*n82/(n170*n81) + n134*n59 + n173*n207)/n237;
-      n450 = n109*n281*n89*(pow(alpha, n0*n27 - n11*n174)*n0*n11*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n11*n174)*n30*n38*n82/(n170*n81) + n160 + n173*n198);
-      n451 = n109*n298*(pow(alpha, n0*n27 - n13*n174)*n0*n13*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n13*n174)*n137*n82/(n170*n81) + n137*n63 + n173*n204);
-      n452 = n109*n115*(pow(alpha, n0*n27 - n15*n174)*n0*n15*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n15*n174)*n30*n42*n82/(n170*n81) + n164 + n173*n199)/n243;
-      n453 = n109*n296*(pow(alpha, n0*n27 - n17*n174)*n0*n17*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n17*n174)*n117*n82/(n170*n81) + n117*n67 + n173*n208);
-      n454 = n109*n123*(pow(alpha, n0*n27 - n174*n19)*n0*n19*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n19)*n125*n82/(n170*n81) + n125*n69 + n173*n196)/n247;
-      n455 = n109*n302*(pow(alpha, n0*n27 - n174*n20)*n0*n20*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n20)*n30*n47*n82/(n170*n81) + n162 + n173*n202);
-      n456 = n109*n120*(pow(alpha, n0*n27 - n174*n21)*n0*n21*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n21)*n30*n48*n82/(n170*n81) + n173*n197 + n30*n48*n71)/n249;
-      n457 = n325 + n423 + n425;
-      n458 = n109*n112*n386 + n109*n115*n340/n243 + n109*n116*n385 + n109*n120*n381 + n109*n121*n343/n246 + n109*n123*n387 + n109*n126*n384 + n109*n127*n380 + n109*n131*n382 + n109*n132*n383 + n109*n143*n378 + n109*n281*n377 + n109*n294*n366 + n109*n296*n342 + n109*n297*n337 + n109*n298*n338 + n109*n299*n341 + n109*n302*n345 + n113*n114*n274 + n113*n122*n271 + n113*n129*n270 + n113*n130*n276 + n113*n136*n273 + n113*n138*n275 + n113*n139*xF[1]/n222 + n113*n141*n278 + n113*n142*n277 + n113*n145*xF[5]/n226 + n113*n146*n279 + n113*n147*xF[7]/n228 + n113*n148*n269 + n113*n16*n272*n66 + n286*n73*n74 + n288*n73*n75 + n289*n73*n76 + n290*n73*n77 + n426;
-      n459 = n306 + n307 + n308 + n309 + n310 + n311 + n312 + n313 + n314 + n315 + n316 + n317 + n318 + n319 + n320 + n321 + n322 + n323 + n324 + n404 + n405 + n406 + n407 + n408 + n409 + n410 + n411 + n412 + n413 + n414 + n415 + n416 + n417 + n418 + n419 + n420 + n421 + n422 + n424 + n439 + n440 + n441 + n442 + n443 + n444 + n445 + n446 + n447 + n448 + n449 + n450 + n451 + n452 + n453 + n454 + n455 + n456;
-      n460 = n109*n112*n335*(n138*n50 + n156*n210*n50*n51/n169)/n257 + n109*n115*n340*n371/n262 + n109*n116*n334*(n150*n50 + n156*n207*n50*n51/n169)/n256 + n109*n120*n346*(n130*n50 + n156*n197*n50*n51/n169)/n268 + n109*n121*n343*(n156*n200*n50*n51/n169 + n158)/n265 + n109*n123*n344*(n147*n50 + n156*n196*n50*n51/n169)/n266 + n109*n126*n333*(n122*n50 + n156*n201*n50*n51/n169)/n255 + n109*n127*n339*(n14*n50*n64 + n156*n205*n50*n51/n169)/n261 + n109*n131*n329*(n141*n50 + n156*n209*n50*n51/n169)/n251 + n109*n132*n332*(n156*n211*n50*n51/n169 + n50*n57*n7)/n254 + n109*n133*n427 + n109*n143*n331*(n142*n50 + n156*n194*n50*n51/n169)/n253 + n109*n144*n342*(n145*n50 + n156*n208*n50*n51/n169)/n264 + n109*n291*n366*(n148*n50 + n156*n203*n50*n51/n169) + n109*n292*n367*(n139*n50 + n156*n204*n50*n51/n169) + n109*n295*n368*(n156*n206*n50*n51/n169 + n16*n50*n66) + n109*n300*n336*n372 + n109*n301*n337*(n12*n50*n62 + n156*n195*n50*n51/n169) + n109*n369*n98*(n136*n50 + n156*n202*n50*n51/n169)/n267 + n459;
-      NP_b = -n0*n110*n113*n293*n327 - n27*(1.0*n0*n110*n113*(pow(alpha, NP0*n0 - n0*n174)*n0*n1*n156/n169 + n0*n124)/n231 - 1.0*n133*n395*n73 + 0.5*n133*n73*(pow(alpha, NP0*n0 - n0*n174)*n119*(-n25 + xPj*xTj)/(n169*n52) + n100*n119)/n231 + n325 - 0.5*xTj*(n109*n115*(pow(alpha, NP0*n0 - n15*n174)*n0*n15*n156*n30/n169 + pow(alpha, n0*n27 - n15*n174)*n0*n15*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n15*n174)*n30*n42*n82/(n170*n81) + n164)/n243 + n109*n116*(pow(alpha, NP0*n0 - n174*n9)*n0*n156*n30*n9/n169 + pow(alpha, n0*n27 - n174*n9)*n0*n30*n82*n9/(n170*n81) - pow(alpha, n0*n27 - n174*n9)*n134*n82/(n170*n81) + n134*n59)/n237 + n109*n120*(pow(alpha, NP0*n0 - n174*n21)*n0*n156*n21*n30/n169 + pow(alpha, n0*n27 - n174*n21)*n0*n21*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n21)*n30*n48*n82/(n170*n81) + n30*n48*n71)/n249 + n109*n123*(pow(alpha, NP0*n0 - n174*n19)*n0*n156*n19*n30/n169 + pow(alpha, n0*n27 - n174*n19)*n0*n19*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n19)*n125*n82/(n170*n81) + n125*n69)/n247 + n109*n131*(pow(alpha, NP0*n0 - n174*n4)*n0*n156*n30*n4/n169 + pow(alpha, n0*n27 - n174*n4)*n0*n30*n4*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n4)*n30*n31*n82/(n170*n81) + n167)/n232 + n109*n143*(pow(alpha, NP0*n0 - n174*n6)*n0*n156*n30*n6/n169 + pow(alpha, n0*n27 - n174*n6)*n0*n30*n6*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n6)*n30*n33*n82/(n170*n81) + n165)/n234 + n109*n281*n89*(pow(alpha, NP0*n0 - n11*n174)*n0*n11*n156*n30/n169 + pow(alpha, n0*n27 - n11*n174)*n0*n11*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n11*n174)*n30*n38*n82/(n170*n81) + n160) + n109*n294*xF[11]*(pow(alpha, NP0*n0 - n174*n5)*n0*n156*n30*n5/n169 + pow(alpha, n0*n27 - n174*n5)*n0*n30*n5*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n5)*n30*n32*n82/(n170*n81) + n161) + n109*n296*(pow(alpha, NP0*n0 - n17*n174)*n0*n156*n17*n30/n169 + pow(alpha, n0*n27 - n17*n174)*n0*n17*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n17*n174)*n117*n82/(n170*n81) + n117*n67) + n109*n298*(pow(alpha, NP0*n0 - n13*n174)*n0*n13*n156*n30/n169 + pow(alpha, n0*n27 - n13*n174)*n0*n13*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n13*n174)*n137*n82/(n170*n81) + n137*n63) + n109*n302*(pow(alpha, NP0*n0 - n174*n20)*n0*n156*n20*n30/n169 + pow(alpha, n0*n27 - n174*n20)*n0*n20*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n20)*n30*n47*n82/(n170*n81) + n162) + n112*n23*n400*n73 + n112*n73*(pow(alpha, NP0*n0 - n10*n174)*n10*n156*n24*n30/n169 + pow(alpha, n0*n27 - n10*n174)*n10*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n10*n174)*n30*n37*n82/(n170*n81) + n104*n30*n37)/n238 + n115*n23*n388*n73 + n116*n23*n391*n73 + n120*n23*n389*n73 + n121*n23*n390*n73 + n121*n73*(pow(alpha, NP0*n0 - n174*n18)*n156*n18*n24*n30/n169 + pow(alpha, n0*n27 - n174*n18)*n18*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n18)*n30*n45*n82/(n170*n81) + n108*n30*n45)/n246 + n123*n23*n394*n73 + n126*n23*n393*n73 + n126*n73*(pow(alpha, NP0*n0 - n174*n8)*n156*n24*n30*n8/n169 + pow(alpha, n0*n27 - n174*n8)*n149*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n8)*n24*n30*n8*n82/(n170*n81) + n103*n149)/n236 + n127*n23*n396*n73 + n127*n73*(pow(alpha, NP0*n0 - n14*n174)*n14*n156*n24*n30/n169 + pow(alpha, n0*n27 - n14*n174)*n135*n82/(n170*n81) + pow(alpha, n0*n27 - n14*n174)*n14*n24*n30*n82/(n170*n81) + n106*n135)/n242 + n131*n23*n399*n73 + n132*n23*n392*n73 + n132*n73*(pow(alpha, NP0*n0 - n174*n7)*n156*n24*n30*n7/n169 + pow(alpha, n0*n27 - n174*n7)*n128*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n7)*n24*n30*n7*n82/(n170*n81) + n102*n128)/n235 + n133*n23*n395*n73 + n133*n73*(pow(alpha, NP0*n0 - n0*n174)*n119*(-n25 + xPj*xTj)/(n169*n52) + n100*n119)/n231 + n143*n23*n397*n73 + n144*n23*n398*n73 + n23*n291*n373*n73 + n23*n292*n374*n73 + n23*n295*n375*n73 + n23*n300*n355*n73 + n23*n301*n356*n73 + n23*n401*n73 + n297*n73*(pow(alpha, NP0*n0 - n12*n174)*n12*n156*n24*n30/n169 + pow(alpha, n0*n27 - n12*n174)*n12*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n12*n174)*n140*n82/(n170*n81) + n105*n140) + n299*n73*(pow(alpha, NP0*n0 - n16*n174)*n156*n16*n24*n30/n169 + pow(alpha, n0*n27 - n16*n174)*n16*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n16*n174)*n30*n43*n82/(n170*n81) + n107*n30*n43) + n306 + n307 + n308 + n309 + n310 + n311 + n312 + n313 + n314 + n315 + n316 + n317 + n318 + n319 + n320 + n321 + n322 + n323 + n324 + n404 + n405 + n406 + n407 + n408 + n409 + n410 + n411 + n412 + n413 + n414 + n415 + n416 + n417 + n418 + n419 + n420 + n421 + n422)) - n305 - n73*xTj*(n1*n114*n274 + n1*n122*n271 + n1*n130*n276 + n1*n136*n273 + n1*n138*n275 + n1*n139*xF[1]/n222 + n1*n145*xF[5]/n226 + n1*n147*xF[7]/n228 + n110*n283 - n112*n386 - n115*n340/n243 - n116*n385 + n118*n16*n272 - n120*n381 - n121*n343/n246 + n123*n282*n344 - n126*n384 - n127*n380 - n131*n382 - n132*n383 - n133*n379 + n152*n378 + n153*n269 + n154*n270 + n155*n279 + n157/n215 + n159/n213 - n281*n377 + n286*n74 + n288*n75 + n289*n76 + n290*n77 - n294*n366 - n296*n342 - n297*n337 - n298*n338 - n299*n341 - n302*n345);
-      NP_2a = -n73*(-pow(alpha, n0*n27)*n119*n133*n23*pow(n327, -n23)/n250 - 2.0*pow(alpha, n0*n27)*n119*n327*xF[0]/n231 + n100*n119*n133*(-1 + (-n25 + xPj*xTj)/(n169*n175*n52))/n231 - 1.0*n110*n119/n212 + 1.0*xTj*(n1*n110*n23*n24*(pow(alpha, NP0*n0 + n174*n24)*n0*n1*n156/n169 + n0*n124)/n231 + n110*n119/n212 + n112*n23*n400 + n112*(pow(alpha, n0*n27 - n10*n174)*n10*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n10*n174)*n30*n37*n82/(n170*n81) + n104*n30*n37 + n156*n210*n24*n30*n51/n169)/n238 + n114*n280*n50*(pow(alpha, NP0*n0 - n15*n174)*n1*n15*n156/n169 + n1*n114) + n115*n23*n388 - n115*(pow(alpha, n0*n27 - n15*n174)*n0*n15*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n15*n174)*n30*n42*n82/(n170*n81) + n164 + n173*n199)/n243 + n116*n23*n391 - n116*(pow(alpha, n0*n27 - n174*n9)*n0*n30*n82*n9/(n170*n81) - pow(alpha, n0*n27 - n174*n9)*n134*n82/(n170*n81) + n134*n59 + n173*n207)/n237 + n117*n284 + n12*n50*n62*xF[18]*(pow(alpha, NP0*n0 - n12*n174)*n156*n74/n169 + n62*n74)/n240 + n120*n23*n389 - n120*(pow(alpha, n0*n27 - n174*n21)*n0*n21*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n21)*n30*n48*n82/(n170*n81) + n173*n197 + n30*n48*n71)/n249 + n121*n23*n390 + n121*(pow(alpha, n0*n27 - n174*n18)*n18*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n18)*n30*n45*n82/(n170*n81) + n108*n30*n45 + n156*n200*n24*n30*n51/n169)/n246 + n122*n50*xF[14]*(pow(alpha, NP0*n0 - n174*n8)*n1*n156*n8/n169 + n1*n122)/n236 + n123*n23*n394 + n123*n282*(pow(alpha, n0*n27 - n174*n19)*n0*n19*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n19)*n125*n82/(n170*n81) + n125*n69 + n173*n196) + n125*n287 + n126*n23*n393 + n126*(pow(alpha, n0*n27 - n174*n8)*n149*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n8)*n24*n30*n8*n82/(n170*n81) + n103*n149 + n156*n201*n24*n30*n51/n169)/n236 + n127*n23*n396 + n127*(pow(alpha, n0*n27 - n14*n174)*n135*n82/(n170*n81) + pow(alpha, n0*n27 - n14*n174)*n14*n24*n30*n82/(n170*n81) + n106*n135 + n156*n205*n24*n30*n51/n169)/n242 + n128*n288 + n129*n281*n50*(pow(alpha, NP0*n0 - n11*n174)*n1*n11*n156/n169 + n154) + n130*n50*xF[9]*(pow(alpha, NP0*n0 - n174*n21)*n1*n156*n21/n169 + n1*n130)/n249 + n131*n23*n399 - n131*(pow(alpha, n0*n27 - n174*n4)*n0*n30*n4*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n4)*n30*n31*n82/(n170*n81) + n167 + n173*n209)/n232 + n132*n23*n392 + n132*(pow(alpha, n0*n27 - n174*n7)*n128*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n7)*n24*n30*n7*n82/(n170*n81) + n102*n128 + n156*n211*n24*n30*n51/n169)/n235 + n133*n23*n395 + n134*n290 + n135*n289 + n136*n50*xF[8]*(pow(alpha, NP0*n0 - n174*n20)*n1*n156*n20/n169 + n1*n136)/n248 + n137*n285 + n138*n50*xF[16]*(pow(alpha, NP0*n0 - n10*n174)*n1*n10*n156/n169 + n1*n138)/n238 + n139*n50*xF[1]*(pow(alpha, NP0*n0 - n13*n174)*n1*n13*n156/n169 + n1*n139)/n241 + n14*n50*n64*xF[2]*(pow(alpha, NP0*n0 - n14*n174)*n156*n76/n169 + n64*n76)/n242 + n140*n286 + n141*n50*xF[10]*(pow(alpha, NP0*n0 - n174*n4)*n1*n156*n4/n169 + n1*n141)/n232 + n142*n50*xF[12]*(pow(alpha, NP0*n0 - n174*n6)*n1*n156*n6/n169 + n1*n142)/n234 + n143*n23*n397 + n144*n23*n398 + n145*n50*xF[5]*(pow(alpha, NP0*n0 - n17*n174)*n1*n156*n17/n169 + n1*n145)/n245 + n147*n50*xF[7]*(pow(alpha, NP0*n0 - n174*n19)*n1*n156*n19/n169 + n1*n147)/n247 + n148*n50*xF[11]*(pow(alpha, NP0*n0 - n174*n5)*n1*n156*n5/n169 + n153)/n233 + n149*n271*n58 + n150*n50*xF[15]*(pow(alpha, NP0*n0 - n174*n9)*n156*n77/n169 + n59*n77)/n237 + n152*(pow(alpha, n0*n27 - n174*n6)*n0*n30*n6*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n6)*n30*n33*n82/(n170*n81) + n165 + n173*n194)/n234 + n158*xF[6]*(pow(alpha, NP0*n0 - n174*n18)*n1*n156*n18/n169 + n155)/n246 + n16*n50*n66*xF[4]*(pow(alpha, NP0*n0 - n16*n174)*n1*n156*n16/n169 + n118*n16)/n244 + n160*n270 + n161*n269 + n162*n273 + n163*n275 + n164*n274 + n165*n277 + n166*n272 + n167*n278 + n168*n279 + n23*n291*n373 + n23*n292*n374 + n23*n295*n375 + n23*n300*n355 + n23*n301*n356 + n23*n401 - n281*n89*(pow(alpha, n0*n27 - n11*n174)*n0*n11*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n11*n174)*n30*n38*n82/(n170*n81) + n160 + n173*n198) + n294*xF[11]*(pow(alpha, n0*n27 - n174*n5)*n24*n30*n5*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n5)*n30*n32*n82/(n170*n81) + n101*n30*n32 + n156*n203*n24*n30*n51/n169) - n296*(pow(alpha, n0*n27 - n17*n174)*n0*n17*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n17*n174)*n117*n82/(n170*n81) + n117*n67 + n173*n208) + n297*(pow(alpha, n0*n27 - n12*n174)*n12*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n12*n174)*n140*n82/(n170*n81) + n105*n140 + n156*n195*n24*n30*n51/n169) - n298*(pow(alpha, n0*n27 - n13*n174)*n0*n13*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n13*n174)*n137*n82/(n170*n81) + n137*n63 + n173*n204) + n299*(pow(alpha, n0*n27 - n16*n174)*n16*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n16*n174)*n30*n43*n82/(n170*n81) + n107*n30*n43 + n156*n206*n24*n30*n51/n169) - n302*(pow(alpha, n0*n27 - n174*n20)*n0*n20*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n20)*n30*n47*n82/(n170*n81) + n162 + n173*n202) + n303 + n403 + n50*n57*n7*xF[13]*(pow(alpha, NP0*n0 - n174*n7)*n156*n75/n169 + n57*n75)/n235));
-      NP_sqrt_base = (NP0*(n28*(n109*n112*(pow(alpha, NP0*n0 - n10*n174)*n1*n10*n156/n169 + n1*n138)/n238 + n109*n115*(pow(alpha, NP0*n0 - n15*n174)*n1*n15*n156/n169 + n1*n114)/n243 + n109*n116*(pow(alpha, NP0*n0 - n174*n9)*n156*n77/n169 + n59*n77)/n237 + n109*n120*(pow(alpha, NP0*n0 - n174*n21)*n1*n156*n21/n169 + n1*n130)/n249 + n109*n121*(pow(alpha, NP0*n0 - n174*n18)*n1*n156*n18/n169 + n155)/n246 + n109*n123*(pow(alpha, NP0*n0 - n174*n19)*n1*n156*n19/n169 + n1*n147)/n247 + n109*n126*(pow(alpha, NP0*n0 - n174*n8)*n1*n156*n8/n169 + n1*n122)/n236 + n109*n127*(pow(alpha, NP0*n0 - n14*n174)*n156*n76/n169 + n64*n76)/n242 + n109*n131*(pow(alpha, NP0*n0 - n174*n4)*n1*n156*n4/n169 + n1*n141)/n232 + n109*n132*(pow(alpha, NP0*n0 - n174*n7)*n156*n75/n169 + n57*n75)/n235 + n109*n133*(pow(alpha, NP0*n0 - n0*n174)*n0*n1*n156/n169 + n0*n124)/n231 + n109*n143*(pow(alpha, NP0*n0 - n174*n6)*n1*n156*n6/n169 + n1*n142)/n234 + n109*n281*n89*(pow(alpha, NP0*n0 - n11*n174)*n1*n11*n156/n169 + n154) + n109*n294*xF[11]*(pow(alpha, NP0*n0 - n174*n5)*n1*n156*n5/n169 + n153) + n109*n296*(pow(alpha, NP0*n0 - n17*n174)*n1*n156*n17/n169 + n1*n145) + n109*n297*(pow(alpha, NP0*n0 - n12*n174)*n156*n74/n169 + n62*n74) + n109*n298*(pow(alpha, NP0*n0 - n13*n174)*n1*n13*n156/n169 + n1*n139) + n109*n299*(pow(alpha, NP0*n0 - n16*n174)*n1*n156*n16/n169 + n118*n16) + n109*n302*(pow(alpha, NP0*n0 - n174*n20)*n1*n156*n20/n169 + n1*n136) + n113*n114*n274 + n113*n122*n271 + n113*n129*n270 + n113*n130*n276 + n113*n136*n273 + n113*n138*n275 + n113*n139*xF[1]/n222 + n113*n141*n278 + n113*n142*n277 + n113*n145*xF[5]/n226 + n113*n146*n279 + n113*n147*xF[7]/n228 + n113*n148*n269 + n113*n16*n272*n66 + n286*n73*n74 + n288*n73*n75 + n289*n73*n76 + n290*n73*n77 + n304) + n426) + n133*n73/n212 + xTj*(n109*n112/n219 + n109*n115/n224 + n109*n116/n218 + n109*n120/n230 + n109*n121/n227 + n109*n123/n228 + n109*n126/n217 + n109*n127/n223 + n109*n131/n213 + n109*n132/n216 + n109*n133/n212 + n109*n143/n215 + n109*n144/n226 + n109*n269*n83 + n109*n270*n89 + n109*n272*n94 + n109*n273*n98 + n109*n91*xF[1]/n222 + n109*n90*xF[18]/n221) + pow(NP0, -n23)*(-1.0*n0*n110*n113*n379 + 0.5*n133*n427*n73 - 0.5*n306 - 0.5*n424 + 0.5*n460*xTj))*(4.0*n0*n110*n113*n379 - 4.0*n133*n395*n73 - n23*n28*(n109*n112*(pow(alpha, NP0*n0 - n10*n174)*n1*n10*n156/n169 + n1*n138)*(pow(alpha, NP0*n0 - n10*n174)*n10*n156*n50/n169 + n138*n50)/n257 + n109*n115*(pow(alpha, NP0*n0 - n15*n174)*n1*n15*n156/n169 + n1*n114)*(pow(alpha, NP0*n0 - n15*n174)*n15*n156*n50/n169 + n114*n50)/n262 + n109*n115*(pow(alpha, NP0*n0 - n15*n174)*n0*n15*n156*n30/n169 + pow(alpha, n0*n27 - n15*n174)*n0*n15*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n15*n174)*n30*n42*n82/(n170*n81) + n164)/n243 + n109*n116*(pow(alpha, NP0*n0 - n174*n9)*n156*n77/n169 + n59*n77)*(pow(alpha, NP0*n0 - n174*n9)*n156*n50*n9/n169 + n150*n50)/n256 + n109*n116*(pow(alpha, NP0*n0 - n174*n9)*n0*n156*n30*n9/n169 + pow(alpha, n0*n27 - n174*n9)*n0*n30*n82*n9/(n170*n81) - pow(alpha, n0*n27 - n174*n9)*n134*n82/(n170*n81) + n134*n59)/n237 + n109*n120*(pow(alpha, NP0*n0 - n174*n21)*n1*n156*n21/n169 + n1*n130)*(pow(alpha, NP0*n0 - n174*n21)*n156*n21*n50/n169 + n130*n50)/n268 + n109*n120*(pow(alpha, NP0*n0 - n174*n21)*n0*n156*n21*n30/n169 + pow(alpha, n0*n27 - n174*n21)*n0*n21*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n21)*n30*n48*n82/(n170*n81) + n30*n48*n71)/n249 + n109*n121*(pow(alpha, NP0*n0 - n174*n18)*n1*n156*n18/n169 + n155)*(pow(alpha, NP0*n0 - n174*n18)*n156*n18*n50/n169 + n158)/n265 + n109*n123*(pow(alpha, NP0*n0 - n174*n19)*n1*n156*n19/n169 + n1*n147)*(pow(alpha, NP0*n0 - n174*n19)*n156*n19*n50/n169 + n147*n50)/n266 + n109*n123*(pow(alpha, NP0*n0 - n174*n19)*n0*n156*n19*n30/n169 + pow(alpha, n0*n27 - n174*n19)*n0*n19*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n19)*n125*n82/(n170*n81) + n125*n69)/n247 + n109*n126*(pow(alpha, NP0*n0 - n174*n8)*n1*n156*n8/n169 + n1*n122)*(pow(alpha, NP0*n0 - n174*n8)*n156*n50*n8/n169 + n122*n50)/n255 + n109*n127*(pow(alpha, NP0*n0 - n14*n174)*n156*n76/n169 + n64*n76)*(pow(alpha, NP0*n0 - n14*n174)*n14*n156*n50/n169 + n14*n50*n64)/n261 + n109*n131*(pow(alpha, NP0*n0 - n174*n4)*n1*n156*n4/n169 + n1*n141)*(pow(alpha, NP0*n0 - n174*n4)*n156*n4*n50/n169 + n141*n50)/n251 + n109*n131*(pow(alpha, NP0*n0 - n174*n4)*n0*n156*n30*n4/n169 + pow(alpha, n0*n27 - n174*n4)*n0*n30*n4*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n4)*n30*n31*n82/(n170*n81) + n167)/n232 + n109*n132*(pow(alpha, NP0*n0 - n174*n7)*n156*n75/n169 + n57*n75)*(pow(alpha, NP0*n0 - n174*n7)*n156*n50*n7/n169 + n50*n57*n7)/n254 + n109*n133*(pow(alpha, NP0*n0 - n0*n174)*n0*n1*n156/n169 + n0*n124)*(pow(alpha, NP0*n0 - n0*n174)*n1*n156*n23*n24/n169 + n124*n23*n24)/n250 + n109*n143*(pow(alpha, NP0*n0 - n174*n6)*n1*n156*n6/n169 + n1*n142)*(pow(alpha, NP0*n0 - n174*n6)*n156*n50*n6/n169 + n142*n50)/n253 + n109*n143*(pow(alpha, NP0*n0 - n174*n6)*n0*n156*n30*n6/n169 + pow(alpha, n0*n27 - n174*n6)*n0*n30*n6*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n6)*n30*n33*n82/(n170*n81) + n165)/n234 + n109*n144*(pow(alpha, NP0*n0 - n17*n174)*n1*n156*n17/n169 + n1*n145)*(pow(alpha, NP0*n0 - n17*n174)*n156*n17*n50/n169 + n145*n50)/n264 + n109*n281*n89*(pow(alpha, NP0*n0 - n11*n174)*n0*n11*n156*n30/n169 + pow(alpha, n0*n27 - n11*n174)*n0*n11*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n11*n174)*n30*n38*n82/(n170*n81) + n160) + n109*n291*xF[11]*(pow(alpha, NP0*n0 - n174*n5)*n1*n156*n5/n169 + n153)*(pow(alpha, NP0*n0 - n174*n5)*n156*n5*n50/n169 + n148*n50) + n109*n292*xF[1]*(pow(alpha, NP0*n0 - n13*n174)*n1*n13*n156/n169 + n1*n139)*(pow(alpha, NP0*n0 - n13*n174)*n13*n156*n50/n169 + n139*n50) + n109*n294*xF[11]*(pow(alpha, NP0*n0 - n174*n5)*n0*n156*n30*n5/n169 + pow(alpha, n0*n27 - n174*n5)*n0*n30*n5*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n5)*n30*n32*n82/(n170*n81) + n161) + n109*n295*xF[4]*(pow(alpha, NP0*n0 - n16*n174)*n1*n156*n16/n169 + n118*n16)*(pow(alpha, NP0*n0 - n16*n174)*n156*n16*n50/n169 + n16*n50*n66) + n109*n296*(pow(alpha, NP0*n0 - n17*n174)*n0*n156*n17*n30/n169 + pow(alpha, n0*n27 - n17*n174)*n0*n17*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n17*n174)*n117*n82/(n170*n81) + n117*n67) + n109*n298*(pow(alpha, NP0*n0 - n13*n174)*n0*n13*n156*n30/n169 + pow(alpha, n0*n27 - n13*n174)*n0*n13*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n13*n174)*n137*n82/(n170*n81) + n137*n63) + n109*n300*(pow(alpha, NP0*n0 - n11*n174)*n1*n11*n156/n169 + n154)*(pow(alpha, NP0*n0 - n11*n174)*n11*n156*n50/n169 + n129*n50) + n109*n301*(pow(alpha, NP0*n0 - n12*n174)*n156*n74/n169 + n62*n74)*(pow(alpha, NP0*n0 - n12*n174)*n12*n156*n50/n169 + n12*n50*n62) + n109*n302*(pow(alpha, NP0*n0 - n174*n20)*n0*n156*n20*n30/n169 + pow(alpha, n0*n27 - n174*n20)*n0*n20*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n20)*n30*n47*n82/(n170*n81) + n162) + n109*n98*xF[8]*(pow(alpha, NP0*n0 - n174*n20)*n1*n156*n20/n169 + n1*n136)*(pow(alpha, NP0*n0 - n174*n20)*n156*n20*n50/n169 + n136*n50)/n267 + n112*n73*(pow(alpha, NP0*n0 - n10*n174)*n10*n156*n24*n30/n169 + pow(alpha, n0*n27 - n10*n174)*n10*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n10*n174)*n30*n37*n82/(n170*n81) + n104*n30*n37)/n238 + n121*n73*(pow(alpha, NP0*n0 - n174*n18)*n156*n18*n24*n30/n169 + pow(alpha, n0*n27 - n174*n18)*n18*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n18)*n30*n45*n82/(n170*n81) + n108*n30*n45)/n246 + n126*n73*(pow(alpha, NP0*n0 - n174*n8)*n156*n24*n30*n8/n169 + pow(alpha, n0*n27 - n174*n8)*n149*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n8)*n24*n30*n8*n82/(n170*n81) + n103*n149)/n236 + n127*n73*(pow(alpha, NP0*n0 - n14*n174)*n14*n156*n24*n30/n169 + pow(alpha, n0*n27 - n14*n174)*n135*n82/(n170*n81) + pow(alpha, n0*n27 - n14*n174)*n14*n24*n30*n82/(n170*n81) + n106*n135)/n242 + n132*n73*(pow(alpha, NP0*n0 - n174*n7)*n156*n24*n30*n7/n169 + pow(alpha, n0*n27 - n174*n7)*n128*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n7)*n24*n30*n7*n82/(n170*n81) + n102*n128)/n235 + n133*n73*(pow(alpha, NP0*n0 - n0*n174)*n119*(-n25 + xPj*xTj)/(n169*n52) + n100*n119)/n231 + n297*n73*(pow(alpha, NP0*n0 - n12*n174)*n12*n156*n24*n30/n169 + pow(alpha, n0*n27 - n12*n174)*n12*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n12*n174)*n140*n82/(n170*n81) + n105*n140) + n299*n73*(pow(alpha, NP0*n0 - n16*n174)*n156*n16*n24*n30/n169 + pow(alpha, n0*n27 - n16*n174)*n16*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n16*n174)*n30*n43*n82/(n170*n81) + n107*n30*n43) + n306 + n307 + n308 + n309 + n310 + n311 + n312 + n313 + n314 + n315 + n316 + n317 + n318 + n319 + n320 + n321 + n322 + n323 + n324 + n404 + n405 + n406 + n407 + n408 + n409 + n410 + n411 + n412 + n413 + n414 + n415 + n416 + n417 + n418 + n419 + n420 + n421 + n422) + 2.0*n306 + 2.0*n424) + pow(-n133*n379*n73 - n27*(1.0*n0*n110*n113*(pow(alpha, NP0*n0 - n0*n174)*n0*n1*n156/n169 + n0*n124)/n231 - 0.5*n133*n73*(pow(alpha, NP0*n0 - n0*n174)*n0*n1*n156/n169 + n0*n124)*(pow(alpha, NP0*n0 - n0*n174)*n1*n156*n23*n24/n169 + n124*n23*n24)/n250 + 0.5*n133*n73*(pow(alpha, NP0*n0 - n0*n174)*n119*(-n25 + xPj*xTj)/(n169*n52) + n100*n119)/n231 + n325 - 0.5*xTj*(n109*n112*(pow(alpha, NP0*n0 - n10*n174)*n1*n10*n156/n169 + n1*n138)*(pow(alpha, NP0*n0 - n10*n174)*n10*n156*n50/n169 + n138*n50)/n257 + n109*n115*(pow(alpha, NP0*n0 - n15*n174)*n1*n15*n156/n169 + n1*n114)*(pow(alpha, NP0*n0 - n15*n174)*n15*n156*n50/n169 + n114*n50)/n262 + n109*n115*(pow(alpha, NP0*n0 - n15*n174)*n0*n15*n156*n30/n169 + pow(alpha, n0*n27 - n15*n174)*n0*n15*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n15*n174)*n30*n42*n82/(n170*n81) + n164)/n243 + n109*n116*(pow(alpha, NP0*n0 - n174*n9)*n156*n77/n169 + n59*n77)*(pow(alpha, NP0*n0 - n174*n9)*n156*n50*n9/n169 + n150*n50)/n256 + n109*n116*(pow(alpha, NP0*n0 - n174*n9)*n0*n156*n30*n9/n169 + pow(alpha, n0*n27 - n174*n9)*n0*n30*n82*n9/(n170*n81) - pow(alpha, n0*n27 - n174*n9)*n134*n82/(n170*n81) + n134*n59)/n237 + n109*n120*(pow(alpha, NP0*n0 - n174*n21)*n1*n156*n21/n169 + n1*n130)*(pow(alpha, NP0*n0 - n174*n21)*n156*n21*n50/n169 + n130*n50)/n268 + n109*n120*(pow(alpha, NP0*n0 - n174*n21)*n0*n156*n21*n30/n169 + pow(alpha, n0*n27 - n174*n21)*n0*n21*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n21)*n30*n48*n82/(n170*n81) + n30*n48*n71)/n249 + n109*n121*(pow(alpha, NP0*n0 - n174*n18)*n1*n156*n18/n169 + n155)*(pow(alpha, NP0*n0 - n174*n18)*n156*n18*n50/n169 + n158)/n265 + n109*n123*(pow(alpha, NP0*n0 - n174*n19)*n1*n156*n19/n169 + n1*n147)*(pow(alpha, NP0*n0 - n174*n19)*n156*n19*n50/n169 + n147*n50)/n266 + n109*n123*(pow(alpha, NP0*n0 - n174*n19)*n0*n156*n19*n30/n169 + pow(alpha, n0*n27 - n174*n19)*n0*n19*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n19)*n125*n82/(n170*n81) + n125*n69)/n247 + n109*n126*(pow(alpha, NP0*n0 - n174*n8)*n1*n156*n8/n169 + n1*n122)*(pow(alpha, NP0*n0 - n174*n8)*n156*n50*n8/n169 + n122*n50)/n255 + n109*n127*(pow(alpha, NP0*n0 - n14*n174)*n156*n76/n169 + n64*n76)*(pow(alpha, NP0*n0 - n14*n174)*n14*n156*n50/n169 + n14*n50*n64)/n261 + n109*n131*(pow(alpha, NP0*n0 - n174*n4)*n1*n156*n4/n169 + n1*n141)*(pow(alpha, NP0*n0 - n174*n4)*n156*n4*n50/n169 + n141*n50)/n251 + n109*n131*(pow(alpha, NP0*n0 - n174*n4)*n0*n156*n30*n4/n169 + pow(alpha, n0*n27 - n174*n4)*n0*n30*n4*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n4)*n30*n31*n82/(n170*n81) + n167)/n232 + n109*n132*(pow(alpha, NP0*n0 - n174*n7)*n156*n75/n169 + n57*n75)*(pow(alpha, NP0*n0 - n174*n7)*n156*n50*n7/n169 + n50*n57*n7)/n254 + n109*n133*(pow(alpha, NP0*n0 - n0*n174)*n0*n1*n156/n169 + n0*n124)*(pow(alpha, NP0*n0 - n0*n174)*n1*n156*n23*n24/n169 + n124*n23*n24)/n250 + n109*n143*(pow(alpha, NP0*n0 - n174*n6)*n1*n156*n6/n169 + n1*n142)*(pow(alpha, NP0*n0 - n174*n6)*n156*n50*n6/n169 + n142*n50)/n253 + n109*n143*(pow(alpha, NP0*n0 - n174*n6)*n0*n156*n30*n6/n169 + pow(alpha, n0*n27 - n174*n6)*n0*n30*n6*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n6)*n30*n33*n82/(n170*n81) + n165)/n234 + n109*n144*(pow(alpha, NP0*n0 - n17*n174)*n1*n156*n17/n169 + n1*n145)*(pow(alpha, NP0*n0 - n17*n174)*n156*n17*n50/n169 + n145*n50)/n264 + n109*n281*n89*(pow(alpha, NP0*n0 - n11*n174)*n0*n11*n156*n30/n169 + pow(alpha, n0*n27 - n11*n174)*n0*n11*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n11*n174)*n30*n38*n82/(n170*n81) + n160) + n109*n291*xF[11]*(pow(alpha, NP0*n0 - n174*n5)*n1*n156*n5/n169 + n153)*(pow(alpha, NP0*n0 - n174*n5)*n156*n5*n50/n169 + n148*n50) + n109*n292*xF[1]*(pow(alpha, NP0*n0 - n13*n174)*n1*n13*n156/n169 + n1*n139)*(pow(alpha, NP0*n0 - n13*n174)*n13*n156*n50/n169 + n139*n50) + n109*n294*xF[11]*(pow(alpha, NP0*n0 - n174*n5)*n0*n156*n30*n5/n169 + pow(alpha, n0*n27 - n174*n5)*n0*n30*n5*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n5)*n30*n32*n82/(n170*n81) + n161) + n109*n295*xF[4]*(pow(alpha, NP0*n0 - n16*n174)*n1*n156*n16/n169 + n118*n16)*(pow(alpha, NP0*n0 - n16*n174)*n156*n16*n50/n169 + n16*n50*n66) + n109*n296*(pow(alpha, NP0*n0 - n17*n174)*n0*n156*n17*n30/n169 + pow(alpha, n0*n27 - n17*n174)*n0*n17*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n17*n174)*n117*n82/(n170*n81) + n117*n67) + n109*n298*(pow(alpha, NP0*n0 - n13*n174)*n0*n13*n156*n30/n169 + pow(alpha, n0*n27 - n13*n174)*n0*n13*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n13*n174)*n137*n82/(n170*n81) + n137*n63) + n109*n300*(pow(alpha, NP0*n0 - n11*n174)*n1*n11*n156/n169 + n154)*(pow(alpha, NP0*n0 - n11*n174)*n11*n156*n50/n169 + n129*n50) + n109*n301*(pow(alpha, NP0*n0 - n12*n174)*n156*n74/n169 + n62*n74)*(pow(alpha, NP0*n0 - n12*n174)*n12*n156*n50/n169 + n12*n50*n62) + n109*n302*(pow(alpha, NP0*n0 - n174*n20)*n0*n156*n20*n30/n169 + pow(alpha, n0*n27 - n174*n20)*n0*n20*n30*n82/(n170*n81) - pow(alpha, n0*n27 - n174*n20)*n30*n47*n82/(n170*n81) + n162) + n109*n98*xF[8]*(pow(alpha, NP0*n0 - n174*n20)*n1*n156*n20/n169 + n1*n136)*(pow(alpha, NP0*n0 - n174*n20)*n156*n20*n50/n169 + n136*n50)/n267 + n112*n73*(pow(alpha, NP0*n0 - n10*n174)*n10*n156*n24*n30/n169 + pow(alpha, n0*n27 - n10*n174)*n10*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n10*n174)*n30*n37*n82/(n170*n81) + n104*n30*n37)/n238 + n121*n73*(pow(alpha, NP0*n0 - n174*n18)*n156*n18*n24*n30/n169 + pow(alpha, n0*n27 - n174*n18)*n18*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n18)*n30*n45*n82/(n170*n81) + n108*n30*n45)/n246 + n126*n73*(pow(alpha, NP0*n0 - n174*n8)*n156*n24*n30*n8/n169 + pow(alpha, n0*n27 - n174*n8)*n149*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n8)*n24*n30*n8*n82/(n170*n81) + n103*n149)/n236 + n127*n73*(pow(alpha, NP0*n0 - n14*n174)*n14*n156*n24*n30/n169 + pow(alpha, n0*n27 - n14*n174)*n135*n82/(n170*n81) + pow(alpha, n0*n27 - n14*n174)*n14*n24*n30*n82/(n170*n81) + n106*n135)/n242 + n132*n73*(pow(alpha, NP0*n0 - n174*n7)*n156*n24*n30*n7/n169 + pow(alpha, n0*n27 - n174*n7)*n128*n82/(n170*n81) + pow(alpha, n0*n27 - n174*n7)*n24*n30*n7*n82/(n170*n81) + n102*n128)/n235 + n133*n73*(pow(alpha, NP0*n0 - n0*n174)*n119*(-n25 + xPj*xTj)/(n169*n52) + n100*n119)/n231 + n297*n73*(pow(alpha, NP0*n0 - n12*n174)*n12*n156*n24*n30/n169 + pow(alpha, n0*n27 - n12*n174)*n12*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n12*n174)*n140*n82/(n170*n81) + n105*n140) + n299*n73*(pow(alpha, NP0*n0 - n16*n174)*n156*n16*n24*n30/n169 + pow(alpha, n0*n27 - n16*n174)*n16*n24*n30*n82/(n170*n81) + pow(alpha, n0*n27 - n16*n174)*n30*n43*n82/(n170*n81) + n107*n30*n43) + n306 + n307 + n308 + n309 + n310 + n311 + n312 + n313 + n314 + n315 + n316 + n317 + n318 + n319 + n320 + n321 + n322 + n323 + n324 + n404 + n405 + n406 + n407 + n408 + n409 + n410 + n411 + n412 + n413 + n414 + n415 + n416 + n417 + n418 + n419 + n420 + n421 + n422)) - n305 - n458*xTj, -n23);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n111*(n171 - log(-pow(alpha, NP1*n0)*n156 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[10] - Mstar;
-      g5 = MW[11] - Mstar;
-      g6 = MW[12] - Mstar;
-      g7 = MW[13] - Mstar;
-      g8 = MW[14] - Mstar;
-      g9 = MW[15] - Mstar;
-      g10 = MW[16] - Mstar;
-      g11 = MW[17] - Mstar;
-      g12 = MW[18] - Mstar;
-      g13 = MW[2] - Mstar;
-      g14 = MW[3] - Mstar;
-      g15 = MW[4] - Mstar;
-      g16 = MW[5] - Mstar;
-      g17 = MW[6] - Mstar;
-      g18 = MW[7] - Mstar;
-      g19 = MW[8] - Mstar;
-      g20 = MW[9] - Mstar;
-      g21 = xF[0] - xTj;
-      g22 = xF[0] - xPj;
-      g23 = -xTj;
-      g24 = xPj/xF[1];
-      g25 = pow(alpha, -g1);
-      g26 = pow(alpha, -g4);
-      g27 = pow(alpha, -g5);
-      g28 = pow(alpha, -g6);
-      g29 = pow(alpha, -g7);
-      g30 = pow(alpha, -g8);
-      g31 = pow(alpha, -g9);
-      g32 = pow(alpha, -g10);
-      g33 = pow(alpha, -g11);
-      g34 = pow(alpha, -g12);
-      g35 = pow(alpha, -g0);
-      g36 = pow(alpha, -g13);
-      g37 = pow(alpha, -g14);
-      g38 = pow(alpha, -g15);
-      g39 = pow(alpha, -g16);
-      g40 = pow(alpha, -g17);
-      g41 = pow(alpha, -g18);
-      g42 = pow(alpha, -g19);
-      g43 = pow(alpha, -g20);
-      g44 = log(xF[0]/xF[1]);
-      g45 = -g2;
-      g46 = pow(alpha, NP1*g0);
-      g47 = pow(alpha, NP1*g1);
-      g48 = pow(alpha, NP1*g4);
-      g49 = log(g25);
-      g50 = pow(alpha, NP1*g5);
-      g51 = pow(alpha, NP1*g6);
-      g52 = pow(alpha, NP1*g7);
-      g53 = pow(alpha, NP1*g8);
-      g54 = pow(alpha, NP1*g9);
-      g55 = pow(alpha, NP1*g10);
-      g56 = pow(alpha, NP1*g11);
-      g57 = pow(alpha, NP1*g12);
-      g58 = pow(alpha, NP1*g13);
-      g59 = pow(alpha, NP1*g14);
-      g60 = pow(alpha, NP1*g15);
-      g61 = pow(alpha, NP1*g16);
-      g62 = pow(alpha, NP1*g17);
-      g63 = pow(alpha, NP1*g18);
-      g64 = pow(alpha, NP1*g19);
-      g65 = pow(alpha, NP1*g20);
-      g66 = -g44;
-      g67 = g21/g3;
-      g68 = g3/g21;
-      g69 = -g46 + 1;
-      g70 = -g46 + 1;
-      g71 = -g47 + 1;
-      g72 = -g58 + 1;
-      g73 = -g59 + 1;
-      g74 = -g60 + 1;
-      g75 = -g61 + 1;
-      g76 = -g62 + 1;
-      g77 = -g63 + 1;
-      g78 = -g64 + 1;
-      g79 = -g65 + 1;
-      g80 = -g48 + 1;
-      g81 = -g50 + 1;
-      g82 = -g51 + 1;
-      g83 = -g52 + 1;
-      g84 = -g53 + 1;
-      g85 = -g54 + 1;
-      g86 = -g55 + 1;
-      g87 = -g56 + 1;
-      g88 = -g57 + 1;
-      g89 = -g47;
-      g90 = -g48;
-      g91 = -g50;
-      g92 = -g51;
-      g93 = -g52;
-      g94 = -g53;
-      g95 = -g54;
-      g96 = -g55;
-      g97 = -g56;
-      g98 = -g57;
-      g99 = -g58;
-      g100 = -g59;
-      g101 = -g60;
-      g102 = -g61;
-      g103 = -g62;
-      g104 = -g63;
-      g105 = -g64;
-      g106 = -g65;
-      g107 = -1.0*g44;
-      g108 = -g3/g22;
-      g109 = g22/(g3*xF[1]);
-      g110 = pow(alpha, g0*g45) - 1;
-      g111 = pow(alpha, g0*g45) - 1;
-      g112 = pow(alpha, g1*g45) - 1;
-      g113 = pow(alpha, g13*g45) - 1;
-      g114 = pow(alpha, g14*g45) - 1;
-      g115 = pow(alpha, g15*g45) - 1;
-      g116 = pow(alpha, g16*g45) - 1;
-      g117 = pow(alpha, g17*g45) - 1;
-      g118 = pow(alpha, g18*g45) - 1;
-      g119 = pow(alpha, g19*g45) - 1;
-      g120 = pow(alpha, g20*g45) - 1;
-      g121 = pow(alpha, g4*g45) - 1;
-      g122 = pow(alpha, g45*g5) - 1;
-      g123 = pow(alpha, g45*g6) - 1;
-      g124 = pow(alpha, g45*g7) - 1;
-      g125 = pow(alpha, g45*g8) - 1;
-      g126 = pow(alpha, g45*g9) - 1;
-      g127 = pow(alpha, g10*g45) - 1;
-      g128 = pow(alpha, g11*g45) - 1;
-      g129 = pow(alpha, g12*g45) - 1;
-      g130 = -pow(alpha, g1*g45);
-      g131 = -pow(alpha, g4*g45);
-      g132 = -pow(alpha, g45*g5);
-      g133 = -pow(alpha, g45*g6);
-      g134 = -pow(alpha, g45*g7);
-      g135 = -pow(alpha, g45*g8);
-      g136 = -pow(alpha, g45*g9);
-      g137 = -pow(alpha, g10*g45);
-      g138 = -pow(alpha, g11*g45);
-      g139 = -pow(alpha, g12*g45);
-      g140 = -pow(alpha, g13*g45);
-      g141 = -pow(alpha, g14*g45);
-      g142 = -pow(alpha, g15*g45);
-      g143 = -pow(alpha, g16*g45);
-      g144 = -pow(alpha, g17*g45);
-      g145 = -pow(alpha, g18*g45);
-      g146 = -pow(alpha, g19*g45);
-      g147 = -pow(alpha, g20*g45);
-      g148 = g111 + g70;
-      g149 = -g130 - g47;
-      g150 = -g131 - g48;
-      g151 = -g132 - g50;
-      g152 = -g133 - g51;
-      g153 = -g134 - g52;
-      g154 = -g135 - g53;
-      g155 = -g136 - g54;
-      g156 = -g137 - g55;
-      g157 = -g138 - g56;
-      g158 = -g139 - g57;
-      g159 = -g140 - g58;
-      g160 = -g141 - g59;
-      g161 = -g142 - g60;
-      g162 = -g143 - g61;
-      g163 = -g144 - g62;
-      g164 = -g145 - g63;
-      g165 = -g146 - g64;
-      g166 = -g147 - g65;
-      g167 = pow(alpha, g1*g45) + g89;
-      g168 = g111 + g70;
-      g169 = pow(alpha, g4*g45) + g90;
-      g170 = pow(alpha, g45*g5) + g91;
-      g171 = pow(alpha, g45*g6) + g92;
-      g172 = pow(alpha, g45*g7) + g93;
-      g173 = pow(alpha, g45*g8) + g94;
-      g174 = pow(alpha, g45*g9) + g95;
-      g175 = pow(alpha, g10*g45) + g96;
-      g176 = pow(alpha, g11*g45) + g97;
-      g177 = pow(alpha, g12*g45) + g98;
-      g178 = pow(alpha, g13*g45) + g99;
-      g179 = pow(alpha, g14*g45) + g100;
-      g180 = pow(alpha, g15*g45) + g101;
-      g181 = pow(alpha, g16*g45) + g102;
-      g182 = pow(alpha, g17*g45) + g103;
-      g183 = pow(alpha, g18*g45) + g104;
-      g184 = pow(alpha, g19*g45) + g105;
-      g185 = pow(alpha, g20*g45) + g106;
-      g186 = xF[9]/g185;
-      g187 = xF[8]/g184;
-      g188 = xF[1]/g168;
-      g189 = xF[3]/g179;
-      g190 = xF[10]/g169;
-      g191 = xF[17]/g176;
-      g192 = xF[15]/g174;
-      g193 = xF[16]/g175;
-      g194 = xF[7]/g183;
-      g195 = xF[4]/g180;
-      g196 = xF[12]/g171;
-      g197 = xF[13]/g172;
-      g198 = xF[11]/g170;
-      g199 = xF[6]/g182;
-      g200 = xF[14]/g173;
-      g201 = xF[5]/g181;
-      g202 = xF[2]/g178;
-      g203 = xF[18]/g177;
-      g204 = xF[0]/g167;
-      g205 = xF[17]/g157;
-      g206 = xF[0]/g149;
-      g207 = xF[15]/g155;
-      g208 = xF[4]/g161;
-      g209 = xF[2]/g159;
-      g210 = xF[11]/g151;
-      g211 = xF[18]/g158;
-      g212 = xF[1]/g148;
-      g213 = xF[13]/g153;
-      g214 = xF[16]/g156;
-      g215 = xF[3]/g160;
-      g216 = xF[6]/g163;
-      g217 = xF[14]/g154;
-      g218 = xF[8]/g165;
-      g219 = xF[12]/g152;
-      g220 = xF[10]/g150;
-      g221 = xF[7]/g164;
-      g222 = xF[9]/g166;
-      g223 = xF[5]/g162;
-      g224 = g82/g152;
-      g225 = g79/g166;
-      g226 = g87/g157;
-      g227 = g85/g155;
-      g228 = g74/g161;
-      g229 = g72/g159;
-      g230 = g71/g149;
-      g231 = g75/g162;
-      g232 = g88/g158;
-      g233 = g76/g163;
-      g234 = g83/g153;
-      g235 = g73/g160;
-      g236 = g86/g156;
-      g237 = g81/g151;
-      g238 = g84/g154;
-      g239 = g80/g150;
-      g240 = g78/g165;
-      g241 = g69/g148;
-      g242 = g77/g164;
-      g243 = g112/g149;
-      g244 = g126/g155;
-      g245 = g122/g151;
-      g246 = g113/g159;
-      g247 = g114/g160;
-      g248 = g115/g161;
-      g249 = g128/g157;
-      g250 = g110/g148;
-      g251 = g119/g165;
-      g252 = g120/g166;
-      g253 = g127/g156;
-      g254 = g117/g163;
-      g255 = g125/g154;
-      g256 = g123/g152;
-      g257 = g124/g153;
-      g258 = g129/g158;
-      g259 = g118/g164;
-      g260 = g121/g150;
-      g261 = g116/g162;
-      g262 = log(g109*g168*g23/g70);
-      g263 = log(g109*g148*g23/g69);
-      g264 = log(g168*g24*g67/g111);
-      g265 = 1.0*g262;
-      g266 = log(g148*g24*g67/g110);
-      g267 = 1.0*g264;
-      g268 = -g107*xF[0] - g107*xF[10] - g107*xF[11] - g107*xF[12] - g107*xF[13] - g107*xF[14] - g107*xF[15] - g107*xF[16] - g107*xF[17] - g107*xF[18] - g107*xF[1] - g107*xF[2] - g107*xF[3] - g107*xF[4] - g107*xF[5] - g107*xF[6] - g107*xF[7] - g107*xF[8] - g107*xF[9] - g111*g188*g267 - g186*g265*(g106 + 1) - g186*g267*(pow(alpha, g20*g45) - 1) - g187*g265*(g105 + 1) - g187*g267*(pow(alpha, g19*g45) - 1) - g188*g265*g70 - g189*g265*(g100 + 1) - g189*g267*(pow(alpha, g14*g45) - 1) - g190*g265*(g90 + 1) - g190*g267*(pow(alpha, g4*g45) - 1) - g191*g265*(g97 + 1) - g191*g267*(pow(alpha, g11*g45) - 1) - g192*g265*(g95 + 1) - g192*g267*(pow(alpha, g45*g9) - 1) - g193*g265*(g96 + 1) - g193*g267*(pow(alpha, g10*g45) - 1) - g194*g265*(g104 + 1) - g194*g267*(pow(alpha, g18*g45) - 1) - g195*g265*(g101 + 1) - g195*g267*(pow(alpha, g15*g45) - 1) - g196*g265*(g92 + 1) - g196*g267*(pow(alpha, g45*g6) - 1) - g197*g265*(g93 + 1) - g197*g267*(pow(alpha, g45*g7) - 1) - g198*g265*(g91 + 1) - g198*g267*(pow(alpha, g45*g5) - 1) - g199*g265*(g103 + 1) - g199*g267*(pow(alpha, g17*g45) - 1) - g200*g265*(g94 + 1) - g200*g267*(pow(alpha, g45*g8) - 1) - g201*g265*(g102 + 1) - g201*g267*(pow(alpha, g16*g45) - 1) - g202*g265*(g99 + 1) - g202*g267*(pow(alpha, g13*g45) - 1) - g203*g265*(g98 + 1) - g203*g267*(pow(alpha, g12*g45) - 1) - g204*g265*(g89 + 1) - g204*g267*(pow(alpha, g1*g45) - 1);
-      LpF = xF[0]*(g25 + 1.0)*(g230*g263 + g243*g266 + g66)/(g49*(g25 - 1.0)) + xF[10]*(g26 + 1.0)*(g239*g263 + g260*g266 + g66)/(g49*(g26 - 1.0)) + xF[11]*(g27 + 1.0)*(g237*g263 + g245*g266 + g66)/(g49*(g27 - 1.0)) + xF[12]*(g28 + 1.0)*(g224*g263 + g256*g266 + g66)/(g49*(g28 - 1.0)) + xF[13]*(g29 + 1.0)*(g234*g263 + g257*g266 + g66)/(g49*(g29 - 1.0)) + xF[14]*(g30 + 1.0)*(g238*g263 + g255*g266 + g66)/(g49*(g30 - 1.0)) + xF[15]*(g31 + 1.0)*(g227*g263 + g244*g266 + g66)/(g49*(g31 - 1.0)) + xF[16]*(g32 + 1.0)*(g236*g263 + g253*g266 + g66)/(g49*(g32 - 1.0)) + xF[17]*(g33 + 1.0)*(g226*g263 + g249*g266 + g66)/(g49*(g33 - 1.0)) + xF[18]*(g34 + 1.0)*(g232*g263 + g258*g266 + g66)/(g49*(g34 - 1.0)) + xF[1]*(g35 + 1.0)*(g241*g263 + g250*g266 + g66)/(g49*(g35 - 1.0)) + xF[2]*(g36 + 1.0)*(g229*g263 + g246*g266 + g66)/(g49*(g36 - 1.0)) + xF[3]*(g37 + 1.0)*(g235*g263 + g247*g266 + g66)/(g49*(g37 - 1.0)) + xF[4]*(g38 + 1.0)*(g228*g263 + g248*g266 + g66)/(g49*(g38 - 1.0)) + xF[5]*(g39 + 1.0)*(g231*g263 + g261*g266 + g66)/(g49*(g39 - 1.0)) + xF[6]*(g40 + 1.0)*(g233*g263 + g254*g266 + g66)/(g49*(g40 - 1.0)) + xF[7]*(g41 + 1.0)*(g242*g263 + g259*g266 + g66)/(g49*(g41 - 1.0)) + xF[8]*(g42 + 1.0)*(g240*g263 + g251*g266 + g66)/(g49*(g42 - 1.0)) + xF[9]*(g43 + 1.0)*(g225*g263 + g252*g266 + g66)/(g49*(g43 - 1.0));
-      PpF = g67;
-      TpF = -g22/g3;
-      SWUpF = g268;
-      SWUpP = g268*g68;
-      xP[0] = g112*g206*g68;
-      xP[1] = g110*g212*g68;
-      xP[2] = g113*g209*g68;
-      xP[3] = g114*g215*g68;
-      xP[4] = g115*g208*g68;
-      xP[5] = g116*g223*g68;
-      xP[6] = g117*g216*g68;
-      xP[7] = g118*g221*g68;
-      xP[8] = g119*g218*g68;
-      xP[9] = g120*g222*g68;
-      xP[10] = g121*g220*g68;
-      xP[11] = g122*g210*g68;
-      xP[12] = g123*g219*g68;
-      xP[13] = g124*g213*g68;
-      xP[14] = g125*g217*g68;
-      xP[15] = g126*g207*g68;
-      xP[16] = g127*g214*g68;
-      xP[17] = g128*g205*g68;
-      xP[18] = g129*g211*g68;
-      xT[0] = g108*g206*g71;
-      xT[1] = g108*g212*g69;
-      xT[2] = g108*g209*g72;
-      xT[3] = g108*g215*g73;
-      xT[4] = g108*g208*g74;
-      xT[5] = g108*g223*g75;
-      xT[6] = g108*g216*g76;
-      xT[7] = g108*g221*g77;
-      xT[8] = g108*g218*g78;
-      xT[9] = g108*g222*g79;
-      xT[10] = g108*g220*g80;
-      xT[11] = g108*g210*g81;
-      xT[12] = g108*g219*g82;
-      xT[13] = g108*g213*g83;
-      xT[14] = g108*g217*g84;
-      xT[15] = g108*g207*g85;
-      xT[16] = g108*g214*g86;
-      xT[17] = g108*g205*g87;
-      xT[18] = g108*g211*g88;
-      break;
-    case 20:
-      n0 = MW[0] - Mstar;
-      n1 = log(alpha);
-      n2 = xPj - xTj;
-      n3 = xF[0] - xPj;
-      n4 = MW[10] - Mstar;
-      n5 = MW[11] - Mstar;
-      n6 = MW[12] - Mstar;
-      n7 = MW[13] - Mstar;
-      n8 = MW[14] - Mstar;
-      n9 = MW[15] - Mstar;
-      n10 = MW[16] - Mstar;
-      n11 = MW[17] - Mstar;
-      n12 = MW[18] - Mstar;
-      n13 = MW[19] - Mstar;
-      n14 = MW[1] - Mstar;
-      n15 = MW[2] - Mstar;
-      n16 = MW[3] - Mstar;
-      n17 = MW[4] - Mstar;
-      n18 = MW[5] - Mstar;
-      n19 = MW[6] - Mstar;
-      n20 = MW[7] - Mstar;
-      n21 = MW[8] - Mstar;
-      n22 = MW[9] - Mstar;
-      n23 = log(xTj);
-      n24 = -2;
-      n25 = -n0;
-      n26 = xF[0]*xPj;
-      n27 = -Mstar;
-      n28 = -n24*xF[4];
-      n29 = -n24*xF[12];
-      n30 = -n24*xF[11];
-      n31 = 4.0*xF[0];
-      n32 = -xTj;
-      n33 = -n24*xF[0];
-      n34 = -xPj;
-      n35 = -n24*xF[1];
-      n36 = -n24*xF[17];
-      n37 = -MW[0];
-      n38 = -NP0*n24;
-      n39 = pow(n0, -n24);
-      n40 = pow(n1, -n24);
-      n41 = pow(n4, -n24);
-      n42 = pow(n5, -n24);
-      n43 = pow(n6, -n24);
-      n44 = pow(n7, -n24);
-      n45 = pow(n8, -n24);
-      n46 = pow(n9, -n24);
-      n47 = pow(n10, -n24);
-      n48 = pow(n11, -n24);
-      n49 = pow(n12, -n24);
-      n50 = pow(n13, -n24);
-      n51 = pow(n14, -n24);
-      n52 = pow(n15, -n24);
-      n53 = pow(n16, -n24);
-      n54 = pow(n17, -n24);
-      n55 = pow(n18, -n24);
-      n56 = pow(n19, -n24);
-      n57 = pow(n20, -n24);
-      n58 = pow(n21, -n24);
-      n59 = pow(n22, -n24);
-      n60 = Mstar*n1;
-      n61 = -n1*n24;
-      n62 = NP0*n0;
-      n63 = pow(alpha, n62);
-      n64 = n26 + n32*xF[0];
-      n65 = n26 + n32*xPj;
-      n66 = pow(alpha, NP0*n4);
-      n67 = pow(alpha, NP0*n5);
-      n68 = pow(alpha, NP0*n6);
-      n69 = pow(alpha, NP0*n7);
-      n70 = pow(alpha, NP0*n8);
-      n71 = pow(alpha, NP0*n9);
-      n72 = pow(alpha, NP0*n10);
-      n73 = pow(alpha, NP0*n11);
-      n74 = pow(alpha, NP0*n12);
-      n75 = pow(alpha, NP0*n13);
-      n76 = pow(alpha, NP0*n14);
-      n77 = pow(alpha, NP0*n15);
-      n78 = pow(alpha, NP0*n16);
-      n79 = pow(alpha, NP0*n17);
-      n80 = pow(alpha, NP0*n18);
-      n81 = pow(alpha, NP0*n19);
-      n82 = pow(alpha, NP0*n20);
-      n83 = pow(alpha, NP0*n21);
-      n84 = pow(alpha, NP0*n22);
-      n85 = n1*n37;
-      n86 = n2/n3;
-      n87 = n1*n18;
-      n88 = -n40;
-      n89 = n1*n7;
-      n90 = n1*n15;
-      n91 = n1*n9;
-      n92 = n1*n21;
-      n93 = n0*n22;
-      n94 = n0*n18;
-      n95 = n0*n12;
-      n96 = -n63 + 1;
-      n97 = -n66 + 1;
-      n98 = pow(alpha, NP0*n24*n25);
-      n99 = pow(n64, -n24);
-      n100 = pow(n65, -n24);
-      n101 = -n67 + 1;
-      n102 = -n68 + 1;
-      n103 = -n69 + 1;
-      n104 = -n70 + 1;
-      n105 = -n71 + 1;
-      n106 = -n72 + 1;
-      n107 = -n73 + 1;
-      n108 = -n74 + 1;
-      n109 = -n75 + 1;
-      n110 = -n76 + 1;
-      n111 = -n77 + 1;
-      n112 = -n78 + 1;
-      n113 = -n79 + 1;
-      n114 = -n80 + 1;
-      n115 = -n81 + 1;
-      n116 = -n82 + 1;
-      n117 = -n83 + 1;
-      n118 = -n84 + 1;
-      n119 = n96;
-      n120 = n97;
-      n121 = n101;
-      n122 = n102;
-      n123 = n103;
-      n124 = n104;
-      n125 = n105;
-      n126 = n106;
-      n127 = n107;
-      n128 = n108;
-      n129 = n109;
-      n130 = n110;
-      n131 = n111;
-      n132 = n112;
-      n133 = n113;
-      n134 = n114;
-      n135 = n115;
-      n136 = n116;
-      n137 = n117;
-      n138 = n118;
-      n139 = -n102;
-      n140 = -n63;
-      n141 = -n80;
-      n142 = -n86;
-      n143 = n69*xF[13];
-      n144 = n74*xF[18];
-      n145 = n83*xF[8];
-      n146 = 1/(n0*n1);
-      n147 = n77*xF[2];
-      n148 = n17*n40;
-      n149 = n106*xF[16];
-      n150 = n101*xF[11];
-      n151 = n134*xF[5];
-      n152 = n108*xF[18];
-      n153 = n40*n44;
-      n154 = n16*n78;
-      n155 = n126*xF[16];
-      n156 = n105*xF[15];
-      n157 = n19*n81;
-      n158 = n0*n63;
-      n159 = n40*n55;
-      n160 = n1*n79;
-      n161 = n11*n73;
-      n162 = n118*xF[9];
-      n163 = n4*n66;
-      n164 = n116*xF[7];
-      n165 = n132*xF[3];
-      n166 = n127*xF[17];
-      n167 = n136*xF[7];
-      n168 = n133*xF[4];
-      n169 = n13*n75;
-      n170 = n111*xF[2];
-      n171 = n40*n49;
-      n172 = n130*xF[1];
-      n173 = n70*n8;
-      n174 = n40*n58;
-      n175 = n138*xF[9];
-      n176 = n103*xF[13];
-      n177 = n125*xF[15];
-      n178 = n124*xF[14];
-      n179 = n119*xF[0];
-      n180 = n40*n46;
-      n181 = n40*n52;
-      n182 = n10*n72;
-      n183 = n131*xF[2];
-      n184 = n104*xF[14];
-      n185 = n22*n84;
-      n186 = n114*xF[5];
-      n187 = n110*xF[1];
-      n188 = n14*n76;
-      n189 = n123*xF[13];
-      n190 = n135*xF[6];
-      n191 = n129*xF[19];
-      n192 = n12*n74;
-      n193 = n20*n82;
-      n194 = n71*n9;
-      n195 = n120*xF[10];
-      n196 = n137*xF[8];
-      n197 = n117*xF[8];
-      n198 = n128*xF[18];
-      n199 = log((-1.0 + xPj/xF[0])/n2);
-      n200 = n173*xF[14];
-      n201 = n188*xF[1];
-      n202 = n42*n67;
-      n203 = n182*xF[16];
-      n204 = n185*xF[9];
-      n205 = n39*n63;
-      n206 = n193*xF[7];
-      n207 = n50*n75;
-      n208 = n54*n79;
-      n209 = n1*n158;
-      n210 = n1*n163;
-      n211 = n1*n5*n67;
-      n212 = n1*n6*n68;
-      n213 = n69*n89;
-      n214 = n1*n173;
-      n215 = n71*n91;
-      n216 = n1*n182;
-      n217 = n1*n161;
-      n218 = n1*n192;
-      n219 = n1*n169;
-      n220 = n1*n188;
-      n221 = n77*n90;
-      n222 = n1*n154;
-      n223 = n160*n17;
-      n224 = n80*n87;
-      n225 = n1*n157;
-      n226 = n1*n193;
-      n227 = n83*n92;
-      n228 = n1*n185;
-      n229 = n65/n64;
-      n230 = n40*n98;
-      n231 = n40*n41*n66;
-      n232 = n40*n43*n68;
-      n233 = n180*n71;
-      n234 = n40*n48*n73;
-      n235 = n40*n51*n76;
-      n236 = n40*n53*n78;
-      n237 = n159*n80;
-      n238 = n40*n56*n81;
-      n239 = n40*n57*n82;
-      n240 = n174*n83;
-      n241 = n40*n59*n84;
-      n242 = n40*n45*n70;
-      n243 = n40*n47*n72;
-      n244 = n205*n40*xF[0];
-      n245 = n239*xF[7];
-      n246 = n238*xF[6];
-      n247 = n236*xF[3];
-      n248 = n208*n40*xF[4];
-      n249 = n140*n229 + 1;
-      n250 = -n229*n63 + 1;
-      n251 = pow(n249, -n24);
-      n252 = pow(n250, -n24);
-      n253 = n1*n229*n63;
-      n254 = n199 + n23 + n60 + n85;
-      n255 = n40/n249;
-      n256 = n100/(n252*n99);
-      n257 = n0*n256;
-      n258 = n146*(n254 - log(n249)) + 1;
-      n259 = n146*(n254 - log(n250)) + 1;
-      n260 = pow(alpha, n0*n258);
-      n261 = pow(alpha, n258*n4);
-      n262 = pow(alpha, n258*n5);
-      n263 = pow(alpha, n258*n6);
-      n264 = pow(alpha, n258*n7);
-      n265 = pow(alpha, n258*n8);
-      n266 = pow(alpha, n258*n9);
-      n267 = pow(alpha, n10*n258);
-      n268 = pow(alpha, n11*n258);
-      n269 = pow(alpha, n12*n258);
-      n270 = pow(alpha, n13*n258);
-      n271 = pow(alpha, n14*n258);
-      n272 = pow(alpha, n15*n258);
-      n273 = pow(alpha, n16*n258);
-      n274 = pow(alpha, n17*n258);
-      n275 = pow(alpha, n18*n258);
-      n276 = pow(alpha, n19*n258);
-      n277 = pow(alpha, n20*n258);
-      n278 = pow(alpha, n21*n258);
-      n279 = pow(alpha, n22*n258);
-      n280 = pow(alpha, -n259*n4);
-      n281 = pow(alpha, -n259*n6);
-      n282 = pow(alpha, -n259*n9);
-      n283 = pow(alpha, -n11*n259);
-      n284 = pow(alpha, -n14*n259);
-      n285 = pow(alpha, -n16*n259);
-      n286 = pow(alpha, -n18*n259);
-      n287 = pow(alpha, -n19*n259);
-      n288 = pow(alpha, -n20*n259);
-      n289 = pow(alpha, -n21*n259);
-      n290 = pow(alpha, -n22*n259);
-      n291 = -1/n269;
-      n292 = n7/n264;
-      n293 = n22*n290;
-      n294 = n6/n263;
-      n295 = -1/n264;
-      n296 = n13/n270;
-      n297 = n20/n277;
-      n298 = -1/n263;
-      n299 = n281*n6;
-      n300 = -1/n276;
-      n301 = -1/n261;
-      n302 = n11/n268;
-      n303 = n16/n273;
-      n304 = n19/n276;
-      n305 = n8/n265;
-      n306 = -1/n266;
-      n307 = n21/n278;
-      n308 = n10/n267;
-      n309 = n20*n288;
-      n310 = -1/n262;
-      n311 = n5/n262;
-      n312 = -1/n275;
-      n313 = n16*n285;
-      n314 = n14/n271;
-      n315 = -1/n279;
-      n316 = n15/n272;
-      n317 = -1/n273;
-      n318 = n17/n274;
-      n319 = n19*n287;
-      n320 = -1/n270;
-      n321 = n9/n266;
-      n322 = n18/n275;
-      n323 = -1/n278;
-      n324 = n4/n261;
-      n325 = -1/n271;
-      n326 = n282*n9;
-      n327 = -1/n268;
-      n328 = n14*n284;
-      n329 = -1/n277;
-      n330 = n21*n289;
-      n331 = n280*n4;
-      n332 = n11*n283;
-      n333 = n47/n267;
-      n334 = n54/n274;
-      n335 = n45/n265;
-      n336 = pow(alpha, n25*n258) + n96 - 1;
-      n337 = n97 - 1 + 1.0/n261;
-      n338 = n101 - 1 + 1.0/n262;
-      n339 = n102 - 1 + 1.0/n263;
-      n340 = n103 - 1 + 1.0/n264;
-      n341 = n104 - 1 + 1.0/n265;
-      n342 = n105 - 1 + 1.0/n266;
-      n343 = n106 - 1 + 1.0/n267;
-      n344 = n107 - 1 + 1.0/n268;
-      n345 = n108 - 1 + 1.0/n269;
-      n346 = n109 - 1 + 1.0/n270;
-      n347 = n110 - 1 + 1.0/n271;
-      n348 = n111 - 1 + 1.0/n272;
-      n349 = n112 - 1 + 1.0/n273;
-      n350 = n113 - 1 + 1.0/n274;
-      n351 = n114 - 1 + 1.0/n275;
-      n352 = n115 - 1 + 1.0/n276;
-      n353 = n116 - 1 + 1.0/n277;
-      n354 = n117 - 1 + 1.0/n278;
-      n355 = n118 - 1 + 1.0/n279;
-      n356 = n96 - 1 + 1.0/n260;
-      n357 = -n301 + n97 - 1;
-      n358 = n101 - n310 - 1;
-      n359 = -n139 - n298 - 1;
-      n360 = n103 - n295 - 1;
-      n361 = n341;
-      n362 = n105 - n306 - 1;
-      n363 = n343;
-      n364 = n107 - n327 - 1;
-      n365 = n108 - n291 - 1;
-      n366 = n109 - n320 - 1;
-      n367 = n110 - n325 - 1;
-      n368 = n348;
-      n369 = n112 - n317 - 1;
-      n370 = n350;
-      n371 = n114 - n312 - 1;
-      n372 = n115 - n300 - 1;
-      n373 = n116 - n329 - 1;
-      n374 = n117 - n323 - 1;
-      n375 = n118 - n315 - 1;
-      n376 = pow(n336, -n24);
-      n377 = pow(n337, -n24);
-      n378 = pow(n338, -n24);
-      n379 = pow(n339, -n24);
-      n380 = pow(n340, -n24);
-      n381 = pow(n341, -n24);
-      n382 = pow(n342, -n24);
-      n383 = pow(n343, -n24);
-      n384 = pow(n344, -n24);
-      n385 = pow(n345, -n24);
-      n386 = pow(n346, -n24);
-      n387 = pow(n347, -n24);
-      n388 = pow(n348, -n24);
-      n389 = pow(n349, -n24);
-      n390 = pow(n350, -n24);
-      n391 = pow(n351, -n24);
-      n392 = pow(n352, -n24);
-      n393 = pow(n353, -n24);
-      n394 = pow(n354, -n24);
-      n395 = pow(n355, -n24);
-      n396 = pow(n336, 3);
-      n397 = pow(n337, 3);
-      n398 = pow(n338, 3);
-      n399 = pow(n339, 3);
-      n400 = pow(n340, 3);
-      n401 = pow(n341, 3);
-      n402 = pow(n342, 3);
-      n403 = pow(n343, 3);
-      n404 = pow(n344, 3);
-      n405 = pow(n345, 3);
-      n406 = pow(n346, 3);
-      n407 = pow(n347, 3);
-      n408 = pow(n348, 3);
-      n409 = pow(n349, 3);
-      n410 = pow(n350, 3);
-      n411 = pow(n351, 3);
-      n412 = pow(n352, 3);
-      n413 = pow(n353, 3);
-      n414 = pow(n354, 3);
-      n415 = pow(n355, 3);
-      n416 = pow(n356, -n24);
-      n417 = pow(n357, -n24);
-      n418 = pow(n362, -n24);
-      n419 = pow(n364, -n24);
-      n420 = pow(n366, -n24);
-      n421 = pow(n368, -n24);
-      n422 = pow(n369, -n24);
-      n423 = pow(n370, -n24);
-      n424 = pow(n371, -n24);
-      n425 = pow(n372, -n24);
-      n426 = pow(n373, -n24);
-      n427 = pow(n356, 3);
-      n428 = xF[12]/n339;
-      n429 = xF[17]/n344;
-      n430 = 0.5/n336;
-      n431 = xF[10]/n337;
-      n432 = xF[11]/n338;
-      n433 = xF[19]/n346;
-      n434 = xF[0]/n336;
-      n435 = xF[16]/n343;
-      n436 = xF[14]/n341;
-      n437 = xF[3]/n389;
-      n438 = n1/n347;
-      n439 = n1/n341;
-      n440 = xF[17]/n384;
-      n441 = xF[10]/n377;
-      n442 = n1/n343;
-      n443 = n1/n355;
-      n444 = n1/n353;
-      n445 = -1/n393;
-      n446 = xF[0]/n416;
-      n447 = n1/n376;
-      n448 = n1*n12/n345;
-      n449 = n147/n348;
-      n450 = n96/n376;
-      n451 = n113/n410;
-      n452 = n186/n391;
-      n453 = n115*xF[6]/n412;
-      n454 = n187/n387;
-      n455 = n113*xF[4]/n390;
-      n456 = n107*xF[17]/n404;
-      n457 = n102*xF[12]/n399;
-      n458 = n197/n394;
-      n459 = n97*xF[10]/n397;
-      n460 = 1/(n249*n274);
-      n461 = 1/(n249*n260);
-      n462 = n12/(n249*n269);
-      n463 = n22/(n249*n279);
-      n464 = n293/n250;
-      n465 = n299/n250;
-      n466 = n241*xF[9]/n355;
-      n467 = n235*xF[1]/n347;
-      n468 = n319/n250;
-      n469 = n309/n250;
-      n470 = n313/n250;
-      n471 = n328/n250;
-      n472 = n331/n250;
-      n473 = n332/n250;
-      n474 = n1*n25*n434*n63*n86;
-      n475 = n244*n86/n336;
-      n476 = n231*n431*n86;
-      n477 = n202*n40*n432*n86;
-      n478 = n232*n428*n86;
-      n479 = n143*n153*n86/n340;
-      n480 = n242*n436*n86;
-      n481 = n233*n86*xF[15]/n342;
-      n482 = n243*n435*n86;
-      n483 = n234*n429*n86;
-      n484 = n144*n171*n86/n345;
-      n485 = n207*n40*n433*n86;
-      n486 = n467*n86;
-      n487 = n181*n449*n86;
-      n488 = n247*n86/n349;
-      n489 = n248*n86/n350;
-      n490 = n237*n86*xF[5]/n351;
-      n491 = n246*n86/n352;
-      n492 = n245*n86/n353;
-      n493 = n145*n174*n86/n354;
-      n494 = n466*n86;
-      n495 = n244*n430*n86;
-      n496 = n229*n461 + 1;
-      n497 = n209*n229*n461 + n209;
-      n498 = n210 + n253*n324/n249;
-      n499 = n211 + n253*n311/n249;
-      n500 = n212 + n253*n294/n249;
-      n501 = n213 + n229*n63*n89/(n249*n264);
-      n502 = n214 + n253*n305/n249;
-      n503 = n215 + n229*n63*n91/(n249*n266);
-      n504 = n216 + n253*n308/n249;
-      n505 = n217 + n253*n302/n249;
-      n506 = n218 + n253*n462;
-      n507 = n219 + n253*n296/n249;
-      n508 = n220 + n253*n314/n249;
-      n509 = n221 + n229*n63*n90/(n249*n272);
-      n510 = n222 + n253*n303/n249;
-      n511 = n223 + n253*n318/n249;
-      n512 = n224 + n229*n63*n87/(n249*n275);
-      n513 = n225 + n253*n304/n249;
-      n514 = n226 + n253*n297/n249;
-      n515 = n227 + n229*n63*n92/(n249*n278);
-      n516 = n228 + n253*n463;
-      n517 = pow(n497, -n24);
-      n518 = pow(n498, -n24);
-      n519 = pow(n499, -n24);
-      n520 = pow(n500, -n24);
-      n521 = pow(n501, -n24);
-      n522 = pow(n502, -n24);
-      n523 = pow(n503, -n24);
-      n524 = pow(n504, -n24);
-      n525 = pow(n505, -n24);
-      n526 = pow(n506, -n24);
-      n527 = pow(n507, -n24);
-      n528 = pow(n508, -n24);
-      n529 = pow(n509, -n24);
-      n530 = pow(n510, -n24);
-      n531 = pow(n511, -n24);
-      n532 = pow(n512, -n24);
-      n533 = pow(n513, -n24);
-      n534 = pow(n514, -n24);
-      n535 = pow(n515, -n24);
-      n536 = pow(n516, -n24);
-      n537 = pow(alpha, n25*n259)*n209*n229/n250 + n209;
-      n538 = n497*xF[0];
-      n539 = n511*xF[4];
-      n540 = n1*n24*n25*n63 + n24*n25*n253*n461;
-      n541 = pow(n537, -n24);
-      n542 = -n205*n229*n255/n260 - n205*n40;
-      n543 = n205*n229*n461*n88 + n205*n88;
-      n544 = n112*n510;
-      n545 = n498*n97;
-      n546 = n107*n505;
-      n547 = n504/n383;
-      n548 = n499/n378;
-      n549 = n509/n388;
-      n550 = n506/n385;
-      n551 = n516/n395;
-      n552 = n512/n391;
-      n553 = n501/n380;
-      n554 = n502/n381;
-      n555 = n503/n382;
-      n556 = n508/n387;
-      n557 = n514/n393;
-      n558 = n526/n405;
-      n559 = n500*xF[12]/n379;
-      n560 = n513*xF[6]/n392;
-      n561 = n536/n415;
-      n562 = n507*xF[19]/n386;
-      n563 = n523/n402;
-      n564 = n521/n400;
-      n565 = n534/n413;
-      n566 = n529/n408;
-      n567 = n532/n411;
-      n568 = n519/n398;
-      n569 = n524/n403;
-      n570 = n528/n407;
-      n571 = n522/n401;
-      n572 = n540/n396;
-      n573 = n517*n96/n396;
-      n574 = n112*n530*xF[3]/n409;
-      n575 = n197*n535/n414;
-      n576 = n109*n527*xF[19]/n406;
-      n577 = n450*n538*n86;
-      n578 = n179*n542/n416;
-      n579 = n24*n25*n447*n63*n86*xF[0]*(pow(alpha, n25*n258 + n62)*n0*n1*n229/n249 + n209);
-      n580 = n163*n441*n61*n86*(pow(alpha, -n258*n4 + n62)*n1*n229*n4/n249 + n210);
-      n581 = n211*n30*n86*(pow(alpha, -n258*n5 + n62)*n1*n229*n5/n249 + n211)/n378;
-      n582 = n212*n29*n86*(pow(alpha, -n258*n6 + n62)*n1*n229*n6/n249 + n212)/n379;
-      n583 = n143*n61*n7*n86*(pow(alpha, -n258*n7 + n62)*n229*n89/n249 + n213)/n380;
-      n584 = n200*n61*n86*(pow(alpha, -n258*n8 + n62)*n1*n229*n8/n249 + n214)/n381;
-      n585 = n194*n61*n86*xF[15]*(pow(alpha, -n258*n9 + n62)*n229*n91/n249 + n215)/n382;
-      n586 = n203*n61*n86*(pow(alpha, -n10*n258 + n62)*n1*n10*n229/n249 + n216)/n383;
-      n587 = n217*n36*n86*(pow(alpha, -n11*n258 + n62)*n1*n11*n229/n249 + n217)/n384;
-      n588 = n12*n144*n61*n86*(pow(alpha, -n12*n258 + n62)*n1*n12*n229/n249 + n218)/n385;
-      n589 = n169*n61*n86*xF[19]*(pow(alpha, -n13*n258 + n62)*n1*n13*n229/n249 + n219)/n386;
-      n590 = n220*n35*n86*(pow(alpha, -n14*n258 + n62)*n1*n14*n229/n249 + n220)/n387;
-      n591 = n147*n15*n61*n86*(pow(alpha, -n15*n258 + n62)*n229*n90/n249 + n221)/n388;
-      n592 = n154*n437*n61*n86*(pow(alpha, -n16*n258 + n62)*n1*n16*n229/n249 + n222);
-      n593 = n223*n28*n86*(pow(alpha, -n17*n258 + n62)*n1*n17*n229/n249 + n223)/n390;
-      n594 = n18*n61*n80*n86*xF[5]*(pow(alpha, -n18*n258 + n62)*n229*n87/n249 + n224)/n391;
-      n595 = n157*n61*n86*xF[6]*(pow(alpha, -n19*n258 + n62)*n1*n19*n229/n249 + n225)/n392;
-      n596 = n206*n61*n86*(pow(alpha, -n20*n258 + n62)*n1*n20*n229/n249 + n226)/n393;
-      n597 = n145*n21*n61*n86*(pow(alpha, -n21*n258 + n62)*n229*n92/n249 + n227)/n394;
-      n598 = n204*n61*n86*(pow(alpha, -n22*n258 + n62)*n1*n22*n229/n249 + n228)/n395;
-      n599 = 1.0*n209*n538*n86/n376;
-      n600 = n450*n543*n86*xF[0];
-      n601 = 0.5*n600;
-      n602 = pow(alpha, n0*n38)*n0*n100*n324*n40/(n251*n99) + pow(alpha, n0*n38)*n100*n41*n88/(n251*n261*n99) + n158*n229*n255*n324 + n231;
-      n603 = pow(alpha, n0*n38)*n0*n100*n294*n40/(n251*n99) + pow(alpha, n0*n38)*n100*n43*n88/(n251*n263*n99) + n158*n229*n255*n294 + n232;
-      n604 = pow(alpha, n0*n38)*n100*n153/(n251*n264*n99) + pow(alpha, n0*n38)*n100*n25*n292*n40/(n251*n99) + n229*n25*n255*n292*n63 + n44*n69*n88;
-      n605 = pow(alpha, n0*n38)*n0*n100*n321*n40/(n251*n99) + pow(alpha, n0*n38)*n100*n46*n88/(n251*n266*n99) + n158*n229*n255*n321 + n233;
-      n606 = pow(alpha, n0*n38)*n100*n25*n308*n40/(n251*n99) + pow(alpha, n0*n38)*n100*n333*n40/(n251*n99) + n229*n25*n255*n308*n63 + n47*n72*n88;
-      n607 = pow(alpha, n0*n38)*n0*n100*n302*n40/(n251*n99) + pow(alpha, n0*n38)*n100*n48*n88/(n251*n268*n99) + n158*n229*n255*n302 + n234;
-      n608 = pow(alpha, n0*n38)*n100*n12*n25*n40/(n251*n269*n99) + pow(alpha, n0*n38)*n100*n171/(n251*n269*n99) + n12*n229*n25*n255*n63/n269 + n49*n74*n88;
-      n609 = pow(alpha, n0*n38)*n100*n25*n296*n40/(n251*n99) + pow(alpha, n0*n38)*n100*n40*n50/(n251*n270*n99) + n207*n88 + n229*n25*n255*n296*n63;
-      n610 = pow(alpha, n0*n38)*n100*n181/(n251*n272*n99) + pow(alpha, n0*n38)*n100*n25*n316*n40/(n251*n99) + n229*n25*n255*n316*n63 + n52*n77*n88;
-      n611 = pow(alpha, n0*n38)*n0*n100*n303*n40/(n251*n99) + pow(alpha, n0*n38)*n100*n53*n88/(n251*n273*n99) + n158*n229*n255*n303 + n236;
-      n612 = pow(alpha, n0*n38)*n0*n100*n304*n40/(n251*n99) + pow(alpha, n0*n38)*n100*n56*n88/(n251*n276*n99) + n158*n229*n255*n304 + n238;
-      n613 = pow(alpha, n0*n38)*n100*n40*n93/(n251*n279*n99) + pow(alpha, n0*n38)*n100*n59*n88/(n251*n279*n99) + n229*n255*n63*n93/n279 + n241;
-      n614 = pow(alpha, n0*n38)*n100*n25*n311*n40/(n251*n99) + pow(alpha, n0*n38)*n100*n40*n42/(n251*n262*n99) + n202*n88 + n229*n25*n255*n311*n63;
-      n615 = n184*(pow(alpha, n0*n38 - n258*n8)*n100*n25*n40*n8/(n251*n99) + pow(alpha, n0*n38 - n258*n8)*n100*n40*n45/(n251*n99) + n229*n25*n255*n305*n63 + n45*n70*n88)/n381;
-      n616 = n176*n86*(pow(alpha, n0*n38 - n258*n7)*n100*n153/(n251*n99) + pow(alpha, n0*n38 - n258*n7)*n100*n25*n40*n7/(n251*n99) + n229*n25*n255*n292*n63 + n44*n69*n88)/n380;
-      n617 = n615*n86;
-      n618 = n149*n86*(pow(alpha, n0*n38 - n10*n258)*n10*n100*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n10*n258)*n100*n40*n47/(n251*n99) + n229*n25*n255*n308*n63 + n47*n72*n88)/n383;
-      n619 = n152*n86*(pow(alpha, n0*n38 - n12*n258)*n100*n12*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n12*n258)*n100*n171/(n251*n99) + n12*n229*n25*n255*n63/n269 + n49*n74*n88)/n385;
-      n620 = n109*n86*xF[19]*(pow(alpha, n0*n38 - n13*n258)*n100*n13*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n13*n258)*n100*n40*n50/(n251*n99) + n207*n88 + n229*n25*n255*n296*n63)/n386;
-      n621 = n170*n86*(pow(alpha, n0*n38 - n15*n258)*n100*n15*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n15*n258)*n100*n181/(n251*n99) + n229*n25*n255*n316*n63 + n52*n77*n88)/n388;
-      n622 = n455*n86*(pow(alpha, n0*n38 - n17*n258)*n100*n148*n25/(n251*n99) + pow(alpha, n0*n38 - n17*n258)*n100*n40*n54/(n251*n99) + n148*n229*n25*n460*n63 + n208*n88);
-      n623 = n142*n441*n97*(pow(alpha, n0*n38 - n258*n4)*n0*n100*n4*n40/(n251*n99) + pow(alpha, n0*n38 - n258*n4)*n100*n41*n88/(n251*n99) + n158*n229*n255*n324 + n231);
-      n624 = n139*n86*xF[12]*(pow(alpha, n0*n38 - n258*n6)*n0*n100*n40*n6/(n251*n99) + pow(alpha, n0*n38 - n258*n6)*n100*n43*n88/(n251*n99) + n158*n229*n255*n294 + n232)/n379;
-      n625 = n142*n156*(pow(alpha, n0*n38 - n258*n9)*n0*n100*n40*n9/(n251*n99) + pow(alpha, n0*n38 - n258*n9)*n100*n46*n88/(n251*n99) + n158*n229*n255*n321 + n233)/n382;
-      n626 = n107*n142*n440*(pow(alpha, n0*n38 - n11*n258)*n0*n100*n11*n40/(n251*n99) + pow(alpha, n0*n38 - n11*n258)*n100*n48*n88/(n251*n99) + n158*n229*n255*n302 + n234);
-      n627 = n142*n454*(pow(alpha, n0*n38 - n14*n258)*n0*n100*n14*n40/(n251*n99) + pow(alpha, n0*n38 - n14*n258)*n100*n51*n88/(n251*n99) + n158*n229*n255*n314 + n235);
-      n628 = n112*n142*n437*(pow(alpha, n0*n38 - n16*n258)*n0*n100*n16*n40/(n251*n99) + pow(alpha, n0*n38 - n16*n258)*n100*n53*n88/(n251*n99) + n158*n229*n255*n303 + n236);
-      n629 = n142*n452*(pow(alpha, n0*n38 - n18*n258)*n100*n40*n94/(n251*n99) + pow(alpha, n0*n38 - n18*n258)*n100*n55*n88/(n251*n99) + n229*n255*n63*n94/n275 + n237);
-      n630 = n115*n142*xF[6]*(pow(alpha, n0*n38 - n19*n258)*n0*n100*n19*n40/(n251*n99) + pow(alpha, n0*n38 - n19*n258)*n100*n56*n88/(n251*n99) + n158*n229*n255*n304 + n238)/n392;
-      n631 = n142*n164*(pow(alpha, n0*n38 - n20*n258)*n0*n100*n20*n40/(n251*n99) + pow(alpha, n0*n38 - n20*n258)*n100*n57*n88/(n251*n99) + n158*n229*n255*n297 + n239)/n393;
-      n632 = n142*n458*(pow(alpha, n0*n38 - n21*n258)*n0*n100*n21*n40/(n251*n99) + pow(alpha, n0*n38 - n21*n258)*n100*n58*n88/(n251*n99) + n158*n229*n255*n307 + n240);
-      n633 = n142*n162*(pow(alpha, n0*n38 - n22*n258)*n100*n40*n93/(n251*n99) + pow(alpha, n0*n38 - n22*n258)*n100*n59*n88/(n251*n99) + n229*n255*n63*n93/n279 + n241)/n395;
-      n634 = n495 + n599 + n601;
-      n635 = xTj*(n109*n142*n562 + n115*n142*n560 + n139*n559*n86 + n142*n149*n547 + n142*n150*n548 + n142*n152*n550 + n142*n156*n555 + n142*n162*n551 + n142*n164*n557 + n142*n170*n549 + n142*n176*n553 + n142*n184*n554 + n142*n437*n544 + n142*n440*n546 + n142*n441*n545 + n142*n450*n538 + n142*n452*n512 + n142*n454*n508 + n142*n455*n511 + n142*n458*n515 + n143*n86*n89/n340 + n144*n448*n86 + n145*n86*n92/n354 + n200*n439*n86 + n201*n438*n86 + n203*n442*n86 + n204*n443*n86 + n206*n444*n86 + n209*n434*n86 + n210*n431*n86 + n211*n432*n86 + n212*n428*n86 + n215*n86*xF[15]/n342 + n217*n429*n86 + n219*n433*n86 + n222*n86*xF[3]/n349 + n223*n86*xF[4]/n350 + n224*n86*xF[5]/n351 + n225*n86*xF[6]/n352 + n449*n86*n90);
-      n636 = n474 + n577 + n635;
-      n637 = n475 + n476 + n477 + n478 + n479 + n480 + n481 + n482 + n483 + n484 + n485 + n486 + n487 + n488 + n489 + n490 + n491 + n492 + n493 + n494 + n579 + n580 + n581 + n582 + n583 + n584 + n585 + n586 + n587 + n588 + n589 + n590 + n591 + n592 + n593 + n594 + n595 + n596 + n597 + n598 + n600 + n616 + n617 + n618 + n619 + n620 + n621 + n622 + n623 + n624 + n625 + n626 + n627 + n628 + n629 + n630 + n631 + n632 + n633;
-      n638 = n109*n142*n507*xF[19]*(n169*n61 + n229*n296*n61*n63/n249)/n406 + n139*n500*n86*xF[12]*(n229*n294*n61*n63/n249 + n6*n61*n68)/n399 + n142*n149*n504*(n182*n61 + n229*n308*n61*n63/n249)/n403 + n142*n150*n499*(n229*n311*n61*n63/n249 + n5*n61*n67)/n398 + n142*n152*n506*(n192*n61 + n229*n462*n61*n63)/n405 + n142*n156*n503*(n194*n61 + n229*n321*n61*n63/n249)/n402 + n142*n162*n516*(n185*n61 + n229*n463*n61*n63)/n415 + n142*n164*n514*(n193*n61 + n229*n297*n61*n63/n249)/n413 + n142*n170*n509*(n15*n61*n77 + n229*n316*n61*n63/n249)/n408 + n142*n176*n501*(n229*n292*n61*n63/n249 + n61*n69*n7)/n400 + n142*n184*n502*(n173*n61 + n229*n305*n61*n63/n249)/n401 + n142*n186*n512*(n18*n61*n80 + n229*n322*n61*n63/n249)/n411 + n142*n187*n508*(n188*n61 + n229*n314*n61*n63/n249)/n407 + n142*n197*n515*(n21*n61*n83 + n229*n307*n61*n63/n249)/n414 + n142*n451*n539*(n17*n61*n79 + n229*n318*n61*n63/n249) + n142*n453*n513*(n157*n61 + n229*n304*n61*n63/n249) + n142*n456*n505*(n161*n61 + n229*n302*n61*n63/n249) + n142*n459*n498*(n163*n61 + n229*n324*n61*n63/n249) + n142*n538*n572*n96 + n142*n544*xF[3]*(n154*n61 + n229*n303*n61*n63/n249)/n409 + n150*n86*(pow(alpha, n0*n38 - n258*n5)*n100*n25*n40*n5/(n251*n99) + pow(alpha, n0*n38 - n258*n5)*n100*n40*n42/(n251*n99) + n202*n88 + n229*n25*n255*n311*n63)/n378 + n637;
-      NP_b = -n209*n450*n496*n86*xF[0] - n38*(1.0*n209*n86*xF[0]*(pow(alpha, -n0*n258 + n62)*n0*n1*n229/n249 + n209)/n376 + 0.5*n450*n86*xF[0]*(pow(alpha, -n0*n258 + n62)*n229*n39*n88/n249 + n205*n88) + n495 - 1.0*n573*n86*xF[0] - 0.5*xTj*(n107*n142*n440*(pow(alpha, n0*n38 - n11*n258)*n0*n100*n11*n40/(n251*n99) + pow(alpha, n0*n38 - n11*n258)*n100*n48*n88/(n251*n99) + pow(alpha, -n11*n258 + n62)*n0*n11*n229*n255 + n234) + n109*n86*xF[19]*(pow(alpha, n0*n38 - n13*n258)*n100*n13*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n13*n258)*n100*n40*n50/(n251*n99) + pow(alpha, -n13*n258 + n62)*n13*n229*n25*n255 + n207*n88)/n386 + n112*n142*n437*(pow(alpha, n0*n38 - n16*n258)*n0*n100*n16*n40/(n251*n99) + pow(alpha, n0*n38 - n16*n258)*n100*n53*n88/(n251*n99) + pow(alpha, -n16*n258 + n62)*n0*n16*n229*n255 + n236) + n115*n142*xF[6]*(pow(alpha, n0*n38 - n19*n258)*n0*n100*n19*n40/(n251*n99) + pow(alpha, n0*n38 - n19*n258)*n100*n56*n88/(n251*n99) + pow(alpha, -n19*n258 + n62)*n0*n19*n229*n255 + n238)/n392 + n139*n86*xF[12]*(pow(alpha, n0*n38 - n258*n6)*n0*n100*n40*n6/(n251*n99) + pow(alpha, n0*n38 - n258*n6)*n100*n43*n88/(n251*n99) + pow(alpha, -n258*n6 + n62)*n0*n229*n255*n6 + n232)/n379 + n142*n150*(pow(alpha, n0*n38 - n258*n5)*n0*n100*n40*n5/(n251*n99) + pow(alpha, n0*n38 - n258*n5)*n100*n42*n88/(n251*n99) + pow(alpha, -n258*n5 + n62)*n0*n229*n255*n5 + n202*n40)/n378 + n142*n156*(pow(alpha, n0*n38 - n258*n9)*n0*n100*n40*n9/(n251*n99) + pow(alpha, n0*n38 - n258*n9)*n100*n46*n88/(n251*n99) + pow(alpha, -n258*n9 + n62)*n0*n229*n255*n9 + n233)/n382 + n142*n162*(pow(alpha, n0*n38 - n22*n258)*n100*n40*n93/(n251*n99) + pow(alpha, n0*n38 - n22*n258)*n100*n59*n88/(n251*n99) + pow(alpha, -n22*n258 + n62)*n229*n255*n93 + n241)/n395 + n142*n164*(pow(alpha, n0*n38 - n20*n258)*n0*n100*n20*n40/(n251*n99) + pow(alpha, n0*n38 - n20*n258)*n100*n57*n88/(n251*n99) + pow(alpha, -n20*n258 + n62)*n0*n20*n229*n255 + n239)/n393 + n142*n441*n97*(pow(alpha, n0*n38 - n258*n4)*n0*n100*n4*n40/(n251*n99) + pow(alpha, n0*n38 - n258*n4)*n100*n41*n88/(n251*n99) + pow(alpha, -n258*n4 + n62)*n0*n229*n255*n4 + n231) + n142*n452*(pow(alpha, n0*n38 - n18*n258)*n100*n40*n94/(n251*n99) + pow(alpha, n0*n38 - n18*n258)*n100*n55*n88/(n251*n99) + pow(alpha, -n18*n258 + n62)*n229*n255*n94 + n237) + n142*n454*(pow(alpha, n0*n38 - n14*n258)*n0*n100*n14*n40/(n251*n99) + pow(alpha, n0*n38 - n14*n258)*n100*n51*n88/(n251*n99) + pow(alpha, -n14*n258 + n62)*n0*n14*n229*n255 + n235) + n142*n458*(pow(alpha, n0*n38 - n21*n258)*n0*n100*n21*n40/(n251*n99) + pow(alpha, n0*n38 - n21*n258)*n100*n58*n88/(n251*n99) + pow(alpha, -n21*n258 + n62)*n0*n21*n229*n255 + n240) + n149*n24*n569*n86 + n149*n86*(pow(alpha, n0*n38 - n10*n258)*n10*n100*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n10*n258)*n100*n40*n47/(n251*n99) + pow(alpha, -n10*n258 + n62)*n10*n229*n25*n255 + n47*n72*n88)/n383 + n150*n24*n568*n86 + n152*n24*n558*n86 + n152*n86*(pow(alpha, n0*n38 - n12*n258)*n100*n12*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n12*n258)*n100*n171/(n251*n99) + pow(alpha, -n12*n258 + n62)*n12*n229*n25*n255 + n49*n74*n88)/n385 + n156*n24*n563*n86 + n162*n24*n561*n86 + n164*n24*n565*n86 + n170*n24*n566*n86 + n170*n86*(pow(alpha, n0*n38 - n15*n258)*n100*n15*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n15*n258)*n100*n181/(n251*n99) + pow(alpha, -n15*n258 + n62)*n15*n229*n25*n255 + n52*n77*n88)/n388 + n176*n24*n564*n86 + n176*n86*(pow(alpha, n0*n38 - n258*n7)*n100*n153/(n251*n99) + pow(alpha, n0*n38 - n258*n7)*n100*n25*n40*n7/(n251*n99) + pow(alpha, -n258*n7 + n62)*n229*n25*n255*n7 + n44*n69*n88)/n380 + n184*n24*n571*n86 + n184*n86*(pow(alpha, n0*n38 - n258*n8)*n100*n25*n40*n8/(n251*n99) + pow(alpha, n0*n38 - n258*n8)*n100*n40*n45/(n251*n99) + pow(alpha, -n258*n8 + n62)*n229*n25*n255*n8 + n45*n70*n88)/n381 + n186*n24*n567*n86 + n187*n24*n570*n86 + n24*n451*n531*n86*xF[4] + n24*n453*n533*n86 + n24*n456*n525*n86 + n24*n457*n520*n86 + n24*n459*n518*n86 + n24*n573*n86*xF[0] + n24*n574*n86 + n24*n575*n86 + n24*n576*n86 + n450*n86*xF[0]*(pow(alpha, -n0*n258 + n62)*n229*n39*n88/n249 + n205*n88) + n455*n86*(pow(alpha, n0*n38 - n17*n258)*n100*n148*n25/(n251*n99) + pow(alpha, n0*n38 - n17*n258)*n100*n40*n54/(n251*n99) + pow(alpha, -n17*n258 + n62)*n148*n229*n25/n249 + n208*n88) + n475 + n476 + n477 + n478 + n479 + n480 + n481 + n482 + n483 + n484 + n485 + n486 + n487 + n488 + n489 + n490 + n491 + n492 + n493 + n494 + n579 + n580 + n581 + n582 + n583 + n584 + n585 + n586 + n587 + n588 + n589 + n590 + n591 + n592 + n593 + n594 + n595 + n596 + n597 + n598)) - n474 - n86*xTj*(-n109*n562 - n115*n560 + n139*n559 + n143*n89/n340 + n144*n448 + n145*n92/n354 - n149*n547 - n150*n548 - n152*n550 - n156*n555 - n162*n551 + n164*n445*n514 - n170*n549 - n176*n553 - n184*n554 + n200*n439 + n201*n438 + n203*n442 + n204*n443 + n206*n444 + n209*n434 + n210*n431 + n211*n432 + n212*n428 + n215*xF[15]/n342 + n217*n429 + n219*n433 + n222*xF[3]/n349 + n223*xF[4]/n350 + n224*xF[5]/n351 + n225*xF[6]/n352 - n437*n544 - n440*n546 - n441*n545 + n449*n90 - n450*n538 - n452*n512 - n454*n508 - n455*n511 - n458*n515);
-      NP_2a = -n86*(pow(alpha, n0*n38)*n33*n39*n40*pow(n496, -n24)*n96/n396 - 2.0*pow(alpha, n0*n38)*n39*n40*n496*xF[0]/n376 + n205*n450*n88*xF[0]*(n461*(-n26 + xPj*xTj)/n64 - 1) - 1.0*n244/n336 + 1.0*xTj*(-n107*n440*(pow(alpha, n0*n38 - n11*n258)*n0*n100*n11*n40/(n251*n99) + pow(alpha, n0*n38 - n11*n258)*n100*n48*n88/(n251*n99) + n158*n229*n255*n302 + n234) + n109*xF[19]*(pow(alpha, n0*n38 - n13*n258)*n100*n13*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n13*n258)*n100*n40*n50/(n251*n99) + n207*n88 + n229*n25*n255*n296*n63)/n386 - n112*n437*(pow(alpha, n0*n38 - n16*n258)*n0*n100*n16*n40/(n251*n99) + pow(alpha, n0*n38 - n16*n258)*n100*n53*n88/(n251*n99) + n158*n229*n255*n303 + n236) - n115*xF[6]*(pow(alpha, n0*n38 - n19*n258)*n0*n100*n19*n40/(n251*n99) + pow(alpha, n0*n38 - n19*n258)*n100*n56*n88/(n251*n99) + n158*n229*n255*n304 + n238)/n392 + n12*n144*n61*(pow(alpha, -n12*n258 + n62)*n1*n12*n229/n249 + n218)/n385 + n139*xF[12]*(pow(alpha, n0*n38 - n258*n6)*n0*n100*n40*n6/(n251*n99) + pow(alpha, n0*n38 - n258*n6)*n100*n43*n88/(n251*n99) + n158*n229*n255*n294 + n232)/n379 + n143*n153/n340 + n143*n61*n7*(pow(alpha, -n258*n7 + n62)*n229*n89/n249 + n213)/n380 + n144*n171/n345 + n145*n174/n354 + n145*n21*n61*(pow(alpha, -n21*n258 + n62)*n229*n92/n249 + n227)/n394 + n147*n15*n61*(pow(alpha, -n15*n258 + n62)*n229*n90/n249 + n221)/n388 + n149*n24*n569 + n149*(pow(alpha, n0*n38 - n10*n258)*n10*n100*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n10*n258)*n100*n40*n47/(n251*n99) + n229*n25*n255*n308*n63 + n47*n72*n88)/n383 + n150*n24*n568 + n150*(pow(alpha, n0*n38 - n258*n5)*n100*n25*n40*n5/(n251*n99) + pow(alpha, n0*n38 - n258*n5)*n100*n40*n42/(n251*n99) + n202*n88 + n229*n25*n255*n311*n63)/n378 + n152*n24*n558 + n152*(pow(alpha, n0*n38 - n12*n258)*n100*n12*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n12*n258)*n100*n171/(n251*n99) + n12*n229*n25*n255*n63/n269 + n49*n74*n88)/n385 + n154*n437*n61*(pow(alpha, -n16*n258 + n62)*n1*n16*n229/n249 + n222) + n156*n24*n563 - n156*(pow(alpha, n0*n38 - n258*n9)*n0*n100*n40*n9/(n251*n99) + pow(alpha, n0*n38 - n258*n9)*n100*n46*n88/(n251*n99) + n158*n229*n255*n321 + n233)/n382 + n157*n61*xF[6]*(pow(alpha, -n19*n258 + n62)*n1*n19*n229/n249 + n225)/n392 + n162*n24*n561 - n162*(pow(alpha, n0*n38 - n22*n258)*n100*n40*n93/(n251*n99) + pow(alpha, n0*n38 - n22*n258)*n100*n59*n88/(n251*n99) + n229*n255*n63*n93/n279 + n241)/n395 + n163*n441*n61*(pow(alpha, -n258*n4 + n62)*n1*n229*n4/n249 + n210) + n164*n24*n565 + n164*n445*(pow(alpha, n0*n38 - n20*n258)*n0*n100*n20*n40/(n251*n99) + pow(alpha, n0*n38 - n20*n258)*n100*n57*n88/(n251*n99) + n158*n229*n255*n297 + n239) + n169*n61*xF[19]*(pow(alpha, -n13*n258 + n62)*n1*n13*n229/n249 + n219)/n386 + n170*n24*n566 + n170*(pow(alpha, n0*n38 - n15*n258)*n100*n15*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n15*n258)*n100*n181/(n251*n99) + n229*n25*n255*n316*n63 + n52*n77*n88)/n388 + n176*n24*n564 + n176*(pow(alpha, n0*n38 - n258*n7)*n100*n153/(n251*n99) + pow(alpha, n0*n38 - n258*n7)*n100*n25*n40*n7/(n251*n99) + n229*n25*n255*n292*n63 + n44*n69*n88)/n380 + n18*n61*n80*xF[5]*(pow(alpha, -n18*n258 + n62)*n229*n87/n249 + n224)/n391 + n181*n449 + n184*n24*n571 + n186*n24*n567 + n187*n24*n570 + n194*n61*xF[15]*(pow(alpha, -n258*n9 + n62)*n229*n91/n249 + n215)/n382 + n200*n61*(pow(alpha, -n258*n8 + n62)*n1*n229*n8/n249 + n214)/n381 + n202*n40*n432 + n203*n61*(pow(alpha, -n10*n258 + n62)*n1*n10*n229/n249 + n216)/n383 + n204*n61*(pow(alpha, -n22*n258 + n62)*n1*n22*n229/n249 + n228)/n395 + n206*n61*(pow(alpha, -n20*n258 + n62)*n1*n20*n229/n249 + n226)/n393 + n207*n40*n433 + n211*n30*(pow(alpha, -n258*n5 + n62)*n1*n229*n5/n249 + n211)/n378 + n212*n29*(pow(alpha, -n258*n6 + n62)*n1*n229*n6/n249 + n212)/n379 + n217*n36*(pow(alpha, -n11*n258 + n62)*n1*n11*n229/n249 + n217)/n384 + n220*n35*(pow(alpha, -n14*n258 + n62)*n1*n14*n229/n249 + n220)/n387 + n223*n28*(pow(alpha, -n17*n258 + n62)*n1*n17*n229/n249 + n223)/n390 + n231*n431 + n232*n428 + n233*xF[15]/n342 + n234*n429 + n237*xF[5]/n351 + n24*n25*n447*n63*xF[0]*(pow(alpha, n25*n258 + n62)*n0*n1*n229/n249 + n209) + n24*n451*n531*xF[4] + n24*n453*n533 + n24*n456*n525 + n24*n457*n520 + n24*n459*n518 + n24*n573*xF[0] + n24*n574 + n24*n575 + n24*n576 + n242*n436 + n243*n435 + n244/n336 + n245/n353 + n246/n352 + n247/n349 + n248/n350 - n441*n97*(pow(alpha, n0*n38 - n258*n4)*n0*n100*n4*n40/(n251*n99) + pow(alpha, n0*n38 - n258*n4)*n100*n41*n88/(n251*n99) + n158*n229*n255*n324 + n231) + n450*n543*xF[0] - n452*(pow(alpha, n0*n38 - n18*n258)*n100*n40*n94/(n251*n99) + pow(alpha, n0*n38 - n18*n258)*n100*n55*n88/(n251*n99) + n229*n255*n63*n94/n275 + n237) - n454*(pow(alpha, n0*n38 - n14*n258)*n0*n100*n14*n40/(n251*n99) + pow(alpha, n0*n38 - n14*n258)*n100*n51*n88/(n251*n99) + n158*n229*n255*n314 + n235) + n455*(pow(alpha, n0*n38 - n17*n258)*n100*n148*n25/(n251*n99) + pow(alpha, n0*n38 - n17*n258)*n100*n40*n54/(n251*n99) + n148*n229*n25*n460*n63 + n208*n88) - n458*(pow(alpha, n0*n38 - n21*n258)*n0*n100*n21*n40/(n251*n99) + pow(alpha, n0*n38 - n21*n258)*n100*n58*n88/(n251*n99) + n158*n229*n255*n307 + n240) + n466 + n467 + n615));
-      NP_sqrt_base = (NP0*n636 + n142*n179/n356 + n32*(-n102*n86*xF[12]/(n102 - 1 + pow(alpha, -n6*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n107*n86*xF[17]/(n107 - 1 + pow(alpha, -n11*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n109*n86*xF[19]/(n109 - 1 + pow(alpha, -n13*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n112*n86*xF[3]/(n112 - 1 + pow(alpha, -n16*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n113*n86*xF[4]/(n113 - 1 + pow(alpha, -n17*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n115*n86*xF[6]/(n115 - 1 + pow(alpha, -n19*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n149*n86/(n106 - 1 + pow(alpha, -n10*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n150*n86/(n101 - 1 + pow(alpha, -n5*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n152*n86/(n108 - 1 + pow(alpha, -n12*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n156*n86/(n105 - 1 + pow(alpha, -n9*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n162*n86/(n118 - 1 + pow(alpha, -n22*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n164*n86/(n116 - 1 + pow(alpha, -n20*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n170*n86/(n111 - 1 + pow(alpha, -n15*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n176*n86/(n103 - 1 + pow(alpha, -n7*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n184*n86/(n104 - 1 + pow(alpha, -n8*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n186*n86/(n114 - 1 + pow(alpha, -n18*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n187*n86/(n110 - 1 + pow(alpha, -n14*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n197*n86/(n117 - 1 + pow(alpha, -n21*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) - n86*n96*xF[0]/(pow(alpha, n25*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)) + n96 - 1) - n86*n97*xF[10]/(n97 - 1 + pow(alpha, -n4*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)))) + pow(NP0, -n24)*(1.0*n209*n538*n86/n376 + 0.5*n475 - 0.5*n538*n572*n86*n96 + 0.5*n600 - 0.5*n638*xTj))*(n119*n31*n541*n86/n427 - 4.0*n209*n446*n86*(pow(alpha, n25*n259)*n0*n253/n250 + n0*n1*n63) + n24*n32*(n1*n24*n25*n63*n86*xF[0]*(n209 + pow(alpha, -n0*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n209*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n96 - 1 + pow(alpha, -n0*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n12*n144*n61*n86*(n218 + pow(alpha, -n12*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n12*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n108 - 1 + pow(alpha, -n12*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n121*n24*n86*xF[11]*pow(n211 + pow(alpha, -n5*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n5*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n101 - 1 + pow(alpha, -n5*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n121*n86*xF[11]*pow(n101 - 1 + pow(alpha, -n5*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(-pow(alpha, n0*n38)*pow(alpha, -n5*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n40*n5*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - pow(alpha, n0*n38)*pow(alpha, -n5*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n42*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - n202*n40 - pow(alpha, -n5*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n158*n40*n5*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n122*n142*xF[12]*pow(-n139 - 1 + pow(alpha, -n6*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(pow(alpha, n0*n38)*pow(alpha, -n6*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n40*n6*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + pow(alpha, n0*n38)*pow(alpha, -n6*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n43*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + n232 + pow(alpha, -n6*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n158*n40*n6*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n122*n24*n86*xF[12]*pow(n212 + pow(alpha, -n6*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n6*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(-n139 - 1 + pow(alpha, -n6*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n142*n151*pow(n114 - 1 + pow(alpha, -n18*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(pow(alpha, n0*n38)*pow(alpha, -n18*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n40*n94*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + pow(alpha, n0*n38)*pow(alpha, -n18*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n55*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + n237 + pow(alpha, -n18*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n40*n63*n94*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n142*n165*pow(n112 - 1 + pow(alpha, -n16*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(pow(alpha, n0*n38)*pow(alpha, -n16*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n16*n40*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + pow(alpha, n0*n38)*pow(alpha, -n16*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n53*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + n236 + pow(alpha, -n16*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n158*n16*n40*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n142*n166*pow(n107 - 1 + pow(alpha, -n11*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(pow(alpha, n0*n38)*pow(alpha, -n11*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n11*n40*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + pow(alpha, n0*n38)*pow(alpha, -n11*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n48*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + n234 + pow(alpha, -n11*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n11*n158*n40*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n142*n167*pow(n116 - 1 + pow(alpha, -n20*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(pow(alpha, n0*n38)*pow(alpha, -n20*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n20*n40*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + pow(alpha, n0*n38)*pow(alpha, -n20*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n57*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + n239 + pow(alpha, -n20*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n158*n20*n40*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n142*n172*pow(n110 - 1 + pow(alpha, -n14*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(pow(alpha, n0*n38)*pow(alpha, -n14*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n14*n40*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + pow(alpha, n0*n38)*pow(alpha, -n14*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n51*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + n235 + pow(alpha, -n14*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n14*n158*n40*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n142*n175*pow(n118 - 1 + pow(alpha, -n22*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(pow(alpha, n0*n38)*pow(alpha, -n22*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n40*n93*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + pow(alpha, n0*n38)*pow(alpha, -n22*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n59*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + n241 + pow(alpha, -n22*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n40*n63*n93*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n142*n177*pow(n105 - 1 + pow(alpha, -n9*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(pow(alpha, n0*n38)*pow(alpha, -n9*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n40*n9*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + pow(alpha, n0*n38)*pow(alpha, -n9*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n46*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + n233 + pow(alpha, -n9*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n158*n40*n9*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n142*n190*pow(n115 - 1 + pow(alpha, -n19*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(pow(alpha, n0*n38)*pow(alpha, -n19*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n19*n40*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + pow(alpha, n0*n38)*pow(alpha, -n19*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n56*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + n238 + pow(alpha, -n19*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n158*n19*n40*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n142*n195*pow(n97 - 1 + pow(alpha, -n4*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(pow(alpha, n0*n38)*pow(alpha, -n4*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n4*n40*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + pow(alpha, n0*n38)*pow(alpha, -n4*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n41*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + n231 + pow(alpha, -n4*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n158*n4*n40*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n142*n196*pow(n117 - 1 + pow(alpha, -n21*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(pow(alpha, n0*n38)*pow(alpha, -n21*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n21*n40*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + pow(alpha, n0*n38)*pow(alpha, -n21*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n58*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) + n240 + pow(alpha, -n21*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n158*n21*n40*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n143*n153*n86/(n103 - 1 + pow(alpha, -n7*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n143*n61*n7*n86*(n213 + pow(alpha, -n7*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n63*n89*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n103 - 1 + pow(alpha, -n7*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n144*n171*n86/(n108 - 1 + pow(alpha, -n12*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n145*n174*n86/(n117 - 1 + pow(alpha, -n21*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n145*n21*n61*n86*(n227 + pow(alpha, -n21*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n63*n92*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n117 - 1 + pow(alpha, -n21*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n147*n15*n61*n86*(n221 + pow(alpha, -n15*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n63*n90*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n111 - 1 + pow(alpha, -n15*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n147*n181*n86/(n111 - 1 + pow(alpha, -n15*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n151*n24*n86*pow(n224 + pow(alpha, -n18*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n63*n87*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n114 - 1 + pow(alpha, -n18*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n154*n61*n86*xF[3]*(n1*n16*n78 + pow(alpha, -n16*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n16*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n112 - 1 + pow(alpha, -n16*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n155*n24*n86*pow(n216 + pow(alpha, -n10*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n10*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n106 - 1 + pow(alpha, -n10*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n155*n86*pow(n106 - 1 + pow(alpha, -n10*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(-pow(alpha, n0*n38)*pow(alpha, -n10*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n10*n40*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - pow(alpha, n0*n38)*pow(alpha, -n10*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n47*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - n243 - pow(alpha, -n10*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n10*n158*n40*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n157*n61*n86*xF[6]*(n1*n19*n81 + pow(alpha, -n19*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n19*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n115 - 1 + pow(alpha, -n19*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n163*n61*n86*xF[10]*(n1*n4*n66 + pow(alpha, -n4*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n4*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n97 - 1 + pow(alpha, -n4*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n165*n24*n86*pow(n222 + pow(alpha, -n16*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n16*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n112 - 1 + pow(alpha, -n16*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n166*n24*n86*pow(n217 + pow(alpha, -n11*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n11*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n107 - 1 + pow(alpha, -n11*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n167*n24*n86*pow(n226 + pow(alpha, -n20*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n20*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n116 - 1 + pow(alpha, -n20*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n168*n24*n86*pow(n223 + pow(alpha, -n17*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n17*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n113 - 1 + pow(alpha, -n17*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n168*n86*pow(n113 - 1 + pow(alpha, -n17*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(-pow(alpha, n0*n38)*pow(alpha, -n17*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n148*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - pow(alpha, n0*n38)*pow(alpha, -n17*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n54*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - n208*n40 - pow(alpha, -n17*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n148*n158*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n169*n61*n86*xF[19]*(n1*n13*n75 + pow(alpha, -n13*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n13*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n109 - 1 + pow(alpha, -n13*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n172*n24*n86*pow(n220 + pow(alpha, -n14*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n14*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n110 - 1 + pow(alpha, -n14*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n175*n24*n86*pow(n228 + pow(alpha, -n22*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n22*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n118 - 1 + pow(alpha, -n22*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n177*n24*n86*pow(n215 + pow(alpha, -n9*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n63*n91*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n105 - 1 + pow(alpha, -n9*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n178*n24*n86*pow(n214 + pow(alpha, -n8*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n63*n8*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n104 - 1 + pow(alpha, -n8*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n178*n86*pow(n104 - 1 + pow(alpha, -n8*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(-pow(alpha, n0*n38)*pow(alpha, -n8*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n40*n8*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - pow(alpha, n0*n38)*pow(alpha, -n8*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n45*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - n242 - pow(alpha, -n8*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n158*n40*n8*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n179*n24*n86*pow(pow(alpha, n25*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n209*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + n209, -n24)/pow(n96 - 1 + pow(alpha, -n0*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n179*n86*(-n205*n40 - pow(alpha, -n0*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n205*n40*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n96 - 1 + pow(alpha, -n0*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n18*n61*n80*n86*xF[5]*(n224 + pow(alpha, -n18*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n63*n87*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n114 - 1 + pow(alpha, -n18*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n183*n24*n86*pow(n221 + pow(alpha, -n15*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n63*n90*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n111 - 1 + pow(alpha, -n15*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n183*n86*pow(n111 - 1 + pow(alpha, -n15*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(-pow(alpha, n0*n38)*pow(alpha, -n15*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n15*n40*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - pow(alpha, n0*n38)*pow(alpha, -n15*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n52*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - n181*n77 - pow(alpha, -n15*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n15*n158*n40*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n189*n24*n86*pow(n213 + pow(alpha, -n7*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n63*n89*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n103 - 1 + pow(alpha, -n7*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n189*n86*pow(n103 - 1 + pow(alpha, -n7*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(-pow(alpha, n0*n38)*pow(alpha, -n7*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n40*n7*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - pow(alpha, n0*n38)*pow(alpha, -n7*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n44*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - n153*n69 - pow(alpha, -n7*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n158*n40*n7*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n190*n24*n86*pow(n225 + pow(alpha, -n19*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n19*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n115 - 1 + pow(alpha, -n19*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n191*n24*n86*pow(n219 + pow(alpha, -n13*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n13*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n109 - 1 + pow(alpha, -n13*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n191*n86*pow(n109 - 1 + pow(alpha, -n13*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(-pow(alpha, n0*n38)*pow(alpha, -n13*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n0*n13*n40*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - pow(alpha, n0*n38)*pow(alpha, -n13*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n50*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - n207*n40 - pow(alpha, -n13*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n13*n158*n40*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n194*n61*n86*xF[15]*(n215 + pow(alpha, -n9*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n63*n91*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n105 - 1 + pow(alpha, -n9*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n195*n24*n86*pow(n210 + pow(alpha, -n4*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n4*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n97 - 1 + pow(alpha, -n4*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n196*n24*n86*pow(n227 + pow(alpha, -n21*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n63*n92*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n117 - 1 + pow(alpha, -n21*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n198*n24*n86*pow(n218 + pow(alpha, -n12*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n12*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)), -n24)/pow(n108 - 1 + pow(alpha, -n12*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), 3) + n198*n86*pow(n108 - 1 + pow(alpha, -n12*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24)*(-pow(alpha, n0*n38)*pow(alpha, -n12*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n40*n95*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - pow(alpha, n0*n38)*pow(alpha, -n12*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n49*n88*pow(n26 + n34*xTj, -n24)*pow(n26 - xF[0]*xTj, n24)*pow(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1, n24) - n171*n74 - pow(alpha, -n12*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n40*n63*n95*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1))) + n200*n61*n86*(n1*n70*n8 + pow(alpha, -n8*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n63*n8*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n104 - 1 + pow(alpha, -n8*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n202*n40*n86*xF[11]/(n101 - 1 + pow(alpha, -n5*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n203*n61*n86*(n1*n10*n72 + pow(alpha, -n10*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n10*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n106 - 1 + pow(alpha, -n10*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n204*n61*n86*(n1*n22*n84 + pow(alpha, -n22*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n22*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n118 - 1 + pow(alpha, -n22*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n206*n61*n86*(n1*n20*n82 + pow(alpha, -n20*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n20*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n116 - 1 + pow(alpha, -n20*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n207*n40*n86*xF[19]/(n109 - 1 + pow(alpha, -n13*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n211*n30*n86*(n1*n5*n67 + pow(alpha, -n5*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n5*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n101 - 1 + pow(alpha, -n5*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n212*n29*n86*(n1*n6*n68 + pow(alpha, -n6*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n6*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(-n139 - 1 + pow(alpha, -n6*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n217*n36*n86*(n1*n11*n73 + pow(alpha, -n11*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n11*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n107 - 1 + pow(alpha, -n11*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n220*n35*n86*(n1*n14*n76 + pow(alpha, -n14*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n14*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n110 - 1 + pow(alpha, -n14*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n223*n28*n86*(n1*n17*n79 + pow(alpha, -n17*(n146*(n254 - log(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))*n1*n17*n63*(n26 + n34*xTj)/((n26 - xF[0]*xTj)*(-n63*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)))*pow(n113 - 1 + pow(alpha, -n17*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)), n24) + n231*n86*xF[10]/(n97 - 1 + pow(alpha, -n4*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n232*n86*xF[12]/(-n139 - 1 + pow(alpha, -n6*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n233*n86*xF[15]/(n105 - 1 + pow(alpha, -n9*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n234*n86*xF[17]/(n107 - 1 + pow(alpha, -n11*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n235*n86*xF[1]/(n110 - 1 + pow(alpha, -n14*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n237*n86*xF[5]/(n114 - 1 + pow(alpha, -n18*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n241*n86*xF[9]/(n118 - 1 + pow(alpha, -n22*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n242*n86*xF[14]/(n104 - 1 + pow(alpha, -n8*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n243*n86*xF[16]/(n106 - 1 + pow(alpha, -n10*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n244*n86/(n96 - 1 + pow(alpha, -n0*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n245*n86/(n116 - 1 + pow(alpha, -n20*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n246*n86/(n115 - 1 + pow(alpha, -n19*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n247*n86/(n112 - 1 + pow(alpha, -n16*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1))) + n248*n86/(n113 - 1 + pow(alpha, -n17*(n146*(n254 - log(n140*(n26 + n34*xTj)/(n26 - xF[0]*xTj) + 1)) + 1)))) - 2.0*n244*n86/n356 - 2.0*n578*n86) + pow(-n38*(1.0*n209*n86*xF[0]*(pow(alpha, -n0*n258 + n62)*n0*n1*n229/n249 + n209)/n376 + 0.5*n450*n86*xF[0]*(pow(alpha, -n0*n258 + n62)*n229*n39*n88/n249 + n205*n88) + n495 - 0.5*xTj*(n107*n142*n440*(pow(alpha, n0*n38 - n11*n258)*n0*n100*n11*n40/(n251*n99) + pow(alpha, n0*n38 - n11*n258)*n100*n48*n88/(n251*n99) + pow(alpha, -n11*n258 + n62)*n0*n11*n229*n255 + n234) + n109*n142*xF[19]*(pow(alpha, -n13*n258 + n62)*n1*n13*n229/n249 + n219)*(pow(alpha, -n13*n258 + n62)*n13*n229*n61/n249 + n169*n61)/n406 + n109*n86*xF[19]*(pow(alpha, n0*n38 - n13*n258)*n100*n13*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n13*n258)*n100*n40*n50/(n251*n99) + pow(alpha, -n13*n258 + n62)*n13*n229*n25*n255 + n207*n88)/n386 + n112*n142*n437*(pow(alpha, n0*n38 - n16*n258)*n0*n100*n16*n40/(n251*n99) + pow(alpha, n0*n38 - n16*n258)*n100*n53*n88/(n251*n99) + pow(alpha, -n16*n258 + n62)*n0*n16*n229*n255 + n236) + n112*n142*xF[3]*(pow(alpha, -n16*n258 + n62)*n1*n16*n229/n249 + n222)*(pow(alpha, -n16*n258 + n62)*n16*n229*n61/n249 + n154*n61)/n409 + n115*n142*xF[6]*(pow(alpha, n0*n38 - n19*n258)*n0*n100*n19*n40/(n251*n99) + pow(alpha, n0*n38 - n19*n258)*n100*n56*n88/(n251*n99) + pow(alpha, -n19*n258 + n62)*n0*n19*n229*n255 + n238)/n392 + n139*n86*xF[12]*(pow(alpha, -n258*n6 + n62)*n1*n229*n6/n249 + n212)*(pow(alpha, -n258*n6 + n62)*n229*n6*n61/n249 + n6*n61*n68)/n399 + n139*n86*xF[12]*(pow(alpha, n0*n38 - n258*n6)*n0*n100*n40*n6/(n251*n99) + pow(alpha, n0*n38 - n258*n6)*n100*n43*n88/(n251*n99) + pow(alpha, -n258*n6 + n62)*n0*n229*n255*n6 + n232)/n379 + n142*n149*(pow(alpha, -n10*n258 + n62)*n1*n10*n229/n249 + n216)*(pow(alpha, -n10*n258 + n62)*n10*n229*n61/n249 + n182*n61)/n403 + n142*n150*(pow(alpha, -n258*n5 + n62)*n1*n229*n5/n249 + n211)*(pow(alpha, -n258*n5 + n62)*n229*n5*n61/n249 + n5*n61*n67)/n398 + n142*n152*(pow(alpha, -n12*n258 + n62)*n1*n12*n229/n249 + n218)*(pow(alpha, -n12*n258 + n62)*n12*n229*n61/n249 + n192*n61)/n405 + n142*n156*(pow(alpha, -n258*n9 + n62)*n229*n91/n249 + n215)*(pow(alpha, -n258*n9 + n62)*n229*n61*n9/n249 + n194*n61)/n402 + n142*n156*(pow(alpha, n0*n38 - n258*n9)*n0*n100*n40*n9/(n251*n99) + pow(alpha, n0*n38 - n258*n9)*n100*n46*n88/(n251*n99) + pow(alpha, -n258*n9 + n62)*n0*n229*n255*n9 + n233)/n382 + n142*n162*(pow(alpha, -n22*n258 + n62)*n1*n22*n229/n249 + n228)*(pow(alpha, -n22*n258 + n62)*n22*n229*n61/n249 + n185*n61)/n415 + n142*n162*(pow(alpha, n0*n38 - n22*n258)*n100*n40*n93/(n251*n99) + pow(alpha, n0*n38 - n22*n258)*n100*n59*n88/(n251*n99) + pow(alpha, -n22*n258 + n62)*n229*n255*n93 + n241)/n395 + n142*n164*(pow(alpha, -n20*n258 + n62)*n1*n20*n229/n249 + n226)*(pow(alpha, -n20*n258 + n62)*n20*n229*n61/n249 + n193*n61)/n413 + n142*n164*(pow(alpha, n0*n38 - n20*n258)*n0*n100*n20*n40/(n251*n99) + pow(alpha, n0*n38 - n20*n258)*n100*n57*n88/(n251*n99) + pow(alpha, -n20*n258 + n62)*n0*n20*n229*n255 + n239)/n393 + n142*n170*(pow(alpha, -n15*n258 + n62)*n229*n90/n249 + n221)*(pow(alpha, -n15*n258 + n62)*n15*n229*n61/n249 + n15*n61*n77)/n408 + n142*n176*(pow(alpha, -n258*n7 + n62)*n229*n89/n249 + n213)*(pow(alpha, -n258*n7 + n62)*n229*n61*n7/n249 + n61*n69*n7)/n400 + n142*n184*(pow(alpha, -n258*n8 + n62)*n1*n229*n8/n249 + n214)*(pow(alpha, -n258*n8 + n62)*n229*n61*n8/n249 + n173*n61)/n401 + n142*n186*(pow(alpha, -n18*n258 + n62)*n229*n87/n249 + n224)*(pow(alpha, -n18*n258 + n62)*n18*n229*n61/n249 + n18*n61*n80)/n411 + n142*n187*(pow(alpha, -n14*n258 + n62)*n1*n14*n229/n249 + n220)*(pow(alpha, -n14*n258 + n62)*n14*n229*n61/n249 + n188*n61)/n407 + n142*n197*(pow(alpha, -n21*n258 + n62)*n229*n92/n249 + n227)*(pow(alpha, -n21*n258 + n62)*n21*n229*n61/n249 + n21*n61*n83)/n414 + n142*n441*n97*(pow(alpha, n0*n38 - n258*n4)*n0*n100*n4*n40/(n251*n99) + pow(alpha, n0*n38 - n258*n4)*n100*n41*n88/(n251*n99) + pow(alpha, -n258*n4 + n62)*n0*n229*n255*n4 + n231) + n142*n451*xF[4]*(pow(alpha, -n17*n258 + n62)*n1*n17*n229/n249 + n223)*(pow(alpha, -n17*n258 + n62)*n17*n229*n61/n249 + n17*n61*n79) + n142*n452*(pow(alpha, n0*n38 - n18*n258)*n100*n40*n94/(n251*n99) + pow(alpha, n0*n38 - n18*n258)*n100*n55*n88/(n251*n99) + pow(alpha, -n18*n258 + n62)*n229*n255*n94 + n237) + n142*n453*(pow(alpha, -n19*n258 + n62)*n1*n19*n229/n249 + n225)*(pow(alpha, -n19*n258 + n62)*n19*n229*n61/n249 + n157*n61) + n142*n454*(pow(alpha, n0*n38 - n14*n258)*n0*n100*n14*n40/(n251*n99) + pow(alpha, n0*n38 - n14*n258)*n100*n51*n88/(n251*n99) + pow(alpha, -n14*n258 + n62)*n0*n14*n229*n255 + n235) + n142*n456*(pow(alpha, -n11*n258 + n62)*n1*n11*n229/n249 + n217)*(pow(alpha, -n11*n258 + n62)*n11*n229*n61/n249 + n161*n61) + n142*n458*(pow(alpha, n0*n38 - n21*n258)*n0*n100*n21*n40/(n251*n99) + pow(alpha, n0*n38 - n21*n258)*n100*n58*n88/(n251*n99) + pow(alpha, -n21*n258 + n62)*n0*n21*n229*n255 + n240) + n142*n459*(pow(alpha, -n258*n4 + n62)*n1*n229*n4/n249 + n210)*(pow(alpha, -n258*n4 + n62)*n229*n4*n61/n249 + n163*n61) + n142*n96*xF[0]*(pow(alpha, -n0*n258 + n62)*n0*n1*n229/n249 + n209)*(pow(alpha, -n0*n258 + n62)*n1*n229*n24*n25/n249 + n1*n24*n25*n63)/n396 + n149*n86*(pow(alpha, n0*n38 - n10*n258)*n10*n100*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n10*n258)*n100*n40*n47/(n251*n99) + pow(alpha, -n10*n258 + n62)*n10*n229*n25*n255 + n47*n72*n88)/n383 + n150*n86*(pow(alpha, n0*n38 - n258*n5)*n100*n25*n40*n5/(n251*n99) + pow(alpha, n0*n38 - n258*n5)*n100*n40*n42/(n251*n99) + pow(alpha, -n258*n5 + n62)*n229*n25*n255*n5 + n202*n88)/n378 + n152*n86*(pow(alpha, n0*n38 - n12*n258)*n100*n12*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n12*n258)*n100*n171/(n251*n99) + pow(alpha, -n12*n258 + n62)*n12*n229*n25*n255 + n49*n74*n88)/n385 + n170*n86*(pow(alpha, n0*n38 - n15*n258)*n100*n15*n25*n40/(n251*n99) + pow(alpha, n0*n38 - n15*n258)*n100*n181/(n251*n99) + pow(alpha, -n15*n258 + n62)*n15*n229*n25*n255 + n52*n77*n88)/n388 + n176*n86*(pow(alpha, n0*n38 - n258*n7)*n100*n153/(n251*n99) + pow(alpha, n0*n38 - n258*n7)*n100*n25*n40*n7/(n251*n99) + pow(alpha, -n258*n7 + n62)*n229*n25*n255*n7 + n44*n69*n88)/n380 + n184*n86*(pow(alpha, n0*n38 - n258*n8)*n100*n25*n40*n8/(n251*n99) + pow(alpha, n0*n38 - n258*n8)*n100*n40*n45/(n251*n99) + pow(alpha, -n258*n8 + n62)*n229*n25*n255*n8 + n45*n70*n88)/n381 + n450*n86*xF[0]*(pow(alpha, -n0*n258 + n62)*n229*n39*n88/n249 + n205*n88) + n455*n86*(pow(alpha, n0*n38 - n17*n258)*n100*n148*n25/(n251*n99) + pow(alpha, n0*n38 - n17*n258)*n100*n40*n54/(n251*n99) + pow(alpha, -n17*n258 + n62)*n148*n229*n25/n249 + n208*n88) + n475 + n476 + n477 + n478 + n479 + n480 + n481 + n482 + n483 + n484 + n485 + n486 + n487 + n488 + n489 + n490 + n491 + n492 + n493 + n494 + n579 + n580 + n581 + n582 + n583 + n584 + n585 + n586 + n587 + n588 + n589 + n590 + n591 + n592 + n593 + n594 + n595 + n596 + n597 + n598) - 0.5*n86*n96*xF[0]*(pow(alpha, -n0*n258 + n62)*n0*n1*n229/n249 + n209)*(pow(alpha, -n0*n258 + n62)*n1*n229*n24*n25/n249 + n1*n24*n25*n63)/n396) - n636, -n24);
-      NP_sqrt_base = fabs(NP_sqrt_base);
-      NP1 = (-NP_b - sqrt(NP_sqrt_base))/NP_2a;
-      NT1 = n146*(n254 - log(-pow(alpha, NP1*n0)*n229 + 1));
-      g0 = MW[1] - Mstar;
-      g1 = MW[0] - Mstar;
-      g2 = NT1 + 1;
-      g3 = xPj - xTj;
-      g4 = MW[10] - Mstar;
-      g5 = MW[11] - Mstar;
-      g6 = MW[12] - Mstar;
-      g7 = MW[13] - Mstar;
-      g8 = MW[14] - Mstar;
-      g9 = MW[15] - Mstar;
-      g10 = MW[16] - Mstar;
-      g11 = MW[17] - Mstar;
-      g12 = MW[18] - Mstar;
-      g13 = MW[19] - Mstar;
-      g14 = MW[2] - Mstar;
-      g15 = MW[3] - Mstar;
-      g16 = MW[4] - Mstar;
-      g17 = MW[5] - Mstar;
-      g18 = MW[6] - Mstar;
-      g19 = MW[7] - Mstar;
-      g20 = MW[8] - Mstar;
-      g21 = MW[9] - Mstar;
-      g22 = xF[0] - xTj;
-      g23 = xF[0] - xPj;
-      g24 = -xTj;
-      g25 = xPj/xF[1];
-      g26 = pow(alpha, -g1);
-      g27 = pow(alpha, -g4);
-      g28 = pow(alpha, -g5);
-      g29 = pow(alpha, -g6);
-      g30 = pow(alpha, -g7);
-      g31 = pow(alpha, -g8);
-      g32 = pow(alpha, -g9);
-      g33 = pow(alpha, -g10);
-      g34 = pow(alpha, -g11);
-      g35 = pow(alpha, -g12);
-      g36 = pow(alpha, -g13);
-      g37 = pow(alpha, -g0);
-      g38 = pow(alpha, -g14);
-      g39 = pow(alpha, -g15);
-      g40 = pow(alpha, -g16);
-      g41 = pow(alpha, -g17);
-      g42 = pow(alpha, -g18);
-      g43 = pow(alpha, -g19);
-      g44 = pow(alpha, -g20);
-      g45 = pow(alpha, -g21);
-      g46 = log(xF[0]/xF[1]);
-      g47 = -g2;
-      g48 = pow(alpha, NP1*g0);
-      g49 = pow(alpha, NP1*g1);
-      g50 = pow(alpha, NP1*g4);
-      g51 = log(g26);
-      g52 = pow(alpha, NP1*g5);
-      g53 = pow(alpha, NP1*g6);
-      g54 = pow(alpha, NP1*g7);
-      g55 = pow(alpha, NP1*g8);
-      g56 = pow(alpha, NP1*g9);
-      g57 = pow(alpha, NP1*g10);
-      g58 = pow(alpha, NP1*g11);
-      g59 = pow(alpha, NP1*g12);
-      g60 = pow(alpha, NP1*g13);
-      g61 = pow(alpha, NP1*g14);
-      g62 = pow(alpha, NP1*g15);
-      g63 = pow(alpha, NP1*g16);
-      g64 = pow(alpha, NP1*g17);
-      g65 = pow(alpha, NP1*g18);
-      g66 = pow(alpha, NP1*g19);
-      g67 = pow(alpha, NP1*g20);
-      g68 = pow(alpha, NP1*g21);
-      g69 = -g46;
-      g70 = g22/g3;
-      g71 = g3/g22;
-      g72 = -g48 + 1;
-      g73 = -g48 + 1;
-      g74 = -g49 + 1;
-      g75 = -g61 + 1;
-      g76 = -g62 + 1;
-      g77 = -g63 + 1;
-      g78 = -g64 + 1;
-      g79 = -g65 + 1;
-      g80 = -g66 + 1;
-      g81 = -g67 + 1;
-      g82 = -g68 + 1;
-      g83 = -g50 + 1;
-      g84 = -g52 + 1;
-      g85 = -g53 + 1;
-      g86 = -g54 + 1;
-      g87 = -g55 + 1;
-      g88 = -g56 + 1;
-      g89 = -g57 + 1;
-      g90 = -g58 + 1;
-      g91 = -g59 + 1;
-      g92 = -g60 + 1;
-      g93 = -g49;
-      g94 = -g50;
-      g95 = -g52;
-      g96 = -g53;
-      g97 = -g54;
-      g98 = -g55;
-      g99 = -g56;
-      g100 = -g57;
-      g101 = -g58;
-      g102 = -g59;
-      g103 = -g60;
-      g104 = -g61;
-      g105 = -g62;
-      g106 = -g63;
-      g107 = -g64;
-      g108 = -g65;
-      g109 = -g66;
-      g110 = -g67;
-      g111 = -g68;
-      g112 = -1.0*g46;
-      g113 = -g3/g23;
-      g114 = g23/(g3*xF[1]);
-      g115 = pow(alpha, g0*g47) - 1;
-      g116 = pow(alpha, g0*g47) - 1;
-      g117 = pow(alpha, g1*g47) - 1;
-      g118 = pow(alpha, g14*g47) - 1;
-      g119 = pow(alpha, g15*g47) - 1;
-      g120 = pow(alpha, g16*g47) - 1;
-      g121 = pow(alpha, g17*g47) - 1;
-      g122 = pow(alpha, g18*g47) - 1;
-      g123 = pow(alpha, g19*g47) - 1;
-      g124 = pow(alpha, g20*g47) - 1;
-      g125 = pow(alpha, g21*g47) - 1;
-      g126 = pow(alpha, g4*g47) - 1;
-      g127 = pow(alpha, g47*g5) - 1;
-      g128 = pow(alpha, g47*g6) - 1;
-      g129 = pow(alpha, g47*g7) - 1;
-      g130 = pow(alpha, g47*g8) - 1;
-      g131 = pow(alpha, g47*g9) - 1;
-      g132 = pow(alpha, g10*g47) - 1;
-      g133 = pow(alpha, g11*g47) - 1;
-      g134 = pow(alpha, g12*g47) - 1;
-      g135 = pow(alpha, g13*g47) - 1;
-      g136 = -pow(alpha, g1*g47);
-      g137 = -pow(alpha, g4*g47);
-      g138 = -pow(alpha, g47*g5);
-      g139 = -pow(alpha, g47*g6);
-      g140 = -pow(alpha, g47*g7);
-      g141 = -pow(alpha, g47*g8);
-      g142 = -pow(alpha, g47*g9);
-      g143 = -pow(alpha, g10*g47);
-      g144 = -pow(alpha, g11*g47);
-      g145 = -pow(alpha, g12*g47);
-      g146 = -pow(alpha, g13*g47);
-      g147 = -pow(alpha, g14*g47);
-      g148 = -pow(alpha, g15*g47);
-      g149 = -pow(alpha, g16*g47);
-      g150 = -pow(alpha, g17*g47);
-      g151 = -pow(alpha, g18*g47);
-      g152 = -pow(alpha, g19*g47);
-      g153 = -pow(alpha, g20*g47);
-      g154 = -pow(alpha, g21*g47);
-      g155 = g116 + g73;
-      g156 = -g136 - g49;
-      g157 = -g137 - g50;
-      g158 = -g138 - g52;
-      g159 = -g139 - g53;
-      g160 = -g140 - g54;
-      g161 = -g141 - g55;
-      g162 = -g142 - g56;
-      g163 = -g143 - g57;
-      g164 = -g144 - g58;
-      g165 = -g145 - g59;
-      g166 = -g146 - g60;
-      g167 = -g147 - g61;
-      g168 = -g148 - g62;
-      g169 = -g149 - g63;
-      g170 = -g150 - g64;
-      g171 = -g151 - g65;
-      g172 = -g152 - g66;
-      g173 = -g153 - g67;
-      g174 = -g154 - g68;
-      g175 = pow(alpha, g1*g47) + g93;
-      g176 = g116 + g73;
-      g177 = pow(alpha, g4*g47) + g94;
-      g178 = pow(alpha, g47*g5) + g95;
-      g179 = pow(alpha, g47*g6) + g96;
-      g180 = pow(alpha, g47*g7) + g97;
-      g181 = pow(alpha, g47*g8) + g98;
-      g182 = pow(alpha, g47*g9) + g99;
-      g183 = pow(alpha, g10*g47) + g100;
-      g184 = pow(alpha, g11*g47) + g101;
-      g185 = pow(alpha, g12*g47) + g102;
-      g186 = pow(alpha, g13*g47) + g103;
-      g187 = pow(alpha, g14*g47) + g104;
-      g188 = pow(alpha, g15*g47) + g105;
-      g189 = pow(alpha, g16*g47) + g106;
-      g190 = pow(alpha, g17*g47) + g107;
-      g191 = pow(alpha, g18*g47) + g108;
-      g192 = pow(alpha, g19*g47) + g109;
-      g193 = pow(alpha, g20*g47) + g110;
-      g194 = pow(alpha, g21*g47) + g111;
-      g195 = xF[9]/g194;
-      g196 = xF[8]/g193;
-      g197 = xF[11]/g178;
-      g198 = xF[1]/g176;
-      g199 = xF[3]/g188;
-      g200 = xF[10]/g177;
-      g201 = xF[19]/g186;
-      g202 = xF[17]/g184;
-      g203 = xF[15]/g182;
-      g204 = xF[16]/g183;
-      g205 = xF[7]/g192;
-      g206 = xF[4]/g189;
-      g207 = xF[12]/g179;
-      g208 = xF[13]/g180;
-      g209 = xF[6]/g191;
-      g210 = xF[14]/g181;
-      g211 = xF[2]/g187;
-      g212 = xF[5]/g190;
-      g213 = xF[18]/g185;
-      g214 = xF[0]/g175;
-      g215 = xF[17]/g164;
-      g216 = xF[0]/g156;
-      g217 = xF[9]/g174;
-      g218 = xF[4]/g169;
-      g219 = xF[15]/g162;
-      g220 = xF[2]/g167;
-      g221 = xF[11]/g158;
-      g222 = xF[18]/g165;
-      g223 = xF[1]/g155;
-      g224 = xF[13]/g160;
-      g225 = xF[16]/g163;
-      g226 = xF[3]/g168;
-      g227 = xF[6]/g171;
-      g228 = xF[14]/g161;
-      g229 = xF[8]/g173;
-      g230 = xF[12]/g159;
-      g231 = xF[19]/g166;
-      g232 = xF[10]/g157;
-      g233 = xF[7]/g172;
-      g234 = xF[5]/g170;
-      g235 = g85/g159;
-      g236 = g82/g174;
-      g237 = g90/g164;
-      g238 = g77/g169;
-      g239 = g80/g172;
-      g240 = g75/g167;
-      g241 = g78/g170;
-      g242 = g91/g165;
-      g243 = g79/g171;
-      g244 = g86/g160;
-      g245 = g76/g168;
-      g246 = g88/g162;
-      g247 = g89/g163;
-      g248 = g84/g158;
-      g249 = g92/g166;
-      g250 = g87/g161;
-      g251 = g83/g157;
-      g252 = g74/g156;
-      g253 = g81/g173;
-      g254 = g72/g155;
-      g255 = g117/g156;
-      g256 = g131/g162;
-      g257 = g127/g158;
-      g258 = g118/g167;
-      g259 = g119/g168;
-      g260 = g120/g169;
-      g261 = g133/g164;
-      g262 = g115/g155;
-      g263 = g124/g173;
-      g264 = g125/g174;
-      g265 = g132/g163;
-      g266 = g122/g171;
-      g267 = g130/g161;
-      g268 = g128/g159;
-      g269 = g129/g160;
-      g270 = g134/g165;
-      g271 = g123/g172;
-      g272 = g126/g157;
-      g273 = g121/g170;
-      g274 = g135/g166;
-      g275 = log(g114*g176*g24/g73);
-      g276 = log(g114*g155*g24/g72);
-      g277 = log(g176*g25*g70/g116);
-      g278 = 1.0*g275;
-      g279 = log(g155*g25*g70/g115);
-      g280 = 1.0*g277;
-      g281 = -g112*xF[0] - g112*xF[10] - g112*xF[11] - g112*xF[12] - g112*xF[13] - g112*xF[14] - g112*xF[15] - g112*xF[16] - g112*xF[17] - g112*xF[18] - g112*xF[19] - g112*xF[1] - g112*xF[2] - g112*xF[3] - g112*xF[4] - g112*xF[5] - g112*xF[6] - g112*xF[7] - g112*xF[8] - g112*xF[9] - g116*g198*g280 - g195*g278*(g111 + 1) - g195*g280*(pow(alpha, g21*g47) - 1) - g196*g278*(g110 + 1) - g196*g280*(pow(alpha, g20*g47) - 1) - g197*g278*(g95 + 1) - g197*g280*(pow(alpha, g47*g5) - 1) - g198*g278*g73 - g199*g278*(g105 + 1) - g199*g280*(pow(alpha, g15*g47) - 1) - g200*g278*(g94 + 1) - g200*g280*(pow(alpha, g4*g47) - 1) - g201*g278*(g103 + 1) - g201*g280*(pow(alpha, g13*g47) - 1) - g202*g278*(g101 + 1) - g202*g280*(pow(alpha, g11*g47) - 1) - g203*g278*(g99 + 1) - g203*g280*(pow(alpha, g47*g9) - 1) - g204*g278*(g100 + 1) - g204*g280*(pow(alpha, g10*g47) - 1) - g205*g278*(g109 + 1) - g205*g280*(pow(alpha, g19*g47) - 1) - g206*g278*(g106 + 1) - g206*g280*(pow(alpha, g16*g47) - 1) - g207*g278*(g96 + 1) - g207*g280*(pow(alpha, g47*g6) - 1) - g208*g278*(g97 + 1) - g208*g280*(pow(alpha, g47*g7) - 1) - g209*g278*(g108 + 1) - g209*g280*(pow(alpha, g18*g47) - 1) - g210*g278*(g98 + 1) - g210*g280*(pow(alpha, g47*g8) - 1) - g211*g278*(g104 + 1) - g211*g280*(pow(alpha, g14*g47) - 1) - g212*g278*(g107 + 1) - g212*g280*(pow(alpha, g17*g47) - 1) - g213*g278*(g102 + 1) - g213*g280*(pow(alpha, g12*g47) - 1) - g214*g278*(g93 + 1) - g214*g280*(pow(alpha, g1*g47) - 1);
-      LpF = xF[0]*(g26 + 1.0)*(g252*g276 + g255*g279 + g69)/(g51*(g26 - 1.0)) + xF[10]*(g27 + 1.0)*(g251*g276 + g272*g279 + g69)/(g51*(g27 - 1.0)) + xF[11]*(g28 + 1.0)*(g248*g276 + g257*g279 + g69)/(g51*(g28 - 1.0)) + xF[12]*(g29 + 1.0)*(g235*g276 + g268*g279 + g69)/(g51*(g29 - 1.0)) + xF[13]*(g30 + 1.0)*(g244*g276 + g269*g279 + g69)/(g51*(g30 - 1.0)) + xF[14]*(g31 + 1.0)*(g250*g276 + g267*g279 + g69)/(g51*(g31 - 1.0)) + xF[15]*(g32 + 1.0)*(g246*g276 + g256*g279 + g69)/(g51*(g32 - 1.0)) + xF[16]*(g33 + 1.0)*(g247*g276 + g265*g279 + g69)/(g51*(g33 - 1.0)) + xF[17]*(g34 + 1.0)*(g237*g276 + g261*g279 + g69)/(g51*(g34 - 1.0)) + xF[18]*(g35 + 1.0)*(g242*g276 + g270*g279 + g69)/(g51*(g35 - 1.0)) + xF[19]*(g36 + 1.0)*(g249*g276 + g274*g279 + g69)/(g51*(g36 - 1.0)) + xF[1]*(g37 + 1.0)*(g254*g276 + g262*g279 + g69)/(g51*(g37 - 1.0)) + xF[2]*(g38 + 1.0)*(g240*g276 + g258*g279 + g69)/(g51*(g38 - 1.0)) + xF[3]*(g39 + 1.0)*(g245*g276 + g259*g279 + g69)/(g51*(g39 - 1.0)) + xF[4]*(g40 + 1.0)*(g238*g276 + g260*g279 + g69)/(g51*(g40 - 1.0)) + xF[5]*(g41 + 1.0)*(g241*g276 + g273*g279 + g69)/(g51*(g41 - 1.0)) + xF[6]*(g42 + 1.0)*(g243*g276 + g266*g279 + g69)/(g51*(g42 - 1.0)) + xF[7]*(g43 + 1.0)*(g239*g276 + g271*g279 + g69)/(g51*(g43 - 1.0)) + xF[8]*(g44 + 1.0)*(g253*g276 + g263*g279 + g69)/(g51*(g44 - 1.0)) + xF[9]*(g45 + 1.0)*(g236*g276 + g264*g279 + g69)/(g51*(g45 - 1.0));
-      PpF = g70;
-      TpF = -g23/g3;
-      SWUpF = g281;
-      SWUpP = g281*g71;
-      xP[0] = g117*g216*g71;
-      xP[1] = g115*g223*g71;
-      xP[2] = g118*g220*g71;
-      xP[3] = g119*g226*g71;
-      xP[4] = g120*g218*g71;
-      xP[5] = g121*g234*g71;
-      xP[6] = g122*g227*g71;
-      xP[7] = g123*g233*g71;
-      xP[8] = g124*g229*g71;
-      xP[9] = g125*g217*g71;
-      xP[10] = g126*g232*g71;
-      xP[11] = g127*g221*g71;
-      xP[12] = g128*g230*g71;
-      xP[13] = g129*g224*g71;
-      xP[14] = g130*g228*g71;
-      xP[15] = g131*g219*g71;
-      xP[16] = g132*g225*g71;
-      xP[17] = g133*g215*g71;
-      xP[18] = g134*g222*g71;
-      xP[19] = g135*g231*g71;
-      xT[0] = g113*g216*g74;
-      xT[1] = g113*g223*g72;
-      xT[2] = g113*g220*g75;
-      xT[3] = g113*g226*g76;
-      xT[4] = g113*g218*g77;
-      xT[5] = g113*g234*g78;
-      xT[6] = g113*g227*g79;
-      xT[7] = g113*g233*g80;
-      xT[8] = g113*g229*g81;
-      xT[9] = g113*g217*g82;
-      xT[10] = g113*g232*g83;
-      xT[11] = g113*g221*g84;
-      xT[12] = g113*g230*g85;
-      xT[13] = g113*g224*g86;
-      xT[14] = g113*g228*g87;
-      xT[15] = g113*g219*g88;
-      xT[16] = g113*g225*g89;
-      xT[17] = g113*g215*g90;
-      xT[18] = g113*g222*g91;
-      xT[19] = g113*g231*g92;
-      break;
-
-  };
-
-  i = 2;
-  casc.mat_prod.comp[j] = xP[0];
-  casc.mat_prod.comp[k] = xP[1];
-  casc.mat_tail.comp[j] = xT[0];
-  casc.mat_tail.comp[k] = xT[1];
-  for(pyne::comp_iter ci = casc.mat_feed.comp.begin(); ci != casc.mat_feed.comp.end(); ci++)
-  {
-    nuc = (*ci).first;
-    if (nuc == j || nuc == k)
-        continue;
-    casc.mat_prod.comp[nuc] = xP[i];
-    casc.mat_tail.comp[nuc] = xT[i];
-    i++;
-  };
-  // must renormalize to eliminate numerical error
-  casc.mat_prod.norm_comp();
-  casc.mat_tail.norm_comp();
-  casc.mat_prod.mass = PpF;
-  casc.mat_tail.mass = TpF;
-
-  casc.N = NP1;
-  casc.M = NT1;
-  casc.l_t_per_feed = LpF;
-  casc.swu_per_feed = SWUpF;
-  casc.swu_per_prod = SWUpP;
-
-  delete [] MW;
-  delete [] xP;
-  delete [] xF;
-  delete [] xT;
-
-  return casc;
-};
@@ -12,6 +12,7 @@
 #include <map>
 #include <vector>
 #include <set>
+#include <algorithm>
 #include <stdio.h>
 #include <stdlib.h>
 #include <exception>
@@ -227,17 +228,129 @@ namespace h5wrap
     int arr_ndim = H5Sget_simple_extent_dims(arr_space, arr_dims, NULL);
 
     // Read in data from file to memory
-    T mem_arr [arr_dims[0]];
-    H5Dread(dset, dtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, mem_arr);
-
-    // Load new values into the vector
-    cpp_vec.assign(mem_arr, mem_arr+arr_dims[0]);
+    cpp_vec.resize(arr_dims[0]);
+    if (0 < arr_dims[0])
+      H5Dread(dset, dtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, &cpp_vec[0]);
 
+    H5Sclose(arr_space);
     H5Dclose(dset);
     return cpp_vec;
   }
 
 
+  /// A dense row-major array of up to three dimensions, stored in one
+  /// contiguous buffer rather than as nested vectors.
+  template <typename T>
+  struct DenseArray
+  {
+    std::vector<hsize_t> shape;    ///< extent of each dimension
+    std::vector<hsize_t> strides;  ///< stride of each dimension, in elements
+    std::vector<T> data;           ///< the values, in row-major order
+
+    /// Returns a pointer to the values from index (i, j, k) on.
+    T * ptr(hsize_t i, hsize_t j=0, hsize_t k=0)
+    {
+      return &data[0] + offset(i, j, k);
+    };
+    const T * ptr(hsize_t i, hsize_t j=0, hsize_t k=0) const
+    {
+      return &data[0] + offset(i, j, k);
+    };
+    /// Returns the value at index (i, j, k).
+    T & operator() (hsize_t i, hsize_t j=0, hsize_t k=0)
+    {
+      return data[offset(i, j, k)];
+    };
+    const T & operator() (hsize_t i, hsize_t j=0, hsize_t k=0) const
+    {
+      return data[offset(i, j, k)];
+    };
+
+  private:
+    hsize_t offset(hsize_t i, hsize_t j, hsize_t k) const
+    {
+      hsize_t n = i * strides[0];
+      if (1 < strides.size())
+        n += j * strides[1];
+      if (2 < strides.size())
+        n += k * strides[2];
+      return n;
+    };
+  };
+
+
+  /// Opens the dataset at \a data_path, throwing PathNotFound if it is missing.
+  inline hid_t open_dataset(hid_t h5file, std::string data_path)
+  {
+    hid_t dset = H5Dopen2(h5file, data_path.c_str(), H5P_DEFAULT);
+    if (dset < 0)
+    {
+      char fname [1024] = "";
+      H5Fget_name(h5file, fname, sizeof(fname));
+      throw PathNotFound(fname, data_path);
+    };
+    return dset;
+  }
+
+
+  /// Reads in data from an HDF5 file as a dense array in one contiguous
+  /// buffer.  \a T should roughly match \a dtype.  Only the \a count rows
+  /// from row \a start on, along the first dimension, are read through an
+  /// HDF5 hyperslab; by default all of them.
+  /// \param h5file HDF5 file id for an open file.
+  /// \param data_path path to the data in the open file.
+  /// \param dtype HDF5 data type for the data set at \a data_path.
+  /// \param start first row to read.
+  /// \param count number of rows to read, negative for all rows from \a start.
+  /// \return an in memory array of type \a T.
+  template <typename T>
+  DenseArray<T> h5_array_to_dense(hid_t h5file, std::string data_path,
+                                  hid_t dtype=H5T_NATIVE_DOUBLE,
+                                  hsize_t start=0, long long count=-1)
+  {
+    hid_t dset = open_dataset(h5file, data_path);
+    hid_t arr_space = H5Dget_space(dset);
+    int arr_ndim = H5Sget_simple_extent_ndims(arr_space);
+    if (arr_ndim < 1 || 3 < arr_ndim)
+    {
+      H5Sclose(arr_space);
+      H5Dclose(dset);
+      throw HDF5BoundsError();
+    };
+    hsize_t arr_dims [3];
+    H5Sget_simple_extent_dims(arr_space, arr_dims, NULL);
+    if (arr_dims[0] < start || (0 <= count && arr_dims[0] < start + (hsize_t) count))
+    {
+      H5Sclose(arr_space);
+      H5Dclose(dset);
+      throw HDF5BoundsError();
+    };
+
+    DenseArray<T> arr;
+    arr.shape.assign(arr_dims, arr_dims + arr_ndim);
+    arr.shape[0] = count < 0 ? arr_dims[0] - start : (hsize_t) count;
+    arr.strides.assign(arr_ndim, 1);
+    for (int d = arr_ndim - 2; 0 <= d; d--)
+      arr.strides[d] = arr.strides[d + 1] * arr.shape[d + 1];
+    hsize_t size = arr.shape[0] * arr.strides[0];
+    arr.data.resize(size);
+
+    if (0 < size)
+    {
+      // select the rows in the file and read them into the whole buffer
+      hsize_t offset [3] = {start, 0, 0};
+      H5Sselect_hyperslab(arr_space, H5S_SELECT_SET, offset, NULL,
+                          &arr.shape[0], NULL);
+      hid_t mem_space = H5Screate_simple(arr_ndim, &arr.shape[0], NULL);
+      H5Dread(dset, dtype, mem_space, arr_space, H5P_DEFAULT, &arr.data[0]);
+      H5Sclose(mem_space);
+    };
+    H5Sclose(arr_space);
+    H5Dclose(dset);
+    return arr;
+  }
+
+
   /// Reads in data from an HDF5 file as a 2 dimiensional vector.  \a T should roughly
   /// match \a dtype.
   /// \param h5file HDF5 file id for an open file.
@@ -248,27 +361,15 @@ namespace h5wrap
   std::vector< std::vector<T> > h5_array_to_cpp_vector_2d(hid_t h5file, std::string data_path,
                                                           hid_t dtype=H5T_NATIVE_DOUBLE)
   {
-    hsize_t arr_dims [2];
-    hid_t dset = H5Dopen2(h5file, data_path.c_str(), H5P_DEFAULT);
-
-    // Initilize to dataspace, to find the indices we are looping over
-    hid_t arr_space = H5Dget_space(dset);
-    int arr_ndim = H5Sget_simple_extent_dims(arr_space, arr_dims, NULL);
-
-    // Read in data from file to memory
-    // Have to read in as 1D array to get HDF5 and new keyword
-    // to play nice with each other
-    T mem_arr [arr_dims[0] * arr_dims[1]];
-    H5Dread(dset, dtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, mem_arr);
+    DenseArray<T> arr = h5_array_to_dense<T>(h5file, data_path, dtype);
 
     // Load new values into the vector of vectors, using some indexing tricks
-    std::vector< std::vector<T> > cpp_vec (arr_dims[0], std::vector<T>(arr_dims[1]));
-    for(int i = 0; i < arr_dims[0]; i++)
+    std::vector< std::vector<T> > cpp_vec (arr.shape[0]);
+    for(hsize_t i = 0; i < arr.shape[0]; i++)
     {
-        cpp_vec[i].assign(mem_arr+(i*arr_dims[1]), mem_arr+((i+1)*arr_dims[1]));
+        const T * row = arr.ptr(i);
+        cpp_vec[i].assign(row, row + arr.shape[1]);
     };
-
-    H5Dclose(dset);
     return cpp_vec;
   }
 
@@ -284,30 +385,18 @@ namespace h5wrap
                                                   std::string data_path,
                                                   hid_t dtype=H5T_NATIVE_DOUBLE)
   {
-    hsize_t arr_dims [3];
-    hid_t dset = H5Dopen2(h5file, data_path.c_str(), H5P_DEFAULT);
-
-    // Initilize to dataspace, to find the indices we are looping over
-    hid_t arr_space = H5Dget_space(dset);
-    int arr_ndim = H5Sget_simple_extent_dims(arr_space, arr_dims, NULL);
-
-    // Read in data from file to memory
-    // Have to read in as 1D array to get HDF5 and new keyword
-    // to play nice with each other
-    T mem_arr [arr_dims[0] * arr_dims[1] * arr_dims[2]];
-    H5Dread(dset, dtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, mem_arr);
+    DenseArray<T> arr = h5_array_to_dense<T>(h5file, data_path, dtype);
 
     // Load new values into the vector of vectors of vectors, using some indexing tricks
-    std::vector< std::vector< std::vector<T> > > cpp_vec (arr_dims[0], std::vector< std::vector<T> >(arr_dims[1], std::vector<T>(arr_dims[2])));
-    for(int i = 0; i < arr_dims[0]; i++)
+    std::vector< std::vector< std::vector<T> > > cpp_vec (arr.shape[0], std::vector< std::vector<T> >(arr.shape[1]));
+    for(hsize_t i = 0; i < arr.shape[0]; i++)
     {
-        for(int j = 0; j < arr_dims[1]; j++)
+        for(hsize_t j = 0; j < arr.shape[1]; j++)
         {
-            cpp_vec[i][j].assign(mem_arr+((i*arr_dims[1]*arr_dims[2]) + (j*arr_dims[2])), mem_arr+((i*arr_dims[1]*arr_dims[2]) + ((j+1)*arr_dims[2])));
+            const T * row = arr.ptr(i, j);
+            cpp_vec[i][j].assign(row, row + arr.shape[2]);
         };
     };
-
-    H5Dclose(dset);
     return cpp_vec;
   }
 
@@ -346,10 +435,13 @@ namespace h5wrap
       shape[1] = H5Tget_nmembers(h5_type);
 
       // set cols
-      std::string * cols_buf = new std::string [shape[1]];
+      cols.clear();
       for(int n = 0; n < shape[1]; n++)
-        cols_buf[n] = H5Tget_member_name(h5_type, n);
-      cols.assign(cols_buf, cols_buf+shape[1]);
+      {
+        char * name = H5Tget_member_name(h5_type, n);
+        cols.push_back(name);
+        H5free_memory(name);
+      };
 
       // set data
       hid_t col_type;
@@ -367,8 +459,12 @@ namespace h5wrap
 
         // save this column as a vector in out data map
         data[cols[n]] = std::vector<T>(col_buf, col_buf+shape[0]);
+        H5Tclose(col_type);
       };
       delete[] col_buf;
+      H5Tclose(h5_type);
+      H5Sclose(h5_space);
+      H5Dclose(h5_set);
     };
 
     // Metadata attributes
@@ -400,6 +496,177 @@ namespace h5wrap
   };
 
 
+  /// A table whose columns all have the same type \a T, like
+  /// HomogenousTypeTable, stored in one contiguous row-major buffer. Only the
+  /// selected columns are read, and only a window of rows at a time, so that
+  /// tables larger than memory can be iterated over in chunks with load().
+  template <typename T>
+  class DenseTypeTable
+  {
+  public:
+
+    /// A view of one row of the table, valid until the next load().
+    class RowView
+    {
+    public:
+      RowView(const DenseTypeTable * table, const T * values)
+        : table_(table), values_(values) {};
+      /// value of the \a n-th selected column
+      const T & operator[] (int n) const {return values_[n];};
+      /// value of the column named \a col_name
+      const T & operator[] (const std::string & col_name) const
+      {
+        return values_[table_->col_index(col_name)];
+      };
+      /// the values of the selected columns
+      const T * data() const {return values_;};
+
+    private:
+      const DenseTypeTable * table_;
+      const T * values_;
+    };
+
+    /// default constructor
+    DenseTypeTable() : h5file(-1), dtype(H5T_NATIVE_DOUBLE), num_rows(0),
+                       start(0), num_loaded(0) {};
+
+    /// Constructor that opens the table and loads \a count rows from row 0
+    /// on, all of them by default.  \a T should roughly match \a dtype.
+    /// \param h5file HDF5 file id for an open file, which must stay open while
+    ///        rows are loaded.
+    /// \param data_path path to the data in the open file.
+    /// \param dtype HDF5 data type of the columns.
+    /// \param columns names of the columns to read, all of them if empty.
+    /// \param count number of rows to load, negative for all of them.
+    DenseTypeTable(hid_t h5file, std::string data_path,
+                   hid_t dtype=H5T_NATIVE_DOUBLE,
+                   const std::vector<std::string> & columns=std::vector<std::string>(),
+                   long long count=-1)
+      : h5file(h5file), path(data_path), dtype(dtype), start(0), num_loaded(0)
+    {
+      hid_t h5_set = open_dataset(h5file, data_path);
+      hid_t h5_space = H5Dget_space(h5_set);
+      hid_t h5_type = H5Dget_type(h5_set);
+      num_rows = H5Sget_simple_extent_npoints(h5_space);
+
+      int nmembers = H5Tget_nmembers(h5_type);
+      std::vector<std::string> all_cols;
+      for (int n = 0; n < nmembers; n++)
+      {
+        char * name = H5Tget_member_name(h5_type, n);
+        all_cols.push_back(name);
+        H5free_memory(name);
+      };
+      H5Tclose(h5_type);
+      H5Sclose(h5_space);
+      H5Dclose(h5_set);
+
+      if (columns.empty())
+        cols = all_cols;
+      else
+      {
+        std::set<std::string> known (all_cols.begin(), all_cols.end());
+        for (size_t n = 0; n < columns.size(); n++)
+          if (0 == known.count(columns[n]))
+            throw PathNotFound(path, columns[n]);
+        cols = columns;
+      };
+      for (size_t n = 0; n < cols.size(); n++)
+        col_indices[cols[n]] = n;
+
+      load(0, count < 0 ? num_rows : std::min<hsize_t>(count, num_rows));
+    };
+
+    /// Loads the \a count rows from row \a first on, replacing the rows loaded
+    /// before.  Rows past the end of the table are not loaded.
+    /// \return the number of rows loaded.
+    hsize_t load(hsize_t first, hsize_t count)
+    {
+      if (num_rows < first)
+        throw HDF5BoundsError();
+      count = std::min(count, num_rows - first);
+      start = first;
+      num_loaded = count;
+      values.resize(count * cols.size());
+      if (0 == count || cols.empty())
+        return count;
+
+      // A compound type of just the selected columns, packed in order
+      hid_t row_type = H5Tcreate(H5T_COMPOUND, cols.size() * sizeof(T));
+      for (size_t n = 0; n < cols.size(); n++)
+        H5Tinsert(row_type, cols[n].c_str(), n * sizeof(T), dtype);
+
+      hid_t h5_set = open_dataset(h5file, path);
+      hid_t h5_space = H5Dget_space(h5_set);
+      hsize_t offset [1] = {first};
+      hsize_t counts [1] = {count};
+      H5Sselect_hyperslab(h5_space, H5S_SELECT_SET, offset, NULL, counts, NULL);
+      hid_t mem_space = H5Screate_simple(1, counts, NULL);
+      H5Dread(h5_set, row_type, mem_space, h5_space, H5P_DEFAULT, &values[0]);
+
+      H5Sclose(mem_space);
+      H5Sclose(h5_space);
+      H5Dclose(h5_set);
+      H5Tclose(row_type);
+      return count;
+    };
+
+    /// Loads the next \a count rows after the ones loaded, for iteration over
+    /// the table in chunks.
+    /// \return the number of rows loaded, zero past the end of the table.
+    hsize_t load_next(hsize_t count)
+    {
+      return load(start + num_loaded, count);
+    };
+
+    /// Returns the index of the column named \a col_name among the selected
+    /// ones, throwing PathNotFound if it was not selected.
+    int col_index(const std::string & col_name) const
+    {
+      std::map<std::string, int>::const_iterator it = col_indices.find(col_name);
+      if (it == col_indices.end())
+        throw PathNotFound(path, col_name);
+      return it->second;
+    };
+
+    /// Returns a view of the \a m-th loaded row, loaded row \a m being table
+    /// row start + m.
+    RowView row(hsize_t m) const
+    {
+      if (num_loaded <= m)
+        throw HDF5BoundsError();
+      return RowView(this, &values[0] + m * cols.size());
+    };
+
+    /// Returns the value of column \a n in loaded row \a m.
+    const T & at(hsize_t m, int n) const {return values[m * cols.size() + n];};
+
+    /// Copies the loaded values of the column named \a col_name.
+    std::vector<T> column(const std::string & col_name) const
+    {
+      int n = col_index(col_name);
+      std::vector<T> col (num_loaded);
+      for (hsize_t m = 0; m < num_loaded; m++)
+        col[m] = values[m * cols.size() + n];
+      return col;
+    };
+
+    // Metadata attributes
+    hid_t h5file;      ///< the open file the table is loaded from
+    std::string path;  ///< path in file to the data
+    hid_t dtype;       ///< HDF5 data type of the columns
+    hsize_t num_rows;  ///< number of rows in the table
+    hsize_t start;     ///< table row of the first loaded row
+    hsize_t num_loaded;  ///< number of loaded rows
+    std::vector<std::string> cols;  ///< selected column names
+    /// loaded values, row-major with one value per selected column
+    std::vector<T> values;
+
+  private:
+    std::map<std::string, int> col_indices;
+  };
+
+
   /// Create an HDF5 data type for complex 128 bit data, which happens to match the
   /// complex data type that is used by PyTables ^_~.
   inline hid_t _get_PYTABLES_COMPLEX128()
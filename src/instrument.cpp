@@ -0,0 +1,140 @@
+// Instrumentation counters and timers, see instrument.h.
+#include <sstream>
+#ifdef PYNE_INSTRUMENT
+#include <mutex>
+#include <set>
+#endif
+
+#ifndef PYNE_IS_AMALGAMATED
+#include "instrument.h"
+#endif
+
+namespace pyne_inst = pyne::instrument;
+
+const char* pyne_inst::counter_names[pyne_inst::NUM_COUNTERS] = {
+  "data_loads", "fpyield_lookups", "fpyield_misses", "alias_samples",
+  "cram_order_6", "cram_order_8", "cram_order_10", "cram_order_12",
+  "cram_order_14", "cram_order_16", "cram_order_18", "material_copies"};
+
+const char* pyne_inst::timer_names[pyne_inst::NUM_TIMERS] = {
+  "data_load", "cram", "material_read_hdf5", "material_write_hdf5",
+  "sampler_setup", "sampler_load_mesh", "sampler_geom_data",
+  "sampler_tag_data", "sampler_read_state"};
+
+#ifdef PYNE_INSTRUMENT
+namespace {
+
+// The counters of the running threads, and the sums of those of the threads
+// that have exited.
+struct Registry {
+  std::mutex mutex;
+  std::set<pyne_inst::ThreadStats*> threads;
+  unsigned long long counts[pyne_inst::NUM_COUNTERS];
+  unsigned long long timer_calls[pyne_inst::NUM_TIMERS];
+  unsigned long long timer_ns[pyne_inst::NUM_TIMERS];
+  Registry() {reset();};
+  void reset() {
+    for (int i = 0; i < pyne_inst::NUM_COUNTERS; i++)
+      counts[i] = 0;
+    for (int i = 0; i < pyne_inst::NUM_TIMERS; i++)
+      timer_calls[i] = timer_ns[i] = 0;
+  };
+};
+
+// Never destroyed, since threads may still exit during static destruction.
+Registry& registry() {
+  static Registry* r = new Registry();
+  return *r;
+}
+
+}  // namespace
+
+pyne_inst::ThreadStats::ThreadStats() {
+  for (int i = 0; i < NUM_COUNTERS; i++)
+    counts[i].store(0, std::memory_order_relaxed);
+  for (int i = 0; i < NUM_TIMERS; i++) {
+    timer_calls[i].store(0, std::memory_order_relaxed);
+    timer_ns[i].store(0, std::memory_order_relaxed);
+  }
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.threads.insert(this);
+}
+
+pyne_inst::ThreadStats::~ThreadStats() {
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  for (int i = 0; i < NUM_COUNTERS; i++)
+    r.counts[i] += counts[i].load(std::memory_order_relaxed);
+  for (int i = 0; i < NUM_TIMERS; i++) {
+    r.timer_calls[i] += timer_calls[i].load(std::memory_order_relaxed);
+    r.timer_ns[i] += timer_ns[i].load(std::memory_order_relaxed);
+  }
+  r.threads.erase(this);
+}
+
+pyne_inst::ThreadStats& pyne_inst::thread_stats() {
+  static thread_local ThreadStats s;
+  return s;
+}
+#endif
+
+std::string pyne::stats() {
+  unsigned long long counts[pyne_inst::NUM_COUNTERS] = {0};
+  unsigned long long timer_calls[pyne_inst::NUM_TIMERS] = {0};
+  unsigned long long timer_ns[pyne_inst::NUM_TIMERS] = {0};
+  bool enabled = false;
+#ifdef PYNE_INSTRUMENT
+  enabled = true;
+  Registry& r = registry();
+  {
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (int i = 0; i < pyne_inst::NUM_COUNTERS; i++)
+      counts[i] = r.counts[i];
+    for (int i = 0; i < pyne_inst::NUM_TIMERS; i++) {
+      timer_calls[i] = r.timer_calls[i];
+      timer_ns[i] = r.timer_ns[i];
+    }
+    std::set<pyne_inst::ThreadStats*>::const_iterator it;
+    for (it = r.threads.begin(); it != r.threads.end(); ++it) {
+      for (int i = 0; i < pyne_inst::NUM_COUNTERS; i++)
+        counts[i] += (*it)->counts[i].load(std::memory_order_relaxed);
+      for (int i = 0; i < pyne_inst::NUM_TIMERS; i++) {
+        timer_calls[i] += (*it)->timer_calls[i].load(std::memory_order_relaxed);
+        timer_ns[i] += (*it)->timer_ns[i].load(std::memory_order_relaxed);
+      }
+    }
+  }
+#endif
+
+  std::ostringstream json;
+  json << "{\"enabled\": " << (enabled ? "true" : "false")
+       << ", \"counters\": {";
+  for (int i = 0; i < pyne_inst::NUM_COUNTERS; i++)
+    json << (i > 0 ? ", " : "") << "\"" << pyne_inst::counter_names[i]
+         << "\": " << counts[i];
+  json << "}, \"timers\": {";
+  for (int i = 0; i < pyne_inst::NUM_TIMERS; i++)
+    json << (i > 0 ? ", " : "") << "\"" << pyne_inst::timer_names[i]
+         << "\": {\"calls\": " << timer_calls[i] << ", \"ns\": "
+         << timer_ns[i] << "}";
+  json << "}}";
+  return json.str();
+}
+
+void pyne::reset_stats() {
+#ifdef PYNE_INSTRUMENT
+  Registry& r = registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.reset();
+  std::set<pyne_inst::ThreadStats*>::const_iterator it;
+  for (it = r.threads.begin(); it != r.threads.end(); ++it) {
+    for (int i = 0; i < pyne_inst::NUM_COUNTERS; i++)
+      (*it)->counts[i].store(0, std::memory_order_relaxed);
+    for (int i = 0; i < pyne_inst::NUM_TIMERS; i++) {
+      (*it)->timer_calls[i].store(0, std::memory_order_relaxed);
+      (*it)->timer_ns[i].store(0, std::memory_order_relaxed);
+    }
+  }
+#endif
+}
@@ -0,0 +1,136 @@
+/// \brief Opt-in counters and timers of the library's hot paths.
+///
+/// The instrumentation is only compiled in when PYNE_INSTRUMENT is defined,
+/// e.g. by configuring with -DPYNE_INSTRUMENT=ON. Otherwise PYNE_COUNT and
+/// PYNE_TIME expand to nothing and stats() reports that it is disabled.
+///
+/// Each thread increments its own counters, so that the hot paths never
+/// contend on a shared cache line; stats() sums over the running threads and
+/// those that have exited.
+
+#ifndef PYNE_OJ3VBHQXEZDQ5MNGFRKTYA6WLI
+#define PYNE_OJ3VBHQXEZDQ5MNGFRKTYA6WLI
+
+#include <string>
+#ifdef PYNE_INSTRUMENT
+#include <atomic>
+#include <chrono>
+#endif
+
+namespace pyne {
+
+/// Returns the instrumentation counters and timers as a JSON object, with an
+/// "enabled" flag, a "counters" object of event counts and a "timers" object
+/// of {"calls", "ns"} pairs, each keyed by name.
+std::string stats();
+
+/// Zeroes the instrumentation counters and timers of all threads. Events that
+/// other threads count while it runs may survive the reset.
+void reset_stats();
+
+namespace instrument {
+
+/// Events that are counted.
+enum Counter {
+  COUNT_DATA_LOADS,  ///< lazy loads of a nuc_data.h5 table
+  COUNT_FPYIELD_LOOKUPS,  ///< fpyield() lookups
+  COUNT_FPYIELD_MISSES,  ///< fpyield() lookups of a pair without a yield
+  COUNT_ALIAS_SAMPLES,  ///< alias table samples
+  COUNT_CRAM_ORDER_6,  ///< CRAM solves of each order
+  COUNT_CRAM_ORDER_8,
+  COUNT_CRAM_ORDER_10,
+  COUNT_CRAM_ORDER_12,
+  COUNT_CRAM_ORDER_14,
+  COUNT_CRAM_ORDER_16,
+  COUNT_CRAM_ORDER_18,
+  COUNT_MATERIAL_COPIES,  ///< Material copy constructions and assignments
+  NUM_COUNTERS
+};
+
+/// Code regions that are timed.
+enum Timer {
+  TIME_DATA_LOAD,  ///< lazy loads of nuc_data.h5 tables, nested ones included
+  TIME_CRAM,  ///< transmuters::cram()
+  TIME_MATERIAL_READ_HDF5,  ///< Material::from_hdf5()
+  TIME_MATERIAL_WRITE_HDF5,  ///< Material::write_hdf5()
+  TIME_SAMPLER_SETUP,  ///< Sampler::setup(), which includes the phases below
+  TIME_SAMPLER_LOAD_MESH,  ///< loading the mesh file
+  TIME_SAMPLER_GEOM_DATA,  ///< volume element geometry
+  TIME_SAMPLER_TAG_DATA,  ///< cell data, source tags and alias tables
+  TIME_SAMPLER_READ_STATE,  ///< Sampler::read_state()
+  NUM_TIMERS
+};
+
+/// The names of the counters and timers in the output of stats().
+extern const char* counter_names[NUM_COUNTERS];
+extern const char* timer_names[NUM_TIMERS];
+
+/// Returns the counter of the CRAM solves of an order, which must be one of
+/// 6, 8, ..., 18.
+inline Counter cram_order_counter(int order) {
+  return (Counter) (COUNT_CRAM_ORDER_6 + (order - 6) / 2);
+}
+
+#ifdef PYNE_INSTRUMENT
+/// The counters of one thread. They are only written by their own thread;
+/// the relaxed atomics let stats() read them while it runs.
+struct ThreadStats {
+  ThreadStats();
+  ~ThreadStats();
+  std::atomic<unsigned long long> counts[NUM_COUNTERS];
+  std::atomic<unsigned long long> timer_calls[NUM_TIMERS];
+  std::atomic<unsigned long long> timer_ns[NUM_TIMERS];
+};
+
+/// Returns the counters of the calling thread.
+ThreadStats& thread_stats();
+
+inline void add(std::atomic<unsigned long long>& a, unsigned long long n) {
+  a.store(a.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+/// Adds \a n to counter \a c of the calling thread.
+inline void count(Counter c, unsigned long long n=1) {
+  add(thread_stats().counts[c], n);
+}
+
+/// Adds the time from its construction to its destruction to a timer.
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(Timer t) : t(t),
+    start(std::chrono::steady_clock::now()) {};
+  ~ScopedTimer() {
+    unsigned long long ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    ThreadStats& s = thread_stats();
+    add(s.timer_calls[t], 1);
+    add(s.timer_ns[t], ns);
+  };
+
+ private:
+  ScopedTimer(const ScopedTimer&);
+  ScopedTimer& operator=(const ScopedTimer&);
+  Timer t;
+  std::chrono::steady_clock::time_point start;
+};
+#endif
+
+}  // namespace instrument
+}  // namespace pyne
+
+#ifdef PYNE_INSTRUMENT
+/// Counts one event, e.g. PYNE_COUNT(COUNT_DATA_LOADS).
+#define PYNE_COUNT(c) pyne::instrument::count(pyne::instrument::c)
+/// Counts one event of a counter given as a pyne::instrument::Counter value.
+#define PYNE_COUNT_ID(c) pyne::instrument::count(c)
+/// Times the rest of the enclosing scope, e.g. PYNE_TIME(TIME_CRAM).
+#define PYNE_TIME(t) \
+  pyne::instrument::ScopedTimer pyne_scoped_timer_##t(pyne::instrument::t)
+#else
+#define PYNE_COUNT(c) ((void) 0)
+#define PYNE_COUNT_ID(c) ((void) 0)
+#define PYNE_TIME(t)
+#endif
+
+#endif  // PYNE_OJ3VBHQXEZDQ5MNGFRKTYA6WLI
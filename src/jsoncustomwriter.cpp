@@ -23,6 +23,11 @@ THE SOFTWARE.
 
 ***********************************************************************/
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sstream>
+
 #ifndef PYNE_IS_AMALGAMATED
   #include "json.h"
   #include "jsoncustomwriter.h"
@@ -191,4 +196,624 @@ CustomWriter::unindent()
       indentString_.resize (idsSize - idSize);
 }
 
+
+
+// Formats a double into a buffer of 32 chars, as valueToString( double ) does
+static void formatDouble( double value, char *buffer )
+{
+   snprintf(buffer, 32, "%#.16g", value);
+   char* ch = buffer + strlen(buffer) - 1;
+   if (*ch != '0') return; // nothing to truncate
+   while(ch > buffer && *ch == '0'){
+     --ch;
+   }
+   char* last_nonzero = ch;
+   while(ch >= buffer){
+     if (*ch >= '0' && *ch <= '9') {
+       --ch;
+       continue;
+     }
+     // Truncate zeroes to save bytes in output, but keep one.
+     if (*ch == '.')
+       *(last_nonzero+2) = '\0';
+     return;
+   }
+}
+
+
+CompactStreamWriter::CompactStreamWriter( std::ostream &out )
+   : out_( out )
+   , afterKey_( false )
+{
+}
+
+
+void
+CompactStreamWriter::separate()
+{
+   if ( afterKey_ )
+   {
+      afterKey_ = false;
+      return;
+   }
+   if ( !first_.empty() )
+   {
+      if ( !first_.back() )
+         out_.put( ',' );
+      first_.back() = false;
+   }
+}
+
+
+void
+CompactStreamWriter::beginObject()
+{
+   separate();
+   out_.put( '{' );
+   first_.push_back( true );
+}
+
+
+void
+CompactStreamWriter::endObject()
+{
+   first_.pop_back();
+   out_.put( '}' );
+}
+
+
+void
+CompactStreamWriter::beginArray()
+{
+   separate();
+   out_.put( '[' );
+   first_.push_back( true );
+}
+
+
+void
+CompactStreamWriter::endArray()
+{
+   first_.pop_back();
+   out_.put( ']' );
+}
+
+
+void
+CompactStreamWriter::key( const std::string &name )
+{
+   separate();
+   writeString( name.c_str() );
+   out_.put( ':' );
+   afterKey_ = true;
+}
+
+
+void
+CompactStreamWriter::value( double value )
+{
+   separate();
+   char buffer[32];
+   formatDouble( value, buffer );
+   out_ << buffer;
+}
+
+
+void
+CompactStreamWriter::value( int value )
+{
+   separate();
+   char buffer[16];
+   snprintf( buffer, sizeof(buffer), "%d", value );
+   out_ << buffer;
+}
+
+
+void
+CompactStreamWriter::value( bool value )
+{
+   separate();
+   out_ << (value ? "true" : "false");
+}
+
+
+void
+CompactStreamWriter::value( const std::string &value )
+{
+   separate();
+   writeString( value.c_str() );
+}
+
+
+void
+CompactStreamWriter::value( const char *value )
+{
+   separate();
+   writeString( value );
+}
+
+
+void
+CompactStreamWriter::value( const Value &value )
+{
+   separate();
+   writeTree( value );
+}
+
+
+void
+CompactStreamWriter::writeString( const char *value )
+{
+   for ( const char *c = value; *c != 0; ++c )
+   {
+      if ( *c == '"'  ||  *c == '\\'  ||  (*c > 0  &&  *c <= 0x1F) )
+      {
+         out_ << valueToQuotedString( value );
+         return;
+      }
+   }
+   out_.put( '"' );
+   out_ << value;
+   out_.put( '"' );
+}
+
+
+void
+CompactStreamWriter::writeTree( const Value &value )
+{
+   char buffer[32];
+   switch ( value.type() )
+   {
+   case nullValue:
+      out_ << "null";
+      break;
+   case intValue:
+      out_ << valueToString( value.asLargestInt() );
+      break;
+   case uintValue:
+      out_ << valueToString( value.asLargestUInt() );
+      break;
+   case realValue:
+      formatDouble( value.asDouble(), buffer );
+      out_ << buffer;
+      break;
+   case stringValue:
+      writeString( value.asCString() );
+      break;
+   case booleanValue:
+      out_ << (value.asBool() ? "true" : "false");
+      break;
+   case arrayValue:
+      {
+         out_.put( '[' );
+         int size = value.size();
+         for ( int index = 0; index < size; ++index )
+         {
+            if ( index > 0 )
+               out_.put( ',' );
+            writeTree( value[index] );
+         }
+         out_.put( ']' );
+      }
+      break;
+   case objectValue:
+      {
+         out_.put( '{' );
+         for ( Value::const_iterator it = value.begin(); it != value.end(); ++it )
+         {
+            if ( it != value.begin() )
+               out_.put( ',' );
+            writeString( it.memberName() );
+            out_.put( ':' );
+            writeTree( *it );
+         }
+         out_.put( '}' );
+      }
+      break;
+   }
+}
+
+
+// Appends the UTF-8 encoding of a code point
+static void appendUtf8( std::string &text, unsigned int cp )
+{
+   if ( cp <= 0x7F )
+   {
+      text += static_cast<char>( cp );
+   }
+   else if ( cp <= 0x7FF )
+   {
+      text += static_cast<char>( 0xC0 | (cp >> 6) );
+      text += static_cast<char>( 0x80 | (cp & 0x3F) );
+   }
+   else if ( cp <= 0xFFFF )
+   {
+      text += static_cast<char>( 0xE0 | (cp >> 12) );
+      text += static_cast<char>( 0x80 | ((cp >> 6) & 0x3F) );
+      text += static_cast<char>( 0x80 | (cp & 0x3F) );
+   }
+   else
+   {
+      text += static_cast<char>( 0xF0 | (cp >> 18) );
+      text += static_cast<char>( 0x80 | ((cp >> 12) & 0x3F) );
+      text += static_cast<char>( 0x80 | ((cp >> 6) & 0x3F) );
+      text += static_cast<char>( 0x80 | (cp & 0x3F) );
+   }
+}
+
+
+// Reads four hex digits at current, returns false if they are not
+static bool decodeHex4( const char *current, const char *end, unsigned int &cp )
+{
+   if ( end - current < 4 )
+      return false;
+   cp = 0;
+   for ( int i = 0; i < 4; ++i )
+   {
+      char c = current[i];
+      cp *= 16;
+      if ( c >= '0'  &&  c <= '9' )
+         cp += c - '0';
+      else if ( c >= 'a'  &&  c <= 'f' )
+         cp += c - 'a' + 10;
+      else if ( c >= 'A'  &&  c <= 'F' )
+         cp += c - 'A' + 10;
+      else
+         return false;
+   }
+   return true;
+}
+
+
+EventReader::EventReader( const char *beginDoc, const char *endDoc )
+   : begin_( beginDoc )
+   , end_( endDoc )
+   , current_( beginDoc )
+   , state_( stateValue )
+   , number_( 0.0 )
+   , boolean_( false )
+{
+}
+
+
+void
+EventReader::skipSpaces()
+{
+   while ( current_ != end_ )
+   {
+      char c = *current_;
+      if ( c != ' '  &&  c != '\t'  &&  c != '\r'  &&  c != '\n' )
+         break;
+      ++current_;
+   }
+}
+
+
+EventReader::Event
+EventReader::fail( const std::string &message )
+{
+   if ( state_ != stateFailed )
+   {
+      std::ostringstream oss;
+      oss << "* at offset " << (current_ - begin_) << ": " << message << "\n";
+      error_ = oss.str();
+      state_ = stateFailed;
+   }
+   return eventError;
+}
+
+
+EventReader::Event
+EventReader::close()
+{
+   char open = *current_ == '}' ? '{' : '[';
+   if ( (*current_ != '}'  &&  *current_ != ']')  ||  stack_.back() != open )
+      return fail( "',' or the end of the container expected" );
+   ++current_;
+   stack_.pop_back();
+   state_ = stack_.empty() ? stateDone : stateCommaOrClose;
+   return open == '{' ? eventObjectEnd : eventArrayEnd;
+}
+
+
+EventReader::Event
+EventReader::scalar( Event event )
+{
+   state_ = stack_.empty() ? stateDone : stateCommaOrClose;
+   return event;
+}
+
+
+EventReader::Event
+EventReader::next()
+{
+   while ( true )
+   {
+      if ( state_ == stateFailed )
+         return eventError;
+      skipSpaces();
+      if ( state_ == stateDone )
+         return current_ == end_ ? eventEndOfStream : fail( "end of document expected" );
+      if ( current_ == end_ )
+         return fail( "unexpected end of document" );
+      char c = *current_;
+      switch ( state_ )
+      {
+      case stateCommaOrClose:
+         if ( c != ',' )
+            return close();
+         ++current_;
+         state_ = stack_.back() == '{' ? stateKey : stateValue;
+         continue;
+      case stateColon:
+         if ( c != ':' )
+            return fail( "':' expected" );
+         ++current_;
+         state_ = stateValue;
+         continue;
+      case stateKeyOrClose:
+         if ( c == '}' )
+            return close();
+         // fall through
+      case stateKey:
+         if ( c != '"' )
+            return fail( "object member name expected" );
+         if ( !decodeString() )
+            return eventError;
+         state_ = stateColon;
+         return eventKey;
+      case stateValueOrClose:
+         if ( c == ']' )
+            return close();
+         break;
+      default:
+         break;
+      }
+
+      // a value
+      switch ( c )
+      {
+      case '{':
+         ++current_;
+         stack_.push_back( '{' );
+         state_ = stateKeyOrClose;
+         return eventObjectBegin;
+      case '[':
+         ++current_;
+         stack_.push_back( '[' );
+         state_ = stateValueOrClose;
+         return eventArrayBegin;
+      case '"':
+         if ( !decodeString() )
+            return eventError;
+         return scalar( eventString );
+      case 't':
+      case 'f':
+      case 'n':
+         {
+            const char *word = c == 't' ? "true" : (c == 'f' ? "false" : "null");
+            size_t len = strlen( word );
+            if ( size_t(end_ - current_) < len  ||  strncmp( current_, word, len ) != 0 )
+               return fail( "syntax error" );
+            current_ += len;
+            boolean_ = c == 't';
+            return scalar( c == 'n' ? eventNull : eventBoolean );
+         }
+      default:
+         {
+            const char *start = current_;
+            while ( current_ != end_  &&  ((*current_ >= '0'  &&  *current_ <= '9')  ||
+                    *current_ == '-'  ||  *current_ == '+'  ||  *current_ == '.'  ||
+                    *current_ == 'e'  ||  *current_ == 'E') )
+               ++current_;
+            size_t len = current_ - start;
+            char buffer[64];
+            if ( len == 0  ||  len >= sizeof(buffer) )
+            {
+               current_ = start;
+               return fail( "syntax error" );
+            }
+            memcpy( buffer, start, len );
+            buffer[len] = '\0';
+            char *parsed;
+            number_ = strtod( buffer, &parsed );
+            if ( parsed != buffer + len )
+            {
+               current_ = start;
+               return fail( "'" + std::string( start, len ) + "' is not a number" );
+            }
+            return scalar( eventNumber );
+         }
+      }
+   }
+}
+
+
+bool
+EventReader::decodeString()
+{
+   text_.clear();
+   ++current_;  // skip '"'
+   while ( true )
+   {
+      const char *start = current_;
+      while ( current_ != end_  &&  *current_ != '"'  &&  *current_ != '\\' )
+         ++current_;
+      text_.append( start, current_ );
+      if ( current_ == end_ )
+      {
+         fail( "missing '\"' at the end of a string" );
+         return false;
+      }
+      if ( *current_ == '"' )
+      {
+         ++current_;
+         return true;
+      }
+      // an escape sequence
+      ++current_;
+      if ( current_ == end_ )
+      {
+         fail( "empty escape sequence in a string" );
+         return false;
+      }
+      char escape = *current_++;
+      switch ( escape )
+      {
+      case '"': text_ += '"'; break;
+      case '/': text_ += '/'; break;
+      case '\\': text_ += '\\'; break;
+      case 'b': text_ += '\b'; break;
+      case 'f': text_ += '\f'; break;
+      case 'n': text_ += '\n'; break;
+      case 'r': text_ += '\r'; break;
+      case 't': text_ += '\t'; break;
+      case 'u':
+         {
+            unsigned int cp;
+            if ( !decodeHex4( current_, end_, cp ) )
+            {
+               fail( "bad unicode escape sequence in a string" );
+               return false;
+            }
+            current_ += 4;
+            if ( cp >= 0xD800  &&  cp <= 0xDBFF )
+            {
+               // a surrogate pair
+               unsigned int low;
+               if ( end_ - current_ < 6  ||  current_[0] != '\\'  ||  current_[1] != 'u'  ||
+                    !decodeHex4( current_ + 2, end_, low ) )
+               {
+                  fail( "expecting the second half of a surrogate pair" );
+                  return false;
+               }
+               current_ += 6;
+               cp = 0x10000 + ((cp & 0x3FF) << 10) + (low & 0x3FF);
+            }
+            appendUtf8( text_, cp );
+         }
+         break;
+      default:
+         fail( "bad escape sequence in a string" );
+         return false;
+      }
+   }
+}
+
+
+bool
+EventReader::startValue()
+{
+   while ( true )
+   {
+      if ( state_ == stateFailed )
+         return false;
+      skipSpaces();
+      if ( current_ == end_ )
+      {
+         fail( "unexpected end of document" );
+         return false;
+      }
+      char c = *current_;
+      if ( state_ == stateColon  &&  c == ':' )
+      {
+         ++current_;
+         state_ = stateValue;
+         continue;
+      }
+      if ( state_ == stateCommaOrClose  &&  c == ','  &&  stack_.back() == '[' )
+      {
+         ++current_;
+         state_ = stateValue;
+         continue;
+      }
+      if ( state_ == stateValue  ||  (state_ == stateValueOrClose  &&  c != ']') )
+         return true;
+      fail( "value expected" );
+      return false;
+   }
+}
+
+
+bool
+EventReader::valueEnd( const char *&end )
+{
+   const char *cur = current_;
+   int depth = 0;
+   do
+   {
+      if ( cur == end_ )
+      {
+         fail( "unexpected end of document" );
+         return false;
+      }
+      char c = *cur++;
+      if ( c == '"' )
+      {
+         while ( cur != end_  &&  *cur != '"' )
+            cur += *cur == '\\'  &&  cur + 1 != end_ ? 2 : 1;
+         if ( cur == end_ )
+         {
+            fail( "missing '\"' at the end of a string" );
+            return false;
+         }
+         ++cur;
+      }
+      else if ( c == '{'  ||  c == '[' )
+      {
+         ++depth;
+      }
+      else if ( c == '}'  ||  c == ']' )
+      {
+         --depth;
+      }
+      else if ( depth == 0 )
+      {
+         // the rest of a scalar
+         while ( cur != end_  &&  *cur != ','  &&  *cur != '}'  &&  *cur != ']'  &&
+                 *cur != ' '  &&  *cur != '\t'  &&  *cur != '\r'  &&  *cur != '\n' )
+            ++cur;
+      }
+   } while ( depth > 0 );
+   end = cur;
+   return true;
+}
+
+
+bool
+EventReader::readValue( Value &root )
+{
+   const char *end;
+   if ( !startValue()  ||  !valueEnd( end ) )
+      return false;
+   Reader reader;
+   if ( !reader.parse( current_, end, root, false ) )
+   {
+      fail( reader.getFormattedErrorMessages() );
+      return false;
+   }
+   current_ = end;
+   scalar( eventNull );
+   return true;
+}
+
+
+bool
+EventReader::skipValue()
+{
+   const char *end;
+   if ( !startValue()  ||  !valueEnd( end ) )
+      return false;
+   current_ = end;
+   scalar( eventNull );
+   return true;
+}
+
+
+std::string
+EventReader::getFormattedErrorMessages() const
+{
+   return error_;
+}
+
 }
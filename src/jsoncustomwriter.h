@@ -26,7 +26,9 @@ THE SOFTWARE.
 #ifndef PYNE_46Z7LQYFI5HZNASIPCWHVX3X5E
 #define PYNE_46Z7LQYFI5HZNASIPCWHVX3X5E
 
+#include <ostream>
 #include <string>
+#include <vector>
 
 namespace Json {
 
@@ -73,6 +75,121 @@ namespace Json {
       int maxWidth_;
    };
 
+   /** \brief Writes <a HREF="http://www.json.org">JSON</a> token by token to a stream.
+    *
+    * Objects and arrays are opened and closed explicitly and their members are written
+    * as they come, without spaces or newlines, so large documents are never built as a
+    * Value tree or held as one string. Numbers are formatted as by FastWriter. Commas
+    * are inserted as needed; it is up to the caller to nest the calls validly.
+    *
+    * \sa EventReader
+    */
+   class JSON_API CompactStreamWriter
+   {
+   public:
+      CompactStreamWriter( std::ostream &out );
+
+      void beginObject();
+      void endObject();
+      void beginArray();
+      void endArray();
+      /// Writes the name of the next object member.
+      void key( const std::string &name );
+      void value( double value );
+      void value( int value );
+      void value( bool value );
+      void value( const std::string &value );
+      void value( const char *value );
+      /// Writes a whole Value tree compactly.
+      void value( const Value &value );
+
+   private:
+      void separate();
+      void writeString( const char *value );
+      void writeTree( const Value &value );
+
+      std::ostream &out_;
+      std::vector<bool> first_; ///< whether the open containers are still empty
+      bool afterKey_;
+   };
+
+   /** \brief Reads <a HREF="http://www.json.org">JSON</a> text as a sequence of events.
+    *
+    * A pull parser in the spirit of SAX: each call to next() consumes one token of the
+    * document and reports it, without building Value trees. The decoded text of keys and
+    * strings is kept in a buffer that is reused between events. Subtrees that are wanted
+    * as a Value can be read with readValue(), and unwanted ones skipped with skipValue().
+    *
+    * \sa CompactStreamWriter
+    */
+   class JSON_API EventReader
+   {
+   public:
+      enum Event
+      {
+         eventObjectBegin = 0,
+         eventObjectEnd,
+         eventArrayBegin,
+         eventArrayEnd,
+         eventKey,
+         eventString,
+         eventNumber,
+         eventBoolean,
+         eventNull,
+         eventEndOfStream,
+         eventError
+      };
+
+      /// Reads the document in [begin, end), which must outlive the reader.
+      EventReader( const char *beginDoc, const char *endDoc );
+
+      /// Consumes the next token and returns its event.
+      Event next();
+      /// Returns the decoded text of the last key or string.
+      const std::string &text() const { return text_; }
+      /// Returns the last number.
+      double number() const { return number_; }
+      /// Returns the last boolean.
+      bool boolean() const { return boolean_; }
+      /// Reads the next value, which may be a whole object or array, into \a root.
+      bool readValue( Value &root );
+      /// Consumes the next value, which may be a whole object or array.
+      bool skipValue();
+      /// Returns a message on the first error with its offset, or an empty string.
+      std::string getFormattedErrorMessages() const;
+
+   private:
+      enum State
+      {
+         stateValue = 0,
+         stateValueOrClose,
+         stateKey,
+         stateKeyOrClose,
+         stateColon,
+         stateCommaOrClose,
+         stateDone,
+         stateFailed
+      };
+
+      Event fail( const std::string &message );
+      Event close();
+      Event scalar( Event event );
+      bool startValue();
+      bool valueEnd( const char *&end );
+      bool decodeString();
+      void skipSpaces();
+
+      const char *begin_;
+      const char *end_;
+      const char *current_;
+      std::vector<char> stack_; ///< '{' or '[' for each open container
+      State state_;
+      std::string text_;
+      double number_;
+      bool boolean_;
+      std::string error_;
+   };
+
 }
 
 #endif
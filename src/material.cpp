@@ -4,13 +4,24 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <exception>
 #include <iomanip>  // std::setprecision
+#include <memory>
 #include <math.h>   // modf
 #include <stdexcept>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #ifndef PYNE_IS_AMALGAMATED
 #include "transmuters.h"
 #include "material.h"
+#include "instrument.h"
 #endif
 
 // h5wrap template
@@ -241,6 +252,7 @@ int pyne::Material::detect_hdf5_layout(hid_t db, std::string path){
 
 
 void pyne::Material::from_hdf5(std::string filename, std::string datapath, int row, int protocol) {
+  PYNE_TIME(TIME_MATERIAL_READ_HDF5);
   // Turn off annoying HDF5 errors
   herr_t status;
   H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
@@ -301,6 +313,498 @@ void pyne::Material::from_hdf5(std::string filename, std::string datapath, int r
 }
 
 
+pyne::MaterialTable::MaterialTable(std::string filename, std::string datapath,
+                                   int start, int count) : num_rows(0),
+                                                           row_size(3) {
+  // Turn off annoying HDF5 errors
+  H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
+
+  // Check that the file is there
+  if (!pyne::file_exists(filename))
+    throw pyne::FileNotFound(filename);
+  // Check to see if the file is in HDF5 format.
+  bool ish5 = H5Fis_hdf5(filename.c_str());
+  if (!ish5)
+    throw h5wrap::FileNotHDF5(filename);
+
+  //Set file access properties so it closes cleanly
+  hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fclose_degree(fapl, H5F_CLOSE_STRONG);
+  // Open the database once for all rows
+  hid_t db = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, fapl);
+  H5Pclose(fapl);
+
+  try {
+    std::string nucpath;
+    hid_t data_set;
+    bool has_nucpath;
+    switch (Material::detect_hdf5_layout(db, datapath)) {
+      case Material::path_donotexists:
+        throw std::runtime_error("/material and " + datapath +
+                                 " paths do not exist.");
+      case Material::unknown:
+        throw std::runtime_error(datapath + " is not a dataset and /material "
+                                 "entity is not a group nor a dataset.");
+      case Material::old_layout:
+        data_set = H5Dopen2(db, datapath.c_str(), H5P_DEFAULT);
+        has_nucpath = detect_nuclidelist(data_set, nucpath);
+        H5Dclose(data_set);
+        if (!has_nucpath)
+          throw std::runtime_error("Can't find location of the nuclide list: "
+                                   "nucpath attribute not found!");
+        read_rows(db, datapath, nucpath, start, count);
+        break;
+      case Material::new_layout:
+        read_rows(db, "/material" + datapath + "/composition",
+                  "/material" + datapath + "/nuclidelist", start, count);
+        break;
+    }
+  } catch (...) {
+    H5Fclose(db);
+    throw;
+  }
+  H5Fclose(db);
+}
+
+
+void pyne::MaterialTable::read_rows(hid_t db, std::string datapath,
+                                    std::string nucpath, int start,
+                                    int count) {
+  if (!h5wrap::path_exists(db, nucpath))
+    throw std::runtime_error("No path found at the location: " + nucpath);
+
+  if (!h5wrap::path_exists(db, datapath))
+    throw std::runtime_error("No path found at the location: " + datapath);
+
+  // Grab the nuclides
+  nucs = h5wrap::h5_array_to_cpp_vector_1d<int>(db, nucpath, H5T_NATIVE_INT);
+  hsize_t nuc_dims[1] = {static_cast<hsize_t>(nucs.size())};
+  row_size = 3 + nucs.size();
+
+  // Resolve the row range, negative starts count from the end
+  hid_t data_set = H5Dopen2(db, datapath.c_str(), H5P_DEFAULT);
+  hid_t data_space = H5Dget_space(data_set);
+  hsize_t data_dims[1];
+  H5Sget_simple_extent_dims(data_space, data_dims, NULL);
+  int num_data = static_cast<int>(data_dims[0]);
+  if (start < 0)
+    start += num_data;
+  if (count < 0)
+    count = num_data - start;
+  if (start < 0 || count < 0 || num_data < start + count) {
+    H5Sclose(data_space);
+    H5Dclose(data_set);
+    throw std::out_of_range("Material table rows out of range.");
+  }
+  num_rows = count;
+  buf.assign((size_t) num_rows * row_size, 0.0);
+  meta.assign(num_rows, std::string());
+  if (num_rows == 0) {
+    H5Sclose(data_space);
+    H5Dclose(data_set);
+    return;
+  }
+
+  // Select all rows at once
+  hsize_t data_offset[1] = {static_cast<hsize_t>(start)};
+  hsize_t data_count[1] = {static_cast<hsize_t>(num_rows)};
+  H5Sselect_hyperslab(data_space, H5S_SELECT_SET, data_offset, NULL,
+                      data_count, NULL);
+  hid_t mem_space = H5Screate_simple(1, data_count, NULL);
+
+  // Rows are packed as mass, density, atoms_per_molecule, then the comp
+  hid_t desc = H5Tcreate(H5T_COMPOUND, row_size * sizeof(double));
+  H5Tinsert(desc, "mass", 0, H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "density", sizeof(double), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "atoms_per_molecule", 2*sizeof(double), H5T_NATIVE_DOUBLE);
+  hid_t comp_values_array_type = -1;
+  if (0 < nucs.size()) {
+    comp_values_array_type = H5Tarray_create2(H5T_NATIVE_DOUBLE, 1, nuc_dims);
+    H5Tinsert(desc, "comp", 3*sizeof(double), comp_values_array_type);
+  }
+  H5Dread(data_set, desc, mem_space, data_space, H5P_DEFAULT, buf.data());
+  if (0 <= comp_values_array_type)
+    H5Tclose(comp_values_array_type);
+  H5Tclose(desc);
+  H5Sclose(mem_space);
+  H5Sclose(data_space);
+  H5Dclose(data_set);
+
+  //
+  // Get metadata from associated dataset, if available
+  //
+  std::string attrpath = datapath + "_metadata";
+  if (!h5wrap::path_exists(db, attrpath))
+    return;
+
+  hid_t attrtype = H5Tvlen_create(H5T_NATIVE_CHAR);
+  hid_t metadataet = H5Dopen2(db, attrpath.c_str(), H5P_DEFAULT);
+  hid_t metadatalab = H5Dget_space(metadataet);
+  H5Sselect_hyperslab(metadatalab, H5S_SELECT_SET, data_offset, NULL,
+                      data_count, NULL);
+  hid_t attrmemspace = H5Screate_simple(1, data_count, NULL);
+  std::vector<hvl_t> attrdata (num_rows);
+  H5Dread(metadataet, attrtype, attrmemspace, metadatalab, H5P_DEFAULT,
+          attrdata.data());
+  for (int k = 0; k < num_rows; k++)
+    meta[k].assign((char *) attrdata[k].p, attrdata[k].len);
+  H5Dvlen_reclaim(attrtype, attrmemspace, H5P_DEFAULT, attrdata.data());
+
+  // close attr data objects
+  H5Sclose(attrmemspace);
+  H5Sclose(metadatalab);
+  H5Dclose(metadataet);
+  H5Tclose(attrtype);
+}
+
+
+pyne::Material pyne::MaterialTable::material(int k) const {
+  if (k < 0 || num_rows <= k)
+    throw std::out_of_range("Material table row out of range.");
+  Material mat;
+  mat.mass = mass(k);
+  mat.density = density(k);
+  mat.atoms_per_molecule = atoms_per_molecule(k);
+  const double* values = comp(k);
+  for (int i = 0; i < nucs.size(); i++) {
+    if (values[i] != 0)
+      mat.comp.insert(mat.comp.end(), std::make_pair(nucs[i], values[i]));
+  }
+  if (!meta[k].empty()) {
+    Json::Reader reader;
+    reader.parse(meta[k].data(), meta[k].data() + meta[k].size(),
+                 mat.metadata, false);
+  }
+  // Renormalize the composition, just to be safe.
+  mat.norm_comp();
+  return mat;
+}
+
+
+std::vector<pyne::Material> pyne::MaterialTable::materials() const {
+  std::vector<Material> mats;
+  mats.reserve(num_rows);
+  for (int k = 0; k < num_rows; k++)
+    mats.push_back(material(k));
+  return mats;
+}
+
+
+namespace {
+
+const char binary_library_magic[8] = {'P', 'Y', 'N', 'E', 'M', 'L', 'I', 'B'};
+const uint32_t binary_library_byte_order = 0x01020304;
+
+// Binary material library header. Offsets are from the start of the file and
+// multiples of 8.
+struct BinaryLibraryHeader {
+  char magic[8];
+  uint32_t byte_order;
+  uint32_t version;
+  uint64_t num_mats;
+  uint64_t num_nucs;
+  uint64_t nnz;
+  uint64_t meta_size;
+  uint64_t nucs_offset;       // int32_t[num_nucs], sorted
+  uint64_t comp_ptr_offset;   // uint64_t[num_mats + 1]
+  uint64_t comp_index_offset; // int32_t[nnz]
+  uint64_t comp_frac_offset;  // double[nnz]
+  uint64_t mass_offset;       // double[num_mats]
+  uint64_t density_offset;    // double[num_mats]
+  uint64_t apm_offset;        // double[num_mats]
+  uint64_t meta_ptr_offset;   // uint64_t[num_mats + 1]
+  uint64_t meta_offset;       // char[meta_size]
+};
+
+// Returns n rounded up to a multiple of 8
+inline uint64_t align8(uint64_t n) {
+  return (n + 7) & ~((uint64_t) 7);
+}
+
+// Writes n items of v, then pads the file to a multiple of 8 bytes
+template <typename T>
+void binary_library_write(std::ofstream& f, const T* v, size_t n) {
+  static const char zeros[8] = {0};
+  if (0 < n)
+    f.write(reinterpret_cast<const char*>(v), n * sizeof(T));
+  f.write(zeros, align8(n * sizeof(T)) - n * sizeof(T));
+}
+
+}  // namespace
+
+
+void pyne::write_binary_library(const std::vector<Material>& mats,
+                                std::string filename) {
+  // the union of the nuclides, and the index of each one in it
+  std::vector<int32_t> nucs;
+  size_t nnz = 0;
+  for (size_t k = 0; k < mats.size(); k++) {
+    nnz += mats[k].comp.size();
+    for (comp_map::const_iterator it = mats[k].comp.begin();
+         it != mats[k].comp.end(); ++it)
+      nucs.push_back(it->first);
+  }
+  std::sort(nucs.begin(), nucs.end());
+  nucs.erase(std::unique(nucs.begin(), nucs.end()), nucs.end());
+
+  size_t num_mats = mats.size();
+  std::vector<uint64_t> comp_ptr (num_mats + 1, 0);
+  std::vector<int32_t> comp_index;
+  std::vector<double> comp_frac;
+  std::vector<double> columns (3 * num_mats);
+  std::vector<uint64_t> meta_ptr (num_mats + 1, 0);
+  std::ostringstream meta;
+  comp_index.reserve(nnz);
+  comp_frac.reserve(nnz);
+  for (size_t k = 0; k < num_mats; k++) {
+    const Material& mat = mats[k];
+    // compositions are sorted, so each lookup starts after the previous one
+    std::vector<int32_t>::const_iterator n = nucs.begin();
+    for (comp_map::const_iterator it = mat.comp.begin(); it != mat.comp.end();
+         ++it) {
+      n = std::lower_bound(n, nucs.cend(), it->first);
+      comp_index.push_back(n - nucs.begin());
+      comp_frac.push_back(it->second);
+    }
+    comp_ptr[k + 1] = comp_index.size();
+    columns[k] = mat.mass;
+    columns[num_mats + k] = mat.density;
+    columns[2*num_mats + k] = mat.atoms_per_molecule;
+    Json::CompactStreamWriter writer (meta);
+    if (mat.metadata.isNull())
+      writer.value(Json::Value(Json::objectValue));
+    else
+      writer.value(mat.metadata);
+    meta_ptr[k + 1] = meta.tellp();
+  }
+  std::string meta_text = meta.str();
+
+  BinaryLibraryHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, binary_library_magic, 8);
+  header.byte_order = binary_library_byte_order;
+  header.version = BINARY_LIBRARY_VERSION;
+  header.num_mats = num_mats;
+  header.num_nucs = nucs.size();
+  header.nnz = nnz;
+  header.meta_size = meta_text.size();
+  header.nucs_offset = align8(sizeof(header));
+  header.comp_ptr_offset = header.nucs_offset +
+                           align8(nucs.size() * sizeof(int32_t));
+  header.comp_index_offset = header.comp_ptr_offset +
+                             (num_mats + 1) * sizeof(uint64_t);
+  header.comp_frac_offset = header.comp_index_offset +
+                            align8(nnz * sizeof(int32_t));
+  header.mass_offset = header.comp_frac_offset + nnz * sizeof(double);
+  header.density_offset = header.mass_offset + num_mats * sizeof(double);
+  header.apm_offset = header.density_offset + num_mats * sizeof(double);
+  header.meta_ptr_offset = header.apm_offset + num_mats * sizeof(double);
+  header.meta_offset = header.meta_ptr_offset +
+                       (num_mats + 1) * sizeof(uint64_t);
+
+  // write to a temporary file first, so readers never map a partial file
+  std::string tmpname = filename + ".tmp";
+  std::ofstream f(tmpname.c_str(), std::ios::binary | std::ios::trunc);
+  if (!f)
+    throw FileNotFound(tmpname);
+  binary_library_write(f, &header, 1);
+  binary_library_write(f, nucs.data(), nucs.size());
+  binary_library_write(f, comp_ptr.data(), comp_ptr.size());
+  binary_library_write(f, comp_index.data(), comp_index.size());
+  binary_library_write(f, comp_frac.data(), comp_frac.size());
+  binary_library_write(f, columns.data(), columns.size());
+  binary_library_write(f, meta_ptr.data(), meta_ptr.size());
+  binary_library_write(f, meta_text.data(), meta_text.size());
+  f.close();
+  if (!f || std::rename(tmpname.c_str(), filename.c_str()) != 0) {
+    std::remove(tmpname.c_str());
+    throw std::runtime_error("could not write material library " + filename);
+  }
+}
+
+
+
+std::vector<double> pyne::MaterialSeries::activity() const {
+  pyne::NucPropertyTable& props = pyne::nuc_property_table;
+  size_t nc = nucs.size();
+  std::vector<double> factor (nc);
+  for (size_t c = 0; c < nc; c++)
+    factor[c] = pyne::N_A * props.decay_const(props.ordinal(nucs[c]));
+  std::vector<double> act (moles.size());
+  for (size_t j = 0; j < moles.size(); j++)
+    act[j] = moles[j] * factor[j % nc];
+  return act;
+}
+
+
+std::vector<double> pyne::MaterialSeries::decay_heat() const {
+  pyne::NucPropertyTable& props = pyne::nuc_property_table;
+  size_t nc = nucs.size();
+  std::vector<double> factor (nc);
+  for (size_t c = 0; c < nc; c++) {
+    int ord = props.ordinal(nucs[c]);
+    factor[c] = pyne::N_A * props.metastable_decay_const(ord) *
+                props.q_val(ord) / pyne::MeV_per_MJ;
+  }
+  std::vector<double> dh (moles.size());
+  for (size_t j = 0; j < moles.size(); j++)
+    dh[j] = moles[j] * factor[j % nc];
+  return dh;
+}
+
+
+std::vector<std::pair<double, double> > pyne::MaterialSeries::photons(
+    int k, bool norm) const {
+  if (k < 0 || size() <= k)
+    throw std::out_of_range("Material series time out of range.");
+  const double* amounts = row(k);
+  size_t nc = nucs.size();
+  double total = 0.0;
+  for (size_t c = 0; c < nc; c++)
+    total += amounts[c];
+  // gammas then x-rays of each nuclide, weighted by its atom fraction
+  std::vector<std::pair<double, double> > result;
+  for (int pass = 0; pass < 2; pass++) {
+    for (size_t c = 0; c < nc; c++) {
+      if (amounts[c] == 0.0)
+        continue;
+      int state_id = nucs[c] % 10000 > 0 ?
+                     nucname::id_to_state_id(nucs[c]) : nucs[c];
+      std::vector<std::pair<double, double> > lines = pass == 0 ?
+          pyne::gammas(state_id) : pyne::xrays(state_id);
+      for (size_t i = 0; i < lines.size(); i++)
+        result.push_back(std::make_pair(lines[i].first, amounts[c] / total *
+                                        lines[i].second));
+    }
+  }
+  if (norm)
+    result = Material().normalize_radioactivity(result);
+  return result;
+}
+
+
+pyne::Material pyne::MaterialSeries::material(int k) const {
+  if (k < 0 || size() <= k)
+    throw std::out_of_range("Material series time out of range.");
+  pyne::NucPropertyTable& props = pyne::nuc_property_table;
+  const double* amounts = row(k);
+  Material mat;
+  mat.mass = 0.0;
+  for (size_t c = 0; c < nucs.size(); c++) {
+    if (amounts[c] <= 0.0)
+      continue;
+    double m = amounts[c] * props.atomic_mass(props.ordinal(nucs[c]));
+    mat.comp.insert(mat.comp.end(), std::make_pair(nucs[c], m));
+    mat.mass += m;
+  }
+  mat.norm_comp();
+  return mat;
+}
+
+
+pyne::Material pyne::MaterialView::material() const {
+  Material mat;
+  mat.mass = mass;
+  mat.density = density;
+  mat.atoms_per_molecule = atoms_per_molecule;
+  for (int i = 0; i < num; i++)
+    mat.comp.insert(mat.comp.end(), std::make_pair(nucs[index[i]], fracs[i]));
+  if (meta_size == 2 && meta[0] == '{' && meta[1] == '}') {
+    mat.metadata = Json::Value(Json::objectValue);
+  } else {
+    Json::Reader reader;
+    if (!reader.parse(meta, meta + meta_size, mat.metadata, false))
+      throw std::runtime_error("invalid metadata in material library: " +
+                               reader.getFormattedErrorMessages());
+  }
+  return mat;
+}
+
+
+pyne::BinaryMaterialLibrary::BinaryMaterialLibrary(std::string filename)
+    : file(filename) {
+  const char* base = file.data();
+  size_t len = file.size();
+  if (len < sizeof(BinaryLibraryHeader))
+    throw std::runtime_error("material library " + filename + " is truncated");
+  BinaryLibraryHeader header;
+  std::memcpy(&header, base, sizeof(header));
+  if (std::memcmp(header.magic, binary_library_magic, 8) != 0)
+    throw std::runtime_error(filename + " is not a material library");
+  if (header.byte_order != binary_library_byte_order ||
+      header.version != BINARY_LIBRARY_VERSION)
+    throw std::runtime_error("material library " + filename +
+                             " was written by an incompatible build");
+
+  // every section must lie in the file, and be aligned for in-place use
+  struct Section {uint64_t offset; uint64_t size;};
+  Section sections[] = {
+    {header.nucs_offset, header.num_nucs * sizeof(int32_t)},
+    {header.comp_ptr_offset, (header.num_mats + 1) * sizeof(uint64_t)},
+    {header.comp_index_offset, header.nnz * sizeof(int32_t)},
+    {header.comp_frac_offset, header.nnz * sizeof(double)},
+    {header.mass_offset, header.num_mats * sizeof(double)},
+    {header.density_offset, header.num_mats * sizeof(double)},
+    {header.apm_offset, header.num_mats * sizeof(double)},
+    {header.meta_ptr_offset, (header.num_mats + 1) * sizeof(uint64_t)},
+    {header.meta_offset, header.meta_size},
+  };
+  if (header.num_mats > (uint64_t) INT_MAX ||
+      header.num_nucs > (uint64_t) INT_MAX || header.nnz > len ||
+      header.num_nucs > len)
+    throw std::runtime_error("material library " + filename + " is truncated");
+  for (int i = 0; i < 9; i++) {
+    if (sections[i].offset % 8 != 0 || sections[i].offset > len ||
+        sections[i].size > len - sections[i].offset)
+      throw std::runtime_error("material library " + filename +
+                               " is truncated");
+  }
+  num_mats = header.num_mats;
+  num_nucs = header.num_nucs;
+  nucs = reinterpret_cast<const int32_t*>(base + header.nucs_offset);
+  comp_ptr = reinterpret_cast<const uint64_t*>(base + header.comp_ptr_offset);
+  comp_index = reinterpret_cast<const int32_t*>(base +
+                                                header.comp_index_offset);
+  comp_frac = reinterpret_cast<const double*>(base + header.comp_frac_offset);
+  masses = reinterpret_cast<const double*>(base + header.mass_offset);
+  densities = reinterpret_cast<const double*>(base + header.density_offset);
+  apms = reinterpret_cast<const double*>(base + header.apm_offset);
+  meta_ptr = reinterpret_cast<const uint64_t*>(base + header.meta_ptr_offset);
+  meta = base + header.meta_offset;
+
+  // the row pointers and indices are checked once here, so that views can be
+  // taken without further checks
+  if (comp_ptr[0] != 0 || comp_ptr[num_mats] != header.nnz ||
+      meta_ptr[0] != 0 || meta_ptr[num_mats] != header.meta_size)
+    throw std::runtime_error("material library " + filename + " is corrupt");
+  for (int k = 0; k < num_mats; k++) {
+    if (comp_ptr[k + 1] < comp_ptr[k] || meta_ptr[k + 1] < meta_ptr[k])
+      throw std::runtime_error("material library " + filename + " is corrupt");
+  }
+  for (uint64_t i = 0; i < header.nnz; i++) {
+    if (comp_index[i] < 0 || num_nucs <= comp_index[i])
+      throw std::runtime_error("material library " + filename + " is corrupt");
+  }
+}
+
+
+pyne::MaterialView pyne::BinaryMaterialLibrary::view(int k) const {
+  if (k < 0 || num_mats <= k)
+    throw std::out_of_range("Material library index out of range.");
+  MaterialView v;
+  v.mass = masses[k];
+  v.density = densities[k];
+  v.atoms_per_molecule = apms[k];
+  v.num = comp_ptr[k + 1] - comp_ptr[k];
+  v.nucs = nucs;
+  v.index = comp_index + comp_ptr[k];
+  v.fracs = comp_frac + comp_ptr[k];
+  v.meta = meta + meta_ptr[k];
+  v.meta_size = meta_ptr[k + 1] - meta_ptr[k];
+  return v;
+}
+
+
 void pyne::Material::deprecated_write_hdf5(char * filename, char * datapath, char * nucpath, float row, int chunksize) {
   std::string fname (filename);
   std::string groupname (datapath);
@@ -525,6 +1029,7 @@ void pyne::Material::write_hdf5_datapath(hid_t db, std::string datapath,
 
 void pyne::Material::write_hdf5(std::string filename, std::string datapath,
                                 float row, int chunksize) {
+  PYNE_TIME(TIME_MATERIAL_WRITE_HDF5);
   if (datapath.front() != '/') datapath = '/' + datapath;
 
   hid_t material_grp_id;  // Holder of HDF5 Id of the "/material" group
@@ -631,6 +1136,222 @@ void pyne::Material::write_hdf5(std::string filename, std::string datapath,
 }
 
 
+void pyne::write_hdf5_rows(const std::vector<Material>& mats,
+                           std::string filename, std::string datapath,
+                           int chunksize, int deflate, bool shuffle) {
+  if (datapath.front() != '/') datapath = '/' + datapath;
+
+  // Turn off annoying HDF5 errors
+  H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
+
+  // Set file access properties so it closes cleanly
+  hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fclose_degree(fapl, H5F_CLOSE_STRONG);
+  hid_t db;
+  if (!pyne::file_exists(filename)) {
+    db = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+  } else {
+    bool ish5 = H5Fis_hdf5(filename.c_str());
+    if (!ish5) throw h5wrap::FileNotHDF5(filename);
+    db = H5Fopen(filename.c_str(), H5F_ACC_RDWR, fapl);
+  }
+  H5Pclose(fapl);
+
+  hid_t material_grp_id;
+  switch (Material::detect_hdf5_layout(db, datapath)) {
+    case Material::unknown:
+      H5Fclose(db);
+      throw std::runtime_error(
+          datapath +
+          " is not a dataset and /material entity is neither a group nor a dataset.");
+    case Material::old_layout:
+      // the old layout has its own row by row writer
+      H5Fclose(db);
+      for (int k = 0; k < mats.size(); k++) {
+        Material mat = mats[k];
+        mat.write_hdf5(filename, datapath, -0.0, chunksize);
+      }
+      return;
+    case Material::path_donotexists:
+      material_grp_id =
+          H5Gcreate2(db, "/material", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+      break;
+    case Material::new_layout:
+      material_grp_id = H5Gopen2(db, "/material", H5P_DEFAULT);
+      break;
+  }
+  hid_t data_id;
+  if (!h5wrap::path_exists(db, "/material" + datapath)) {
+    data_id = H5Gcreate2(db, ("/material" + datapath).c_str(), H5P_DEFAULT,
+                         H5P_DEFAULT, H5P_DEFAULT);
+  } else {
+    data_id = H5Gopen2(db, ("/material" + datapath).c_str(), H5P_DEFAULT);
+  }
+
+  //
+  // Read in nuclist if available, write the union of the nuclides if not
+  //
+  std::string nucpath = "nuclidelist";
+  std::vector<int> nuclides;
+  if (h5wrap::path_exists(data_id, nucpath)) {
+    nuclides = h5wrap::h5_array_to_cpp_vector_1d<int>(data_id, nucpath,
+                                                      H5T_NATIVE_INT);
+  } else {
+    std::set<int> nucset;
+    for (int k = 0; k < mats.size(); k++) {
+      pyne::comp_map::const_iterator ci;
+      for (ci = mats[k].comp.begin(); ci != mats[k].comp.end(); ci++)
+        nucset.insert(ci->first);
+    }
+    nuclides.assign(nucset.begin(), nucset.end());
+    hsize_t nuc_dims[1] = {static_cast<hsize_t>(nuclides.size())};
+    hid_t nuc_space = H5Screate_simple(1, nuc_dims, NULL);
+    hid_t nuc_set = H5Dcreate2(data_id, nucpath.c_str(), H5T_NATIVE_INT,
+                               nuc_space, H5P_DEFAULT, H5P_DEFAULT,
+                               H5P_DEFAULT);
+    if (0 < nuclides.size())
+      H5Dwrite(nuc_set, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+               nuclides.data());
+    H5Dclose(nuc_set);
+    H5Sclose(nuc_space);
+  }
+  int nuc_size = nuclides.size();
+  std::map<int, int> columns;
+  for (int n = 0; n < nuc_size; n++)
+    columns[nuclides[n]] = n;
+
+  //
+  // Pack all rows, mass, density, atoms_per_molecule, then the comp
+  //
+  size_t row_size = 3 + nuc_size;
+  std::vector<double> buf (row_size * mats.size(), 0.0);
+  bool missing_nucs = false;
+  for (int k = 0; k < mats.size(); k++) {
+    double* row = &buf[k * row_size];
+    row[0] = mats[k].mass;
+    row[1] = mats[k].density;
+    row[2] = mats[k].atoms_per_molecule;
+    pyne::comp_map::const_iterator ci;
+    for (ci = mats[k].comp.begin(); ci != mats[k].comp.end(); ci++) {
+      std::map<int, int>::iterator col = columns.find(ci->first);
+      if (col == columns.end())
+        missing_nucs = true;
+      else
+        row[3 + col->second] = ci->second;
+    }
+  }
+  if (missing_nucs)
+    std::cout
+        << "One or more nuclides are missing from the existing nuclides "
+           "list, material will likely not be written correctly."
+        << std::endl;
+
+  hsize_t nuc_dims[1] = {static_cast<hsize_t>(nuc_size)};
+  hid_t desc = H5Tcreate(H5T_COMPOUND, row_size * sizeof(double));
+  H5Tinsert(desc, "mass", 0, H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "density", sizeof(double), H5T_NATIVE_DOUBLE);
+  H5Tinsert(desc, "atoms_per_molecule", 2*sizeof(double), H5T_NATIVE_DOUBLE);
+  hid_t comp_values_array_type = -1;
+  if (0 < nuc_size) {
+    comp_values_array_type = H5Tarray_create2(H5T_NATIVE_DOUBLE, 1, nuc_dims);
+    H5Tinsert(desc, "comp", 3*sizeof(double), comp_values_array_type);
+  }
+
+  //
+  // Size the data sets once
+  //
+  hsize_t data_dims[1] = {0};
+  hsize_t data_max_dims[1] = {H5S_UNLIMITED};
+  hsize_t chunk_dims[1] = {static_cast<hsize_t>(chunksize)};
+  std::string datasetpath = "composition";
+  std::string attrpath = datasetpath + "_metadata";
+  hid_t attrtype = H5Tvlen_create(H5T_NATIVE_CHAR);
+  hid_t data_set, metadataet;
+  if (h5wrap::path_exists(data_id, datasetpath)) {
+    data_set = H5Dopen2(data_id, datasetpath.c_str(), H5P_DEFAULT);
+    hid_t data_space = H5Dget_space(data_set);
+    H5Sget_simple_extent_dims(data_space, data_dims, NULL);
+    H5Sclose(data_space);
+  } else {
+    hid_t data_set_params = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(data_set_params, 1, chunk_dims);
+    if (shuffle)
+      H5Pset_shuffle(data_set_params);
+    if (0 < deflate)
+      H5Pset_deflate(data_set_params, deflate);
+    hid_t data_space = H5Screate_simple(1, data_dims, data_max_dims);
+    data_set = H5Dcreate2(data_id, datasetpath.c_str(), desc, data_space,
+                          H5P_DEFAULT, data_set_params, H5P_DEFAULT);
+    H5Sclose(data_space);
+    H5Pclose(data_set_params);
+  }
+  if (h5wrap::path_exists(data_id, attrpath)) {
+    metadataet = H5Dopen2(data_id, attrpath.c_str(), H5P_DEFAULT);
+  } else {
+    hid_t metadataetparams = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(metadataetparams, 1, chunk_dims);
+    if (0 < deflate)
+      H5Pset_deflate(metadataetparams, deflate);
+    hvl_t attrfillvalue [1];
+    attrfillvalue[0].len = 3;
+    attrfillvalue[0].p = (char *) "{}\n";
+    H5Pset_fill_value(metadataetparams, attrtype, &attrfillvalue);
+    hsize_t attr_dims[1] = {data_dims[0]};
+    hid_t metadatapace = H5Screate_simple(1, attr_dims, data_max_dims);
+    metadataet = H5Dcreate2(data_id, attrpath.c_str(), attrtype, metadatapace,
+                            H5P_DEFAULT, metadataetparams, H5P_DEFAULT);
+    H5Sclose(metadatapace);
+    H5Pclose(metadataetparams);
+  }
+  hsize_t data_offset[1] = {data_dims[0]};
+  hsize_t data_count[1] = {static_cast<hsize_t>(mats.size())};
+  data_dims[0] += mats.size();
+  H5Dset_extent(data_set, data_dims);
+  H5Dset_extent(metadataet, data_dims);
+
+  if (0 < mats.size()) {
+    // Write all rows...
+    hid_t data_hyperslab = H5Dget_space(data_set);
+    H5Sselect_hyperslab(data_hyperslab, H5S_SELECT_SET, data_offset, NULL,
+                        data_count, NULL);
+    hid_t mem_space = H5Screate_simple(1, data_count, NULL);
+    H5Dwrite(data_set, desc, mem_space, data_hyperslab, H5P_DEFAULT,
+             buf.data());
+    H5Sclose(mem_space);
+    H5Sclose(data_hyperslab);
+
+    // ...and all metadata
+    Json::FastWriter writer;
+    std::vector<std::string> metadatatrs (mats.size());
+    std::vector<hvl_t> attrdata (mats.size());
+    for (int k = 0; k < mats.size(); k++) {
+      metadatatrs[k] = writer.write(mats[k].metadata);
+      attrdata[k].p = (char *) metadatatrs[k].c_str();
+      attrdata[k].len = metadatatrs[k].length();
+    }
+    hid_t metadatalab = H5Dget_space(metadataet);
+    H5Sselect_hyperslab(metadatalab, H5S_SELECT_SET, data_offset, NULL,
+                        data_count, NULL);
+    hid_t attrmemspace = H5Screate_simple(1, data_count, NULL);
+    H5Dwrite(metadataet, attrtype, attrmemspace, metadatalab, H5P_DEFAULT,
+             attrdata.data());
+    H5Sclose(attrmemspace);
+    H5Sclose(metadatalab);
+  }
+
+  // close all data objects, groups and files
+  H5Dclose(metadataet);
+  H5Dclose(data_set);
+  H5Tclose(attrtype);
+  if (0 <= comp_values_array_type)
+    H5Tclose(comp_values_array_type);
+  H5Tclose(desc);
+  H5Gclose(data_id);
+  H5Gclose(material_grp_id);
+  H5Fclose(db);
+}
+
+
 void pyne::Material::deprecated_write_hdf5(std::string filename, std::string datapath,
                                 std::string nucpath, float row, int chunksize) {
   // Turn off annoying HDF5 errors
@@ -825,24 +1546,32 @@ std::string pyne::Material::get_uwuw_name() {
 
 ///---------------------------------------------------------------------------//
 std::string pyne::Material::mcnp(std::string frac_type, bool mult_den) {
-  //////////////////// Begin card creation ///////////////////////
   std::ostringstream oss;
+  mcnp(oss, frac_type, mult_den);
+  return oss.str();
+}
+
+
+void pyne::Material::mcnp(std::ostream& oss, std::string frac_type,
+                          bool mult_den) {
+  //////////////////// Begin card creation ///////////////////////
+  pyne::StreamFormatSaver saver (oss);
 
   std::string comment_prefix = "C ";
 
   // 'name'
   if (metadata.isMember("name")) {
-    oss << "C name: " << metadata["name"].asString() << std::endl;
+    oss << "C name: " << metadata["name"].asString() << "\n";
   }
   // 'density'
   if (density != -1.0) {
-     std::stringstream ds;
-     ds << std::setprecision(5) << std::fixed << "C density = " << density << std::endl;
-     oss << ds.str();
+     oss << std::setprecision(5) << std::fixed << "C density = " << density
+         << "\n";
+     oss.flags(std::ios::dec | std::ios::skipws);
   }
   // 'source'
   if (metadata.isMember("source")) {
-     oss << "C source: " << metadata["source"].asString() << std::endl;
+     oss << "C source: " << metadata["source"].asString() << "\n";
   }
   // Metadata comments
   if (metadata.isMember("comments")) {
@@ -854,19 +1583,16 @@ std::string pyne::Material::mcnp(std::string frac_type, bool mult_den) {
   oss << "m";
   if (metadata.isMember("mat_number")) {
     int mat_num = metadata["mat_number"].asInt();
-    oss << mat_num << std::endl;
+    oss << mat_num << "\n";
   } else {
-    oss << "?" << std::endl;
+    oss << "?" << "\n";
   }
 
   // Set up atom or mass frac map
   std::map<int, double> fracs = get_density_frac(frac_type, mult_den);
-  std::string frac_sign = "";
 
   // write the frac map
-  oss << mcnp_frac(fracs, frac_type);
-
-  return oss.str();
+  mcnp_frac(oss, fracs, frac_type);
 }
 
 
@@ -921,39 +1647,41 @@ std::string pyne::Material::phits(std::string frac_type, bool mult_den) {
 
 
 std::string pyne::Material::mcnp_frac(std::map<int, double> fracs, std::string frac_type){
+  std::ostringstream oss;
+  mcnp_frac(oss, fracs, frac_type);
+  return oss.str();
+}
+
+
+void pyne::Material::mcnp_frac(std::ostream& oss,
+                               const std::map<int, double>& fracs,
+                               std::string frac_type) {
+  pyne::StreamFormatSaver saver (oss);
   std::string frac_sign = "";
   if ("atom" != frac_type) {
     frac_sign = "-";
   }
 
   // iterate through frac map
-  // This is an awkward pre-C++11 way to put an int to a string
-  std::ostringstream oss;
-  for(pyne::comp_iter i = fracs.begin(); i != fracs.end(); ++i) {
+  for(std::map<int, double>::const_iterator i = fracs.begin();
+      i != fracs.end(); ++i) {
     if (i->second > 0.0) {
-      // Clear first
-      std::stringstream ss;
-      std::string nucmcnp;
-      std::string table_item;
-      ss << pyne::nucname::mcnp(i->first);
-      nucmcnp = ss.str();
-
       int mcnp_id;
       mcnp_id = pyne::nucname::mcnp(i->first);
+      std::string table_item;
       // Spaces are important for tests
-      table_item = metadata["table_ids"][nucmcnp].asString();
+      table_item = metadata["table_ids"][std::to_string(mcnp_id)].asString();
       if (!table_item.empty()) {
         oss << "     " << mcnp_id << "." << table_item << " ";
       } else {
         oss << "     " << mcnp_id << " ";
       }
       // The int needs a little formatting
-      std::stringstream fs;
-      fs << std::setprecision(4) << std::scientific << frac_sign << i->second << std::endl;
-      oss << fs.str();
+      oss << std::setprecision(4) << std::scientific << frac_sign << i->second
+          << "\n";
+      oss.flags(std::ios::dec | std::ios::skipws);
     }
   }
-  return oss.str();
 }
 
 
@@ -976,18 +1704,23 @@ bool pyne::Material::not_fluka_builtin(std::string fluka_name) {
 ///---------------------------------------------------------------------------//
 /// Main external call
 std::string pyne::Material::fluka(int id, std::string frac_type) {
-  std::stringstream rs;
+  std::ostringstream rs;
+  fluka(rs, id, frac_type);
+  return rs.str();
+}
+
+void pyne::Material::fluka(std::ostream& rs, int id, std::string frac_type) {
+  pyne::StreamFormatSaver saver (rs);
 
   // Element, one nucid
   if (comp.size() == 1) {
-    rs << fluka_material_str(id);
+    fluka_material_str(rs, id);
   } else if (comp.size() > 1) {
   // Compound
-    rs << fluka_compound_str(id, frac_type);
+    fluka_compound_str(rs, id, frac_type);
   } else {
-    rs << "There is no nuclide information in the Material Object" << std::endl;
+    rs << "There is no nuclide information in the Material Object" << "\n";
   }
-  return rs.str();
 }
 
 ///---------------------------------------------------------------------------//
@@ -1001,7 +1734,12 @@ std::string pyne::Material::fluka(int id, std::string frac_type) {
 /// read out of a UW^2-tagged geometry file, and thus does not have
 /// certain metadata.
 std::string pyne::Material::fluka_material_str(int id) {
-  std::stringstream ms;
+  std::ostringstream ms;
+  fluka_material_str(ms, id);
+  return ms.str();
+}
+
+void pyne::Material::fluka_material_str(std::ostream& ms, int id) {
   std::string fluka_name; // needed to determine if built-in
 
   int nucid = comp.begin()->first;
@@ -1013,17 +1751,16 @@ std::string pyne::Material::fluka_material_str(int id) {
     if (comp.size() > 1 ) {
       std::cerr << "Error: this mix is a compound, there should be a fluka_name defined."
                 << std::endl;
-      return ms.str();
+      return;
     }
     fluka_name = nucname::fluka(nucid);
   }
 
   if (not_fluka_builtin(fluka_name)) {
-    ms << fluka_material_component(id, nucid, fluka_name);
+    fluka_material_component(ms, id, nucid, fluka_name);
   }
 
   // could be empty
-  return ms.str();
 }
 
 ///---------------------------------------------------------------------------//
@@ -1035,6 +1772,14 @@ std::string pyne::Material::fluka_material_str(int id) {
 /// material-ized components of compounds
 std::string pyne::Material::fluka_material_component(int fid, int nucid,
                                                std::string fluka_name) {
+  std::ostringstream cs;
+  fluka_material_component(cs, fid, nucid, fluka_name);
+  return cs.str();
+}
+
+void pyne::Material::fluka_material_component(std::ostream& cs, int fid,
+                                              int nucid,
+                                              std::string fluka_name) {
   int znum = pyne::nucname::znum(nucid);
 
   double atomic_mass;
@@ -1045,7 +1790,7 @@ std::string pyne::Material::fluka_material_component(int fid, int nucid,
     atomic_mass = 1.0;
   }
 
-  return fluka_material_line(znum, atomic_mass, fid, fluka_name);
+  fluka_material_line(cs, znum, atomic_mass, fid, fluka_name);
 }
 
 ///---------------------------------------------------------------------------//
@@ -1054,28 +1799,34 @@ std::string pyne::Material::fluka_material_component(int fid, int nucid,
 /// Given all the info, return the Material string
 std::string pyne::Material::fluka_material_line(int znum, double atomic_mass,
                                           int fid, std::string fluka_name) {
-  std::stringstream ls;
+  std::ostringstream ls;
+  fluka_material_line(ls, znum, atomic_mass, fid, fluka_name);
+  return ls.str();
+}
+
+void pyne::Material::fluka_material_line(std::ostream& ls, int znum,
+                                         double atomic_mass, int fid,
+                                         std::string fluka_name) {
+  pyne::StreamFormatSaver saver (ls);
 
   if (metadata.isMember("comments") ) {
      std::string comment = metadata["comments"].asString();
      ls << "* " << comment;
-     ls << std::endl;
+     ls << "\n";
   }
   ls << std::setw(10) << std::left << "MATERIAL";
   ls << std::setprecision(0) << std::fixed << std::showpoint <<
         std::setw(10) << std::right << (float)znum;
 
-  ls << fluka_format_field(atomic_mass);
+  fluka_format_field(ls, atomic_mass);
   // Note this is the current object density, and may or may not be meaningful
-  ls << fluka_format_field(std::sqrt(density*density));
+  fluka_format_field(ls, std::sqrt(density*density));
 
   ls << std::setprecision(0) << std::fixed << std::showpoint <<
         std::setw(10) << std::right << (float)fid;
   ls << std::setw(10) << std::right << "";
   ls << std::setw(10) << std::right << "";
-  ls << std::setw(10) << std::left << fluka_name << std::endl;
-
-  return ls.str();
+  ls << std::setw(10) << std::left << fluka_name << "\n";
 }
 
 ///---------------------------------------------------------------------------//
@@ -1087,7 +1838,13 @@ std::string pyne::Material::fluka_material_line(int znum, double atomic_mass,
 /// 999.123 -> 999.123
 /// 999.1234 -> 999.123
 std::string pyne::Material::fluka_format_field(float field) {
-  std::stringstream ls;
+  std::ostringstream ls;
+  fluka_format_field(ls, field);
+  return ls.str();
+}
+
+void pyne::Material::fluka_format_field(std::ostream& ls, float field) {
+  pyne::StreamFormatSaver saver (ls);
   double intpart;
   modf (field, &intpart);
   if (field == intpart) {
@@ -1100,8 +1857,6 @@ std::string pyne::Material::fluka_format_field(float field) {
     ls.precision(6);
     ls << std::setw(10) << std::right << field;
   }
-
-  return ls.str();
 }
 
 ///---------------------------------------------------------------------------//
@@ -1111,7 +1866,14 @@ std::string pyne::Material::fluka_format_field(float field) {
 /// -- MATERIAL line for compound
 /// -- COMPOUND lines
 std::string pyne::Material::fluka_compound_str(int id, std::string frac_type) {
-  std::stringstream ss;
+  std::ostringstream ss;
+  fluka_compound_str(ss, id, frac_type);
+  return ss.str();
+}
+
+void pyne::Material::fluka_compound_str(std::ostream& ss, int id,
+                                        std::string frac_type) {
+  pyne::StreamFormatSaver saver (ss);
   std::map<double, std::string> frac_name_map;
   std::string compound_string = "";
   std::vector<std::string> material_names;
@@ -1127,7 +1889,7 @@ std::string pyne::Material::fluka_compound_str(int id, std::string frac_type) {
     std::cerr << "Error:  metadata \"fluka_name\" expected." << std::endl;
     compound_name = "NotFound";
   }
-  ss << fluka_material_line(znum, atomic_mass, id, compound_name);
+  fluka_material_line(ss, znum, atomic_mass, id, compound_name);
 
   std::string frac_sign;
   if ("atom" == frac_type) {
@@ -1166,7 +1928,7 @@ std::string pyne::Material::fluka_compound_str(int id, std::string frac_type) {
     temp_s.str("");
 
     ss << std::setw(10) << std::left << compound_name;
-    ss << std::endl;
+    ss << "\n";
 
     counter -= 3;
   }
@@ -1194,10 +1956,8 @@ std::string pyne::Material::fluka_compound_str(int id, std::string frac_type) {
     ss << std::setw(10) << std::right << "";
     ss << std::setw(10) << std::right << "";
     ss << std::setw(10) << std::left << compound_name;
-    ss << std::endl;
+    ss << "\n";
     }
-
-  return ss.str();
 }
 
 
@@ -1340,10 +2100,8 @@ void pyne::Material::from_json(std::string filename) {
   f.seekg(0, std::ios::beg);
   f.read(&s[0], s.size());
   f.close();
-  Json::Reader reader;
-  Json::Value json;
-  reader.parse(s, json);
-  load_json(json);
+  Json::EventReader reader (s.data(), s.data() + s.size());
+  load_json(reader);
 }
 
 
@@ -1364,6 +2122,179 @@ void pyne::Material::write_json(std::string filename) {
 }
 
 
+// Throws on a reader error or an event other than the one expected
+static void expect_json_event(Json::EventReader& reader,
+                              Json::EventReader::Event event,
+                              Json::EventReader::Event expected) {
+  if (event == Json::EventReader::eventError)
+    throw std::invalid_argument("invalid JSON material: " +
+                                reader.getFormattedErrorMessages());
+  if (event != expected)
+    throw std::invalid_argument("unexpected JSON in material");
+}
+
+// Reads a number member of a material JSON object as Value::asDouble() does
+static double json_event_double(Json::EventReader& reader) {
+  Json::EventReader::Event event = reader.next();
+  if (event == Json::EventReader::eventNumber)
+    return reader.number();
+  if (event == Json::EventReader::eventBoolean)
+    return reader.boolean() ? 1.0 : 0.0;
+  if (event == Json::EventReader::eventNull)
+    return 0.0;
+  expect_json_event(reader, event, Json::EventReader::eventNumber);
+  return 0.0;
+}
+
+
+void pyne::Material::load_json(Json::EventReader& reader) {
+  typedef Json::EventReader JR;
+  // the nuclide ids of composition keys, which repeat between materials
+  static thread_local std::map<std::string, int> key_ids;
+  static thread_local std::vector<std::pair<int, double> > entries;
+  comp.clear();
+  mass = 0.0;
+  density = 0.0;
+  atoms_per_molecule = 0.0;
+  metadata = Json::Value();
+  expect_json_event(reader, reader.next(), JR::eventObjectBegin);
+  JR::Event event;
+  while ((event = reader.next()) == JR::eventKey) {
+    const std::string& key = reader.text();
+    if (key == "comp") {
+      expect_json_event(reader, reader.next(), JR::eventObjectBegin);
+      entries.clear();
+      while ((event = reader.next()) == JR::eventKey) {
+        std::map<std::string, int>::iterator it = key_ids.find(reader.text());
+        if (it == key_ids.end())
+          it = key_ids.insert(std::make_pair(reader.text(),
+                                             nucname::id(reader.text()))).first;
+        int nuc = it->second;
+        entries.push_back(std::make_pair(nuc, json_event_double(reader)));
+      }
+      expect_json_event(reader, event, JR::eventObjectEnd);
+      // the map is built in one pass from the entries sorted by id, the last
+      // of repeated ids winning as with comp[id] = value
+      std::stable_sort(entries.begin(), entries.end(),
+                       [](const std::pair<int, double>& a,
+                          const std::pair<int, double>& b) {
+                         return a.first < b.first;
+                       });
+      for (size_t i = 0; i < entries.size(); i++)
+        if (i + 1 == entries.size() || entries[i].first != entries[i+1].first)
+          comp.insert(comp.end(), entries[i]);
+    } else if (key == "mass") {
+      mass = json_event_double(reader);
+    } else if (key == "density") {
+      density = json_event_double(reader);
+    } else if (key == "atoms_per_molecule") {
+      atoms_per_molecule = json_event_double(reader);
+    } else if (key == "metadata") {
+      if (!reader.readValue(metadata))
+        expect_json_event(reader, JR::eventError, JR::eventObjectEnd);
+    } else if (!reader.skipValue()) {
+      expect_json_event(reader, JR::eventError, JR::eventObjectEnd);
+    }
+  }
+  expect_json_event(reader, event, JR::eventObjectEnd);
+  norm_comp();
+}
+
+
+void pyne::Material::dump_json(Json::CompactStreamWriter& writer) {
+  // the names of the nuclides, which repeat between materials
+  static thread_local std::map<int, std::string> names;
+  writer.beginObject();
+  writer.key("atoms_per_molecule");
+  writer.value(atoms_per_molecule);
+  writer.key("comp");
+  writer.beginObject();
+  for (comp_iter i = comp.begin(); i != comp.end(); i++) {
+    std::map<int, std::string>::iterator name = names.find(i->first);
+    if (name == names.end())
+      name = names.insert(std::make_pair(i->first,
+                                         nucname::name(i->first))).first;
+    writer.key(name->second);
+    writer.value(i->second);
+  }
+  writer.endObject();
+  writer.key("density");
+  writer.value(density);
+  writer.key("mass");
+  writer.value(mass);
+  writer.key("metadata");
+  writer.value(metadata);
+  writer.endObject();
+}
+
+
+// Reads the file at filename into s
+static void read_json_file(const std::string& filename, std::string& s) {
+  if (!pyne::file_exists(filename))
+    throw pyne::FileNotFound(filename);
+  std::ifstream f (filename.c_str(), std::ios::in | std::ios::binary);
+  f.seekg(0, std::ios::end);
+  s.resize(f.tellg());
+  f.seekg(0, std::ios::beg);
+  f.read(&s[0], s.size());
+}
+
+
+void pyne::read_json_library(const char* begin, const char* end,
+                             std::vector<std::string>& names,
+                             std::vector<Material>& mats) {
+  typedef Json::EventReader JR;
+  JR reader (begin, end);
+  names.clear();
+  mats.clear();
+  expect_json_event(reader, reader.next(), JR::eventObjectBegin);
+  JR::Event event;
+  while ((event = reader.next()) == JR::eventKey) {
+    names.push_back(reader.text());
+    mats.push_back(Material());
+    mats.back().load_json(reader);
+  }
+  expect_json_event(reader, event, JR::eventObjectEnd);
+  expect_json_event(reader, reader.next(), JR::eventEndOfStream);
+}
+
+
+void pyne::read_json_library(std::string filename,
+                             std::vector<std::string>& names,
+                             std::vector<Material>& mats) {
+  std::string s;
+  read_json_file(filename, s);
+  read_json_library(s.data(), s.data() + s.size(), names, mats);
+}
+
+
+void pyne::write_json_library(std::ostream& os,
+                              const std::vector<std::string>& names,
+                              std::vector<Material>& mats) {
+  if (names.size() != mats.size())
+    throw std::invalid_argument("the numbers of names and materials differ");
+  Json::CompactStreamWriter writer (os);
+  writer.beginObject();
+  for (size_t i = 0; i < mats.size(); i++) {
+    writer.key(names[i]);
+    mats[i].dump_json(writer);
+  }
+  writer.endObject();
+  os << "\n";
+}
+
+
+void pyne::write_json_library(std::string filename,
+                              const std::vector<std::string>& names,
+                              std::vector<Material>& mats) {
+  std::ofstream f (filename.c_str(), std::ios::out | std::ios::trunc |
+                                     std::ios::binary);
+  if (!f)
+    throw pyne::FileNotFound(filename);
+  write_json_library(f, names, mats);
+}
+
+
 /************************/
 /*** Public Functions ***/
 /************************/
@@ -1433,6 +2364,24 @@ pyne::Material::Material(std::string filename, double m, double d, double apm,
 }
 
 
+pyne::Material::Material(const Material& other)
+  : comp(other.comp), mass(other.mass), density(other.density),
+    atoms_per_molecule(other.atoms_per_molecule), metadata(other.metadata) {
+  PYNE_COUNT(COUNT_MATERIAL_COPIES);
+}
+
+
+pyne::Material& pyne::Material::operator=(const Material& other) {
+  PYNE_COUNT(COUNT_MATERIAL_COPIES);
+  comp = other.comp;
+  mass = other.mass;
+  density = other.density;
+  atoms_per_molecule = other.atoms_per_molecule;
+  metadata = other.metadata;
+  return *this;
+}
+
+
 pyne::Material::~Material() {
 }
 
@@ -1467,67 +2416,72 @@ pyne::comp_map pyne::Material::mult_by_mass() {
   if (mass == 1.0)
     return comp;
 
+  // entries arrive in order, so each insert is at the end hint
   pyne::comp_map cm;
   for (pyne::comp_iter i = comp.begin(); i != comp.end(); i++) {
-    cm[i->first] = (i->second) * mass;
+    cm.insert(cm.end(), std::make_pair(i->first, (i->second) * mass));
   }
   return cm;
 }
 
 
 pyne::comp_map pyne::Material::activity() {
+  pyne::NucPropertyTable& props = pyne::nuc_property_table;
   pyne::comp_map act;
   double masspermole = mass * pyne::N_A;
   for (pyne::comp_iter i = comp.begin(); i != comp.end(); ++i) {
-    act[i->first] = masspermole * (i->second) * decay_const(i->first) / \
-                    atomic_mass(i->first);
+    int k = props.ordinal(i->first);
+    act.insert(act.end(), std::make_pair(i->first, masspermole * (i->second) *
+                                         props.decay_const(k) /
+                                         props.atomic_mass(k)));
   }
   return act;
 }
 
 
 pyne::comp_map pyne::Material::decay_heat() {
+  pyne::NucPropertyTable& props = pyne::nuc_property_table;
   pyne::comp_map dh;
   double masspermole = mass * pyne::N_A;
   for (pyne::comp_iter i = comp.begin(); i != comp.end(); ++i) {
-    dh[i->first] = masspermole * (i->second) * \
-                   decay_const(metastable_id(i->first,nucname::snum(i->first))) * \
-                   q_val(i->first) / atomic_mass(i->first) / pyne::MeV_per_MJ;
+    int k = props.ordinal(i->first);
+    dh.insert(dh.end(), std::make_pair(i->first, masspermole * (i->second) *
+                                       props.metastable_decay_const(k) *
+                                       props.q_val(k) / props.atomic_mass(k) /
+                                       pyne::MeV_per_MJ));
   }
   return dh;
 }
 
 
 pyne::comp_map pyne::Material::dose_per_g(std::string dose_type, int source) {
+  pyne::NucPropertyTable& props = pyne::nuc_property_table;
   pyne::comp_map dose;
   const double pCi_per_Bq = 27.027027;
+  pyne::DoseKind kind;
+  double units;
   if (dose_type == "ext_air") {
-    for (pyne::comp_iter i = comp.begin(); i != comp.end(); ++i) {
-      dose[i->first] = Ci_per_Bq * pyne::N_A * (i->second) * \
-                       decay_const(i->first) * ext_air_dose(i->first, source) / \
-                       atomic_mass(i->first);
-    }
+    kind = pyne::EXT_AIR_DOSE;
+    units = Ci_per_Bq;
   } else if (dose_type == "ext_soil") {
-    for (pyne::comp_iter i = comp.begin(); i != comp.end(); ++i) {
-      dose[i->first] = Ci_per_Bq * pyne::N_A * (i->second) * \
-                       decay_const(i->first) * ext_soil_dose(i->first, source) / \
-                       atomic_mass(i->first);
-    }
+    kind = pyne::EXT_SOIL_DOSE;
+    units = Ci_per_Bq;
   } else if (dose_type == "ingest") {
-    for (pyne::comp_iter i = comp.begin(); i != comp.end(); ++i) {
-      dose[i->first] = pCi_per_Bq * pyne::N_A * (i->second) * \
-                       decay_const(i->first) * ingest_dose(i->first, source) / \
-                       atomic_mass(i->first);
-    }
+    kind = pyne::INGEST_DOSE;
+    units = pCi_per_Bq;
   } else if (dose_type == "inhale") {
-    for (pyne::comp_iter i = comp.begin(); i != comp.end(); ++i) {
-      dose[i->first] = pCi_per_Bq * pyne::N_A * (i->second) * \
-                       decay_const(i->first) * inhale_dose(i->first, source) / \
-                       atomic_mass(i->first);
-    }
+    kind = pyne::INHALE_DOSE;
+    units = pCi_per_Bq;
   } else {
     throw std::invalid_argument("Dose type must be one of: ext_air, ext_soil, ingest, inhale.");
   }
+  for (pyne::comp_iter i = comp.begin(); i != comp.end(); ++i) {
+    int k = props.ordinal(i->first);
+    dose.insert(dose.end(), std::make_pair(i->first, units * pyne::N_A *
+                                           (i->second) * props.decay_const(k) *
+                                           props.dose(k, kind, source) /
+                                           props.atomic_mass(k)));
+  }
   return dose;
 }
 
@@ -1536,8 +2490,9 @@ double pyne::Material::molecular_mass(double apm) {
   // Calculate the atomic weight of the Material
   double inverseA = 0.0;
 
+  pyne::NucPropertyTable& props = pyne::nuc_property_table;
   for (pyne::comp_iter nuc = comp.begin(); nuc != comp.end(); nuc++)
-    inverseA += (nuc->second) / pyne::atomic_mass(nuc->first);
+    inverseA += (nuc->second) / props.atomic_mass(props.ordinal(nuc->first));
 
   if (inverseA == 0.0)
     return inverseA;
@@ -1555,50 +2510,78 @@ double pyne::Material::molecular_mass(double apm) {
 }
 
 
+namespace {
+
+// The natural isotopes of an element, as expand_elements() substitutes them
+struct NaturalIsotopes {
+  NaturalIsotopes() : listed(false), keep_id(-1), mass(0.0) {};
+  bool listed;  // whether natural_abund_map has any entry of this Z number
+  int keep_id;  // element id listed with zero abundance, which stays as-is
+  double mass;  // atomic mass of the element
+  std::vector<int> nucs;
+  std::vector<double> abunds;
+  std::vector<double> masses;  // atomic masses of nucs
+};
+
+std::vector<NaturalIsotopes> build_natural_isotopes() {
+  // any lookup fills the map through the guard of its loader
+  pyne::natural_abund(10010000);
+  std::vector<NaturalIsotopes> table;
+  std::map<int, double>::iterator it;
+  for (it = pyne::natural_abund_map.begin();
+       it != pyne::natural_abund_map.end(); it++) {
+    int z = pyne::nucname::znum(it->first);
+    if (table.size() <= (size_t) z)
+      table.resize(z + 1);
+    NaturalIsotopes& iso = table[z];
+    if (!iso.listed) {
+      iso.listed = true;
+      iso.mass = pyne::atomic_mass(z * 10000000);
+    }
+    if (0 != pyne::nucname::anum(it->first) && 0.0 != it->second) {
+      iso.nucs.push_back(it->first);
+      iso.abunds.push_back(it->second);
+      iso.masses.push_back(pyne::atomic_mass(it->first));
+    } else if (0 == pyne::nucname::anum(it->first) && 0.0 == it->second) {
+      iso.keep_id = it->first;
+    }
+  }
+  return table;
+}
+
+// The natural isotopes of each Z number, built once from natural_abund_map
+const std::vector<NaturalIsotopes>& natural_isotopes() {
+  static const std::vector<NaturalIsotopes> table = build_natural_isotopes();
+  return table;
+}
+
+}  // namespace
+
+
 pyne::Material pyne::Material::expand_elements(std::set<int> exception_ids) {
-  // Expands the natural elements of a material and returns a new material note
-  // that this implementation relies on the fact that maps of ints are stored in
-  // a sorted manner in C++.
-  int n, nabund, znuc, zabund;
+  // Expands the natural elements of a material and returns a new material.
+  // The isotopes of each element come from a table built once, rather than
+  // from a walk of natural_abund_map per call.
+  const std::vector<NaturalIsotopes>& table = natural_isotopes();
   comp_map newcomp;
-  std::map<int, double>::iterator abund_itr, abund_end;
-  if (pyne::natural_abund_map.empty())
-    pyne::_load_atomic_mass_map();
-  abund_itr = pyne::natural_abund_map.begin();
-  abund_end = pyne::natural_abund_map.end();
-  zabund = nucname::znum((*abund_itr).first);
   for (comp_iter nuc = comp.begin(); nuc != comp.end(); nuc++) {
+    int n = nuc->first;
     // keep element as-is if in exception list
-    if (0 < exception_ids.count(nuc->first)) {
+    if (0 < exception_ids.count(n) || 0 != nucname::anum(n)) {
       newcomp.insert(*nuc);
       continue;
     }
-
-    if(abund_itr == abund_end)
+    int znuc = nucname::znum(n);
+    if (table.size() <= (size_t) znuc || !table[znuc].listed) {
       newcomp.insert(*nuc);
-    else if(0 == nucname::anum((*nuc).first)) {
-      n = (*nuc).first;
-      znuc = nucname::znum(n);
-      if (znuc < zabund) {
-        newcomp.insert(*nuc);
-        continue;
-      }
-      while(zabund <= znuc) {
-        nabund = (*abund_itr).first;
-        zabund = nucname::znum(nabund);
-
-        if (zabund == znuc && 0 != nucname::anum(nabund) && 0.0 != (*abund_itr).second)
-          newcomp[nabund] = (*abund_itr).second * (*nuc).second * \
-                            atomic_mass(nabund) / atomic_mass(n);
-        else if (n == nabund && 0.0 == (*abund_itr).second)
-          newcomp.insert(*nuc);
-        abund_itr++;
-        if (abund_itr == abund_end) {
-          zabund = INT_MAX;
-          break;
-        }
-      }
-    } else
+      continue;
+    }
+    const NaturalIsotopes& iso = table[znuc];
+    double mass_n = (n == znuc * 10000000) ? iso.mass : atomic_mass(n);
+    for (size_t i = 0; i < iso.nucs.size(); i++)
+      newcomp[iso.nucs[i]] = iso.abunds[i] * (*nuc).second * iso.masses[i] / \
+                             mass_n;
+    if (n == iso.keep_id)
       newcomp.insert(*nuc);
   }
   return Material(newcomp, mass, density, atoms_per_molecule, metadata);
@@ -1644,15 +2627,15 @@ pyne::Material pyne::Material::collapse_elements(std::set<int> exception_ids) {
     if (0 < ptr->second) {
       // There is a nonzero amount of this nucid in the current material,
       // check if znum and anum are in the exception list,
-      int cur_stripped_id = nucname::znum(ptr->first) * 10000000 +
-                            nucname::anum(ptr->first) * 10000;
+      int nucid = nucname::id(ptr->first);
+      int znum_id = (nucid / 10000000) * 10000000;
+      int cur_stripped_id = (nucid / 10000) * 10000;
       if (0 < exception_ids.count(cur_stripped_id)) {
         // The znum/anum combination identify the current material as a
         // fluka-named exception list => copy, don't collapse
         cm[ptr->first] = (ptr->second) * mass;
       } else {
         // Not on exception list => add frac to id-component
-        int znum_id = nucname::id(nucname::znum(ptr->first));
         cm[znum_id] += (ptr->second) * mass;
       }
     }
@@ -1677,6 +2660,47 @@ pyne::Material pyne::Material::collapse_elements(int** int_ptr_arry) {
 }
 
 
+void pyne::expand_elements(std::vector<Material>& mats,
+                           const std::set<int>& exception_ids,
+                           int num_threads) {
+  // the isotope table and the atomic masses of the elements are looked up
+  // before threads start, so that the parallel section only reads them
+  natural_isotopes();
+  for (size_t k = 0; k < mats.size(); k++) {
+    comp_iter nuc;
+    for (nuc = mats[k].comp.begin(); nuc != mats[k].comp.end(); nuc++)
+      if (0 == nucname::anum(nuc->first))
+        atomic_mass(nuc->first);
+  }
+  int num_mats = mats.size();
+#ifdef _OPENMP
+  if (num_threads < 1)
+    num_threads = omp_get_max_threads();
+#else
+  num_threads = 1;
+#endif
+  #pragma omp parallel for schedule(dynamic, 16) num_threads(num_threads)
+  for (int k = 0; k < num_mats; k++)
+    mats[k] = mats[k].expand_elements(exception_ids);
+}
+
+
+void pyne::collapse_elements(std::vector<Material>& mats,
+                             const std::set<int>& exception_ids,
+                             int num_threads) {
+  int num_mats = mats.size();
+#ifdef _OPENMP
+  if (num_threads < 1)
+    num_threads = omp_get_max_threads();
+#else
+  num_threads = 1;
+#endif
+  #pragma omp parallel for schedule(dynamic, 16) num_threads(num_threads)
+  for (int k = 0; k < num_mats; k++)
+    mats[k] = mats[k].collapse_elements(exception_ids);
+}
+
+
 // Set up atom or mass frac map
 std::map<int, double> pyne::Material::get_density_frac(std::string frac_type,
                                                        bool mult_den) {
@@ -1722,16 +2746,55 @@ double pyne::Material::number_density(double mass_dens, double apm) {
 }
 
 
+/*--- Nuclide Group Masks ---*/
+pyne::z_mask pyne::z_range_mask(int lower, int upper) {
+  pyne::z_mask zs;
+  for (int z = std::max(lower, 0); z < upper && z < (int) zs.size(); z++)
+    zs.set(z);
+  return zs;
+}
+
+
+pyne::z_mask pyne::z_group_mask(const std::set<int>& zs) {
+  pyne::z_mask mask;
+  for (std::set<int>::const_iterator z = zs.begin(); z != zs.end(); z++)
+    if (0 <= *z && *z < (int) mask.size())
+      mask.set(*z);
+  return mask;
+}
+
+
+const pyne::z_mask pyne::LAN_MASK = pyne::z_range_mask(57, 72);
+const pyne::z_mask pyne::ACT_MASK = pyne::z_range_mask(89, 104);
+const pyne::z_mask pyne::TRU_MASK = pyne::z_range_mask(93, 256);
+const pyne::z_mask pyne::MA_MASK = pyne::z_range_mask(93, 104).reset(94);
+const pyne::z_mask pyne::FP_MASK = pyne::z_range_mask(0, 89);
+
+
+namespace {
+
+// Whether the Z number of id form nuclide nuc is in zs
+inline bool in_z_mask(const pyne::z_mask& zs, int nuc) {
+  return 0 <= nuc && zs[nuc / 10000000];
+}
+
+}  // namespace
+
+
 /*--- Stub-Stream Computation ---*/
 pyne::Material pyne::Material::sub_mat(std::set<int> nucset) {
   // Grabs a sub-material from this mat based on a set of integers.
   // Integers can either be of id form -OR- they can be a z-numer (is 8 for O,
   // 93 for Np, etc).
 
+  // both are sorted, so a single merge walk finds the common nuclides
   pyne::comp_map cm;
+  std::set<int>::const_iterator n = nucset.begin();
   for (pyne::comp_iter i = comp.begin(); i != comp.end(); i++) {
-    if (0 < nucset.count(i->first))
-      cm[i->first] = (i->second) * mass;
+    while (n != nucset.end() && *n < i->first)
+      n++;
+    if (n != nucset.end() && *n == i->first)
+      cm.insert(cm.end(), std::make_pair(i->first, (i->second) * mass));
   }
   return pyne::Material(cm, -1, -1);
 }
@@ -1786,10 +2849,13 @@ pyne::Material pyne::Material::del_mat(std::set<int> nucset) {
   // n is the name of the new material.
 
   pyne::comp_map cm;
+  std::set<int>::const_iterator n = nucset.begin();
   for (pyne::comp_iter i = comp.begin(); i != comp.end(); i++) {
+    while (n != nucset.end() && *n < i->first)
+      n++;
     // Only add to new comp if not in nucset
-    if ( 0 == nucset.count(i->first) )
-      cm[i->first] = (i->second) * mass;
+    if (n == nucset.end() || *n != i->first)
+      cm.insert(cm.end(), std::make_pair(i->first, (i->second) * mass));
   }
   return pyne::Material(cm, -1, -1);
 }
@@ -1818,7 +2884,7 @@ pyne::Material pyne::Material::sub_range(int lower, int upper) {
   pyne::comp_map cm;
   for (pyne::comp_iter i = comp.begin(); i != comp.end(); i++) {
     if ((lower <= (i->first)) && ((i->first) < upper))
-      cm[i->first] = (i->second) * mass;
+      cm.insert(cm.end(), std::make_pair(i->first, (i->second) * mass));
   }
   return pyne::Material(cm, -1,-1);
 }
@@ -1854,12 +2920,80 @@ pyne::Material pyne::Material::del_range(int lower, int upper) {
   pyne::comp_map cm;
   for (pyne::comp_iter i = comp.begin(); i != comp.end(); i++) {
     if ((upper <= (i->first)) || ((i->first) < lower))
-      cm[i->first] = (i->second) * mass;
+      cm.insert(cm.end(), std::make_pair(i->first, (i->second) * mass));
+  }
+  return pyne::Material(cm, -1, -1);
+}
+
+
+pyne::Material pyne::Material::sub_mask(const z_mask& zs) {
+  // Grabs a sub-material from this mat based on the Z numbers of its nuclides.
+  pyne::comp_map cm;
+  for (pyne::comp_iter i = comp.begin(); i != comp.end(); i++) {
+    if (in_z_mask(zs, i->first))
+      cm.insert(cm.end(), std::make_pair(i->first, (i->second) * mass));
+  }
+  return pyne::Material(cm, -1, -1);
+}
+
+
+pyne::Material pyne::Material::del_mask(const z_mask& zs) {
+  // Removes a sub-material from this mat based on the Z numbers of its
+  // nuclides.
+  pyne::comp_map cm;
+  for (pyne::comp_iter i = comp.begin(); i != comp.end(); i++) {
+    if (!in_z_mask(zs, i->first))
+      cm.insert(cm.end(), std::make_pair(i->first, (i->second) * mass));
   }
   return pyne::Material(cm, -1, -1);
 }
 
 
+std::vector<double> pyne::Material::group_masses(
+    const std::vector<z_mask>& masks) {
+  std::vector<double> masses(masks.size(), 0.0);
+  for (pyne::comp_iter i = comp.begin(); i != comp.end(); i++) {
+    if (i->first < 0)
+      continue;
+    int z = i->first / 10000000;
+    for (size_t g = 0; g < masks.size(); g++)
+      if (masks[g][z])
+        masses[g] += (i->second) * mass;
+  }
+  return masses;
+}
+
+
+std::vector<double> pyne::Material::group_masses(
+    const std::vector<std::set<int> >& zgroups) {
+  std::vector<z_mask> masks;
+  masks.reserve(zgroups.size());
+  for (size_t g = 0; g < zgroups.size(); g++)
+    masks.push_back(z_group_mask(zgroups[g]));
+  return group_masses(masks);
+}
+
+
+std::vector<pyne::Material> pyne::Material::partition(
+    const std::vector<z_mask>& masks) {
+  std::vector<pyne::comp_map> cms(masks.size());
+  for (pyne::comp_iter i = comp.begin(); i != comp.end(); i++) {
+    if (i->first < 0)
+      continue;
+    int z = i->first / 10000000;
+    for (size_t g = 0; g < masks.size(); g++)
+      if (masks[g][z])
+        cms[g].insert(cms[g].end(), std::make_pair(i->first,
+                                                   (i->second) * mass));
+  }
+  std::vector<pyne::Material> parts;
+  parts.reserve(masks.size());
+  for (size_t g = 0; g < masks.size(); g++)
+    parts.push_back(pyne::Material(cms[g], -1, -1));
+  return parts;
+}
+
+
 pyne::Material pyne::Material::sub_elem(int elem) {
   // Returns a material of the element that is a submaterial of this one.
   return sub_range(elem, elem + 10000000);
@@ -1868,31 +3002,31 @@ pyne::Material pyne::Material::sub_elem(int elem) {
 
 pyne::Material pyne::Material::sub_lan() {
   // Returns a material of Lanthanides that is a sub-material of this one.
-  return sub_range(570000000, 720000000);
+  return sub_mask(LAN_MASK);
 }
 
 
 pyne::Material pyne::Material::sub_act() {
   //Returns a material of Actindes that is a sub-material of this one.
-  return sub_range(890000000, 1040000000);
+  return sub_mask(ACT_MASK);
 }
 
 
 pyne::Material pyne::Material::sub_tru() {
   // Returns a material of Transuranics that is a sub-material of this one.
-  return sub_range(930000000, INT_MAX);
+  return sub_mask(TRU_MASK);
 }
 
 
 pyne::Material pyne::Material::sub_ma() {
   // Returns a material of Minor Actinides that is a sub-material of this one.
-  return sub_range(930000000, 1040000000).del_range(940000000, 950000000);
+  return sub_mask(MA_MASK);
 }
 
 
 pyne::Material pyne::Material::sub_fp() {
   // Returns a material of Fission Products that is a sub-material of this one.
-  return sub_range(0, 890000000);
+  return sub_mask(FP_MASK);
 }
 
 
@@ -1992,6 +3126,19 @@ std::vector<std::pair<double, double> > pyne::Material::photons(bool norm) {
 }
 
 
+std::vector<double> pyne::Material::photon_source(
+    const std::vector<double>& e_bounds, bool norm) {
+  // the binner of the last group structure is kept for the next calls
+  static thread_local std::unique_ptr<PhotonGroups> groups;
+  if (!groups || groups->bounds() != e_bounds)
+    groups.reset(new PhotonGroups(e_bounds));
+  groups->load(*this);
+  std::vector<double> src (groups->num_groups());
+  groups->source(*this, src.data(), norm);
+  return src;
+}
+
+
 std::vector<std::pair<double, double> > pyne::Material::normalize_radioactivity(
     std::vector<std::pair<double, double> > unnormed) {
   std::vector<std::pair<double, double> > normed;
@@ -2008,6 +3155,41 @@ std::vector<std::pair<double, double> > pyne::Material::normalize_radioactivity(
   return normed;
 }
 
+// Fills the columns of a series from the nt by ncols row-major amounts of the
+// nuclides ids, keeping the nuclides that are present at some time, and adds
+// the constant amounts of the nuclides in passed.
+static void fill_series(pyne::MaterialSeries& series, int nt, int ncols,
+                        const int* ids, const double* amounts,
+                        const pyne::comp_map& passed) {
+  std::vector<std::pair<int, int> > cols;  // nuclide id and source column
+  for (int i = 0; i < ncols; i++) {
+    for (int k = 0; k < nt; k++) {
+      if (amounts[(size_t) k * ncols + i] > 0.0) {
+        cols.push_back(std::make_pair(ids[i], i));
+        break;
+      }
+    }
+  }
+  for (pyne::comp_map::const_iterator it = passed.begin(); it != passed.end();
+       ++it)
+    cols.push_back(std::make_pair(it->first, -1));
+  std::sort(cols.begin(), cols.end());
+
+  size_t nc = cols.size();
+  series.nucs.resize(nc);
+  series.moles.assign(nt * nc, 0.0);
+  for (size_t c = 0; c < nc; c++) {
+    series.nucs[c] = cols[c].first;
+    int i = cols[c].second;
+    double value = i < 0 ? passed.find(cols[c].first)->second : 0.0;
+    for (int k = 0; k < nt; k++) {
+      if (0 <= i)
+        value = std::max(amounts[(size_t) k * ncols + i], 0.0);
+      series.moles[k * nc + c] = value;
+    }
+  }
+}
+
 
 #ifdef PYNE_DECAY
 pyne::Material pyne::Material::decay(double t) {
@@ -2017,10 +3199,49 @@ pyne::Material pyne::Material::decay(double t) {
   rtn.mass = mass * rtn.molecular_mass() / molecular_mass();
   return rtn;
 }
+
+std::vector<pyne::Material> pyne::Material::decay(
+    const std::vector<double>& ts) {
+  std::vector<comp_map> outs = pyne::decayers::decay(to_atom_frac(), ts);
+  double mw = molecular_mass();
+  std::vector<Material> rtn (outs.size());
+  for (size_t k = 0; k < outs.size(); k++) {
+    rtn[k].from_atom_frac(outs[k]);
+    rtn[k].mass = mass * rtn[k].molecular_mass() / mw;
+  }
+  return rtn;
+}
+
+pyne::MaterialSeries pyne::Material::decay_series(
+    const std::vector<double>& times) {
+  pyne::NucPropertyTable& props = pyne::nuc_property_table;
+  int n = pyne::decayers::num_nucs;
+  std::vector<double> x (n, 0.0);
+  comp_map passed;  // nuclides without decay chains, which are kept as is
+  for (comp_iter it = comp.begin(); it != comp.end(); ++it) {
+    double moles = mass * it->second /
+                   props.atomic_mass(props.ordinal(it->first));
+    int i = pyne::decayers::nuc_index(it->first);
+    if (i < 0)
+      passed[it->first] = moles;
+    else
+      x[i] += moles;
+  }
+  int nt = times.size();
+  std::vector<double> out ((size_t) nt * n);
+  pyne::decayers::decay(x.data(), nt, times.data(), out.data());
+  std::vector<int> ids (n);
+  for (int i = 0; i < n; i++)
+    ids[i] = nucname::state_id_to_id(pyne::decayers::all_nucs[i]);
+  MaterialSeries series;
+  series.times = times;
+  fill_series(series, nt, n, ids.data(), out.data(), passed);
+  return series;
+}
 #endif //  PYNE_DECAY
 
 
-pyne::Material pyne::Material::cram(std::vector<double> A,
+pyne::Material pyne::Material::cram(const std::vector<double>& A,
                                     const int order) {
   Material rtn;
   rtn.from_atom_frac(pyne::transmuters::cram(A, to_atom_frac(), order));
@@ -2028,32 +3249,335 @@ pyne::Material pyne::Material::cram(std::vector<double> A,
   return rtn;
 }
 
+pyne::Material pyne::Material::cram(const std::vector<std::vector<double> >& A,
+                                    const std::vector<double>& dt,
+                                    const int order) {
+  if (A.size() != dt.size())
+    throw pyne::ValueError("One step length is required per CRAM step.");
+  pyne::transmuters::CramDepletion depletion (to_atom_frac(), order);
+  for (int s = 0; s < A.size(); s++)
+    depletion.step(A[s], dt[s]);
+  Material rtn;
+  rtn.from_atom_frac(depletion.get_comp());
+  rtn.mass = mass * rtn.molecular_mass() / molecular_mass();
+  return rtn;
+}
 
-pyne::Material pyne::Material::operator+ (double y) {
-  // Overloads x + y
-  return pyne::Material(comp, mass + y, density);
+pyne::MaterialSeries pyne::Material::cram_series(
+    const std::vector<double>& A, const std::vector<double>& times,
+    const int order) {
+  pyne::transmuters::CramMatrixBuilder builder (false);
+  int n = builder.size();
+  pyne::NucPropertyTable& props = pyne::nuc_property_table;
+  std::vector<double> x (n, 0.0);
+  for (comp_iter it = comp.begin(); it != comp.end(); ++it) {
+    int i = builder.index(it->first);
+    if (0 <= i)
+      x[i] = mass * it->second / props.atomic_mass(props.ordinal(it->first));
+  }
+
+  // each time is reached by a step from the previous one, with the solver of
+  // the last step length reused while the length stays the same, up to the
+  // rounding of times that are meant to be equally spaced
+  int nt = times.size();
+  std::vector<double> out ((size_t) nt * n);
+  std::vector<double> At (A.size());
+  std::unique_ptr<pyne::transmuters::CramSolver> solver;
+  double t = 0.0;
+  double dt = 0.0;
+  const double* b = x.data();
+  for (int k = 0; k < nt; k++) {
+    if (times[k] < t)
+      throw std::invalid_argument("CRAM series times must be non-negative "
+                                  "and non-decreasing.");
+    double* xk = &out[(size_t) k * n];
+    if (times[k] == t) {
+      std::copy(b, b + n, xk);
+    } else {
+      if (!solver || fabs(times[k] - t - dt) > 1e-12 * dt) {
+        dt = times[k] - t;
+        for (size_t j = 0; j < A.size(); j++)
+          At[j] = A[j] * dt;
+        solver.reset(new pyne::transmuters::CramSolver(At, order));
+      }
+      solver->solve(b, xk);
+    }
+    t = times[k];
+    b = xk;
+  }
+
+  std::vector<int> ids = pyne::transmuters::cram_nucids();
+  MaterialSeries series;
+  series.times = times;
+  fill_series(series, nt, n, ids.data(), out.data(), comp_map());
+  return series;
+}
+
+pyne::MaterialSeries pyne::Material::cram_series(
+    const std::vector<double>& times, const int order) {
+  pyne::transmuters::CramMatrixBuilder builder;
+  return cram_series(builder.assemble(std::vector<double>(), 1.0), times,
+                     order);
+}
+
+// Replaces the composition of a material by its transmuted one, the same way
+// Material::cram() builds a new material, but keeping density and metadata.
+static void transmute_in_place(pyne::Material& mat,
+                               pyne::transmuters::CramSolver& solver) {
+  double mw = mat.molecular_mass();
+  pyne::Material rtn;
+  rtn.from_atom_frac(solver.solve(mat.to_atom_frac()));
+  mat.mass = mat.mass * rtn.molecular_mass() / mw;
+  mat.atoms_per_molecule = rtn.atoms_per_molecule;
+  mat.comp.swap(rtn.comp);
+}
+
+// Fills the atomic mass caches for the nuclides of the materials, so that
+// threads working on them only read the caches.
+static void load_comp_atomic_masses(const std::vector<pyne::Material>& mats) {
+  pyne::NucPropertyTable& props = pyne::nuc_property_table;
+  for (int k = 0; k < mats.size(); k++) {
+    pyne::comp_map::const_iterator ci;
+    for (ci = mats[k].comp.begin(); ci != mats[k].comp.end(); ci++)
+      props.atomic_mass(props.ordinal(ci->first));
+  }
+}
+
+// Fills the atomic mass caches for every nuclide the threads may look up, so
+// that the parallel section of transmute_all() only reads them.
+static void load_atomic_masses(const std::vector<pyne::Material>& mats) {
+  pyne::NucPropertyTable& props = pyne::nuc_property_table;
+  std::vector<int> nucids = pyne::transmuters::cram_nucids();
+  for (int i = 0; i < nucids.size(); i++)
+    props.atomic_mass(props.ordinal(nucids[i]));
+  load_comp_atomic_masses(mats);
+}
+
+void pyne::transmute_all(std::vector<Material>& mats,
+                         const std::vector<double>& A, const int order) {
+  // checks A and order before any thread starts
+  pyne::transmuters::CramSolver proto (A, order);
+  load_atomic_masses(mats);
+  int num_mats = mats.size();
+  #pragma omp parallel
+  {
+    pyne::transmuters::CramSolver solver (proto);
+    #pragma omp for schedule(dynamic, 16)
+    for (int k = 0; k < num_mats; k++)
+      transmute_in_place(mats[k], solver);
+  }
+}
+
+void pyne::transmute_all(std::vector<Material>& mats,
+                         const pyne::transmuters::CramMatrixBuilder& builder,
+                         const std::vector<double>& rates, double dt,
+                         const int order) {
+  int nch = builder.num_channels();
+  if (rates.size() != (size_t) nch * mats.size())
+    throw pyne::ValueError("One set of reaction rates is required per "
+                           "material.");
+  pyne::transmuters::CramSolver proto (std::vector<double>(builder.nnz()),
+                                       order);
+  load_atomic_masses(mats);
+  int num_mats = mats.size();
+  #pragma omp parallel
+  {
+    pyne::transmuters::CramSolver solver (proto);
+    #pragma omp for schedule(dynamic, 16)
+    for (int k = 0; k < num_mats; k++) {
+      solver.assemble(builder, rates.data() + (size_t) k * nch, dt);
+      transmute_in_place(mats[k], solver);
+    }
+  }
 }
 
 
-pyne::Material pyne::Material::operator+ (Material y) {
-  // Overloads x + y
-  pyne::comp_map cm;
-  pyne::comp_map xwgt = mult_by_mass();
-  pyne::comp_map ywgt = y.mult_by_mass();
+pyne::PhotonGroups::PhotonGroups(const std::vector<double>& e_bounds)
+    : e_bounds(e_bounds) {
+  if (e_bounds.size() < 2)
+    throw std::invalid_argument("At least two photon group bounds are "
+                                "required.");
+  for (size_t g = 1; g < e_bounds.size(); g++) {
+    if (!(e_bounds[g - 1] < e_bounds[g]))
+      throw std::invalid_argument("Photon group bounds must be increasing.");
+  }
+}
 
-  for (pyne::comp_iter i = xwgt.begin(); i != xwgt.end(); i++) {
-    if ( 0 < ywgt.count(i->first) )
-      cm[i->first] = xwgt[i->first] + ywgt[i->first];
-    else
-      cm[i->first] = xwgt[i->first];
+void pyne::PhotonGroups::load(const Material& mat) {
+  for (comp_map::const_iterator it = mat.comp.begin(); it != mat.comp.end();
+       ++it)
+    spectrum(it->first);
+}
+
+const double* pyne::PhotonGroups::spectrum(int nuc) {
+  int ng = num_groups();
+  std::unordered_map<int, int>::const_iterator row = rows.find(nuc);
+  if (row != rows.end())
+    return &spectra[(size_t) row->second * ng];
+
+  int state_id = nuc % 10000 > 0 ? nucname::id_to_state_id(nuc) : nuc;
+  std::vector<std::pair<double, double> > lines = pyne::gammas(state_id);
+  std::vector<std::pair<double, double> > xray_lines = pyne::xrays(state_id);
+  lines.insert(lines.end(), xray_lines.begin(), xray_lines.end());
+  int r = rows.size();
+  spectra.resize((size_t) (r + 1) * ng, 0.0);
+  double* spec = &spectra[(size_t) r * ng];
+  for (size_t i = 0; i < lines.size(); i++) {
+    double e = lines[i].first;
+    if (isnan(lines[i].second) || e < e_bounds.front() || e_bounds.back() < e)
+      continue;
+    int g = std::upper_bound(e_bounds.begin(), e_bounds.end(), e) -
+            e_bounds.begin() - 1;
+    spec[std::min(g, ng - 1)] += lines[i].second;
+  }
+  rows[nuc] = r;
+  return spec;
+}
+
+void pyne::PhotonGroups::source(Material& mat, double* src, bool norm) const {
+  pyne::NucPropertyTable& props = pyne::nuc_property_table;
+  int ng = num_groups();
+  std::fill(src, src + ng, 0.0);
+  // intensities are weighted by atom fraction, as in Material::photons()
+  double mw = mat.molecular_mass();
+  for (comp_iter it = mat.comp.begin(); it != mat.comp.end(); ++it) {
+    std::unordered_map<int, int>::const_iterator row = rows.find(it->first);
+    if (row == rows.end())
+      throw std::out_of_range("Photon spectrum of " +
+                              pyne::to_str(it->first) + " was not loaded.");
+    double af = it->second * mw / props.atomic_mass(props.ordinal(it->first));
+    const double* spec = &spectra[(size_t) row->second * ng];
+    for (int g = 0; g < ng; g++)
+      src[g] += af * spec[g];
+  }
+  if (norm) {
+    double sum = 0.0;
+    for (int g = 0; g < ng; g++)
+      sum += src[g];
+    if (sum != 0.0) {
+      for (int g = 0; g < ng; g++)
+        src[g] /= sum;
+    }
   }
+}
 
-  for (pyne::comp_iter i = ywgt.begin(); i != ywgt.end(); i++) {
-    if ( 0 == cm.count(i->first) )
-      cm[i->first] = ywgt[i->first];
+std::vector<double> pyne::photon_sources(std::vector<Material>& mats,
+                                         const std::vector<double>& e_bounds,
+                                         bool norm, int num_threads) {
+  // the spectra and atomic masses are all looked up before threads start, so
+  // that the parallel section only reads them
+  PhotonGroups groups (e_bounds);
+  for (size_t k = 0; k < mats.size(); k++)
+    groups.load(mats[k]);
+  load_comp_atomic_masses(mats);
+  int ng = groups.num_groups();
+  int num_mats = mats.size();
+  std::vector<double> src ((size_t) num_mats * ng);
+#ifdef _OPENMP
+  if (num_threads < 1)
+    num_threads = omp_get_max_threads();
+#else
+  num_threads = 1;
+#endif
+  #pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads)
+  for (int k = 0; k < num_mats; k++)
+    groups.source(mats[k], &src[(size_t) k * ng], norm);
+  return src;
+}
+
+
+// Writes the cards of mats to os, as card(mat, k, stream) formats the k-th
+// one. In parallel, rounds of num_threads chunks of materials are formatted
+// into one buffer per chunk by the OpenMP threads, and each round is written
+// in order before the next starts.
+template <typename F>
+static void write_cards(std::ostream& os, std::vector<pyne::Material>& mats,
+                        int num_threads, F card) {
+  int num_mats = mats.size();
+  if (num_threads < 1) {
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#else
+    num_threads = 1;
+#endif
+  }
+  if (num_threads == 1 || num_mats <= 1) {
+    for (int k = 0; k < num_mats; k++)
+      card(mats[k], k, os);
+    return;
   }
 
-  return pyne::Material(cm, -1, -1);
+  const int chunk_size = 64;
+  load_comp_atomic_masses(mats);
+  std::vector<std::string> chunks (num_threads);
+  std::vector<std::exception_ptr> errors (num_threads);
+  for (int start = 0; start < num_mats; start += chunk_size * num_threads) {
+    int num_chunks = std::min(num_threads,
+                              (num_mats - start + chunk_size - 1) / chunk_size);
+    #pragma omp parallel for num_threads(num_threads) schedule(static, 1)
+    for (int c = 0; c < num_chunks; c++) {
+      try {
+        std::ostringstream oss;
+        int end = std::min(num_mats, start + (c + 1) * chunk_size);
+        for (int k = start + c * chunk_size; k < end; k++)
+          card(mats[k], k, oss);
+        chunks[c] = oss.str();
+      } catch (...) {
+        errors[c] = std::current_exception();
+      }
+    }
+    for (int c = 0; c < num_chunks; c++) {
+      if (errors[c])
+        std::rethrow_exception(errors[c]);
+      os << chunks[c];
+    }
+  }
+}
+
+void pyne::write_mcnp(std::ostream& os, std::vector<Material>& mats,
+                      std::string frac_type, bool mult_den, int num_threads) {
+  write_cards(os, mats, num_threads,
+              [&frac_type, mult_den](Material& mat, int /*k*/, std::ostream& s) {
+                mat.mcnp(s, frac_type, mult_den);
+              });
+}
+
+void pyne::write_mcnp(std::string filename, std::vector<Material>& mats,
+                      std::string frac_type, bool mult_den, int num_threads) {
+  std::ofstream f (filename.c_str(), std::ios::out | std::ios::app);
+  if (!f)
+    throw pyne::FileNotFound(filename);
+  write_mcnp(f, mats, frac_type, mult_den, num_threads);
+}
+
+void pyne::write_fluka(std::ostream& os, std::vector<Material>& mats,
+                       int first_id, std::string frac_type, int num_threads) {
+  write_cards(os, mats, num_threads,
+              [&frac_type, first_id](Material& mat, int k, std::ostream& s) {
+                mat.fluka(s, first_id + k, frac_type);
+              });
+}
+
+void pyne::write_fluka(std::string filename, std::vector<Material>& mats,
+                       int first_id, std::string frac_type, int num_threads) {
+  std::ofstream f (filename.c_str(), std::ios::out | std::ios::app);
+  if (!f)
+    throw pyne::FileNotFound(filename);
+  write_fluka(f, mats, first_id, frac_type, num_threads);
+}
+
+
+pyne::Material pyne::Material::operator+ (double y) {
+  // Overloads x + y
+  return pyne::Material(comp, mass + y, density);
+}
+
+
+pyne::Material pyne::Material::operator+ (Material y) {
+  // Overloads x + y, as one linear merge of the mass weighted compositions
+  pyne::CompVector cm = pyne::comp_merge(pyne::CompVector(comp), mass,
+                                         pyne::CompVector(y.comp), y.mass);
+  return pyne::Material(cm.to_map(), -1, -1);
 }
 
 
@@ -2069,6 +3593,61 @@ pyne::Material pyne::Material::operator/ (double y) {
 }
 
 
+void pyne::MaterialMixer::add(const Material& mat, double weight) {
+  double scale = weight * mat.mass;
+  for (comp_map::const_iterator it = mat.comp.begin(); it != mat.comp.end();
+       ++it)
+    nucs.push_back(std::make_pair(it->first, scale * it->second));
+  total += scale;
+  // keeps the buffer within a few times the number of distinct nuclides
+  if (4 * merged + 256 < nucs.size())
+    merge();
+}
+
+
+void pyne::MaterialMixer::merge() {
+  std::sort(nucs.begin(), nucs.end(),
+            [](const std::pair<int, double>& a, const std::pair<int, double>& b)
+            {return a.first < b.first;});
+  size_t n = 0;
+  for (size_t i = 0; i < nucs.size(); i++) {
+    if (0 < n && nucs[n - 1].first == nucs[i].first)
+      nucs[n - 1].second += nucs[i].second;
+    else
+      nucs[n++] = nucs[i];
+  }
+  nucs.resize(n);
+  merged = n;
+}
+
+
+pyne::Material pyne::MaterialMixer::material() {
+  merge();
+  comp_map cm;
+  for (size_t i = 0; i < nucs.size(); i++)
+    cm.insert(cm.end(), nucs[i]);
+  return Material(cm, -1, -1);
+}
+
+
+void pyne::MaterialMixer::clear() {
+  total = 0.0;
+  nucs.clear();
+  merged = 0;
+}
+
+
+pyne::Material pyne::mix(const std::vector<const Material*>& mats,
+                         const std::vector<double>& weights) {
+  if (mats.size() != weights.size())
+    throw std::invalid_argument("One weight is required per material.");
+  MaterialMixer mixer;
+  for (size_t i = 0; i < mats.size(); i++)
+    mixer.add(*mats[i], weights[i]);
+  return mixer.material();
+}
+
+
 bool pyne::detect_nuclidelist(hid_t data_set, std::string& nucpath){
   hid_t nuc_attr = H5Aopen(data_set, "nucpath", H5P_DEFAULT);
 
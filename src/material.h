@@ -8,11 +8,14 @@
 #ifndef PYNE_MR34UE5INRGMZK2QYRDWICFHVM
 #define PYNE_MR34UE5INRGMZK2QYRDWICFHVM
 
+#include <bitset>
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <sstream>	// std::ostringstream
@@ -25,8 +28,10 @@
   #define PYNE_DECAY
 #include "json-forwards.h"
 #include "json.h"
+#include "jsoncustomwriter.h"
 #include "h5wrap.h"
 #include "utils.h"
+#include "comp_vector.h"
 #include "nucname.h"
 #include "data.h"
 #include "decay.h"
@@ -34,13 +39,35 @@
 
 namespace pyne
 {
+  namespace transmuters {
+    class CramMatrixBuilder;
+  }
+
   // Set Type Definitions
   typedef std::map<int, double> comp_map; ///< Nuclide-mass composition map type
   typedef comp_map::iterator comp_iter;   ///< Nuclide-mass composition iter type
 
+  /// Dense set of Z numbers, the elements of a nuclide group. Z numbers of id
+  /// form nuclides range up to 214, the Z of INT_MAX.
+  typedef std::bitset<256> z_mask;
+
+  /// Returns the mask of the Z numbers in [\a lower, \a upper).
+  z_mask z_range_mask(int lower, int upper);
+  /// Returns the mask of the Z numbers in \a zs, e.g. nucname::act.
+  z_mask z_group_mask(const std::set<int>& zs);
+  /// Masks of the standard nuclide groups, as used by Material::sub_lan(),
+  /// sub_act(), sub_tru(), sub_ma() and sub_fp().
+  extern const z_mask LAN_MASK;  ///< lanthanides, 57 <= Z < 72
+  extern const z_mask ACT_MASK;  ///< actinides, 89 <= Z < 104
+  extern const z_mask TRU_MASK;  ///< transuranics, 93 <= Z
+  extern const z_mask MA_MASK;   ///< minor actinides, the actinides from Np but Pu
+  extern const z_mask FP_MASK;   ///< fission products, Z < 89
+
   #ifdef PYNE_IS_AMALGAMATED
   namespace decayers {
-    extern comp_map decay(comp_map, double);
+    extern comp_map decay(const comp_map&, double);
+    extern std::vector<comp_map> decay(const comp_map&,
+                                       const std::vector<double>&);
   }  // namespace decayers
   #endif
 
@@ -65,6 +92,9 @@ namespace pyne
 
   static int FLUKA_MAT_NUM = 37;
 
+  class MaterialSeries;
+  class PhotonGroups;
+
   /// Material composed of nuclides.
   class Material
   {
@@ -114,6 +144,10 @@ namespace pyne
     ///          may be overridden by the value from disk.
     Material(std::string filename, double m=-1.0, double d=-1.0, double apm=-1.0,
              Json::Value attributes=Json::Value(Json::objectValue));
+    /// Copy constructor, counted by the instrumentation (see instrument.h)
+    Material(const Material& other);
+    /// Copy assignment, counted by the instrumentation
+    Material& operator=(const Material& other);
     ~Material (); ///< default destructor
 
     /// Normalizes the mass values in the composition.
@@ -168,10 +202,15 @@ namespace pyne
     ///     - "0": datapath and/or "/material" exist but either as a group or a dataset
     ///     - "1": datapath exists as a dataset -> old layout
     ///     - "2": "/material" exists as a group-> new layout
-    int detect_hdf5_layout(hid_t db, std::string datapath);
+    static int detect_hdf5_layout(hid_t db, std::string datapath);
 
     enum prot1_layout {path_donotexists=-1, unknown, old_layout, new_layout};
 
+    friend class MaterialTable;
+    friend void write_hdf5_rows(const std::vector<Material>& mats,
+                                std::string filename, std::string datapath,
+                                int chunksize, int deflate, bool shuffle);
+
   public:
 
     /// Writes this material out to an HDF5 file.
@@ -253,31 +292,49 @@ namespace pyne
 
     /// Return an mcnp input deck record as a string
     std::string mcnp(std::string frac_type = "mass", bool mult_den = true);
+    /// Writes the mcnp input deck record to \a os rather than to a string.
+    /// This and the other stream writers below leave the format of \a os as
+    /// they found it.
+    void mcnp(std::ostream& os, std::string frac_type = "mass",
+              bool mult_den = true);
     /// Return an phits input deck record as a string
     std::string phits(std::string frac_type = "mass", bool mult_den = true);
     /// return the compo fraction writen ala "mcnp"
     std::string mcnp_frac(std::map<int, double> fracs, std::string frac_type = "");
+    /// Writes the compo fraction ala "mcnp" to \a os
+    void mcnp_frac(std::ostream& os, const std::map<int, double>& fracs,
+                   std::string frac_type = "");
     ///
     /// Return an uwuw name
     std::string get_uwuw_name();
     ///
     /// Return a fluka input deck MATERIAL card as a string
     std::string fluka(int id, std::string frac_type = "mass");
+    /// Writes the fluka input deck MATERIAL card to \a os
+    void fluka(std::ostream& os, int id, std::string frac_type = "mass");
     /// Convenience function to tell whether a given name needs a material card
     bool not_fluka_builtin(std::string fluka_name);
     /// High level call to get details and call material_component(..)
     std::string fluka_material_str(int id);
+    void fluka_material_str(std::ostream& os, int id);
     /// Intermediate level call to prepare final info and call material_line(..)
     std::string fluka_material_component(int fid, int nucid,
                                          std::string fluka_name);
+    void fluka_material_component(std::ostream& os, int fid, int nucid,
+                                  std::string fluka_name);
     /// Format information into a FLUKA material card
     std::string fluka_material_line(int znum, double atomic_mass,
                               int fid, std::string fluka_name);
+    void fluka_material_line(std::ostream& os, int znum, double atomic_mass,
+                             int fid, std::string fluka_name);
     /// Convenience function to format a single fluka field
     std::string fluka_format_field(float field);
+    void fluka_format_field(std::ostream& os, float field);
     /// Return FLUKA compound card and the material card for the named compound
     /// but not the material cards of the components
     std::string fluka_compound_str(int id, std::string frac_type = "mass");
+    void fluka_compound_str(std::ostream& os, int id,
+                            std::string frac_type = "mass");
 
     /// Reads data from a plaintext file at \a filename into this Material instance.
     void from_text(char * filename);
@@ -301,6 +358,13 @@ namespace pyne
     void write_json(char * filename);
     /// Writes the Material out to a JSON file
     void write_json(std::string filename);
+    /// Reads the JSON object of a Material from \a reader, as load_json() does
+    /// with its tree, but with the composition read entry by entry without
+    /// building one. Only the metadata is read as a tree.
+    void load_json(Json::EventReader& reader);
+    /// Writes the Material as a compact JSON object to \a writer, with the
+    /// members of dump_json(), but without building the tree.
+    void dump_json(Json::CompactStreamWriter& writer);
 
     // Fundemental mass stream data
     /// composition, maps nuclides in id form to normalized mass weights.
@@ -341,6 +405,8 @@ namespace pyne
     comp_map dose_per_g(std::string dose_type, int source=0);
     /// Returns a copy of the current material where all natural elements in the
     /// composition are expanded to their natural isotopic abundances.
+    /// The isotopes of each element are taken from a table built once from
+    /// natural_abund_map on first use.
     Material expand_elements(std::set<int> exception_ids);
     // Wrapped version to facilitate calling from python
     Material expand_elements(int **int_ptr_arry = NULL);
@@ -398,6 +464,22 @@ namespace pyne
     /// Creates a new Material with the all nuclides in the id range removed.
     Material del_range(int lower=0, int upper=10000000);
 
+    /// Creates a sub-Material of the nuclides whose Z number is in \a zs.
+    Material sub_mask(const z_mask& zs);
+    /// Creates a new Material with the nuclides whose Z number is in \a zs
+    /// removed.
+    Material del_mask(const z_mask& zs);
+    /// Returns the mass of this material in each of the groups \a masks, in
+    /// one pass over the composition, e.g. the actinide and fission product
+    /// masses with {ACT_MASK, FP_MASK}. A nuclide counts towards every group
+    /// that holds its Z number.
+    std::vector<double> group_masses(const std::vector<z_mask>& masks);
+    /// Returns the mass of this material in each group of Z numbers \a zgroups.
+    std::vector<double> group_masses(const std::vector<std::set<int> >& zgroups);
+    /// Splits this material into one sub-Material per group of \a masks, in
+    /// one pass over the composition.
+    std::vector<Material> partition(const std::vector<z_mask>& masks);
+
     /// Creates a sub-Material of only the given element. Assumes element is
     /// id form.
     Material sub_elem(int element);
@@ -434,6 +516,15 @@ namespace pyne
     /// Returns a list of photon energies in keV and intensities in
     /// decays/s/atom material unnormalized
     std::vector<std::pair<double, double> > photons(bool norm);
+    /// Returns the photons() intensities binned into energy groups, with the
+    /// binned line spectra of the nuclides cached per group structure, see
+    /// PhotonGroups.
+    /// \param e_bounds The increasing group bounds [keV]
+    /// \param norm Whether the group intensities are normalized to sum to one
+    /// \return The e_bounds.size() - 1 group intensities [decays/s/atom
+    ///         material]
+    std::vector<double> photon_source(const std::vector<double>& e_bounds,
+                                      bool norm=false);
     /// Takes a list of photon energies and intensities and normalizes them
     /// so the sum of the intensities is one
     std::vector<std::pair<double, double> > normalize_radioactivity(
@@ -442,13 +533,46 @@ namespace pyne
 #ifdef PYNE_DECAY
     /// Decays this material for a given amount of time in seconds
     Material decay(double t);
+    /// Decays this material to each of the times \a ts in seconds, with the
+    /// exponentials of the decay chains evaluated once per time.
+    std::vector<Material> decay(const std::vector<double>& ts);
+    /// Decays this material to each of a series of times, without building a
+    /// Material per time.
+    /// \param times The cooling times [s]
+    /// \return The amounts of the nuclides at each time.
+    MaterialSeries decay_series(const std::vector<double>& times);
 #endif // PYNE_DECAY
 
     /// Transmutes the material via the CRAM method.
     /// \param A The transmutation matrix [unitless]
     /// \param order The CRAM approximation order (default 14).
     /// \return A new material which has been transmuted.
-    Material cram(std::vector<double> A, const int order=14);
+    Material cram(const std::vector<double>& A, const int order=14);
+    /// Transmutes the material via the CRAM method through a sequence of
+    /// steps. The nuclide vector stays dense in the CRAM index space between
+    /// steps and is only converted back to a material at the end.
+    /// \param A The flat rate matrices, one per step [1/s]
+    /// \param dt The step lengths [s]
+    /// \param order The CRAM approximation order (default 14).
+    /// \return A new material which has been transmuted.
+    Material cram(const std::vector<std::vector<double> >& A,
+                  const std::vector<double>& dt, const int order=14);
+    /// Transmutes the material via the CRAM method to each of a series of
+    /// times under a constant rate matrix. The composition is advanced from
+    /// one time to the next, and a solver is only set up again when the step
+    /// length changes by more than 1e-12 relative, so a series of equally
+    /// spaced times shares one even when their spacing is rounded.
+    /// \param A The flat rate matrix [1/s]
+    /// \param times The non-decreasing times [s]
+    /// \param order The CRAM approximation order (default 14).
+    /// \return The amounts of the nuclides at each time.
+    MaterialSeries cram_series(const std::vector<double>& A,
+                               const std::vector<double>& times,
+                               const int order=14);
+    /// Decays the material via the CRAM method to each of a series of times,
+    /// see above, with the decay rate matrix of the CRAM nuclides.
+    MaterialSeries cram_series(const std::vector<double>& times,
+                               const int order=14);
 
     // Overloaded Operators
     /// Adds mass to a material instance.
@@ -461,6 +585,372 @@ namespace pyne
     Material operator/ (double);
   };
 
+  /// Builder of a mixture of materials. The nuclide masses of the weighted
+  /// materials are accumulated into one buffer and the composition is
+  /// normalized once when the mixture is built, instead of one intermediate
+  /// material per constituent as with a chain of Material::operator+ calls.
+  class MaterialMixer {
+  public:
+    /// Empty mixture constructor
+    MaterialMixer() : total(0.0), merged(0) {};
+    /// Adds \a weight times \a mat, i.e. the nuclide masses of \a mat scaled
+    /// by \a weight, as mixture + mat * weight would.
+    void add(const Material& mat, double weight=1.0);
+    /// Returns the mass of the mixture so far.
+    double mass() const {return total;};
+    /// Builds the mixture, whose mass is the sum of the weighted masses, as
+    /// Material::operator+ gives it.
+    Material material();
+    /// Empties the mixture.
+    void clear();
+
+  private:
+    void merge();
+    double total; ///< Sum of the weighted masses
+    std::vector<std::pair<int, double> > nucs; ///< Nuclide masses
+    size_t merged; ///< Length of the sorted, merged prefix of nucs
+  };
+
+  /// Returns the mixture of \a mats weighted by \a weights, as the sum of
+  /// mats[i] * weights[i] with one buffer for the whole mixture, e.g. for the
+  /// homogenization of the cells of a mesh voxel.
+  Material mix(const std::vector<const Material*>& mats,
+               const std::vector<double>& weights);
+
+  /// Expands the natural elements of every material of a collection in place,
+  /// as Material::expand_elements() does, e.g. for a library of element-level
+  /// CAD materials. The materials are partitioned across \a num_threads
+  /// OpenMP threads, 0 for all available ones.
+  void expand_elements(std::vector<Material>& mats,
+                       const std::set<int>& exception_ids=std::set<int>(),
+                       int num_threads=1);
+  /// Collapses the isotopes of every material of a collection into their
+  /// elements in place, as Material::collapse_elements() does.
+  void collapse_elements(std::vector<Material>& mats,
+                         const std::set<int>& exception_ids=std::set<int>(),
+                         int num_threads=1);
+
+  /// Transmutes every material of a collection in place via the CRAM method,
+  /// e.g. all voxel materials of a mesh. The materials are partitioned across
+  /// OpenMP threads, when available, and each thread reuses one CRAM
+  /// workspace. Density and metadata of the materials are kept.
+  /// \param mats The materials to transmute
+  /// \param A The transmutation matrix shared by all materials [unitless]
+  /// \param order The CRAM approximation order (default 14).
+  void transmute_all(std::vector<Material>& mats, const std::vector<double>& A,
+                     const int order=14);
+  /// Transmutes every material of a collection in place via the CRAM method,
+  /// with its own reaction rates. Each thread assembles the matrix of a
+  /// material into its workspace just before solving, so no per-material
+  /// matrices are stored.
+  /// \param mats The materials to transmute
+  /// \param builder The assembler of the transmutation matrices
+  /// \param rates The builder.num_channels() reaction rates of each material,
+  ///        material k starting at element k*builder.num_channels() [1/s]
+  /// \param dt The length of the step [s]
+  /// \param order The CRAM approximation order (default 14).
+  void transmute_all(std::vector<Material>& mats,
+                     const transmuters::CramMatrixBuilder& builder,
+                     const std::vector<double>& rates, double dt,
+                     const int order=14);
+
+  /// Writes the mcnp input deck records of a collection of materials to
+  /// \a os in order, e.g. those of all voxels of a mesh, without holding
+  /// the deck in memory. With \a num_threads other than 1 the records are
+  /// formatted in chunks across OpenMP threads, when available, and the
+  /// chunks are written in order, so the text is the same.
+  /// \param os The stream to write to
+  /// \param mats The materials to write, as Material::mcnp() does
+  /// \param frac_type Either "mass" or "atom" fractions
+  /// \param mult_den Whether the fractions are multiplied by the density
+  /// \param num_threads The number of threads, 0 for all available ones
+  void write_mcnp(std::ostream& os, std::vector<Material>& mats,
+                  std::string frac_type="mass", bool mult_den=true,
+                  int num_threads=1);
+  /// Appends the mcnp input deck records of \a mats to the file at
+  /// \a filename, as write_mcnp() on a stream does.
+  void write_mcnp(std::string filename, std::vector<Material>& mats,
+                  std::string frac_type="mass", bool mult_den=true,
+                  int num_threads=1);
+  /// Writes the fluka input deck cards of a collection of materials to
+  /// \a os in order, the k-th material getting the id \a first_id + k, the
+  /// same way write_mcnp() writes the mcnp records.
+  /// \param os The stream to write to
+  /// \param mats The materials to write, as Material::fluka() does
+  /// \param first_id The fluka material id of the first material
+  /// \param frac_type Either "mass" or "atom" fractions
+  /// \param num_threads The number of threads, 0 for all available ones
+  void write_fluka(std::ostream& os, std::vector<Material>& mats,
+                   int first_id, std::string frac_type="mass",
+                   int num_threads=1);
+  /// Appends the fluka input deck cards of \a mats to the file at
+  /// \a filename, as write_fluka() on a stream does.
+  void write_fluka(std::string filename, std::vector<Material>& mats,
+                   int first_id, std::string frac_type="mass",
+                   int num_threads=1);
+
+  /// Reads a JSON library of materials, an object whose members are named
+  /// material objects as written by MaterialLibrary.write_json(), with
+  /// Material::load_json() on an event reader. Neither the document nor the
+  /// compositions are built as JSON trees.
+  /// \param begin Start of the JSON text
+  /// \param end End of the JSON text
+  /// \param names Filled with the names of the materials, in file order
+  /// \param mats Filled with the materials
+  void read_json_library(const char* begin, const char* end,
+                         std::vector<std::string>& names,
+                         std::vector<Material>& mats);
+  /// Reads the JSON library of materials in the file at \a filename into
+  /// \a names and \a mats.
+  void read_json_library(std::string filename, std::vector<std::string>& names,
+                         std::vector<Material>& mats);
+  /// Writes a JSON library of the materials \a mats named \a names to \a os
+  /// as one compact object, material by material, in a form read by
+  /// read_json_library().
+  void write_json_library(std::ostream& os,
+                          const std::vector<std::string>& names,
+                          std::vector<Material>& mats);
+  /// Writes the compact JSON library of \a mats named \a names to the file at
+  /// \a filename, replacing it.
+  void write_json_library(std::string filename,
+                          const std::vector<std::string>& names,
+                          std::vector<Material>& mats);
+
+  /// Writes materials as rows of a protocol 1 material table in an HDF5 file,
+  /// like calling Material::write_hdf5() on each of them with row=-0.0, but
+  /// with the table extended once and all rows and their metadata written
+  /// with one H5Dwrite each. Without an existing nuclide list, the list is
+  /// the union of the nuclides of \a mats. Files in the old layout fall back
+  /// to one Material::write_hdf5() call per material.
+  /// \param mats The materials to append.
+  /// \param filename Path on disk to the HDF5 file.
+  /// \param datapath Path to the the material table in the file.
+  /// \param chunksize The chunksize of new material datasets on disk.
+  /// \param deflate The deflate compression level of new datasets, 0 for no
+  ///        compression.
+  /// \param shuffle Whether new composition datasets use the shuffle filter,
+  ///        which usually improves the compression of floating point data.
+  void write_hdf5_rows(const std::vector<Material>& mats, std::string filename,
+                       std::string datapath="/mat_name", int chunksize=100,
+                       int deflate=1, bool shuffle=false);
+
+  /// Amounts of the nuclides of a material at a series of times, one row per
+  /// time and one column per nuclide, as returned by Material::decay_series()
+  /// and Material::cram_series(). The reductions work on the rows directly,
+  /// so a Material is only built for a time when material() is called.
+  class MaterialSeries {
+  public:
+    std::vector<double> times; ///< Times of the rows [s]
+    std::vector<int> nucs; ///< Nuclide ids of the columns, sorted
+    /// Row-major amounts, row k holding the nucs.size() amounts at times[k]
+    /// [mol, for a material mass in grams]
+    std::vector<double> moles;
+
+    /// Returns the number of times.
+    int size() const {return times.size();};
+    /// Returns the amounts at times[k].
+    const double* row(int k) const {return &moles[(size_t) k * nucs.size()];};
+    /// Returns the activities in the layout of moles, see
+    /// Material::activity() [Bq]
+    std::vector<double> activity() const;
+    /// Returns the decay heats in the layout of moles, see
+    /// Material::decay_heat() [MW]
+    std::vector<double> decay_heat() const;
+    /// Returns the photon energies and intensities at times[k], see
+    /// Material::photons().
+    std::vector<std::pair<double, double> > photons(int k,
+                                                    bool norm=false) const;
+    /// Builds the material at times[k], whose composition and mass are those
+    /// given by Material::decay() or Material::cram().
+    Material material(int k) const;
+  };
+
+  /// Photon line spectra of nuclides binned into one energy group structure.
+  /// The gamma and x-ray lines of a nuclide, as Material::photons() gathers
+  /// them, are binned the first time the nuclide is loaded and reused for
+  /// every material, so binning a material is one dense add per nuclide. A
+  /// line of energy E is in group g when e_bounds[g] <= E < e_bounds[g + 1],
+  /// the last group also holding its upper bound. Lines outside the bounds
+  /// and lines without a known intensity are dropped.
+  class PhotonGroups {
+  public:
+    /// \param e_bounds The increasing group bounds [keV]
+    PhotonGroups(const std::vector<double>& e_bounds);
+    /// Returns the number of groups.
+    int num_groups() const {return e_bounds.size() - 1;};
+    /// Returns the group bounds [keV]
+    const std::vector<double>& bounds() const {return e_bounds;};
+    /// Bins the lines of the nuclides of \a mat that were not loaded yet.
+    void load(const Material& mat);
+    /// Returns the num_groups() binned line intensities of nuclide \a nuc,
+    /// loading it if needed [decays/s/atom]
+    const double* spectrum(int nuc);
+    /// Writes the num_groups() group intensities of \a mat into \a src, see
+    /// Material::photon_source(). Every nuclide of \a mat must have been
+    /// loaded, so that this only reads the binner and may run concurrently.
+    void source(Material& mat, double* src, bool norm=false) const;
+
+  private:
+    std::vector<double> e_bounds; ///< Group bounds [keV]
+    std::unordered_map<int, int> rows; ///< Row of each loaded nuclide
+    std::vector<double> spectra; ///< Row-major binned spectra of the nuclides
+  };
+
+  /// Bins the photon sources of a collection of materials, e.g. the voxel
+  /// materials of an activated mesh, into one energy group structure. The
+  /// line spectra of the nuclides are binned once for all materials and the
+  /// materials are then partitioned across OpenMP threads, when available.
+  /// \param mats The materials
+  /// \param e_bounds The increasing group bounds [keV]
+  /// \param norm Whether the intensities of each material sum to one
+  /// \param num_threads The number of threads, 0 for all available ones
+  /// \return The group intensities of the materials, material k starting at
+  ///         element k*(e_bounds.size() - 1), the layout of a Sampler source
+  ///         density tag [decays/s/atom material]
+  std::vector<double> photon_sources(std::vector<Material>& mats,
+                                     const std::vector<double>& e_bounds,
+                                     bool norm=false, int num_threads=1);
+
+  /// Bulk reader of a protocol 1 material table in an HDF5 file. The file is
+  /// opened once and a range of rows is read with a single hyperslab read into
+  /// one contiguous buffer. The rows can be inspected in place, and materials
+  /// are only built from them when asked for.
+  class MaterialTable {
+  public:
+    /// Reads rows of a material table.
+    /// \param filename Path on disk to the HDF5 file.
+    /// \param datapath Path to the the material table in the file, with the same
+    ///        layout detection as Material::from_hdf5().
+    /// \param start The first row to read, may be negative.
+    /// \param count The number of rows to read, -1 for all rows from \a start.
+    MaterialTable(std::string filename, std::string datapath="/mat_name",
+                  int start=0, int count=-1);
+
+    /// Returns the number of rows read.
+    int size() const {return num_rows;};
+    /// Returns the nuclides of the composition columns.
+    const std::vector<int>& nuclides() const {return nucs;};
+    /// Returns the mass of row \a k.
+    double mass(int k) const {return buf[(size_t) k*row_size];};
+    /// Returns the density of row \a k.
+    double density(int k) const {return buf[(size_t) k*row_size + 1];};
+    /// Returns the atoms per molecule of row \a k.
+    double atoms_per_molecule(int k) const {
+      return buf[(size_t) k*row_size + 2];
+    };
+    /// Returns the nuclides().size() composition values of row \a k, a view
+    /// into the read buffer.
+    const double* comp(int k) const {return &buf[(size_t) k*row_size + 3];};
+    /// Builds the material of row \a k, as Material::from_hdf5() would.
+    Material material(int k) const;
+    /// Builds the materials of all rows.
+    std::vector<Material> materials() const;
+
+  private:
+    void read_rows(hid_t db, std::string datapath, std::string nucpath,
+                   int start, int count);
+    int num_rows; ///< Number of rows read
+    size_t row_size; ///< Number of doubles per row, 3 plus one per nuclide
+    std::vector<int> nucs; ///< Nuclides of the composition columns
+    std::vector<double> buf; ///< Rows of mass, density, apm, and composition
+    std::vector<std::string> meta; ///< JSON metadata of each row, if any
+  };
+
+  /// Version of the binary material library file format.
+  const unsigned int BINARY_LIBRARY_VERSION = 1;
+
+  /// Writes materials to a binary material library file, replacing it. The
+  /// file holds a header, the sorted union of the nuclides of \a mats, the
+  /// compositions in compressed sparse row form as indices into that table
+  /// and fractions, columns of mass, density and atoms per molecule, and the
+  /// metadata of each material as compact JSON. Every array is 8-byte
+  /// aligned so that BinaryMaterialLibrary can use it in place.
+  /// \param mats The materials to write, in order.
+  /// \param filename Path on disk to the file.
+  void write_binary_library(const std::vector<Material>& mats,
+                            std::string filename);
+
+  /// A material of a BinaryMaterialLibrary as pointers into the mapped file,
+  /// valid as long as the library is. Nothing is copied or parsed.
+  class MaterialView {
+  public:
+    /// Returns the number of nuclides in the composition.
+    int size() const {return num;};
+    /// Returns the id of the i-th nuclide of the composition.
+    int nuclide(int i) const {return nucs[index[i]];};
+    /// Returns the indices of the composition nuclides into the nuclide
+    /// table of the library, in increasing order.
+    const int32_t* indices() const {return index;};
+    /// Returns the mass fractions of the composition.
+    const double* fractions() const {return fracs;};
+    /// Returns the mass fraction of the i-th nuclide of the composition.
+    double fraction(int i) const {return fracs[i];};
+    double mass; ///< Material mass
+    double density; ///< Material density
+    double atoms_per_molecule; ///< Material atoms per molecule
+    /// Returns the metadata as compact JSON text, which is not terminated.
+    const char* metadata_json() const {return meta;};
+    /// Returns the length of metadata_json().
+    size_t metadata_size() const {return meta_size;};
+    /// Builds the Material, with its metadata parsed.
+    Material material() const;
+
+  private:
+    friend class BinaryMaterialLibrary;
+    int num; ///< Number of nuclides in the composition
+    const int32_t* nucs; ///< Nuclide table of the library
+    const int32_t* index; ///< Indices of the composition into nucs
+    const double* fracs; ///< Mass fractions of the composition
+    const char* meta; ///< Compact JSON metadata
+    size_t meta_size; ///< Length of meta
+  };
+
+  /// Read-only access to a binary material library file written by
+  /// write_binary_library(). The file is memory mapped and checked once on
+  /// opening, after which any material is found in constant time without
+  /// parsing, and the columns may be used in place. Libraries are only
+  /// readable on builds with the same byte order as the writer.
+  class BinaryMaterialLibrary {
+  public:
+    /// Maps the library \a filename and checks its layout. Throws
+    /// FileNotFound if it can't be opened and std::runtime_error if it is
+    /// not a valid library.
+    BinaryMaterialLibrary(std::string filename);
+    /// Returns the number of materials.
+    int size() const {return num_mats;};
+    /// Returns the number of nuclides in the nuclide table.
+    int num_nuclides() const {return num_nucs;};
+    /// Returns the sorted nuclide table.
+    const int32_t* nuclides() const {return nucs;};
+    /// Returns the column of masses.
+    const double* mass() const {return masses;};
+    /// Returns the column of densities.
+    const double* density() const {return densities;};
+    /// Returns the column of atoms per molecule.
+    const double* atoms_per_molecule() const {return apms;};
+    /// Returns a view of material \a k, throws std::out_of_range if there is
+    /// no such material.
+    MaterialView view(int k) const;
+    /// Builds material \a k, as view(k).material() does.
+    Material material(int k) const {return view(k).material();};
+
+  private:
+    BinaryMaterialLibrary(const BinaryMaterialLibrary&);
+    BinaryMaterialLibrary& operator=(const BinaryMaterialLibrary&);
+    MappedFile file; ///< Library contents
+    int num_mats; ///< Number of materials
+    int num_nucs; ///< Number of nuclides in the table
+    const int32_t* nucs; ///< Sorted nuclide table
+    const uint64_t* comp_ptr; ///< Start of each composition, num_mats + 1
+    const int32_t* comp_index; ///< Nuclide table indices of the compositions
+    const double* comp_frac; ///< Mass fractions of the compositions
+    const double* masses; ///< Mass column
+    const double* densities; ///< Density column
+    const double* apms; ///< Atoms per molecule column
+    const uint64_t* meta_ptr; ///< Start of each metadata text, num_mats + 1
+    const char* meta; ///< Metadata texts
+  };
+
   /// Converts a Material to a string stream representation for canonical writing.
   /// This operator is also defined on inheritors of std::ostream
   std::ostream& operator<< (std::ostream& os, Material mat);
@@ -24,6 +24,7 @@
  */
 
 #include <math.h>
+#include <vector>
 
 #ifndef PYNE_IS_AMALGAMATED
 #include "measure.h"
@@ -200,3 +201,105 @@ double measure( moab::EntityType type,
   }
 }
 
+// Number of elements measure_many gathers and computes at a time
+static const int MEASURE_BLOCK = 64;
+
+// Returns the volume of the tet (a, b, c, d) of each element of a block, whose
+// vertex coordinates are in px[vertex][element] etc.
+static inline double block_tet_volume( const double (*px)[MEASURE_BLOCK],
+                                       const double (*py)[MEASURE_BLOCK],
+                                       const double (*pz)[MEASURE_BLOCK],
+                                       int i, int a, int b, int c, int d )
+{
+  double ux = px[b][i] - px[a][i], uy = py[b][i] - py[a][i], uz = pz[b][i] - pz[a][i];
+  double vx = px[c][i] - px[a][i], vy = py[c][i] - py[a][i], vz = pz[c][i] - pz[a][i];
+  double wx = px[d][i] - px[a][i], wy = py[d][i] - py[a][i], wz = pz[d][i] - pz[a][i];
+  return 1./6. * ( (uy * vz - uz * vy) * wx +
+                   (uz * vx - ux * vz) * wy +
+                   (ux * vy - uy * vx) * wz );
+}
+
+// Measures the block of elements first to first + n - 1
+static void measure_block( moab::EntityType type,
+                           int num_vertices,
+                           size_t first,
+                           int n,
+                           const int* connectivity,
+                           const double* x,
+                           const double* y,
+                           const double* z,
+                           double* measures )
+{
+  double px[8][MEASURE_BLOCK], py[8][MEASURE_BLOCK], pz[8][MEASURE_BLOCK];
+  for (int i = 0; i < n; ++i)
+  {
+    for (int k = 0; k < num_vertices; ++k)
+    {
+      size_t slot = (first + i) * num_vertices + k;
+      size_t vtx = connectivity ? connectivity[slot] : slot;
+      px[k][i] = x[vtx];
+      py[k][i] = y[vtx];
+      pz[k][i] = z[vtx];
+    }
+  }
+
+  double* out = measures + first;
+  if (type == moab::MBTET)
+  {
+    #pragma omp simd
+    for (int i = 0; i < n; ++i)
+      out[i] = block_tet_volume( px, py, pz, i, 0, 1, 2, 3 );
+  }
+  else
+  {
+    // the same five tets as measure()
+    #pragma omp simd
+    for (int i = 0; i < n; ++i)
+      out[i] = block_tet_volume( px, py, pz, i, 0, 1, 3, 4 ) +
+               block_tet_volume( px, py, pz, i, 7, 3, 6, 4 ) +
+               block_tet_volume( px, py, pz, i, 4, 5, 1, 6 ) +
+               block_tet_volume( px, py, pz, i, 1, 6, 3, 4 ) +
+               block_tet_volume( px, py, pz, i, 2, 6, 3, 1 );
+  }
+}
+
+void measure_many( moab::EntityType type,
+                   int num_vertices,
+                   size_t num_elems,
+                   const int* connectivity,
+                   const double* x,
+                   const double* y,
+                   const double* z,
+                   double* measures )
+{
+  if (type != moab::MBTET && type != moab::MBHEX)
+  {
+    std::vector<double> coords(3 * num_vertices);
+    for (size_t e = 0; e < num_elems; ++e)
+    {
+      for (int k = 0; k < num_vertices; ++k)
+      {
+        size_t slot = e * num_vertices + k;
+        size_t vtx = connectivity ? connectivity[slot] : slot;
+        coords[3*k] = x[vtx];
+        coords[3*k + 1] = y[vtx];
+        coords[3*k + 2] = z[vtx];
+      }
+      measures[e] = measure( type, num_vertices, &coords[0] );
+    }
+    return;
+  }
+
+  num_vertices = (type == moab::MBTET) ? 4 : 8;
+  long num_blocks = (num_elems + MEASURE_BLOCK - 1) / MEASURE_BLOCK;
+  #pragma omp parallel for schedule(static) if(num_blocks > 64)
+  for (long b = 0; b < num_blocks; ++b)
+  {
+    size_t first = b * MEASURE_BLOCK;
+    int n = (num_elems - first < (size_t) MEASURE_BLOCK) ?
+            (int) (num_elems - first) : MEASURE_BLOCK;
+    measure_block( type, num_vertices, first, n, connectivity, x, y, z,
+                   measures );
+  }
+}
+
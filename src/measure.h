@@ -1,5 +1,7 @@
 #ifndef MEASURE_HPP
 
+#include <cstddef>
+
 #include "moab/CN.hpp"
 
 double edge_length( const double* start_vtx_coords,
@@ -9,5 +11,20 @@ double measure( moab::EntityType type,
                 int num_vertices,
                 const double* vertex_coordinatee );
 
+// Computes the measures of num_elems elements of one type into measures, as
+// measure() does for each. The vertex coordinates are given as separate x, y
+// and z arrays; vertex k of element e is connectivity[e*num_vertices + k], or
+// e*num_vertices + k when connectivity is NULL. Tets and hexes are computed
+// in vectorized blocks, over several threads for large inputs when built with
+// OpenMP; other types fall back to measure().
+void measure_many( moab::EntityType type,
+                   int num_vertices,
+                   size_t num_elems,
+                   const int* connectivity,
+                   const double* x,
+                   const double* y,
+                   const double* z,
+                   double* measures );
+
 #endif
 
@@ -421,6 +421,112 @@ bool pyne::nucname::isnuclide(int nuc) {
 
 
 
+/*********************************/
+/*** Element symbol hash table ***/
+/*********************************/
+
+// Element symbols indexed by Z
+static const char* element_symbols[119] = {"",
+  "H", "He", "Li", "Be", "B", "C", "N", "O", "F", "Ne", "Na", "Mg", "Al", "Si",
+  "P", "S", "Cl", "Ar", "K", "Ca", "Sc", "Ti", "V", "Cr", "Mn", "Fe", "Co",
+  "Ni", "Cu", "Zn", "Ga", "Ge", "As", "Se", "Br", "Kr", "Rb", "Sr", "Y", "Zr",
+  "Nb", "Mo", "Tc", "Ru", "Rh", "Pd", "Ag", "Cd", "In", "Sn", "Sb", "Te", "I",
+  "Xe", "Cs", "Ba", "La", "Ce", "Pr", "Nd", "Pm", "Sm", "Eu", "Gd", "Tb", "Dy",
+  "Ho", "Er", "Tm", "Yb", "Lu", "Hf", "Ta", "W", "Re", "Os", "Ir", "Pt", "Au",
+  "Hg", "Tl", "Pb", "Bi", "Po", "At", "Rn", "Fr", "Ra", "Ac", "Th", "Pa", "U",
+  "Np", "Pu", "Am", "Cm", "Bk", "Cf", "Es", "Fm", "Md", "No", "Lr", "Rf", "Db",
+  "Sg", "Bh", "Hs", "Mt", "Ds", "Rg", "Cn", "Nh", "Fl", "Mc", "Lv", "Ts", "Og"};
+
+static inline bool is_digit(char c) {return '0' <= c && c <= '9';}
+
+static inline bool is_letter(char c) {
+  return ('A' <= c && c <= 'Z') || ('a' <= c && c <= 'z');
+}
+
+static inline int letter_index(char c) {
+  return (c <= 'Z' ? c - 'A' : c - 'a');
+}
+
+// Slot of a one or two letter symbol in the symbol table, case insensitive.
+// Every symbol has its own slot, so the table is a perfect hash.
+static inline int symbol_slot(const char* s, size_t len) {
+  return letter_index(s[0]) * 27 + (len == 2 ? letter_index(s[1]) + 1 : 0);
+}
+
+// Returns the Z number of a one or two letter element symbol, or 0.
+static int symbol_to_z(const char* s, size_t len) {
+  struct SymbolTable {
+    unsigned char z[26 * 27];
+    SymbolTable() {
+      for (int i = 0; i < 26 * 27; i++)
+        z[i] = 0;
+      for (int i = 1; i < 119; i++) {
+        const char* sym = element_symbols[i];
+        z[symbol_slot(sym, sym[1] == '\0' ? 1 : 2)] = i;
+      }
+    };
+  };
+  static const SymbolTable table;
+  if (len < 1 || len > 2 || !is_letter(s[0]) || (len == 2 && !is_letter(s[1])))
+    return 0;
+  return table.z[symbol_slot(s, len)];
+}
+
+// Resolves the common string forms without allocating: integers, name form
+// with an optional dash and metastable flag, e.g. "Am-242m", NIST form, e.g.
+// "242Am", and bare element symbols. Returns false for anything else, which
+// is then left to the general parser.
+static bool fast_string_id(const char* s, size_t len, int& nucid) {
+  if (len == 0 || 12 < len)
+    return false;
+  size_t i = 0;
+  if (is_digit(s[0])) {
+    int anum = 0;
+    for (; i < len && is_digit(s[i]); i++)
+      anum = anum * 10 + (s[i] - '0');
+    if (i == len) {
+      if (9 < len)
+        return false;
+      nucid = pyne::nucname::id(anum);
+      return true;
+    }
+    int z = (i <= 3 ? symbol_to_z(s + i, len - i) : 0);
+    if (z == 0)
+      return false;
+    nucid = (10000000 * z) + (10000 * anum);
+    return true;
+  }
+
+  // name form
+  size_t nlet = (1 < len && is_letter(s[1])) ? 2 : 1;
+  int z = symbol_to_z(s, nlet);
+  if (z == 0)
+    return false;
+  i = nlet;
+  if (i == len) {
+    nucid = 10000000 * z;
+    return true;
+  }
+  if (s[i] == '-')
+    i++;
+  size_t digits_start = i;
+  int anum = 0;
+  for (; i < len && is_digit(s[i]) && i - digits_start < 3; i++)
+    anum = anum * 10 + (s[i] - '0');
+  if (i == digits_start)
+    return false;
+  int state = 0;
+  if (i < len && (s[i] == 'M' || s[i] == 'm')) {
+    state = 1;
+    i++;
+  }
+  if (i != len)
+    return false;
+  nucid = (10000000 * z) + (10000 * anum) + state;
+  return true;
+}
+
+
 /********************/
 /*** id functions ***/
 /********************/
@@ -513,14 +619,23 @@ int pyne::nucname::id(int nuc) {
 }
 
 int pyne::nucname::id(const char * nuc) {
-  std::string newnuc (nuc);
-  return id(newnuc);
+  return id(nuc, strlen(nuc));
+}
+
+int pyne::nucname::id(const char * nuc, size_t len) {
+  int nucid;
+  if (fast_string_id(nuc, len, nucid))
+    return nucid;
+  return id(std::string(nuc, len));
 }
 
 int pyne::nucname::id(std::string nuc) {
   size_t npos = std::string::npos;
   if (nuc.empty())
     throw NotANuclide(nuc, "<empty>");
+  int fast_nucid;
+  if (fast_string_id(nuc.c_str(), nuc.length(), fast_nucid))
+    return fast_nucid;
   int newnuc;
   std::string elem_name;
   int dash1 = nuc.find("-");
@@ -1464,23 +1579,29 @@ void pyne::nucname::_load_state_map(){
     }
 }
 
+namespace {
+// Returns the index of the first of the sorted map_nuc_ids that is not less
+// than state. The search halves a window of constant size each step, so the
+// comparison turns into a conditional move rather than a branch.
+inline int state_map_lower_bound(int state) {
+  const int* base = pyne::nucname::map_nuc_ids;
+  int n = TOTAL_STATE_MAPS;
+  while (n > 1) {
+    int half = n / 2;
+    base = (base[half] < state) ? base + half : base;
+    n -= half;
+  }
+  return (base - pyne::nucname::map_nuc_ids) + (*base < state);
+}
+}  // namespace
+
 int pyne::nucname::state_id_to_id(int state) {
   int zzzaaa = (state / 10000) * 10000;
   int state_number = state % 10000;
   if (state_number == 0) return state;
-  std::map<int, int>::iterator nuc_iter, nuc_end;
-
-  nuc_iter = state_id_map.find(state);
-  nuc_end = state_id_map.end();
-  if (nuc_iter != nuc_end){
-    int m = (*nuc_iter).second;
-    return zzzaaa + m;
-  }
-
-  if (state_id_map.empty())  {
-    _load_state_map();
-    return state_id_to_id(state);
-  }
+  int i = state_map_lower_bound(state);
+  if (i < TOTAL_STATE_MAPS && map_nuc_ids[i] == state)
+    return zzzaaa + map_metastable[i];
   return -1;
 }
 
@@ -1489,19 +1610,11 @@ int pyne::nucname::id_to_state_id(int nuc_id) {
   int zzzaaa = (nuc_id / 10000) * 10000;
   int state = nuc_id % 10000;
   if (state == 0) return nuc_id;
-  std::map<int, int>::iterator nuc_iter, nuc_end, it;
-
-  nuc_iter = state_id_map.lower_bound(zzzaaa);
-  nuc_end = state_id_map.upper_bound(zzzaaa + 9999);
-  for (it = nuc_iter; it!= nuc_end; ++it){
-    if (state == it->second) {
-      return it->first;
-    }
-  }
-
-  if (state_id_map.empty())  {
-    _load_state_map();
-    return id_to_state_id(nuc_id);
+  // the states of a nuclide are contiguous in map_nuc_ids
+  for (int i = state_map_lower_bound(zzzaaa);
+       i < TOTAL_STATE_MAPS && map_nuc_ids[i] <= zzzaaa + 9999; ++i) {
+    if (state == map_metastable[i])
+      return map_nuc_ids[i];
   }
   return -1;
 }
@@ -267,6 +267,22 @@ namespace nucname
   int id(int nuc);
   int id(const char * nuc);
   int id(std::string nuc);
+  /// Converts the \a len characters at \a nuc to id form, like
+  /// id(std::string), without copying them. The common name, NIST, and
+  /// integer forms, e.g. "U235", "Am-242m", "242Am", and "922350", resolve
+  /// without any allocation.
+  int id(const char * nuc, size_t len);
+  /// Returns \a nuc unchanged if it is already in id form, skipping the
+  /// form resolution and warnings of id(int); other forms are resolved by
+  /// id(int). Meant for hot loops whose input is canonical.
+  inline int id_fast(int nuc) {
+    int zzz = nuc / 10000000;
+    int aaa = (nuc % 10000000) / 10000;
+    if (0 < zzz && zzz <= 118 &&
+        ((zzz <= aaa && aaa <= zzz * 7) || nuc % 10000000 == 0))
+      return nuc;
+    return id(nuc);
+  };
   /// \}
 
   /// \name Name Form Functions
@@ -607,7 +623,10 @@ namespace nucname
   /// \{
   /// These convert from/to decay state ids (used in decay data)
   /// to metastable ids (the PyNE default). If the cooresponding value cannot
-  /// be found, -1 is returned.
+  /// be found, -1 is returned. Both search the sorted tables generated by
+  /// state_map.py in place, so nothing is built at run time.
+  /// _load_state_map() fills state_id_map from those tables, which the
+  /// conversions do not need.
   void _load_state_map();
   int state_id_to_id(int state);
   int id_to_state_id(int nuc_id);
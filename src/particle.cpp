@@ -85,11 +85,9 @@ int pyne::particle::_pdcids[NUM_PARTICLES] = {
   // charmed baryons
 };
 
-std::set<std::string> pyne::particle::names(pyne::particle::_names,
-              pyne::particle::_names+NUM_PARTICLES);
+std::set<std::string> pyne::particle::names;
 
-std::set<int> pyne::particle::pdc_nums(pyne::particle::_pdcids,
-                 pyne::particle::_pdcids+NUM_PARTICLES);
+std::set<int> pyne::particle::pdc_nums;
 
 std::map<std::string,int> pyne::particle::altnames;
 std::map<int,std::string> pyne::particle::id_name;
@@ -105,6 +103,9 @@ std::map<std::string,std::string> pyne::particle::part_to_geant4;
 void * pyne::particle::_fill_maps() {
   using std::make_pair;
 
+  names.insert(_names, _names + NUM_PARTICLES);
+  pdc_nums.insert(_pdcids, _pdcids + NUM_PARTICLES);
+
   std::string _docs[NUM_PARTICLES] = {
     // leptons
     "Electron",
@@ -253,10 +254,17 @@ void * pyne::particle::_fill_maps() {
   return NULL;
 }
 
-void * pyne::particle::filler = pyne::particle::_fill_maps();
+void * pyne::particle::filler = NULL;
+
+void pyne::particle::ensure_maps() {
+  // filled on first use rather than during static initialization
+  static void * filled = _fill_maps();
+  (void) filled;
+}
 
 // is hydrogen
 bool pyne::particle::is_hydrogen(int s) {
+  ensure_maps();
   if(s == name_id["Proton"])
     return true;
   if(pyne::particle::is_hydrogen(pyne::nucname::name(s)))
@@ -269,6 +277,7 @@ bool pyne::particle::is_hydrogen(char *s) {
 }
 
 bool pyne::particle::is_hydrogen(std::string s) {
+  ensure_maps();
   // check std name
   if(name_id[s] == name_id["Proton"])
     return true;
@@ -288,6 +297,7 @@ bool pyne::particle::is_heavy_ion(char *s) {
 }
 
 bool pyne::particle::is_heavy_ion(std::string s) {
+  ensure_maps();
   if(pyne::nucname::isnuclide(s)) {
     if(pyne::particle::is_hydrogen(s))
       return false;
@@ -299,6 +309,7 @@ bool pyne::particle::is_heavy_ion(std::string s) {
 
 // is valid functions
 bool pyne::particle::is_valid(int s) {
+  ensure_maps();
   if(pyne::nucname::isnuclide(s))
     return true;
   else
@@ -310,6 +321,7 @@ bool pyne::particle::is_valid(char *s) {
 }
 
 bool pyne::particle::is_valid(std::string s) {
+  ensure_maps();
   // check std name
   if(0 < names.count(s))
     return true;
@@ -325,6 +337,7 @@ bool pyne::particle::is_valid(std::string s) {
 
 // pdc functions
 int pyne::particle::id(int s) {
+  ensure_maps();
   if (0 < pdc_nums.count(s))
     return s;
   else
@@ -336,6 +349,7 @@ int pyne::particle::id(char *s) {
 }
 
 int pyne::particle::id(std::string s) {
+  ensure_maps();
   if(pyne::nucname::isnuclide(s))
     {
       if(pyne::particle::is_hydrogen(s))
@@ -353,6 +367,7 @@ int pyne::particle::id(std::string s) {
 
 // name functions
 std::string pyne::particle::name(int s) {
+  ensure_maps();
   if(s < 9999999)
     return pyne::particle::name(id_name[s]);
   if(pyne::nucname::isnuclide(s))
@@ -365,6 +380,7 @@ std::string pyne::particle::name(char *s) {
 }
 
 std::string pyne::particle::name(std::string s) {
+  ensure_maps();
   // check if is a hydrogen
   if(pyne::nucname::isnuclide(s))
     {
@@ -394,6 +410,7 @@ std::string pyne::particle::mcnp(char *s) {
 }
 
 std::string pyne::particle::mcnp(std::string s) {
+  ensure_maps();
   if(0 < part_to_mcnp.count(pyne::particle::name(s)))
     return part_to_mcnp[pyne::particle::name(s)];
   else
@@ -413,6 +430,7 @@ std::string pyne::particle::mcnp6(char *s) {
 }
 
 std::string pyne::particle::mcnp6(std::string s) {
+  ensure_maps();
   if(0 < part_to_mcnp6.count(pyne::particle::name(s)))
     return part_to_mcnp6[pyne::particle::name(s)];
   else
@@ -429,6 +447,7 @@ std::string pyne::particle::fluka(char *s) {
 }
 
 std::string pyne::particle::fluka(std::string s) {
+  ensure_maps();
   if (pyne::particle::is_heavy_ion(s))
     return "HEAVYION";
   else if(0 < part_to_fluka.count(pyne::particle::name(s)))
@@ -450,6 +469,7 @@ std::string pyne::particle::geant4(char *s) {
 }
 
 std::string pyne::particle::geant4(std::string s) {
+  ensure_maps();
   if (pyne::particle::is_heavy_ion(s))
     return "GenericIon";
   else if(0 < part_to_geant4.count(pyne::particle::name(s)))
@@ -464,6 +484,7 @@ std::string pyne::particle::geant4(std::string s) {
 
 // describe functions
 std::string pyne::particle::describe(int s) {
+  ensure_maps();
   if(pyne::nucname::isnuclide(s))
     return pyne::particle::describe(pyne::nucname::name(s));
   return pyne::particle::describe(id_name[s]);
@@ -474,6 +495,7 @@ std::string pyne::particle::describe(char *s) {
 }
 
 std::string pyne::particle::describe(std::string s) {
+  ensure_maps();
   // check if is a hydrogen
   if (pyne::nucname::isnuclide(s))
     {
@@ -160,7 +160,11 @@ namespace particle
 
   /// A helper function to set the contents of the variables in this library.
   void * _fill_maps();
-  extern void * filler;  ///< A dummy variable used when calling #_fill_maps().
+  /// Fills the variables of this library on the first call only. The
+  /// functions of this library call it themselves; code reading the
+  /// variables directly must call it first.
+  void ensure_maps();
+  extern void * filler;  ///< Unused, kept for compatibility; see ensure_maps().
 
 
   /// Custom excpeption for failed particle types
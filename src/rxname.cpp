@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <vector>
+
 #ifndef PYNE_IS_AMALGAMATED
 #include "rxname.h"
 #endif
@@ -578,8 +581,7 @@ std::string pyne::rxname::_names[NUM_RX_NAMES] = {
   "ec_3p",
   "bminus_sf"
   };
-std::set<std::string> pyne::rxname::names(pyne::rxname::_names,
-                                          pyne::rxname::_names+NUM_RX_NAMES);
+std::set<std::string> pyne::rxname::names;
 
 
 std::map<std::string, unsigned int> pyne::rxname::altnames;
@@ -596,6 +598,7 @@ void * pyne::rxname::_fill_maps() {
   using std::make_pair;
   std::string rx;
   unsigned int rxid;
+  names.insert(_names, _names + NUM_RX_NAMES);
   unsigned int _mts [NUM_RX_NAMES] = {
     1,
     0,
@@ -2567,7 +2570,13 @@ void * pyne::rxname::_fill_maps() {
   id_offset[make_pair("decay", name_id["decay_2ec"])] = offset(-2, 0);
   return NULL;
 }
-void * pyne::rxname::_ = pyne::rxname::_fill_maps();
+void * pyne::rxname::_ = NULL;
+
+void pyne::rxname::ensure_maps() {
+  // filled on first use rather than during static initialization
+  static void * filled = _fill_maps();
+  (void) filled;
+}
 
 
 unsigned int pyne::rxname::hash(std::string s) {
@@ -2586,6 +2595,216 @@ unsigned int pyne::rxname::hash(const char * s) {
 }
 
 
+// ************************
+// *** lookup table *******
+// ************************
+
+namespace {
+// 32-bit finalizer from MurmurHash3, salted to give independent hashes
+inline unsigned int mix_hash(unsigned int k, unsigned int salt) {
+  k ^= salt;
+  k ^= k >> 16;
+  k *= 0x85ebca6bu;
+  k ^= k >> 13;
+  k *= 0xc2b2ae35u;
+  k ^= k >> 16;
+  return k;
+}
+
+// Perfect hash over a fixed set of 32-bit keys by hash and displace: each
+// bucket of keys gets a displacement that places all of its keys in free
+// slots, so a lookup is one bucket read and one slot probe.
+class PerfectHash {
+ public:
+  PerfectHash() : nbuckets(1), nslots(1), disp(1, 0), keys(1, 0),
+                  vals(1, -1) {};
+
+  /// Builds the table for distinct \a k, where key k[i] gets value i.
+  /// Returns false if no placement was found.
+  bool build(const std::vector<unsigned int>& k) {
+    size_t n = k.size();
+    nslots = 1;
+    while (nslots < 2 * n)
+      nslots <<= 1;
+    nbuckets = 1;
+    while (4 * nbuckets < n)
+      nbuckets <<= 1;
+    disp.assign(nbuckets, 0);
+    keys.assign(nslots, 0);
+    vals.assign(nslots, -1);
+    std::vector<std::vector<int> > buckets(nbuckets);
+    for (size_t i = 0; i < n; i++)
+      buckets[bucket(k[i])].push_back(i);
+    // place the largest buckets first, while most slots are free
+    std::vector<std::pair<size_t, size_t> > order;
+    for (size_t b = 0; b < nbuckets; b++)
+      order.push_back(std::make_pair(buckets[b].size(), b));
+    std::sort(order.rbegin(), order.rend());
+    std::vector<size_t> placed;
+    for (size_t o = 0; o < nbuckets && 0 < order[o].first; o++) {
+      const std::vector<int>& bk = buckets[order[o].second];
+      unsigned int d = 0;
+      for (; d < 16 * nslots; d++) {
+        placed.clear();
+        for (size_t j = 0; j < bk.size(); j++) {
+          size_t sl = slot(k[bk[j]], d);
+          if (vals[sl] != -1 ||
+              std::find(placed.begin(), placed.end(), sl) != placed.end())
+            break;
+          placed.push_back(sl);
+        }
+        if (placed.size() == bk.size())
+          break;
+      }
+      if (placed.size() != bk.size())
+        return false;
+      disp[order[o].second] = d;
+      for (size_t j = 0; j < bk.size(); j++) {
+        keys[placed[j]] = k[bk[j]];
+        vals[placed[j]] = bk[j];
+      }
+    }
+    return true;
+  };
+
+  /// Returns the value of key \a k, or -1 if it is not in the table.
+  int find(unsigned int k) const {
+    size_t sl = slot(k, disp[bucket(k)]);
+    return keys[sl] == k ? vals[sl] : -1;
+  };
+
+ private:
+  size_t bucket(unsigned int k) const {
+    return mix_hash(k, 0x9e3779b9u) & (nbuckets - 1);
+  };
+  size_t slot(unsigned int k, unsigned int d) const {
+    return (mix_hash(k, 0x7f4a7c15u) + d * (mix_hash(k, 0x2545f491u) | 1u))
+           & (nslots - 1);
+  };
+  size_t nbuckets;
+  size_t nslots;
+  std::vector<unsigned int> disp;
+  std::vector<unsigned int> keys;
+  std::vector<int> vals;
+};
+
+// One reaction as seen by the lookup functions
+struct RxEntry {
+  unsigned int id;
+  const std::string* name;
+  bool has_mt;
+  unsigned int mt;
+  const std::string* label;
+  const std::string* doc;
+};
+
+// Perfect hash index of the reaction maps. Reaction ids and MT numbers map
+// to their reaction, as do the string hashes of the names and alternative
+// names, which keep a pointer to the string to rule out hash collisions.
+// The index is built from the maps on first use; anything it cannot
+// resolve falls back to the maps.
+class RxIndex {
+ public:
+  RxIndex() {
+    using namespace pyne::rxname;
+    ensure_maps();
+    std::map<unsigned int, std::string>::const_iterator it;
+    std::vector<unsigned int> number_keys;
+    for (it = id_name.begin(); it != id_name.end(); ++it) {
+      RxEntry e = {it->first, &it->second, false, 0, NULL, NULL};
+      if (0 < id_mt.count(it->first)) {
+        e.has_mt = true;
+        e.mt = id_mt[it->first];
+      }
+      if (0 < labels.count(it->first))
+        e.label = &labels[it->first];
+      if (0 < docs.count(it->first))
+        e.doc = &docs[it->first];
+      entry_of_id[it->first] = entries.size();
+      number_keys.push_back(it->first);
+      number_entries.push_back(entries.size());
+      entries.push_back(e);
+    }
+    // MT numbers that are also reaction ids resolve to the id, as in id()
+    std::map<unsigned int, unsigned int>::const_iterator mit;
+    for (mit = mt_id.begin(); mit != mt_id.end(); ++mit)
+      if (0 == id_name.count(mit->first) && 0 < entry_of_id.count(mit->second)) {
+        number_keys.push_back(mit->first);
+        number_entries.push_back(entry_of_id[mit->second]);
+      }
+
+    // names win over alternative names with the same hash
+    std::vector<unsigned int> string_keys;
+    std::set<unsigned int> seen;
+    for (size_t i = 0; i < entries.size(); i++) {
+      unsigned int h = hash(*entries[i].name);
+      if (!seen.insert(h).second)
+        continue;
+      string_keys.push_back(h);
+      string_entries.push_back(std::make_pair((int) i, entries[i].name));
+    }
+    std::map<std::string, unsigned int>::const_iterator ait;
+    for (ait = altnames.begin(); ait != altnames.end(); ++ait) {
+      unsigned int h = hash(ait->first);
+      if (0 == entry_of_id.count(ait->second) || !seen.insert(h).second)
+        continue;
+      string_keys.push_back(h);
+      string_entries.push_back(std::make_pair((int) entry_of_id[ait->second],
+                                              &ait->first));
+    }
+
+    usable = numbers.build(number_keys) && strings.build(string_keys);
+  };
+
+  /// Returns the reaction of an id or MT number, or NULL.
+  const RxEntry* find(unsigned int n) const {
+    if (!usable)
+      return NULL;
+    int i = numbers.find(n);
+    return i < 0 ? NULL : &entries[number_entries[i]];
+  };
+
+  /// Returns the reaction of a name or alternative name, or NULL.
+  const RxEntry* find(const std::string& s) const {
+    if (!usable)
+      return NULL;
+    int i = strings.find(pyne::rxname::hash(s.c_str()));
+    if (i < 0 || *string_entries[i].second != s)
+      return NULL;
+    return &entries[string_entries[i].first];
+  };
+
+ private:
+  bool usable;
+  std::vector<RxEntry> entries;
+  std::map<unsigned int, size_t> entry_of_id;
+  PerfectHash numbers;
+  std::vector<size_t> number_entries;
+  PerfectHash strings;
+  std::vector<std::pair<int, const std::string*> > string_entries;
+};
+
+const RxIndex& rx_index() {
+  static const RxIndex index;
+  return index;
+}
+
+std::string rx_label(unsigned int rxid) {
+  const RxEntry* e = rx_index().find(rxid);
+  if (e != NULL && e->id == rxid && e->label != NULL)
+    return *e->label;
+  return pyne::rxname::labels[rxid];
+}
+
+std::string rx_doc(unsigned int rxid) {
+  const RxEntry* e = rx_index().find(rxid);
+  if (e != NULL && e->id == rxid && e->doc != NULL)
+    return *e->doc;
+  return pyne::rxname::docs[rxid];
+}
+}  // namespace
+
+
 // ************************
 // *** name functions *****
 // ************************
@@ -2595,6 +2814,10 @@ std::string pyne::rxname::name(char * s) {
 }
 
 std::string pyne::rxname::name(std::string s) {
+  ensure_maps();
+  const RxEntry* e = rx_index().find(s);
+  if (e != NULL)
+    return *e->name;
   if (0 < names.count(s))
     return s;
   if (0 < altnames.count(s))
@@ -2619,6 +2842,10 @@ std::string pyne::rxname::name(int n) {
 }
 
 std::string pyne::rxname::name(unsigned int n) {
+  ensure_maps();
+  const RxEntry* e = rx_index().find(n);
+  if (e != NULL)
+    return *e->name;
   if (0 < id_name.count(n))
     return id_name[n];
   if (0 < mt_id.count(n))
@@ -2628,6 +2855,7 @@ std::string pyne::rxname::name(unsigned int n) {
 
 
 std::string pyne::rxname::name(int from_nuc, int to_nuc, std::string z) {
+  ensure_maps();
   // This assumes nuclides are in id form
   std::pair<std::string, int> key = std::make_pair(z, to_nuc - from_nuc);
   if (0 == offset_id.count(key))
@@ -2657,10 +2885,18 @@ std::string pyne::rxname::name(std::string from_nuc, std::string to_nuc, std::st
 // *** id functions *****
 // **********************
 unsigned int pyne::rxname::id(int x) {
+  ensure_maps();
+  const RxEntry* e = rx_index().find((unsigned int) x);
+  if (e != NULL)
+    return e->id;
   return name_id[pyne::rxname::name(x)];
 }
 
 unsigned int pyne::rxname::id(unsigned int x) {
+  ensure_maps();
+  const RxEntry* e = rx_index().find(x);
+  if (e != NULL)
+    return e->id;
   if (0 < id_name.count(x))
     return x;
   if (0 < mt_id.count(x))
@@ -2669,10 +2905,14 @@ unsigned int pyne::rxname::id(unsigned int x) {
 }
 
 unsigned int pyne::rxname::id(const char * x) {
-  return name_id[pyne::rxname::name(x)];
+  return pyne::rxname::id(std::string(x));
 }
 
 unsigned int pyne::rxname::id(std::string x) {
+  ensure_maps();
+  const RxEntry* e = rx_index().find(x);
+  if (e != NULL)
+    return e->id;
   if (0 < names.count(x))
     return name_id[x];
   if (0 < altnames.count(x))
@@ -2681,6 +2921,7 @@ unsigned int pyne::rxname::id(std::string x) {
 }
 
 unsigned int pyne::rxname::id(int from_nuc, int to_nuc, std::string z) {
+  ensure_maps();
   // This assumes nuclides are in id form
   std::pair<std::string, int> key = std::make_pair(z, to_nuc - from_nuc);
   if (0 == offset_id.count(key))
@@ -2708,60 +2949,56 @@ unsigned int pyne::rxname::id(std::string from_nuc, std::string to_nuc, std::str
 // **********************
 // *** MT functions *****
 // **********************
+static unsigned int rx_mt(unsigned int rxid) {
+  const RxEntry* e = rx_index().find(rxid);
+  if (e != NULL && e->id == rxid) {
+    if (!e->has_mt)
+      throw pyne::rxname::NotAReaction();
+    return e->mt;
+  }
+  if (0 == pyne::rxname::id_mt.count(rxid))
+    throw pyne::rxname::NotAReaction();
+  return pyne::rxname::id_mt[rxid];
+}
+
 unsigned int pyne::rxname::mt(int x) {
   unsigned int rxid = pyne::rxname::id(x);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return rx_mt(rxid);
 }
 
 unsigned int pyne::rxname::mt(unsigned int x) {
   unsigned int rxid = pyne::rxname::id(x);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return rx_mt(rxid);
 }
 
 unsigned int pyne::rxname::mt(char * x) {
   unsigned int rxid = pyne::rxname::id(x);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return rx_mt(rxid);
 }
 
 unsigned int pyne::rxname::mt(std::string x) {
   unsigned int rxid = pyne::rxname::id(x);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return rx_mt(rxid);
 }
 
 unsigned int pyne::rxname::mt(int from_nuc, int to_nuc, std::string z) {
   unsigned int rxid = pyne::rxname::id(from_nuc, to_nuc, z);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return rx_mt(rxid);
 }
 
 unsigned int pyne::rxname::mt(int from_nuc, std::string to_nuc, std::string z) {
   unsigned int rxid = pyne::rxname::id(from_nuc, to_nuc, z);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return rx_mt(rxid);
 }
 
 unsigned int pyne::rxname::mt(std::string from_nuc, int to_nuc, std::string z) {
   unsigned int rxid = pyne::rxname::id(from_nuc, to_nuc, z);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return rx_mt(rxid);
 }
 
 unsigned int pyne::rxname::mt(std::string from_nuc, std::string to_nuc, std::string z) {
   unsigned int rxid = pyne::rxname::id(from_nuc, to_nuc, z);
-  if (0 == id_mt.count(rxid))
-    throw NotAReaction();
-  return id_mt[rxid];
+  return rx_mt(rxid);
 }
 
 
@@ -2769,35 +3006,35 @@ unsigned int pyne::rxname::mt(std::string from_nuc, std::string to_nuc, std::str
 // *** label functions ***
 // ***********************
 std::string pyne::rxname::label(int x) {
-  return labels[pyne::rxname::id(x)];
+  return rx_label(pyne::rxname::id(x));
 }
 
 std::string pyne::rxname::label(unsigned int x) {
-  return labels[pyne::rxname::id(x)];
+  return rx_label(pyne::rxname::id(x));
 }
 
 std::string pyne::rxname::label(char * x) {
-  return labels[pyne::rxname::id(x)];
+  return rx_label(pyne::rxname::id(x));
 }
 
 std::string pyne::rxname::label(std::string x) {
-  return labels[pyne::rxname::id(x)];
+  return rx_label(pyne::rxname::id(x));
 }
 
 std::string pyne::rxname::label(int from_nuc, int to_nuc, std::string z) {
-  return labels[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return rx_label(pyne::rxname::id(from_nuc, to_nuc, z));
 }
 
 std::string pyne::rxname::label(int from_nuc, std::string to_nuc, std::string z) {
-  return labels[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return rx_label(pyne::rxname::id(from_nuc, to_nuc, z));
 }
 
 std::string pyne::rxname::label(std::string from_nuc, int to_nuc, std::string z) {
-  return labels[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return rx_label(pyne::rxname::id(from_nuc, to_nuc, z));
 }
 
 std::string pyne::rxname::label(std::string from_nuc, std::string to_nuc, std::string z) {
-  return labels[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return rx_label(pyne::rxname::id(from_nuc, to_nuc, z));
 }
 
 
@@ -2805,35 +3042,35 @@ std::string pyne::rxname::label(std::string from_nuc, std::string to_nuc, std::s
 // *** doc functions ***
 // *********************
 std::string pyne::rxname::doc(int x) {
-  return docs[pyne::rxname::id(x)];
+  return rx_doc(pyne::rxname::id(x));
 }
 
 std::string pyne::rxname::doc(unsigned int x) {
-  return docs[pyne::rxname::id(x)];
+  return rx_doc(pyne::rxname::id(x));
 }
 
 std::string pyne::rxname::doc(char * x) {
-  return docs[pyne::rxname::id(x)];
+  return rx_doc(pyne::rxname::id(x));
 }
 
 std::string pyne::rxname::doc(std::string x) {
-  return docs[pyne::rxname::id(x)];
+  return rx_doc(pyne::rxname::id(x));
 }
 
 std::string pyne::rxname::doc(int from_nuc, int to_nuc, std::string z) {
-  return docs[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return rx_doc(pyne::rxname::id(from_nuc, to_nuc, z));
 }
 
 std::string pyne::rxname::doc(int from_nuc, std::string to_nuc, std::string z) {
-  return docs[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return rx_doc(pyne::rxname::id(from_nuc, to_nuc, z));
 }
 
 std::string pyne::rxname::doc(std::string from_nuc, int to_nuc, std::string z) {
-  return docs[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return rx_doc(pyne::rxname::id(from_nuc, to_nuc, z));
 }
 
 std::string pyne::rxname::doc(std::string from_nuc, std::string to_nuc, std::string z) {
-  return docs[pyne::rxname::id(from_nuc, to_nuc, z)];
+  return rx_doc(pyne::rxname::id(from_nuc, to_nuc, z));
 }
 
 
@@ -2842,6 +3079,7 @@ std::string pyne::rxname::doc(std::string from_nuc, std::string to_nuc, std::str
 // ***********************
 
 int pyne::rxname::child(int nuc, unsigned int rx, std::string z) {
+  ensure_maps();
   // This assumes nuclides are in id form
   std::pair<std::string, unsigned int> key = std::make_pair(z, rx);
   if (0 == id_offset.count(key))
@@ -2869,6 +3107,7 @@ int pyne::rxname::child(std::string nuc, std::string rx, std::string z) {
 // ************************
 
 int pyne::rxname::parent(int nuc, unsigned int rx, std::string z) {
+  ensure_maps();
   // This assumes nuclides are in id form
   std::pair<std::string, unsigned int> key = std::make_pair(z, rx);
   if (0 == id_offset.count(key))
@@ -50,7 +50,11 @@ namespace rxname
 
   /// A helper function to set the contents of the variables in this library.
   void * _fill_maps();
-  extern void * _;  ///< A dummy variable used when calling #_fill_maps().
+  /// Fills the variables of this library on the first call only. The
+  /// functions of this library call it themselves; code reading the
+  /// variables directly must call it first.
+  void ensure_maps();
+  extern void * _;  ///< Unused, kept for compatibility; see ensure_maps().
 
   /// A helper function to compute nuclide id offsets from z-, a-, and s- deltas
   inline int offset(int dz, int da, int ds=0) {return dz*10000000 + da*10000 + ds;}
@@ -1,19 +1,87 @@
+#include <mutex>
+#include <algorithm>
+#include <utility>
+#include <stdint.h>
+#include <math.h>
+#include <string.h>
+#include <errno.h>
+#include <float.h>
+#if !defined __WIN_MSVC__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #ifndef PYNE_IS_AMALGAMATED
 #include "source_sampling.h"
+#include "instrument.h"
 #endif
 
 // Global sampler instance
 static pyne::Sampler* sampler = NULL;
+// Per-thread sampling contexts for the thread-indexed Fortran API
+static std::vector<pyne::SamplingContext> sampling_contexts;
+// Guards the creation of sampler and sampling_contexts
+static std::mutex sampler_mutex;
 // Global variable for mode range
 const int SUBVOXEL_START = 3;
+// Number of particles processed together by Sampler::particle_birth_batch
+const int BIRTH_BLOCK_SIZE = 64;
+// Number of volume elements whose source data are read from the mesh at once
+// when building a MeshAliasTable
+const int TAG_BLOCK_SIZE = 4096;
 
-// Fortran API
-void pyne::sampling_setup_(int* mode, int* cell_list_size) {
+// Size and modification time of the source mesh file, 0 if it isn't found.
+static void source_file_stat(std::string filename, int64_t& size,
+                             int64_t& mtime) {
+  struct stat st;
+  size = mtime = 0;
+  if (stat(filename.c_str(), &st) == 0) {
+    size = st.st_size;
+    mtime = st.st_mtime;
+  }
+}
+
+// Maps the state file if it is an up to date state of the source, else NULL.
+static pyne::Sampler* matching_state(std::string state_file,
+                                     std::string filename, int mode) {
+  if (!pyne::file_exists(state_file))
+    return NULL;
+  pyne::Sampler* s = NULL;
+  try {
+    s = pyne::Sampler::read_state(state_file);
+  } catch (std::exception&) {
+    return NULL;  // written by another version, rebuild it
+  }
+  if (s->matches_source(filename, mode))
+    return s;
+  delete s;
+  return NULL;
+}
+
+// Builds the global sampler from the default MCNP file and tag names. A
+// sampler state file written by Sampler::write_state for the same source and
+// mode is used instead when present, so that ranks map the prebuilt tables.
+// A state file that is stale, truncated or of another version is rebuilt
+// rather than thrown for, since this runs under the Fortran API.
+static void setup_default_sampler(int mode) {
   if (sampler == NULL) {
     std::string filename ("source.h5m");
+    std::string state_file ("source_sampler.state");
+    sampler = matching_state(state_file, filename, mode);
+    if (sampler != NULL)
+      return;
+    if (pyne::file_exists(state_file))
+      std::cout << "Warning: " << state_file << " does not match " << filename
+                << ", the sampler is rebuilt." << std::endl;
     std::string src_tag_name ("source_density");
     std::string e_bounds_file ("e_bounds");
-    std::vector<double> e_bounds = read_e_bounds(e_bounds_file);
+    std::vector<double> e_bounds = pyne::read_e_bounds(e_bounds_file);
     std::map<std::string, std::string> tag_names;
     tag_names.insert(std::pair<std::string, std::string> ("src_tag_name",
           "source_density"));
@@ -23,11 +91,47 @@ void pyne::sampling_setup_(int* mode, int* cell_list_size) {
           "cell_number"));
     tag_names.insert(std::pair<std::string, std::string> ("cell_fracs_tag_name",
           "cell_fracs"));
-    sampler = new pyne::Sampler(filename, tag_names, e_bounds, *mode);
-    *cell_list_size = sampler->get_cell_list_size();
+    sampler = new pyne::Sampler(filename, tag_names, e_bounds, mode);
   }
 }
 
+// Fortran API
+void pyne::sampling_setup_(int* mode, int* cell_list_size) {
+  std::lock_guard<std::mutex> lock(sampler_mutex);
+  setup_default_sampler(*mode);
+  *cell_list_size = sampler->get_cell_list_size();
+}
+
+void pyne::sampling_setup_thread_(int* mode, int* thread_id, int* num_threads,
+                                  int* cell_list_size, int* ierr) {
+  std::lock_guard<std::mutex> lock(sampler_mutex);
+  setup_default_sampler(*mode);
+  // The context list is sized once, so that threads which are already
+  // sampling never observe a reallocation.
+  if (sampling_contexts.empty() && *num_threads > 0)
+    sampling_contexts.resize(*num_threads);
+  // Exceptions must not cross into Fortran, so a bad index is reported
+  if (*thread_id < 0 || *thread_id >= (int) sampling_contexts.size()) {
+    *ierr = 1;
+    return;
+  }
+  sampling_contexts[*thread_id] = pyne::SamplingContext(sampler);
+  *cell_list_size = sampler->get_cell_list_size();
+  *ierr = 0;
+}
+
+void pyne::particle_birth_thread_(int* thread_id,
+                                  double* rands,
+                                  double* x,
+                                  double* y,
+                                  double* z,
+                                  double* e,
+                                  double* w,
+                                  int* cell_list) {
+    sampling_contexts[*thread_id].particle_birth(rands, x, y, z, e, w,
+                                                 cell_list);
+}
+
 void pyne::particle_birth_(double* rands,
                            double* x,
                            double* y,
@@ -35,16 +139,20 @@ void pyne::particle_birth_(double* rands,
                            double* e,
                            double* w,
                            int* cell_list) {
-    std::vector<double> rands2(rands, rands + 6);
-    pyne::SourceParticle src = sampler->particle_birth(rands2);
-    *x = src.get_x();
-    *y = src.get_y();
-    *z = src.get_z();
-    *e = src.get_e();
-    *w = src.get_w();
-    std::vector<int> c_list = src.get_cell_list();
-    int cell_list_size = sampler->get_cell_list_size();
-    std::copy(c_list.begin(), c_list.end(), cell_list);
+    pyne::SourceParticleSoA out = {x, y, z, e, w, cell_list};
+    sampler->particle_birth_batch(rands, 1, out);
+}
+
+void pyne::particle_birth_batch_(int* n,
+                                 double* rands,
+                                 double* x,
+                                 double* y,
+                                 double* z,
+                                 double* e,
+                                 double* w,
+                                 int* cell_list) {
+    pyne::SourceParticleSoA out = {x, y, z, e, w, cell_list};
+    sampler->particle_birth_batch(rands, *n, out);
 }
 
 std::vector<double> pyne::read_e_bounds(std::string e_bounds_file){
@@ -125,49 +233,102 @@ pyne::Sampler::Sampler(std::string filename,
       bias_tag_name = tag_names["bias_tag_name"];
     }
   }
+  // optional HDF5 sidecar for the two-level alias table
+  if (tag_names.find("alias_table_file") != tag_names.end())
+    alias_table_file = tag_names["alias_table_file"];
   setup();
 }
 
-pyne::SourceParticle pyne::Sampler::particle_birth(std::vector<double> rands) {
+pyne::SourceParticle pyne::Sampler::particle_birth(std::vector<double> rands) const {
+  double x, y, z, e, w;
+  std::vector<int> cell_list;
+  if (ve_type == moab::MBHEX)
+    cell_list.resize((mesh_mode == SUBVOXEL) ? 1 : max_num_cells);
+  birth(&rands[0], &x, &y, &z, &e, &w,
+        cell_list.empty() ? NULL : cell_list.data());
+  pyne::SourceParticle src = SourceParticle(x, y, z, e, w, cell_list);
+  return src;
+}
+
+void pyne::Sampler::particle_birth_batch(const double* rands, size_t n,
+                                         SourceParticleSoA& out) const {
+  // Particles are processed in fixed size blocks so that the index scratch
+  // space lives on the stack and the position kernel runs over a whole block.
+  int64_t pdf_idx[BIRTH_BLOCK_SIZE];
+  int ve_idx[BIRTH_BLOCK_SIZE];
+  int cell_list_size = get_cell_list_size();
+  for (size_t start=0; start<n; start+=BIRTH_BLOCK_SIZE) {
+    int m = std::min(n - start, (size_t) BIRTH_BLOCK_SIZE);
+    const double* r = &rands[6*start];
+    for (int i=0; i<m; ++i) {
+      pdf_idx[i] = sample_pdf(r[6*i], r[6*i + 1]);
+      ve_idx[i] = row_ve(pdf_idx[i]/num_e_groups);
+    }
+    ve_table.place(ve_type == moab::MBTET, ve_idx, &r[2], 6, m,
+                   &out.x[start], &out.y[start], &out.z[start]);
+    for (int i=0; i<m; ++i) {
+      out.e[start + i] = sample_e(pdf_idx[i] % num_e_groups, r[6*i + 5]);
+      out.w[start + i] = sample_w(pdf_idx[i]);
+    }
+    if (cell_list_size > 0) {
+      for (int i=0; i<m; ++i)
+        sample_cells(pdf_idx[i], &out.cell_list[(start + i)*cell_list_size]);
+    }
+  }
+}
+
+void pyne::Sampler::birth(const double* rands, double* x, double* y,
+                          double* z, double* e, double* w, int* cells) const {
   // select mesh volume and energy group
-  // For Unstructured mesh, p_src_num_cells and max_num_cells are set to 1
-  // For Cartisian mesh, max_num_cells is obtained via cell_fracs tag
-  int pdf_idx =at->sample_pdf(rands[0], rands[1]);
-  int ve_idx = pdf_idx/p_src_num_cells/num_e_groups;
-  int c_idx = (pdf_idx/num_e_groups)%p_src_num_cells;
+  // The PDF has a row per mesh volume element, or in SUBVOXEL mode per cell
+  // of each mesh volume element, of num_e_groups entries
+  int64_t pdf_idx = sample_pdf(rands[0], rands[1]);
+  int ve_idx = row_ve(pdf_idx/num_e_groups);
   int e_idx = pdf_idx % num_e_groups;
 
   // Sample uniformly within the selected mesh volume element and energy
   // group.
-  std::vector<double> xyz_rands;
-  xyz_rands.push_back(rands[2]);
-  xyz_rands.push_back(rands[3]);
-  xyz_rands.push_back(rands[4]);
-  moab::CartVect pos = sample_xyz(ve_idx, xyz_rands);
-  cell_list.resize(0);
-  if (ve_type == moab::MBHEX) {
-     if (mesh_mode == SUBVOXEL) {
-         cell_list.emplace_back(cell_number[ve_idx*max_num_cells + c_idx]);
-     }
-     else { // Voxel
-        for (int c=0; c<max_num_cells; c++) {
-            cell_list.emplace_back(cell_number[ve_idx*max_num_cells + c]);
-        }
-     }
+  ve_table.place(ve_type == moab::MBTET, &ve_idx, &rands[2], 3, 1, x, y, z);
+  *e = sample_e(e_idx, rands[5]);
+  *w = sample_w(pdf_idx);
+
+  // cells is NULL when no cell list is requested (e.g. tet mesh)
+  if (cells != NULL)
+    sample_cells(pdf_idx, cells);
+}
+
+void pyne::Sampler::sample_cells(int64_t pdf_idx, int* cells) const {
+  int row = pdf_idx/num_e_groups;
+  if (mesh_mode == SUBVOXEL) {
+    cells[0] = cell_number[row];
+  } else { // Voxel, the cells of the VE padded with -1 to max_num_cells
+    int c = 0;
+    for (int k=cell_ptr[row]; k<cell_ptr[row + 1]; ++k)
+      cells[c++] = cell_number[k];
+    for (; c<max_num_cells; ++c)
+      cells[c] = -1;
   }
-  pyne::SourceParticle src = SourceParticle(pos[0], pos[1], pos[2],
-      sample_e(e_idx, rands[5]), sample_w(pdf_idx), cell_list);
-  return src;
 }
 
 
 void pyne::Sampler::setup() {
+  PYNE_TIME(TIME_SAMPLER_SETUP);
+  e_mode = E_LINEAR;
+  at = NULL;
+  mesh_at = NULL;
+  state = NULL;
+  has_cell_fracs = false;
+  source_strength = biased_strength = 0.0;
+  source_file_stat(filename, source_size, source_mtime);
   moab::ErrorCode rval;
   moab::EntityHandle loaded_file_set;
   // Create MOAB instance
-  mesh = new moab::Core();
-  rval = mesh->create_meshset(moab::MESHSET_SET, loaded_file_set);
-  rval = mesh->load_file(filename.c_str(), &loaded_file_set);
+  {
+    PYNE_TIME(TIME_SAMPLER_LOAD_MESH);
+    mesh = new moab::Core();
+    rval = mesh->create_meshset(moab::MESHSET_SET, loaded_file_set);
+    rval = mesh->load_file(filename.c_str(), &loaded_file_set);
+  }
   if (rval != moab::MB_SUCCESS)
     throw std::invalid_argument("Could not load mesh file.");
 
@@ -222,7 +383,11 @@ void pyne::Sampler::setup() {
 
   // Process all the spatial and tag data and create an alias table.
   std::vector<double> volumes(num_ves);
-  mesh_geom_data(ves, volumes);
+  {
+    PYNE_TIME(TIME_SAMPLER_GEOM_DATA);
+    mesh_geom_data(ves, volumes);
+  }
+  PYNE_TIME(TIME_SAMPLER_TAG_DATA);
   mesh_tag_data(ves, volumes);
 }
 
@@ -236,38 +401,168 @@ void pyne::Sampler::mesh_geom_data(moab::Range ves, std::vector<double> &volumes
 
   // Grab the coordinates that define 4 connected points within a mesh volume
   // element and setup a data structure to allow uniform sampling with each
-  // mesh volume element.
-  double coords[verts_per_ve*3];
-  int v;
-  for (v=0; v<num_ves; ++v) {
-    rval = mesh->get_coords(&connect[verts_per_ve*v], verts_per_ve, &coords[0]);
+  // mesh volume element. The coordinates are read and the volumes computed
+  // a chunk of elements at a time.
+  const int chunk = 4096;
+  std::vector<double> coords(chunk*verts_per_ve*3);
+  std::vector<double> xs(chunk*verts_per_ve), ys(chunk*verts_per_ve),
+                      zs(chunk*verts_per_ve);
+  double x_vec[3], y_vec[3], z_vec[3];
+  // Offsets of the vertices spanning the x, y and z edges from vertex 0
+  const int hex_verts[3] = {1, 3, 4};
+  const int tet_verts[3] = {1, 2, 3};
+  const int* edge_verts = (ve_type == moab::MBHEX) ? hex_verts : tet_verts;
+  ve_table.resize(num_ves);
+  for (int first=0; first<num_ves; first+=chunk) {
+    int n = std::min(chunk, num_ves - first);
+    rval = mesh->get_coords(&connect[verts_per_ve*first], verts_per_ve*n,
+                            &coords[0]);
     if (rval != moab::MB_SUCCESS)
       throw std::runtime_error("Problem vertex coordinates.");
-    volumes[v] = measure(ve_type, verts_per_ve, &coords[0]);
-    if (ve_type == moab::MBHEX) {
-      moab::CartVect o(coords[0], coords[1], coords[2]);
-      moab::CartVect x(coords[3], coords[4], coords[5]);
-      moab::CartVect y(coords[9], coords[10], coords[11]);
-      moab::CartVect z(coords[12], coords[13], coords[14]);
-      edge_points ep = {o, x-o, y-o, z-o};
-      all_edge_points.push_back(ep);
-    } else if (ve_type == moab::MBTET) {
-      moab::CartVect o(coords[0], coords[1], coords[2]);
-      moab::CartVect x(coords[3], coords[4], coords[5]);
-      moab::CartVect y(coords[6], coords[7], coords[8]);
-      moab::CartVect z(coords[9], coords[10], coords[11]);
-      edge_points ep = {o, x-o, y-o, z-o};
-      all_edge_points.push_back(ep);
+    for (int i=0; i<verts_per_ve*n; ++i) {
+      xs[i] = coords[3*i];
+      ys[i] = coords[3*i + 1];
+      zs[i] = coords[3*i + 2];
     }
+    measure_many(ve_type, verts_per_ve, n, NULL, &xs[0], &ys[0], &zs[0],
+                 &volumes[first]);
+    for (int i=0; i<n; ++i) {
+      const double* ve_coords = &coords[3*verts_per_ve*i];
+      for (int d=0; d<3; ++d) {
+        x_vec[d] = ve_coords[3*edge_verts[0] + d] - ve_coords[d];
+        y_vec[d] = ve_coords[3*edge_verts[1] + d] - ve_coords[d];
+        z_vec[d] = ve_coords[3*edge_verts[2] + d] - ve_coords[d];
+      }
+      ve_table.set(first + i, ve_coords, x_vec, y_vec, z_vec);
+    }
+  }
+}
+
+// Calls f(block, first) for each block of up to TAG_BLOCK_SIZE volume elements
+// of ves in turn, first being the index of the first volume element of block.
+template <typename F>
+static void for_each_ve_block(const moab::Range& ves, F f) {
+  std::vector<moab::EntityHandle> block;
+  block.reserve(TAG_BLOCK_SIZE);
+  int first = 0;
+  moab::Range::const_iterator it = ves.begin();
+  while (it != ves.end()) {
+    block.clear();
+    for (; it != ves.end() && block.size() < TAG_BLOCK_SIZE; ++it)
+      block.push_back(*it);
+    f(block, first);
+    first += block.size();
   }
 }
 
+void pyne::Sampler::index_rows() {
+  std::vector<int>().swap(row_ves);
+  if (mesh_mode != SUBVOXEL)
+    return;
+  row_ves.resize(cell_ptr[num_ves]);
+  for (int v=0; v<num_ves; ++v)
+    std::fill(row_ves.begin() + cell_ptr[v], row_ves.begin() + cell_ptr[v + 1],
+              v);
+}
+
+void pyne::Sampler::mesh_cell_data(moab::Range ves,
+                                   std::vector<int>& cell_slots) {
+  moab::ErrorCode rval;
+  moab::Tag cell_number_tag;
+  moab::Tag cell_fracs_tag;
+  // Set the default value of max_num_cells to 1, so that the structured mesh
+  // and unstructured mesh r2s can use the same form of pdf size description.
+  max_num_cells = 1;
+  p_src_num_cells = 1;
+  std::vector<int> ptr(num_ves + 1, 0);
+  std::vector<int> numbers;
+  std::vector<double> fracs;
+  if (ve_type == moab::MBHEX) {
+    // Read the cell_number tag and cell_fracs tag
+    rval = mesh->tag_get_handle(cell_number_tag_name.c_str(), cell_number_tag);
+    rval = mesh->tag_get_handle(cell_fracs_tag_name.c_str(), cell_fracs_tag);
+    has_cell_fracs = check_cell_fracs(cell_fracs_tag);
+    max_num_cells = get_max_num_cells(cell_fracs_tag);
+    if (mesh_mode == SUBVOXEL) {
+      p_src_num_cells = max_num_cells;
+      num_e_groups /= p_src_num_cells;
+      // cell_fracs must exist in SUBVOXEL mode
+      if (has_cell_fracs == false) {
+        throw std::runtime_error("No cell_fracs tag found in sub-voxel R2S. Wrong source file used.");
+      }
+    }
+  }
+  if (has_cell_fracs) {
+    // The tags hold max_num_cells entries for every volume element, padded
+    // with cell number -1 and fraction 0. Only the cells a volume element
+    // intersects are kept, in CSR form, along with their places in the tags.
+    std::vector<int> block_numbers(TAG_BLOCK_SIZE*max_num_cells);
+    std::vector<double> block_fracs(TAG_BLOCK_SIZE*max_num_cells);
+    for_each_ve_block(ves, [&](const std::vector<moab::EntityHandle>& block,
+                               int first) {
+      moab::ErrorCode rval;
+      rval = mesh->tag_get_data(cell_number_tag, &block[0], block.size(),
+                                &block_numbers[0]);
+      if (rval == moab::MB_SUCCESS)
+        rval = mesh->tag_get_data(cell_fracs_tag, &block[0], block.size(),
+                                  &block_fracs[0]);
+      if (rval != moab::MB_SUCCESS)
+        throw std::runtime_error("Problem getting cell tag data.");
+      for (int b=0; b<block.size(); ++b) {
+        for (int c=0; c<max_num_cells; ++c) {
+          int k = b*max_num_cells + c;
+          if (block_numbers[k] == -1 && block_fracs[k] <= 0.0)
+            continue;
+          numbers.push_back(block_numbers[k]);
+          if (mesh_mode == SUBVOXEL) {
+            fracs.push_back(block_fracs[k]);
+            cell_slots.push_back(c);
+          }
+        }
+        ptr[first + b + 1] = numbers.size();
+      }
+    });
+  }
+  cell_ptr.swap_in(ptr);
+  cell_number.swap_in(numbers);
+  cell_fracs.swap_in(fracs);
+  index_rows();
+  std::cout<<" comment. max_num_cells="<<max_num_cells<<std::endl;
+}
+
+void pyne::Sampler::read_row_data(moab::Range ves, moab::Tag tag, int n,
+                                  const std::vector<int>& cell_slots,
+                                  std::vector<double>& rows) {
+  moab::ErrorCode rval;
+  rows.resize((size_t) num_rows()*n);
+  if (rows.empty())
+    return;
+  if (mesh_mode != SUBVOXEL) {
+    rval = mesh->tag_get_data(tag, ves, &rows[0]);
+    if (rval != moab::MB_SUCCESS)
+      throw std::runtime_error("Problem getting tag data.");
+    return;
+  }
+  std::vector<double> data(TAG_BLOCK_SIZE*max_num_cells*n);
+  for_each_ve_block(ves, [&](const std::vector<moab::EntityHandle>& block,
+                             int first) {
+    moab::ErrorCode rval = mesh->tag_get_data(tag, &block[0], block.size(),
+                                              &data[0]);
+    if (rval != moab::MB_SUCCESS)
+      throw std::runtime_error("Problem getting tag data.");
+    for (int b=0; b<block.size(); ++b) {
+      for (int row=row_begin(first + b); row<row_end(first + b); ++row) {
+        const double* src = &data[0] + (b*max_num_cells + cell_slots[row])*n;
+        std::copy(src, src + n, &rows[(size_t) row*n]);
+      }
+    }
+  });
+}
+
 void pyne::Sampler::mesh_tag_data(moab::Range ves,
                                   const std::vector<double> volumes) {
   moab::ErrorCode rval;
   moab::Tag src_tag;
-  moab::Tag cell_number_tag;
-  moab::Tag cell_fracs_tag;
   rval = mesh->tag_get_handle(src_tag_name.c_str(),
                               moab::MB_TAG_VARLEN,
                               moab::MB_TYPE_DOUBLE,
@@ -276,76 +571,122 @@ void pyne::Sampler::mesh_tag_data(moab::Range ves,
   // That's okay. That's what the next line is all about:
   num_e_groups = num_groups(src_tag);
 
-  // Set the default value of max_num_cells to 1, so that the structured mesh
-  // and unstructured mesh r2s can use the same form of pdf size description.
-  max_num_cells = 1;
-  p_src_num_cells = 1;
-  int tag_size;
-  // set the default value of cell_number to -1, cell_fracs to 1.0.
-  cell_number.resize(num_ves, -1);
-  cell_fracs.resize(num_ves, 1.0);
-  if (ve_type == moab::MBHEX) {
-      // Read the cell_number tag and cell_fracs tag
-      rval = mesh->tag_get_handle(cell_number_tag_name.c_str(),
-                                  cell_number_tag);
-      rval = mesh->tag_get_handle(cell_fracs_tag_name.c_str(),
-                                  cell_fracs_tag);
-      has_cell_fracs = check_cell_fracs(cell_fracs_tag);
-      max_num_cells = get_max_num_cells(cell_fracs_tag);
-      if (mesh_mode == SUBVOXEL) {
-         p_src_num_cells = max_num_cells;
-         num_e_groups /= p_src_num_cells;
-   // cell_fracs must exist in SUBVOXEL mode
-         if (has_cell_fracs == false) {
-             throw std::runtime_error("No cell_fracs tag found in sub-voxel R2S. Wrong source file used.");
-         }
-         cell_fracs.resize(num_ves*p_src_num_cells);
-         rval = mesh->tag_get_data(cell_fracs_tag, ves, &cell_fracs[0]);
-      }
-      // check and set cell_number
-      if (has_cell_fracs) {
-          cell_number.resize(num_ves*max_num_cells);
-          rval = mesh->tag_get_data(cell_number_tag, ves, &cell_number[0]);
-      }
+  std::vector<int> cell_slots;
+  mesh_cell_data(ves, cell_slots);
+  if (!alias_table_file.empty() && bias_mode != USER) {
+    mesh_tag_data_blocked(ves, src_tag, volumes, cell_slots);
+    return;
   }
-  std::cout<<" comment. max_num_cells="<<max_num_cells<<std::endl;
-  std::vector<double> pdf(num_ves*num_e_groups*p_src_num_cells);
-  rval = mesh->tag_get_data(src_tag, ves, &pdf[0]);
-  if (rval != moab::MB_SUCCESS)
-    throw std::runtime_error("Problem getting source tag data.");
+  std::vector<double> pdf;
+  read_row_data(ves, src_tag, num_e_groups, cell_slots, pdf);
 
   // Multiply the source densities by the VE volumes
-  int v, c, e;
+  int v, row, e;
   for (v=0; v<num_ves; ++v) {
-      for (c=0; c<p_src_num_cells; ++c) {
+      for (row=row_begin(v); row<row_end(v); ++row) {
           for (e=0; e<num_e_groups; ++e) {
-              pdf[v*p_src_num_cells*num_e_groups + c*num_e_groups + e] *=
-                  volumes[v]*cell_fracs[v*p_src_num_cells + c];
+              pdf[row*num_e_groups + e] *= volumes[v]*row_frac(row);
           }
       }
   }
-  normalize_pdf(pdf);
+  source_strength = normalize_pdf(pdf);
 
   // Setup alias table based off PDF or biased PDF
   if (bias_mode == ANALOG) {
-    at = new AliasTable(pdf);
+    biased_strength = source_strength;
+    at = new AliasTable(std::move(pdf));
   } else {
-    std::vector<double> bias_pdf = read_bias_pdf(ves, volumes, pdf);
-    normalize_pdf(bias_pdf);
+    std::vector<double> bias_pdf = read_bias_pdf(ves, volumes, pdf,
+                                                 cell_slots);
+    biased_strength = normalize_pdf(bias_pdf);
     //  Create alias table based off biased pdf and calculate birth weights.
-    biased_weights.resize(num_ves*p_src_num_cells*num_e_groups);
-    for (int i=0; i<biased_weights.size(); ++i) {
-      biased_weights[i] = pdf[i]/bias_pdf[i];
+    std::vector<double> weights(pdf.size());
+    for (int i=0; i<weights.size(); ++i) {
+      weights[i] = pdf[i]/bias_pdf[i];
+    }
+    biased_weights.swap_in(weights);
+    at = new AliasTable(std::move(bias_pdf));
+  }
+}
+
+void pyne::Sampler::mesh_tag_data_blocked(moab::Range ves, moab::Tag src_tag,
+                                          const std::vector<double>& volumes,
+                                          const std::vector<int>& cell_slots) {
+  int num_rows = this->num_rows();
+  if (pyne::file_exists(alias_table_file)) {
+    mesh_at = new MeshAliasTable(alias_table_file);
+    if (mesh_at->num_rows != num_rows || mesh_at->num_groups != num_e_groups ||
+        mesh_at->row_weights.empty() != (bias_mode == ANALOG))
+      throw std::runtime_error("Alias table file " + alias_table_file +
+                               " does not match the source mesh.");
+    source_strength = mesh_at->source_strength;
+    biased_strength = mesh_at->biased_strength;
+    return;
+  }
+
+  // Read the source densities a block of volume elements at a time. Each row
+  // only needs its own group data, so the flattened PDF is never assembled.
+  mesh_at = new MeshAliasTable(num_rows, num_e_groups);
+  std::vector<double> row_pdf(num_rows);
+  std::vector<double> row_vol(num_rows);
+  std::vector<double> data(TAG_BLOCK_SIZE*p_src_num_cells*num_e_groups);
+  for_each_ve_block(ves, [&](const std::vector<moab::EntityHandle>& block,
+                             int first) {
+    moab::ErrorCode rval = mesh->tag_get_data(src_tag, &block[0], block.size(),
+                                              &data[0]);
+    if (rval != moab::MB_SUCCESS)
+      throw std::runtime_error("Problem getting source tag data.");
+    for (int b=0; b<block.size(); ++b) {
+      int v = first + b;
+      for (int row=row_begin(v); row<row_end(v); ++row) {
+        int c = (mesh_mode == SUBVOXEL) ? cell_slots[row] : 0;
+        row_vol[row] = volumes[v]*row_frac(row);
+        row_pdf[row] = row_vol[row]*mesh_at->set_row(row,
+            &data[(b*p_src_num_cells + c)*num_e_groups]);
+      }
+    }
+  });
+  // the tag data are no longer needed once the table is built
+  mesh->tag_delete(src_tag);
+
+  if (bias_mode == ANALOG) {
+    source_strength = 0.0;
+    for (int row=0; row<num_rows; ++row)
+      source_strength += row_pdf[row];
+    biased_strength = source_strength;
+    mesh_at->set_row_pdf(row_pdf);
+  } else {
+    // Uniform sampling: rows are selected by volume, and energies in analog
+    // within a row, so the birth weights only depend on the row.
+    double q_in_all = 0.0;
+    double vol_in_all = 0.0;
+    for (int row=0; row<num_rows; ++row) {
+      q_in_all += row_pdf[row];
+      if (row_pdf[row] > 0)
+        vol_in_all += row_vol[row];
+      else
+        row_vol[row] = 0.0;
     }
-    at = new AliasTable(bias_pdf);
+    std::vector<double> weights(num_rows);
+    for (int row=0; row<num_rows; ++row) {
+      weights[row] = (row_vol[row] > 0) ?
+          (row_pdf[row]/q_in_all)/(row_vol[row]/vol_in_all) : 0.0;
+    }
+    mesh_at->row_weights.swap_in(weights);
+    mesh_at->set_row_pdf(row_vol);
+    source_strength = q_in_all;
+    biased_strength = vol_in_all;
   }
+  mesh_at->source_strength = source_strength;
+  mesh_at->biased_strength = biased_strength;
+  mesh_at->write_hdf5(alias_table_file);
 }
 
 std::vector<double> pyne::Sampler::read_bias_pdf(moab::Range ves,
-                                                 std::vector<double> volumes,
-                                                 std::vector<double> pdf) {
-    std::vector<double> bias_pdf(num_ves*p_src_num_cells*num_e_groups);
-    int v, c, e;
+    const std::vector<double>& volumes, const std::vector<double>& pdf,
+    const std::vector<int>& cell_slots) {
+    std::vector<double> bias_pdf(pdf.size());
+    int v, row, e;
     moab::ErrorCode rval;
     if (bias_mode == UNIFORM) {
       // Sub-voxel Uniform sampling: uniform in space, analog in energy. Biased PDF is
@@ -353,22 +694,21 @@ std::vector<double> pyne::Sampler::read_bias_pdf(moab::Range ves,
       // mesh volume element and multiplying by the volume of the element.
       double q_in_group;
       for (v=0; v<num_ves; ++v) {
-        for (c=0; c<p_src_num_cells; ++c) {
+        for (row=row_begin(v); row<row_end(v); ++row) {
             q_in_group = 0.0;
             for (e=0; e<num_e_groups; ++e) {
-                q_in_group += pdf[v*p_src_num_cells*num_e_groups + c*num_e_groups + e];
+                q_in_group += pdf[row*num_e_groups + e];
             }
 
             if (q_in_group > 0) {
                 for (e=0; e<num_e_groups; ++e) {
-                    bias_pdf[v*p_src_num_cells*num_e_groups + c*num_e_groups + e] =
-                        volumes[v]*cell_fracs[v*p_src_num_cells + c]*
-                        pdf[v*p_src_num_cells*num_e_groups +
-                        c*num_e_groups + e]/q_in_group;
+                    bias_pdf[row*num_e_groups + e] =
+                        volumes[v]*row_frac(row)*
+                        pdf[row*num_e_groups + e]/q_in_group;
                 }
             } else {
                 for (e=0; e<num_e_groups; ++e) {
-                  bias_pdf[v*p_src_num_cells*num_e_groups + c*num_e_groups + e] = 0.0;
+                  bias_pdf[row*num_e_groups + e] = 0.0;
                 }
             }
 
@@ -386,14 +726,11 @@ std::vector<double> pyne::Sampler::read_bias_pdf(moab::Range ves,
         // Spatial, cell and energy biasing. The supplied bias PDF values are
         // applied to each specific energy group and sub-voxels in a mesh
         // volume element.
-        rval = mesh->tag_get_data(bias_tag, ves, &bias_pdf[0]);
-        if (rval != moab::MB_SUCCESS)
-          throw std::runtime_error("Problem getting bias tag data.");
+        read_row_data(ves, bias_tag, num_e_groups, cell_slots, bias_pdf);
         for (v=0; v<num_ves; ++v) {
-            for (c=0; c<p_src_num_cells; c++) {
+            for (row=row_begin(v); row<row_end(v); ++row) {
                 for (e=0; e<num_e_groups; ++e)
-                    bias_pdf[v*p_src_num_cells*num_e_groups + c*num_e_groups + e] *=
-                       volumes[v]*cell_fracs[v*p_src_num_cells + c];
+                    bias_pdf[row*num_e_groups + e] *= volumes[v]*row_frac(row);
             }
         }
       } else if (num_bias_groups == 1) {
@@ -407,24 +744,23 @@ std::vector<double> pyne::Sampler::read_bias_pdf(moab::Range ves,
         double q_in_group;
         for (v=0; v<num_ves; ++v) {
           q_in_group = 0;
-          for (c=0; c<p_src_num_cells; ++c){
+          for (row=row_begin(v); row<row_end(v); ++row){
               for (e=0; e<num_e_groups; ++e){
-                q_in_group += pdf[v*p_src_num_cells*num_e_groups + c*num_e_groups + e];
+                q_in_group += pdf[row*num_e_groups + e];
               }
           }
           if (q_in_group > 0){
-            for (c=0; c<p_src_num_cells; ++c){
+            for (row=row_begin(v); row<row_end(v); ++row){
                 for (e=0; e<num_e_groups; ++e){
-                    bias_pdf[v*p_src_num_cells*num_e_groups + c*num_e_groups + e] =
-                        spatial_pdf[v]*volumes[v]*cell_fracs[v*p_src_num_cells + c]*
-                        pdf[v*p_src_num_cells*num_e_groups + c*num_e_groups + e]/
-                        q_in_group;
+                    bias_pdf[row*num_e_groups + e] =
+                        spatial_pdf[v]*volumes[v]*row_frac(row)*
+                        pdf[row*num_e_groups + e]/q_in_group;
                 }
             }
           } else {
-            for (c=0; c<p_src_num_cells; ++c)
+            for (row=row_begin(v); row<row_end(v); ++row)
                 for (e=0; e<num_e_groups; ++e){
-                    bias_pdf[v*p_src_num_cells*num_e_groups + c*num_e_groups + e] =  0;
+                    bias_pdf[row*num_e_groups + e] =  0;
                 }
           }
         }
@@ -438,18 +774,18 @@ std::vector<double> pyne::Sampler::read_bias_pdf(moab::Range ves,
         for (v=0; v<num_ves; ++v) {
             for (e=0; e<num_e_groups; ++e) {
                 q_in_group = 0.0;
-                for (c=0; c<p_src_num_cells; ++c) {
-                    q_in_group += pdf[v*p_src_num_cells*num_e_groups + c*num_e_groups +e];
+                for (row=row_begin(v); row<row_end(v); ++row) {
+                    q_in_group += pdf[row*num_e_groups + e];
                 }
                 if (q_in_group >0) {
-                    for (c=0; c<p_src_num_cells; ++c) {
-                        bias_pdf[v*p_src_num_cells*num_e_groups + c*num_e_groups +e] =
-                            spa_erg_pdf[v*num_e_groups+e]*volumes[v]*cell_fracs[v*p_src_num_cells + c]*
-                            pdf[v*p_src_num_cells*num_e_groups + c*num_e_groups +e]/q_in_group;
+                    for (row=row_begin(v); row<row_end(v); ++row) {
+                        bias_pdf[row*num_e_groups + e] =
+                            spa_erg_pdf[v*num_e_groups+e]*volumes[v]*row_frac(row)*
+                            pdf[row*num_e_groups + e]/q_in_group;
                     }
                 } else {
-                    for (c=0; c<p_src_num_cells; ++c) {
-                        bias_pdf[v*p_src_num_cells*num_e_groups + c*num_e_groups + e] = 0.0;
+                    for (row=row_begin(v); row<row_end(v); ++row) {
+                        bias_pdf[row*num_e_groups + e] = 0.0;
                     }
                 }
             }
@@ -469,54 +805,74 @@ std::vector<double> pyne::Sampler::read_bias_pdf(moab::Range ves,
 }
 
 
-moab::CartVect pyne::Sampler::sample_xyz(int ve_idx, std::vector<double> rands) {
-  double s = rands[0];
-  double t = rands[1];
-  double u = rands[2];
+double pyne::Sampler::sample_e(int e_idx, double rand) const {
+   double e_min = e_bounds[e_idx];
+   double e_max = e_bounds[e_idx + 1];
+   if (e_mode == E_LOG)
+     return e_min * pow(e_max/e_min, rand);
+   if (e_mode == E_TABULATED && !group_spectra[e_idx].empty())
+     return group_spectra[e_idx].sample(rand);
+   return rand * (e_max - e_min) + e_min;
+}
 
-  // Transform s, t, u to uniformly sample a tetrahedron. See:
-  // C. Rocchini and P. Cignoni, “Generating Random Points in a Tetrahedron,”
-  //  Journal of Graphics Tools, 5, 200–202 (2001).
-  if (ve_type == moab::MBTET) {
-    if (s + t > 1) {
-      s = 1.0 - s;
-      t = 1.0 - t;
-    }
-    if (s + t + u > 1) {
-      if (t + u > 1) {
-        double old_t = t;
-        t = 1.0 - u;
-        u = 1.0 - s - old_t;
-      }else if (t + u <= 1) {
-        double old_s = s;
-        s = 1.0 - t - u;
-        u = old_s + t + u - 1;
-      }
+void pyne::Sampler::set_energy_mode(EnergyMode e_mode) {
+  if (e_mode == E_LOG) {
+    for (int i=0; i<e_bounds.size(); ++i) {
+      if (e_bounds[i] <= 0.0)
+        throw std::invalid_argument("Log energy sampling requires positive "
+                                    "energy bounds.");
     }
+  } else if (e_mode == E_TABULATED && group_spectra.empty()) {
+    throw std::invalid_argument("Tabulated energy sampling requires group "
+                                "spectra, see set_group_spectra.");
   }
+  this->e_mode = e_mode;
+}
 
- return s*all_edge_points[ve_idx].x_vec + \
-        t*all_edge_points[ve_idx].y_vec + \
-        u*all_edge_points[ve_idx].z_vec + \
-          all_edge_points[ve_idx].o_point;
+void pyne::Sampler::set_group_spectra(
+    const std::vector<std::vector<double> >& bounds,
+    const std::vector<std::vector<double> >& pdfs) {
+  if (bounds.size() != num_e_groups || pdfs.size() != num_e_groups)
+    throw std::length_error("One group spectrum is required per energy group.");
+  std::vector<GroupSpectrum> spectra(num_e_groups);
+  for (int g=0; g<num_e_groups; ++g) {
+    if (bounds[g].empty() && pdfs[g].empty())
+      continue;
+    if (bounds[g].empty() || pdfs[g].empty())
+      throw std::invalid_argument("A group spectrum needs both bounds and "
+                                  "probabilities, or neither.");
+    if (bounds[g].size() != pdfs[g].size() + 1)
+      throw std::invalid_argument("A group spectrum needs one more bound than "
+                                  "sub-bin probabilities.");
+    if (bounds[g].front() < e_bounds[g] || bounds[g].back() > e_bounds[g + 1])
+      throw std::invalid_argument("Group spectrum bounds must lie within the "
+                                  "energy group.");
+    spectra[g] = GroupSpectrum(bounds[g], pdfs[g]);
+  }
+  group_spectra.swap(spectra);
+  e_mode = E_TABULATED;
 }
 
-double pyne::Sampler::sample_e(int e_idx, double rand) {
-   double e_min = e_bounds[e_idx];
-   double e_max = e_bounds[e_idx + 1];
-   return rand * (e_max - e_min) + e_min;
+double pyne::Sampler::sample_w(int64_t pdf_idx) const {
+  if (bias_mode == ANALOG)
+    return 1.0;
+  if (mesh_at != NULL)
+    return mesh_at->row_weights[pdf_idx/num_e_groups];
+  return biased_weights[pdf_idx];
 }
 
-double pyne::Sampler::sample_w(int pdf_idx) {
-  return (bias_mode == ANALOG) ? 1.0 : biased_weights[pdf_idx];
+int64_t pyne::Sampler::sample_pdf(double rand1, double rand2) const {
+  return (mesh_at != NULL) ? mesh_at->sample_pdf(rand1, rand2) :
+                             at->sample_pdf(rand1, rand2);
 }
 
-void pyne::Sampler::normalize_pdf(std::vector<double> & pdf) {
+double pyne::Sampler::normalize_pdf(std::vector<double> & pdf) {
   double sum = 0;
   for (int i=0; i<pdf.size(); ++i)
     sum += pdf[i];
   for (int i=0; i<pdf.size(); ++i)
     pdf[i] /= sum;
+  return sum;
 }
 
 int pyne::Sampler::num_groups(moab::Tag tag) {
@@ -553,7 +909,7 @@ int pyne::Sampler::get_max_num_cells(moab::Tag cell_fracs_tag) {
   }
 }
 
-int pyne::Sampler::get_cell_list_size() {
+int pyne::Sampler::get_cell_list_size() const {
    // cell_list_size should be:
    // 0: for unstructured mesh
    // 1: for sub-voxel R2S
@@ -569,59 +925,1046 @@ int pyne::Sampler::get_cell_list_size() {
    }
 }
 
+// Sampler state files start with a fixed header, followed by the tables in
+// 64-byte aligned sections so that each can be used in place from a mapping.
+static const char SAMPLER_STATE_MAGIC[8] = {'P','Y','N','E','S','M','P','L'};
+static const int32_t SAMPLER_STATE_VERSION = 3;
+enum SamplerStateSection {STATE_E_BOUNDS, STATE_VE_TABLE, STATE_AT_PROB,
+                          STATE_AT_ALIAS, STATE_BIASED_WEIGHTS,
+                          STATE_CELL_NUMBER, STATE_CELL_FRACS, STATE_ROW_PROB,
+                          STATE_ROW_ALIAS, STATE_GROUP_PROB, STATE_GROUP_ALIAS,
+                          STATE_ROW_WEIGHTS, STATE_CELL_PTR, NUM_STATE_SECTIONS};
+struct SamplerStateHeader {
+  char magic[8];
+  int32_t version;
+  int32_t mode;
+  int32_t bias_mode;
+  int32_t mesh_mode;
+  int32_t ve_type;
+  int32_t verts_per_ve;
+  int32_t num_ves;
+  int32_t num_e_groups;
+  int32_t num_bias_groups;
+  int32_t max_num_cells;
+  int32_t p_src_num_cells;
+  int32_t has_cell_fracs;
+  int32_t num_rows; // rows of the MeshAliasTable, 0 for a flat AliasTable
+  int32_t at_n; // bins of the flat AliasTable
+  int64_t ve_stride;
+  int64_t source_size;
+  int64_t source_mtime;
+  double source_strength;
+  double biased_strength;
+  uint64_t offset[NUM_STATE_SECTIONS]; // in bytes from the start of the file
+  uint64_t count[NUM_STATE_SECTIONS]; // in elements
+};
+
+// Appends a section, padded to a 64-byte boundary, and records its place.
+static void write_state_section(std::ofstream& f, SamplerStateHeader& header,
+                                int section, const void* data, size_t count,
+                                size_t elem_size) {
+  static const char pad[64] = {0};
+  uint64_t pos = f.tellp();
+  f.write(pad, (64 - pos % 64) % 64);
+  header.offset[section] = f.tellp();
+  header.count[section] = count;
+  if (count > 0)
+    f.write(static_cast<const char*>(data), count*elem_size);
+}
+
+// Returns a section of a mapped state file, checking that it is in bounds.
+template <typename T>
+static const T* state_section(const pyne::MappedFile& file,
+                              const SamplerStateHeader& header, int section,
+                              size_t expected) {
+  if (header.count[section] != expected ||
+      header.offset[section] + expected*sizeof(T) > file.size())
+    throw std::runtime_error("Sampler state file is corrupt.");
+  if (expected == 0)
+    return NULL;
+  return reinterpret_cast<const T*>(file.data() + header.offset[section]);
+}
+
+void pyne::Sampler::write_state(std::string filename) const {
+  SamplerStateHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, SAMPLER_STATE_MAGIC, sizeof(header.magic));
+  header.version = SAMPLER_STATE_VERSION;
+  header.mode = mode;
+  header.bias_mode = bias_mode;
+  header.mesh_mode = mesh_mode;
+  header.ve_type = ve_type;
+  header.verts_per_ve = verts_per_ve;
+  header.num_ves = num_ves;
+  header.num_e_groups = num_e_groups;
+  header.num_bias_groups = num_bias_groups;
+  header.max_num_cells = max_num_cells;
+  header.p_src_num_cells = p_src_num_cells;
+  header.has_cell_fracs = has_cell_fracs;
+  header.num_rows = (mesh_at != NULL) ? mesh_at->num_rows : 0;
+  header.at_n = (at != NULL) ? at->n : 0;
+  header.ve_stride = ve_table.column_stride();
+  header.source_size = source_size;
+  header.source_mtime = source_mtime;
+  header.source_strength = source_strength;
+  header.biased_strength = biased_strength;
+
+  std::ofstream f(filename.c_str(), std::ios::binary | std::ios::trunc);
+  if (!f)
+    throw std::runtime_error("Could not create sampler state file " + filename);
+  f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  write_state_section(f, header, STATE_E_BOUNDS, &e_bounds[0],
+                      e_bounds.size(), sizeof(double));
+  write_state_section(f, header, STATE_VE_TABLE, ve_table.column(0),
+                      VolumeElementTable::NUM_COLUMNS*header.ve_stride,
+                      sizeof(double));
+  if (at != NULL) {
+    write_state_section(f, header, STATE_AT_PROB, at->prob_data(), at->n,
+                        sizeof(double));
+    write_state_section(f, header, STATE_AT_ALIAS, at->alias_data(), at->n,
+                        sizeof(int));
+  } else {
+    write_state_section(f, header, STATE_ROW_PROB, mesh_at->row_at->prob_data(),
+                        mesh_at->num_rows, sizeof(double));
+    write_state_section(f, header, STATE_ROW_ALIAS,
+                        mesh_at->row_at->alias_data(), mesh_at->num_rows,
+                        sizeof(int));
+    write_state_section(f, header, STATE_GROUP_PROB, mesh_at->group_prob.data(),
+                        mesh_at->group_prob.size(), sizeof(double));
+    write_state_section(f, header, STATE_GROUP_ALIAS,
+                        mesh_at->group_alias.data(),
+                        mesh_at->group_alias.size(), sizeof(int));
+    write_state_section(f, header, STATE_ROW_WEIGHTS,
+                        mesh_at->row_weights.data(),
+                        mesh_at->row_weights.size(), sizeof(double));
+  }
+  write_state_section(f, header, STATE_BIASED_WEIGHTS, biased_weights.data(),
+                      biased_weights.size(), sizeof(double));
+  write_state_section(f, header, STATE_CELL_PTR, cell_ptr.data(),
+                      cell_ptr.size(), sizeof(int));
+  write_state_section(f, header, STATE_CELL_NUMBER, cell_number.data(),
+                      cell_number.size(), sizeof(int));
+  write_state_section(f, header, STATE_CELL_FRACS, cell_fracs.data(),
+                      cell_fracs.size(), sizeof(double));
+  f.seekp(0);
+  f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  if (!f)
+    throw std::runtime_error("Problem writing sampler state file " + filename);
+}
+
+pyne::Sampler* pyne::Sampler::read_state(std::string filename) {
+  PYNE_TIME(TIME_SAMPLER_READ_STATE);
+  MappedFile* file = new MappedFile(filename);
+  Sampler* s = new Sampler();
+  s->state = file;
+  const SamplerStateHeader& header =
+      *reinterpret_cast<const SamplerStateHeader*>(file->data());
+  if (file->size() < sizeof(header) ||
+      memcmp(header.magic, SAMPLER_STATE_MAGIC, sizeof(header.magic)) != 0 ||
+      header.version != SAMPLER_STATE_VERSION) {
+    delete s;
+    throw std::runtime_error(filename + " is not a sampler state file.");
+  }
+  try {
+    s->mode = header.mode;
+    s->bias_mode = static_cast<BiasMode>(header.bias_mode);
+    s->mesh_mode = static_cast<MeshMode>(header.mesh_mode);
+    s->ve_type = static_cast<moab::EntityType>(header.ve_type);
+    s->verts_per_ve = header.verts_per_ve;
+    s->num_ves = header.num_ves;
+    s->num_e_groups = header.num_e_groups;
+    s->num_bias_groups = header.num_bias_groups;
+    s->max_num_cells = header.max_num_cells;
+    s->p_src_num_cells = header.p_src_num_cells;
+    s->has_cell_fracs = header.has_cell_fracs;
+    s->source_size = header.source_size;
+    s->source_mtime = header.source_mtime;
+    s->source_strength = header.source_strength;
+    s->biased_strength = header.biased_strength;
+
+    size_t count = header.count[STATE_E_BOUNDS];
+    const double* e_bounds = state_section<double>(*file, header,
+        STATE_E_BOUNDS, count);
+    s->e_bounds.assign(e_bounds, e_bounds + count);
+    s->ve_table.refer(header.num_ves, header.ve_stride,
+        state_section<double>(*file, header, STATE_VE_TABLE,
+            VolumeElementTable::NUM_COLUMNS*header.ve_stride));
+    if (header.num_rows == 0) {
+      s->at = new AliasTable(header.at_n,
+          state_section<double>(*file, header, STATE_AT_PROB, header.at_n),
+          state_section<int>(*file, header, STATE_AT_ALIAS, header.at_n));
+    } else {
+      size_t num_rows = header.num_rows;
+      size_t num_entries = num_rows*header.num_e_groups;
+      s->mesh_at = new MeshAliasTable(num_rows, header.num_e_groups,
+          state_section<double>(*file, header, STATE_ROW_PROB, num_rows),
+          state_section<int>(*file, header, STATE_ROW_ALIAS, num_rows),
+          state_section<double>(*file, header, STATE_GROUP_PROB, num_entries),
+          state_section<int>(*file, header, STATE_GROUP_ALIAS, num_entries),
+          state_section<double>(*file, header, STATE_ROW_WEIGHTS,
+              header.count[STATE_ROW_WEIGHTS] > 0 ? num_rows : 0));
+    }
+    count = header.count[STATE_BIASED_WEIGHTS];
+    s->biased_weights.refer(state_section<double>(*file, header,
+        STATE_BIASED_WEIGHTS, count), count);
+    s->cell_ptr.refer(state_section<int>(*file, header, STATE_CELL_PTR,
+        header.num_ves + 1), header.num_ves + 1);
+    count = header.count[STATE_CELL_NUMBER];
+    s->cell_number.refer(state_section<int>(*file, header,
+        STATE_CELL_NUMBER, count), count);
+    count = header.count[STATE_CELL_FRACS];
+    s->cell_fracs.refer(state_section<double>(*file, header,
+        STATE_CELL_FRACS, count), count);
+    if (s->cell_ptr[header.num_ves] != s->cell_number.size())
+      throw std::runtime_error("Sampler state file is corrupt.");
+    s->index_rows();
+  } catch (...) {
+    delete s;
+    throw;
+  }
+  return s;
+}
+
+bool pyne::Sampler::matches_source(std::string filename, int mode) const {
+  int64_t size, mtime;
+  source_file_stat(filename, size, mtime);
+  return mode == this->mode && size == source_size && mtime == source_mtime;
+}
+
+pyne::Sampler* pyne::Sampler::read_shared_state(std::string state_file,
+    std::string filename, std::map<std::string, std::string> tag_names,
+    std::vector<double> e_bounds, int mode) {
+  Sampler* s = matching_state(state_file, filename, mode);
+  if (s != NULL)
+    return s;
+  std::string lock_file = state_file + ".lock";
+#if !defined __WIN_MSVC__
+  // The build is serialized with an advisory lock on the lock file, which the
+  // system releases if the process that holds it dies. The holder removes the
+  // file before it unlocks, so a process that waited on a removed file opens
+  // the new one and waits again.
+  int fd;
+  while (true) {
+    fd = open(lock_file.c_str(), O_CREAT | O_RDWR, 0644);
+    if (fd < 0)
+      throw std::runtime_error("Could not open lock file " + lock_file);
+    int rval;
+    do {
+      rval = flock(fd, LOCK_EX);
+    } while (rval != 0 && errno == EINTR);
+    if (rval != 0) {
+      close(fd);
+      throw std::runtime_error("Could not lock " + lock_file);
+    }
+    struct stat held, named;
+    if (fstat(fd, &held) == 0 && stat(lock_file.c_str(), &named) == 0 &&
+        held.st_dev == named.st_dev && held.st_ino == named.st_ino)
+      break;
+    close(fd);
+  }
+#endif
+  try {
+    // the state may have been written while the lock was being taken
+    s = matching_state(state_file, filename, mode);
+    if (s == NULL) {
+      // Written under another name and renamed into place, so that no
+      // process maps a partial file. Processes still mapping an older
+      // state keep their copy.
+      std::string tmp_file = state_file + ".tmp";
+      {
+        Sampler built(filename, tag_names, e_bounds, mode);
+        built.write_state(tmp_file);
+      }
+      if (rename(tmp_file.c_str(), state_file.c_str()) != 0)
+        throw std::runtime_error("Could not replace sampler state file " +
+                                 state_file);
+      s = read_state(state_file);
+    }
+  } catch (...) {
+#if !defined __WIN_MSVC__
+    remove(lock_file.c_str());
+    close(fd);
+#endif
+    throw;
+  }
+#if !defined __WIN_MSVC__
+  remove(lock_file.c_str());
+  close(fd);
+#endif
+  return s;
+}
+
+// Reads the header of a sampler state file without mapping the file.
+static SamplerStateHeader read_state_header(std::string filename) {
+  SamplerStateHeader header;
+  std::ifstream f(filename.c_str(), std::ios::binary);
+  if (!f)
+    throw pyne::FileNotFound(filename);
+  f.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!f || memcmp(header.magic, SAMPLER_STATE_MAGIC,
+                   sizeof(header.magic)) != 0 ||
+      header.version != SAMPLER_STATE_VERSION)
+    throw std::runtime_error(filename + " is not a sampler state file.");
+  return header;
+}
+
+pyne::PartitionedSampler::PartitionedSampler(
+    std::vector<std::string> state_files)
+  : state_files(state_files), at(NULL), weights(state_files.size()),
+    cell_list_sizes(state_files.size()), cell_list_size(0),
+    samplers(new std::atomic<const Sampler*>[state_files.size()]) {
+  int n = state_files.size();
+  if (n == 0)
+    throw std::invalid_argument("A partitioned sampler needs a partition.");
+  std::vector<double> p(n);
+  std::vector<double> q(n);
+  double p_sum = 0.0;
+  double q_sum = 0.0;
+  int mode = 0;
+  for (int i=0; i<n; ++i) {
+    samplers[i].store(NULL);
+    SamplerStateHeader header = read_state_header(state_files[i]);
+    if (i == 0)
+      mode = header.mode;
+    else if (header.mode != mode)
+      throw std::invalid_argument("Partitions must be sampled in one mode.");
+    p[i] = header.source_strength;
+    q[i] = header.biased_strength;
+    if (p[i] > 0.0 && !(q[i] > 0.0))
+      throw std::invalid_argument(state_files[i] + " has a source but no "
+                                  "biased source.");
+    p_sum += p[i];
+    q_sum += q[i];
+    // as Sampler::get_cell_list_size
+    if (header.ve_type == moab::MBTET || !header.has_cell_fracs)
+      cell_list_sizes[i] = 0;
+    else if (header.mesh_mode == VOXEL)
+      cell_list_sizes[i] = header.max_num_cells;
+    else
+      cell_list_sizes[i] = 1;
+    cell_list_size = std::max(cell_list_size, cell_list_sizes[i]);
+  }
+  if (!(p_sum > 0.0 && q_sum > 0.0))
+    throw std::invalid_argument("The partitions have no source.");
+  // A particle born in partition i is drawn with probability q[i]/q_sum
+  // rather than p[i]/p_sum, which its weight makes up for. Both are the same
+  // in analog mode, so the factors are exactly 1.
+  for (int i=0; i<n; ++i) {
+    weights[i] = (q[i] > 0.0) ? (p[i]/p_sum)/(q[i]/q_sum) : 0.0;
+    q[i] /= q_sum;
+  }
+  at = new AliasTable(std::move(q));
+}
+
+pyne::PartitionedSampler::~PartitionedSampler() {
+  delete at;
+  for (int i=0; i<state_files.size(); ++i)
+    delete samplers[i].load();
+}
+
+int pyne::PartitionedSampler::sample_partition(double rand,
+                                               double& rest) const {
+  // As in GroupSpectrum::sample, rand is split into a column and a uniform
+  // number for the accept/alias decision, and what that decision leaves over
+  // is rescaled. The rest is kept below 1, which the samplers need.
+  const double* prob = at->prob_data();
+  const int* alias = at->alias_data();
+  double r = rand * at->n;
+  int i = std::min((int) r, at->n - 1);
+  double r2 = r - i;
+  int k;
+  if (r2 < prob[i] || prob[i] >= 1.0) {
+    k = i;
+    rest = r2 / prob[i];
+  } else {
+    k = alias[i];
+    rest = (r2 - prob[i]) / (1.0 - prob[i]);
+  }
+  rest = std::min(rest, 1.0 - DBL_EPSILON/2);
+  return k;
+}
+
+const pyne::Sampler* pyne::PartitionedSampler::partition(int i) const {
+  if (i < 0 || i >= state_files.size())
+    throw std::out_of_range("Partition index out of range.");
+  const Sampler* s = samplers[i].load(std::memory_order_acquire);
+  if (s == NULL) {
+    std::lock_guard<std::mutex> lock(load_mutex);
+    s = samplers[i].load(std::memory_order_relaxed);
+    if (s == NULL) {
+      s = Sampler::read_state(state_files[i]);
+      samplers[i].store(s, std::memory_order_release);
+    }
+  }
+  return s;
+}
+
+void pyne::PartitionedSampler::particle_birth_batch(const double* rands,
+    size_t n, SourceParticleSoA& out) const {
+  double r[6];
+  for (size_t i=0; i<n; ++i) {
+    std::copy(rands + 6*i, rands + 6*i + 6, r);
+    int k = sample_partition(rands[6*i], r[0]);
+    int* cells = (cell_list_size > 0) ? out.cell_list + i*cell_list_size
+                                      : NULL;
+    SourceParticleSoA one = {out.x + i, out.y + i, out.z + i, out.e + i,
+                             out.w + i, cells};
+    partition(k)->particle_birth_batch(r, 1, one);
+    out.w[i] *= weights[k];
+    for (int c=cell_list_sizes[k]; c<cell_list_size; ++c)
+      cells[c] = -1;
+  }
+}
+
+pyne::SourceParticle pyne::PartitionedSampler::particle_birth(
+    std::vector<double> rands) const {
+  double x, y, z, e, w;
+  std::vector<int> cell_list(cell_list_size);
+  SourceParticleSoA out = {&x, &y, &z, &e, &w,
+                           cell_list.empty() ? NULL : &cell_list[0]};
+  particle_birth_batch(&rands[0], 1, out);
+  return SourceParticle(x, y, z, e, w, cell_list);
+}
+
+pyne::Sampler::Sampler()
+  : num_ves(0), mesh(NULL), at(NULL), mesh_at(NULL), state(NULL),
+    e_mode(E_LINEAR), has_cell_fracs(false), source_strength(0.0),
+    biased_strength(0.0) {}
+
 // Random-number sampling using the Walker-Vose alias method,
 // Copyright: Joachim Wuttke, Forschungszentrum Juelich GmbH (2013)
 // M. D. Vose, IEEE T. Software Eng. 17, 972 (1991)
 // A. J. Walker, Electronics Letters 10, 127 (1974); ACM TOMS 3, 253 (1977)
 
-pyne::AliasTable::AliasTable(std::vector<double> p) {
-  n = p.size();
-  prob.resize(n);
-  alias.resize(n);
-  std::vector<double> small(n);
-  std::vector<double> large(n);
+// Builds the alias table of a PDF normalized to n in place: the probabilities
+// overwrite p. work is scratch space of n entries that holds the small list
+// from the front and the large list from the back, since no index is on both.
+static void build_alias_table(int n, double* p, int* alias, int* work) {
   int i, a, g;
 
-  for (i=0; i<n; ++i)
-    p[i] *= n;
-
   // Set separate index lists for small and large probabilities:
   int n_s = 0;
   int n_l = 0;
   for (i=n-1; i>=0; --i) {
     // at variance from Schwarz, we revert the index order
     if (p[i] < 1)
-      small[n_s++] = i;
+      work[n_s++] = i;
     else
-      large[n_l++] = i;
+      work[n - ++n_l] = i;
   }
 
-  // Work through index lists
+  // Work through index lists, the probability of a is p[a] as it stands
   while(n_s && n_l) {
-    a = small[--n_s]; // Schwarz's l
-    g = large[--n_l]; // Schwarz's g
-    prob[a] = p[a];
+    a = work[--n_s]; // Schwarz's l
+    g = work[n - n_l--]; // Schwarz's g
     alias[a] = g;
     p[g] = p[g] + p[a] - 1;
     if (p[g] < 1)
-      small[n_s++] = g;
+      work[n_s++] = g;
     else
-      large[n_l++] = g;
+      work[n - ++n_l] = g;
   }
 
   while(n_l)
-    prob[large[--n_l]] = 1;
+    p[work[n - n_l--]] = 1;
 
   while(n_s)
     // can only happen through numeric instability
-    prob[small[--n_s] ] = 1;
+    p[work[--n_s]] = 1;
 }
 
-int pyne::AliasTable::sample_pdf(double rand1, double rand2) {
+// Parallel construction of an alias table by the sweeping method of
+// L. Huebschle-Schneider and P. Sanders, "Parallel Weighted Random Sampling"
+// (2019). The light bins (p < 1) and the heavy bins (p >= 1), each in index
+// order, are merged into one sweep that fills every bin from the current
+// heavy bin. After i light and j heavy bins are filled, i + j of weight has
+// been placed, so the weight the sweep has taken from heavy bin j follows from
+// prefix sums over the light and heavy weights alone. That lets the sweep be
+// cut into independent pieces, one per thread.
+namespace {
+
+// Indices per block of the prefix sums, a multiple of 64 so that each block
+// owns whole words of the heavy bit set
+const int SWEEP_BLOCK_SIZE = 4096;
+
+// Compensated (Neumaier) sum, the spill at a cut is the small difference of
+// sums over up to n weights, which plain summation would get wrong
+struct CompensatedSum {
+  double sum, c;
+  CompensatedSum(double x=0.0) : sum(x), c(0.0) {};
+  void add(double x) {
+    double t = sum + x;
+    c += (fabs(sum) >= fabs(x)) ? (sum - t) + x : (x - t) + sum;
+    sum = t;
+  };
+  double value() const {return sum + c;};
+};
+
+struct AliasSweep {
+  int n; // number of bins
+  double* p; // weights, normalized to n, overwritten by the probabilities
+  int* alias;
+  std::vector<uint64_t> heavy; // set bit for each heavy bin
+  std::vector<long long> light_cnt; // lights before each block
+  std::vector<double> light_sum; // light weight before each block
+  std::vector<double> heavy_sum; // heavy weight before each block
+
+  bool is_heavy(long long i) const {return (heavy[i >> 6] >> (i & 63)) & 1;};
+
+  // Returns the index of the first bin from i on that is heavy, or light, or
+  // n if there is none.
+  long long next(long long i, bool want_heavy) const {
+    while (i < n) {
+      uint64_t word = heavy[i >> 6];
+      if (!want_heavy)
+        word = ~word;
+      word &= ~(uint64_t) 0 << (i & 63);
+      if (word != 0) {
+        long long k = i & ~63LL;
+        for (; !(word & 1); word >>= 1)
+          k++;
+        return k < n ? k : n;
+      }
+      i = (i | 63) + 1;
+    }
+    return n;
+  };
+
+  // Returns the weight of the first k light or heavy bins, and sets pos to
+  // the index of bin k of that kind, n if there are only k.
+  double prefix(long long k, bool want_heavy, long long& pos) const {
+    int nb = (int) light_cnt.size() - 1;
+    // the last block with fewer than k such bins before it, or the first
+    int lo = 0;
+    int hi = nb;
+    while (hi - lo > 1) {
+      int mid = (lo + hi) / 2;
+      long long cnt = want_heavy ? (long long) mid*SWEEP_BLOCK_SIZE - \
+                                   light_cnt[mid] : light_cnt[mid];
+      if (cnt < k)
+        lo = mid;
+      else
+        hi = mid;
+    }
+    long long cnt = want_heavy ? (long long) lo*SWEEP_BLOCK_SIZE - \
+                                 light_cnt[lo] : light_cnt[lo];
+    CompensatedSum sum(want_heavy ? heavy_sum[lo] : light_sum[lo]);
+    pos = next((long long) lo*SWEEP_BLOCK_SIZE, want_heavy);
+    for (; cnt < k && pos < n; ++cnt) {
+      sum.add(p[pos]);
+      pos = next(pos + 1, want_heavy);
+    }
+    return sum.value();
+  };
+};
+
+// Where a piece of the sweep starts: i light and j heavy bins have been
+// filled, taking spill of weight from heavy bin j, the next light bin and
+// heavy bin j are at light_pos and heavy_pos, and heavy bin j weighs w.
+struct SweepCut {
+  long long i, j, light_pos, heavy_pos;
+  double spill, w;
+};
+
+void build_alias_table_parallel(int n, double* p, int* alias,
+                                int num_threads) {
+  AliasSweep s;
+  s.n = n;
+  s.p = p;
+  s.alias = alias;
+  int nb = (n + SWEEP_BLOCK_SIZE - 1) / SWEEP_BLOCK_SIZE;
+  s.heavy.assign((n + 63) / 64, 0);
+  s.light_cnt.assign(nb + 1, 0);
+  s.light_sum.assign(nb + 1, 0.0);
+  s.heavy_sum.assign(nb + 1, 0.0);
+
+  // normalize to n, mark the heavy bins and sum the weights of each block
+  #pragma omp parallel for schedule(static) num_threads(num_threads)
+  for (int b=0; b<nb; ++b) {
+    long long cnt = 0;
+    CompensatedSum lsum;
+    CompensatedSum hsum;
+    int end = std::min(n, (b + 1) * SWEEP_BLOCK_SIZE);
+    for (int i=b*SWEEP_BLOCK_SIZE; i<end; ++i) {
+      p[i] *= n;
+      if (p[i] < 1) {
+        cnt++;
+        lsum.add(p[i]);
+      } else {
+        s.heavy[i >> 6] |= (uint64_t) 1 << (i & 63);
+        hsum.add(p[i]);
+      }
+    }
+    s.light_cnt[b + 1] = cnt;
+    s.light_sum[b + 1] = lsum.value();
+    s.heavy_sum[b + 1] = hsum.value();
+  }
+  CompensatedSum lsum;
+  CompensatedSum hsum;
+  for (int b=0; b<nb; ++b) {
+    s.light_cnt[b + 1] += s.light_cnt[b];
+    lsum.add(s.light_sum[b + 1]);
+    hsum.add(s.heavy_sum[b + 1]);
+    s.light_sum[b + 1] = lsum.value();
+    s.heavy_sum[b + 1] = hsum.value();
+  }
+  long long num_light = s.light_cnt[nb];
+  long long num_heavy = n - num_light;
+
+  // cut the sweep into pieces of about n / num_pieces bins. For a cut after k
+  // bins the spill k - light(i) - heavy(k - i) grows with i, the cut is at
+  // the first i where it is not negative, so heavy bin j can cover it.
+  int num_pieces = std::max(1, std::min(num_threads, n / SWEEP_BLOCK_SIZE));
+  std::vector<SweepCut> cuts(num_pieces + 1);
+  #pragma omp parallel for schedule(static) num_threads(num_threads)
+  for (int c=0; c<=num_pieces; ++c) {
+    long long k = (long long) c * n / num_pieces;
+    long long lo = std::max(0LL, k - num_heavy);
+    long long hi = std::min(k, num_light);
+    long long lpos, hpos;
+    while (lo < hi) {
+      long long mid = (lo + hi) / 2;
+      double spill = k - s.prefix(mid, false, lpos) - \
+                     s.prefix(k - mid, true, hpos);
+      if (spill >= 0.0)
+        hi = mid;
+      else
+        lo = mid + 1;
+    }
+    SweepCut& cut = cuts[c];
+    cut.i = lo;
+    cut.j = k - lo;
+    cut.spill = k - s.prefix(cut.i, false, cut.light_pos) - \
+                s.prefix(cut.j, true, cut.heavy_pos);
+    cut.w = cut.j < num_heavy ? p[cut.heavy_pos] : 0.0;
+    cut.spill = std::max(0.0, std::min(cut.spill, cut.w));
+  }
+
+  // sweep each piece, the weight of the heavy bin it ends on is taken from
+  // its cut, since the next piece overwrites that with a probability
+  #pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+  for (int c=0; c<num_pieces; ++c) {
+    const SweepCut& end = cuts[c + 1];
+    long long i = cuts[c].i;
+    long long j = cuts[c].j;
+    long long lpos = cuts[c].light_pos;
+    long long hpos = cuts[c].heavy_pos;
+    double r = cuts[c].w - cuts[c].spill; // weight left in heavy bin j
+    while (i < end.i || j < end.j) {
+      if (j < end.j && (r < 1 || i == end.i)) {
+        // heavy bin j is filled with what is left of it and its remainder
+        // taken from the next heavy bin; without one, numeric instability
+        // left too much or too little, so it keeps itself
+        long long npos = (j + 1 == end.j) ? end.heavy_pos : \
+                         s.next(hpos + 1, true);
+        double nw = (j + 1 == end.j) ? end.w : p[npos];
+        if (r < 1 && j + 1 < num_heavy) {
+          p[hpos] = std::max(r, 0.0);
+          alias[hpos] = npos;
+          r = nw - (1 - p[hpos]);
+        } else {
+          p[hpos] = 1;
+          alias[hpos] = hpos;
+          r = nw;
+        }
+        hpos = npos;
+        j++;
+      } else {
+        // light bin i keeps its weight and aliases the current heavy bin
+        if (j < num_heavy) {
+          alias[lpos] = hpos;
+          r -= 1 - p[lpos];
+        } else {
+          // can only happen through numeric instability
+          p[lpos] = 1;
+          alias[lpos] = lpos;
+        }
+        i++;
+        if (i < end.i)
+          lpos = s.next(lpos + 1, false);
+      }
+    }
+  }
+}
+
+}  // namespace
+
+pyne::AliasTable::AliasTable(std::vector<double> p, int num_threads)
+  : prob_view(NULL), alias_view(NULL) {
+#ifdef _OPENMP
+  if (num_threads < 1)
+    num_threads = omp_get_max_threads();
+#else
+  num_threads = 1;
+#endif
+  n = p.size();
+  alias.resize(n);
+  if (num_threads > 1 && n > 0) {
+    build_alias_table_parallel(n, &p[0], &alias[0], num_threads);
+  } else if (n > 0) {
+    std::vector<int> work(n);
+    for (int i=0; i<n; ++i)
+      p[i] *= n;
+    build_alias_table(n, &p[0], &alias[0], &work[0]);
+  }
+  prob.swap(p);
+}
+
+pyne::CompactAliasTable::CompactAliasTable(std::vector<double> p,
+                                           int num_threads) {
+  AliasTable at(std::move(p), num_threads);
+  n = at.n;
+  prob.assign(at.prob.begin(), at.prob.end());
+  alias.swap(at.alias);
+}
+
+int pyne::CompactAliasTable::sample_pdf(double rand1, double rand2) const {
+  PYNE_COUNT(COUNT_ALIAS_SAMPLES);
   int i = (int) n * rand1;
   return rand2 < prob[i] ? i : alias[i];
 }
 
+pyne::AliasTable::AliasTable(int n, const double* prob, const int* alias)
+  : n(n), prob_view(prob), alias_view(alias) {}
+
+int pyne::AliasTable::sample_pdf(double rand1, double rand2) const {
+  PYNE_COUNT(COUNT_ALIAS_SAMPLES);
+  int i = (int) n * rand1;
+  if (prob_view != NULL)
+    return rand2 < prob_view[i] ? i : alias_view[i];
+  return rand2 < prob[i] ? i : alias[i];
+}
+
+pyne::MeshAliasTable::MeshAliasTable(int num_rows, int num_groups)
+  : num_rows(num_rows), num_groups(num_groups), row_at(NULL),
+    source_strength(0.0), biased_strength(0.0),
+    build_prob((size_t) num_rows*num_groups, 1.0),
+    build_alias((size_t) num_rows*num_groups), build_work(num_groups) {
+  for (size_t i=0; i<build_alias.size(); ++i)
+    build_alias[i] = i % num_groups;
+}
+
+pyne::MeshAliasTable::MeshAliasTable(int num_rows, int num_groups,
+                                     const double* row_prob,
+                                     const int* row_alias,
+                                     const double* group_prob,
+                                     const int* group_alias,
+                                     const double* row_weights)
+  : num_rows(num_rows), num_groups(num_groups), source_strength(0.0),
+    biased_strength(0.0) {
+  row_at = new AliasTable(num_rows, row_prob, row_alias);
+  this->group_prob.refer(group_prob, (size_t) num_rows*num_groups);
+  this->group_alias.refer(group_alias, (size_t) num_rows*num_groups);
+  if (row_weights != NULL)
+    this->row_weights.refer(row_weights, num_rows);
+}
+
+double pyne::MeshAliasTable::set_row(int row, const double* p) {
+  double sum = 0.0;
+  for (int g=0; g<num_groups; ++g)
+    sum += p[g];
+  if (sum <= 0.0)
+    return 0.0; // never sampled, keep the identity table
+  size_t first = (size_t) row*num_groups;
+  double* prob = &build_prob[first];
+  for (int g=0; g<num_groups; ++g)
+    prob[g] = p[g]*num_groups/sum;
+  build_alias_table(num_groups, prob, &build_alias[first], &build_work[0]);
+  return sum;
+}
+
+void pyne::MeshAliasTable::set_row_pdf(std::vector<double> row_pdf) {
+  double sum = 0.0;
+  for (int i=0; i<row_pdf.size(); ++i)
+    sum += row_pdf[i];
+  if (sum <= 0.0)
+    throw std::runtime_error("Source data are ALL ZERO!");
+  for (int i=0; i<row_pdf.size(); ++i)
+    row_pdf[i] /= sum;
+  delete row_at;
+  row_at = new AliasTable(std::move(row_pdf));
+  group_prob.swap_in(build_prob);
+  group_alias.swap_in(build_alias);
+}
+
+int64_t pyne::MeshAliasTable::sample_pdf(double rand1, double rand2) const {
+  PYNE_COUNT(COUNT_ALIAS_SAMPLES);
+  // The row is selected with rand1 and rand2 as in AliasTable::sample_pdf.
+  // The fraction of rand1 left over after picking the row column, and the
+  // part of rand2 left over by the accept/alias decision, are both uniform
+  // and are reused to sample the group within the row.
+  double r = rand1 * num_rows;
+  int i = std::min((int) r, num_rows - 1);
+  double f = r - i;
+  double p = row_at->prob_data()[i];
+  int row;
+  double u;
+  if (rand2 < p) {
+    row = i;
+    u = rand2 / p;
+  } else {
+    row = row_at->alias_data()[i];
+    u = (rand2 - p) / (1.0 - p);
+  }
+  int64_t first = (int64_t) row*num_groups;
+  int64_t j = first + std::min((int) (f * num_groups), num_groups - 1);
+  int64_t g = (u < group_prob[j]) ? j - first : group_alias[j];
+  return first + g;
+}
+
+pyne::MeshAliasTable::~MeshAliasTable() {
+  delete row_at;
+}
+
+// Writes a contiguous 1D data set, which keeps the sidecar mappable.
+static void write_h5_array(hid_t h5file, std::string path, hid_t dtype,
+                           const void* data, hsize_t size) {
+  hid_t space = H5Screate_simple(1, &size, NULL);
+  hid_t set = H5Dcreate2(h5file, path.c_str(), dtype, space, H5P_DEFAULT,
+                         H5P_DEFAULT, H5P_DEFAULT);
+  if (size > 0)
+    H5Dwrite(set, dtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+  H5Dclose(set);
+  H5Sclose(space);
+}
+
+// Reads a 1D data set into a vector, resized to fit.
+template <typename T>
+static void read_h5_array(hid_t h5file, std::string path, hid_t dtype,
+                          std::vector<T>& data) {
+  hid_t set = H5Dopen2(h5file, path.c_str(), H5P_DEFAULT);
+  if (set < 0)
+    throw std::runtime_error("Alias table data set " + path + " not found.");
+  hid_t space = H5Dget_space(set);
+  hsize_t size;
+  H5Sget_simple_extent_dims(space, &size, NULL);
+  data.resize(size);
+  if (size > 0)
+    H5Dread(set, dtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data[0]);
+  H5Sclose(space);
+  H5Dclose(set);
+}
+
+pyne::MeshAliasTable::MeshAliasTable(std::string filename)
+  : row_at(NULL), source_strength(0.0), biased_strength(0.0) {
+  hid_t h5file = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (h5file < 0)
+    throw h5wrap::FileNotHDF5(filename);
+  std::vector<double> row_prob;
+  std::vector<int> row_alias;
+  std::vector<double> weights;
+  std::vector<double> strengths;
+  read_h5_array(h5file, "/row_prob", H5T_NATIVE_DOUBLE, row_prob);
+  read_h5_array(h5file, "/row_alias", H5T_NATIVE_INT, row_alias);
+  read_h5_array(h5file, "/group_prob", H5T_NATIVE_DOUBLE, build_prob);
+  read_h5_array(h5file, "/group_alias", H5T_NATIVE_INT, build_alias);
+  read_h5_array(h5file, "/row_weights", H5T_NATIVE_DOUBLE, weights);
+  read_h5_array(h5file, "/strengths", H5T_NATIVE_DOUBLE, strengths);
+  H5Fclose(h5file);
+  num_rows = row_prob.size();
+  if (num_rows == 0 || row_alias.size() != num_rows ||
+      build_prob.size() % num_rows != 0 ||
+      build_alias.size() != build_prob.size() ||
+      !(weights.empty() || weights.size() == num_rows) ||
+      strengths.size() != 2)
+    throw std::runtime_error("Alias table file " + filename + " is corrupt.");
+  source_strength = strengths[0];
+  biased_strength = strengths[1];
+  num_groups = build_prob.size() / num_rows;
+  row_at = new AliasTable(std::vector<double>());
+  row_at->n = num_rows;
+  row_at->prob.swap(row_prob);
+  row_at->alias.swap(row_alias);
+  group_prob.swap_in(build_prob);
+  group_alias.swap_in(build_alias);
+  row_weights.swap_in(weights);
+}
+
+void pyne::MeshAliasTable::write_hdf5(std::string filename) const {
+  hid_t h5file = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT,
+                           H5P_DEFAULT);
+  if (h5file < 0)
+    throw std::runtime_error("Could not create alias table file " + filename);
+  write_h5_array(h5file, "/row_prob", H5T_NATIVE_DOUBLE, row_at->prob_data(),
+                 num_rows);
+  write_h5_array(h5file, "/row_alias", H5T_NATIVE_INT, row_at->alias_data(),
+                 num_rows);
+  write_h5_array(h5file, "/group_prob", H5T_NATIVE_DOUBLE, group_prob.data(),
+                 group_prob.size());
+  write_h5_array(h5file, "/group_alias", H5T_NATIVE_INT, group_alias.data(),
+                 group_alias.size());
+  write_h5_array(h5file, "/row_weights", H5T_NATIVE_DOUBLE,
+                 row_weights.data(), row_weights.size());
+  double strengths[2] = {source_strength, biased_strength};
+  write_h5_array(h5file, "/strengths", H5T_NATIVE_DOUBLE, strengths, 2);
+  H5Fclose(h5file);
+}
+
+pyne::GroupSpectrum::GroupSpectrum() : at(std::vector<double>()) {}
+
+pyne::GroupSpectrum::GroupSpectrum(std::vector<double> bounds,
+                                   std::vector<double> pdf)
+  : bounds(bounds), at(std::vector<double>()) {
+  if (pdf.empty() || bounds.size() != pdf.size() + 1)
+    throw std::length_error("A group spectrum needs one more bound than "
+                            "sub-bin probabilities.");
+  double sum = 0.0;
+  for (int i=0; i<pdf.size(); ++i) {
+    if (bounds[i + 1] < bounds[i])
+      throw std::invalid_argument("Group spectrum bounds must be ascending.");
+    if (pdf[i] < 0.0)
+      throw std::invalid_argument("Group spectrum probabilities must be "
+                                  "non-negative.");
+    sum += pdf[i];
+  }
+  if (sum <= 0.0)
+    throw std::invalid_argument("Group spectrum probabilities are all zero.");
+  for (int i=0; i<pdf.size(); ++i)
+    pdf[i] /= sum;
+  at = AliasTable(std::move(pdf));
+}
+
+double pyne::GroupSpectrum::sample(double rand) const {
+  // Split rand into an alias table column and a uniform number for the
+  // accept/alias decision, then rescale the part of that uniform number left
+  // over by the decision to place the energy within the chosen sub-bin.
+  double r = rand * at.n;
+  int i = std::min((int) r, at.n - 1);
+  double r2 = r - i;
+  int bin;
+  double u;
+  if (r2 < at.prob[i]) {
+    bin = i;
+    u = r2 / at.prob[i];
+  } else {
+    bin = at.alias[i];
+    u = (r2 - at.prob[i]) / (1.0 - at.prob[i]);
+  }
+  return bounds[bin] + u * (bounds[bin + 1] - bounds[bin]);
+}
+
+pyne::VolumeElementTable::VolumeElementTable()
+  : num_ves(0), stride(0), view(NULL) {}
+
+void pyne::VolumeElementTable::resize(int n) {
+  // pad each column to a whole number of 64 byte cache lines
+  const size_t per_line = 64 / sizeof(double);
+  num_ves = n;
+  view = NULL;
+  stride = ((n + per_line - 1) / per_line) * per_line;
+  buf.assign(NUM_COLUMNS*stride + per_line, 0.0);
+}
+
+const double* pyne::VolumeElementTable::column(int c) const {
+  if (view != NULL)
+    return view + c*stride;
+  const double* base = buf.data();
+  size_t misalign = reinterpret_cast<uintptr_t>(base) % 64;
+  size_t offset = (misalign == 0) ? 0 : (64 - misalign) / sizeof(double);
+  return base + offset + c*stride;
+}
+
+void pyne::VolumeElementTable::refer(int num_ves, size_t stride,
+                                     const double* data) {
+  std::vector<double>().swap(buf);
+  this->num_ves = num_ves;
+  this->stride = stride;
+  view = data;
+}
+
+double* pyne::VolumeElementTable::column(int c) {
+  return const_cast<double*>(
+      static_cast<const VolumeElementTable*>(this)->column(c));
+}
+
+void pyne::VolumeElementTable::set(int ve_idx, const double* o,
+                                   const double* x_vec, const double* y_vec,
+                                   const double* z_vec) {
+  for (int d=0; d<3; ++d) {
+    column(OX + d)[ve_idx] = o[d];
+    column(XX + d)[ve_idx] = x_vec[d];
+    column(YX + d)[ve_idx] = y_vec[d];
+    column(ZX + d)[ve_idx] = z_vec[d];
+  }
+}
+
+void pyne::VolumeElementTable::place(bool tet, const int* ve_idx,
+                                     const double* rands, int rands_stride,
+                                     int n, double* x, double* y,
+                                     double* z) const {
+  const double* __restrict ox = column(OX);
+  const double* __restrict oy = column(OY);
+  const double* __restrict oz = column(OZ);
+  const double* __restrict xx = column(XX);
+  const double* __restrict xy = column(XY);
+  const double* __restrict xz = column(XZ);
+  const double* __restrict yx = column(YX);
+  const double* __restrict yy = column(YY);
+  const double* __restrict yz = column(YZ);
+  const double* __restrict zx = column(ZX);
+  const double* __restrict zy = column(ZY);
+  const double* __restrict zz = column(ZZ);
+  // The branch on the element type is hoisted out of the loop over points.
+  const double fold = tet ? 1.0 : 0.0;
+  #pragma omp simd
+  for (int i=0; i<n; ++i) {
+    double s = rands[i*rands_stride];
+    double t = rands[i*rands_stride + 1];
+    double u = rands[i*rands_stride + 2];
+
+    // Transform s, t, u to uniformly sample a tetrahedron. See:
+    // C. Rocchini and P. Cignoni, "Generating Random Points in a Tetrahedron,"
+    //  Journal of Graphics Tools, 5, 200-202 (2001).
+    // The folds are written as 0/1 masks rather than branches so the loop
+    // vectorizes; for hexes fold is 0 and the coordinates pass through.
+    double m1 = fold*(s + t) > 1.0 ? 1.0 : 0.0;
+    s += m1*(1.0 - 2.0*s);
+    t += m1*(1.0 - 2.0*t);
+    double m2 = fold*(s + t + u) > 1.0 ? 1.0 : 0.0;
+    double m3 = t + u > 1.0 ? m2 : 0.0;
+    double m4 = m2 - m3;
+    double ds = m4*(1.0 - s - t - u);
+    double dt = m3*(1.0 - t - u);
+    double du = m3*(1.0 - s - t - u) + m4*(s + t - 1.0);
+    s += ds;
+    t += dt;
+    u += du;
+
+    int v = ve_idx[i];
+    x[i] = s*xx[v] + t*yx[v] + u*zx[v] + ox[v];
+    y[i] = s*xy[v] + t*yy[v] + u*zy[v] + oy[v];
+    z[i] = s*xz[v] + t*yz[v] + u*zz[v] + oz[v];
+  }
+}
+
+pyne::SamplingContext::SamplingContext(const Sampler* sampler)
+  : sampler(sampler) {}
+
+pyne::SourceParticle pyne::SamplingContext::particle_birth(
+    const std::vector<double>& rands) {
+  double x, y, z, e, w;
+  cell_list.resize(0);
+  if (sampler->ve_type == moab::MBHEX)
+    cell_list.resize((sampler->mesh_mode == SUBVOXEL) ? 1 :
+                     sampler->max_num_cells);
+  sampler->birth(&rands[0], &x, &y, &z, &e, &w,
+                 cell_list.empty() ? NULL : cell_list.data());
+  return SourceParticle(x, y, z, e, w, cell_list);
+}
+
+void pyne::SamplingContext::particle_birth(const double* rands, double* x,
+                                           double* y, double* z, double* e,
+                                           double* w, int* cell_list) const {
+  sampler->birth(rands, x, y, z, e, w,
+                 (sampler->get_cell_list_size() > 0) ? cell_list : NULL);
+}
+
+void pyne::SamplingContext::particle_birth_batch(const double* rands,
+                                                 size_t n,
+                                                 SourceParticleSoA& out) const {
+  sampler->particle_birth_batch(rands, n, out);
+}
+
 pyne::SourceParticle::SourceParticle() {
     x = -1.0;
     y = -1.0;
@@ -34,10 +34,16 @@
 #include <sstream>
 #include <string>
 #include <map>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
 
 #include "moab/Range.hpp"
 #include "moab/Core.hpp"
 #ifndef PYNE_IS_AMALGAMATED
+#include "utils.h"
+#include "h5wrap.h"
 #include "measure.h"
 #endif
 #include "moab/CartVect.hpp"
@@ -73,32 +79,274 @@ namespace pyne {
                             double* e,
                             double* w,
                             int* cell_list);
+  /// MCNP interface to sample a batch of particle birth parameters after
+  /// sampling setup. All output arrays are supplied by the caller.
+  /// \param n The number of particles to sample
+  /// \param rands 6*n pseudo-random numbers, six per particle
+  /// \param x The n sampled x positions returned by this function
+  /// \param y The n sampled y positions returned by this function
+  /// \param z The n sampled z positions returned by this function
+  /// \param e The n sampled energies returned by this function
+  /// \param w The n sampled statistical weights returned by this function
+  /// \param cell_list The sampled cell lists, n*cell_list_size entries
+  void particle_birth_batch_(int* n,
+                             double* rands,
+                             double* x,
+                             double* y,
+                             double* z,
+                             double* e,
+                             double* w,
+                             int* cell_list);
+  /// Thread-safe MCNP interface for source sampling setup. The first call
+  /// builds the source model shared by all threads, every call sets up the
+  /// sampling context of the calling thread.
+  /// \param mode The sampling mode, see sampling_setup_
+  /// \param thread_id The index of the calling thread, in [0, num_threads)
+  /// \param num_threads The total number of sampling threads
+  /// \param cell_list_size The cell list size, see sampling_setup_
+  /// \param ierr Set to 0 on success, or to 1 if thread_id is not in
+  ///        [0, num_threads), in which case no context is set up
+  void sampling_setup_thread_(int* mode, int* thread_id, int* num_threads,
+                              int* cell_list_size, int* ierr);
+  /// Thread-safe MCNP interface to sample particle birth parameters after
+  /// sampling_setup_thread_ has been called by the same thread.
+  /// \param thread_id The index of the calling thread. As this is called for
+  ///        every particle it is not checked: it must be an index for which
+  ///        sampling_setup_thread_ returned ierr 0.
+  /// The remaining parameters are the same as for particle_birth_
+  void particle_birth_thread_(int* thread_id,
+                              double* rands,
+                              double* x,
+                              double* y,
+                              double* z,
+                              double* e,
+                              double* w,
+                              int* cell_list);
   /// Helper function for MCNP interface that reads energy boudaries from a file
   /// \param e_bounds_file A file containing the energy group boundaries.
   std::vector<double> read_e_bounds(std::string e_bounds_file);
 
-  /// Stores 4 connected points in a mesh volume element
-  struct edge_points {
-    moab::CartVect o_point;
-    moab::CartVect x_vec;
-    moab::CartVect y_vec;
-    moab::CartVect z_vec;
+  /// Packed, 64-byte aligned structure-of-arrays table holding the origin and
+  /// the three edge vectors of every mesh volume element. A point with local
+  /// coordinates (s, t, u) is placed at o + s*x_vec + t*y_vec + u*z_vec.
+  class VolumeElementTable {
+  public:
+    /// Column indices: origin, x edge, y edge and z edge, each as x, y, z.
+    enum Column {OX, OY, OZ, XX, XY, XZ, YX, YY, YZ, ZX, ZY, ZZ, NUM_COLUMNS};
+
+    VolumeElementTable();
+    /// Allocates storage for \a num_ves volume elements.
+    void resize(int num_ves);
+    /// Sets the origin and edge vectors of a volume element.
+    /// \param ve_idx The volume element index
+    /// \param o The origin point
+    /// \param x_vec The first edge vector
+    /// \param y_vec The second edge vector
+    /// \param z_vec The third edge vector
+    void set(int ve_idx, const double* o, const double* x_vec,
+             const double* y_vec, const double* z_vec);
+    /// Returns the number of volume elements in the table.
+    int size() const {return num_ves;};
+    /// Returns the 64-byte aligned start of a column.
+    const double* column(int c) const;
+    /// Returns the distance between the starts of two columns.
+    size_t column_stride() const {return stride;};
+    /// Refers to a table stored elsewhere, such as in a mapped sampler state
+    /// file, instead of the owned storage.
+    /// \param num_ves The number of volume elements
+    /// \param stride The column stride, see column_stride
+    /// \param data The start of the NUM_COLUMNS columns
+    void refer(int num_ves, size_t stride, const double* data);
+    /// Places n points uniformly in the given volume elements. For tets the
+    /// Rocchini-Cignoni folding is applied branch-free, so the loop over
+    /// points vectorizes.
+    /// \param tet True if the volume elements are tets, false for hexes
+    /// \param ve_idx The n volume element indices
+    /// \param rands Three random numbers (s, t, u) per point
+    /// \param rands_stride The distance between the (s, t, u) of two points
+    /// \param n The number of points
+    /// \param x The n x coordinates returned by this function
+    /// \param y The n y coordinates returned by this function
+    /// \param z The n z coordinates returned by this function
+    void place(bool tet, const int* ve_idx, const double* rands,
+               int rands_stride, int n, double* x, double* y,
+               double* z) const;
+  private:
+    double* column(int c);
+    int num_ves; ///< Number of volume elements
+    size_t stride; ///< Column length, padded to a multiple of 64 bytes
+    std::vector<double> buf; ///< Storage, over-allocated for alignment
+    const double* view; ///< External storage, or NULL
   };
 
+  /// Read-only contiguous array which either owns its elements or refers to
+  /// storage owned elsewhere, such as a mapped sampler state file.
+  extern "C++" {
+  template <typename T>
+  class DataArray {
+  public:
+    DataArray() : ptr(NULL), n(0) {};
+    DataArray(const DataArray& other) : ptr(NULL), n(0) {*this = other;};
+    DataArray& operator=(const DataArray& other) {
+      own = other.own;
+      ptr = (other.ptr == other.own_data()) ? own_data() : other.ptr;
+      n = other.n;
+      return *this;
+    };
+    /// Takes over the elements of \a v, leaving it empty.
+    void swap_in(std::vector<T>& v) {
+      own.swap(v);
+      std::vector<T>().swap(v);
+      ptr = own_data();
+      n = own.size();
+    };
+    /// Refers to \a size elements owned elsewhere, which must outlive this.
+    void refer(const T* data, size_t size) {
+      std::vector<T>().swap(own);
+      ptr = data;
+      n = size;
+    };
+    const T& operator[](size_t i) const {return ptr[i];};
+    const T* data() const {return ptr;};
+    size_t size() const {return n;};
+    bool empty() const {return n == 0;};
+  private:
+    const T* own_data() const {return own.empty() ? NULL : &own[0];};
+    std::vector<T> own; ///< Owned elements, if any
+    const T* ptr; ///< Start of the elements
+    size_t n; ///< Number of elements
+  };
+  } // extern "C++"
+
   /// A data structure for O(1) source sampling
   class AliasTable {
   public:
-    /// Constructor
+    /// Constructor. The table is built in the storage of \a p, so a PDF that
+    /// is moved in is never copied.
     /// \param p A normalized probability distribution function
-    AliasTable(std::vector<double> p);
+    /// \param num_threads The number of threads to build the table with, 1
+    ///        by default, or all available if less than 1. The single
+    ///        threaded table is the Walker-Vose one; with more threads the
+    ///        pairing of bins and aliases depends on the number of threads,
+    ///        but the sampled distribution does not.
+    AliasTable(std::vector<double> p, int num_threads=1);
+    /// Constructor for a table that refers to read-only storage owned
+    /// elsewhere, such as a mapped sampler state file.
+    /// \param n The number of bins
+    /// \param prob The n probabilities
+    /// \param alias The n aliases
+    AliasTable(int n, const double* prob, const int* alias);
     /// Samples the alias table
     /// \param rand1 A random number in range [0, 1].
     /// \param rand2 A random number in range [0, 1].
-    int sample_pdf(double rand1, double rand2);
+    int sample_pdf(double rand1, double rand2) const;
+    /// Returns the probabilities, wherever they are stored.
+    const double* prob_data() const {
+      return (prob_view != NULL) ? prob_view : &prob[0];
+    };
+    /// Returns the aliases, wherever they are stored.
+    const int* alias_data() const {
+      return (alias_view != NULL) ? alias_view : &alias[0];
+    };
     ~AliasTable(){};
     int n; /// Number of bins in the PDF.
     std::vector<double> prob; /// Probabilities.
     std::vector<int> alias; /// Alias probabilities.
+  private:
+    const double* prob_view; ///< External probabilities, or NULL
+    const int* alias_view; ///< External aliases, or NULL
+  };
+
+  /// An alias table that keeps its probabilities in single precision, which
+  /// takes 8 rather than 12 bytes per bin for very large PDFs. Rounding moves
+  /// at most a relative 2^-24 of the probability of each bin to its alias.
+  class CompactAliasTable {
+  public:
+    /// Constructor, see AliasTable::AliasTable(). The table is built in
+    /// double precision and then narrowed.
+    CompactAliasTable(std::vector<double> p, int num_threads=1);
+    /// Samples the alias table, see AliasTable::sample_pdf().
+    int sample_pdf(double rand1, double rand2) const;
+    int n; ///< Number of bins in the PDF.
+    std::vector<float> prob; ///< Probabilities.
+    std::vector<int> alias; ///< Alias probabilities.
+  };
+
+  /// Two-level alias table for mesh sources. The first level selects a row
+  /// (a volume element, or a sub-voxel cell of one) and the second level the
+  /// energy group within that row. Rows are built one at a time from
+  /// unnormalized data, so the full flattened PDF never has to be held in
+  /// memory. Both levels are stored as flat arrays that can be written to and
+  /// read from an HDF5 sidecar file.
+  class MeshAliasTable {
+  public:
+    /// Constructor for an empty table
+    /// \param num_rows The number of rows
+    /// \param num_groups The number of energy groups per row
+    MeshAliasTable(int num_rows, int num_groups);
+    /// Constructor that reads a table written by write_hdf5
+    /// \param filename The path to the HDF5 sidecar file
+    MeshAliasTable(std::string filename);
+    /// Constructor for a table that refers to read-only storage owned
+    /// elsewhere, such as a mapped sampler state file. The arguments are the
+    /// arrays written by write_hdf5; \a row_weights may be NULL.
+    MeshAliasTable(int num_rows, int num_groups, const double* row_prob,
+                   const int* row_alias, const double* group_prob,
+                   const int* group_alias, const double* row_weights);
+    /// Builds the group level table of one row. The rows share one scratch
+    /// buffer, so they are set one at a time.
+    /// \param row The row index
+    /// \param p The num_groups unnormalized group probabilities of the row
+    /// \return The sum of \a p
+    double set_row(int row, const double* p);
+    /// Builds the row level table once all rows have been set.
+    /// \param row_pdf The num_rows unnormalized row probabilities
+    void set_row_pdf(std::vector<double> row_pdf);
+    /// Samples the table
+    /// \param rand1 A random number in range [0, 1].
+    /// \param rand2 A random number in range [0, 1].
+    /// \return The flat index row*num_groups + group, which is 64 bits wide
+    ///         since there may be more than INT_MAX entries
+    int64_t sample_pdf(double rand1, double rand2) const;
+    /// Writes the table to an HDF5 sidecar file, replacing any existing file.
+    /// \param filename The path to the HDF5 sidecar file
+    void write_hdf5(std::string filename) const;
+    ~MeshAliasTable();
+    int num_rows; ///< Number of rows
+    int num_groups; ///< Number of energy groups per row
+    AliasTable* row_at; ///< Row level alias table
+    DataArray<double> group_prob; ///< Group level probabilities, per row
+    DataArray<int> group_alias; ///< Group level aliases, per row
+    DataArray<double> row_weights; ///< Birth weights per row, if biased
+    double source_strength; ///< Total unbiased source, see Sampler
+    double biased_strength; ///< Total biased source, see Sampler
+  private:
+    std::vector<double> build_prob; ///< group_prob while rows are being set
+    std::vector<int> build_alias; ///< group_alias while rows are being set
+    std::vector<int> build_work; ///< Scratch of set_row, num_groups long
+    MeshAliasTable(const MeshAliasTable&);
+    MeshAliasTable& operator=(const MeshAliasTable&);
+  };
+
+  /// Tabulated sub-spectrum within a single energy group. The group is split
+  /// into sub-bins which are selected with a small alias table; the energy is
+  /// then sampled uniformly within the selected sub-bin.
+  class GroupSpectrum {
+  public:
+    /// Constructor for an empty spectrum, i.e. uniform in the group
+    GroupSpectrum();
+    /// Constructor
+    /// \param bounds The N + 1 ascending sub-bin energy boundaries
+    /// \param pdf The N relative sub-bin probabilities
+    GroupSpectrum(std::vector<double> bounds, std::vector<double> pdf);
+    /// Samples an energy from the sub-spectrum
+    /// \param rand A random number in range [0, 1]. A single random number
+    ///             selects both the sub-bin and the energy within it.
+    double sample(double rand) const;
+    /// Returns true if no sub-spectrum is tabulated
+    bool empty() const {return bounds.empty();};
+    std::vector<double> bounds; ///< Sub-bin energy boundaries
+    AliasTable at; ///< Alias table over the sub-bins
   };
 
   // class Source particle
@@ -136,11 +384,31 @@ namespace pyne {
     std::vector<int> cell_list;
   };
 
+  /// Caller-owned structure-of-arrays buffers filled by
+  /// Sampler::particle_birth_batch. Each of x, y, z, e and w must hold at
+  /// least n entries; cell_list must hold n*cell_list_size entries and may be
+  /// NULL when the cell list size of the sampler is 0.
+  struct SourceParticleSoA {
+    double* x; ///< x coordinates
+    double* y; ///< y coordinates
+    double* z; ///< z coordinates
+    double* e; ///< energies
+    double* w; ///< weights
+    int* cell_list; ///< cell lists, cell_list_size entries per particle
+  };
+
   /// Problem modes
   enum BiasMode {USER, ANALOG, UNIFORM};
   enum MeshMode {VOXEL, SUBVOXEL, TET};
+  /// In-group energy sampling modes: uniform (linear) in energy, uniform in
+  /// lethargy (log), or from tabulated per-group sub-spectra.
+  enum EnergyMode {E_LINEAR, E_LOG, E_TABULATED};
 
   /// Mesh based Monte Carlo source sampling.
+  /// Once constructed a Sampler is an immutable source model (alias table,
+  /// edge points, biased weights and cell data): all of its sampling member
+  /// functions are const and may be called concurrently from several threads.
+  /// Per-thread scratch data lives in SamplingContext objects.
   class Sampler {
   public:
     /// Constuctor for analog and uniform sampling
@@ -176,6 +444,13 @@ namespace pyne {
     /// \param e_bounds The energy boundaries, note there are N + 1 energy
     ///                 bounds for N energy groups
     /// \param mode The mode number, 0, 1, 2, 3, 4 or 5
+    ///
+    /// The tag names map may also contain an "alias_table_file" entry naming
+    /// an HDF5 sidecar file. In analog and uniform modes the source is then
+    /// read from the mesh in blocks into a two-level MeshAliasTable, which is
+    /// written to the sidecar; when the sidecar already exists the table is
+    /// read from it instead of being rebuilt. The sidecar must be removed
+    /// whenever the source mesh changes.
     Sampler(std::string filename,
             std::map<std::string, std::string> tag_names,
             std::vector<double> e_bounds,
@@ -185,14 +460,88 @@ namespace pyne {
     /// \param rands Six pseudo-random numbers in range [0, 1].
     /// \return A SourceParticle object containing the x position, y, position,
     ///         z, position, e, energy and w, weight of a particle.
-    pyne::SourceParticle particle_birth(std::vector<double> rands);
+    pyne::SourceParticle particle_birth(std::vector<double> rands) const;
+
+    /// Samples the birth parameters of a batch of particles without any per
+    /// particle allocation.
+    /// \param rands 6*n pseudo-random numbers in range [0, 1], six per
+    ///              particle in the same order as for particle_birth.
+    /// \param n The number of particles to sample.
+    /// \param out The caller-owned buffers the birth parameters are written to.
+    void particle_birth_batch(const double* rands, size_t n,
+                              SourceParticleSoA& out) const;
 
     /// Return cell_list_size
-    int get_cell_list_size();
+    int get_cell_list_size() const;
+    /// Returns the total source of the mesh, the sum over all volume
+    /// elements (and sub-voxels) and energy groups of density times volume.
+    double get_source_strength() const {return source_strength;};
+    /// Returns the total of the biased source the sampler draws from, in the
+    /// units of the bias tag times volume, or the source volume in uniform
+    /// mode. It equals the source strength in analog mode.
+    double get_biased_strength() const {return biased_strength;};
+
+    /// Writes the fully built source model (alias tables, volume element
+    /// geometry, birth weights and cell data) to a flat binary state file
+    /// laid out so that it can be mapped directly. The in-group energy mode
+    /// and group spectra are not part of the state.
+    /// \param filename The path to the state file
+    void write_state(std::string filename) const;
+    /// Creates a sampler from a state file written by write_state. The file
+    /// is mapped read-only and the tables refer to the mapping, so processes
+    /// on one node that read the same state share a single copy of it.
+    /// \param filename The path to the state file
+    /// \return A new sampler, owned by the caller
+    static Sampler* read_state(std::string filename);
+    /// Creates a sampler that shares its tables with the other processes of
+    /// a node. The first process to find \a state_file missing or out of date
+    /// builds the sampler, writes the state file and maps it; the others wait
+    /// for the file and map it too. The build is serialized with an advisory
+    /// lock (flock) on a lock file next to the state file. The system drops
+    /// the lock when a building process dies, so a killed build leaves no lock
+    /// that blocks the next one, though the file itself may stay. The state
+    /// file has to be on a file system whose flock works across the processes
+    /// that share it. A state file on a memory-backed file system such as
+    /// /dev/shm is shared through POSIX shared memory.
+    /// \param state_file The path to the shared state file
+    /// \param filename The path to the MOAB mesh (.h5m) file
+    /// \param tag_names The map of tag names, see the constructor
+    /// \param e_bounds The energy boundaries
+    /// \param mode The mode number, 0, 1, 2, 3, 4 or 5
+    /// \return A new sampler, owned by the caller
+    static Sampler* read_shared_state(std::string state_file,
+                                      std::string filename,
+                                      std::map<std::string, std::string> tag_names,
+                                      std::vector<double> e_bounds, int mode);
+    /// Returns true if the sampler was built in mode \a mode from the mesh
+    /// file \a filename, and the file has not changed since.
+    /// \param filename The path to the MOAB mesh (.h5m) file
+    /// \param mode The mode number, 0, 1, 2, 3, 4 or 5
+    bool matches_source(std::string filename, int mode) const;
+
+    /// Sets how energies are sampled within an energy group. The default is
+    /// E_LINEAR. E_LOG requires all energy bounds to be positive and
+    /// E_TABULATED requires set_group_spectra to have been called. Like the
+    /// rest of the source model this must be set before sampling starts.
+    /// \param e_mode The in-group energy sampling mode
+    void set_energy_mode(EnergyMode e_mode);
+    /// Supplies tabulated sub-spectra shared by all volume elements, one per
+    /// energy group, and switches to E_TABULATED sampling. This allows coarse
+    /// energy groups (and therefore small alias tables) without sampling
+    /// energies uniformly within each group.
+    /// \param bounds For each group, the ascending sub-bin boundaries, which
+    ///               must lie within the group. An empty entry samples the
+    ///               group uniformly.
+    /// \param pdfs For each group, the relative sub-bin probabilities, one
+    ///             fewer than the number of sub-bin boundaries.
+    void set_group_spectra(const std::vector<std::vector<double> >& bounds,
+                           const std::vector<std::vector<double> >& pdfs);
 
     ~Sampler() {
       delete mesh;
       delete at;
+      delete mesh_at;
+      delete state;
     };
 
   // member variables
@@ -218,39 +567,165 @@ namespace pyne {
     BiasMode bias_mode; ///< Bias mode: ANALOG, UNIFORM, USER
     MeshMode mesh_mode; ///< Mesh mode: VOXEL, SUBVOXEL, TET
     int mode; ///< Sampler mode, currently support 0, 1, 2, 3, 4, 5
+    EnergyMode e_mode; ///< In-group energy sampling: E_LINEAR, E_LOG, E_TABULATED
     // mesh
     moab::Interface* mesh; ///< MOAB mesh
     int num_ves; ///< Number of mesh volume elements on \a mesh.
     moab::EntityType ve_type; ///< Type of mesh volume: moab::TET or moab::HEX
     int verts_per_ve; ///< Number of verticles per mesh volume element
     // sampling
-    std::vector<edge_points> all_edge_points; ///< Four connected points on a VE.
-    std::vector<double> biased_weights; ///< Birth weights for biased sampling.
-    std::vector<int> cell_number; ///< Tag cell_number
-    std::vector<int> cell_list; ///< Cell list passed to Fortran
-    std::vector<double> cell_fracs; ///< Tag cell_fracs
+    VolumeElementTable ve_table; ///< Origin and edge vectors of all VEs.
+    DataArray<double> biased_weights; ///< Birth weights for biased sampling.
+    /// Start of the cells of each VE in \a cell_number, num_ves + 1 entries.
+    /// Only the cells a VE intersects are kept, rather than max_num_cells.
+    DataArray<int> cell_ptr;
+    /// VE of each PDF row in SUBVOXEL mode, else empty. It is rebuilt from
+    /// \a cell_ptr rather than kept in state files.
+    std::vector<int> row_ves;
+    DataArray<int> cell_number; ///< Tag cell_number, of the cells of each VE
+    /// Tag cell_fracs, of the cells of each VE in SUBVOXEL mode, else empty
+    DataArray<double> cell_fracs;
     AliasTable* at; ///< Alias table used for sampling.
+    /// Two-level alias table used instead of \a at when the source is read in
+    /// blocks, see the "alias_table_file" entry of the tag names map.
+    MeshAliasTable* mesh_at;
+    std::string alias_table_file; ///< HDF5 sidecar of \a mesh_at
+    MappedFile* state; ///< State file the tables refer to, if any
+    int64_t source_size; ///< Size of the mesh file when it was read
+    int64_t source_mtime; ///< Modification time of the mesh file when read
+    double source_strength; ///< Total unbiased source
+    double biased_strength; ///< Total biased source
+    std::vector<GroupSpectrum> group_spectra; ///< Sub-spectra for E_TABULATED
 
   // member functions
   private:
+    friend class SamplingContext;
+    Sampler(); // for read_state
+    Sampler(const Sampler&);
+    Sampler& operator=(const Sampler&);
     // instantiation
     void setup();
     void mesh_geom_data(moab::Range ves, std::vector<double> &volumes);
+    void mesh_cell_data(moab::Range ves, std::vector<int>& cell_slots);
     void mesh_tag_data(moab::Range ves, const std::vector<double> volumes);
+    void mesh_tag_data_blocked(moab::Range ves, moab::Tag src_tag,
+                               const std::vector<double>& volumes,
+                               const std::vector<int>& cell_slots);
+    void read_row_data(moab::Range ves, moab::Tag tag, int n,
+                       const std::vector<int>& cell_slots,
+                       std::vector<double>& rows);
+    // PDF rows: one per VE, or in SUBVOXEL mode one per cell of each VE
+    int num_rows() const {
+      return (mesh_mode == SUBVOXEL) ? cell_ptr[num_ves] : num_ves;
+    };
+    int row_begin(int v) const {
+      return (mesh_mode == SUBVOXEL) ? cell_ptr[v] : v;
+    };
+    int row_end(int v) const {
+      return (mesh_mode == SUBVOXEL) ? cell_ptr[v + 1] : v + 1;
+    };
+    int row_ve(int row) const {
+      return (mesh_mode == SUBVOXEL) ? row_ves[row] : row;
+    };
+    void index_rows();
+    double row_frac(int row) const {
+      return (mesh_mode == SUBVOXEL) ? cell_fracs[row] : 1.0;
+    };
     // select birth parameters
-    moab::CartVect sample_xyz(int ve_idx, std::vector<double> rands);
-    double sample_e(int e_idx, double rand);
-    double sample_w(int pdf_idx);
+    void birth(const double* rands, double* x, double* y, double* z,
+               double* e, double* w, int* cells) const;
+    void sample_cells(int64_t pdf_idx, int* cells) const;
+    double sample_e(int e_idx, double rand) const;
+    double sample_w(int64_t pdf_idx) const;
+    int64_t sample_pdf(double rand1, double rand2) const;
     // helper functions
-    void normalize_pdf(std::vector<double> & pdf);
+    double normalize_pdf(std::vector<double> & pdf);
     int num_groups(moab::Tag tag);
-    std::vector<double> read_bias_pdf(moab::Range ves, std::vector<double> volumes,
-                                      std::vector<double> pdf);
+    std::vector<double> read_bias_pdf(moab::Range ves,
+                                      const std::vector<double>& volumes,
+                                      const std::vector<double>& pdf,
+                                      const std::vector<int>& cell_slots);
     // Get max_num_cells
     int get_max_num_cells(moab::Tag cell_fracs_tag);
     // get has_cell_fracs
     bool check_cell_fracs(moab::Tag cell_fracs_tag);
   };
+
+  /// Lightweight per-thread sampling state over a shared, immutable Sampler.
+  /// Each thread owns its own SamplingContext, so no sampling state is shared
+  /// between threads.
+  class SamplingContext {
+  public:
+    /// Constructor
+    /// \param sampler The shared source model to sample from. It must outlive
+    ///                this context.
+    SamplingContext(const Sampler* sampler=NULL);
+    /// Samples particle birth parameters, see Sampler::particle_birth
+    pyne::SourceParticle particle_birth(const std::vector<double>& rands);
+    /// Samples the birth parameters of one particle into the supplied
+    /// buffers, see particle_birth_ for the meaning of the parameters.
+    void particle_birth(const double* rands, double* x, double* y, double* z,
+                        double* e, double* w, int* cell_list) const;
+    /// Samples the birth parameters of a batch of particles, see
+    /// Sampler::particle_birth_batch
+    void particle_birth_batch(const double* rands, size_t n,
+                              SourceParticleSoA& out) const;
+
+    const Sampler* sampler; ///< The shared source model
+  private:
+    std::vector<int> cell_list; ///< Cell list scratch for particle_birth
+  };
+
+  /// Hierarchical sampler over a source mesh split into partitions, each
+  /// of which has its own sampler state file. A small top level alias table
+  /// over the biased strengths of the partitions picks a partition, and the
+  /// particle is then born from that partition's sampler, with its weight
+  /// corrected for the share of the total source the partition holds. The
+  /// state file of a partition is only mapped once a particle is first born
+  /// in it, so a process that samples a few partitions never loads the rest.
+  /// All partitions must have been built in the same mode; cell lists are
+  /// padded with -1 to the longest one.
+  class PartitionedSampler {
+  public:
+    /// Constructor, which only reads the headers of the state files
+    /// \param state_files The state files written by Sampler::write_state
+    ///                    for each partition
+    PartitionedSampler(std::vector<std::string> state_files);
+    /// Samples particle birth parameters, see Sampler::particle_birth. The
+    /// first random number selects the partition and is then reused within
+    /// it, so six random numbers are still enough.
+    pyne::SourceParticle particle_birth(std::vector<double> rands) const;
+    /// Samples the birth parameters of a batch of particles, see
+    /// Sampler::particle_birth_batch
+    void particle_birth_batch(const double* rands, size_t n,
+                              SourceParticleSoA& out) const;
+    /// Return cell_list_size, the largest of the partitions
+    int get_cell_list_size() const {return cell_list_size;};
+    /// Returns the number of partitions
+    int num_partitions() const {return state_files.size();};
+    /// Selects a partition
+    /// \param rand A random number in range [0, 1]
+    /// \param rest A random number in range [0, 1] returned by this function,
+    ///             independent of the partition selected
+    /// \return The partition index
+    int sample_partition(double rand, double& rest) const;
+    /// Returns the sampler of a partition, mapping its state file on first
+    /// use. This may be called concurrently from several threads.
+    /// \param i The partition index
+    const Sampler* partition(int i) const;
+    ~PartitionedSampler();
+  private:
+    std::vector<std::string> state_files; ///< State file of each partition
+    AliasTable* at; ///< Top level alias table over the partitions
+    std::vector<double> weights; ///< Birth weight factor of each partition
+    std::vector<int> cell_list_sizes; ///< Cell list size of each partition
+    int cell_list_size; ///< Largest of \a cell_list_sizes
+    /// Sampler of each partition, NULL until it is first used
+    std::unique_ptr<std::atomic<const Sampler*>[]> samplers;
+    mutable std::mutex load_mutex; ///< Serializes loading partitions
+    PartitionedSampler(const PartitionedSampler&);
+    PartitionedSampler& operator=(const PartitionedSampler&);
+  };
 } //end namespace pyne
 
 #ifdef __cplusplus
@@ -1,45 +1,50 @@
 # -*- coding: utf-8 -*-
 """
-This script generates the state_map.h file from nuc_data.h5
+This script generates the state_map.cpp file from nuc_data.h5
 """
 import tables as tb
 
 from pyne import nuc_data
 
 
-def generate_state_id_map(nuc_data):
+def read_state_id_map(nuc_data):
+    """Returns the sorted (state id, metastable state) pairs of the level list
+    of nuc_data.h5, for the levels that are metastable.
+    """
     f = tb.open_file(nuc_data)
+    states = {}
+    for item in f.root.decay.level_list:
+        if item['metastable'] > 0 and item['nuc_id'] not in states:
+            states[int(item['nuc_id'])] = int(item['metastable'])
+    f.close()
+    return sorted(states.items())
 
-    with open('state_map.cpp','w') as sm:
+
+def write_state_id_map(states, filename='state_map.cpp'):
+    """Writes the sorted (state id, metastable state) pairs as two constexpr
+    arrays that nucname searches in place.
+    """
+    with open(filename, 'w') as sm:
         sm.write('//Mapping file for state ids to nuc ids\n')
         sm.write('//This File was autogenerated!!\n')
         sm.write('#ifndef PYNE_4HFU6PUEQJB3ZJ4UIFLVU4SPCM\n')
         sm.write('#define PYNE_4HFU6PUEQJB3ZJ4UIFLVU4SPCM\n')
         sm.write('namespace pyne {\n')
         sm.write('namespace nucname {\n')
-        lastnuc = 0
-        count = 0
-        for item in f.root.decay.level_list:
-            if item['metastable'] > 0 and item['nuc_id'] != lastnuc:
-                lastnuc = item['nuc_id']
-                count = count + 1
-        sm.write('#define TOTAL_STATE_MAPS '+ str(count) +'\n')
+        sm.write('#define TOTAL_STATE_MAPS ' + str(len(states)) + '\n')
         sm.write('std::map<int, int> state_id_map;\n')
-        sm.write('int map_nuc_ids [TOTAL_STATE_MAPS] = {')
-        for item in f.root.decay.level_list:
-            if item['metastable'] > 0 and item['nuc_id'] != lastnuc:
-                lastnuc = item['nuc_id']
-                sm.write(str(item['nuc_id']) + ",\n")
+        sm.write('// state ids of the metastable levels, sorted\n')
+        sm.write('constexpr int map_nuc_ids [TOTAL_STATE_MAPS] = {')
+        sm.write(',\n'.join(str(nuc_id) for nuc_id, m in states))
         sm.write('};\n')
-        sm.write('int map_metastable [TOTAL_STATE_MAPS] = {')
-        for item in f.root.decay.level_list:
-            if item['metastable'] > 0 and item['nuc_id'] != lastnuc:
-                lastnuc = item['nuc_id']
-                sm.write(str(item['metastable']) + ",\n")
+        sm.write('// metastable state of each of map_nuc_ids\n')
+        sm.write('constexpr int map_metastable [TOTAL_STATE_MAPS] = {')
+        sm.write(',\n'.join(str(m) for nuc_id, m in states))
         sm.write('};\n')
         sm.write('}\n')
         sm.write('}\n')
-        sm.write("#endif")
+        sm.write("#endif\n")
+
 
 if __name__ == "__main__":
-    generate_state_id_map(nuc_data)
+    write_state_id_map(read_state_id_map(nuc_data))
@@ -2,7 +2,9 @@
 // Central Tally Class
 // -- Andrew Davis
 
+#include <algorithm>
 #include <iomanip>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -200,7 +202,7 @@ void pyne::Tally::write_hdf5(char * filename, char * datapath) {
 }
 
 // create filetype
-hid_t pyne::Tally::create_filetype() {
+static hid_t tally_filetype() {
   herr_t status;  // iostatus
 
   // create string type
@@ -224,8 +226,12 @@ hid_t pyne::Tally::create_filetype() {
   return filetype;
 }
 
+hid_t pyne::Tally::create_filetype() {
+  return tally_filetype();
+}
+
 // create memory type 
-hid_t pyne::Tally::create_memtype() {
+static hid_t tally_memtype() {
   // iostatus
   herr_t status;
 
@@ -233,53 +239,61 @@ hid_t pyne::Tally::create_memtype() {
   hid_t strtype = H5Tcopy(H5T_C_S1);
   status = H5Tset_size(strtype, H5T_VARIABLE);
   // Create the compound datatype for memory.
-  hid_t memtype = H5Tcreate(H5T_COMPOUND, sizeof(tally_struct));
+  hid_t memtype = H5Tcreate(H5T_COMPOUND, sizeof(pyne::tally_struct));
   status = H5Tinsert(memtype, "entity_id",
-         HOFFSET(tally_struct, entity_id), H5T_NATIVE_INT);
+         HOFFSET(pyne::tally_struct, entity_id), H5T_NATIVE_INT);
   status = H5Tinsert(memtype, "entity_type",
-         HOFFSET(tally_struct, entity_type), H5T_NATIVE_INT);
+         HOFFSET(pyne::tally_struct, entity_type), H5T_NATIVE_INT);
   status = H5Tinsert(memtype, "tally_type",
-         HOFFSET(tally_struct, tally_type), H5T_NATIVE_INT);
+         HOFFSET(pyne::tally_struct, tally_type), H5T_NATIVE_INT);
   status = H5Tinsert(memtype, "particle_name",
-         HOFFSET(tally_struct, particle_name), strtype);
-  status = H5Tinsert(memtype, "entity_name",HOFFSET(tally_struct, entity_name),
-         strtype);
-  status = H5Tinsert(memtype, "tally_name",HOFFSET(tally_struct, tally_name),
-         strtype);
+         HOFFSET(pyne::tally_struct, particle_name), strtype);
+  status = H5Tinsert(memtype, "entity_name",
+         HOFFSET(pyne::tally_struct, entity_name), strtype);
+  status = H5Tinsert(memtype, "tally_name",
+         HOFFSET(pyne::tally_struct, tally_name), strtype);
   status = H5Tinsert(memtype, "entity_size",
-         HOFFSET(tally_struct, entity_size), H5T_NATIVE_DOUBLE);
+         HOFFSET(pyne::tally_struct, entity_size), H5T_NATIVE_DOUBLE);
   status = H5Tinsert(memtype, "normalization",
-         HOFFSET(tally_struct, normalization), H5T_NATIVE_DOUBLE);
+         HOFFSET(pyne::tally_struct, normalization), H5T_NATIVE_DOUBLE);
   return memtype;
 }
 
-hid_t pyne::Tally::create_dataspace(hid_t file, std::string datapath) {
+hid_t pyne::Tally::create_memtype() {
+  return tally_memtype();
+}
+
+// Creates an extendable tally dataset of length n, with chunks of the 
+// given length
+static hid_t create_tally_dataset(hid_t file, std::string datapath,
+                                  hsize_t n, hsize_t chunk) {
     // enable chunking 
     hid_t prop = H5Pcreate(H5P_DATASET_CREATE);
     // set chunk size
-    hsize_t chunk_dimensions[1]={1};
+    hsize_t chunk_dimensions[1] = {chunk};
     herr_t status = H5Pset_chunk(prop, 1, chunk_dimensions);
-    
-    // allow varaible length strings
-    hid_t strtype = H5Tcopy(H5T_C_S1);
-    status = H5Tset_size(strtype, H5T_VARIABLE);
 
-    // Create the compound datatype for memory.
-    hid_t memtype = create_memtype();
-    
     // Create the compound datatype for the file
-    hid_t filetype = create_filetype();
+    hid_t filetype = tally_filetype();
     
     // max dims unlimted
     hsize_t max_dims[1] = {H5S_UNLIMITED};
-    // only ever let 1 tally object be added
-    hsize_t dims[1] = {1}; 
+    hsize_t dims[1] = {n}; 
     // Create dataspace.  Setting maximum size to NULL sets the maximum
     hid_t space = H5Screate_simple(1, dims, max_dims);
 
     // Create the dataset and write the compound data to it.
-    return H5Dcreate2(file, datapath.c_str(), filetype, space, H5P_DEFAULT, prop,
-           H5P_DEFAULT);
+    hid_t dset = H5Dcreate2(file, datapath.c_str(), filetype, space,
+                            H5P_DEFAULT, prop, H5P_DEFAULT);
+    status = H5Sclose(space);
+    status = H5Tclose(filetype);
+    status = H5Pclose(prop);
+    return dset;
+}
+
+hid_t pyne::Tally::create_dataspace(hid_t file, std::string datapath) {
+    // only ever let 1 tally object be added
+    return create_tally_dataset(file, datapath, 1, 1);
 }
 
 // Appends Tally object to dataset if file & datapath already exists
@@ -436,6 +450,236 @@ void pyne::Tally::write_hdf5(std::string filename, std::string datapath) {
   }
 }
 
+/*--- TallyCollection ---*/
+
+pyne::TallyCollection::TallyCollection() {}
+
+pyne::TallyCollection::TallyCollection(const std::vector<Tally>& tallies) {
+  reserve(tallies.size());
+  for (int i = 0; i < tallies.size(); i++)
+    push_back(tallies[i]);
+}
+
+int pyne::TallyCollection::intern(const std::string& s) {
+  std::map<std::string, int>::iterator it = string_ids.find(s);
+  if (it != string_ids.end())
+    return it->second;
+  int id = strings.size();
+  strings.push_back(s);
+  string_ids[s] = id;
+  return id;
+}
+
+int pyne::TallyCollection::push_back(const Tally& tal) {
+  int ent_type;
+  if (tal.entity_type.find("Volume") != std::string::npos)
+    ent_type = VOLUME;
+  else if (tal.entity_type.find("Surface") != std::string::npos)
+    ent_type = SURFACE;
+  else
+    throw std::invalid_argument("a TallyCollection only holds volume and "
+                                "surface tallies, not " + tal.entity_type);
+
+  int tal_type;
+  if (tal.tally_type.find("Flux") != std::string::npos)
+    tal_type = FLUX;
+  else if (tal.tally_type.find("Current") != std::string::npos)
+    tal_type = CURRENT;
+  else
+    throw std::invalid_argument("a TallyCollection only holds flux and "
+                                "current tallies, not " + tal.tally_type);
+
+  entity_ids.push_back(tal.entity_id);
+  entity_types.push_back(ent_type);
+  tally_types.push_back(tal_type);
+  particle_names.push_back(intern(pyne::join_to_string(tal.particle_names,
+                                                       ",")));
+  entity_names.push_back(intern(tal.entity_name));
+  tally_names.push_back(intern(tal.tally_name));
+  entity_sizes.push_back(tal.entity_size);
+  normalizations.push_back(tal.normalization);
+  return entity_ids.size() - 1;
+}
+
+pyne::Tally pyne::TallyCollection::at(int i) const {
+  if (i < 0 || i >= size())
+    throw std::out_of_range("tally index out of range");
+  Tally tal;
+  tal.entity_id = entity_ids[i];
+  tal.entity_type = entity_type_enum2string[entity_types[i]];
+  tal.tally_type = tally_type_enum2string[tally_types[i]];
+  // split the comma separated particle names
+  const std::string& names = strings[particle_names[i]];
+  size_t start = 0;
+  while (start < names.size()) {
+    size_t end = names.find(',', start);
+    if (end == std::string::npos)
+      end = names.size();
+    tal.particle_names.push_back(names.substr(start, end - start));
+    start = end + 1;
+  }
+  tal.entity_name = strings[entity_names[i]];
+  tal.tally_name = strings[tally_names[i]];
+  tal.entity_size = entity_sizes[i];
+  tal.normalization = normalizations[i];
+  return tal;
+}
+
+void pyne::TallyCollection::clear() {
+  entity_ids.clear();
+  entity_types.clear();
+  tally_types.clear();
+  particle_names.clear();
+  entity_names.clear();
+  tally_names.clear();
+  entity_sizes.clear();
+  normalizations.clear();
+  strings.clear();
+  string_ids.clear();
+}
+
+void pyne::TallyCollection::reserve(int n) {
+  entity_ids.reserve(n);
+  entity_types.reserve(n);
+  tally_types.reserve(n);
+  particle_names.reserve(n);
+  entity_names.reserve(n);
+  tally_names.reserve(n);
+  entity_sizes.reserve(n);
+  normalizations.reserve(n);
+}
+
+void pyne::TallyCollection::write_hdf5(std::string filename,
+                                       std::string datapath) {
+  // turn of annoying hdf5 errors
+  H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
+
+  // the rows to write, whose strings point into the interned ones
+  hsize_t n = size();
+  std::vector<tally_struct> tally_data(n);
+  for (int i = 0; i < n; i++) {
+    tally_data[i].entity_id = entity_ids[i];
+    tally_data[i].entity_type = entity_types[i];
+    tally_data[i].tally_type = tally_types[i];
+    tally_data[i].particle_name = strings[particle_names[i]].c_str();
+    tally_data[i].entity_name = strings[entity_names[i]].c_str();
+    tally_data[i].tally_name = strings[tally_names[i]].c_str();
+    tally_data[i].entity_size = entity_sizes[i];
+    tally_data[i].normalization = normalizations[i];
+  }
+
+  bool is_exist = pyne::file_exists(filename);
+  if (is_exist && !H5Fis_hdf5(filename.c_str()))
+    throw h5wrap::FileNotHDF5(filename);
+
+  hid_t file;
+  if (is_exist)
+    file = H5Fopen(filename.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+  else
+    file = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT,
+                     H5P_DEFAULT);
+
+  herr_t status;
+  hsize_t offset[1] = {0};
+  hid_t dset;
+  if (is_exist && H5Lexists(file, datapath.c_str(), H5P_DEFAULT) > 0) {
+    // append after the rows already there
+    dset = H5Dopen2(file, datapath.c_str(), H5P_DEFAULT);
+    hid_t space = H5Dget_space(dset);
+    H5Sget_simple_extent_dims(space, offset, NULL);
+    status = H5Sclose(space);
+    hsize_t dims[1] = {offset[0] + n};
+    status = H5Dset_extent(dset, dims);
+  } else {
+    // chunks of up to 1024 rows rather than one row per chunk
+    hsize_t chunk = std::max<hsize_t>(1, std::min<hsize_t>(n, 1024));
+    dset = create_tally_dataset(file, datapath, n, chunk);
+  }
+  if (dset < 0) {
+    H5Fclose(file);
+    throw h5wrap::PathNotFound(filename, datapath);
+  }
+
+  // write all of the rows at once
+  if (n > 0) {
+    hid_t memtype = tally_memtype();
+    hid_t filespace = H5Dget_space(dset);
+    hsize_t count[1] = {n};
+    status = H5Sselect_hyperslab(filespace, H5S_SELECT_SET, offset, NULL,
+                                 count, NULL);
+    hid_t memspace = H5Screate_simple(1, count, NULL);
+    status = H5Dwrite(dset, memtype, memspace, filespace, H5P_DEFAULT,
+                      &tally_data[0]);
+    H5Sclose(memspace);
+    H5Sclose(filespace);
+    H5Tclose(memtype);
+  }
+  H5Dclose(dset);
+  H5Fclose(file);
+}
+
+void pyne::TallyCollection::from_hdf5(std::string filename,
+                                      std::string datapath) {
+  // check for file existence
+  if (!pyne::file_exists(filename))
+    throw pyne::FileNotFound(filename);
+
+  // check to make sure is a HDF5 file
+  if (!H5Fis_hdf5(filename.c_str()))
+    throw h5wrap::FileNotHDF5(filename);
+
+  H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
+  hid_t file = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  hid_t dset = H5Dopen2(file, datapath.c_str(), H5P_DEFAULT);
+  if (dset < 0) {
+    H5Fclose(file);
+    throw h5wrap::PathNotFound(filename, datapath);
+  }
+
+  // read all of the rows at once
+  hid_t space = H5Dget_space(dset);
+  hsize_t dims[1] = {0};
+  H5Sget_simple_extent_dims(space, dims, NULL);
+  std::vector<tally_struct> read_data(dims[0]);
+  hid_t memtype = tally_memtype();
+  herr_t status = 0;
+  if (dims[0] > 0)
+    status = H5Dread(dset, memtype, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+                     &read_data[0]);
+
+  clear();
+  reserve(dims[0]);
+  bool valid = status >= 0;
+  for (int i = 0; valid && i < dims[0]; i++) {
+    const tally_struct& row = read_data[i];
+    valid = (row.entity_type == VOLUME || row.entity_type == SURFACE) &&
+            (row.tally_type == FLUX || row.tally_type == CURRENT);
+    if (!valid)
+      break;
+    entity_ids.push_back(row.entity_id);
+    entity_types.push_back(row.entity_type);
+    tally_types.push_back(row.tally_type);
+    particle_names.push_back(intern(row.particle_name));
+    entity_names.push_back(intern(row.entity_name));
+    tally_names.push_back(intern(row.tally_name));
+    entity_sizes.push_back(row.entity_size);
+    normalizations.push_back(row.normalization);
+  }
+
+  // tidy up
+  if (dims[0] > 0 && status >= 0)
+    H5Dvlen_reclaim(memtype, space, H5P_DEFAULT, &read_data[0]);
+  H5Tclose(memtype);
+  H5Sclose(space);
+  H5Dclose(dset);
+  H5Fclose(file);
+  if (!valid) {
+    clear();
+    throw std::invalid_argument(datapath + " in " + filename +
+                                " does not hold volume or surface tallies");
+  }
+}
+
 std::ostream& operator<<(std::ostream& os, pyne::Tally tal) {
   //print the Tally to ostream
   os << "\t---------\n";
@@ -449,6 +693,12 @@ std::ostream& operator<<(std::ostream& os, pyne::Tally tal) {
 std::string pyne::Tally::mcnp(int tally_index, std::string mcnp_version,
                               std::string out) {
   std::stringstream output;  // output stream
+  mcnp(output, tally_index, mcnp_version, out);
+  return output.str();
+}
+
+void pyne::Tally::mcnp(std::ostream& output, int tally_index,
+                       std::string mcnp_version, std::string out) {
   std::string particle_token = "";
 
   if (particle_names.size() == 0) {
@@ -466,44 +716,46 @@ std::string pyne::Tally::mcnp(int tally_index, std::string mcnp_version,
     else
       particle_token += "?";
   }
-  // print out comment line
-  output << "C " << tally_name << std::endl;
-  output << std::setiosflags(std::ios::fixed) << std::setprecision(6);
 
-  if (normalization != 1.0) output << std::scientific;
+  bool is_surface = entity_type.find("Surface") != std::string::npos;
+  bool is_volume = !is_surface &&
+                   entity_type.find("Volume") != std::string::npos;
+  // makes no sense in mcnp
+  if (is_volume && tally_type.find("Flux") == std::string::npos &&
+      tally_type.find("Current") != std::string::npos)
+    return;
+
+  pyne::StreamFormatSaver saver (output);
+  // print out comment line
+  output << "C " << tally_name << "\n";
   int tally_id = 0;
 
   // neednt check entity type
-  if (entity_type.find("Surface") != std::string::npos) {
+  if (is_surface) {
     if (tally_type.find("Current") != std::string::npos) {
       tally_id = 1;
     } else if (tally_type.find("Flux") != std::string::npos) {
       tally_id = 2;
     }
-    output << form_mcnp_tally(tally_index, tally_id, particle_token, entity_id,
-                              entity_size, normalization);
+    form_mcnp_tally(output, tally_index, tally_id, particle_token, entity_id,
+                    entity_size, normalization);
 
-  } else if (entity_type.find("Volume") != std::string::npos) {
+  } else if (is_volume) {
     if (tally_type.find("Flux") != std::string::npos) {
       tally_id = 4;
-    } else if (tally_type.find("Current") != std::string::npos) {
-      // makes no sense in mcnp
-      return "";
     }
-    output << form_mcnp_tally(tally_index, tally_id, particle_token, entity_id,
-                              entity_size, normalization);
+    form_mcnp_tally(output, tally_index, tally_id, particle_token, entity_id,
+                    entity_size, normalization);
 
   } else if (entity_type.find("Mesh") != std::string::npos) {
-    output << form_mcnp_meshtally(tally_index, particle_token, entity_geometry,
-                                  axs, vec, origin, meshes, ints, e_bounds,
-                                  e_ints, out);
+    form_mcnp_meshtally(output, tally_index, particle_token, entity_geometry,
+                        axs, vec, origin, meshes, ints, e_bounds, e_ints, out);
 
   } else {
     std::cout << "tally/entity combination makes no sense for MCNP"
               << std::endl;
   }
   // print sd card if area/volume specified
-  return output.str();
 }
 
 template <typename T>
@@ -521,21 +773,29 @@ std::string pyne::Tally::form_mcnp_tally(int tally_index, int type,
                                          int entity_id, double entity_size,
                                          double normalization) {
   std::stringstream tally_stream;  // tally stream
+  form_mcnp_tally(tally_stream, tally_index, type, particle_token, entity_id,
+                  entity_size, normalization);
+  return tally_stream.str();
+}
+
+void pyne::Tally::form_mcnp_tally(std::ostream& tally_stream, int tally_index,
+                                  int type, std::string particle_token,
+                                  int entity_id, double entity_size,
+                                  double normalization) {
+  pyne::StreamFormatSaver saver (tally_stream);
   tally_stream << std::setiosflags(std::ios::fixed) << std::setprecision(6);
   if (normalization != 1.0) tally_stream << std::scientific;
 
   tally_stream << "F" << tally_index << type << ":" << particle_token << " "
-               << entity_id << std::endl;
+               << entity_id << "\n";
 
   if (entity_size > 0.0)
     tally_stream << "SD" << tally_index << type << " " << entity_size
-                 << std::endl;
+                 << "\n";
 
   if (normalization != 1.0)
     tally_stream << "FM" << tally_index << type << " " << normalization
-                 << std::endl;
-
-  return tally_stream.str();
+                 << "\n";
 }
 
 
@@ -547,6 +807,20 @@ std::string pyne::Tally::form_mcnp_meshtally(
     std::vector<int> ints[3], std::vector<double> e_bounds,
     std::vector<int> e_ints, std::string out) {
   std::stringstream mtally_stream;
+  form_mcnp_meshtally(mtally_stream, tally_index, particle_token,
+                      entity_geometry, axs, vec, origin, meshes, ints,
+                      e_bounds, e_ints, out);
+  return mtally_stream.str();
+}
+
+void pyne::Tally::form_mcnp_meshtally(
+    std::ostream& mtally_stream, int tally_index, std::string particle_token,
+    std::string entity_geometry, const std::vector<double>& axs,
+    const std::vector<double>& vec, const std::vector<double>& origin,
+    const std::vector<double> meshes[3], const std::vector<int> ints[3],
+    const std::vector<double>& e_bounds, const std::vector<int>& e_ints,
+    std::string out) {
+  pyne::StreamFormatSaver saver (mtally_stream);
   // indentation block
   std::string indent_block = "          ";
 
@@ -554,20 +828,20 @@ std::string pyne::Tally::form_mcnp_meshtally(
   mtally_stream << "GEOM=";
 
   if (entity_geometry.find("Cartesian") != std::string::npos) {
-    mtally_stream << "XYZ" << std::endl;
+    mtally_stream << "XYZ" << "\n";
     mtally_stream << indent_block;
   } else if (entity_geometry.find("Cylinder") != std::string::npos) {
-    mtally_stream << "CYL" << std::endl;
+    mtally_stream << "CYL" << "\n";
     if (!is_zero(axs)) {
-      mtally_stream << indent_block << "AXS=" << pyne::join_to_string(axs) << std::endl;
+      mtally_stream << indent_block << "AXS=" << pyne::join_to_string(axs) << "\n";
     }
     if (!is_zero(vec)) {
-      mtally_stream << indent_block << "VEC=" << pyne::join_to_string(vec) << std::endl;
+      mtally_stream << indent_block << "VEC=" << pyne::join_to_string(vec) << "\n";
     }
     mtally_stream << indent_block;
   }
 
-  mtally_stream << "ORIGIN=" << pyne::join_to_string(origin) << std::endl;
+  mtally_stream << "ORIGIN=" << pyne::join_to_string(origin) << "\n";
   std::string dir_name[3] = {"I", "J", "K"};
 
   for (int j = 0; j < 3; j++) {
@@ -577,19 +851,18 @@ std::string pyne::Tally::form_mcnp_meshtally(
       mtally_stream << " " << dir_name[j]
                     << "INTS=" << pyne::join_to_string(ints[j]);
     }
-    mtally_stream << std::endl;
+    mtally_stream << "\n";
   }
   if (e_bounds.size() > 0) {
     mtally_stream << indent_block << "EMESH=" << pyne::join_to_string(e_bounds);
   }
-  mtally_stream << std::endl;
+  mtally_stream << "\n";
   if (e_ints.size() > 0) {
     mtally_stream << indent_block << "EINTS=" << pyne::join_to_string(e_ints);
   }
   if (out.size() > 0) {
-    mtally_stream << std::endl << indent_block << "OUT=" << out;
+    mtally_stream << "\n" << indent_block << "OUT=" << out;
   }
-  return mtally_stream.str();
 }
 
 
@@ -13,6 +13,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 #ifndef PYNE_IS_AMALGAMATED
   #include "h5wrap.h"
@@ -131,6 +132,11 @@ namespace pyne
     // mcnp tally
     std::string mcnp(int tally_index = 1, std::string mcnp_version = "mcnp5",
                      std::string out = "");
+    /// Writes the mcnp tally cards to \a os rather than returning them, so
+    /// that whole decks are streamed without intermediate strings. The
+    /// formatting state of \a os is restored afterwards.
+    void mcnp(std::ostream& os, int tally_index = 1,
+              std::string mcnp_version = "mcnp5", std::string out = "");
 
     template<typename T> bool is_zero(T vect);
 
@@ -145,6 +151,18 @@ namespace pyne
         std::vector<double> origin, std::vector<double> meshes[3],
         std::vector<int> ints[3], std::vector<double> e_bounds,
         std::vector<int> e_ints, std::string out);
+    /// Writes the mcnp tally line to \a os.
+    void form_mcnp_tally(std::ostream& os, int tally_index, int type,
+                         std::string particle_token, int entity_id,
+                         double entity_size, double normalization);
+    /// Writes the mesh tally line to \a os.
+    void form_mcnp_meshtally(
+        std::ostream& os, int tally_index, std::string particle_token,
+        std::string entity_geometry, const std::vector<double>& axs,
+        const std::vector<double>& vec, const std::vector<double>& origin,
+        const std::vector<double> meshes[3], const std::vector<int> ints[3],
+        const std::vector<double>& e_bounds, const std::vector<int>& e_ints,
+        std::string out);
     
     // fluka tally
     std::string fluka(std::string unit_number = "-21");
@@ -189,6 +207,70 @@ namespace pyne
     double normalization;
   } tally_struct;
 
+  /// A set of volume and surface tallies stored column by column, which is
+  /// written to or read from HDF5 in one operation. The names of the tallies
+  /// are interned, so each distinct string is stored once and the columns
+  /// hold indices into strings. The HDF5 layout is that of
+  /// Tally::write_hdf5(), so either class can read back what the other wrote.
+  class TallyCollection
+  {
+  public:
+    /// empty collection constructor
+    TallyCollection();
+
+    /// Constructor from a vector of volume and surface tallies
+    TallyCollection(const std::vector<Tally>& tallies);
+
+    /// Appends a tally to the collection, throwing std::invalid_argument if
+    /// it is not a volume or surface tally of flux or current.
+    /// \param tal the tally to append
+    /// \return the index of the tally
+    int push_back(const Tally& tal);
+
+    /// Returns the tally at index  i.
+    Tally at(int i) const;
+
+    /// Returns the number of tallies.
+    int size() const {return entity_ids.size();};
+
+    /// Removes all tallies and strings.
+    void clear();
+
+    /// Reserves storage for  n tallies.
+    void reserve(int n);
+
+    /// Returns the index of  s in strings, adding it if it is new.
+    int intern(const std::string& s);
+
+    /// Writes all tallies with one HDF5 write, appending them to the dataset
+    /// at  datapath if it exists and creating the file or dataset if not.
+    /// \param filename the filename of the file to write to
+    /// \param datapath the name of the dataset where tallies are stored
+    void write_hdf5(std::string filename, std::string datapath);
+
+    /// Replaces the tallies by the whole dataset at  datapath, read with
+    /// one HDF5 read.
+    /// \param filename the filename of the file to read from
+    /// \param datapath the name of the dataset where tallies are stored
+    void from_hdf5(std::string filename, std::string datapath);
+
+    // columns, one entry per tally
+    std::vector<int> entity_ids;      ///< id of the entity tallied upon
+    std::vector<int> entity_types;    ///< 0 for volumes, 1 for surfaces
+    std::vector<int> tally_types;     ///< 0 for flux, 1 for current
+    std::vector<int> particle_names;  ///< comma separated particle names
+    std::vector<int> entity_names;    ///< entity name
+    std::vector<int> tally_names;     ///< tally name
+    std::vector<double> entity_sizes;    ///< physical size of the entity
+    std::vector<double> normalizations;  ///< tally normalization
+
+    /// the interned strings that the name columns index
+    std::vector<std::string> strings;
+
+  private:
+    std::map<std::string, int> string_ids;  ///< index of each interned string
+  };
+
 // End pyne namespace
 }
 
@@ -1,63 +1,289 @@
 extern "C" {
 #include "cram.hpp"
 }
+#include <string.h>
+
 #include "utils.h"
+#include "instrument.h"
+#include "data.h"
+#include "rxname.h"
 #include "transmuters.h"
 
 
-std::map<int, double> pyne::transmuters::cram(std::vector<double>& A,
-                                              const std::map<int, double>& n0,
-                                              const int order) {
-  using std::map;
-  using std::vector;
-  // Get intial condition vector
-  vector<double> b (pyne_cram_transmute_info.n, 0.0);
-  map<int, double>::const_iterator it;
-  int i = -1;
-  for (it = n0.begin(); it != n0.end(); ++it) {
-    i = pyne_cram_transmute_nucid_to_i(it->first);
-    if (i < 0) {
-      continue;
-    }
-    b[i] = it->second;
-  }
+typedef void (*expm_multiply_func)(double*, double*, double*);
 
-  // perform decay
-  vector<double> x (pyne_cram_transmute_info.n);
+// Returns the generated CRAM solver of a given order.
+static expm_multiply_func expm_multiply_for(const int order) {
   switch(order) {
     case 6:
-      pyne_cram_expm_multiply6(A.data(), b.data(), x.data());
-      break;
+      return pyne_cram_expm_multiply6;
     case 8:
-      pyne_cram_expm_multiply8(A.data(), b.data(), x.data());
-      break;
+      return pyne_cram_expm_multiply8;
     case 10:
-      pyne_cram_expm_multiply10(A.data(), b.data(), x.data());
-      break;
+      return pyne_cram_expm_multiply10;
     case 12:
-      pyne_cram_expm_multiply12(A.data(), b.data(), x.data());
-      break;
+      return pyne_cram_expm_multiply12;
     case 14:
-      pyne_cram_expm_multiply14(A.data(), b.data(), x.data());
-      break;
+      return pyne_cram_expm_multiply14;
     case 16:
-      pyne_cram_expm_multiply16(A.data(), b.data(), x.data());
-      break;
+      return pyne_cram_expm_multiply16;
     case 18:
-      pyne_cram_expm_multiply18(A.data(), b.data(), x.data());
-      break;
+      return pyne_cram_expm_multiply18;
     default:
       throw pyne::ValueError("Order selected not available for CRAM, please use"
                              " order 6, 8, 10, 12, 14, 16, or 18.");
-      break;
   }
+}
 
-  // convert back to map
-  map<int, double> n1;
-  for (i=0; i < pyne_cram_transmute_info.n; ++i) {
+// Scatters a composition map into a dense vector in CRAM index order.
+static void comp_to_vector(const std::map<int, double>& n0, double* b) {
+  int i = -1;
+  std::map<int, double>::const_iterator it;
+  for (it = n0.begin(); it != n0.end(); ++it) {
+    i = pyne_cram_transmute_nucid_to_i(it->first);
+    if (i < 0) {
+      continue;
+    }
+    b[i] = it->second;
+  }
+}
+
+// Gathers the positive entries of a dense vector into a composition map.
+static std::map<int, double> vector_to_comp(const double* x) {
+  std::map<int, double> n1;
+  for (int i=0; i < pyne_cram_transmute_info.n; ++i) {
     if (x[i] > 0.0) {
       n1[(pyne_cram_transmute_info.nucids)[i]] = x[i];
     }
   }
   return n1;
-}
\ No newline at end of file
+}
+
+
+std::map<int, double> pyne::transmuters::cram(const std::vector<double>& A,
+                                              const std::map<int, double>& n0,
+                                              const int order) {
+  using std::vector;
+  PYNE_TIME(TIME_CRAM);
+  expm_multiply_func expm_multiply = expm_multiply_for(order);
+  PYNE_COUNT_ID(pyne::instrument::cram_order_counter(order));
+  // Get intial condition vector
+  vector<double> b (pyne_cram_transmute_info.n, 0.0);
+  comp_to_vector(n0, b.data());
+
+  // perform decay
+  // The generated solvers take non-const arguments but do not modify A.
+  vector<double> x (pyne_cram_transmute_info.n);
+  expm_multiply(const_cast<double*>(A.data()), b.data(), x.data());
+
+  // convert back to map
+  return vector_to_comp(x.data());
+}
+
+std::vector<int> pyne::transmuters::cram_nucids() {
+  return std::vector<int>(pyne_cram_transmute_info.nucids,
+                          pyne_cram_transmute_info.nucids +
+                          pyne_cram_transmute_info.n);
+}
+
+
+pyne::transmuters::CramSolver::CramSolver(const std::vector<double>& A,
+                                          const int order)
+  : n(pyne_cram_transmute_info.n), order(order),
+    expm_multiply(expm_multiply_for(order)), A(A), work_b(n), work_x(n) {
+  if ((int) A.size() != pyne_cram_transmute_info.nnz)
+    throw pyne::ValueError("The flat A matrix must have one entry per "
+                           "non-zero of the CRAM sparsity pattern.");
+}
+
+void pyne::transmuters::CramSolver::solve(const double* b, double* x) {
+  // The generated solvers take non-const arguments, so the inputs are
+  // staged in the workspace rather than handed over directly.
+  memcpy(work_b.data(), b, n*sizeof(double));
+  PYNE_COUNT_ID(pyne::instrument::cram_order_counter(order));
+  expm_multiply(A.data(), work_b.data(), x);
+}
+
+void pyne::transmuters::CramSolver::solve_many(const double* b, int nrhs,
+                                               double* x) {
+  for (int k=0; k<nrhs; ++k)
+    solve(b + (size_t) k*n, x + (size_t) k*n);
+}
+
+std::map<int, double> pyne::transmuters::CramSolver::solve(
+    const std::map<int, double>& n0) {
+  std::fill(work_x.begin(), work_x.end(), 0.0);
+  comp_to_vector(n0, work_x.data());
+  solve(work_x.data(), work_x.data());
+  return vector_to_comp(work_x.data());
+}
+
+void pyne::transmuters::CramSolver::assemble(const CramMatrixBuilder& builder,
+                                             const double* rates, double dt) {
+  builder.assemble(rates, dt, A.data());
+}
+
+
+pyne::transmuters::CramDepletion::CramDepletion(
+    const std::map<int, double>& n0, const int order)
+  : order(order), expm_multiply(expm_multiply_for(order)),
+    A(pyne_cram_transmute_info.nnz), b(pyne_cram_transmute_info.n),
+    x(pyne_cram_transmute_info.n, 0.0) {
+  comp_to_vector(n0, x.data());
+}
+
+void pyne::transmuters::CramDepletion::step(const std::vector<double>& A) {
+  if ((int) A.size() != pyne_cram_transmute_info.nnz)
+    throw pyne::ValueError("The flat A matrix must have one entry per "
+                           "non-zero of the CRAM sparsity pattern.");
+  std::copy(A.begin(), A.end(), this->A.begin());
+  advance();
+}
+
+void pyne::transmuters::CramDepletion::step(const std::vector<double>& A,
+                                            double dt) {
+  if ((int) A.size() != pyne_cram_transmute_info.nnz)
+    throw pyne::ValueError("The flat A matrix must have one entry per "
+                           "non-zero of the CRAM sparsity pattern.");
+  for (int k=0; k<A.size(); ++k)
+    this->A[k] = A[k] * dt;
+  advance();
+}
+
+void pyne::transmuters::CramDepletion::advance() {
+  b.swap(x);
+  PYNE_COUNT_ID(pyne::instrument::cram_order_counter(order));
+  expm_multiply(A.data(), b.data(), x.data());
+}
+
+std::map<int, double> pyne::transmuters::CramDepletion::get_comp() const {
+  return vector_to_comp(x.data());
+}
+
+
+pyne::transmuters::CramMatrixBuilder::CramMatrixBuilder(bool decay)
+  : n(pyne_cram_transmute_info.n), decay(pyne_cram_transmute_info.nnz, 0.0) {
+  init();
+  // the generated decay matrix is the negated rate matrix
+  if (decay)
+    for (int k=0; k<pyne_cram_transmute_info.nnz; ++k)
+      this->decay[k] = -pyne_cram_transmute_info.decay_matrix[k];
+}
+
+pyne::transmuters::CramMatrixBuilder::CramMatrixBuilder(
+    const pyne::DecayGraph& graph)
+  : n(pyne_cram_transmute_info.n), decay(pyne_cram_transmute_info.nnz, 0.0) {
+  init();
+  for (int p=0; p<graph.size(); ++p) {
+    int j = index(graph.nucs()[p]);
+    double lambda = graph.decay_const(p);
+    int diag = slot(j, j);
+    if (diag < 0 || lambda == 0.0)
+      continue;
+    decay[diag] -= lambda;
+    const int* children = graph.children(p);
+    const double* ratios = graph.branch_ratios(p);
+    for (int c=0; c<graph.num_children(p); ++c) {
+      int k = slot(index(children[c]), j);
+      if (k >= 0 && k != diag)
+        decay[k] += lambda * ratios[c];
+    }
+  }
+}
+
+void pyne::transmuters::CramMatrixBuilder::init() {
+  // open addressing tables at most half full
+  int nnz = pyne_cram_transmute_info.nnz;
+  unsigned int cap = 1;
+  while (cap < 2u*nnz)
+    cap <<= 1;
+  mask = cap - 1;
+  slot_keys.assign(cap, -1);
+  slot_vals.assign(cap, -1);
+  nucid_keys.assign(cap, -1);
+  nucid_vals.assign(cap, -1);
+  for (int k=0; k<nnz; ++k)
+    insert(slot_keys, slot_vals, pyne_cram_transmute_info.i[k]*n +
+           pyne_cram_transmute_info.j[k], k);
+  for (int i=0; i<n; ++i)
+    insert(nucid_keys, nucid_vals, pyne_cram_transmute_info.nucids[i], i);
+}
+
+int pyne::transmuters::CramMatrixBuilder::find(const std::vector<int>& keys,
+                                               const std::vector<int>& vals,
+                                               int key) const {
+  unsigned int h = ((unsigned int) key * 2654435761u) & mask;
+  while (keys[h] != -1) {
+    if (keys[h] == key)
+      return vals[h];
+    h = (h + 1) & mask;
+  }
+  return -1;
+}
+
+void pyne::transmuters::CramMatrixBuilder::insert(std::vector<int>& keys,
+                                                  std::vector<int>& vals,
+                                                  int key, int val) {
+  unsigned int h = ((unsigned int) key * 2654435761u) & mask;
+  while (keys[h] != -1 && keys[h] != key)
+    h = (h + 1) & mask;
+  keys[h] = key;
+  vals[h] = val;
+}
+
+int pyne::transmuters::CramMatrixBuilder::index(int nucid) const {
+  if (nucid < 0)
+    return -1;
+  return find(nucid_keys, nucid_vals, nucid);
+}
+
+int pyne::transmuters::CramMatrixBuilder::slot(int i, int j) const {
+  if (i < 0 || i >= n || j < 0 || j >= n)
+    return -1;
+  return find(slot_keys, slot_vals, i*n + j);
+}
+
+int pyne::transmuters::CramMatrixBuilder::add_channel(int parent, int child) {
+  int i = index(parent);
+  if (i < 0)
+    throw pyne::ValueError("The parent nuclide is not tracked by CRAM.");
+  int diag_slot = slot(i, i);
+  int c = index(child);
+  int child_slot = c < 0 ? -1 : slot(c, i);
+  if (diag_slot < 0 || (c >= 0 && child_slot < 0))
+    throw pyne::ValueError("The reaction channel is not in the CRAM "
+                           "sparsity pattern.");
+  diag_slots.push_back(diag_slot);
+  child_slots.push_back(child_slot);
+  return num_channels() - 1;
+}
+
+int pyne::transmuters::CramMatrixBuilder::add_channel(int parent,
+                                                      std::string rx,
+                                                      std::string z) {
+  return add_channel(parent, pyne::rxname::child(parent, rx, z));
+}
+
+void pyne::transmuters::CramMatrixBuilder::assemble(const double* rates,
+                                                    double dt,
+                                                    double* A) const {
+  int nnz = this->nnz();
+  for (int k=0; k<nnz; ++k)
+    A[k] = decay[k] * dt;
+  int nch = num_channels();
+  for (int c=0; c<nch; ++c) {
+    double r = rates[c] * dt;
+    A[diag_slots[c]] -= r;
+    if (child_slots[c] >= 0)
+      A[child_slots[c]] += r;
+  }
+}
+
+std::vector<double> pyne::transmuters::CramMatrixBuilder::assemble(
+    const std::vector<double>& rates, double dt) const {
+  if ((int) rates.size() != num_channels())
+    throw pyne::ValueError("There must be one reaction rate per channel.");
+  std::vector<double> A (nnz());
+  assemble(rates.data(), dt, A.data());
+  return A;
+}
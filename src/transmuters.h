@@ -2,9 +2,12 @@
 #define PYNE_DQKIQSJ4SNG7VAB5LX36BLIYMA
 
 #include <map>
+#include <string>
 #include <vector>
 
 namespace pyne {
+class DecayGraph;
+
 namespace transmuters {
 
 
@@ -14,10 +17,170 @@ namespace transmuters {
 /// \param n0 The initial compositions [atom fraction]
 /// \param order The order of approximation, default 14.
 /// \return n1 The result of the transmutation [atom fraction]
-std::map<int, double> cram(std::vector<double>& A,
+std::map<int, double> cram(const std::vector<double>& A,
                            const std::map<int, double>& n0,
                            const int order=14);
 
+/// Returns the nuclide ids of the CRAM index space, in order.
+std::vector<int> cram_nucids();
+
+class CramMatrixBuilder;
+
+/// CRAM solver for applying the same (flat) A matrix to many initial
+/// compositions. The approximation order is resolved and the matrix and work
+/// vectors are set up once, so each solve only evaluates the rational
+/// approximation. Compositions are dense vectors of length size() in the
+/// CRAM nuclide order (pyne_cram_transmute_info.nucids); a set of nrhs of them
+/// is stored column-major, composition k starting at element k*size().
+class CramSolver {
+ public:
+  /// Constructor
+  /// \param A The transmutation matrix [unitless]
+  /// \param order The order of approximation, default 14.
+  CramSolver(const std::vector<double>& A, const int order=14);
+
+  /// Returns the number of nuclides in the CRAM index space.
+  int size() const {return n;};
+  /// Returns the order of approximation.
+  int get_order() const {return order;};
+
+  /// Transmutes one dense composition.
+  /// \param b The size() initial compositions [atom fraction]
+  /// \param x The size() resulting compositions [atom fraction]
+  void solve(const double* b, double* x);
+  /// Transmutes a column-major block of dense compositions.
+  /// \param b The size()*nrhs initial compositions [atom fraction]
+  /// \param nrhs The number of compositions
+  /// \param x The size()*nrhs resulting compositions [atom fraction]
+  void solve_many(const double* b, int nrhs, double* x);
+  /// Transmutes a nuclide atom fraction composition map, see cram().
+  std::map<int, double> solve(const std::map<int, double>& n0);
+  /// Rebuilds the matrix of this solver in place, see
+  /// CramMatrixBuilder::assemble().
+  /// \param builder The assembler, which must have been set up for the CRAM
+  ///        sparsity pattern of this solver
+  /// \param rates The builder.num_channels() reaction rates [1/s]
+  /// \param dt The length of the step [s]
+  void assemble(const CramMatrixBuilder& builder, const double* rates,
+                double dt);
+
+ private:
+  typedef void (*expm_multiply_func)(double*, double*, double*);
+  int n; ///< Number of nuclides
+  int order; ///< Order of approximation
+  expm_multiply_func expm_multiply; ///< Generated solver for \a order
+  std::vector<double> A; ///< Transmutation matrix
+  std::vector<double> work_b; ///< Initial composition workspace
+  std::vector<double> work_x; ///< Result workspace
+};
+
+/// Dense nuclide vector in the CRAM index space that is carried through a
+/// sequence of transmutation steps, so that no composition map is built
+/// between steps. The vector is in the CRAM nuclide order
+/// (pyne_cram_transmute_info.nucids).
+class CramDepletion {
+ public:
+  /// Constructor
+  /// \param n0 The initial compositions [atom fraction]
+  /// \param order The order of approximation, default 14.
+  CramDepletion(const std::map<int, double>& n0, const int order=14);
+
+  /// Advances by one step.
+  /// \param A The transmutation matrix of the step [unitless]
+  void step(const std::vector<double>& A);
+  /// Advances by one step of a given length.
+  /// \param A The flat rate matrix, e.g. the decay matrix [1/s]
+  /// \param dt The length of the step [s]
+  void step(const std::vector<double>& A, double dt);
+
+  /// Returns the current dense compositions [atom fraction]
+  const std::vector<double>& get_vector() const {return x;};
+  /// Returns the current compositions as a nuclide map [atom fraction]
+  std::map<int, double> get_comp() const;
+  /// Returns the order of approximation.
+  int get_order() const {return order;};
+
+ private:
+  typedef void (*expm_multiply_func)(double*, double*, double*);
+  void advance();
+  int order; ///< Order of approximation
+  expm_multiply_func expm_multiply; ///< Generated solver for \a order
+  std::vector<double> A; ///< Transmutation matrix of the current step
+  std::vector<double> b; ///< Compositions at the start of the step
+  std::vector<double> x; ///< Current compositions
+};
+
+/// Bulk assembler of flat A matrices in the fixed CRAM sparsity pattern
+/// (pyne_cram_transmute_info.i/j). A hash from (i, j) to the slot in the flat
+/// array is built once, and reaction channels are resolved to their slots when
+/// they are added, so rebuilding A for a new set of reaction rates is a single
+/// pass over the decay matrix and the channels. This makes it cheap enough to
+/// assemble one matrix per mesh voxel.
+class CramMatrixBuilder {
+ public:
+  /// Constructor
+  /// \param decay Whether the decay matrix is included in the assembled
+  ///        matrices, default true.
+  CramMatrixBuilder(bool decay=true);
+  /// Constructor with the decay rate matrix taken from a decay graph rather
+  /// than the generated one, e.g. pyne::decay_graph(). Decays to or from
+  /// nuclides outside the CRAM sparsity pattern are left out.
+  /// \param graph The decay graph
+  CramMatrixBuilder(const pyne::DecayGraph& graph);
+
+  /// Returns the number of nuclides in the CRAM index space.
+  int size() const {return n;};
+  /// Returns the number of non-zeros of the CRAM sparsity pattern.
+  int nnz() const {return (int) decay.size();};
+  /// Returns the number of reaction channels added so far.
+  int num_channels() const {return (int) diag_slots.size();};
+
+  /// Returns the CRAM index of a nuclide, or -1 if it is not tracked.
+  int index(int nucid) const;
+  /// Returns the slot of entry (i, j) in the flat array, or -1 if the entry
+  /// is not in the sparsity pattern.
+  int slot(int i, int j) const;
+
+  /// Adds a reaction channel that removes \a parent and produces \a child.
+  /// A child that is not tracked by CRAM, e.g. 0, only removes the parent.
+  /// \param parent The nuclide id of the target
+  /// \param child The nuclide id of the product
+  /// \return The index of the channel in the rates given to assemble()
+  int add_channel(int parent, int child);
+  /// Adds a reaction channel whose product is given by rxname::child().
+  /// \param parent The nuclide id of the target
+  /// \param rx The reaction name or id, e.g. "gamma"
+  /// \param z The incident particle type, default "n"
+  /// \return The index of the channel in the rates given to assemble()
+  int add_channel(int parent, std::string rx, std::string z="n");
+
+  /// Assembles the flat transmutation matrix dt*(D + R), where D is the decay
+  /// rate matrix and R holds the reaction rates of the channels.
+  /// \param rates The num_channels() reaction rates [1/s]
+  /// \param dt The length of the step [s]
+  /// \param A The nnz() entries of the transmutation matrix [unitless]
+  void assemble(const double* rates, double dt, double* A) const;
+  /// Assembles the flat transmutation matrix, see above.
+  std::vector<double> assemble(const std::vector<double>& rates,
+                               double dt) const;
+
+ private:
+  void init();
+  int find(const std::vector<int>& keys, const std::vector<int>& vals,
+           int key) const;
+  void insert(std::vector<int>& keys, std::vector<int>& vals, int key,
+              int val);
+  int n; ///< Number of nuclides
+  unsigned int mask; ///< Hash table capacity minus one
+  std::vector<int> slot_keys; ///< i*n + j of each hash table entry, or -1
+  std::vector<int> slot_vals; ///< Flat array slot of each hash table entry
+  std::vector<int> nucid_keys; ///< Nuclide id of each hash table entry, or -1
+  std::vector<int> nucid_vals; ///< CRAM index of each hash table entry
+  std::vector<double> decay; ///< Decay rate matrix [1/s], or zeros
+  std::vector<int> diag_slots; ///< Parent diagonal slot of each channel
+  std::vector<int> child_slots; ///< Child off-diagonal slot, or -1
+};
+
 } // namespace transmuters
 } // namespace pyne
-#endif // PYNE_DQKIQSJ4SNG7VAB5LX36BLIYMA
\ No newline at end of file
+#endif // PYNE_DQKIQSJ4SNG7VAB5LX36BLIYMA
@@ -158,6 +158,11 @@ ELSE IF (moments_converged < 0 .OR. moments_converged > lambda) THEN
    error_code = 1028
    RETURN
    !STOP
+ELSE IF (inner_solver /= "SI" .AND. inner_solver /= "GMRES") THEN
+   WRITE(8,'(/,3x,A)') "ERROR: Illegal inner solver. Must be SI or GMRES."
+   error_code = 1038
+   RETURN
+   !STOP
 
 ! Checks on the angular quadrature
 ELSE IF (MINVAL(ang) <= 0. .OR. MAXVAL(ang) >= 1.) THEN
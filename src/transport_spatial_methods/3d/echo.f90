@@ -35,6 +35,7 @@ WRITE (8,'(/,1X,A)') "Iteration Control Parameters"
 WRITE (8,105) "Maximum number of iterations = ", itmx
 WRITE (8,107) "Pointwise convergence criterion = ", convergence_criterion
 WRITE (8,105) "Highest moment converged = ", moments_converged
+WRITE (8,'(1X,A,A)') "Inner iteration solver = ", TRIM(inner_solver)
 107 FORMAT(1X,A,ES10.3)
 
 ! Write the names of the files used
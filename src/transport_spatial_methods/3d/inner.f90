@@ -3,7 +3,8 @@ SUBROUTINE inner(g)
 !-------------------------------------------------------------
 !
 !  Directs the inner iterations
-!   Calls for the mesh sweep in 'sweep'
+!   Calls for the mesh sweep in 'sweep', or hands the iterations to
+!   inner_gmres
 !   Evaulates convergence
 ! 
 !-------------------------------------------------------------
@@ -18,6 +19,11 @@ INTEGER :: i, j, k, t, u, v, it, l
 INTEGER :: id, jd, kd, td, ud, vd, gd
 REAL(kind=dp) :: df, dfmx
 
+IF (inner_solver == "GMRES") THEN
+    CALL inner_gmres(g)
+    RETURN
+END IF
+
 ! Initialize the previous flux iterate
 ! Initialize the old time point
 told = ttosolve
@@ -330,6 +336,9 @@ ELSE IF (solver == "SCTSTEP") THEN
 
 END IF
 
+! The number of sweeps, the last one included
+nits(g) = MIN(it, itmx)
+
 
 !"NEFD" AHOTN Solver formatting
 11101 FORMAT(2X,'Gr',I3,' It ',I5,' Pos ',3I4,' Mom ',3I2,' DfMx ',ES11.3,' Flx ',ES11.3, '  Time(s) ', F9.3)
@@ -0,0 +1,267 @@
+SUBROUTINE inner_gmres(g)
+
+!-------------------------------------------------------------
+!
+!  Solves the within group problem by restarted GMRES
+!   A source iteration is the fixed point iteration e <- A e + b of the
+!   mesh sweep, where b is the sweep of the external source and inflow and
+!   A the sweep of the scattering source alone. GMRES solves (I - A) e = b
+!   instead, taking one sweep per Krylov vector, which converges much faster
+!   than source iteration for highly scattering problems. The iteration
+!   count reported is the number of sweeps, including the first one for b
+!   and the last one that computes the flux from the converged e.
+!
+!   Convergence is on the residual b - (I - A) e, the change that
+!   another source iteration would make, relative to b.
+!
+!-------------------------------------------------------------
+
+USE invar
+USE solvar
+USE timevar
+use precision_module, only: dp
+IMPLICIT NONE
+INTEGER, INTENT(IN) :: g
+
+! Restart length; GMRES stores gmres_restart+1 group fluxes
+INTEGER, PARAMETER :: gmres_restart = 20
+INTEGER :: neq, nsrc, nsweep, it, i, j
+INTEGER :: xsbc0, xebc0, ysbc0, yebc0, zsbc0, zebc0
+LOGICAL :: done
+REAL(kind=dp) :: bnorm, rnorm, res, tmp, df, dfmx
+REAL(kind=dp), DIMENSION(:), ALLOCATABLE :: b, x, r, v, sg
+REAL(kind=dp), DIMENSION(:,:), ALLOCATABLE :: vk
+REAL(kind=dp), DIMENSION(gmres_restart+1,gmres_restart) :: h
+REAL(kind=dp), DIMENSION(gmres_restart+1) :: gv
+REAL(kind=dp), DIMENSION(gmres_restart) :: cs, sn, y
+
+! Initialize the old time point
+told = ttosolve
+
+IF (solver == "AHOTN" .and. (solvertype == "LN" .or. solvertype == "LL")) THEN
+   neq = SIZE(e_ahot_l)
+ELSE
+   neq = SIZE(e)
+END IF
+ALLOCATE(b(neq), x(neq), r(neq), v(neq), vk(neq,gmres_restart+1))
+
+WRITE (8,*) " GMRES iterative solution ..."
+WRITE (8,'(2X,A)') "Error based on the residual relative to the first sweep"
+
+! The right hand side is the sweep of the external source and inflow
+x = 0.0
+CALL sweep_group(x, b)
+nsweep = 1
+bnorm = SQRT(DOT_PRODUCT(b,b))
+
+! Sweep the scattering source alone from here on: no external source, and
+! vacuum in place of the fixed inflow. SCTSTEP takes its reflected inflow
+! from arrays that the sweep does not update, so it is fixed inflow too.
+xsbc0 = xsbc; xebc0 = xebc; ysbc0 = ysbc; yebc0 = yebc; zsbc0 = zsbc; zebc0 = zebc
+IF (xsbc == 2 .or. (solver == "SCTSTEP" .and. xsbc == 1)) xsbc = 0
+IF (xebc == 2 .or. (solver == "SCTSTEP" .and. xebc == 1)) xebc = 0
+IF (ysbc == 2 .or. (solver == "SCTSTEP" .and. ysbc == 1)) ysbc = 0
+IF (yebc == 2 .or. (solver == "SCTSTEP" .and. yebc == 1)) yebc = 0
+IF (zsbc == 2 .or. (solver == "SCTSTEP" .and. zsbc == 1)) zsbc = 0
+IF (zebc == 2 .or. (solver == "SCTSTEP" .and. zebc == 1)) zebc = 0
+CALL swap_source(.TRUE.)
+
+r = b
+rnorm = bnorm
+res = 0.0
+IF (bnorm > 0.0) res = 1.0
+done = res < convergence_criterion .or. nsweep >= itmx-1
+it = 0
+DO WHILE (.not. done)
+   ! Arnoldi process from the residual, giving the least squares problem
+   ! min |gv - h y| after the Givens rotations
+   vk(:,1) = r/rnorm
+   gv = 0.0
+   gv(1) = rnorm
+   DO j = 1, gmres_restart
+      CALL apply_operator(vk(:,j), v)
+      nsweep = nsweep + 1
+      DO i = 1, j
+         h(i,j) = DOT_PRODUCT(v, vk(:,i))
+         v = v - h(i,j)*vk(:,i)
+      END DO
+      h(j+1,j) = SQRT(DOT_PRODUCT(v,v))
+      IF (h(j+1,j) > 0.0) vk(:,j+1) = v/h(j+1,j)
+
+      ! Apply the previous rotations to the new column, then zero h(j+1,j)
+      DO i = 1, j-1
+         tmp = cs(i)*h(i,j) + sn(i)*h(i+1,j)
+         h(i+1,j) = -sn(i)*h(i,j) + cs(i)*h(i+1,j)
+         h(i,j) = tmp
+      END DO
+      tmp = SQRT(h(j,j)**2 + h(j+1,j)**2)
+      cs(j) = h(j,j)/tmp
+      sn(j) = h(j+1,j)/tmp
+      h(j,j) = tmp
+      h(j+1,j) = 0.0
+      gv(j+1) = -sn(j)*gv(j)
+      gv(j) = cs(j)*gv(j)
+      it = j
+
+      res = ABS(gv(j+1))/bnorm
+      CALL CPU_time(titer)
+      done = res < convergence_criterion .or. nsweep >= itmx-1
+      IF (.not. done) THEN
+         WRITE(8,11105) g, nsweep, res, titer-told
+         told = titer
+      END IF
+      IF (done) EXIT
+   END DO
+
+   ! Update the solution by the least squares solution
+   DO i = it, 1, -1
+      tmp = gv(i)
+      DO j = i+1, it
+         tmp = tmp - h(i,j)*y(j)
+      END DO
+      y(i) = tmp/h(i,i)
+   END DO
+   DO i = 1, it
+      x = x + y(i)*vk(:,i)
+   END DO
+
+   ! Restart from the true residual
+   IF (.not. done) THEN
+      CALL apply_operator(x, v)
+      nsweep = nsweep + 1
+      r = b - v
+      rnorm = SQRT(DOT_PRODUCT(r,r))
+      res = rnorm/bnorm
+      done = res < convergence_criterion .or. nsweep >= itmx-1
+   END IF
+END DO
+
+! Sweep the converged iterate with the sources and inflow back in
+CALL swap_source(.FALSE.)
+xsbc = xsbc0; xebc = xebc0; ysbc = ysbc0; yebc = yebc0; zsbc = zsbc0; zebc = zebc0
+CALL sweep_group(x, v)
+nsweep = nsweep + 1
+nits(g) = nsweep
+
+! The pointwise change of the last sweep, as source iteration reports it
+dfmx = 0.0
+DO i = 1, neq
+   IF (x(i) >= converge_tolerence) THEN
+      df = ABS((v(i) - x(i))/x(i))
+   ELSE
+      df = ABS(v(i) - x(i))
+   END IF
+   dfmx = MAX(dfmx, df)
+END DO
+
+CALL CPU_time(titer)
+IF (res < convergence_criterion) THEN
+   WRITE (8,*)
+   WRITE (8,*) " Group ", g, " converged in ", nsweep, " sweeps"
+   WRITE (8,'(2X,A,ES11.3,A,ES11.3)') "Relative residual: ", res, " < ", convergence_criterion
+   WRITE (8,'(2X,A,ES11.3)') "Maximum pointwise change of the last sweep: ", dfmx
+   WRITE (8,'(2X,A,F9.3,A)') "Final iteration time ", titer-told, " seconds"
+   cnvf(g) = 1
+ELSE
+   WRITE (8,*)
+   WRITE (8,*) "  Group ", g, " did not converge in maximum number of iterations ", itmx
+   WRITE (8,'(2X,A,ES11.3,A,ES11.3)') "Relative residual = ", res, " > ", convergence_criterion
+   WRITE (8,'(2X,A,ES11.3)') "Maximum pointwise change of the last sweep: ", dfmx
+   cnvf(g) = 0
+END IF
+
+DEALLOCATE(b, x, r, v, vk)
+
+!GMRES formatting
+11105 FORMAT(2X,'Gr',I3,' It ',I5,' Res ',ES11.3, '  Time(s) ', F9.3)
+
+RETURN
+
+CONTAINS
+
+SUBROUTINE sweep_group(xin, xout)
+!-------------------------------------------------------------
+!
+!  Sweeps the mesh with the scattering source of the flux
+!   moments xin, giving the new flux moments xout
+!
+!-------------------------------------------------------------
+REAL(kind=dp), DIMENSION(neq), INTENT(IN) :: xin
+REAL(kind=dp), DIMENSION(neq), INTENT(OUT) :: xout
+
+IF (solver == "AHOTN") THEN
+   IF (solvertype == "LN" .or. solvertype == "LL") THEN
+      e_ahot_l = RESHAPE(xin, SHAPE(e_ahot_l))
+      CALL sweep_ahotn_l(g)
+      xout = RESHAPE(f_ahot_l(:,:,:,:,g), (/neq/))
+   ELSE IF (solvertype == "NEFD") THEN
+      e = RESHAPE(xin, SHAPE(e))
+      CALL sweep_ahotn_nefd(g)
+      xout = RESHAPE(f(:,:,:,:,:,:,g), (/neq/))
+   END IF
+ELSE IF (solver == "DGFEM") THEN
+   e = RESHAPE(xin, SHAPE(e))
+   CALL sweep_dgfem(g)
+   xout = RESHAPE(f(:,:,:,:,g,:,:), (/neq/))
+ELSE IF (solver == "SCTSTEP") THEN
+   e = RESHAPE(xin, SHAPE(e))
+   CALL sweep_sct_step(g)
+   xout = RESHAPE(f(:,:,:,g,:,:,:), (/neq/))
+END IF
+
+END SUBROUTINE sweep_group
+
+SUBROUTINE apply_operator(xin, xout)
+!-------------------------------------------------------------
+!
+!  Applies I - A to xin
+!
+!-------------------------------------------------------------
+REAL(kind=dp), DIMENSION(neq), INTENT(IN) :: xin
+REAL(kind=dp), DIMENSION(neq), INTENT(OUT) :: xout
+
+CALL sweep_group(xin, xout)
+xout = xin - xout
+
+END SUBROUTINE apply_operator
+
+SUBROUTINE swap_source(save_it)
+!-------------------------------------------------------------
+!
+!  Zeroes the external source of the group, keeping it in sg, or
+!   puts it back
+!
+!-------------------------------------------------------------
+LOGICAL, INTENT(IN) :: save_it
+
+IF (save_it) THEN
+   IF (solver == "AHOTN") THEN
+      nsrc = SIZE(s(:,:,:,:,:,:,g))
+      ALLOCATE(sg(nsrc))
+      sg = RESHAPE(s(:,:,:,:,:,:,g), (/nsrc/))
+      s(:,:,:,:,:,:,g) = 0.0
+   ELSE IF (solver == "DGFEM") THEN
+      nsrc = SIZE(s(:,:,:,:,g,:,:))
+      ALLOCATE(sg(nsrc))
+      sg = RESHAPE(s(:,:,:,:,g,:,:), (/nsrc/))
+      s(:,:,:,:,g,:,:) = 0.0
+   ELSE IF (solver == "SCTSTEP") THEN
+      nsrc = SIZE(s(:,:,:,g,:,:,:))
+      ALLOCATE(sg(nsrc))
+      sg = RESHAPE(s(:,:,:,g,:,:,:), (/nsrc/))
+      s(:,:,:,g,:,:,:) = 0.0
+   END IF
+ELSE
+   IF (solver == "AHOTN") THEN
+      s(:,:,:,:,:,:,g) = RESHAPE(sg, SHAPE(s(:,:,:,:,:,:,g)))
+   ELSE IF (solver == "DGFEM") THEN
+      s(:,:,:,:,g,:,:) = RESHAPE(sg, SHAPE(s(:,:,:,:,g,:,:)))
+   ELSE IF (solver == "SCTSTEP") THEN
+      s(:,:,:,g,:,:,:) = RESHAPE(sg, SHAPE(s(:,:,:,g,:,:,:)))
+   END IF
+   DEALLOCATE(sg)
+END IF
+
+END SUBROUTINE swap_source
+
+END SUBROUTINE inner_gmres
@@ -23,6 +23,8 @@ INTEGER :: xsbc, xebc, ysbc, yebc, zsbc, zebc
 ! Iteration Controls
 real(kind=dp) :: convergence_criterion, converge_tolerence
 INTEGER :: itmx, moments_converged
+! Inner iteration solver, "SI" (source iteration) or "GMRES"
+CHARACTER(30) :: inner_solver
 
 ! Extra variables derived from input
 INTEGER :: apo, dofpc, order, ordsq, ordcb, orpc
@@ -39,6 +39,7 @@
 !> @param moment_sum_flag_in
 !> @param mom_at_a_pt_flag_in
 !> @param quad_flux_print_flag_in
+!> @param inner_solver_in inner iteration solver, "SI" (source iteration) or "GMRES"
 
 !OUTPUT NOT PARAM
 !> @param fluxout: ouput array of final solution
@@ -46,6 +47,7 @@
 !> @param tsolve_out: system time when solver began
 !> @param ttosolve_out: system time when solver terminated
 !> @param tend_out: solver runtime
+!> @param iterations_out: number of sweeps of the inner iterations of each group
 
 SUBROUTINE main(qdfile, xsfile, srcfile, mtfile,inflow_file,phi_file, titlein,&
  solver_in, solver_type_in, spatial_order_in,&
@@ -57,8 +59,8 @@ SUBROUTINE main(qdfile, xsfile, srcfile, mtfile,inflow_file,phi_file, titlein,&
  source_input_file_in, bc_input_filein, flux_output_filein, &
  convergence_criterion_in, itmxin, moments_converged_in, converge_tolerence_in, &
  max_mom_printed_in, moment_sum_flag_in,&
- mom_at_a_pt_flag_in, quad_flux_print_flag_in,fluxout,error_code_out,&
- tsolve_out, ttosolve_out, tend_out) 
+ mom_at_a_pt_flag_in, quad_flux_print_flag_in, inner_solver_in, fluxout,&
+ error_code_out, tsolve_out, ttosolve_out, tend_out, iterations_out) 
 
 !-------------------------------------------------------------
 !
@@ -132,16 +134,19 @@ INTEGER, INTENT(IN) :: itmxin, moments_converged_in
 ! Editing data
 INTEGER, INTENT(IN) :: max_mom_printed_in, moment_sum_flag_in, mom_at_a_pt_flag_in,&
  quad_flux_print_flag_in
+CHARACTER(30), INTENT(IN) :: inner_solver_in
 
 REAL*8, INTENT(OUT), DIMENSION(nodes_x_in,num_groups_in*nodes_y_in,num_groups_in*nodes_z_in) :: fluxout
 ! Works for all solvers!
 
 INTEGER, INTENT(OUT) :: error_code_out
 REAL*8, INTENT(OUT) :: tsolve_out, ttosolve_out, tend_out
+INTEGER, INTENT(OUT), DIMENSION(num_groups_in) :: iterations_out
 
 ! Set error codes to 0 initmoments_convergedy
 error_code = 0
 error_code_out = error_code
+iterations_out = 0
 
 ! Set all of the input values
 title = titlein
@@ -171,6 +176,7 @@ convergence_criterion = convergence_criterion_in
 converge_tolerence = converge_tolerence_in
 itmx = itmxin
 moments_converged = moments_converged_in
+inner_solver = inner_solver_in
 momp = max_mom_printed_in
 momsum = moment_sum_flag_in
 mompt = mom_at_a_pt_flag_in
@@ -311,6 +317,7 @@ WRITE(8,*) "Solver type: ", solvertype
 CALL solve
 CALL output
 fluxout = flux_out
+iterations_out = nits
 
 ! Time the end of the job
 CALL CPU_TIME(tend)
@@ -349,6 +356,7 @@ IF( allocated(e)) deallocate(e)
 IF( allocated(f_ahot_l)) deallocate(f_ahot_l)
 IF( allocated(e_ahot_l)) deallocate(e_ahot_l)
 IF( allocated(cnvf)) deallocate(cnvf)
+IF( allocated(nits)) deallocate(nits)
 IF( allocated(amat)) deallocate(amat)
 IF( allocated(bmat)) deallocate(bmat)
 IF( allocated(gmat)) deallocate(gmat)
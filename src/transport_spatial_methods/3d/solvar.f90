@@ -19,6 +19,9 @@ real(kind=dp), DIMENSION(:,:,:),ALLOCATABLE :: flux_out
 ! Convergence flag
 INTEGER, DIMENSION(:), ALLOCATABLE :: cnvf
 
+! Number of sweeps of the inner iterations
+INTEGER, DIMENSION(:), ALLOCATABLE :: nits
+
 ! Number of warnings
 INTEGER :: warn
 
@@ -21,7 +21,8 @@ REAL(kind=dp) :: xsct
 
 ! Intitialize warn to indicate where warnings may occur
 warn = 0
-ALLOCATE(cnvf(ng))
+ALLOCATE(cnvf(ng), nits(ng))
+nits = 0
 
 ! Mark the beginning of the solution phase
 WRITE (8,*)
@@ -3,6 +3,12 @@
 extern "C" double endftod_(char *str, int len);
 #endif
 #include <iomanip>
+#include <fstream>
+#if !defined __WIN_MSVC__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
 
 #ifndef PYNE_IS_AMALGAMATED
 #include "utils.h"
@@ -150,6 +156,121 @@ void pyne::use_fast_endftod() {
   pyne::endftod = &pyne::endftod_cpp;
 }
 
+namespace {
+
+// powers of ten that are exact as doubles
+const double endf_pow10[23] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13,
+  1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+// Returns mant * 10**e correctly rounded. Within the exact powers a single
+// multiplication or division is exact up to its rounding, as mant has at most
+// eleven digits; rarer exponents go through strtod().
+inline double endf_scale(double mant, int e) {
+  if (e >= -22 && e <= 22)
+    return e < 0 ? mant / endf_pow10[-e] : mant * endf_pow10[e];
+  char buf[32];
+  long long m = (long long) mant;
+  int ae = e < 0 ? -e : e;
+  int n = 31;
+  buf[n] = '\0';
+  do {
+    buf[--n] = '0' + ae % 10;
+    ae /= 10;
+  } while (ae > 0);
+  buf[--n] = e < 0 ? '-' : '+';
+  buf[--n] = 'e';
+  do {
+    buf[--n] = '0' + m % 10;
+    m /= 10;
+  } while (m > 0);
+  return strtod(buf + n, NULL);
+}
+
+inline bool endf_is_sign(char c) {
+  return (c == '+') | (c == '-');
+}
+
+// Converts the usual "sd.dddddd+e", "sd.ddddd+ee" and "sd.dddd+eee" fields,
+// with the point in column 2 and the exponent sign in column 9, 8 or 7.
+// Returns false for any other field.
+inline bool endf_field_fixed(const char * s, double & v) {
+  const unsigned long long zeros = 0x3030303030303030ULL;
+  const unsigned long long high = 0xF0F0F0F0F0F0F0F0ULL;
+  int s9 = endf_is_sign(s[9]);
+  int s8 = endf_is_sign(s[8]) & (s9 ^ 1);
+  int s7 = endf_is_sign(s[7]) & ((s9 | s8) ^ 1);
+  int ndigits = 7*s9 + 6*s8 + 5*s7;
+  int lead = (s[0] == ' ') | endf_is_sign(s[0]);
+  if (!(lead & (s[2] == '.') & (ndigits > 0)))
+    return false;
+
+  // The mantissa digits s[1], s[3], ... as the bytes of a word, first digit
+  // in the lowest byte, shifted up and padded with '0' to eight digits.
+  unsigned long long w;
+  memcpy(&w, s + 2, 8);
+  w = (w & ~0xFFULL) | (unsigned char) s[1];
+  int shift = 8 * (8 - ndigits);
+  w = (w << shift) | (zeros >> (64 - shift));
+  if (((w & high) | ((w + 0x0606060606060606ULL) & high)) != zeros)
+    return false;
+  // combine pairs, quads and octets of digits
+  w &= 0x0F0F0F0F0F0F0F0FULL;
+  w = (w * 10 + (w >> 8)) & 0x00FF00FF00FF00FFULL;
+  w = (w * 100 + (w >> 16)) & 0x0000FFFF0000FFFFULL;
+  w = (w * 10000 + (w >> 32)) & 0xFFFFFFFFULL;
+
+  unsigned d8 = (unsigned char) s[8] - '0';
+  unsigned d9 = (unsigned char) s[9] - '0';
+  unsigned d10 = (unsigned char) s[10] - '0';
+  if (!((d10 < 10) & ((d9 < 10) | s9) & ((d8 < 10) | s9 | s8)))
+    return false;
+  int ex = d10 + (s9 ? 0 : 10*d9) + (s7 ? 100*d8 : 0);
+  int e = (s[ndigits + 2] == '-' ? -ex : ex) - (ndigits - 1);
+  v = endf_scale((double) w, e);
+  if (s[0] == '-')
+    v = -v;
+  return true;
+}
+
+// Converts any E11.0 field: integers, blanks, an explicit E or D and a signed
+// exponent without one. Each character only updates the state through
+// selects, so there are no branches on the characters.
+inline double endf_field_any(const char * s) {
+  double mant = 0.0;
+  int mant_neg = 0, exp_neg = 0, ex = 0, frac = 0;
+  int in_exp = 0, seen_mant = 0, seen_dot = 0;
+  for (int i = 0; i < 11; i++) {
+    unsigned char c = s[i];
+    unsigned d = c - '0';
+    int is_digit = d < 10;
+    int is_minus = c == '-';
+    int lower = c | 0x20;
+    in_exp |= (endf_is_sign(c) & seen_mant) | (lower == 'e') | (lower == 'd');
+    exp_neg |= is_minus & in_exp;
+    mant_neg |= is_minus & (in_exp ^ 1);
+    int mant_digit = is_digit & (in_exp ^ 1);
+    int exp_digit = is_digit & in_exp & (ex < 10000);
+    mant = mant_digit ? mant * 10.0 + (double) d : mant;
+    ex = exp_digit ? ex * 10 + (int) d : ex;
+    frac += mant_digit & seen_dot;
+    seen_dot |= c == '.';
+    seen_mant |= mant_digit | (c == '.');
+  }
+  double v = endf_scale(mant, (exp_neg ? -ex : ex) - frac);
+  return mant_neg ? -v : v;
+}
+
+}  // namespace
+
+void pyne::endftod_record(const char * s, double * vals) {
+  for (int i = 0; i < 6; i++) {
+    const char * field = s + 11*i;
+    if (!endf_field_fixed(field, vals[i]))
+      vals[i] = endf_field_any(field);
+  }
+}
+
 std::string pyne::to_upper(std::string s) {
   // change each element of the string to upper case.
   for(unsigned int i = 0; i < s.length(); i++)
@@ -394,6 +515,42 @@ bool pyne::file_exists(std::string strfilename) {
   return(blnReturn);
 }
 
+pyne::MappedFile::MappedFile(std::string filename) : ptr(NULL), len(0) {
+#if !defined __WIN_MSVC__
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw FileNotFound(filename);
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    len = st.st_size;
+    void* addr = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, 0);
+    if (addr != MAP_FAILED)
+      ptr = static_cast<const char*>(addr);
+  }
+  close(fd);
+  if (ptr != NULL || len == 0)
+    return;
+#endif
+  // fall back to reading the whole file
+  std::ifstream f(filename.c_str(), std::ios::binary);
+  if (!f)
+    throw FileNotFound(filename);
+  f.seekg(0, std::ios::end);
+  len = f.tellg();
+  f.seekg(0, std::ios::beg);
+  buf.resize(len);
+  if (len > 0)
+    f.read(&buf[0], len);
+  ptr = buf.empty() ? NULL : &buf[0];
+}
+
+pyne::MappedFile::~MappedFile() {
+#if !defined __WIN_MSVC__
+  if (ptr != NULL && buf.empty())
+    munmap(const_cast<char*>(ptr), len);
+#endif
+}
+
 // Message Helpers
 
 bool pyne::USE_WARNINGS = true;
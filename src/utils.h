@@ -80,6 +80,14 @@ namespace pyne {
 
   void use_fast_endftod();/// switches endftod to fast cpp version
 
+  /// Converts the six 11-character fields of an ENDF record, the first 66
+  /// columns of \a s, to floats in \a vals. Every field in the "E11.0"
+  /// format of the Fortran endftod is handled, with or without the E, as well
+  /// as integers and blank fields, which are zero. The usual fixed layouts
+  /// are converted as whole words and the rest without branches on the
+  /// characters, and the results are correctly rounded.
+  void endftod_record(const char * s, double * vals);
+
   /// Returns an all upper case copy of the string.
   std::string to_upper(std::string s);
 
@@ -93,6 +101,29 @@ namespace pyne {
   std::ostringstream comment_line_wrapping(std::string line, std::string comment_prefix = "",
                                            int line_length = 79);
 
+  /// Resets the format flags, precision, and fill of a stream to their
+  /// defaults and puts the old ones back when it goes out of scope, so that
+  /// card writers give the same text on any stream and leave its format be.
+  class StreamFormatSaver {
+  public:
+    StreamFormatSaver(std::ostream& os) : os_(os), flags_(os.flags()),
+        precision_(os.precision()), fill_(os.fill()) {
+      os.flags(std::ios::dec | std::ios::skipws);
+      os.precision(6);
+      os.fill(' ');
+    };
+    ~StreamFormatSaver() {
+      os_.flags(flags_);
+      os_.precision(precision_);
+      os_.fill(fill_);
+    };
+  private:
+    std::ostream& os_;
+    std::ios::fmtflags flags_;
+    std::streamsize precision_;
+    char fill_;
+  };
+
   /// Finds and returns the first white-space delimited token of a line.
   /// \param line a character array to take the first token from.
   /// \param max_l an upper bound to the length of the token.  Must be 11 or less.
@@ -148,6 +179,26 @@ namespace pyne {
   /// Returns true if the file can be found.
   bool file_exists(std::string strfilename);
 
+  /// Read-only memory mapping of a whole file. Mappings of the same file by
+  /// several processes share their physical pages through the page cache.
+  /// Where mapping is not available the file is read into memory instead.
+  class MappedFile {
+  public:
+    /// Maps the file \a filename, throws FileNotFound if it can't be opened.
+    MappedFile(std::string filename);
+    ~MappedFile();
+    /// Returns the start of the file contents.
+    const char* data() const {return ptr;};
+    /// Returns the size of the file in bytes.
+    size_t size() const {return len;};
+  private:
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+    const char* ptr; ///< Start of the mapped contents
+    size_t len; ///< Size in bytes
+    std::vector<char> buf; ///< Contents when the file could not be mapped
+  };
+
   // Message Helpers
   extern bool USE_WARNINGS;
   /// Toggles warnings on and off
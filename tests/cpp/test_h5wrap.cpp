@@ -0,0 +1,240 @@
+// Tests of the HDF5 readers in h5wrap.h: dense arrays, full and column
+// subset DenseTypeTables, chunked loads into the table buffer, and
+// HomogenousTypeTable. Writes h5wrap_test.h5 in the working directory and
+// exits nonzero on the first failure.
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "h5wrap.h"
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      failures++; \
+    } \
+  } while (0)
+
+const char* FILENAME = "h5wrap_test.h5";
+const int NROWS = 10;
+
+struct Row {
+  double a;
+  double b;
+  double c;
+};
+
+double value(int i, int j, int k=0) {return 100.0*i + 10.0*j + k;}
+
+void write_file() {
+  hid_t f = H5Fcreate(FILENAME, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+
+  // a compound table with the columns a, b and c
+  std::vector<Row> rows(NROWS);
+  for (int i = 0; i < NROWS; i++) {
+    rows[i].a = value(i, 0);
+    rows[i].b = value(i, 1);
+    rows[i].c = value(i, 2);
+  }
+  hid_t row_type = H5Tcreate(H5T_COMPOUND, sizeof(Row));
+  H5Tinsert(row_type, "a", HOFFSET(Row, a), H5T_NATIVE_DOUBLE);
+  H5Tinsert(row_type, "b", HOFFSET(Row, b), H5T_NATIVE_DOUBLE);
+  H5Tinsert(row_type, "c", HOFFSET(Row, c), H5T_NATIVE_DOUBLE);
+  hsize_t nrows[1] = {NROWS};
+  hid_t space = H5Screate_simple(1, nrows, NULL);
+  hid_t set = H5Dcreate2(f, "/table", row_type, space, H5P_DEFAULT,
+                         H5P_DEFAULT, H5P_DEFAULT);
+  H5Dwrite(set, row_type, H5S_ALL, H5S_ALL, H5P_DEFAULT, &rows[0]);
+  H5Dclose(set);
+  H5Sclose(space);
+  H5Tclose(row_type);
+
+  // 4 x 3 and 2 x 3 x 4 arrays
+  std::vector<double> arr2;
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 3; j++)
+      arr2.push_back(value(i, j));
+  hsize_t dims2[2] = {4, 3};
+  space = H5Screate_simple(2, dims2, NULL);
+  set = H5Dcreate2(f, "/arr2", H5T_NATIVE_DOUBLE, space, H5P_DEFAULT,
+                   H5P_DEFAULT, H5P_DEFAULT);
+  H5Dwrite(set, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &arr2[0]);
+  H5Dclose(set);
+  H5Sclose(space);
+
+  std::vector<double> arr3;
+  for (int i = 0; i < 2; i++)
+    for (int j = 0; j < 3; j++)
+      for (int k = 0; k < 4; k++)
+        arr3.push_back(value(i, j, k));
+  hsize_t dims3[3] = {2, 3, 4};
+  space = H5Screate_simple(3, dims3, NULL);
+  set = H5Dcreate2(f, "/arr3", H5T_NATIVE_DOUBLE, space, H5P_DEFAULT,
+                   H5P_DEFAULT, H5P_DEFAULT);
+  H5Dwrite(set, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &arr3[0]);
+  H5Dclose(set);
+  H5Sclose(space);
+
+  H5Fclose(f);
+}
+
+// Only the file itself should be open once a reader returns.
+void check_no_open_handles(hid_t f) {
+  CHECK(H5Fget_obj_count(f, H5F_OBJ_ALL) == 1);
+}
+
+void test_dense_arrays(hid_t f) {
+  h5wrap::DenseArray<double> arr = h5wrap::h5_array_to_dense<double>(f, "/arr2");
+  CHECK(arr.shape.size() == 2 && arr.shape[0] == 4 && arr.shape[1] == 3);
+  CHECK(arr.strides.size() == 2 && arr.strides[0] == 3 && arr.strides[1] == 1);
+  CHECK(arr.data.size() == 12);
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 3; j++)
+      CHECK(arr(i, j) == value(i, j));
+
+  // a window of rows through a hyperslab
+  arr = h5wrap::h5_array_to_dense<double>(f, "/arr2", H5T_NATIVE_DOUBLE, 1, 2);
+  CHECK(arr.shape[0] == 2 && arr.data.size() == 6);
+  CHECK(arr(0, 0) == value(1, 0) && arr(1, 2) == value(2, 2));
+  CHECK(*arr.ptr(1) == value(2, 0));
+
+  h5wrap::DenseArray<double> arr3 = h5wrap::h5_array_to_dense<double>(f, "/arr3");
+  CHECK(arr3.shape.size() == 3 && arr3.strides[0] == 12 && arr3.strides[1] == 4);
+  CHECK(arr3(1, 2, 3) == value(1, 2, 3));
+
+  std::vector<std::vector<double> > v2 =
+      h5wrap::h5_array_to_cpp_vector_2d<double>(f, "/arr2");
+  CHECK(v2.size() == 4 && v2[3].size() == 3 && v2[3][1] == value(3, 1));
+  std::vector<std::vector<std::vector<double> > > v3 =
+      h5wrap::h5_array_to_cpp_vector_3d<double>(f, "/arr3");
+  CHECK(v3.size() == 2 && v3[1].size() == 3 && v3[1][2].size() == 4);
+  CHECK(v3[1][0][2] == value(1, 0, 2));
+
+  bool thrown = false;
+  try {
+    h5wrap::h5_array_to_dense<double>(f, "/arr2", H5T_NATIVE_DOUBLE, 3, 2);
+  } catch (h5wrap::HDF5BoundsError& e) {
+    thrown = true;
+  }
+  CHECK(thrown);
+  check_no_open_handles(f);
+}
+
+void test_full_table(hid_t f) {
+  h5wrap::DenseTypeTable<double> table(f, "/table");
+  CHECK(table.num_rows == NROWS && table.num_loaded == NROWS);
+  CHECK(table.cols.size() == 3 && table.cols[0] == "a" && table.cols[2] == "c");
+  CHECK(table.values.size() == 3*NROWS);
+  for (int i = 0; i < NROWS; i++) {
+    CHECK(table.at(i, 0) == value(i, 0));
+    CHECK(table.row(i)["b"] == value(i, 1));
+    CHECK(table.row(i)[2] == value(i, 2));
+  }
+  std::vector<double> b = table.column("b");
+  CHECK(b.size() == NROWS && b[4] == value(4, 1));
+  check_no_open_handles(f);
+}
+
+void test_column_subset(hid_t f) {
+  std::vector<std::string> cols;
+  cols.push_back("c");
+  cols.push_back("a");
+  h5wrap::DenseTypeTable<double> table(f, "/table", H5T_NATIVE_DOUBLE, cols, 3);
+  CHECK(table.num_rows == NROWS && table.num_loaded == 3);
+  CHECK(table.cols == cols && table.values.size() == 6);
+  // the columns are packed in the order asked for
+  CHECK(table.at(0, 0) == value(0, 2) && table.at(0, 1) == value(0, 0));
+  CHECK(table.row(2)["a"] == value(2, 0));
+  CHECK(table.col_index("c") == 0);
+
+  bool thrown = false;
+  try {
+    table.col_index("b");
+  } catch (h5wrap::PathNotFound& e) {
+    thrown = true;
+  }
+  CHECK(thrown);
+  check_no_open_handles(f);
+}
+
+void test_chunked_loads(hid_t f) {
+  // iterating in chunks reuses the table buffer
+  h5wrap::DenseTypeTable<double> table(f, "/table", H5T_NATIVE_DOUBLE,
+                                       std::vector<std::string>(), 4);
+  CHECK(table.num_loaded == 4 && table.start == 0);
+  const double* buf = &table.values[0];
+  CHECK(table.load_next(4) == 4);
+  CHECK(table.start == 4 && table.at(0, 0) == value(4, 0));
+  CHECK(&table.values[0] == buf);
+  CHECK(table.load_next(4) == 2);
+  CHECK(table.start == 8 && table.at(1, 2) == value(9, 2));
+  CHECK(table.load_next(4) == 0 && table.num_loaded == 0);
+  CHECK(table.load(5, 1) == 1 && table.at(0, 1) == value(5, 1));
+
+  bool thrown = false;
+  try {
+    table.row(1);
+  } catch (h5wrap::HDF5BoundsError& e) {
+    thrown = true;
+  }
+  CHECK(thrown);
+  check_no_open_handles(f);
+}
+
+void test_missing(hid_t f) {
+  std::vector<std::string> cols;
+  cols.push_back("a");
+  cols.push_back("not_a_column");
+  bool thrown = false;
+  try {
+    h5wrap::DenseTypeTable<double> table(f, "/table", H5T_NATIVE_DOUBLE, cols);
+  } catch (h5wrap::PathNotFound& e) {
+    thrown = true;
+  }
+  CHECK(thrown);
+
+  thrown = false;
+  try {
+    h5wrap::DenseTypeTable<double> table(f, "/not_a_table");
+  } catch (h5wrap::PathNotFound& e) {
+    thrown = true;
+  }
+  CHECK(thrown);
+  check_no_open_handles(f);
+}
+
+void test_homogenous_table(hid_t f) {
+  h5wrap::HomogenousTypeTable<double> table(f, "/table");
+  CHECK(table.shape[0] == NROWS && table.shape[1] == 3);
+  CHECK(table.cols.size() == 3 && table.cols[1] == "b");
+  CHECK(table["c"].size() == NROWS && table["c"][7] == value(7, 2));
+  std::map<std::string, double> row = table[3];
+  CHECK(row["a"] == value(3, 0) && row["b"] == value(3, 1));
+  check_no_open_handles(f);
+}
+
+}  // namespace
+
+int main() {
+  H5Eset_auto2(H5E_DEFAULT, NULL, NULL);
+  write_file();
+  hid_t f = H5Fopen(FILENAME, H5F_ACC_RDONLY, H5P_DEFAULT);
+  test_dense_arrays(f);
+  test_full_table(f);
+  test_column_subset(f);
+  test_chunked_loads(f);
+  test_missing(f);
+  test_homogenous_table(f);
+  H5Fclose(f);
+  std::remove(FILENAME);
+  if (failures == 0)
+    std::printf("all h5wrap tests passed\n");
+  return failures == 0 ? 0 : 1;
+}
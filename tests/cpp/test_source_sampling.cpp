@@ -0,0 +1,679 @@
+// Tests of the mesh source Sampler: batched particle births against per call
+// births on tet and hex meshes in every mode, including a partial final
+// block, per-thread sampling contexts and the thread-indexed Fortran API
+// against serial sampling, the placement of points in volume elements
+// against the original edge vector formulas, and a state shared by threads
+// through read_shared_state past a stale lock file. Writes the meshes it
+// samples in the working directory and exits nonzero if any check fails.
+//
+// The alias table tests check the distributions that the single precision
+// CompactAliasTable and the rows of a MeshAliasTable sample, and sample a
+// MeshAliasTable of more than 2^32 entries, which is held in sparse mappings
+// of which only the sampled pages are touched.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined __WIN_MSVC__
+#include <sys/mman.h>
+#endif
+
+#include "moab/Core.hpp"
+#include "source_sampling.h"
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+      failures++; \
+    } \
+  } while (0)
+
+const char* HEX_MESH = "sampling_hex.h5m";
+const char* TET_MESH = "sampling_tet.h5m";
+const char* ALIAS_TABLE_FILE = "sampling_hex_alias.h5";
+const int NUM_GROUPS = 2;
+const int MAX_NUM_CELLS = 2;
+const int NUM_THREADS = 4;
+
+bool close(double a, double b) {
+  return std::fabs(a - b) <= 1e-12*(1.0 + std::fabs(b));
+}
+
+std::vector<double> random_numbers(size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  std::vector<double> rands(n);
+  for (size_t i = 0; i < n; i++)
+    rands[i] = dist(gen);
+  return rands;
+}
+
+moab::Tag double_tag(moab::Core& mesh, const char* name, int size) {
+  moab::Tag tag;
+  mesh.tag_get_handle(name, size, moab::MB_TYPE_DOUBLE, tag,
+                      moab::MB_TAG_DENSE | moab::MB_TAG_CREAT);
+  return tag;
+}
+
+// Writes a 3 x 2 x 1 grid of hexes of uneven widths. The hexes carry a two
+// group source "src", the same split over their cells "src_sv" for sub-voxel
+// modes, a two group bias "bias", and the cell_number and cell_fracs tags of
+// one or two cells per hex. "src" and "bias" are also written under the tag
+// names the Fortran API reads.
+void write_hex_mesh(const char* filename) {
+  const double xs[4] = {0.0, 1.0, 2.5, 3.0};
+  const double ys[3] = {0.0, 1.0, 2.0};
+  const double zs[2] = {0.0, 2.0};
+  moab::Core mesh;
+  moab::EntityHandle verts[2][3][4];
+  for (int k = 0; k < 2; k++)
+    for (int j = 0; j < 3; j++)
+      for (int i = 0; i < 4; i++) {
+        double c[3] = {xs[i], ys[j], zs[k]};
+        mesh.create_vertex(c, verts[k][j][i]);
+      }
+  std::vector<moab::EntityHandle> hexes;
+  for (int j = 0; j < 2; j++)
+    for (int i = 0; i < 3; i++) {
+      moab::EntityHandle conn[8] = {
+          verts[0][j][i], verts[0][j][i + 1], verts[0][j + 1][i + 1],
+          verts[0][j + 1][i], verts[1][j][i], verts[1][j][i + 1],
+          verts[1][j + 1][i + 1], verts[1][j + 1][i]};
+      moab::EntityHandle hex;
+      mesh.create_element(moab::MBHEX, conn, 8, hex);
+      hexes.push_back(hex);
+    }
+
+  int n = hexes.size();
+  std::vector<double> src, src_sv, bias, fracs;
+  std::vector<int> numbers;
+  for (int v = 0; v < n; v++) {
+    // every other hex lies in a single cell
+    bool split = v % 2 == 0;
+    double f[MAX_NUM_CELLS] = {split ? 0.75 : 1.0, split ? 0.25 : 0.0};
+    for (int c = 0; c < MAX_NUM_CELLS; c++) {
+      numbers.push_back((f[c] > 0.0) ? 10*(c + 1) + v : -1);
+      fracs.push_back(f[c]);
+    }
+    for (int g = 0; g < NUM_GROUPS; g++) {
+      src.push_back(1.0 + v + 2.0*g);
+      bias.push_back(1.0 + (v + g) % 3);
+    }
+    for (int c = 0; c < MAX_NUM_CELLS; c++)
+      for (int g = 0; g < NUM_GROUPS; g++)
+        src_sv.push_back((f[c] > 0.0) ? 1.0 + v + 2.0*g + c : 0.0);
+  }
+  mesh.tag_set_data(double_tag(mesh, "src", NUM_GROUPS), &hexes[0], n,
+                    &src[0]);
+  mesh.tag_set_data(double_tag(mesh, "src_sv", MAX_NUM_CELLS*NUM_GROUPS),
+                    &hexes[0], n, &src_sv[0]);
+  mesh.tag_set_data(double_tag(mesh, "bias", NUM_GROUPS), &hexes[0], n,
+                    &bias[0]);
+  mesh.tag_set_data(double_tag(mesh, "source_density", NUM_GROUPS), &hexes[0],
+                    n, &src[0]);
+  mesh.tag_set_data(double_tag(mesh, "biased_source_density", NUM_GROUPS),
+                    &hexes[0], n, &bias[0]);
+  mesh.tag_set_data(double_tag(mesh, "cell_fracs", MAX_NUM_CELLS), &hexes[0],
+                    n, &fracs[0]);
+  moab::Tag number_tag;
+  mesh.tag_get_handle("cell_number", MAX_NUM_CELLS, moab::MB_TYPE_INTEGER,
+                      number_tag, moab::MB_TAG_DENSE | moab::MB_TAG_CREAT);
+  mesh.tag_set_data(number_tag, &hexes[0], n, &numbers[0]);
+  mesh.write_file(filename);
+}
+
+// Writes two tets sharing a face, with a two group source "src".
+void write_tet_mesh() {
+  const double coords[5][3] = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0},
+                               {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0},
+                               {1.0, 1.0, 1.0}};
+  moab::Core mesh;
+  moab::EntityHandle verts[5];
+  for (int i = 0; i < 5; i++)
+    mesh.create_vertex(coords[i], verts[i]);
+  moab::EntityHandle tets[2];
+  moab::EntityHandle conn0[4] = {verts[0], verts[1], verts[2], verts[3]};
+  moab::EntityHandle conn1[4] = {verts[1], verts[2], verts[3], verts[4]};
+  mesh.create_element(moab::MBTET, conn0, 4, tets[0]);
+  mesh.create_element(moab::MBTET, conn1, 4, tets[1]);
+  double src[2*NUM_GROUPS] = {1.0, 2.0, 4.0, 0.5};
+  mesh.tag_set_data(double_tag(mesh, "src", NUM_GROUPS), tets, 2, src);
+  mesh.write_file(TET_MESH);
+}
+
+std::vector<double> e_bounds() {
+  std::vector<double> bounds;
+  bounds.push_back(0.0);
+  bounds.push_back(0.5);
+  bounds.push_back(1.0);
+  return bounds;
+}
+
+std::map<std::string, std::string> hex_tag_names(int mode) {
+  std::map<std::string, std::string> tag_names;
+  tag_names["src_tag_name"] = (mode < 3) ? "src" : "src_sv";
+  tag_names["bias_tag_name"] = "bias";
+  tag_names["cell_number_tag_name"] = "cell_number";
+  tag_names["cell_fracs_tag_name"] = "cell_fracs";
+  return tag_names;
+}
+
+std::map<std::string, std::string> tet_tag_names() {
+  std::map<std::string, std::string> tag_names;
+  tag_names["src_tag_name"] = "src";
+  tag_names["bias_tag_name"] = "src";
+  return tag_names;
+}
+
+// Checks that particle_birth_batch gives n particles equal to those that
+// particle_birth gives one at a time for the same random numbers.
+void check_batch(const pyne::Sampler& sampler, size_t n, unsigned seed) {
+  int cell_list_size = sampler.get_cell_list_size();
+  std::vector<double> rands = random_numbers(6*n, seed);
+  std::vector<double> x(n), y(n), z(n), e(n), w(n);
+  std::vector<int> cells(n*cell_list_size + 1);
+  pyne::SourceParticleSoA out = {&x[0], &y[0], &z[0], &e[0], &w[0],
+                                 (cell_list_size > 0) ? &cells[0] : NULL};
+  sampler.particle_birth_batch(&rands[0], n, out);
+  for (size_t i = 0; i < n; i++) {
+    std::vector<double> r(rands.begin() + 6*i, rands.begin() + 6*i + 6);
+    pyne::SourceParticle p = sampler.particle_birth(r);
+    CHECK(close(p.get_x(), x[i]));
+    CHECK(close(p.get_y(), y[i]));
+    CHECK(close(p.get_z(), z[i]));
+    CHECK(p.get_e() == e[i]);
+    CHECK(p.get_w() == w[i]);
+    std::vector<int> cell_list = p.get_cell_list();
+    if (cell_list_size > 0) {
+      CHECK(cell_list.size() == cell_list_size);
+      for (int c = 0; c < cell_list_size && c < cell_list.size(); c++)
+        CHECK(cell_list[c] == cells[i*cell_list_size + c]);
+    }
+  }
+}
+
+// One particle, exactly one block, and two full blocks and a partial one.
+void check_batches(const pyne::Sampler& sampler) {
+  check_batch(sampler, 1, 1);
+  check_batch(sampler, 64, 2);
+  check_batch(sampler, 150, 3);
+}
+
+void test_hex_batches() {
+  for (int mode = 0; mode <= 5; mode++) {
+    pyne::Sampler sampler(HEX_MESH, hex_tag_names(mode), e_bounds(), mode);
+    CHECK(sampler.get_cell_list_size() == ((mode < 3) ? MAX_NUM_CELLS : 1));
+    check_batches(sampler);
+  }
+}
+
+void test_hex_blocked_batches() {
+  // analog and uniform modes read from an alias table file go through the
+  // two-level MeshAliasTable, built on the first pass and read on the second
+  for (int mode = 0; mode <= 4; mode++) {
+    if (mode == 2)
+      continue;
+    std::map<std::string, std::string> tag_names = hex_tag_names(mode);
+    tag_names["alias_table_file"] = ALIAS_TABLE_FILE;
+    for (int pass = 0; pass < 2; pass++) {
+      pyne::Sampler sampler(HEX_MESH, tag_names, e_bounds(), mode);
+      check_batches(sampler);
+    }
+    std::remove(ALIAS_TABLE_FILE);
+  }
+}
+
+void test_tet_batches() {
+  for (int mode = 0; mode <= 2; mode++) {
+    pyne::Sampler sampler(TET_MESH, tet_tag_names(), e_bounds(), mode);
+    CHECK(sampler.get_cell_list_size() == 0);
+    check_batches(sampler);
+  }
+}
+
+// Births of n particles from NUM_THREADS random number streams, five
+// doubles (x, y, z, e, w) and cell_list_size cells per particle.
+struct Births {
+  std::vector<std::vector<double> > rands;
+  std::vector<std::vector<double> > params;
+  std::vector<std::vector<int> > cells;
+
+  Births(size_t n, int cell_list_size)
+    : rands(NUM_THREADS), params(NUM_THREADS), cells(NUM_THREADS) {
+    for (int t = 0; t < NUM_THREADS; t++) {
+      rands[t] = random_numbers(6*n, 100 + t);
+      params[t].resize(5*n);
+      cells[t].resize(n*cell_list_size + 1);
+    }
+  };
+  double* param(int t, size_t i, int k) {return &params[t][5*i + k];};
+};
+
+// Checks what was born from each stream against serial sampling.
+void check_serial(const pyne::Sampler& sampler, Births& births, size_t n) {
+  int cell_list_size = sampler.get_cell_list_size();
+  for (int t = 0; t < NUM_THREADS; t++) {
+    for (size_t i = 0; i < n; i++) {
+      std::vector<double> r(births.rands[t].begin() + 6*i,
+                            births.rands[t].begin() + 6*i + 6);
+      pyne::SourceParticle p = sampler.particle_birth(r);
+      CHECK(p.get_x() == *births.param(t, i, 0));
+      CHECK(p.get_y() == *births.param(t, i, 1));
+      CHECK(p.get_z() == *births.param(t, i, 2));
+      CHECK(p.get_e() == *births.param(t, i, 3));
+      CHECK(p.get_w() == *births.param(t, i, 4));
+      std::vector<int> cell_list = p.get_cell_list();
+      for (int c = 0; c < cell_list_size && c < cell_list.size(); c++)
+        CHECK(cell_list[c] == births.cells[t][i*cell_list_size + c]);
+    }
+  }
+}
+
+void test_concurrent_contexts() {
+  const size_t n = 500;
+  for (int mode = 0; mode <= 5; mode++) {
+    pyne::Sampler sampler(HEX_MESH, hex_tag_names(mode), e_bounds(), mode);
+    int cell_list_size = sampler.get_cell_list_size();
+    Births births(n, cell_list_size);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; t++) {
+      threads.push_back(std::thread([&, t]() {
+        pyne::SamplingContext context(&sampler);
+        for (size_t i = 0; i < n; i++)
+          context.particle_birth(&births.rands[t][6*i], births.param(t, i, 0),
+                                 births.param(t, i, 1), births.param(t, i, 2),
+                                 births.param(t, i, 3), births.param(t, i, 4),
+                                 &births.cells[t][i*cell_list_size]);
+      }));
+    }
+    for (int t = 0; t < NUM_THREADS; t++)
+      threads[t].join();
+    check_serial(sampler, births, n);
+  }
+}
+
+// sampling_setup_thread_ reads source.h5m and e_bounds from the working
+// directory and builds the one global sampler, so this runs once. A
+// truncated source_sampler.state is left in its way, which has to be
+// rebuilt rather than thrown for.
+void test_thread_api() {
+  write_hex_mesh("source.h5m");
+  {
+    std::ofstream f("e_bounds");
+    f << "0.0 0.5 1.0" << std::endl;
+  }
+  {
+    std::ofstream f("source_sampler.state", std::ios::binary);
+    f << "PYNESMPL";
+  }
+  int mode = 1;
+  int num_threads = NUM_THREADS;
+  int cell_list_size = -1;
+  int ierr = -1;
+  int bad_ids[2] = {-1, NUM_THREADS};
+  for (int k = 0; k < 2; k++) {
+    pyne::sampling_setup_thread_(&mode, &bad_ids[k], &num_threads,
+                                 &cell_list_size, &ierr);
+    CHECK(ierr == 1);
+  }
+  for (int t = 0; t < NUM_THREADS; t++) {
+    ierr = -1;
+    pyne::sampling_setup_thread_(&mode, &t, &num_threads, &cell_list_size,
+                                 &ierr);
+    CHECK(ierr == 0);
+    CHECK(cell_list_size == MAX_NUM_CELLS);
+  }
+
+  const size_t n = 500;
+  Births births(n, cell_list_size);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < NUM_THREADS; t++) {
+    threads.push_back(std::thread([&, t]() {
+      int thread_id = t;
+      for (size_t i = 0; i < n; i++)
+        pyne::particle_birth_thread_(&thread_id, &births.rands[t][6*i],
+            births.param(t, i, 0), births.param(t, i, 1),
+            births.param(t, i, 2), births.param(t, i, 3),
+            births.param(t, i, 4), &births.cells[t][i*cell_list_size]);
+    }));
+  }
+  for (int t = 0; t < NUM_THREADS; t++)
+    threads[t].join();
+  pyne::Sampler sampler("source.h5m", hex_tag_names(mode), e_bounds(), mode);
+  check_serial(sampler, births, n);
+
+  // the serial entry point samples the same global sampler
+  Births serial(n, cell_list_size);
+  for (int t = 0; t < NUM_THREADS; t++)
+    for (size_t i = 0; i < n; i++)
+      pyne::particle_birth_(&births.rands[t][6*i], serial.param(t, i, 0),
+          serial.param(t, i, 1), serial.param(t, i, 2), serial.param(t, i, 3),
+          serial.param(t, i, 4), &serial.cells[t][i*cell_list_size]);
+  CHECK(serial.params == births.params);
+  CHECK(serial.cells == births.cells);
+  std::remove("source.h5m");
+  std::remove("e_bounds");
+  std::remove("source_sampler.state");
+}
+
+// The placement of a point in a volume element as the sampler did it before
+// the volume element table, with the branches of the tet fold.
+void edge_point_place(bool tet, const double* o, const double* x_vec,
+                      const double* y_vec, const double* z_vec, double s,
+                      double t, double u, double* pos) {
+  if (tet) {
+    if (s + t > 1) {
+      s = 1.0 - s;
+      t = 1.0 - t;
+    }
+    if (s + t + u > 1) {
+      if (t + u > 1) {
+        double old_t = t;
+        t = 1.0 - u;
+        u = 1.0 - s - old_t;
+      } else if (t + u <= 1) {
+        double old_s = s;
+        s = 1.0 - t - u;
+        u = old_s + t + u - 1;
+      }
+    }
+  }
+  for (int d = 0; d < 3; d++)
+    pos[d] = s*x_vec[d] + t*y_vec[d] + u*z_vec[d] + o[d];
+}
+
+void test_volume_element_table() {
+  // skewed elements, so that every edge vector component matters
+  const int num_ves = 3;
+  const double o[num_ves][3] = {{0.0, 0.0, 0.0}, {1.0, -2.0, 0.5},
+                                {-3.0, 4.0, 2.0}};
+  const double x_vec[num_ves][3] = {{1.0, 0.0, 0.0}, {2.0, 0.5, 0.0},
+                                    {0.3, -1.0, 0.2}};
+  const double y_vec[num_ves][3] = {{0.0, 1.0, 0.0}, {0.25, 3.0, 0.1},
+                                    {0.0, 0.7, 1.1}};
+  const double z_vec[num_ves][3] = {{0.0, 0.0, 1.0}, {-0.5, 0.2, 1.5},
+                                    {2.0, 0.1, -0.4}};
+  pyne::VolumeElementTable table;
+  table.resize(num_ves);
+  for (int v = 0; v < num_ves; v++)
+    table.set(v, o[v], x_vec[v], y_vec[v], z_vec[v]);
+  const pyne::VolumeElementTable& columns = table;
+  CHECK(table.size() == num_ves);
+  for (int c = 0; c < pyne::VolumeElementTable::NUM_COLUMNS; c++)
+    CHECK(reinterpret_cast<uintptr_t>(columns.column(c)) % 64 == 0);
+
+  // fixed points in each region of the tet fold: none, s + t > 1 only,
+  // s + t + u > 1 with t + u <= 1, s + t + u > 1 with t + u > 1, and both
+  // folds, followed by random points
+  std::vector<double> rands;
+  const double fixed[][3] = {{0.2, 0.3, 0.1}, {0.7, 0.6, 0.05},
+                             {0.3, 0.4, 0.5}, {0.1, 0.6, 0.7},
+                             {0.9, 0.8, 0.9}, {0.6, 0.7, 0.2},
+                             {0.0, 0.0, 0.0}, {0.5, 0.5, 0.5}};
+  int num_fixed = sizeof(fixed)/sizeof(fixed[0]);
+  for (int i = 0; i < num_fixed; i++)
+    rands.insert(rands.end(), fixed[i], fixed[i] + 3);
+  std::vector<double> random = random_numbers(3*1000, 7);
+  rands.insert(rands.end(), random.begin(), random.end());
+  int n = rands.size() / 3;
+
+  std::vector<int> ve_idx(n);
+  for (int i = 0; i < n; i++)
+    ve_idx[i] = i % num_ves;
+  for (int tet = 0; tet < 2; tet++) {
+    std::vector<double> x(n), y(n), z(n);
+    table.place(tet, &ve_idx[0], &rands[0], 3, n, &x[0], &y[0], &z[0]);
+    for (int i = 0; i < n; i++) {
+      int v = ve_idx[i];
+      double pos[3];
+      edge_point_place(tet, o[v], x_vec[v], y_vec[v], z_vec[v], rands[3*i],
+                       rands[3*i + 1], rands[3*i + 2], pos);
+      CHECK(close(x[i], pos[0]));
+      CHECK(close(y[i], pos[1]));
+      CHECK(close(z[i], pos[2]));
+    }
+  }
+
+  // a table referring to the storage of another places points the same
+  pyne::VolumeElementTable view;
+  view.refer(num_ves, table.column_stride(), columns.column(0));
+  std::vector<double> x(n), y(n), z(n), vx(n), vy(n), vz(n);
+  table.place(true, &ve_idx[0], &rands[0], 3, n, &x[0], &y[0], &z[0]);
+  view.place(true, &ve_idx[0], &rands[0], 3, n, &vx[0], &vy[0], &vz[0]);
+  CHECK(x == vx && y == vy && z == vz);
+}
+
+// Threads that open a shared state at once, with the lock file of a killed
+// build left in their way, map one state built from the mesh.
+void test_shared_state() {
+  const char* state_file = "sampling_hex_shared.state";
+  std::string lock_file = std::string(state_file) + ".lock";
+  std::remove(state_file);
+  {
+    std::ofstream f(lock_file.c_str());
+  }
+  int mode = 1;
+  pyne::Sampler serial(HEX_MESH, hex_tag_names(mode), e_bounds(), mode);
+  std::vector<pyne::Sampler*> samplers(NUM_THREADS, NULL);
+  std::vector<std::string> errors(NUM_THREADS);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < NUM_THREADS; t++) {
+    threads.push_back(std::thread([&, t]() {
+      try {
+        samplers[t] = pyne::Sampler::read_shared_state(
+            state_file, HEX_MESH, hex_tag_names(mode), e_bounds(), mode);
+      } catch (std::exception& e) {
+        errors[t] = e.what();
+      }
+    }));
+  }
+  for (int t = 0; t < NUM_THREADS; t++)
+    threads[t].join();
+  CHECK(pyne::file_exists(state_file));
+  CHECK(!pyne::file_exists(lock_file));
+  std::vector<double> rands = random_numbers(6*100, 30);
+  for (int t = 0; t < NUM_THREADS; t++) {
+    CHECK(errors[t].empty());
+    if (samplers[t] == NULL)
+      continue;
+    for (size_t i = 0; i < 100; i++) {
+      std::vector<double> r(rands.begin() + 6*i, rands.begin() + 6*i + 6);
+      pyne::SourceParticle p = samplers[t]->particle_birth(r);
+      pyne::SourceParticle q = serial.particle_birth(r);
+      CHECK(p.get_x() == q.get_x() && p.get_y() == q.get_y() &&
+            p.get_z() == q.get_z() && p.get_e() == q.get_e() &&
+            p.get_w() == q.get_w());
+    }
+    delete samplers[t];
+  }
+  std::remove(state_file);
+}
+
+// The probability with which an alias table of n bins samples each bin
+template <typename T>
+std::vector<double> sampled_pdf(int n, const T* prob, const int* alias) {
+  std::vector<double> pdf(n, 0.0);
+  for (int i = 0; i < n; i++) {
+    double keep = std::min(std::max((double) prob[i], 0.0), 1.0);
+    pdf[i] += keep/n;
+    pdf[alias[i]] += (1.0 - keep)/n;
+  }
+  return pdf;
+}
+
+// A PDF of n bins with some empty and a few heavy ones
+std::vector<double> uneven_pdf(int n, unsigned seed) {
+  std::vector<double> pdf = random_numbers(n, seed);
+  double sum = 0.0;
+  for (int i = 0; i < n; i++) {
+    if (i % 7 == 3)
+      pdf[i] = 0.0;
+    else if (i % 97 == 5)
+      pdf[i] *= 50.0;
+    sum += pdf[i];
+  }
+  for (int i = 0; i < n; i++)
+    pdf[i] /= sum;
+  return pdf;
+}
+
+// The single precision table against the double precision one it is narrowed
+// from, built serially and in parallel
+void test_compact_alias_table() {
+  const int n = 5000;
+  std::vector<double> pdf = uneven_pdf(n, 11);
+  std::vector<double> rands = random_numbers(2*n, 12);
+  for (int num_threads = 1; num_threads <= NUM_THREADS; num_threads += 3) {
+    pyne::AliasTable at(pdf, num_threads);
+    pyne::CompactAliasTable cat(pdf, num_threads);
+    CHECK(cat.n == n);
+    CHECK(cat.prob.size() == n);
+    CHECK(cat.alias == at.alias);
+    for (int i = 0; i < n; i++)
+      CHECK(std::fabs(cat.prob[i] - at.prob[i]) <= std::ldexp(at.prob[i], -24));
+    // rounding moves at most 2^-24 of each column between its bin and alias
+    std::vector<double> exact = sampled_pdf(n, &at.prob[0], &at.alias[0]);
+    std::vector<double> sampled = sampled_pdf(n, &cat.prob[0], &cat.alias[0]);
+    std::vector<int> columns(n, 1);
+    for (int i = 0; i < n; i++)
+      if (at.alias[i] != i)
+        columns[at.alias[i]]++;
+    for (int i = 0; i < n; i++) {
+      CHECK(std::fabs(exact[i] - pdf[i]) <= 1e-12);
+      CHECK(std::fabs(sampled[i] - exact[i]) <=
+            std::ldexp(columns[i]*(1.0/n), -24));
+    }
+    // the tables only differ where rand2 falls between the two probabilities
+    for (int k = 0; k < n; k++) {
+      double rand1 = rands[2*k], rand2 = rands[2*k + 1];
+      int i = (int) (n*rand1);
+      double lo = std::min<double>(cat.prob[i], at.prob[i]);
+      double hi = std::max<double>(cat.prob[i], at.prob[i]);
+      if (rand2 < lo || hi <= rand2)
+        CHECK(cat.sample_pdf(rand1, rand2) == at.sample_pdf(rand1, rand2));
+    }
+  }
+}
+
+// Rows of many groups, set one after another through the shared scratch
+void test_mesh_alias_table_rows() {
+  const int num_rows = 3;
+  const int num_groups = 3000;
+  pyne::MeshAliasTable at(num_rows, num_groups);
+  std::vector<std::vector<double> > pdfs;
+  std::vector<double> row_pdf(num_rows);
+  for (int row = 0; row < num_rows; row++) {
+    pdfs.push_back(uneven_pdf(num_groups, 20 + row));
+    std::vector<double> p = pdfs.back();
+    for (int g = 0; g < num_groups; g++)
+      p[g] *= row + 1.0;
+    CHECK(close(at.set_row(row, &p[0]), row + 1.0));
+    row_pdf[row] = 1.0;
+  }
+  at.set_row_pdf(row_pdf);
+  for (int row = 0; row < num_rows; row++) {
+    size_t first = (size_t) row*num_groups;
+    std::vector<double> sampled = sampled_pdf(num_groups, &at.group_prob[first],
+                                              &at.group_alias[first]);
+    for (int g = 0; g < num_groups; g++)
+      CHECK(std::fabs(sampled[g] - pdfs[row][g]) <= 1e-12);
+  }
+}
+
+#if !defined __WIN_MSVC__
+// A zero filled array which only takes memory for the pages written to.
+template <typename T>
+T* sparse_array(size_t n) {
+  void* p = mmap(NULL, n*sizeof(T), PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  return (p == MAP_FAILED) ? NULL : static_cast<T*>(p);
+}
+#endif
+
+void test_mesh_alias_table_64bit_index() {
+#if !defined __WIN_MSVC__
+  const int num_rows = 1 << 23;
+  const int num_groups = 600;
+  const size_t num_entries = (size_t) num_rows*num_groups;
+  CHECK(num_entries > ((size_t) 1 << 32));
+  double* row_prob = sparse_array<double>(num_rows);
+  int* row_alias = sparse_array<int>(num_rows);
+  double* group_prob = sparse_array<double>(num_entries);
+  int* group_alias = sparse_array<int>(num_entries);
+  if (row_prob == NULL || row_alias == NULL || group_prob == NULL ||
+      group_alias == NULL) {
+    std::printf("skipped the 64-bit alias table index test, no memory\n");
+    return;
+  }
+  // every row column keeps its row, so rand1 alone selects the row
+  for (int i = 0; i < num_rows; i++)
+    row_prob[i] = 1.0;
+  {
+    pyne::MeshAliasTable at(num_rows, num_groups, row_prob, row_alias,
+                            group_prob, group_alias, NULL);
+    CHECK(at.group_prob.size() == num_entries);
+    CHECK(at.group_alias.size() == num_entries);
+    // the last row before INT_MAX entries, the first after, the first after
+    // 2^32 entries, and the last row
+    const int rows[4] = {(int) (INT32_MAX / num_groups) - 1,
+                         (int) (INT32_MAX / num_groups) + 1,
+                         (int) ((((int64_t) 1) << 32) / num_groups) + 1,
+                         num_rows - 1};
+    const int groups[3] = {0, 17, num_groups - 1};
+    for (int r = 0; r < 4; r++) {
+      for (int k = 0; k < 3; k++) {
+        int row = rows[r];
+        int g = groups[k];
+        int64_t j = (int64_t) row*num_groups + g;
+        double rand1 = (row + (g + 0.5)/num_groups)/num_rows;
+        // the group column keeps its group
+        group_prob[j] = 1.0;
+        CHECK(at.sample_pdf(rand1, 0.5) == j);
+        // the group column gives way to its alias
+        group_prob[j] = 0.0;
+        group_alias[j] = 7;
+        CHECK(at.sample_pdf(rand1, 0.5) == j - g + 7);
+      }
+    }
+  }
+  munmap(group_alias, num_entries*sizeof(int));
+  munmap(group_prob, num_entries*sizeof(double));
+  munmap(row_alias, num_rows*sizeof(int));
+  munmap(row_prob, num_rows*sizeof(double));
+#endif
+}
+
+}  // namespace
+
+int main() {
+  write_hex_mesh(HEX_MESH);
+  write_tet_mesh();
+  test_hex_batches();
+  test_hex_blocked_batches();
+  test_tet_batches();
+  test_concurrent_contexts();
+  test_thread_api();
+  test_volume_element_table();
+  test_shared_state();
+  test_compact_alias_table();
+  test_mesh_alias_table_rows();
+  test_mesh_alias_table_64bit_index();
+  std::remove(HEX_MESH);
+  std::remove(TET_MESH);
+  if (failures == 0)
+    std::printf("all source sampling tests passed\n");
+  return failures == 0 ? 0 : 1;
+}
@@ -5,8 +5,13 @@
   #a = populate_with_warnings("AHOTN")
   #a = populate_with_warnings("DGFEM")
 
+import json
+import os
+import subprocess
+import sys
+
 import numpy as np
-from numpy.testing import assert_array_almost_equal
+from numpy.testing import assert_array_almost_equal, assert_allclose
 
 import pyne.spatialsolver
 from .dictionary_populate_test import populate_simple, populate_simple_with_warnings, populate_intermediate_1
@@ -58,6 +63,18 @@ def test_ahotn_ll():
     assert_array_almost_equal(exp, obs, 4)
 
 
+def test_ahotn_ln_gmres():
+    a = populate_simple("AHOTN", "LN")
+    si_results = pyne.spatialsolver.solve(a)
+    a = populate_simple("AHOTN", "LN")
+    a['inner_solver'] = "GMRES"
+    dict_results = pyne.spatialsolver.solve(a)
+    if(dict_results['success'] == 0):
+        raise AssertionError("Error: " + dict_results['error_msg'])
+    assert_array_almost_equal(np.array(si_results['flux']),
+                              np.array(dict_results['flux']), 8)
+    assert dict_results['iterations'][0] < si_results['iterations'][0]
+
 def test_ahotn_nefd():
     a = populate_simple("AHOTN","NEFD")
     dict_results = pyne.spatialsolver.solve(a)
@@ -123,6 +140,18 @@ def test_dgfem_ld():
     else:
         raise AssertionError("Flux outputs are not equal for ahotn-nefd example.  Check system setup.")
 
+def test_dgfem_ld_gmres():
+    a = populate_simple("DGFEM","LD")
+    si_results = pyne.spatialsolver.solve(a)
+    a = populate_simple("DGFEM","LD")
+    a['inner_solver'] = "GMRES"
+    dict_results = pyne.spatialsolver.solve(a)
+    if(dict_results['success'] == 0):
+        raise AssertionError("Error: " + dict_results['error_msg'])
+    assert_array_almost_equal(np.array(si_results['flux']),
+                              np.array(dict_results['flux']), 8)
+    assert dict_results['iterations'][0] < si_results['iterations'][0]
+
 def test_dgfem_dense():
     a = populate_simple("DGFEM","DENSE")
     dict_results = pyne.spatialsolver.solve(a)
@@ -433,3 +462,59 @@ def test_sct_step_alternating():
         print("flux's are equal!")
     else:
         raise AssertionError("Flux outputs are not equal for ahotn-nefd example.  Check system setup.")
+
+
+# The sweeps go through the octants as parallel wavefronts when built with
+# OpenMP. These cases mix reflective, vacuum and fixed inflow boundaries, so
+# that the outflow of one octant is the inflow of a later one, and are solved
+# with several thread counts against the fluxes of the serial octant sweeps
+# they replaced, in sweep_ref_flux.json.
+_SWEEP_CASES = [("AHOTN", "LN"), ("AHOTN", "LL"), ("AHOTN", "NEFD"),
+                ("DGFEM", "LD"), ("DGFEM", "DENSE"), ("DGFEM", "LAGRANGE")]
+_SWEEP_BCS = [[[1, 0], [1, 0], [1, 0]], [[2, 0], [1, 2], [0, 2]]]
+_SWEEP_THREADS = [1, 2, 3]
+
+_SOLVE_SCRIPT = """
+import json, sys
+import pyne.spatialsolver
+from spatial_solvers.dictionary_populate_test import populate_simple
+solver, solver_type, bcs = json.loads(sys.argv[1])
+a = populate_simple(solver, solver_type)
+a['x_boundry_conditions'], a['y_boundry_conditions'], a['z_boundry_conditions'] = bcs
+results = pyne.spatialsolver.solve(a)
+if results['success'] == 0:
+    raise RuntimeError(results['error_msg'])
+print(json.dumps(results['flux']))
+"""
+
+def _sweep_ref_key(solver, solver_type, bcs):
+    return "{0}_{1}_{2}".format(solver, solver_type,
+                                "".join(str(b) for bc in bcs for b in bc))
+
+def _solve_with_threads(solver, solver_type, bcs, threads):
+    # the thread count is fixed when the library loads, so each count runs
+    # in its own process
+    env = dict(os.environ, OMP_NUM_THREADS=str(threads))
+    out = subprocess.check_output(
+        [sys.executable, "-c", _SOLVE_SCRIPT,
+         json.dumps([solver, solver_type, bcs])], env=env)
+    return np.array(json.loads(out.decode().strip().splitlines()[-1]))
+
+def _check_sweeps(solver, solver_type, bcs):
+    ref_file = os.path.join(os.path.dirname(__file__), "sweep_ref_flux.json")
+    with open(ref_file) as f:
+        exp = np.array(json.load(f)[_sweep_ref_key(solver, solver_type, bcs)])
+    for threads in _SWEEP_THREADS:
+        obs = _solve_with_threads(solver, solver_type, bcs, threads)
+        assert_allclose(obs, exp, rtol=1e-10, atol=1e-12,
+            err_msg="{0} {1} with {2} threads".format(solver, solver_type,
+                                                      threads))
+
+def test_parallel_sweeps():
+    for solver, solver_type in _SWEEP_CASES:
+        for bcs in _SWEEP_BCS:
+            _check_sweeps(solver, solver_type, bcs)
+
+def test_parallel_sweeps_sct_step():
+    # the reflective inflow of SCTSTEP is not updated, so only vacuum here
+    _check_sweeps("SCTSTEP", "anything", [[0, 0], [0, 0], [0, 0]])
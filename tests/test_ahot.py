@@ -48,6 +48,18 @@ def test_dgfem_lagrange_alternating():
 def test_sct_step_alternating():
   ahot_script.test_sct_step_alternating()
 
+def test_ahotn_ln_gmres():
+  ahot_script.test_ahotn_ln_gmres()
+
+def test_dgfem_ld_gmres():
+  ahot_script.test_dgfem_ld_gmres()
+
+def test_parallel_sweeps():
+  ahot_script.test_parallel_sweeps()
+
+def test_parallel_sweeps_sct_step():
+  ahot_script.test_parallel_sweeps_sct_step()
+
 
 if __name__ == "__main__":
   nose.runmodule()
@@ -48,6 +48,12 @@ def metadata():
 
     return [rets1, rets2, md]
 
+def volume_table():
+    from pyne import dagmc
+    dagmc.load(path)
+
+    return dagmc.dag_volume_table()
+
 def versions():
     from pyne import dagmc
     dagmc.load(path)
@@ -164,6 +170,31 @@ def ray_iterator():
 
     return [startvol, vols1, dists1, surfs1, i, vols2, dists2, surfs2, j]
 
+def ray_follow_many():
+    from pyne import dagmc
+    dagmc.load(path)
+
+    starts = [[-2, 0, 0], [0, 0, 0], [-2, 0, 0]]
+    directions = [[1, 0, 0], [1, 0, 0], [-1, 0, 0]]
+    startvols = [dagmc.find_volume(s) for s in starts]
+    handles = [dagmc.vol_id_to_handle[v] for v in startvols]
+
+    buf = dagmc.dag_alloc_ray_buffer()
+    offsets, surfs, dists, vols = dagmc.dag_ray_follow_many(
+        handles, starts, directions, 0.0, buf)
+    # a second call reuses the buffer
+    again = dagmc.dag_ray_follow_many(handles, starts, directions, 0.0, buf)
+    dagmc.dag_dealloc_ray_buffer(buf)
+
+    many = []
+    for i in range(len(starts)):
+        many.append([(dagmc.vol_handle_to_id[vols[k]], dists[k],
+                      dagmc.surf_handle_to_id[surfs[k]])
+                     for k in range(offsets[i], offsets[i + 1])])
+    single = [list(dagmc.ray_iterator(v, s, d))
+              for v, s, d in zip(startvols, starts, directions)]
+    return [many, single, list(offsets), list(again[0])]
+
 def ray_story():
     from pyne import dagmc
     dagmc.load(path)
@@ -211,6 +242,18 @@ def discretize_geom_grid():
 
     return [results, coords]
 
+def discretize_geom_threads():
+    from pyne import dagmc
+    dagmc.load(path)
+
+    coords = [-4, -1, 1, 4]
+    mesh = Mesh(structured=True, structured_coords=[coords, coords, coords])
+    results1 = dagmc.discretize_geom(mesh, num_rays=49, grid=True)
+    results4 = dagmc.discretize_geom(mesh, num_rays=49, grid=True,
+                                     num_threads=4)
+
+    return [results1, results4]
+
 def discretize_geom_mix():
     from pyne import dagmc
     dagmc.load(path)
@@ -293,6 +336,33 @@ def test_metadata():
     assert_equal(md['rho'], 0.5)
     assert_true(all(x in md for x in ['material', 'rho', 'imp']))
 
+def test_volume_table():
+    p = multiprocessing.Pool()
+    results = p.apply_async(volume_table)
+    p.close()
+    p.join()
+    table = results.get()
+
+    # the known volumes of unitbox.h5m, see test_metadata, test_boundary and
+    # test_one_ray
+    rows = dict((row['id'], row) for row in table)
+    assert_equal(len(table), 4)
+    assert_equal(sorted(rows), [1, 2, 3, 4])
+    assert_equal([bool(rows[v]['graveyard']) for v in range(1, 5)],
+                 [True, False, False, False])
+    assert_equal([bool(rows[v]['implicit_complement']) for v in range(1, 5)],
+                 [False, False, False, True])
+    assert_equal(rows[2]['material'], 5)
+    assert_equal(rows[2]['density'], 0.5)
+    # volume 2 is the box [-1, 1]^3, and volume 3 reaches from its surface at
+    # y = 1 out to y = 1.1 + 3.056921938
+    for i in range(3):
+        assert_true(rows[2]['bbox_min'][i] <= -1.0)
+        assert_true(rows[2]['bbox_max'][i] >= 1.0)
+        assert_true(rows[2]['bbox_min'][i] < rows[2]['bbox_max'][i])
+    assert_true(rows[3]['bbox_min'][1] <= -1.0)
+    assert_true(rows[3]['bbox_max'][1] >= 4.156921938 - 1e-6)
+
 def test_versions():
     p = multiprocessing.Pool()
     results = p.apply_async(versions)
@@ -427,6 +497,22 @@ def test_ray_iterator():
             assert_almost_equal(expected_dists[k], dists2[k])
     assert_equal(j, 1)
 
+def test_ray_follow_many():
+    p = multiprocessing.Pool()
+    results = p.apply_async(ray_follow_many)
+    p.close()
+    p.join()
+    many, single, offsets, again = results.get()
+
+    assert_equal(len(many), 3)
+    assert_equal(offsets, again)
+    for ray_many, ray_single in zip(many, single):
+        assert_equal(len(ray_many), len(ray_single))
+        for (vol1, dist1, surf1), (vol2, dist2, surf2) in zip(ray_many, ray_single):
+            assert_equal(vol1, vol2)
+            assert_almost_equal(dist1, dist2)
+            assert_equal(surf1, surf2)
+
 def test_ray_story():
     p = multiprocessing.Pool()
     results = p.apply_async(ray_story)
@@ -513,6 +599,15 @@ def test_discretize_geom_grid():
 
         assert_almost_equal(res['vol_frac'], 1.0)
 
+def test_discretize_geom_threads():
+    p = multiprocessing.Pool()
+    results = p.apply_async(discretize_geom_threads)
+    p.close()
+    p.join()
+    results1, results4 = results.get()
+
+    assert_array_equal(results1, results4)
+
 def test_discretize_geom_mix():
     """Single mesh volume element that is a 50:50 split of geometry volumes
     2 and 3.
@@ -4,7 +4,7 @@ import math
 import warnings
 
 import nose
-from nose.tools import assert_equal, assert_in, assert_true
+from nose.tools import assert_equal, assert_in, assert_true, assert_raises
 import numpy as np
 import numpy.testing as npt
 
@@ -44,7 +44,28 @@ def test_natural_abund_excited_state():
     # excited state should not be in the map yet
     assert_equal(data.natural_abund_map.get(excited), None)
     nabund = data.natural_abund(excited)
-    assert_equal(nabund, data.natural_abund_map.get(excited))
+    assert_equal(nabund, data.natural_abund(gnd))
+    # the estimate is cached apart, the loaded map is left as it is
+    assert_equal(data.natural_abund_map.get(excited), None)
+    assert_equal(data.natural_abund(excited), nabund)
+
+
+def test_miss_caches():
+    # neither state is in the map, the A number is the estimate
+    gnd = 923000000
+    excited = gnd + 1
+    assert_equal(data.atomic_mass_map.get(gnd), None)
+    assert_equal(data.atomic_mass(excited), 300.0)
+    assert_equal(data.atomic_mass_map.get(excited), None)
+    # the estimate for the excited state follows the ground state mass once
+    # the caches are cleared
+    data.atomic_mass_map[gnd] = 300.5
+    assert_equal(data.atomic_mass(excited), 300.0)
+    data.clear_miss_caches()
+    assert_equal(data.atomic_mass(excited), 300.5)
+    del data.atomic_mass_map[gnd]
+    data.clear_miss_caches()
+    assert_equal(data.atomic_mass(excited), 300.0)
 
 
 def test_q_val():
@@ -122,6 +143,19 @@ def test_nds_fpyield():
     assert_equal(data.fpyield('Th-232', 'Eu-154', 3, True), 9.3e-08)
 
 
+def test_fpyield_matrix():
+    parents, products, fpy = data.fpyield_matrix()
+    assert_equal(fpy.shape, (len(parents), len(products)))
+    p = list(parents).index(962440000)
+    c = list(products).index(611480001)
+    assert_equal(fpy[p, c], data.fpyield(962440000, 611480001))
+    parents, products, fpy = data.fpyield_matrix('NDS_14MEV', True)
+    p = list(parents).index(902320000)
+    c = list(products).index(631540000)
+    assert_equal(fpy[p, c], 9.3e-08)
+    assert_equal(data.fpyield(902320000, 1), 0.0)
+
+
 def test_half_life():
     assert_equal(data.half_life('H1'), np.inf)
     assert_equal(data.half_life(922350001), 1560.0)
@@ -196,6 +230,20 @@ def test_constants():
         yield assert_equal, exp, obs
 
 
+def test_decay_graph():
+    parents, lams, indptr, children, brs = data.decay_graph()
+    assert_equal(len(parents), len(lams))
+    assert_equal(len(indptr), len(parents) + 1)
+    assert_equal(indptr[-1], len(children))
+    for nuc in [922350001, 611460000, 922350000]:
+        p = np.searchsorted(parents, nuc)
+        assert_equal(parents[p], nuc)
+        kids = children[indptr[p]:indptr[p+1]]
+        assert_equal(set(kids), data.decay_children(nuc, False))
+        for child, br in zip(kids, brs[indptr[p]:indptr[p+1]]):
+            assert_equal(br, data.branch_ratio(nuc, int(child), False))
+
+
 def test_metastable_id():
     assert_equal(data.metastable_id(430990000, 1), 430990002)
     assert_equal(data.metastable_id(310720000, 1), 310720002)
@@ -356,6 +404,28 @@ def test_gamma_parent():
                   982520000])
 
 
+
+def test_gamma_line_match():
+    peaks = [661.65, 1173.2, 1332.5, 32.19]
+    indptr, energies, intensities, parents, children = \
+        data.gamma_line_match(peaks, 0.1)
+    assert_equal(len(indptr), len(peaks) + 1)
+    assert_equal(indptr[-1], len(energies))
+    for k, peak in enumerate(peaks):
+        lines = slice(indptr[k], indptr[k+1])
+        assert(np.all(np.abs(energies[lines] - peak) <= 0.1))
+        assert(np.all(np.diff(energies[lines]) >= 0.0))
+        gammas = children[lines] != 0
+        assert_equal(sorted(parents[lines][gammas]),
+                     sorted(data.gamma_parent(peak, 0.1)))
+    # the barium K x-rays of the Cs-137 decay are in the index
+    lines = slice(indptr[3], indptr[4])
+    assert(551370000 in parents[lines][children[lines] == 0])
+    # wider lines match more, never fewer
+    wide = data.gamma_line_match(peaks, 0.1, line_errors=True)[0]
+    assert(np.all(np.diff(wide) >= np.diff(indptr)))
+
+
 def test_alpha_energy():
     assert_equal(data.alpha_energy(952410000),
                  [4758.0, 4800.0, 4834.0, 4889.0, 4956.0, 4962.0, 4964.0,
@@ -527,5 +597,25 @@ def test_special_children():
         assert_equal(set(data.decay_data_children(nucname.id_to_state_id(item))),
                      special_children[item])
 
+def test_preload_nuc_data():
+    data.preload_nuc_data(['atomic_mass', 'decay'])
+    assert_in(data.atomic_mass(922350), [235.043930131, 235.0])
+    assert_true(len(data.decay_data_children(922350000)) > 0)
+    data.preload_nuc_data()
+    assert_true(data.simple_xs(922350000, 'fiss', 'thermal') > 0.0)
+    assert_raises(ValueError, data.preload_nuc_data, ['not_a_table'])
+
+def test_nuc_data_snapshot():
+    fname = 'nuc_data_snapshot.bin'
+    if os.path.exists(fname):
+        os.remove(fname)
+    assert_true(not data.load_nuc_data_snapshot(fname, create=False))
+    assert_true(not data.load_nuc_data_snapshot(fname))
+    assert_true(os.path.exists(fname))
+    assert_true(data.load_nuc_data_snapshot(fname))
+    assert_equal(data.decay_half_life(551370000, 561370000), (949252608.0,
+                                                              2840184.0))
+    os.remove(fname)
+
 if __name__ == "__main__":
     nose.runmodule()
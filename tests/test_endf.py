@@ -86,6 +86,15 @@ def test_endftod():
     exp = np.array(exp)
     assert_allclose(obs, exp, rtol = 1e-8)
 
+def test_fromendf_tok():
+    from pyne.utils import fromendf_tok
+    lines = (" 3.28559+12 2.328559+4-3.28559-12-2.328559-2        121       -1219228 3  1    1\n"
+             " 1.0E+05   -2.5D-3     1.23456789            1.2345-100   -0.0    9228 3  1    2\n")
+    obs = fromendf_tok(lines)
+    exp = [3.28559e+12, 2.328559e+4, -3.28559e-12, -2.328559e-2, 121.0, -121.0,
+           1.0e+05, -2.5e-3, 1.23456789, 0.0, 1.2345e-100, 0.0]
+    assert_array_equal(obs, exp)
+
 def test_loadtape():
     try_download("http://www.nndc.bnl.gov/endf/b6.8/tapes/tape.100",
              "endftape.100", "b56dd0aee38bd006c58181e473232776")
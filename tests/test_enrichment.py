@@ -8,6 +8,7 @@ from nose.tools import assert_equal, assert_not_equal, assert_raises, raises, \
 import os
 import warnings
 import numpy as np
+from numpy.testing import assert_array_almost_equal
 import math
 
 from pyne.utils import QAWarning
@@ -174,6 +175,53 @@ def test_tail_per_prod():
     obs = enr.tail_per_prod(xf, xp, xt)
     assert_almost_equal(obs, exp)
 
+def test_batch():
+    xf = np.array([0.0072, 0.0072, 0.0072, 0.01, 0.0072])
+    xp = np.array([0.05, 0.9, 0.2, 0.05, 0.0])
+    xt = 0.0025
+    ratios = {'prod_per_feed': lambda f, p, t: (f - t) / (p - t),
+              'tail_per_feed': lambda f, p, t: (f - p) / (t - p),
+              'tail_per_prod': lambda f, p, t: (f - p) / (t - f),
+              'feed_per_prod': lambda f, p, t: (p - t) / (f - t),
+              'feed_per_tail': lambda f, p, t: (t - p) / (f - p),
+              'prod_per_tail': lambda f, p, t: (t - f) / (f - p)}
+    for name, func in ratios.items():
+        obs = getattr(enr, name + '_n')(xf, xp, xt)
+        assert_array_almost_equal(obs, func(xf, xp, xt), 12)
+    obs = enr.value_func_n(xp[:4])
+    assert_array_almost_equal(obs, [enr.value_func(x) for x in xp[:4]], 12)
+    for name, kw in [('swu_per_feed', 'feed'), ('swu_per_prod', 'product'),
+                     ('swu_per_tail', 'tails')]:
+        obs = getattr(enr, name + '_n')(xf, xp, xt)
+        exp = [enr.swu(f, p, xt, **{kw: 1.0}) for f, p in zip(xf, xp)]
+        assert_array_almost_equal(obs[:4], exp[:4], 10)
+        # a product assay of zero takes the scalar path
+        assert_equal(obs[4], exp[4])
+
+def test_batch_swu_cancellation():
+    # as the feed assay nears the tails or product assay the terms of the SWU
+    # functions cancel, and the batch functions only agree with the scalar
+    # ones to within 4 eps times the sum of the magnitudes of the terms
+    eps = np.finfo(float).eps
+    xt, xp = 0.0025, 0.05
+    near = 10.0**-np.arange(3.0, 15.0)
+    xf = np.concatenate([xt * (1 + near), xp * (1 - near)])
+    v = enr.value_func
+    terms = {'swu_per_feed': lambda f, p, t: [(f - t) / (p - t) * v(p),
+                                             (f - p) / (t - p) * v(t), v(f)],
+             'swu_per_prod': lambda f, p, t: [v(p), (f - p) / (t - f) * v(t),
+                                             (p - t) / (f - t) * v(f)],
+             'swu_per_tail': lambda f, p, t: [(t - f) / (f - p) * v(p), v(t),
+                                             (t - p) / (f - p) * v(f)]}
+    for name, kw in [('swu_per_feed', 'feed'), ('swu_per_prod', 'product'),
+                     ('swu_per_tail', 'tails')]:
+        obs = getattr(enr, name + '_n')(xf, xp, xt)
+        for f, o in zip(xf, obs):
+            exp = enr.swu(f, xp, xt, **{kw: 1.0})
+            scale = sum(abs(x) for x in terms[name](f, xp, xt))
+            assert_true(abs(o - exp) <= 4 * eps * scale,
+                        (name, f, o, exp, scale))
+
 def test_alphastar_i():
     a, ms, mi = 1.05, 236.5, 235.0
     exp = a**(ms - mi)
@@ -332,6 +380,53 @@ def test_tungsten():
         yield check_tungsten, solver
 
 
+def check_multicomponent_many(solver):
+    feed = Material({
+            922320000: 1.1 * (10.0**-9),
+            922340000: 0.00021,
+            922350000: 0.0092,
+            922360000: 0.0042,
+            922380000: 0.9863899989,
+            })
+    cascs = []
+    for x_prod_j in np.linspace(0.04, 0.08, 9):
+        casc = enr.default_uranium_cascade()
+        casc.mat_feed = feed
+        casc.x_prod_j = x_prod_j
+        cascs.append(casc)
+    expected = [enr.multicomponent(c, solver=solver, tolerance=1E-11)
+                for c in cascs]
+
+    # cold starts solve each cascade exactly as multicomponent() does
+    cold = enr.multicomponent_many(cascs, solver=solver, tolerance=1E-11,
+                                   warm_start=False, num_threads=3)
+    assert_equal(len(cold), len(cascs))
+    for obs, exp in zip(cold, expected):
+        assert_equal(obs.Mstar, exp.Mstar)
+        assert_equal(obs.N, exp.N)
+        assert_equal(obs.M, exp.M)
+        assert_equal(obs.l_t_per_feed, exp.l_t_per_feed)
+        assert_equal(obs.swu_per_prod, exp.swu_per_prod)
+        assert_equal(obs.mat_prod.mass, exp.mat_prod.mass)
+        assert_equal(obs.mat_tail.comp[922350000], exp.mat_tail.comp[922350000])
+
+    warm = enr.multicomponent_many(cascs, solver=solver, tolerance=1E-11)
+    for obs, exp in zip(warm, expected):
+        assert_almost_equal(obs.mat_prod.comp[922350000] / 
+                            exp.mat_prod.comp[922350000], 1.0, 5)
+        assert_almost_equal(obs.Mstar / exp.Mstar, 1.0, 5)
+        assert_almost_equal(obs.l_t_per_feed / exp.l_t_per_feed, 1.0, 5)
+        assert_almost_equal(obs.swu_per_feed / exp.swu_per_feed, 1.0, 5)
+
+def test_multicomponent_many():
+    for solver in SOLVERS:
+        yield check_multicomponent_many, solver
+
+def test_multicomponent_many_unknown_solver():
+    assert_raises(ValueError, enr.multicomponent_many,
+                  [enr.default_uranium_cascade()], "bogus")
+
+
 if __name__ == "__main__":
     nose.runmodule()
 
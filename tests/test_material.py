@@ -13,7 +13,10 @@ from pyne.utils import QAWarning
 warnings.simplefilter("ignore", QAWarning)
 from pyne import nuc_data
 from pyne.material import Material, from_atom_frac, from_hdf5, from_text, \
-    MapStrMaterial, MultiMaterial, MaterialLibrary
+    from_hdf5_rows, write_hdf5_rows, MapStrMaterial, MultiMaterial, \
+    MaterialLibrary, transmute_all, write_mcnp, write_fluka, \
+    write_binary_library, from_binary_library, photon_sources, mix, \
+    expand_elements, collapse_elements
 from pyne import jsoncpp
 from pyne import data
 from pyne import nucname
@@ -277,6 +280,87 @@ def test_hdf5_protocol_1():
     assert_equal(m.metadata['comment'], 'first light')
     os.remove('proto1.h5')
 
+
+def test_from_hdf5_rows():
+    if 'proto1.h5' in os.listdir('.'):
+        os.remove('proto1.h5')
+    for i in range(1, 11):
+        leu = Material({'U235': 0.04, 'U238': 0.96}, i*4.2, 2.72, 1.0*i)
+        leu.metadata['comment'] = 'fire in the disco - {0}'.format(i)
+        leu.write_hdf5('proto1.h5')
+
+    mats = from_hdf5_rows('proto1.h5', '/mat_name', 2, 5)
+    assert_equal(5, len(mats))
+    for k, m in enumerate(mats):
+        exp = from_hdf5('proto1.h5', '/mat_name', k + 2, 1)
+        assert_equal(exp.comp, m.comp)
+        assert_equal(exp.mass, m.mass)
+        assert_equal(exp.density, m.density)
+        assert_equal(exp.atoms_per_molecule, m.atoms_per_molecule)
+        assert_equal(exp.metadata['comment'], m.metadata['comment'])
+    assert_equal(10, len(from_hdf5_rows('proto1.h5')))
+    assert_equal(3, len(from_hdf5_rows('proto1.h5', start=-3)))
+    assert_raises(IndexError, from_hdf5_rows, 'proto1.h5', '/mat_name', 8, 5)
+    os.remove('proto1.h5')
+
+
+def test_write_hdf5_rows():
+    if 'proto1.h5' in os.listdir('.'):
+        os.remove('proto1.h5')
+    mats = []
+    for i in range(1, 6):
+        leu = Material({'U235': 0.04, 'U238': 0.96}, i*4.2, 2.72, 1.0*i)
+        leu.metadata['comment'] = 'fire in the disco - {0}'.format(i)
+        mats.append(leu)
+    mats[2] = Material({'U235': 0.5, 'H1': 0.5}, 1.0, 2.0, 3.0)
+    write_hdf5_rows(mats, 'proto1.h5', deflate=4, shuffle=True)
+    # appends to the same table, also row by row
+    write_hdf5_rows(mats[:2], 'proto1.h5')
+    mats[0].write_hdf5('proto1.h5')
+
+    obs = from_hdf5_rows('proto1.h5')
+    exp = mats + mats[:2] + mats[:1]
+    assert_equal(len(exp), len(obs))
+    for e, m in zip(exp, obs):
+        assert_equal(e.comp, m.comp)
+        assert_equal(e.mass, m.mass)
+        assert_equal(e.density, m.density)
+        assert_equal(e.atoms_per_molecule, m.atoms_per_molecule)
+    assert_equal(obs[1].metadata['comment'], 'fire in the disco - 2')
+    assert_equal(from_hdf5('proto1.h5', '/mat_name', 6, 1).metadata['comment'],
+                 'fire in the disco - 2')
+    os.remove('proto1.h5')
+
+
+def test_binary_library():
+    mats = []
+    for i in range(1, 6):
+        leu = Material({'U235': 0.04, 'U238': 0.96}, i*4.2, 2.72, 1.0*i)
+        leu.metadata['comment'] = 'fire in the disco - {0}'.format(i)
+        mats.append(leu)
+    mats[2] = Material({'U235': 0.5, 'H1': 0.5}, 1.0, 2.0, 3.0)
+    mats.append(Material())
+    write_binary_library(mats, 'matlib.pml')
+
+    obs = from_binary_library('matlib.pml')
+    assert_equal(len(mats), len(obs))
+    for e, m in zip(mats, obs):
+        assert_equal(e.comp, m.comp)
+        assert_equal(e.mass, m.mass)
+        assert_equal(e.density, m.density)
+        assert_equal(e.atoms_per_molecule, m.atoms_per_molecule)
+    assert_equal(obs[1].metadata['comment'], 'fire in the disco - 2')
+    assert_equal(0, len(obs[2].metadata))
+    # random access
+    obs = from_binary_library('matlib.pml', 2, 2)
+    assert_equal(2, len(obs))
+    assert_equal(mats[2].comp, obs[0].comp)
+    assert_equal(obs[1].metadata['comment'], 'fire in the disco - 4')
+    assert_equal(1, len(from_binary_library('matlib.pml', start=-1)))
+    assert_raises(IndexError, from_binary_library, 'matlib.pml', 4, 5)
+    os.remove('matlib.pml')
+    assert_raises(RuntimeError, from_binary_library, 'test_material.py')
+
 class TestMaterialMethods(TestCase):
     "Tests that the Material member functions work."
 
@@ -336,6 +420,21 @@ class TestMaterialMethods(TestCase):
             assert_almost_equal(obs2[key], exp2[key])
 
 
+    def test_nuc_property_table(self):
+        mat = Material({922350000: 0.05, 922380000: 0.95}, 15)
+        # the second calls read the cached properties
+        act = mat.activity()
+        mw = mat.molecular_mass()
+        assert_equal(act, mat.activity())
+        assert_equal(mw, mat.molecular_mass())
+        data.clear_nuc_property_table()
+        assert_equal(act, mat.activity())
+        assert_equal(mw, mat.molecular_mass())
+        data.clear_miss_caches()
+        assert_equal(act, mat.activity())
+        assert_equal(mw, mat.molecular_mass())
+
+
     def test_molecular_mass(self):
         mat_empty = Material({})
         assert_equal(mat_empty.molecular_mass(), 0.0)
@@ -379,6 +478,21 @@ def test_expand_elements3():
     afrac = expmat.to_atom_frac()
     assert_almost_equal(natmat[60000000], afrac[60000000])
     
+def test_expand_elements_all():
+    mats = [Material({'C': 1.0, 'U': 3.0}), Material({'C': 2.0, 'H': 0.5}),
+            Material({'C': 1.0, 922350000: 0.5})]
+    exp = [mat.expand_elements() for mat in mats]
+    expand_elements(mats, num_threads=2)
+    for obs, e in zip(mats, exp):
+        assert_equal(obs.comp, e.comp)
+        assert_equal(obs.mass, e.mass)
+    exp = [mat.collapse_elements({922350000}) for mat in mats]
+    collapse_elements(mats, {922350000})
+    for obs, e in zip(mats, exp):
+        assert_equal(obs.comp, e.comp)
+    assert_true(922350000 in mats[0].comp)
+    assert_true(60000000 in mats[1].comp)
+
 def test_collapse_elements1():
     """ Very simple test to combine nucids"""
     nucvec = {10010000:  1.0,
@@ -603,6 +717,12 @@ class TestMassSubMaterialMethods(TestCase):
         assert_equal(mat1.comp[691690000], 1.0/3.0)
         assert_equal(mat1.mass, 3.0)
 
+    def test_group_masses(self):
+        mat = Material(nucvec)
+        obs = mat.group_masses([nucname.act, nucname.fp, nucname.ma, [1, 8]])
+        assert_equal(obs, [6.0, 3.0, 2.0, 2.0])
+        assert_equal(mat.group_masses([]), [])
+
     def test_sub_range(self):
         mat = Material(nucvec)
         mat1 = mat.sub_range(920000000, 930000000)
@@ -1177,6 +1297,19 @@ def test_multimaterial_mix_composition():
     assert_equal(mat4.comp[300000000], 0.14881933003844042)
 
 
+def test_mix():
+    mat1 = Material(nucvec={120240000:0.3, 300000000:0.2, 10010000:0.1}, density=2.71)
+    mat2 = Material(nucvec={60120000:0.2, 280640000:0.5, 10010000:0.12}, density=8.0)
+    obs = mix([mat1, mat2], [0.5, 0.21])
+    exp = mat1*0.5 + mat2*0.21
+    assert_almost_equal(obs.mass, exp.mass)
+    assert_equal(set(obs.comp.keys()), set(exp.comp.keys()))
+    for nuc, frac in exp.comp.items():
+        assert_almost_equal(obs.comp[nuc], frac)
+    assert_equal(len(mix([], [])), 0)
+    assert_raises(ValueError, mix, [mat1, mat2], [1.0])
+
+
 def test_multimaterial_mix_density():
     mat1 = Material(nucvec={120240000:0.3, 300000000:0.2, 10010000:0.1}, density=1.0)
     mat2 = Material(nucvec={60120000:0.2, 280640000:0.5, 10010000:0.12}, density=2.0)
@@ -1780,6 +1913,28 @@ def test_matlib_json():
         assert_mat_almost_equal(wmatlib[key], rmatlib[key])
     os.remove(filename)
 
+def test_matlib_json_compact():
+    filename = "matlib_compact.json"
+    water = Material()
+    water.from_atom_frac({10000000: 2.0, 80000000: 1.0})
+    water.metadata["name"] = "Aqua \"sera\"."
+    water.metadata["tags"] = [1, 2.5, "x"]
+    lib = {"leu": Material(leu), "nucvec": nucvec, "aqua": water}
+    wmatlib = MaterialLibrary(lib)
+    wmatlib.write_json(filename, compact=True)
+    with open(filename) as f:
+        assert_equal(1, len(f.read().splitlines()))
+    rmatlib = MaterialLibrary()
+    rmatlib.from_json(filename)
+    assert_equal(set(wmatlib), set(rmatlib))
+    for key in rmatlib:
+        assert_mat_almost_equal(wmatlib[key], rmatlib[key])
+    with open(filename) as f:
+        flib = MaterialLibrary()
+        flib.from_json(f)
+    assert_equal(set(wmatlib), set(flib))
+    os.remove(filename)
+
 def test_matlib_hdf5_nuc_data():
     matlib = MaterialLibrary()
     matlib.from_hdf5(nuc_data, datapath="/material_library/materials",
@@ -1882,6 +2037,25 @@ def test_material_xrays():
      (105.0, 2.5103988972247685e-21),
      (13.0, 3.4433858449448927e-17)])
 
+def test_photon_source():
+    mat = Material({"U238": 0.96, "U235": 0.04})
+    e_bounds = [0.0, 50.0, 100.0, 200.0, 1000.0]
+    exp = np.zeros(4)
+    for e, i in mat.photons():
+        if not np.isnan(i) and e_bounds[0] <= e <= e_bounds[-1]:
+            g = min(np.searchsorted(e_bounds, e, side='right') - 1, 3)
+            exp[g] += i
+    obs = mat.photon_source(e_bounds)
+    assert_array_almost_equal(exp / exp.sum(), obs / obs.sum())
+    assert_almost_equal(1.0, mat.photon_source(e_bounds, True).sum())
+    mats = [mat, Material({"Co60": 1.0}), mat]
+    src = photon_sources(mats, e_bounds)
+    assert_equal((3, 4), src.shape)
+    for m, row in zip(mats, src):
+        assert_array_equal(m.photon_source(e_bounds), row)
+    assert_raises(ValueError, mat.photon_source, [2.0, 1.0])
+
+
 def test_material_photons():
     leu = {"U238": 0.96, "U235": 0.04}
     mat = Material(leu)
@@ -2019,6 +2193,35 @@ def test_decay_h3():
     assert_almost_equal(0.5, obs[nucname.id('H3')])
     assert_almost_equal(0.5, obs[nucname.id('He3')])
 
+def test_decay_times():
+    mat = Material({'H3': 1.0, 'U235': 1.0}, 3.0)
+    ts = [0.0, data.half_life('H3'), 2 * data.half_life('H3')]
+    obs = mat.decay(ts)
+    assert_equal(len(ts), len(obs))
+    for t, m in zip(ts, obs):
+        exp = mat.decay(t)
+        assert_equal(set(exp.comp), set(m.comp))
+        for nuc in exp.comp:
+            assert_almost_equal(exp.comp[nuc], m.comp[nuc], 15)
+        assert_almost_equal(exp.mass, m.mass)
+
+def test_decay_series():
+    mat = Material({'H3': 0.5, 'O16': 0.5}, 3.0)
+    ts = [0.0, data.half_life('H3'), 2 * data.half_life('H3')]
+    nucs, moles = mat.decay_series(ts)
+    assert_equal(nucs, sorted(nucs))
+    assert_equal((len(ts), len(nucs)), moles.shape)
+    h3 = nucs.index(nucname.id('H3'))
+    assert_almost_equal(0.25, moles[2, h3] / moles[0, h3])
+    for t, row in zip(ts, moles):
+        exp = mat.decay(t)
+        for nuc, m in zip(nucs, row):
+            assert_almost_equal(exp.comp.get(nuc, 0.0) * exp.mass,
+                                m * data.atomic_mass(nuc))
+    nucs, act = mat.decay_series(ts, 'activity')
+    assert_almost_equal(act[0, h3], mat.activity()[nucname.id('H3')])
+    assert_raises(ValueError, mat.decay_series, ts, 'dose')
+
 def test_decay_u235_h3():
     mat = Material({'U235': 1.0, 'H3': 1.0})
     obs = mat.decay(365.25 * 24.0 * 3600.0)
@@ -2156,6 +2359,62 @@ def test_cram_h3():
     assert_almost_equal(0.5, obs[nucname.id('He3')])
 
 
+def test_cram_series():
+    mat = Material({'H3': 1.0, 'O16': 1.0}, 2.0)
+    A = -cram.DECAY_MATRIX
+    hl = data.half_life('H3')
+    # equal steps, a repeated time, a longer step, and steps that are only
+    # equal up to the rounding of the times
+    ts = [0.0, hl, 2 * hl, 2 * hl, 3.5 * hl] + [0.1 * i * hl
+                                                 for i in range(36, 40)]
+    nucs, moles = mat.cram_series(ts, A, order=16)
+    assert_equal((len(ts), len(nucs)), moles.shape)
+    h3 = nucs.index(nucname.id('H3'))
+    assert_almost_equal(0.25, moles[2, h3] / moles[0, h3])
+    assert_equal(list(moles[2]), list(moles[3]))
+    for t, row in zip(ts, moles):
+        exp = mat.cram(A * t, order=16)
+        for nuc, m in zip(nucs, row):
+            e = exp.comp.get(nuc, 0.0) * exp.mass
+            assert_almost_equal(e, m * data.atomic_mass(nuc),
+                                delta=1e-10 * exp.mass)
+    assert_raises(ValueError, mat.cram_series, [hl, 0.0], A)
+
+
+def test_transmute_all():
+    mats = [Material({'H3': 1.0}, mass=2.0, density=1.5,
+                     metadata={'voxel': i}) for i in range(5)]
+    A = -cram.DECAY_MATRIX * data.half_life('H3')
+    exp = mats[0].cram(A, order=16)
+    transmute_all(mats, A, order=16)
+    for i, mat in enumerate(mats):
+        obs = mat.to_atom_frac()
+        assert_almost_equal(0.5, obs[nucname.id('H3')])
+        assert_almost_equal(0.5, obs[nucname.id('He3')])
+        assert_almost_equal(exp.mass, mat.mass)
+        assert_equal(1.5, mat.density)
+        assert_equal(mat.metadata['voxel'], i)
+
+
+def test_write_mcnp_fluka():
+    mats = [Material({'H1': 0.1 + 0.01*i, 'O': 0.5, 'U': 0.04*i},
+                     density=1.0 + 0.1*i,
+                     metadata={'name': 'vox{0}'.format(i), 'mat_number': i + 1,
+                               'fluka_name': 'VOX{0}'.format(i)})
+            for i in range(100)]
+    for num_threads in (1, 3):
+        if os.path.isfile('deck.txt'):
+            os.remove('deck.txt')
+        write_mcnp('deck.txt', mats, 'atom', False, num_threads=num_threads)
+        write_fluka('deck.txt', mats, 25, num_threads=num_threads)
+        with open('deck.txt') as f:
+            obs = f.read()
+        exp = ''.join([mat.mcnp('atom', False) for mat in mats])
+        exp += ''.join([mat.fluka(25 + i) for i, mat in enumerate(mats)])
+        assert_equal(exp, obs)
+    os.remove('deck.txt')
+
+
 # Run as script
 #
 if __name__ == "__main__":
@@ -125,6 +125,16 @@ def test_id():
 
     assert_raises(RuntimeError, nucname.id, '0-H-1')
 
+def test_id_string_forms():
+    # forms resolved without the general parser agree with their other forms
+    assert_equal(nucname.id("am-242m"), nucname.id("95-Am-242m"))
+    assert_equal(nucname.id("U235"), nucname.id("U-235"))
+    assert_equal(nucname.id("235u"), nucname.id("U235"))
+    assert_equal(nucname.id("922350"), nucname.id(922350))
+    assert_equal(nucname.id("og"), 1180000000)
+    assert_raises(RuntimeError, nucname.id, "Uu235")
+    assert_raises(RuntimeError, nucname.id, "U235q")
+
 def test_name():
     assert_equal(nucname.name(942390), "Pu239")
     assert_equal(nucname.name(952421), "Am242M")
@@ -106,6 +106,17 @@ def test_id_not():
     assert_raises(RuntimeError, rxname.id, "Waka waka")
     assert_raises(RuntimeError, rxname.id, 0)
 
+def test_lookup_all():
+    for name in rxname.names:
+        rxid = rxname.id(name)
+        assert_equal(rxid, _hash(name))
+        assert_equal(rxname.name(rxid), name)
+    for alt, rxid in rxname.altnames.items():
+        assert_equal(rxname.id(alt), rxid)
+    for mt, rxid in rxname.mt_id.items():
+        assert_equal(rxname.id(mt), rxid)
+        assert_equal(rxname.mt(rxid), mt)
+
 def test_mt_names():
     assert_equal(rxname.mt("a"), 107)
     assert_equal(rxname.mt("total"), 1)
@@ -20,7 +20,8 @@ except ImportError:
     from nose.plugins.skip import SkipTest
     raise SkipTest
 
-from pyne.source_sampling import Sampler, AliasTable
+from pyne.source_sampling import Sampler, PartitionedSampler, AliasTable, \
+    E_LOG, E_TABULATED, measure_many
 from pyne.mesh import Mesh, NativeMeshTag
 from pymoab import core as mb_core, types
 from pyne.utils import QAWarning
@@ -344,6 +345,203 @@ def test_uniform():
                / expected_e_tally[i] < 0.1)
 
 
+def _rm_mesh_and_alias_table_files():
+    try_rm_file('sampling_mesh.h5m')()
+    try_rm_file('sampling_alias.h5')()
+
+
+@with_setup(None, _rm_mesh_and_alias_table_files)
+def test_uniform_alias_table_file():
+    """This test tests the two-level alias table built when an alias table
+    sidecar file is given, using the same problem and hand calculations as
+    test_uniform(). The table must be written to the sidecar, and a second
+    sampler must read it back and sample identically.
+    """
+    seed(1953)
+    m = Mesh(structured=True,
+             structured_coords=[[0, 3, 3.5], [0., 1.], [0., 1.]],
+             mats=None)
+    m.src = NativeMeshTag(2, float)
+    m.src[:] = [[2.0, 1.0], [9.0, 3.0]]
+    e_bounds = np.array([0., 0.5, 1.0])
+    filename = "sampling_mesh.h5m"
+    cell_fracs = np.zeros(2, dtype=[('idx', np.int64),
+                                    ('cell', np.int64),
+                                    ('vol_frac', np.float64),
+                                    ('rel_error', np.float64)])
+    cell_fracs[:] = [(0, 11, 1.0, 0.0),
+                     (1, 11, 1.0, 0.0)]
+    m.tag_cell_fracs(cell_fracs)
+    m.write_hdf5(filename)
+    tag_names = {"src_tag_name": "src",
+                 "cell_number_tag_name": "cell_number",
+                 "cell_fracs_tag_name": "cell_fracs",
+                 "alias_table_file": "sampling_alias.h5"}
+    sampler = Sampler(filename, tag_names, e_bounds, DEFAULT_UNIFORM)
+    assert(os.path.exists("sampling_alias.h5"))
+
+    num_samples = 10000
+    score = 1.0/num_samples
+    e_tally = np.zeros(shape=(4))
+    for i in range(num_samples):
+        s = sampler.particle_birth(np.array([uniform(0, 1) for x in range(6)]))
+        if s.x < 3.0:
+            assert_almost_equal(s.w, 0.7)  # hand calcs
+        else:
+            assert_almost_equal(s.w, 2.8)  # hand calcs
+        if s.x < 3 and s.e < 0.5:
+            e_tally[0] += score
+        elif s.x < 3 and s.e > 0.5:
+            e_tally[1] += score
+        if s.x > 3 and s.e < 0.5:
+            e_tally[2] += score
+        if s.x > 3 and s.e > 0.5:
+            e_tally[3] += score
+
+    expected_e_tally = [4./7, 2./7, 3./28, 1./28]  # hand calcs
+    for i in range(4):
+        assert(abs(e_tally[i] - expected_e_tally[i])
+               / expected_e_tally[i] < 0.1)
+
+    # a second sampler reads the sidecar
+    loaded = Sampler(filename, tag_names, e_bounds, DEFAULT_UNIFORM)
+    for i in range(100):
+        rands = np.array([uniform(0, 1) for x in range(6)])
+        s = sampler.particle_birth(rands)
+        t = loaded.particle_birth(rands)
+        assert_equal((s.x, s.y, s.z, s.e, s.w), (t.x, t.y, t.z, t.e, t.w))
+
+    # the sidecar must match the mode it was built for
+    assert_raises(RuntimeError, Sampler, filename, tag_names, e_bounds,
+                  DEFAULT_ANALOG)
+
+
+def _rm_mesh_and_state_files():
+    try_rm_file('sampling_mesh.h5m')()
+    try_rm_file('sampling_mesh.state')()
+    try_rm_file('sampling_alias.h5')()
+
+
+@with_setup(None, _rm_mesh_and_state_files)
+def test_sampler_state():
+    """This test tests that a sampler read from a state file samples exactly
+    like the sampler that wrote it, for biased sub-voxel sampling as well as
+    for the two-level alias table.
+    """
+    seed(1953)
+    m = Mesh(structured=True,
+             structured_coords=[[0, 0.5, 1], [0, 1], [0, 1]],
+             mats=None)
+    cell_fracs = np.zeros(4, dtype=[('idx', np.int64),
+                                    ('cell', np.int64),
+                                    ('vol_frac', np.float64),
+                                    ('rel_error', np.float64)])
+    cell_fracs[:] = [(0, 11, 0.5, 0.0), (0, 12, 0.5, 0.0),
+                     (1, 11, 0.25, 0.0), (1, 13, 0.75, 0.0)]
+    m.tag_cell_fracs(cell_fracs)
+    m.src = NativeMeshTag(4, float)
+    m.src[:] = [[1.0, 2.0, 3.0, 4.0], [5.0, 6.0, 7.0, 8.0]]
+    m.bias = NativeMeshTag(4, float)
+    m.bias[:] = [[1.0, 1.0, 2.0, 2.0], [3.0, 3.0, 4.0, 4.0]]
+    filename = "sampling_mesh.h5m"
+    m.write_hdf5(filename)
+    tag_names = {"src_tag_name": "src",
+                 "cell_number_tag_name": "cell_number",
+                 "cell_fracs_tag_name": "cell_fracs",
+                 "bias_tag_name": "bias"}
+    alias_tag_names = dict(tag_names, alias_table_file="sampling_alias.h5")
+    cases = [(SUBVOXEL_ANALOG, np.array([0, 0.5, 1.0]), tag_names),
+             (SUBVOXEL_USER, np.array([0, 0.5, 1.0]), tag_names),
+             (DEFAULT_UNIFORM, np.array([0, 0.25, 0.5, 0.75, 1.0]),
+              alias_tag_names)]
+
+    for mode, e_bounds, names in cases:
+        sampler = Sampler(filename, names, e_bounds, mode)
+        sampler.write_state("sampling_mesh.state")
+        loaded = Sampler.read_state("sampling_mesh.state")
+        assert(loaded.matches_source(filename, mode))
+        assert(not loaded.matches_source(filename, (mode + 1) % 6))
+        for i in range(100):
+            rands = np.array([uniform(0, 1) for x in range(6)])
+            s = sampler.particle_birth(rands)
+            t = loaded.particle_birth(rands)
+            assert_equal((s.x, s.y, s.z, s.e, s.w), (t.x, t.y, t.z, t.e, t.w))
+            assert_equal(s.cell_list, t.cell_list)
+
+    assert_raises(RuntimeError, Sampler.read_state, filename)
+
+
+def _rm_partition_files():
+    for f in ('sampling_mesh.h5m', 'sampling_mesh.state',
+              'sampling_part_0.state', 'sampling_part_1.state'):
+        try_rm_file(f)()
+
+
+@with_setup(None, _rm_partition_files)
+def test_partitioned_sampler():
+    """This test tests that a source split into two partitions, a unit hex
+    and a hex of twice the volume and four times the source density, is
+    sampled like the whole source, in analog and uniform modes.
+    """
+    seed(1953)
+    tag_names = {"src_tag_name": "src",
+                 "cell_number_tag_name": "cell_number",
+                 "cell_fracs_tag_name": "cell_fracs"}
+    filename = "sampling_mesh.h5m"
+    for mode in (DEFAULT_ANALOG, DEFAULT_UNIFORM):
+        states = []
+        for i, (coords, q) in enumerate([([0, 1], 1.0), ([1, 3], 4.0)]):
+            m = Mesh(structured=True,
+                     structured_coords=[coords, [0, 1], [0, 1]], mats=None)
+            m.src = NativeMeshTag(1, float)
+            m.src[0] = q
+            cell_fracs = np.zeros(1, dtype=[('idx', np.int64),
+                                            ('cell', np.int64),
+                                            ('vol_frac', np.float64),
+                                            ('rel_error', np.float64)])
+            cell_fracs[:] = [(0, 11 + i, 1.0, 0.0)]
+            m.tag_cell_fracs(cell_fracs)
+            m.write_hdf5(filename)
+            sampler = Sampler(filename, tag_names, np.array([0, 1]), mode)
+            assert_almost_equal(sampler.source_strength,
+                                q*(coords[1] - coords[0]))
+            states.append("sampling_part_{0}.state".format(i))
+            sampler.write_state(states[-1])
+
+        ps = PartitionedSampler(states)
+        assert_equal(ps.num_partitions, 2)
+        assert_equal(ps.cell_list_size, 1)
+        # analog: the partitions are sampled 1:8 with unit weights
+        # uniform: they are sampled 1:2 by volume, with weights 1/3 and 4/3
+        exp = {DEFAULT_ANALOG: (1./9, 1.0, 1.0),
+               DEFAULT_UNIFORM: (1./3, 1./3, 4./3)}[mode]
+        num_samples = 10000
+        tally = 0.0
+        for i in range(num_samples):
+            s = ps.particle_birth(np.array([uniform(0, 1) for x in range(6)]))
+            if s.x < 1.0:
+                tally += 1.0/num_samples
+                assert_almost_equal(s.w, exp[1])
+                assert_equal(s.cell_list, [11])
+            else:
+                assert_almost_equal(s.w, exp[2])
+                assert_equal(s.cell_list, [12])
+            if mode == DEFAULT_ANALOG:
+                assert_equal(s.w, 1.0)
+        assert(abs(tally - exp[0])/exp[0] < 0.1)
+
+    # the shared state is built once and then mapped
+    s = Sampler.read_shared_state("sampling_mesh.state", filename, tag_names,
+                                  np.array([0, 1]), DEFAULT_ANALOG)
+    assert(os.path.exists("sampling_mesh.state"))
+    assert(not os.path.exists("sampling_mesh.state.lock"))
+    t = Sampler.read_shared_state("sampling_mesh.state", filename, tag_names,
+                                  np.array([0, 1]), DEFAULT_ANALOG)
+    for i in range(100):
+        rands = np.array([uniform(0, 1) for x in range(6)])
+        assert_equal(s.particle_birth(rands).x, t.particle_birth(rands).x)
+
+
 @with_setup(None, try_rm_file('sampling_mesh.h5m'))
 def test_single_hex_single_subvoxel_analog():
     """This test tests that particles of sampled evenly within the phase-space
@@ -479,6 +677,55 @@ def test_multiple_hex_multiple_subvoxel_analog():
             assert(abs(halfspace_sum - 0.5)/0.5 < 0.1)
 
 
+@with_setup(None, try_rm_file('sampling_mesh.h5m'))
+def test_multiple_hex_uneven_num_cells():
+    """This test tests that voxels intersecting fewer than max_num_cells cells
+    give cell lists padded with -1 in voxel modes, and never sample the padding
+    in sub-voxel modes.
+    """
+    seed(1953)
+    m = Mesh(structured=True,
+             structured_coords=[[0, 0.5, 1], [0, 1], [0, 1]],
+             mats=None)
+    m.src = NativeMeshTag(3, float)
+    m.src[:] = np.ones(shape=(2, 3))
+    cell_fracs = np.zeros(4, dtype=[('idx', np.int64),
+                                    ('cell', np.int64),
+                                    ('vol_frac', np.float64),
+                                    ('rel_error', np.float64)])
+    cell_fracs[:] = [(0, 11, 0.5, 0.0), (0, 12, 0.25, 0.0),
+                     (0, 13, 0.25, 0.0), (1, 21, 1.0, 0.0)]
+    m.tag_cell_fracs(cell_fracs)
+    filename = "sampling_mesh.h5m"
+    m.write_hdf5(filename)
+    tag_names = {"src_tag_name": "src",
+                 "cell_number_tag_name": "cell_number",
+                 "cell_fracs_tag_name": "cell_fracs"}
+    # in voxel modes the three values are energy groups
+    sampler = Sampler(filename, tag_names, np.array([0, 1./3, 2./3, 1]),
+                      DEFAULT_ANALOG)
+    for i in range(1000):
+        s = sampler.particle_birth([uniform(0, 1) for x in range(6)])
+        if s.x < 0.5:
+            assert_equal(list(s.cell_list), [11, 12, 13])
+        else:
+            assert_equal(list(s.cell_list), [21, -1, -1])
+
+    # in sub-voxel modes they are the sub-voxels of a single group
+    sampler = Sampler(filename, tag_names, np.array([0, 1]), SUBVOXEL_ANALOG)
+    num_samples = 20000
+    score = 1.0/num_samples
+    tally = {11: 0.0, 12: 0.0, 13: 0.0, 21: 0.0}
+    for i in range(num_samples):
+        s = sampler.particle_birth([uniform(0, 1) for x in range(6)])
+        assert(s.cell_list[0] in tally)
+        tally[s.cell_list[0]] += score
+    # each sub-voxel has the same source density, so the cells are sampled in
+    # proportion to their volumes
+    for c, exp in [(11, 0.25), (12, 0.125), (13, 0.125), (21, 0.5)]:
+        assert(abs(tally[c] - exp)/exp < 0.05)
+
+
 @with_setup(None, try_rm_file('sampling_mesh.h5m'))
 def test_single_hex_subvoxel_uniform():
     """This test tests that particles of sampled evenly within the phase-space
@@ -980,6 +1227,104 @@ def test_subvoxel_multiple_hex_bias_e_groups():
                            ) / exp_tally[v, c, e] < 0.05)
 
 
+@with_setup(None, try_rm_file('sampling_mesh.h5m'))
+def test_log_energy_sampling():
+    """This test tests that with log in-group energy sampling a single energy
+    group spanning two decades is sampled equally in each decade.
+    """
+    seed(1953)
+    m = Mesh(structured=True, structured_coords=[[0, 1], [0, 1], [0, 1]],
+             mats=None)
+    m.src = NativeMeshTag(1, float)
+    m.src[0] = 1.0
+    cell_fracs = np.zeros(1, dtype=[('idx', np.int64),
+                                    ('cell', np.int64),
+                                    ('vol_frac', np.float64),
+                                    ('rel_error', np.float64)])
+    cell_fracs[:] = [(0, 11, 1.0, 0.0)]
+    m.tag_cell_fracs(cell_fracs)
+    filename = "sampling_mesh.h5m"
+    m.write_hdf5(filename)
+    tag_names = {"src_tag_name": "src",
+                 "cell_number_tag_name": "cell_number",
+                 "cell_fracs_tag_name": "cell_fracs"}
+
+    # log sampling needs positive energy bounds
+    sampler = Sampler(filename, tag_names, np.array([0, 1]), DEFAULT_ANALOG)
+    assert_raises(ValueError, sampler.set_energy_mode, E_LOG)
+    # tabulated sampling needs group spectra
+    assert_raises(ValueError, sampler.set_energy_mode, E_TABULATED)
+
+    sampler = Sampler(filename, tag_names, np.array([1, 100]), DEFAULT_ANALOG)
+    sampler.set_energy_mode(E_LOG)
+    num_samples = 5000
+    below = 0
+    for i in range(num_samples):
+        s = sampler.particle_birth(np.array([uniform(0, 1) for x in range(6)]))
+        assert(1.0 <= s.e <= 100.0)
+        if s.e < 10.0:
+            below += 1
+    assert(abs(below/float(num_samples) - 0.5) < 0.05)
+
+
+@with_setup(None, try_rm_file('sampling_mesh.h5m'))
+def test_tabulated_group_spectra():
+    """This test tests sampling energies from tabulated in-group sub-spectra.
+    The first group is split into two sub-bins with a 3:1 probability ratio,
+    the second group has no sub-spectrum and is sampled uniformly.
+    """
+    seed(1953)
+    m = Mesh(structured=True, structured_coords=[[0, 1], [0, 1], [0, 1]],
+             mats=None)
+    m.src = NativeMeshTag(2, float)
+    m.src[:] = [[1.0, 1.0]]
+    cell_fracs = np.zeros(1, dtype=[('idx', np.int64),
+                                    ('cell', np.int64),
+                                    ('vol_frac', np.float64),
+                                    ('rel_error', np.float64)])
+    cell_fracs[:] = [(0, 11, 1.0, 0.0)]
+    m.tag_cell_fracs(cell_fracs)
+    filename = "sampling_mesh.h5m"
+    m.write_hdf5(filename)
+    tag_names = {"src_tag_name": "src",
+                 "cell_number_tag_name": "cell_number",
+                 "cell_fracs_tag_name": "cell_fracs"}
+    sampler = Sampler(filename, tag_names, np.array([0, 1, 2]),
+                      DEFAULT_ANALOG)
+    # sub-bins outside of the group
+    assert_raises(ValueError, sampler.set_group_spectra,
+                  [[0, 0.5, 1.5], []], [[1, 1], []])
+    # bounds without probabilities, and probabilities without bounds
+    assert_raises(ValueError, sampler.set_group_spectra,
+                  [[0, 0.25, 1], []], [[], []])
+    assert_raises(ValueError, sampler.set_group_spectra,
+                  [[], []], [[3, 1], []])
+    # too few and too many bounds for the probabilities
+    assert_raises(ValueError, sampler.set_group_spectra,
+                  [[0, 1], []], [[3, 1], []])
+    assert_raises(ValueError, sampler.set_group_spectra,
+                  [[0, 0.25, 0.5, 1], []], [[3, 1], []])
+    sampler.set_group_spectra([[0, 0.25, 1], []], [[3, 1], []])
+
+    num_samples = 5000
+    score = 1.0/num_samples
+    tally = np.zeros(4)
+    for i in range(num_samples):
+        s = sampler.particle_birth(np.array([uniform(0, 1) for x in range(6)]))
+        assert_equal(s.w, 1.0)
+        if s.e < 0.25:
+            tally[0] += score
+        elif s.e < 1.0:
+            tally[1] += score
+        elif s.e < 1.5:
+            tally[2] += score
+        else:
+            tally[3] += score
+    exp_tally = np.array([0.375, 0.125, 0.25, 0.25])
+    for i in range(4):
+        assert(abs(tally[i] - exp_tally[i])/exp_tally[i] < 0.1)
+
+
 def test_alias_table():
     """This tests that the AliasTable class produces samples in the ratios
     consistant with the supplied PDF.
@@ -999,6 +1344,21 @@ def test_alias_table():
         assert(abs(tally[i] - pdf[i])/pdf[i] < 0.05)
 
 
+def test_alias_table_threads():
+    """This tests that an AliasTable built with several threads holds exactly
+    the probability of each bin of the PDF.
+    """
+    seed(1953)
+    pdf = np.array([uniform(0, 1)**4 for i in range(20000)])
+    pdf /= np.sum(pdf)
+    n = len(pdf)
+    for num_threads in [1, 4]:
+        at = AliasTable(pdf, num_threads)
+        mass = at.prob / n
+        np.add.at(mass, at.alias, (1.0 - at.prob) / n)
+        assert(np.allclose(mass, pdf, rtol=1e-9, atol=1e-15))
+
+
 def point_in_tet(t, p):
     """ This function determines if some point <p> lies within some tetrahedron
     <t> using the method described here:
@@ -1757,3 +2117,22 @@ def _source_sampling_test_template(mode, cell_fracs_list, src_tag,
             assert(abs(e_dis[i] - e_dis_exp[i]) / e_dis_exp[i] < 0.05)
         else:
             assert_equal(e_dis[i], 0.0)
+
+
+def test_measure_many():
+    """Tests the vectorized volumes against the mesh volumes of each ve."""
+    m = Mesh(structured=True,
+             structured_coords=[[0, 1, 3], [0, 0.5, 1], [0, 2]],
+             mats=None)
+    ves = list(m.structured_iterate_hex("xyz"))
+    coords = [m.mesh.get_coords(m.mesh.get_connectivity(ve)).reshape(8, 3)
+              for ve in ves]
+    volumes = measure_many(coords)
+    assert_array_almost_equal(volumes, [m.elem_volume(ve) for ve in ves])
+
+    tets = [[[0, 0, 0], [1, 0, 0], [0, 1, 0], [0, 0, 1]],
+            [[0, 0, 0], [2, 0, 0], [0, 3, 0], [0, 0, 1]]]
+    assert_array_almost_equal(measure_many(tets), [1.0/6.0, 1.0])
+    assert_equal(len(measure_many(np.zeros((0, 4, 3)))), 0)
+    assert_raises(ValueError, measure_many, np.zeros((2, 5, 3)))
+
@@ -10,7 +10,7 @@ from nose.tools import assert_equal, assert_not_equal, assert_raises, raises, \
 
 from pyne.utils import QAWarning
 warnings.simplefilter("ignore", QAWarning)
-from pyne.tally import Tally
+from pyne.tally import Tally, TallyCollection
 from pyne import jsoncpp 
 from pyne import data
 import numpy  as np
@@ -530,6 +530,42 @@ def test_fluka_tally_muonp():
     assert_equal(fluka_string,tally.fluka("-21.0"))
 
 
+def test_tally_collection():
+    clean(["test_tally_collection.h5"])
+    tallies = [Tally("Flux", ["Neutron", "Photon"], i, "Volume",
+                     "Volume %d" % i, "Flux in Cell %d" % i, 1.0 + i)
+               for i in range(10)]
+    tallies.append(Tally("Current","Neutron",14,"Surface","Surface 14",
+                         "Neutron Current Across surface 14",100.0))
+    coll = TallyCollection(tallies)
+    assert_equal(len(coll), 11)
+    # the particle names are shared by the volume tallies
+    assert_equal(len(coll.strings), 2 * 11 + 2)
+    coll.write_hdf5("test_tally_collection.h5", "tally")
+    # a single tally appended after the collection
+    write_photon("test_tally_collection.h5")
+
+    new_coll = TallyCollection()
+    new_coll.from_hdf5("test_tally_collection.h5", "tally")
+    assert_equal(len(new_coll), 12)
+    for exp, obs in zip(tallies, new_coll):
+        assert_equal(exp.tally_type, obs.tally_type)
+        assert_equal(exp.entity_type, obs.entity_type)
+        assert_equal(exp.particle_names, obs.particle_names)
+        assert_equal(exp.entity_id, obs.entity_id)
+        assert_equal(exp.entity_name, obs.entity_name)
+        assert_equal(exp.tally_name, obs.tally_name)
+        assert_equal(exp.entity_size, obs.entity_size)
+    assert_equal(new_coll[-1].tally_name, "Photon Flux in Cell 12")
+
+    # rows of the collection read back as single tallies
+    tally = Tally()
+    tally.from_hdf5("test_tally_collection.h5", "tally", 10)
+    assert_equal(tally.tally_name, tallies[10].tally_name)
+    assert_raises(ValueError, coll.append, Tally())
+    clean(["test_tally_collection.h5"])
+
+
 # Run as script
 #
 if __name__ == "__main__":
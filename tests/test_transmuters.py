@@ -1,5 +1,6 @@
 """Transmuter tests"""
 from nose.tools import assert_equal, assert_almost_equal
+import numpy as np
 
 from pyne import data
 from pyne import cram
@@ -15,6 +16,70 @@ def test_transmuters_cram():
     assert_almost_equal(0.5, n1[nucname.id('He3')])
 
 
+def test_cram_solver():
+    A = -cram.DECAY_MATRIX * data.half_life('H3')
+    solver = transmuters.CramSolver(A, order=16)
+    assert_equal(16, solver.order)
+    n1 = solver.transmute({'H3': 1.0})
+    assert_almost_equal(0.5, n1[nucname.id('H3')])
+    assert_almost_equal(0.5, n1[nucname.id('He3')])
+
+    # a block of dense compositions, one per row
+    idx = dict((nucname.id(nuc), i) for i, nuc in enumerate(cram.NUCS))
+    h3 = idx[nucname.id('H3')]
+    he3 = idx[nucname.id('He3')]
+    b = np.zeros((3, len(cram.NUCS)))
+    b[0, h3] = 1.0
+    b[1, h3] = 2.0
+    b[2, he3] = 1.0
+    x = solver.solve(b)
+    assert_equal(b.shape, x.shape)
+    assert_almost_equal(0.5, x[0, h3])
+    assert_almost_equal(1.0, x[1, h3])
+    assert_almost_equal(1.0, x[1, he3])
+    assert_almost_equal(1.0, x[2, he3])
+    assert_almost_equal(0.5, solver.solve(b[0])[he3])
+
+
+def test_cram_depletion():
+    depletion = transmuters.CramDepletion({'H3': 1.0}, order=16)
+    # two steps of one half-life each, given as rate matrix and length
+    A = -cram.DECAY_MATRIX
+    depletion.step(A, data.half_life('H3'))
+    depletion.step(A, data.half_life('H3'))
+    n1 = depletion.comp()
+    assert_almost_equal(0.25, n1[nucname.id('H3')])
+    assert_almost_equal(0.75, n1[nucname.id('He3')])
+    assert_almost_equal(1.0, depletion.vector.sum())
+    # a step given as a unitless transmutation matrix
+    depletion.step(A * data.half_life('H3'))
+    assert_almost_equal(0.125, depletion.comp()[nucname.id('H3')])
+
+
+def test_cram_matrix_builder():
+    builder = transmuters.CramMatrixBuilder()
+    # no channels gives back the decay rate matrix
+    A = builder.assemble([], data.half_life('H3'))
+    assert_equal(len(cram.DECAY_MATRIX), len(A))
+    assert_almost_equal(0.0, np.abs(A + cram.DECAY_MATRIX *
+                                    data.half_life('H3')).max())
+    h3 = builder.index('H3')
+    he3 = builder.index('He3')
+    assert_equal(cram.IJ[h3, h3], builder.slot(h3, h3))
+
+    # a removal-only channel, then one rebuilt matrix per voxel
+    builder = transmuters.CramMatrixBuilder(decay=False)
+    assert_equal(0, builder.add_channel('H3', child=0))
+    assert_equal(1, builder.num_channels)
+    rate = np.log(2.0)
+    A = builder.assemble([[rate], [2.0 * rate]])
+    assert_equal((2, len(cram.DECAY_MATRIX)), A.shape)
+    n1 = transmuters.cram(A[0], {'H3': 1.0}, order=16)
+    assert_almost_equal(0.5, n1[nucname.id('H3')])
+    n1 = transmuters.cram(A[1], {'H3': 1.0}, order=16)
+    assert_almost_equal(0.25, n1[nucname.id('H3')])
+
+
 # Run as script
 #
 if __name__ == "__main__":
@@ -364,5 +364,17 @@ def test_check_iterable():
     assert(utils.check_iterable(obj))
 
 
+def test_stats():
+    utils.reset_stats()
+    s = utils.stats()
+    assert_in('enabled', s)
+    assert_in('data_loads', s['counters'])
+    assert_in('cram_order_14', s['counters'])
+    assert_in('sampler_setup', s['timers'])
+    assert_equal(set(s['timers']['cram']), set(['calls', 'ns']))
+    assert_equal(0, sum(s['counters'].values()))
+    assert_equal(0, sum(t['calls'] for t in s['timers'].values()))
+
+
 if __name__ == "__main__":
     nose.runmodule()